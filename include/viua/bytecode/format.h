@@ -0,0 +1,63 @@
+#ifndef VIUA_BYTECODE_FORMAT_H
+#define VIUA_BYTECODE_FORMAT_H
+
+#pragma once
+
+#include <cstdint>
+
+/** This header describes layout of bytecode images (executables and libraries).
+ *
+ *  Versioned images begin with a header consisting of magic number and
+ *  a format version byte.
+ *  Rest of the image is laid out as follows:
+ *
+ *      [jump table]        - only in libraries older than version 3
+ *      block ids section   - size, then (name, address) pairs
+ *      function ids section- size, then (name, address) pairs
+ *      symbol table        - size, then hashed index of functions and blocks (since version 2, see symtab.h)
+ *      constant pool       - size, then literals used by instructions (since version 5, see constpool.h)
+ *      inlined code        - size, then ranges of bytecode holding code of inlined functions (since version 6, see inlined.h)
+ *      bytecode            - size, then raw bytecode
+ *
+ *  Targets of jumps and branches are byte offsets relative to
+ *  the jumping instruction so bytecode can be used from any address without relocation.
+ *
+ *  Since version 4 integer operands are encoded as described in operands.h, and
+ *  since version 5 literals are kept in the constant pool instead of being embedded in bytecode.
+ *  Images older than that are upgraded to the current format when they are loaded.
+ *
+ *  Images produced before the header was introduced (format version 0) are still
+ *  readable: they use 16 bit section sizes and addresses, and
+ *  their bytecode size field spans 16 bytes of which only the first two are meaningful.
+ *  Files that begin with neither magic number, and do not parse as such images, are rejected.
+ *
+ *  Relocatable objects (produced by `viua-asm --object`, and linked by `viua-ld`) begin with
+ *  their own magic number so they are never mistaken for runnable images.
+ *  Objects have no symbol table, and carry relocations instead (see linker.h):
+ *
+ *      block ids section   - size, then (name, address) pairs
+ *      function ids section- size, then (name, address) pairs
+ *      constant pool       - size, then literals used by instructions
+ *      relocations         - size, then relocation entries
+ *      bytecode            - size, then raw bytecode
+ */
+
+typedef uint32_t bytecode_size_type;
+
+const char VIUA_MAGIC_NUMBER[] = { 'V', 'I', 'U', 'A' };
+const unsigned VIUA_MAGIC_NUMBER_SIZE = sizeof(VIUA_MAGIC_NUMBER);
+const char VIUA_OBJECT_MAGIC_NUMBER[] = { 'V', 'I', 'U', 'O' };
+
+const uint8_t VIUA_BYTECODE_LEGACY_VERSION = 0;
+const uint8_t VIUA_BYTECODE_SYMTAB_VERSION = 2;
+const uint8_t VIUA_BYTECODE_PIC_VERSION = 3;
+const uint8_t VIUA_BYTECODE_OPERAND_MODE_VERSION = 4;
+const uint8_t VIUA_BYTECODE_CONSTANT_POOL_VERSION = 5;
+const uint8_t VIUA_BYTECODE_INLINED_CODE_VERSION = 6;
+const uint8_t VIUA_BYTECODE_VERSION = 6;
+
+const unsigned VIUA_LEGACY_SIZE_FIELD_SIZE = sizeof(uint16_t);
+const unsigned VIUA_LEGACY_BYTECODE_SIZE_FIELD_SIZE = 16;
+
+
+#endif
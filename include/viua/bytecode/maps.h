@@ -7,106 +7,171 @@
 #include <vector>
 #include <string>
 #include <viua/bytecode/opcodes.h>
+#include <viua/bytecode/operands.h>
 
 
+/** Sizes of instructions in bytes.
+ *
+ *  These are the sizes of instructions with all integer operands encoded as narrow ones.
+ *  Every wide operand adds (OPERAND_WIDE_SIZE - OPERAND_NARROW_SIZE) bytes, and
+ *  variable-length instructions are followed by their strings.
+ */
 const std::map<std::string, unsigned> OP_SIZES = {
     { "nop",    sizeof(byte) },
 
-    { "izero",  sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "istore", sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "iadd",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "isub",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "imul",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "idiv",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "iinc",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "idec",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "ilt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "ilte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "igt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "igte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "ieq",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-
-    { "fstore", sizeof(byte) + sizeof(bool) + sizeof(int) + sizeof(float) },
-    { "fadd",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "fsub",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "fmul",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "fdiv",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "flt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "flte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "fgt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "fgte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "feq",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-
-    { "bstore", sizeof(byte) + 2*sizeof(bool) + sizeof(int) + sizeof(byte) },
-    { "badd",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "bsub",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "binc",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "bdec",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "blt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "blte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "bgt",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "bgte",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "beq",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-
-    { "itof",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "ftoi",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "stoi",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "stof",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-
-    { "strstore",sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "streq",  sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-
-    { "vec",    sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "vinsert",sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "vpush",  sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "vpop",   sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "vat",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "vlen",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-
-    { "bool",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "not",    sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "and",    sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-    { "or",     sizeof(byte) + 3*sizeof(bool) + 3*sizeof(int) },
-
-    { "move",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "copy",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "ref",    sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "swap",   sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "free",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "empty",  sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "isnull", sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
+    { "izero",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "istore", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "iadd",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "isub",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "imul",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "idiv",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "iinc",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "idec",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "ilt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "ilte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "igt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "igte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "ieq",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "iaddi", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "isubi", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "imuli", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "idivi", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "ilti", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "iltei", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "igti", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "igtei", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "ieqi", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "tiadd", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tisub", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "timul", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tidiv", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tilt", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tilte", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tigt", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tigte", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "tieq", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "giadd", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gisub", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gimul", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gidiv", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gilt", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gilte", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gigt", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gigte", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "gieq", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "fstore", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "fadd",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "fsub",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "fmul",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "fdiv",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "flt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "flte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "fgt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "fgte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "feq",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "faddi", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fsubi", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fmuli", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fdivi", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "flti", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fltei", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fgti", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "fgtei", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+    { "feqi", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE + sizeof(float) },
+
+    { "bstore", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "badd",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "bsub",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "binc",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "bdec",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "blt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "blte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "bgt",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "bgte",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "beq",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "itof",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "ftoi",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "stoi",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "stof",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+
+    { "strstore",sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "streq",  sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "strbuild",sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "strappend",sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "strappendr",sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "strfinal",sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "strlen", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "stradd", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "strsub", sizeof(byte) + OPERAND_MODE_SIZE + 4*OPERAND_NARROW_SIZE },
+    { "strfind",sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "strcmp", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "strsplit",sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "atom",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "atomeq", sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "vec",    sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "vinsert",sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "vpush",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "vpop",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "vat",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "vlen",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "vslice", sizeof(byte) + OPERAND_MODE_SIZE + 4*OPERAND_NARROW_SIZE },
+    { "vsat",   sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "vslen",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "vsmat",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+
+    { "bool",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "not",    sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "and",    sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+    { "or",     sizeof(byte) + OPERAND_MODE_SIZE + 3*OPERAND_NARROW_SIZE },
+
+    { "move",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "copy",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "ref",    sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "swap",   sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "free",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "empty",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "isnull", sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
     { "ress",   sizeof(byte) + sizeof(int) },
-    { "tmpri",  sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "tmpro",  sizeof(byte) + sizeof(bool) + sizeof(int) },
+    { "tmpri",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "tmpro",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
 
-    { "print",  sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "echo",   sizeof(byte) + sizeof(bool) + sizeof(int) },
+    { "print",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "echo",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
 
-    { "clbind", sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "closure",sizeof(byte) + sizeof(bool) + sizeof(int) },
+    { "clbind", sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "closure",sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
 
-    { "function",sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "fcall",  sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
+    { "function",sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "fcall",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
 
-    { "frame",  sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "param",  sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "paref",  sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "call",   sizeof(byte) + sizeof(bool) + sizeof(int) },
-    { "arg",    sizeof(byte) + 2*sizeof(bool) + 2*sizeof(int) },
-    { "argc",   sizeof(byte) + sizeof(bool) + sizeof(int) },
+    { "frame",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "param",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "paref",  sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "call",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
+    { "tailcall", sizeof(byte) },
+    { "arg",    sizeof(byte) + OPERAND_MODE_SIZE + 2*OPERAND_NARROW_SIZE },
+    { "argc",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
 
     { "jump",   sizeof(byte) + sizeof(int) },
-    { "branch", sizeof(byte) + sizeof(bool) + 3*sizeof(int) },
+    { "branch", sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE + 2*sizeof(int) },
 
-    { "throw",  sizeof(byte) + sizeof(int) + sizeof(bool) },
+    { "throw",  sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
     { "catch",  sizeof(byte) }, // catch "<type>" <block>
-    { "pull",   sizeof(byte) + sizeof(bool) + sizeof(int) }, // pull <register>
+    { "pull",   sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE }, // pull <register>
     { "tryframe", sizeof(byte) },
     { "try",    sizeof(byte) },
     { "leave",  sizeof(byte) },
 
     { "eximport", sizeof(byte) },
-    { "excall", sizeof(byte) + sizeof(bool) + sizeof(int) },
+    { "excall", sizeof(byte) + OPERAND_MODE_SIZE + OPERAND_NARROW_SIZE },
 
     { "link",   sizeof(byte) },
 
@@ -115,6 +180,175 @@ const std::map<std::string, unsigned> OP_SIZES = {
 };
 
 
+/** Number of integer operands of instructions.
+ *
+ *  Instructions with at least one integer operand have an operand-mode byte
+ *  directly after the opcode (see operands.h).
+ */
+const std::map<std::string, unsigned> OP_INTEGER_OPERANDS = {
+    { "nop",    0 },
+
+    { "izero",  1 },
+    { "istore", 2 },
+    { "iadd",   3 },
+    { "isub",   3 },
+    { "imul",   3 },
+    { "idiv",   3 },
+    { "iinc",   1 },
+    { "idec",   1 },
+    { "ilt",    3 },
+    { "ilte",   3 },
+    { "igt",    3 },
+    { "igte",   3 },
+    { "ieq",    3 },
+
+    { "iaddi", 3 },
+    { "isubi", 3 },
+    { "imuli", 3 },
+    { "idivi", 3 },
+    { "ilti", 3 },
+    { "iltei", 3 },
+    { "igti", 3 },
+    { "igtei", 3 },
+    { "ieqi", 3 },
+
+    { "tiadd", 3 },
+    { "tisub", 3 },
+    { "timul", 3 },
+    { "tidiv", 3 },
+    { "tilt", 3 },
+    { "tilte", 3 },
+    { "tigt", 3 },
+    { "tigte", 3 },
+    { "tieq", 3 },
+
+    { "giadd", 3 },
+    { "gisub", 3 },
+    { "gimul", 3 },
+    { "gidiv", 3 },
+    { "gilt", 3 },
+    { "gilte", 3 },
+    { "gigt", 3 },
+    { "gigte", 3 },
+    { "gieq", 3 },
+
+    { "fstore", 2 },
+    { "fadd",   3 },
+    { "fsub",   3 },
+    { "fmul",   3 },
+    { "fdiv",   3 },
+    { "flt",    3 },
+    { "flte",   3 },
+    { "fgt",    3 },
+    { "fgte",   3 },
+    { "feq",    3 },
+
+    { "faddi", 2 },
+    { "fsubi", 2 },
+    { "fmuli", 2 },
+    { "fdivi", 2 },
+    { "flti", 2 },
+    { "fltei", 2 },
+    { "fgti", 2 },
+    { "fgtei", 2 },
+    { "feqi", 2 },
+
+    { "bstore", 2 },
+    { "badd",   3 },
+    { "bsub",   3 },
+    { "binc",   1 },
+    { "bdec",   1 },
+    { "blt",    3 },
+    { "blte",   3 },
+    { "bgt",    3 },
+    { "bgte",   3 },
+    { "beq",    3 },
+
+    { "itof",   2 },
+    { "ftoi",   2 },
+    { "stoi",   2 },
+    { "stof",   2 },
+
+    { "strstore",2 },
+    { "streq",  3 },
+    { "strbuild",1 },
+    { "strappend",2 },
+    { "strappendr",2 },
+    { "strfinal",2 },
+    { "strlen", 2 },
+    { "stradd", 3 },
+    { "strsub", 4 },
+    { "strfind",3 },
+    { "strcmp", 3 },
+    { "strsplit",3 },
+
+    { "atom",   2 },
+    { "atomeq", 3 },
+
+    { "vec",    1 },
+    { "vinsert",3 },
+    { "vpush",  2 },
+    { "vpop",   3 },
+    { "vat",    3 },
+    { "vlen",   2 },
+    { "vslice", 4 },
+    { "vsat",   3 },
+    { "vslen",  2 },
+    { "vsmat",  2 },
+
+    { "bool",   1 },
+    { "not",    1 },
+    { "and",    3 },
+    { "or",     3 },
+
+    { "move",   2 },
+    { "copy",   2 },
+    { "ref",    2 },
+    { "swap",   2 },
+    { "free",   1 },
+    { "empty",  1 },
+    { "isnull", 2 },
+    { "ress",   0 },
+    { "tmpri",  1 },
+    { "tmpro",  1 },
+
+    { "print",  1 },
+    { "echo",   1 },
+
+    { "clbind", 1 },
+    { "closure",1 },
+
+    { "function",1 },
+    { "fcall",  2 },
+
+    { "frame",  2 },
+    { "param",  2 },
+    { "paref",  2 },
+    { "call",   1 },
+    { "tailcall", 0 },
+    { "arg",    2 },
+    { "argc",   1 },
+
+    { "jump",   0 },
+    { "branch", 1 },
+
+    { "throw",  1 },
+    { "catch",  0 },
+    { "pull",   1 },
+    { "tryframe", 0 },
+    { "try",    0 },
+    { "leave",  0 },
+
+    { "eximport", 0 },
+    { "excall", 1 },
+
+    { "link",   0 },
+
+    { "end",    0 },
+    { "halt",   0 },
+};
+
+
 const std::map<enum OPCODE, std::string> OP_NAMES = {
     { NOP,	    "nop" },
 
@@ -132,6 +366,36 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
     { IGTE,     "igte" },
     { IEQ,      "ieq" },
 
+    { IADDI,    "iaddi" },
+    { ISUBI,    "isubi" },
+    { IMULI,    "imuli" },
+    { IDIVI,    "idivi" },
+    { ILTI,     "ilti" },
+    { ILTEI,    "iltei" },
+    { IGTI,     "igti" },
+    { IGTEI,    "igtei" },
+    { IEQI,     "ieqi" },
+
+    { TIADD,    "tiadd" },
+    { TISUB,    "tisub" },
+    { TIMUL,    "timul" },
+    { TIDIV,    "tidiv" },
+    { TILT,     "tilt" },
+    { TILTE,    "tilte" },
+    { TIGT,     "tigt" },
+    { TIGTE,    "tigte" },
+    { TIEQ,     "tieq" },
+
+    { GIADD,    "giadd" },
+    { GISUB,    "gisub" },
+    { GIMUL,    "gimul" },
+    { GIDIV,    "gidiv" },
+    { GILT,     "gilt" },
+    { GILTE,    "gilte" },
+    { GIGT,     "gigt" },
+    { GIGTE,    "gigte" },
+    { GIEQ,     "gieq" },
+
     { FSTORE,   "fstore" },
     { FADD,     "fadd" },
     { FSUB,     "fsub" },
@@ -143,6 +407,16 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
     { FGTE,     "fgte" },
     { FEQ,      "feq" },
 
+    { FADDI,    "faddi" },
+    { FSUBI,    "fsubi" },
+    { FMULI,    "fmuli" },
+    { FDIVI,    "fdivi" },
+    { FLTI,     "flti" },
+    { FLTEI,    "fltei" },
+    { FGTI,     "fgti" },
+    { FGTEI,    "fgtei" },
+    { FEQI,     "feqi" },
+
     { BSTORE,   "bstore" },
     { BADD,     "badd" },
     { BSUB,     "bsub" },
@@ -161,6 +435,19 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
 
     { STRSTORE, "strstore" },
     { STREQ,    "streq" },
+    { STRBUILD, "strbuild" },
+    { STRAPPEND, "strappend" },
+    { STRAPPENDR, "strappendr" },
+    { STRFINAL, "strfinal" },
+    { STRLEN,   "strlen" },
+    { STRADD,   "stradd" },
+    { STRSUB,   "strsub" },
+    { STRFIND,  "strfind" },
+    { STRCMP,   "strcmp" },
+    { STRSPLIT, "strsplit" },
+
+    { ATOM,     "atom" },
+    { ATOMEQ,   "atomeq" },
 
     { VEC,      "vec" },
     { VINSERT,  "vinsert" },
@@ -168,6 +455,10 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
     { VPOP,     "vpop" },
     { VAT,      "vat" },
     { VLEN,     "vlen" },
+    { VSLICE,   "vslice" },
+    { VSAT,     "vsat" },
+    { VSLEN,    "vslen" },
+    { VSMAT,    "vsmat" },
 
     { BOOL,	    "bool" },
     { NOT,	    "not" },
@@ -198,6 +489,7 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
     { PARAM,    "param" },
     { PAREF,    "paref" },
     { CALL,     "call" },
+    { TAILCALL, "tailcall" },
     { ARG,      "arg" },
     { ARGC,     "argc" },
 
@@ -222,10 +514,10 @@ const std::map<enum OPCODE, std::string> OP_NAMES = {
 
 
 const std::vector<enum OPCODE> OP_VARIABLE_LENGTH = {
-    STRSTORE,
     CLOSURE,
     FUNCTION,
     CALL,
+    TAILCALL,
     CATCH,
     TRY,
     EXIMPORT,
@@ -5,7 +5,10 @@
 
 #include <viua/bytecode/bytetypedef.h>
 
-enum OPCODE : byte {
+/*  Opcodes are unsigned, so the instruction set may use the whole byte.
+ *  Read them from bytecode with OPCODE(*ptr) rather than comparing raw bytes.
+ */
+enum OPCODE : unsigned char {
     NOP = 0,    // do nothing
 
     // integer instructions
@@ -122,6 +125,82 @@ enum OPCODE : byte {
 
     END,
     HALT,
+
+    // Opcodes below were added to the instruction set of unversioned images, and
+    // are appended so that instructions of images built before them keep their numbers.
+
+    // string building
+    STRBUILD,
+    STRAPPEND,
+    STRAPPENDR,
+    STRFINAL,
+
+    // vector views
+    VSLICE,
+    VSAT,
+    VSLEN,
+    VSMAT,
+
+    // native string operations
+    STRLEN,
+    STRADD,
+    STRSUB,
+    STRFIND,
+    STRCMP,
+    STRSPLIT,
+
+    // atoms
+    ATOM,
+    ATOMEQ,
+
+    // Opcodes below were added after the layout of images was versioned, and
+    // are appended so that instructions of older images keep their numbers.
+
+    // integer instructions with immediate (literal) second operand
+    IADDI,
+    ISUBI,
+    IMULI,
+    IDIVI,
+    ILTI,
+    ILTEI,
+    IGTI,
+    IGTEI,
+    IEQI,
+
+    // integer instructions specialised by assembler for operands known to be integers, and
+    // guarded ones for operands that are expected to be integers (see assembler::optimize::specialise())
+    TIADD,
+    TISUB,
+    TIMUL,
+    TIDIV,
+    TILT,
+    TILTE,
+    TIGT,
+    TIGTE,
+    TIEQ,
+
+    GIADD,
+    GISUB,
+    GIMUL,
+    GIDIV,
+    GILT,
+    GILTE,
+    GIGT,
+    GIGTE,
+    GIEQ,
+
+    // float instructions with immediate (literal) second operand
+    FADDI,
+    FSUBI,
+    FMULI,
+    FDIVI,
+    FLTI,
+    FLTEI,
+    FGTI,
+    FGTEI,
+    FEQI,
+
+    TAILCALL,   // call given function in place of the current one, returning its value to the caller of the current one
 };
 
 #endif
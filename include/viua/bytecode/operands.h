@@ -0,0 +1,76 @@
+#ifndef VIUA_BYTECODE_OPERANDS_H
+#define VIUA_BYTECODE_OPERANDS_H
+
+#pragma once
+
+#include <cstring>
+#include <viua/bytecode/bytetypedef.h>
+
+/** This header describes encoding of integer operands.
+ *
+ *  Integer operands of an instruction directly follow its opcode, and
+ *  are preceded by a single operand-mode byte.
+ *  Every operand gets two bits in the mode byte (first operand uses the lowest two):
+ *
+ *      OPERAND_REF     - operand is an index of register holding the real operand (`@` in assembly)
+ *      OPERAND_WIDE    - operand is stored as a 32 bit integer instead of a single unsigned byte
+ *
+ *  Most operands are register indexes lower than 256 so
+ *  they take a single byte, and can be read without unaligned loads.
+ *  Instructions without integer operands have no mode byte.
+ */
+
+const byte OPERAND_REF = 0x01;
+const byte OPERAND_WIDE = 0x02;
+
+const unsigned OPERAND_MODE_BITS = 2;
+const unsigned OPERAND_MODE_SIZE = sizeof(byte);
+const unsigned OPERAND_NARROW_SIZE = sizeof(byte);
+const unsigned OPERAND_WIDE_SIZE = sizeof(int);
+const unsigned OPERAND_MAX_COUNT = (8 * OPERAND_MODE_SIZE / OPERAND_MODE_BITS);
+
+
+namespace operands {
+    inline bool isnarrow(int value) {
+        return (value >= 0 and value <= 0xff);
+    }
+
+    inline byte getmode(byte*& addr) {
+        /** Read operand-mode byte and advance past it.
+         */
+        return *(addr++);
+    }
+
+    inline void getint(byte*& addr, byte& mode, bool& ref, int& value) {
+        /** Read next integer operand and advance past it.
+         *
+         *  Bits describing the operand are shifted out of the mode so
+         *  consecutive calls read consecutive operands.
+         */
+        ref = (mode & OPERAND_REF);
+        if (mode & OPERAND_WIDE) {
+            memcpy(&value, addr, OPERAND_WIDE_SIZE);
+            addr += OPERAND_WIDE_SIZE;
+        } else {
+            value = static_cast<unsigned char>(*addr);
+            addr += OPERAND_NARROW_SIZE;
+        }
+        mode = static_cast<byte>(static_cast<unsigned char>(mode) >> OPERAND_MODE_BITS);
+    }
+
+    inline unsigned widening(byte mode) {
+        /** Return number of bytes wide operands described by given mode take
+         *  above the size of narrow ones.
+         */
+        unsigned extra = 0;
+        for (unsigned i = 0; i < OPERAND_MAX_COUNT; ++i) {
+            if ((static_cast<unsigned char>(mode) >> (i*OPERAND_MODE_BITS)) & OPERAND_WIDE) {
+                extra += (OPERAND_WIDE_SIZE - OPERAND_NARROW_SIZE);
+            }
+        }
+        return extra;
+    }
+}
+
+
+#endif
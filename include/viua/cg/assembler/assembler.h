@@ -4,11 +4,15 @@
 #pragma once
 
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <tuple>
 #include <map>
+#include <set>
+#include "../../constpool.h"
 #include "../../program.h"
+#include "../lex.h"
 
 namespace assembler {
     namespace operands {
@@ -16,35 +20,133 @@ namespace assembler {
         byte_op getbyte(const std::string& s);
         float_op getfloat(const std::string& s);
 
-        std::tuple<std::string, std::string> get2(std::string s);
-        std::tuple<std::string, std::string, std::string> get3(std::string s, bool fill_third = true);
+        std::tuple<std::string, std::string> get2(const cg::lex::Line& line);
+        std::tuple<std::string, std::string, std::string> get3(const cg::lex::Line& line, bool fill_third = true);
     }
 
     namespace ce {
-        std::vector<std::string> getilines(const std::vector<std::string>& lines);
+        std::map<std::string, int> getmarks(const std::vector<cg::lex::Line>& lines);
+        std::map<std::string, int> getnames(const std::vector<cg::lex::Line>& lines);
+        std::vector<std::string> getlinks(const std::vector<cg::lex::Line>& lines);
 
-        std::map<std::string, int> getmarks(const std::vector<std::string>& lines);
-        std::map<std::string, int> getnames(const std::vector<std::string>& lines);
-        std::vector<std::string> getlinks(const std::vector<std::string>& lines);
-
-        std::vector<std::string> getFunctionNames(const std::vector<std::string>& lines);
-        std::vector<std::string> getSignatures(const std::vector<std::string>& lines);
-        std::vector<std::string> getBlockNames(const std::vector<std::string>& lines);
-        std::vector<std::string> getBlockSignatures(const std::vector<std::string>& lines);
-        std::map<std::string, std::vector<std::string> > getInvokables(const std::string& type, const std::vector<std::string>& lines);
+        std::vector<std::string> getFunctionNames(const std::vector<cg::lex::Line>& lines);
+        std::vector<std::string> getSignatures(const std::vector<cg::lex::Line>& lines);
+        std::vector<std::string> getBlockNames(const std::vector<cg::lex::Line>& lines);
+        std::vector<std::string> getBlockSignatures(const std::vector<cg::lex::Line>& lines);
+        std::vector<std::string> getInlined(const std::vector<cg::lex::Line>& lines);
+        std::map<std::string, std::vector<cg::lex::Line> > getInvokables(const std::string& type, const std::vector<cg::lex::Line>& lines);
     }
 
     namespace verify {
-        std::string functionCallsAreDefined(const std::vector<std::string>& lines, const std::vector<std::string>& function_names, const std::vector<std::string>& function_signatures);
-        std::string frameBalance(const std::vector<std::string>& lines);
-        std::string callableCreations(const std::vector<std::string>& lines, const std::vector<std::string>& function_names, const std::vector<std::string>& function_signatures);
-        std::string ressInstructions(const std::vector<std::string>& lines, bool as_lib);
-        std::string functionBodiesAreNonempty(const std::vector<std::string>& lines, std::map<std::string, std::vector<std::string> >& functions);
-        std::string blockTries(const std::vector<std::string>& lines, const std::vector<std::string>& block_names, const std::vector<std::string>& block_signatures);
+        std::string functionCallsAreDefined(const std::vector<cg::lex::Line>& lines, const std::vector<std::string>& function_names, const std::vector<std::string>& function_signatures);
+        std::string frameBalance(const std::vector<cg::lex::Line>& lines);
+        std::string inlinedFunctionsAreDefined(const std::vector<cg::lex::Line>& lines, const std::vector<std::string>& function_names);
+        std::string callableCreations(const std::vector<cg::lex::Line>& lines, const std::vector<std::string>& function_names, const std::vector<std::string>& function_signatures);
+        std::string ressInstructions(const std::vector<cg::lex::Line>& lines, bool as_lib);
+        std::string functionBodiesAreNonempty(const std::vector<cg::lex::Line>& lines, std::map<std::string, std::vector<cg::lex::Line> >& functions);
+        std::string blockTries(const std::vector<cg::lex::Line>& lines, const std::vector<std::string>& block_names, const std::vector<std::string>& block_signatures);
         std::string blockBodiesEndWithLeave(const std::vector<std::string>& lines, std::map<std::string, std::pair<bool, std::vector<std::string> > >& blocks);
 
-        std::string directives(const std::vector<std::string>& lines);
-        std::string instructions(const std::vector<std::string>& lines);
+        std::string directives(const std::vector<cg::lex::Line>& lines);
+        std::string instructions(const std::vector<cg::lex::Line>& lines);
+    }
+
+    namespace optimize {
+        /** Optimization passes rewriting bodies of functions and blocks before bytecode is generated.
+         *
+         *  Passes work on tokenised lines and produce lines that assemble like any other source, so
+         *  the rest of the assembler (and the cache) sees no difference between optimized and hand-written code.
+         */
+        struct Change {
+            /** Single rewrite made by a pass, as reported by --opt-report.
+             *  After is empty if the instruction was removed.
+             */
+            std::string pass;
+            unsigned line;
+            std::string before;
+            std::string after;
+        };
+
+        struct Context {
+            /** Facts about the whole module that passes optimizing a single function or block rely on.
+             */
+            // functions whose bodies consist of a sole `end`
+            std::set<std::string> empty_functions;
+            // functions used as closures, their registers may hold bound objects when they start
+            std::set<std::string> closures;
+            // functions may be called (also as closures) by modules this one is linked with
+            bool exported;
+            // module contains jumps to instruction indexes or bytes, so its code must not be moved
+            bool fixed_layout;
+
+            // bodies of functions (local or statically linked) whose calls may be replaced by their code
+            std::map<std::string, std::vector<cg::lex::Line> > inlinable;
+            // inlinable functions that place an object in register 0 before every `end`
+            std::set<std::string> returning;
+            // functions that never place an object in register 0, and make no tail calls
+            std::set<std::string> silent;
+            // functions named by `.inline:` directives, inlined whatever their size
+            std::set<std::string> always_inlined;
+            // smallest register sets functions are given by calls in the module, if all their calls are known
+            std::map<std::string, unsigned> windows;
+        };
+
+        struct Inlined {
+            /** Instructions [begin, end) of a body holding code of an inlined function.
+             */
+            std::string function;
+            unsigned arity;
+            unsigned begin;
+            unsigned end;
+        };
+
+        Context analyse(const std::map<std::string, std::vector<cg::lex::Line> >& functions, const std::map<std::string, std::vector<cg::lex::Line> >& blocks, const std::map<std::string, std::vector<cg::lex::Line> >& linked, const std::set<std::string>& always_inlined, bool exported);
+
+        std::vector<cg::lex::Line> inlineCalls(unsigned level, const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+        std::vector<Inlined> takeInlined(std::vector<cg::lex::Line>& body);
+
+        std::vector<cg::lex::Line> peephole(const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+
+        std::vector<cg::lex::Line> propagate(const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+
+        std::vector<cg::lex::Line> allocate(const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+        std::vector<cg::lex::Line> specialise(const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+        std::map<std::string, unsigned> registerSetSizes(const std::map<std::string, std::vector<cg::lex::Line> >& functions);
+        std::vector<cg::lex::Line> resizeFrames(const std::vector<cg::lex::Line>& body, const std::map<std::string, unsigned>& sizes, const Context& context, std::vector<Change>& changes);
+
+        std::vector<cg::lex::Line> run(unsigned level, const std::string& name, const std::vector<cg::lex::Line>& body, bool block, const Context& context, std::vector<Change>& changes);
+    }
+
+    namespace cache {
+        /** Content-addressed cache of assembled modules and functions.
+         *
+         *  Entries are files named after the hash of everything that affects their contents
+         *  (source, assembler version, linked modules) so stale entries are never found, and
+         *  need no invalidation.
+         */
+        typedef uint64_t key_type;
+
+        struct Invokable {
+            /** Bytecode of a function or block, as produced before it is placed in a module.
+             *
+             *  Jumps to bytes are not yet made relative to the jumping instruction as
+             *  that depends on where the invokable is placed.
+             */
+            std::string bytecode;
+            std::vector<std::tuple<int, int> > jumps_absolute;
+            std::vector<std::tuple<int, int> > jumps_to_byte;
+            std::vector<std::tuple<int, ConstantKind, std::string> > constants;
+        };
+
+        key_type hash(const std::string& s, key_type h = 14695981039346656037ULL);
+        std::string path(const std::string& directory, key_type key, const std::string& extension);
+
+        bool fetch(const std::string& path, std::string& contents);
+        bool store(const std::string& path, const std::string& contents);
+
+        std::string dump(const Invokable& invokable);
+        bool load(const std::string& s, Invokable& invokable);
+        bool relink(Invokable& invokable, ConstantPoolBuilder& constants);
     }
 }
 
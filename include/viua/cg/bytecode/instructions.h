@@ -34,7 +34,37 @@ namespace cg {
         byte* igte(byte*, int_op, int_op, int_op);
         byte* ieq(byte*, int_op, int_op, int_op);
 
-        byte* fstore(byte*, int_op, float);
+        byte* iaddi(byte*, int_op, int_op, int_op);
+        byte* isubi(byte*, int_op, int_op, int_op);
+        byte* imuli(byte*, int_op, int_op, int_op);
+        byte* idivi(byte*, int_op, int_op, int_op);
+        byte* ilti(byte*, int_op, int_op, int_op);
+        byte* iltei(byte*, int_op, int_op, int_op);
+        byte* igti(byte*, int_op, int_op, int_op);
+        byte* igtei(byte*, int_op, int_op, int_op);
+        byte* ieqi(byte*, int_op, int_op, int_op);
+
+        byte* tiadd(byte*, int_op, int_op, int_op);
+        byte* tisub(byte*, int_op, int_op, int_op);
+        byte* timul(byte*, int_op, int_op, int_op);
+        byte* tidiv(byte*, int_op, int_op, int_op);
+        byte* tilt(byte*, int_op, int_op, int_op);
+        byte* tilte(byte*, int_op, int_op, int_op);
+        byte* tigt(byte*, int_op, int_op, int_op);
+        byte* tigte(byte*, int_op, int_op, int_op);
+        byte* tieq(byte*, int_op, int_op, int_op);
+
+        byte* giadd(byte*, int_op, int_op, int_op);
+        byte* gisub(byte*, int_op, int_op, int_op);
+        byte* gimul(byte*, int_op, int_op, int_op);
+        byte* gidiv(byte*, int_op, int_op, int_op);
+        byte* gilt(byte*, int_op, int_op, int_op);
+        byte* gilte(byte*, int_op, int_op, int_op);
+        byte* gigt(byte*, int_op, int_op, int_op);
+        byte* gigte(byte*, int_op, int_op, int_op);
+        byte* gieq(byte*, int_op, int_op, int_op);
+
+        byte* fstore(byte*, int_op, int_op);
         byte* fadd(byte*, int_op, int_op, int_op);
         byte* fsub(byte*, int_op, int_op, int_op);
         byte* fmul(byte*, int_op, int_op, int_op);
@@ -45,6 +75,16 @@ namespace cg {
         byte* fgte(byte*, int_op, int_op, int_op);
         byte* feq(byte*, int_op, int_op, int_op);
 
+        byte* faddi(byte*, int_op, int_op, float);
+        byte* fsubi(byte*, int_op, int_op, float);
+        byte* fmuli(byte*, int_op, int_op, float);
+        byte* fdivi(byte*, int_op, int_op, float);
+        byte* flti(byte*, int_op, int_op, float);
+        byte* fltei(byte*, int_op, int_op, float);
+        byte* fgti(byte*, int_op, int_op, float);
+        byte* fgtei(byte*, int_op, int_op, float);
+        byte* feqi(byte*, int_op, int_op, float);
+
         byte* bstore(byte*, int_op, byte_op);
 
         byte* itof(byte*, int_op, int_op);
@@ -52,7 +92,20 @@ namespace cg {
         byte* stoi(byte*, int_op, int_op);
         byte* stof(byte*, int_op, int_op);
 
-        byte* strstore(byte*, int_op, std::string);
+        byte* strstore(byte*, int_op, int_op);
+        byte* streq(byte*, int_op, int_op, int_op);
+        byte* strbuild(byte*, int_op);
+        byte* strappend(byte*, int_op, int_op);
+        byte* strappendr(byte*, int_op, int_op);
+        byte* strfinal(byte*, int_op, int_op);
+        byte* strlen(byte*, int_op, int_op);
+        byte* stradd(byte*, int_op, int_op, int_op);
+        byte* strsub(byte*, int_op, int_op, int_op, int_op);
+        byte* strfind(byte*, int_op, int_op, int_op);
+        byte* strcmp(byte*, int_op, int_op, int_op);
+        byte* strsplit(byte*, int_op, int_op, int_op);
+        byte* atom(byte*, int_op, int_op);
+        byte* atomeq(byte*, int_op, int_op, int_op);
 
         byte* vec(byte*, int_op);
         byte* vinsert(byte*, int_op, int_op, int_op);
@@ -60,6 +113,10 @@ namespace cg {
         byte* vpop(byte*, int_op, int_op, int_op);
         byte* vat(byte*, int_op, int_op, int_op);
         byte* vlen(byte*, int_op, int_op);
+        byte* vslice(byte*, int_op, int_op, int_op, int_op);
+        byte* vsat(byte*, int_op, int_op, int_op);
+        byte* vslen(byte*, int_op, int_op);
+        byte* vsmat(byte*, int_op, int_op);
 
         byte* lognot(byte*, int_op);
         byte* logand(byte*, int_op, int_op, int_op);
@@ -90,6 +147,7 @@ namespace cg {
         byte* arg(byte*, int_op, int_op);
         byte* argc(byte*, int_op);
         byte* call(byte*, int_op, const std::string&);
+        byte* tailcall(byte*, const std::string&);
 
         byte* jump(byte*, int);
         byte* branch(byte*, int_op, int, int);
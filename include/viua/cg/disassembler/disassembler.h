@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <string>
 #include <tuple>
+#include <viua/bytecode/format.h>
+#include <viua/constpool.h>
 
 
 // Helper functions for checking if a container contains an item.
@@ -17,8 +19,9 @@ template<typename K, typename V> bool in(std::map<K, V> m, K key) {
 }
 
 namespace disassembler {
-    std::string intop(byte*);
-    std::tuple<std::string, unsigned> instruction(byte*);
+    std::string intop(byte*&, byte&);
+    std::string constant(byte*&, byte&, bytecode_size_type, const ConstantPool*);
+    std::tuple<std::string, unsigned> instruction(byte*, bytecode_size_type, const ConstantPool* = 0);
 }
 
 
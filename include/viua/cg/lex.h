@@ -0,0 +1,38 @@
+#ifndef VIUA_CG_LEX_H
+#define VIUA_CG_LEX_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+
+namespace cg {
+    namespace lex {
+        struct Line {
+            /** Line of assembly source split into tokens.
+             *
+             *  Source is tokenised once, and every later stage (verification, code generation)
+             *  works on tokens instead of splitting the text of the line again.
+             *
+             *  First token is the mnemonic of an instruction or a directive (e.g. `.function:`).
+             *  Enquoted strings are kept as single tokens, together with their quotes.
+             *  Number is the line in the source file (counting from 1), and
+             *  0 for lines generated by the assembler.
+             */
+            unsigned number;
+            std::string text;
+            std::vector<std::string> tokens;
+
+            // token with given index, or empty string if the line is shorter
+            const std::string& operator[](unsigned) const;
+            bool directive() const;
+        };
+
+        Line tokenise(const std::string&, unsigned = 0);
+        std::vector<Line> tokenise(const std::vector<std::string>&);
+    }
+}
+
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef VIUA_CONSTPOOL_H
+#define VIUA_CONSTPOOL_H
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <tuple>
+#include <viua/bytecode/format.h>
+
+
+enum ConstantKind : uint32_t {
+    CONSTANT_STRING = 0,
+    CONSTANT_ATOM,
+    CONSTANT_FLOAT,
+};
+
+
+class ConstantPool {
+    /** Constant pool section of a bytecode image.
+     *
+     *  Literals (strings, atom names and floats) are not embedded in bytecode.
+     *  Every distinct literal of a module is stored in the pool once, and
+     *  instructions refer to it by index.
+     *
+     *  Section is laid out as follows (all fields are 32 bit):
+     *
+     *      segment count
+     *      segments        - (bytecode offset, first entry) pairs sorted by offset,
+     *                        indexes used by instructions at or after the offset are relative to the first entry
+     *      entry count
+     *      entries         - (kind, data offset) pairs
+     *      data            - NUL-terminated texts of strings and atoms, and raw floats
+     *
+     *  Modules statically linked into an image keep their own indexes, and
+     *  their entries are placed in a segment of their own.
+     *  When code of a module is placed in pieces (e.g. by viua-ld) several segments
+     *  share the same first entry, so entries available to a segment
+     *  end at the next greater first entry of any segment.
+     *
+     *  The pool keeps a private copy of the section so it can outlive the image it was read from.
+     */
+    std::string section;
+
+    uint32_t segment_count;
+    uint32_t entry_count;
+
+    uint32_t segments;
+    uint32_t entries;
+    uint32_t data;
+
+    // one past the last entry available to every segment
+    std::vector<uint32_t> limits;
+
+    uint32_t field(uint32_t, uint32_t) const;
+
+    public:
+        bool empty() const;
+        uint32_t size() const;
+
+        bool find(bytecode_size_type, uint32_t, uint32_t&) const;
+
+        ConstantKind kind(uint32_t) const;
+        std::string text(uint32_t) const;
+        float real(uint32_t) const;
+
+        ConstantPool(const char* = 0, bytecode_size_type = 0);
+
+    friend class ConstantPoolBuilder;
+};
+
+
+class ConstantPoolBuilder {
+    /** Collects literals of a module being assembled, and
+     *  produces its constant pool section.
+     *
+     *  Literals are deduplicated so every distinct one takes a single entry
+     *  no matter how many instructions use it.
+     */
+    std::vector<std::pair<ConstantKind, std::string> > entries;
+    std::map<std::pair<ConstantKind, std::string>, uint32_t> indexes;
+    std::vector<std::pair<bytecode_size_type, uint32_t> > segments;
+
+    /** Sealed pool is only read, so it can be shared by threads assembling functions of one module.
+     *  Adding a literal that is not already in a sealed pool is an error.
+     */
+    bool sealed;
+
+    public:
+        uint32_t add(ConstantKind, const std::string&);
+        uint32_t str(const std::string&);
+        uint32_t atom(const std::string&);
+        uint32_t real(float);
+
+        void link(const ConstantPool&, bytecode_size_type);
+        void link(const ConstantPool&, const std::vector<std::tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type> >&, const std::vector<bool>* = 0);
+
+        uint32_t size() const;
+        std::string build() const;
+
+        ConstantPoolBuilder& seal(bool = true);
+
+        ConstantPoolBuilder(): segments({ std::pair<bytecode_size_type, uint32_t>(0, 0) }), sealed(false) {}
+};
+
+
+#endif
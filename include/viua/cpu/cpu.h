@@ -4,19 +4,24 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <tuple>
 #include <utility>
 #include <algorithm>
 #include <stdexcept>
 #include <viua/bytecode/bytetypedef.h>
+#include <viua/bytecode/format.h>
 #include <viua/types/type.h>
 #include <viua/cpu/registerset.h>
 #include <viua/cpu/frame.h>
 #include <viua/cpu/tryframe.h>
 #include <viua/include/module.h>
+#include <viua/symtab.h>
+#include <viua/constpool.h>
 
 
 const unsigned DEFAULT_REGISTER_SIZE = 256;
@@ -36,8 +41,8 @@ class CPU {
      *  Size and executable offset are metadata exported from bytecode dump.
      */
     byte* bytecode;
-    uint16_t bytecode_size;
-    uint16_t executable_offset;
+    bytecode_size_type bytecode_size;
+    bytecode_size_type executable_offset;
 
     // Global register set
     RegisterSet* regset;
@@ -62,7 +67,6 @@ class CPU {
 
     /*  Function and block names mapped to bytecode addresses.
      */
-    byte* jump_base;
     std::map<std::string, unsigned> function_addresses;
     std::map<std::string, unsigned> block_addresses;
 
@@ -70,6 +74,51 @@ class CPU {
     std::map<std::string, std::pair<std::string, byte*>> linked_blocks;
     std::map<std::string, std::pair<unsigned, byte*> > linked_modules;
 
+    /*  Images mapped into memory, keyed by the bytecode they contain.
+     *  Such bytecode is used in place: it is never freed by the CPU, and
+     *  the whole image is unmapped instead.
+     */
+    std::map<byte*, std::pair<void*, std::size_t> > mapped_images;
+    void release(byte*);
+
+    /*  Symbol tables of the program and of modules linked at runtime.
+     *  Functions and blocks missing from address maps are looked up in them when first used, and
+     *  are recorded in the maps afterwards.
+     */
+    SymbolTable symbol_table;
+    std::vector<std::pair<std::string, SymbolTable> > linked_symbol_tables;
+    bool resolvefunction(const std::string&);
+    bool resolveblock(const std::string&);
+
+    /*  Functions and blocks of modules linked at runtime are materialized only when they are first used:
+     *  every instruction of their code is checked, and they are registered in address maps.
+     *  Code of a function or block extends up to the next boundary of its module (or to the end of its bytecode).
+     *  For every module, numbers of materialized and of all functions, and
+     *  of materialized and of all blocks are kept.
+     */
+    std::map<std::string, std::tuple<unsigned, unsigned, unsigned, unsigned> > module_statistics;
+    std::map<std::string, std::vector<bytecode_size_type> > module_boundaries;
+    byte* materialize(const std::string&, bytecode_size_type, SymbolKind);
+
+    /*  Pool of interned strings.
+     *  Every text is kept in the pool only once and String objects created from
+     *  bytecode literals point into it instead of holding their own copy.
+     */
+    std::set<std::string> string_pool;
+
+    /*  Symbol table for atoms.
+     *  Every atom name is stored exactly once so atoms can be compared by address.
+     */
+    std::set<std::string> symbols;
+
+    /*  Constant pools of the program and of modules linked at runtime, keyed by the bytecode they belong to
+     *  (together with size of the bytecode).
+     *  Objects are built from pool entries when they are first used, and
+     *  instructions storing literals place copies of them in registers so
+     *  executing the same instruction for the second time does not read the pool.
+     */
+    std::map<byte*, std::tuple<bytecode_size_type, ConstantPool, std::vector<Type*> > > constant_pools;
+
     /*  Slot for thrown objects (typically exceptions).
      *  Can be set by user code and the CPU.
      */
@@ -99,6 +148,15 @@ class CPU {
     void place(unsigned, Type*);
     void ensureStaticRegisters(std::string);
 
+    /*  Methods dealing with interned strings.
+     */
+    const std::string* intern(const std::string&);
+
+    /*  Methods dealing with constant pools.
+     */
+    std::map<byte*, std::tuple<bytecode_size_type, ConstantPool, std::vector<Type*> > >::iterator poolof(byte*);
+    Type* constant(byte*, int, ConstantKind);
+
     /*  Methods dealing with stack and frame manipulation.
      */
     Frame* requestNewFrame(int arguments_size = 0, int registers_size = 0);
@@ -106,6 +164,15 @@ class CPU {
     void pushFrame();
     void dropFrame();
 
+    /*  Common parts of instructions with immediate operands.
+     */
+    template<class Result, class Operation> byte* integerImmediate(byte*, Operation);
+    template<class Result, class Operation> byte* floatImmediate(byte*, Operation);
+
+    /*  Common part of integer instructions specialised for types of their operands.
+     */
+    template<class Result, class Operation> byte* typedInteger(byte*, bool, Operation, byte* (CPU::*)(byte*));
+
     /*  Methods implementing CPU instructions.
      */
     byte* izero(byte*);
@@ -121,6 +188,36 @@ class CPU {
     byte* igte(byte*);
     byte* ieq(byte*);
 
+    byte* iaddi(byte*);
+    byte* isubi(byte*);
+    byte* imuli(byte*);
+    byte* idivi(byte*);
+    byte* ilti(byte*);
+    byte* iltei(byte*);
+    byte* igti(byte*);
+    byte* igtei(byte*);
+    byte* ieqi(byte*);
+
+    byte* tiadd(byte*);
+    byte* tisub(byte*);
+    byte* timul(byte*);
+    byte* tidiv(byte*);
+    byte* tilt(byte*);
+    byte* tilte(byte*);
+    byte* tigt(byte*);
+    byte* tigte(byte*);
+    byte* tieq(byte*);
+
+    byte* giadd(byte*);
+    byte* gisub(byte*);
+    byte* gimul(byte*);
+    byte* gidiv(byte*);
+    byte* gilt(byte*);
+    byte* gilte(byte*);
+    byte* gigt(byte*);
+    byte* gigte(byte*);
+    byte* gieq(byte*);
+
     byte* iinc(byte*);
     byte* idec(byte*);
 
@@ -136,6 +233,16 @@ class CPU {
     byte* fgte(byte*);
     byte* feq(byte*);
 
+    byte* faddi(byte*);
+    byte* fsubi(byte*);
+    byte* fmuli(byte*);
+    byte* fdivi(byte*);
+    byte* flti(byte*);
+    byte* fltei(byte*);
+    byte* fgti(byte*);
+    byte* fgtei(byte*);
+    byte* feqi(byte*);
+
     byte* bstore(byte*);
 
     byte* itof(byte*);
@@ -144,6 +251,20 @@ class CPU {
     byte* stof(byte*);
 
     byte* strstore(byte*);
+    byte* streq(byte*);
+    byte* strbuild(byte*);
+    byte* strappend(byte*);
+    byte* strappendr(byte*);
+    byte* strfinal(byte*);
+    byte* strlen(byte*);
+    byte* stradd(byte*);
+    byte* strsub(byte*);
+    byte* strfind(byte*);
+    byte* strcmp(byte*);
+    byte* strsplit(byte*);
+
+    byte* atom(byte*);
+    byte* atomeq(byte*);
 
     byte* vec(byte*);
     byte* vinsert(byte*);
@@ -151,6 +272,10 @@ class CPU {
     byte* vpop(byte*);
     byte* vat(byte*);
     byte* vlen(byte*);
+    byte* vslice(byte*);
+    byte* vsat(byte*);
+    byte* vslen(byte*);
+    byte* vsmat(byte*);
 
     byte* boolean(byte*);
     byte* lognot(byte*);
@@ -185,6 +310,7 @@ class CPU {
     byte* argc(byte*);
 
     byte* call(byte*);
+    byte* tailcall(byte*);
     byte* end(byte*);
 
     byte* jump(byte*);
@@ -216,9 +342,12 @@ class CPU {
          *      * kick the CPU so it starts running,
          */
         CPU& load(byte*);
-        CPU& bytes(uint16_t);
-        CPU& eoffset(uint16_t);
+        CPU& bytes(bytecode_size_type);
+        CPU& eoffset(bytecode_size_type);
 
+        CPU& mapimage(byte*, void*, std::size_t);
+        CPU& symtab(const SymbolTable&);
+        CPU& constpool(byte*, bytecode_size_type, const ConstantPool&);
         CPU& mapfunction(const std::string&, unsigned);
         CPU& mapblock(const std::string&, unsigned);
 
@@ -235,11 +364,13 @@ class CPU {
 
         int run();
         inline unsigned counter() { return instruction_counter; }
+        inline byte* address() { return instruction_pointer; }
 
         inline std::tuple<int, std::string, std::string> exitcondition() {
             return std::tuple<int, std::string, std::string>(return_code, return_exception, return_message);
         }
         inline std::vector<Frame*> trace() { return frames; }
+        inline std::map<std::string, std::tuple<unsigned, unsigned, unsigned, unsigned> > linkstats() { return module_statistics; }
 
         CPU():
             bytecode(0), bytecode_size(0), executable_offset(0),
@@ -248,7 +379,6 @@ class CPU {
             static_registers({}),
             frame_new(0),
             try_frame_new(0),
-            jump_base(0),
             thrown(0), caught(0),
             return_code(0), return_exception(""), return_message(""),
             instruction_counter(0), instruction_pointer(0),
@@ -259,19 +389,21 @@ class CPU {
             /*  Destructor frees memory at bytecode pointer so make sure you passed a copy of the bytecode to the constructor
              *  if you want to keep it around after the CPU is finished.
              */
-            if (bytecode) { delete[] bytecode; }
+            if (bytecode) { release(bytecode); }
             for (std::pair<std::string, RegisterSet*> sr : static_registers) {
                 delete sr.second;
-
-                // this causes valgrind to SCREAM with errors...
-                static_registers.erase(sr.first);
             }
+            static_registers.clear();
             for (std::pair<std::string, std::pair<unsigned, byte*> > lm : linked_modules) {
-                delete[] lm.second.second;
-
-                // this causes valgrind to SCREAM with errors...
-                linked_modules.erase(lm.first);
+                release(lm.second.second);
+            }
+            linked_modules.clear();
+            for (auto& cp : constant_pools) {
+                for (Type* prototype : std::get<2>(cp.second)) {
+                    delete prototype;
+                }
             }
+            constant_pools.clear();
         }
 };
 
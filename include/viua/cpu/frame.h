@@ -18,17 +18,23 @@ class Frame {
 
         std::string function_name;
 
+        // number of frames this one replaced through tail calls
+        unsigned elided_frames;
+        // frame replaced by a tail call, kept as long as its objects may be referenced by this one
+        Frame* retained;
+
         inline byte* ret_address() { return return_address; }
 
         Frame(byte* ra, int argsize, int regsize = 16):
             return_address(ra),
             args(0), regset(0),
-            place_return_value_in(0), resolve_return_value_register(false)
+            place_return_value_in(0), resolve_return_value_register(false),
+            elided_frames(0), retained(0)
         {
             args = new RegisterSet(argsize);
             regset = new RegisterSet(regsize);
         }
-        Frame(const Frame& that) {
+        Frame(const Frame& that): elided_frames(that.elided_frames), retained(0) {
             return_address = that.return_address;
 
             // FIXME: copy the registers maybe?
@@ -37,6 +43,14 @@ class Frame {
         ~Frame() {
             delete args;
             delete regset;
+
+            // chains of retained frames may be long, so they are not deleted recursively
+            while (retained) {
+                Frame* next = retained->retained;
+                retained->retained = 0;
+                delete retained;
+                retained = next;
+            }
         }
 };
 
@@ -0,0 +1,37 @@
+#ifndef VIUA_INLINED_H
+#define VIUA_INLINED_H
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <viua/bytecode/format.h>
+
+
+struct InlinedCode {
+    /** Range of bytecode holding code of a function the assembler inlined into its caller.
+     *
+     *  Inlined code section of an image (since version 6) lists such ranges so that
+     *  stack traces can name functions whose frames were never created.
+     *  Every entry is written as (begin, end, arity) 32 bit fields followed by NUL-terminated function name.
+     *  Ranges are sorted by their beginnings, and code inlined into inlined code is not listed
+     *  as only functions without calls are inlined.
+     */
+    bytecode_size_type begin;
+    bytecode_size_type end;
+    uint32_t arity;
+    std::string function;
+};
+
+
+namespace inlined {
+    std::string dump(const std::vector<InlinedCode>&);
+    std::vector<InlinedCode> load(const char*, bytecode_size_type);
+
+    bool find(const std::vector<InlinedCode>&, bytecode_size_type, InlinedCode&);
+}
+
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef VIUA_LINKER_H
+#define VIUA_LINKER_H
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <viua/bytecode/format.h>
+#include <viua/symtab.h>
+#include <viua/constpool.h>
+
+
+enum RelocationKind : uint32_t {
+    RELOCATION_JUMP = 0,
+    RELOCATION_REFERENCE,
+};
+
+
+struct Relocation {
+    /** Place in bytecode that must be taken care of when functions and blocks are moved or removed.
+     *
+     *  Relocations are of two kinds:
+     *
+     *      RELOCATION_JUMP         - jump or branch whose target lies outside of the function or block it belongs to,
+     *                                target (relative to the instruction) must be recalculated when code is moved
+     *      RELOCATION_REFERENCE    - instruction referring to a function or block by name (call, closure, function, try, catch),
+     *                                referenced symbol must be kept as long as the referring code is
+     *
+     *  In relocation section of an object every entry is written as
+     *  (kind, instruction offset, position) 32 bit fields followed by NUL-terminated symbol name.
+     */
+    RelocationKind kind;
+    bytecode_size_type instruction;
+    bytecode_size_type position;
+    std::string symbol;
+};
+
+
+struct Invokable {
+    std::string name;
+    SymbolKind kind;
+    bytecode_size_type address;
+    bytecode_size_type size;
+};
+
+
+class Module {
+    /** Module being linked - relocatable object or library image.
+     *
+     *  Objects carry their relocations, and
+     *  relocations of images are found by scanning their bytecode.
+     */
+    public:
+        std::string path;
+        std::string bytecode;
+        ConstantPool constants;
+
+        // sorted by address
+        std::vector<Invokable> invokables;
+        // sorted by instruction offset
+        std::vector<Relocation> relocations;
+
+        unsigned at(bytecode_size_type) const;
+        std::vector<std::string> references(unsigned) const;
+
+        static Module load(const std::string&);
+};
+
+
+namespace linker {
+    std::vector<Invokable> invokables(const std::map<std::string, bytecode_size_type>&, const std::map<std::string, bytecode_size_type>&, bytecode_size_type);
+    std::vector<Relocation> scan(const std::string&, const std::vector<Invokable>&);
+
+    std::string dumpRelocations(const std::vector<Relocation>&);
+    std::vector<Relocation> loadRelocations(const char*, bytecode_size_type);
+
+    std::set<std::string> reachable(const std::vector<Module>&, const std::vector<std::string>&);
+
+    void place(const Module&, const std::set<std::string>*, std::string&, ConstantPoolBuilder&, std::vector<std::pair<std::string, bytecode_size_type> >&, std::vector<std::pair<std::string, bytecode_size_type> >&, bytecode_size_type = 0);
+}
+
+
+#endif
@@ -5,56 +5,131 @@
 
 
 #include <cstdint>
-#include <fstream>
+#include <cstddef>
 #include <tuple>
 #include <string>
 #include <vector>
 #include <map>
 #include <viua/bytecode/bytetypedef.h>
+#include <viua/bytecode/format.h>
+#include <viua/symtab.h>
+#include <viua/constpool.h>
 
-typedef std::tuple<std::vector<std::string>, std::map<std::string, uint16_t> > IdToAddressMapping;
+typedef std::tuple<std::vector<std::string>, std::map<std::string, bytecode_size_type> > IdToAddressMapping;
 
 class Loader {
     std::string path;
 
-    uint16_t size;
+    /*  Whole image of the loaded file.
+     *  It is either read into a buffer owned by the loader, or
+     *  (if the loader uses mmap) mapped read-only into memory so that
+     *  several processes running the same program share its pages.
+     */
+    bool use_mmap;
+    bool mapped;
+    char* image;
+    std::size_t image_size;
+    std::size_t cursor;
+
+    uint8_t version;
+    bool relocatable;
+
+    bytecode_size_type size;
     byte* bytecode;
 
-    std::vector<unsigned> jumps;
+    /*  ID sections are only located during loading, and
+     *  are parsed into lookup tables when they are first requested.
+     */
+    char* block_ids_section;
+    bytecode_size_type block_ids_section_size;
+    char* function_ids_section;
+    bytecode_size_type function_ids_section_size;
+    bool ids_loaded;
 
-    std::map<std::string, uint16_t> function_addresses;
+    char* symtab_section;
+    bytecode_size_type symtab_section_size;
+
+    char* constpool_section;
+    bytecode_size_type constpool_section_size;
+
+    char* relocations_section;
+    bytecode_size_type relocations_section_size;
+
+    char* inlined_code_section;
+    bytecode_size_type inlined_code_section_size;
+
+    std::map<std::string, bytecode_size_type> function_addresses;
     std::map<std::string, unsigned> function_sizes;
     std::vector<std::string> functions;
-    std::map<std::string, uint16_t> block_addresses;
+    std::map<std::string, bytecode_size_type> block_addresses;
     std::vector<std::string> blocks;
 
-    IdToAddressMapping loadmap(char*, const uint16_t&);
+    IdToAddressMapping loadmap(char*, const bytecode_size_type&);
     void calculateFunctionSizes();
-
-    void loadJumpTable(std::ifstream&);
-    void loadFunctionsMap(std::ifstream&);
-    void loadBlocksMap(std::ifstream&);
-    void loadBytecode(std::ifstream&);
+    void loadIds();
+
+    void loadImage();
+    void mapImage();
+    void readImage();
+    void releaseImage();
+
+    char* take(std::size_t);
+    bytecode_size_type loadSize();
+
+    void loadFormatHeader();
+    void upgradeImage(bool);
+    void loadFunctionsMap();
+    void loadBlocksMap();
+    void loadSymbolTable();
+    void loadConstantPool();
+    void loadRelocations();
+    void loadInlinedCode();
+    void loadBytecode();
 
     public:
+    Loader& useMmap(bool = true);
+    bool isMapped() const;
+
     Loader& load();
     Loader& executable();
 
-    uint16_t getBytecodeSize();
-    byte* getBytecode();
+    uint8_t getVersion();
+    bool isRelocatable() const;
 
-    std::vector<unsigned> getJumps();
+    bytecode_size_type getBytecodeSize();
+    byte* getBytecode();
+    byte* getBytecodeInPlace();
+    std::tuple<void*, std::size_t> detachImage();
 
-    std::map<std::string, uint16_t> getFunctionAddresses();
+    std::map<std::string, bytecode_size_type> getFunctionAddresses();
     std::map<std::string, unsigned> getFunctionSizes();
     std::vector<std::string> getFunctions();
 
-    std::map<std::string, uint16_t> getBlockAddresses();
+    std::map<std::string, bytecode_size_type> getBlockAddresses();
     std::vector<std::string> getBlocks();
 
-    Loader(std::string pth): path(pth), size(0), bytecode(0) {}
+    bool hasSymbolTable();
+    SymbolTable getSymbolTable();
+
+    ConstantPool getConstantPool();
+    std::string getRelocations();
+    std::string getInlinedCode();
+
+    Loader(std::string pth):
+        path(pth),
+        use_mmap(false), mapped(false), image(0), image_size(0), cursor(0),
+        version(VIUA_BYTECODE_VERSION), relocatable(false),
+        size(0), bytecode(0),
+        block_ids_section(0), block_ids_section_size(0),
+        function_ids_section(0), function_ids_section_size(0),
+        ids_loaded(false),
+        symtab_section(0), symtab_section_size(0),
+        constpool_section(0), constpool_section_size(0),
+        relocations_section(0), relocations_section_size(0),
+        inlined_code_section(0), inlined_code_section_size(0)
+    {}
     ~Loader() {
-        delete[] bytecode;
+        releaseImage();
     }
 };
 
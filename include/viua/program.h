@@ -6,7 +6,10 @@
 #include <tuple>
 #include <map>
 #include <viua/bytecode/bytetypedef.h>
+#include <viua/bytecode/format.h>
 #include <viua/cg/bytecode/instructions.h>
+#include <viua/cg/lex.h>
+#include <viua/constpool.h>
 
 
 enum JUMPTYPE {
@@ -32,15 +35,44 @@ class Program {
     /** Branches inside bytecode must be stored for later recalculation.
      *  Absolute and local branches must be distinguished between as
      *  they are calculated a bit differently.
+     *  Jumps to bytes are stored too as they must be made relative to the jumping instruction.
      */
     std::vector<byte*> branches;
     std::vector<byte*> branches_absolute;
+    std::vector<byte*> branches_to_byte;
+
+    /** Jump targets are encoded relative to the instruction that jumps so
+     *  position of the instruction is saved for every stored branch.
+     */
+    std::map<byte*, byte*> branch_instructions;
+
+    /** Literals are placed in constant pool shared by
+     *  all functions and blocks of the module.
+     */
+    ConstantPoolBuilder* constants;
+
+    /** Every use of a literal is recorded as (instruction offset, kind, value) so
+     *  bytecode can be reused with a different pool (e.g. from assembler cache).
+     */
+    std::vector<std::tuple<int, ConstantKind, std::string> > constant_uses;
+
+    /** Byte offsets of instructions, indexed by instruction number.
+     *  The table is extended as the program grows, so that each instruction is
+     *  analysed only once and jumps are resolved by a lookup.
+     */
+    std::vector<int> instruction_offsets;
+    int offsets_end;
 
     // simple, whether to print debugging information or not
     bool debug;
     bool scream;
 
-    int getInstructionBytecodeOffset(int, int count = -1);
+    ConstantPoolBuilder& pool();
+    int_op constant(ConstantKind, const std::string&);
+
+    int getInstructionSize(int);
+    const std::vector<int>& instructionOffsets();
+    int getInstructionBytecodeOffset(int);
 
     public:
     // instruction insertion interface
@@ -62,6 +94,36 @@ class Program {
     Program& igte       (int_op, int_op, int_op);
     Program& ieq        (int_op, int_op, int_op);
 
+    Program& iaddi      (int_op, int_op, int_op);
+    Program& isubi      (int_op, int_op, int_op);
+    Program& imuli      (int_op, int_op, int_op);
+    Program& idivi      (int_op, int_op, int_op);
+    Program& ilti       (int_op, int_op, int_op);
+    Program& iltei      (int_op, int_op, int_op);
+    Program& igti       (int_op, int_op, int_op);
+    Program& igtei      (int_op, int_op, int_op);
+    Program& ieqi       (int_op, int_op, int_op);
+
+    Program& tiadd      (int_op, int_op, int_op);
+    Program& tisub      (int_op, int_op, int_op);
+    Program& timul      (int_op, int_op, int_op);
+    Program& tidiv      (int_op, int_op, int_op);
+    Program& tilt       (int_op, int_op, int_op);
+    Program& tilte      (int_op, int_op, int_op);
+    Program& tigt       (int_op, int_op, int_op);
+    Program& tigte      (int_op, int_op, int_op);
+    Program& tieq       (int_op, int_op, int_op);
+
+    Program& giadd      (int_op, int_op, int_op);
+    Program& gisub      (int_op, int_op, int_op);
+    Program& gimul      (int_op, int_op, int_op);
+    Program& gidiv      (int_op, int_op, int_op);
+    Program& gilt       (int_op, int_op, int_op);
+    Program& gilte      (int_op, int_op, int_op);
+    Program& gigt       (int_op, int_op, int_op);
+    Program& gigte      (int_op, int_op, int_op);
+    Program& gieq       (int_op, int_op, int_op);
+
     Program& fstore     (int_op, float);
     Program& fadd       (int_op, int_op, int_op);
     Program& fsub       (int_op, int_op, int_op);
@@ -74,6 +136,16 @@ class Program {
     Program& fgte       (int_op, int_op, int_op);
     Program& feq        (int_op, int_op, int_op);
 
+    Program& faddi      (int_op, int_op, float);
+    Program& fsubi      (int_op, int_op, float);
+    Program& fmuli      (int_op, int_op, float);
+    Program& fdivi      (int_op, int_op, float);
+    Program& flti       (int_op, int_op, float);
+    Program& fltei      (int_op, int_op, float);
+    Program& fgti       (int_op, int_op, float);
+    Program& fgtei      (int_op, int_op, float);
+    Program& feqi       (int_op, int_op, float);
+
     Program& bstore     (int_op, byte_op);
 
     Program& itof       (int_op, int_op);
@@ -82,6 +154,19 @@ class Program {
     Program& stof       (int_op, int_op);
 
     Program& strstore   (int_op, std::string);
+    Program& streq      (int_op, int_op, int_op);
+    Program& strbuild   (int_op);
+    Program& strappend  (int_op, int_op);
+    Program& strappendr (int_op, int_op);
+    Program& strfinal   (int_op, int_op);
+    Program& strlen     (int_op, int_op);
+    Program& stradd     (int_op, int_op, int_op);
+    Program& strsub     (int_op, int_op, int_op, int_op);
+    Program& strfind    (int_op, int_op, int_op);
+    Program& strcmp     (int_op, int_op, int_op);
+    Program& strsplit   (int_op, int_op, int_op);
+    Program& atom       (int_op, std::string);
+    Program& atomeq     (int_op, int_op, int_op);
 
     Program& vec        (int_op);
     Program& vinsert    (int_op, int_op, int_op);
@@ -89,6 +174,10 @@ class Program {
     Program& vpop       (int_op, int_op, int_op);
     Program& vat        (int_op, int_op, int_op);
     Program& vlen       (int_op, int_op);
+    Program& vslice     (int_op, int_op, int_op, int_op);
+    Program& vsat       (int_op, int_op, int_op);
+    Program& vslen      (int_op, int_op);
+    Program& vsmat      (int_op, int_op);
 
     Program& lognot     (int_op);
     Program& logand     (int_op, int_op, int_op);
@@ -121,6 +210,7 @@ class Program {
     Program& argc       (int_op);
 
     Program& call       (int_op, const std::string&);
+    Program& tailcall   (const std::string&);
     Program& jump       (int, enum JUMPTYPE);
     Program& branch     (int_op, int, enum JUMPTYPE, int, enum JUMPTYPE);
 
@@ -146,21 +236,25 @@ class Program {
      */
     Program& calculateBranches(unsigned offset = 0); // FIXME: is unused, scheduled for removal
     Program& calculateJumps(std::vector<std::tuple<int, int> >);
-    std::vector<unsigned> jumps();
-    std::vector<unsigned> jumpsAbsolute();
+    Program& calculateJumpsToByte(int);
+    std::vector<std::tuple<int, int> > jumps();
+    std::vector<std::tuple<int, int> > jumpsAbsolute();
+    std::vector<std::tuple<int, int> > jumpsToByte();
+    std::vector<std::tuple<int, ConstantKind, std::string> > constantUses();
 
     byte* bytecode();
     Program& fill(byte*);
 
     Program& setdebug(bool d = true);
     Program& setscream(bool d = true);
+    Program& setconstants(ConstantPoolBuilder*);
 
     int size();
     int instructionCount();
 
-    static uint16_t countBytes(const std::vector<std::string>&);
+    static bytecode_size_type countBytes(const std::vector<cg::lex::Line>&);
 
-    Program(int bts = 2): bytes(bts), debug(false), scream(false) {
+    Program(int bts = 2): bytes(bts), constants(0), offsets_end(0), debug(false), scream(false) {
         program = new byte[bytes];
         /* Filling bytecode with zeroes (which are interpreted by CPU as NOP instructions) is a safe way
          * to prevent many hiccups.
@@ -168,7 +262,7 @@ class Program {
         for (int i = 0; i < bytes; ++i) { program[i] = byte(0); }
         addr_ptr = program;
     }
-    Program(const Program& that): program(0), bytes(that.bytes), addr_ptr(0), branches({}) {
+    Program(const Program& that): program(0), bytes(that.bytes), addr_ptr(0), branches({}), constants(that.constants), constant_uses(that.constant_uses), instruction_offsets(that.instruction_offsets), offsets_end(that.offsets_end) {
         program = new byte[bytes];
         for (int i = 0; i < bytes; ++i) {
             program[i] = that.program[i];
@@ -177,6 +271,9 @@ class Program {
         for (unsigned i = 0; i < that.branches.size(); ++i) {
             branches.push_back(program+long(that.branches[i]-that.program));
         }
+        for (auto b : that.branch_instructions) {
+            branch_instructions[program+long(b.first-that.program)] = program+long(b.second-that.program);
+        }
     }
     ~Program() {
         delete[] program;
@@ -186,6 +283,10 @@ class Program {
         if (this != &that) {
             delete[] program;
             bytes = that.bytes;
+            constants = that.constants;
+            constant_uses = that.constant_uses;
+            instruction_offsets = that.instruction_offsets;
+            offsets_end = that.offsets_end;
             program = new byte[bytes];
             for (int i = 0; i < bytes; ++i) {
                 program[i] = that.program[i];
@@ -195,6 +296,10 @@ class Program {
             for (unsigned i = 0; i < that.branches.size(); ++i) {
                 branches.push_back(program+long(that.branches[i]-that.program));
             }
+            branch_instructions.clear();
+            for (auto b : that.branch_instructions) {
+                branch_instructions[program+long(b.first-that.program)] = program+long(b.second-that.program);
+            }
         }
         return (*this);
     }
@@ -0,0 +1,62 @@
+#ifndef VIUA_SYMTAB_H
+#define VIUA_SYMTAB_H
+
+#pragma once
+
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <viua/bytecode/format.h>
+
+
+enum SymbolKind : uint32_t {
+    SYMBOL_FUNCTION = 0,
+    SYMBOL_BLOCK,
+};
+
+
+class SymbolTable {
+    /** Read-only view of symbol table section of a bytecode image.
+     *
+     *  Section is laid out as follows (all fields are 32 bit):
+     *
+     *      bucket count, entry count
+     *      buckets         - (bucket count + 1) indexes of first entry in each bucket,
+     *                        entries are sorted by bucket so bucket N spans [buckets[N], buckets[N+1])
+     *      entries         - (hash, name offset, address, kind) tuples
+     *      strings         - NUL-terminated names, entries point to them by offset
+     *
+     *  Lookups hash the name and only compare names of entries in a single bucket so
+     *  no entry has to be parsed before it is needed.
+     */
+    const char* section;
+    bytecode_size_type section_size;
+
+    uint32_t bucket_count;
+    uint32_t entry_count;
+
+    const char* buckets;
+    const char* entries;
+    const char* strings;
+    bytecode_size_type strings_size;
+
+    uint32_t field(const char*, uint32_t) const;
+
+    public:
+        static uint32_t hash(const std::string&);
+        static std::string build(const std::map<std::string, bytecode_size_type>&, const std::map<std::string, bytecode_size_type>&);
+
+        bool lookup(const std::string&, SymbolKind, bytecode_size_type&) const;
+
+        bool empty() const;
+        uint32_t size() const;
+        uint32_t count(SymbolKind) const;
+        std::vector<bytecode_size_type> addresses() const;
+
+        SymbolTable(const char* = 0, bytecode_size_type = 0);
+};
+
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef VIUA_TYPES_ATOM_H
+#define VIUA_TYPES_ATOM_H
+
+#pragma once
+
+#include <string>
+#include <functional>
+#include "type.h"
+
+
+class Atom : public Type {
+    /** Atom type.
+     *
+     *  Atoms are symbolic constants, e.g. message kinds or tags.
+     *  Their names are interned once per VM in the CPU symbol table and
+     *  atoms only hold a pointer to the interned name, so
+     *  two atoms are equal if (and only if) they point to the same symbol.
+     */
+    const std::string* symbol;
+
+    public:
+        std::string type() const {
+            return "Atom";
+        }
+        std::string str() const {
+            return *symbol;
+        }
+        std::string repr() const {
+            return ("'" + *symbol + "'");
+        }
+        bool boolean() const {
+            return true;
+        }
+
+        Type* copy() const {
+            return new Atom(symbol);
+        }
+
+        bool equals(const Atom* that) const { return (symbol == that->symbol); }
+        std::size_t hash() const { return std::hash<const std::string*>()(symbol); }
+
+        Atom(const std::string* s): symbol(s) {}
+};
+
+
+#endif
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include "type.h"
 #include "vector.h"
 #include "integer.h"
@@ -14,35 +15,58 @@ class String : public Type {
     /** String type.
      *
      *  Designed to hold text.
+     *
+     *  Strings created from bytecode literals do not own their text -
+     *  they point into the string pool of the CPU and share its (read-only) storage.
+     *  Such strings are cheap to create and copy, and
+     *  equality of two interned strings is a pointer comparison.
+     *  Private copy of the text is made only when the string is about to be modified.
      */
     std::string svalue;
+    const std::string* interned;
 
     public:
         std::string type() const {
             return "String";
         }
         std::string str() const {
-            return svalue;
+            return view();
         }
         std::string repr() const {
-            return str::enquote(svalue);
+            return str::enquote(view());
         }
         bool boolean() const {
-            return svalue.size() != 0;
+            return view().size() != 0;
         }
 
         Type* copy() const {
-            return new String(svalue);
+            return (interned ? new String(interned) : new String(svalue));
         }
 
-        std::string& value() { return svalue; }
+        /** Read-only access to the text of the string.
+         *  Does not cause interned strings to be copied.
+         */
+        const std::string& view() const { return (interned ? *interned : svalue); }
+        bool isinterned() const { return (interned != 0); }
+
+        std::string& value();
+        bool equals(const String*) const;
 
         Integer* size();
         String* sub(int b = 0, int e = -1);
         String* add(String*);
         String* join(Vector*);
 
-        String(std::string s = ""): svalue(s) {}
+        String* concat(const String*) const;
+        Integer* find(const String*) const;
+        Integer* compare(const String*) const;
+        Vector* split(const String*) const;
+
+        int toint() const;
+        float tofloat() const;
+
+        String(std::string s = ""): svalue(std::move(s)), interned(0) {}
+        String(const std::string* s): svalue(""), interned(s) {}
 };
 
 
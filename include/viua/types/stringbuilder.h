@@ -0,0 +1,61 @@
+#ifndef VIUA_TYPES_STRINGBUILDER_H
+#define VIUA_TYPES_STRINGBUILDER_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include "type.h"
+#include "string.h"
+
+
+class StringBuilder : public Type {
+    /** String builder type.
+     *
+     *  Keeps appended pieces in a list instead of concatenating them eagerly so
+     *  appending is never a copy of everything that was built so far.
+     *  Pieces appended from interned strings are not copied at all.
+     *
+     *  Flat String is produced by finalize() which allocates exactly once.
+     */
+    std::vector<const std::string*> pieces;
+    std::deque<std::string> owned;
+    std::string::size_type length;
+
+    std::string flatten() const;
+
+    public:
+        std::string type() const {
+            return "StringBuilder";
+        }
+        std::string str() const {
+            return flatten();
+        }
+        std::string repr() const {
+            return str::enquote(flatten());
+        }
+        bool boolean() const {
+            return length != 0;
+        }
+
+        Type* copy() const {
+            StringBuilder* sb = new StringBuilder();
+            sb->append(flatten());
+            return sb;
+        }
+
+        std::string::size_type size() const { return length; }
+
+        StringBuilder* append(const std::string&);
+        StringBuilder* append(const String*);
+        StringBuilder* append(Type*);
+        StringBuilder* appendrepr(Type*);
+
+        String* finalize() const;
+
+        StringBuilder(): length(0) {}
+};
+
+
+#endif
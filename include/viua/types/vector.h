@@ -8,10 +8,18 @@
 #include "type.h"
 
 
+class VectorView;
+
+
 class Vector : public Type {
     /** Vector type.
+     *
+     *  Vector keeps track of views created from it.
+     *  Before it is modified (or destroyed) the views are detached, i.e.
+     *  they copy the elements they refer to so they never see a changed (or dangling) storage.
      */
     std::vector<Type*> internal_object;
+    std::vector<VectorView*> views;
 
     public:
         std::string type() const {
@@ -30,7 +38,11 @@ class Vector : public Type {
             return vec;
         }
 
-        std::vector<Type*>& value() { return internal_object; }
+        std::vector<Type*>& value() {
+            // storage may be modified through the returned reference
+            detachViews();
+            return internal_object;
+        }
 
         Type* insert(int, Type*);
         Type* push(Type*);
@@ -38,6 +50,13 @@ class Vector : public Type {
         Type* at(int);
         int len();
 
+        // unchecked access, for views
+        Type* element(int i) const { return internal_object[i]; }
+
+        VectorView* view(int, int);
+        void detachViews();
+        void forget(VectorView*);
+
         Vector() {}
         Vector(const std::vector<Type*>& v) {
             for (unsigned i = 0; i < v.size(); ++i) {
@@ -45,6 +64,7 @@ class Vector : public Type {
             }
         }
         ~Vector() {
+            detachViews();
             while (internal_object.size()) {
                 delete internal_object.back();
                 internal_object.pop_back();
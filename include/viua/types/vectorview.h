@@ -0,0 +1,49 @@
+#ifndef VIUA_TYPE_VECTORVIEW_H
+#define VIUA_TYPE_VECTORVIEW_H
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "type.h"
+#include "vector.h"
+
+
+class VectorView : public Type {
+    /** View of a range of a Vector.
+     *
+     *  Creating a view does not copy any elements - the view refers to storage of its parent vector.
+     *  When the parent is about to be modified or destroyed it detaches the view and
+     *  the view takes private copies of the elements in its range.
+     */
+    Vector* parent;
+    std::vector<Type*> detached;
+    int offset;
+    int length;
+
+    public:
+        std::string type() const {
+            return "VectorView";
+        }
+        std::string str() const;
+        bool boolean() const {
+            return length != 0;
+        }
+
+        Type* copy() const;
+
+        Type* at(int);
+        int len() const { return length; }
+        bool isattached() const { return (parent != 0); }
+
+        VectorView* slice(int, int);
+        Vector* materialize() const;
+        void detach();
+
+        VectorView(Vector* v, int o, int l): parent(v), offset(o), length(l) {}
+        VectorView(const std::vector<Type*>& elements): parent(0), detached(elements), offset(0), length(int(elements.size())) {}
+        ~VectorView();
+};
+
+
+#endif
@@ -0,0 +1,42 @@
+.block: handle_ok
+    pull 2
+    print 2
+    leave
+.end
+
+.block: handle_any_atom
+    pull 2
+    strstore 3 "any atom"
+    print 3
+    leave
+.end
+
+.block: throw_atom
+    arg 1 0
+    throw 1
+    leave
+.end
+
+.function: catch_atom
+    ; atoms are caught by value before falling back to the "Atom" type
+    tryframe
+    catch "'ok'" handle_ok
+    catch "Atom" handle_any_atom
+    try throw_atom
+    end
+.end
+
+.function: main
+    atom 1 'ok'
+    frame 1
+    param 0 1
+    call catch_atom
+
+    atom 1 'error'
+    frame 1
+    param 0 1
+    call catch_atom
+
+    izero 0
+    end
+.end
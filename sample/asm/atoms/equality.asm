@@ -0,0 +1,19 @@
+.function: main
+    atom 1 'ok'
+    atom 2 'ok'
+    atom 3 'error'
+
+    ; atoms are printed by name
+    print 1
+
+    ; atoms created from the same name are equal
+    atomeq 4 1 2
+    print 4
+
+    ; ...and atoms created from different names are not
+    atomeq 5 1 3
+    print 5
+
+    izero 0
+    end
+.end
@@ -0,0 +1,26 @@
+; This file tests float instructions taking their right-hand side
+; operand from the instruction itself.
+
+.function: main
+    fstore 1 1.5
+    faddi 2 1 0.25
+    print 2
+    fsubi 2 2 -0.25
+    print 2
+    fmuli 2 2 -2
+    print 2
+    fdivi 2 2 8
+    print 2
+    flti 3 2 0
+    print 3
+    fltei 3 2 -0.5
+    print 3
+    fgti 3 2 -0.5
+    print 3
+    fgtei 3 2 -0.25
+    print 3
+    feqi 3 1 1.5
+    print 3
+    izero 0
+    end
+.end
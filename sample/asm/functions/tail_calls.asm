@@ -0,0 +1,100 @@
+; tail calls give the frame of the calling function to the called one, so
+; recursion through them runs in constant stack space
+
+.function: sum
+    ; adds numbers from counter down to 1 to the accumulator passed by reference
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    arg accumulator 1
+
+    izero 3
+    ieq 4 counter 3
+    branch 4 finish
+
+    iadd accumulator accumulator counter
+    idec counter
+    frame 2
+    param 0 counter
+    paref 1 accumulator
+    tailcall sum
+
+    .mark: finish
+    end
+.end
+
+.function: count
+    ; returns accumulator increased by one counter times
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    arg accumulator 1
+
+    izero 3
+    ieq 4 counter 3
+    branch 4 finish
+
+    iinc accumulator
+    idec counter
+    frame 2
+    param 0 counter
+    param 1 accumulator
+    tailcall count
+
+    .mark: finish
+    move 0 accumulator
+    end
+.end
+
+.function: print_sum
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    arg accumulator 1
+    frame 2
+    param 0 counter
+    paref 1 accumulator
+    call sum
+    print accumulator
+    end
+.end
+
+.function: sum_of
+    ; accumulator is a register of this function, so
+    ; its frame must be kept until print_sum returns
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    izero accumulator
+    frame 2
+    param 0 counter
+    paref 1 accumulator
+    tailcall print_sum
+    end
+.end
+
+.function: main
+    istore 1 50000
+    izero 2
+    frame 2
+    param 0 1
+    paref 1 2
+    call sum
+    print 2
+
+    istore 3 100000
+    izero 4
+    frame 2
+    param 0 3
+    param 1 4
+    call 5 count
+    print 5
+
+    istore 6 100
+    frame 1
+    param 0 6
+    call sum_of
+
+    izero 0
+    end
+.end
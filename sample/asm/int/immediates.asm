@@ -0,0 +1,30 @@
+; This file tests integer instructions taking their right-hand side
+; operand from the instruction itself.
+; Immediate may also be taken from a register, with `@`.
+
+.function: main
+    istore 1 40
+    iaddi 2 1 2
+    print 2
+    isubi 2 2 -50
+    print 2
+    imuli 2 2 3
+    print 2
+    idivi 2 2 4
+    print 2
+    ilti 3 2 100
+    print 3
+    iltei 3 2 69
+    print 3
+    igti 3 2 69
+    print 3
+    igtei 3 2 70
+    print 3
+    ieqi 3 2 69
+    print 3
+    istore 4 7
+    iaddi 2 1 @4
+    print 2
+    izero 0
+    end
+.end
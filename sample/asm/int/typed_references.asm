@@ -0,0 +1,26 @@
+; This file tests integer instructions specialised for types of their operands
+; when they take operands from other registers.
+; Such instructions are not emitted by the assembler, but may be written by hand.
+
+.function: main
+    istore 2 3
+    istore 3 40
+    istore 4 4
+
+    iadd 1 @2 4
+    print 1
+    tiadd 1 @2 4
+    print 1
+    giadd 1 @2 4
+    print 1
+
+    ilt 5 @2 4
+    print 5
+    tilt 5 @2 4
+    print 5
+    gilt 5 @2 4
+    print 5
+
+    izero 0
+    end
+.end
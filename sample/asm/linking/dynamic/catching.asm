@@ -0,0 +1,9 @@
+.signature: catcher::run
+
+.function: main
+    link catcher
+    frame 0
+    call catcher::run
+    izero 0
+    end
+.end
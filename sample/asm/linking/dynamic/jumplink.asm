@@ -0,0 +1,11 @@
+.signature: jumprint
+
+.function: main
+    link jumplib
+    istore 1 42
+    frame 1
+    param 0 1
+    call 0 jumprint
+    izero 0
+    end
+.end
@@ -0,0 +1,9 @@
+.signature: print_N::print_42
+
+.function: main
+    link print_N
+    frame 0
+    call print_N::print_42
+    izero 0
+    end
+.end
@@ -0,0 +1,23 @@
+; blocks of a module linked at runtime are materialized when they are first entered
+.block: catcher::handle
+    pull 2
+    print 2
+    leave
+.end
+
+.block: catcher::throwing
+    istore 1 42
+    throw 1
+    leave
+.end
+
+.block: catcher::unused
+    leave
+.end
+
+.function: catcher::run
+    tryframe
+    catch "Integer" catcher::handle
+    try catcher::throwing
+    end
+.end
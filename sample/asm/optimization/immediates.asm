@@ -0,0 +1,26 @@
+; This file tests use of immediate operands enabled by optimizations.
+; Bound and step of the loop, and the scale are constants, so
+; instructions using them take them from the instruction and
+; registers holding them are never written.
+
+.function: main
+    istore 1 0
+    istore 2 0
+    istore 3 10
+    istore 4 3
+    fstore 5 0.5
+    .mark: loop
+    ilt 6 1 3
+    branch 6 body done
+    .mark: body
+    iadd 2 2 1
+    iadd 1 4 1
+    jump loop
+    .mark: done
+    print 2
+    itof 7 2
+    fmul 7 5 7
+    print 7
+    izero 0
+    end
+.end
@@ -0,0 +1,22 @@
+; This file tests stack traces of exceptions thrown by inlined code.
+; Function `consume` is inlined into `main` so there is no frame for it, but
+; stack trace must still name it.
+
+.inline: consume
+
+.function: consume
+    arg 1 0
+    move 2 1
+    ; register 1 is empty after the move
+    print 1
+    end
+.end
+
+.function: main
+    istore 3 42
+    frame 1
+    param 0 3
+    call consume
+    izero 0
+    end
+.end
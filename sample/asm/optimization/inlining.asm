@@ -0,0 +1,61 @@
+; This file tests inlining of functions enabled by -O2 (and by `.inline:` directives from -O1).
+; Calls to inlined functions are replaced by their code, and
+; the program must print the same output as when it is not optimized.
+
+.inline: clamp
+
+.function: square
+    arg 1 0
+    imul 0 1 1
+    end
+.end
+
+; clamp is larger than functions inlined at -O2, but
+; .inline: directive requests it to be inlined
+.function: clamp
+    .name: 1 value
+    .name: 2 limit
+    .name: 3 over
+    arg value 0
+    istore limit 100
+    igt over value limit
+    branch over too_big fits
+    .mark: too_big
+    copy 0 limit
+    jump done
+    .mark: fits
+    copy 0 value
+    .mark: done
+    iinc limit
+    idec limit
+    iinc limit
+    idec limit
+    iinc limit
+    idec limit
+    end
+.end
+
+.function: main
+    istore 1 7
+    frame 1
+    param 0 1
+    call 2 square
+
+    frame 1
+    param 0 2
+    call 3 square
+
+    frame 1
+    param 0 2
+    call 4 clamp
+
+    frame 1
+    param 0 3
+    call 5 clamp
+
+    print 2
+    print 4
+    print 5
+    izero 0
+    end
+.end
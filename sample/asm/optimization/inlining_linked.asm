@@ -0,0 +1,13 @@
+; This file tests inlining of functions of statically linked modules.
+; Function `jumprint` comes from linking/static/jumplib.asm.
+
+.inline: jumprint
+
+.function: main
+    istore 1 42
+    frame 1
+    param 0 1
+    call 0 jumprint
+    izero 0
+    end
+.end
@@ -0,0 +1,32 @@
+; This file tests peephole optimizations enabled by -O1.
+; Every optimization must leave the output of the program unchanged.
+
+.function: nothing
+    end
+.end
+
+.function: main
+    istore 1 6
+    istore 2 7
+    ; folded into `istore 3 42`
+    imul 3 1 2
+
+    ; condition is known, so the branch becomes a jump and
+    ; code it skips is removed
+    ilt 4 1 2
+    branch 4 less greater_or_equal
+    .mark: greater_or_equal
+    strstore 5 "wrong"
+    print 5
+
+    .mark: less
+    ; calls to functions that do nothing are removed
+    frame 0
+    call nothing
+    jump report
+
+    .mark: report
+    print 3
+    izero 0
+    end
+.end
@@ -0,0 +1,36 @@
+; This file tests constant propagation enabled by -O2.
+; Bound and scale of the loop are known constants and
+; stay known after the loop, even though control reaches it from two places.
+
+.function: main
+    .name: 1 bound
+    .name: 2 scale
+    .name: 7 counter
+    istore bound 10
+    istore scale 3
+    imul 3 bound scale
+    itof 4 3
+    fstore 5 0.5
+    fmul 6 4 5
+
+    istore counter 0
+    .mark: loop
+    ilt 8 counter 3
+    branch 8 body done
+    .mark: body
+    iinc counter
+    jump loop
+
+    .mark: done
+    igt 9 3 bound
+    branch 9 finish wrong
+    .mark: wrong
+    strstore 10 "wrong"
+    print 10
+
+    .mark: finish
+    print counter
+    print 6
+    izero 0
+    end
+.end
@@ -0,0 +1,45 @@
+; This file tests that optimizations back off from registers that
+; are accessed through references or register indirection.
+
+.function: referenced
+    ; register 1 is changed through the reference in register 2
+    istore 1 0
+    ref 2 1
+    iinc 2
+    branch 1 ok wrong
+
+    .mark: wrong
+    strstore 3 "wrong"
+    print 3
+    end
+
+    .mark: ok
+    print 1
+    end
+.end
+
+.function: indirect
+    ; register 2 is changed through the index stored in register 1
+    istore 1 2
+    istore 2 0
+    iinc @1
+    branch 2 ok wrong
+
+    .mark: wrong
+    strstore 3 "wrong"
+    print 3
+    end
+
+    .mark: ok
+    print 2
+    end
+.end
+
+.function: main
+    frame 0
+    call referenced
+    frame 0
+    call indirect
+    izero 0
+    end
+.end
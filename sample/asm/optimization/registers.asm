@@ -0,0 +1,36 @@
+; This file tests register allocation enabled by -O2.
+; Registers of sum are spread over a large register set and
+; values travel between them through moves, so they can be packed into
+; a few registers and most of the moves dropped.
+; The frame of the call to sum is then given only as many registers as sum uses.
+
+.function: sum
+    .name: 20 n
+    .name: 30 total
+    .name: 40 i
+    arg n 0
+    istore total 0
+    istore i 0
+    .mark: loop
+    ilt 50 i n
+    branch 50 body done
+    .mark: body
+    iadd 60 total i
+    move total 60
+    iinc i
+    jump loop
+    .mark: done
+    move 70 total
+    move 0 70
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1 128
+    param 0 1
+    call 2 sum
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,28 @@
+.function: countdown
+    .name: 1 counter
+    arg counter 0
+
+    izero 2
+    ieq 3 counter 2
+    branch 3 finish
+
+    idec counter
+    frame 1
+    param 0 counter
+    call countdown
+    end
+
+    .mark: finish
+    strstore 4 "done"
+    throw 4
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1
+    param 0 1
+    call countdown
+    izero 0
+    end
+.end
@@ -0,0 +1,69 @@
+.function: sum
+    ; adds numbers from counter down to 1 to the accumulator passed by reference
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    arg accumulator 1
+
+    izero 3
+    ieq 4 counter 3
+    branch 4 finish
+
+    iadd accumulator accumulator counter
+    idec counter
+    frame 2
+    param 0 counter
+    paref 1 accumulator
+    ; return value is discarded, and neither function returns one
+    call sum
+
+    .mark: finish
+    end
+.end
+
+.function: count
+    ; returns accumulator increased by one counter times
+    .name: 1 counter
+    .name: 2 accumulator
+    arg counter 0
+    arg accumulator 1
+
+    izero 3
+    ieq 4 counter 3
+    branch 4 finish
+
+    iinc accumulator
+    idec counter
+    frame 2
+    param 0 counter
+    param 1 accumulator
+    ; returned value is returned as is
+    call 5 count
+    move 0 5
+    end
+
+    .mark: finish
+    move 0 accumulator
+    end
+.end
+
+.function: main
+    istore 1 1000
+    izero 2
+    frame 2
+    param 0 1
+    paref 1 2
+    call sum
+    print 2
+
+    istore 3 2000
+    izero 4
+    frame 2
+    param 0 3
+    param 1 4
+    call 5 count
+    print 5
+
+    izero 0
+    end
+.end
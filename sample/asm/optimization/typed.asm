@@ -0,0 +1,33 @@
+; This file tests specialisation of integer instructions enabled by -O2.
+; Counter and accumulator of the loop are known to hold integers, so
+; arithmetic on them needs no type checks.
+; Argument of the function could be anything, so
+; instructions using it check types of operands first.
+
+.function: scaled
+    arg 1 0
+    istore 2 0
+    istore 3 0
+    .mark: loop
+    ilt 4 3 1
+    branch 4 body done
+    .mark: body
+    iadd 2 2 3
+    iinc 3
+    jump loop
+    .mark: done
+    imul 6 2 1
+    print 6
+    move 0 6
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1
+    param 0 1
+    call 2 scaled
+    print 2
+    izero 0
+    end
+.end
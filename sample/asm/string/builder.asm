@@ -0,0 +1,29 @@
+; This script tests string builder instructions.
+; Pieces are appended in a loop and the result is finalized into a flat String.
+
+.function: main
+    strbuild 1
+    strstore 2 "n:"
+    strstore 3 " "
+
+    istore 4 0
+    istore 5 4
+
+    .mark: loop
+    ilt 6 4 5
+    not 6
+    branch 6 done
+    strappend 1 2
+    strappend 1 4
+    strappend 1 3
+    iinc 4
+    jump loop
+
+    .mark: done
+    strappendr 1 2
+    strfinal 7 1
+    print 7
+
+    izero 0
+    end
+.end
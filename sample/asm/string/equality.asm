@@ -0,0 +1,25 @@
+; This script tests support for string equality checking.
+; Strings created from the same literal share interned storage, and
+; strings modified or created at runtime are compared by value.
+
+.function: main
+    strstore 1 "Hello World!"
+    strstore 2 "Hello World!"
+    strstore 3 "Hello Perl!"
+
+    ; should be true (both interned, same pool entry)
+    streq 4 1 2
+    print 4
+
+    ; should be false
+    streq 4 1 3
+    print 4
+
+    ; should be true (copy shares interned storage)
+    copy 5 1
+    streq 4 5 2
+    print 4
+
+    izero 0
+    end
+.end
@@ -0,0 +1,81 @@
+; This script tests vector views (slices).
+; Views refer to storage of their parent vector instead of copying elements.
+; Sum of the vector is calculated recursively by splitting views in halves.
+
+.function: sum
+    .name: 1 view
+    .name: 2 length
+    .name: 3 middle
+    .name: 4 left
+    .name: 5 right
+    .name: 6 tmp
+    arg view 0
+
+    vslen length view
+
+    istore tmp 1
+    igt tmp length tmp
+    branch tmp split
+
+    ; view of length 1 (this sample never sums empty views)
+    vsat 0 view 0
+    end
+
+    .mark: split
+    istore tmp 2
+    idiv middle length tmp
+
+    vslice left view 0 @middle
+    vslice right view @middle
+
+    frame 1
+    param 0 left
+    call left sum
+
+    frame 1
+    param 0 right
+    call right sum
+
+    iadd 0 left right
+    end
+.end
+
+.function: main
+    vec 1
+    istore 2 1
+    .mark: fill
+    vpush 1 2
+    iinc 2
+    istore 3 9
+    ilt 3 2 3
+    branch 3 fill
+
+    ; view of elements 2..5
+    vslice 4 1 2 6
+    print 4
+
+    ; view of a view
+    vslice 5 4 1 -2
+    print 5
+    vslen 6 5
+    print 6
+    vsat 6 5 0
+    print 6
+
+    ; sum of all elements
+    vslice 7 1 0
+    frame 1
+    param 0 7
+    call 8 sum
+    print 8
+
+    ; modifying the vector detaches its views
+    vpush 1 2
+    print 4
+
+    vsmat 9 4
+    print 9
+
+    izero 0
+    end
+.end
@@ -0,0 +1,202 @@
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <tuple>
+#include <unistd.h>
+#include <viua/bytecode/format.h>
+#include <viua/bytecode/operands.h>
+#include <viua/constpool.h>
+#include <viua/cg/assembler/assembler.h>
+using namespace std;
+
+
+// magic number of cached invokables, followed by bytecode format version
+const char CACHE_MAGIC_NUMBER[] = { 'V', 'I', 'U', 'C' };
+
+
+static void appendField(string& out, uint32_t value) {
+    out.append((const char*)&value, sizeof(uint32_t));
+}
+
+static bool readField(const string& s, unsigned& i, uint32_t& value) {
+    if (s.size() < sizeof(uint32_t) or i > (s.size() - sizeof(uint32_t))) {
+        return false;
+    }
+    memcpy(&value, s.data()+i, sizeof(uint32_t));
+    i += sizeof(uint32_t);
+    return true;
+}
+
+static void appendJumps(string& out, const vector<tuple<int, int> >& jumps) {
+    appendField(out, jumps.size());
+    for (tuple<int, int> jmp : jumps) {
+        appendField(out, get<0>(jmp));
+        appendField(out, get<1>(jmp));
+    }
+}
+
+static bool readJumps(const string& s, unsigned& i, vector<tuple<int, int> >& jumps) {
+    uint32_t count = 0, position = 0, instruction = 0;
+    if (not readField(s, i, count)) {
+        return false;
+    }
+    for (uint32_t j = 0; j < count; ++j) {
+        if (not (readField(s, i, position) and readField(s, i, instruction))) {
+            return false;
+        }
+        jumps.push_back(tuple<int, int>(position, instruction));
+    }
+    return true;
+}
+
+
+assembler::cache::key_type assembler::cache::hash(const string& s, key_type h) {
+    /** Return FNV-1a hash of given string.
+     *
+     *  Hash of a previous string can be given as the starting value to
+     *  hash several strings as if they were one.
+     */
+    for (char c : s) {
+        h = ((h ^ static_cast<unsigned char>(c)) * 1099511628211ULL);
+    }
+    return h;
+}
+
+string assembler::cache::path(const string& directory, key_type key, const string& extension) {
+    ostringstream oss;
+    oss << directory << '/' << hex << setw(16) << setfill('0') << key << extension;
+    return oss.str();
+}
+
+bool assembler::cache::fetch(const string& path, string& contents) {
+    /** Read cache entry.
+     *
+     *  Returns false if there is no such entry.
+     */
+    ifstream in(path, ios::in | ios::binary);
+    if (not in) {
+        return false;
+    }
+    ostringstream oss;
+    oss << in.rdbuf();
+    contents = oss.str();
+    return (not in.bad());
+}
+
+bool assembler::cache::store(const string& path, const string& contents) {
+    /** Write cache entry.
+     *
+     *  Entry is written to a temporary file and renamed so that
+     *  assemblers running in parallel never see partially written entries.
+     *  Failure to store an entry is not an error - it will just be rebuilt next time.
+     */
+    ostringstream tmp;
+    tmp << path << ".tmp" << getpid();
+
+    ofstream out(tmp.str(), ios::out | ios::binary);
+    if (not out) {
+        return false;
+    }
+    out.write(contents.data(), contents.size());
+    out.close();
+    if (not out or rename(tmp.str().c_str(), path.c_str()) != 0) {
+        remove(tmp.str().c_str());
+        return false;
+    }
+    return true;
+}
+
+
+string assembler::cache::dump(const Invokable& invokable) {
+    /** Serialize invokable to be stored in cache.
+     */
+    string out(CACHE_MAGIC_NUMBER, sizeof(CACHE_MAGIC_NUMBER));
+    out.push_back(static_cast<char>(VIUA_BYTECODE_VERSION));
+
+    appendField(out, invokable.bytecode.size());
+    out.append(invokable.bytecode);
+    appendJumps(out, invokable.jumps_absolute);
+    appendJumps(out, invokable.jumps_to_byte);
+
+    appendField(out, invokable.constants.size());
+    for (tuple<int, ConstantKind, string> constant : invokable.constants) {
+        appendField(out, get<0>(constant));
+        appendField(out, get<1>(constant));
+        appendField(out, get<2>(constant).size());
+        out.append(get<2>(constant));
+    }
+    return out;
+}
+
+bool assembler::cache::load(const string& s, Invokable& invokable) {
+    /** Deserialize invokable read from cache.
+     *
+     *  Returns false if the entry is malformed, e.g. it was truncated.
+     */
+    unsigned i = (sizeof(CACHE_MAGIC_NUMBER) + 1);
+    if (s.size() < i or s.compare(0, sizeof(CACHE_MAGIC_NUMBER), CACHE_MAGIC_NUMBER, sizeof(CACHE_MAGIC_NUMBER)) != 0 or static_cast<uint8_t>(s[i-1]) != VIUA_BYTECODE_VERSION) {
+        return false;
+    }
+
+    uint32_t size = 0;
+    if (not readField(s, i, size) or size > (s.size() - i)) {
+        return false;
+    }
+    invokable.bytecode = s.substr(i, size);
+    i += size;
+
+    if (not (readJumps(s, i, invokable.jumps_absolute) and readJumps(s, i, invokable.jumps_to_byte))) {
+        return false;
+    }
+
+    uint32_t count = 0, offset = 0, kind = 0;
+    if (not readField(s, i, count)) {
+        return false;
+    }
+    for (uint32_t j = 0; j < count; ++j) {
+        if (not (readField(s, i, offset) and readField(s, i, kind) and readField(s, i, size)) or size > (s.size() - i)) {
+            return false;
+        }
+        // opcode, operand-mode byte and two operands must be inside the bytecode
+        if (offset > invokable.bytecode.size() or (invokable.bytecode.size() - offset) < (2 + 2*OPERAND_NARROW_SIZE)) {
+            return false;
+        }
+        invokable.constants.push_back(tuple<int, ConstantKind, string>(offset, ConstantKind(kind), s.substr(i, size)));
+        i += size;
+    }
+    return (i == s.size());
+}
+
+bool assembler::cache::relink(Invokable& invokable, ConstantPoolBuilder& constants) {
+    /** Place literals of cached invokable in constant pool, and
+     *  update instructions to use their indexes in the pool.
+     *
+     *  Returns false if an index does not fit the width its operand was encoded with, and
+     *  the invokable must be assembled again.
+     *  This keeps bytecode identical to what a full assembly would produce.
+     */
+    for (tuple<int, ConstantKind, string> constant : invokable.constants) {
+        int index = static_cast<int>(constants.add(get<1>(constant), get<2>(constant)));
+
+        // literal is always the second integer operand, after opcode and operand-mode byte
+        unsigned position = (get<0>(constant) + 2);
+        byte mode = invokable.bytecode[position-1];
+        position += ((mode & OPERAND_WIDE) ? OPERAND_WIDE_SIZE : OPERAND_NARROW_SIZE);
+        bool wide = ((static_cast<unsigned char>(mode) >> OPERAND_MODE_BITS) & OPERAND_WIDE);
+
+        if (wide == ::operands::isnarrow(index) or position > (invokable.bytecode.size() - (wide ? OPERAND_WIDE_SIZE : OPERAND_NARROW_SIZE))) {
+            return false;
+        }
+        if (wide) {
+            memcpy(&invokable.bytecode[position], &index, OPERAND_WIDE_SIZE);
+        } else {
+            invokable.bytecode[position] = static_cast<char>(index);
+        }
+    }
+    return true;
+}
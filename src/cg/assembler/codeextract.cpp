@@ -3,27 +3,13 @@
 #include <tuple>
 #include <map>
 #include <viua/support/string.h>
+#include <viua/cg/lex.h>
 #include <viua/cg/assembler/assembler.h>
 #include <viua/program.h>
 using namespace std;
 
 
-vector<string> assembler::ce::getilines(const vector<string>& lines) {
-    /*  Clears code from empty lines and comments.
-     */
-    vector<string> ilines;
-    string line;
-
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (!line.size() or line[0] == ';') continue;
-        ilines.push_back(line);
-    }
-
-    return ilines;
-}
-
-map<string, int> assembler::ce::getmarks(const vector<string>& lines) {
+map<string, int> assembler::ce::getmarks(const vector<cg::lex::Line>& lines) {
     /** This function will pass over all instructions and
      * gather "marks", i.e. `.mark: <name>` directives which may be used by
      * `jump` and `branch` instructions.
@@ -34,21 +20,20 @@ map<string, int> assembler::ce::getmarks(const vector<string>& lines) {
      * which would otherwise be treated as instruction indexes.
      */
     map<string, int> marks;
-    string line, mark;
     int instruction = 0;  // we need separate instruction counter because number of lines is not exactly number of instructions
     for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (str::startswith(line, ".name:") or str::startswith(line, ".link:")) {
-            // names and links can be safely skipped as they are not CPU instructions
+        const string& token = lines[i][0];
+        if (token == ".name:" or token == ".link:" or token == ".inline:") {
+            // names, links and inlining hints can be safely skipped as they are not CPU instructions
             continue;
         }
-        if (str::startswith(line, ".function:")) {
+        if (token == ".function:") {
             // instructions in functions are counted separately so they are
             // not included here
-            while (!str::startswith(lines[i], ".end")) { ++i; }
+            while (i < lines.size() and lines[i][0] != ".end") { ++i; }
             continue;
         }
-        if (!str::startswith(line, ".mark:")) {
+        if (token != ".mark:") {
             // if all previous checks were false, then this line must be either .mark: directive or
             // an instruction
             // if this check is true - then it is an instruction
@@ -56,17 +41,13 @@ map<string, int> assembler::ce::getmarks(const vector<string>& lines) {
             continue;
         }
 
-        // get mark name
-        line = str::lstrip(str::sub(line, 6));
-        mark = str::chunk(line);
-
         // create mark for current instruction
-        marks[mark] = instruction;
+        marks[lines[i][1]] = instruction;
     }
     return marks;
 }
 
-map<string, int> assembler::ce::getnames(const vector<string>& lines) {
+map<string, int> assembler::ce::getnames(const vector<cg::lex::Line>& lines) {
     /** This function will pass over all instructions and
      *  gather "names", i.e. `.name: <register> <name>` instructions which may be used by
      *  as substitutes for register indexes to more easily remember what is stored where.
@@ -77,20 +58,13 @@ map<string, int> assembler::ce::getnames(const vector<string>& lines) {
      *  Example (which also uses marks) name reference could be: `branch if_equals_0 :finish`.
      */
     map<string, int> names;
-    string line, reg, name;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (!str::startswith(line, ".name:")) {
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] != ".name:") {
             continue;
         }
 
-        line = str::lstrip(str::sub(line, 6));
-        reg = str::chunk(line);
-        line = str::lstrip(str::sub(line, reg.size()));
-        name = str::chunk(line);
-
         try {
-            names[name] = stoi(reg);
+            names[line[2]] = stoi(line[1]);
         } catch (const std::invalid_argument& e) {
             throw "invalid register index in .name instruction";
         }
@@ -98,89 +72,49 @@ map<string, int> assembler::ce::getnames(const vector<string>& lines) {
     return names;
 }
 
-vector<string> assembler::ce::getlinks(const vector<string>& lines) {
+vector<string> assembler::ce::getlinks(const vector<cg::lex::Line>& lines) {
     /** This function will pass over all instructions and
      * gather .link: assembler instructions.
      */
     vector<string> links;
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (str::startswith(line, ".link:")) {
-            line = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
-            links.push_back(line);
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] == ".link:") {
+            links.push_back(line[1]);
         }
     }
     return links;
 }
 
-vector<string> assembler::ce::getFunctionNames(const vector<string>& lines) {
+static vector<string> getDeclaredNames(const vector<cg::lex::Line>& lines, const string& directive) {
+    /** Return names declared by given directive (e.g. `.function:` or `.signature:`).
+     */
     vector<string> names;
-
-    string line, holdline;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        holdline = line = lines[i];
-        if (!str::startswith(line, ".function:")) { continue; }
-
-        if (str::startswith(line, ".function:")) {
-            for (int j = i+1; lines[j] != ".end"; ++j, ++i) {}
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] == directive) {
+            names.push_back(line[1]);
         }
-
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-        names.push_back(str::chunk(line));
     }
-
     return names;
 }
-vector<string> assembler::ce::getSignatures(const vector<string>& lines) {
-    vector<string> names;
-
-    string line, holdline;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        holdline = line = lines[i];
-        if (!str::startswith(line, ".signature:")) { continue; }
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-        names.push_back(str::chunk(line));
-    }
 
-    return names;
+vector<string> assembler::ce::getFunctionNames(const vector<cg::lex::Line>& lines) {
+    return getDeclaredNames(lines, ".function:");
 }
-vector<string> assembler::ce::getBlockNames(const vector<string>& lines) {
-    vector<string> names;
-
-    string line, holdline;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        holdline = line = lines[i];
-        if (not str::startswith(line, ".block:")) { continue; }
-
-        if (str::startswith(line, ".block:")) {
-            for (int j = i+1; lines[j] != ".end"; ++j, ++i) {}
-        }
-
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-        string name = str::chunk(line);
-
-        names.push_back(name);
-    }
-
-    return names;
+vector<string> assembler::ce::getSignatures(const vector<cg::lex::Line>& lines) {
+    return getDeclaredNames(lines, ".signature:");
 }
-vector<string> assembler::ce::getBlockSignatures(const vector<string>& lines) {
-    vector<string> names;
-
-    string line, holdline;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        holdline = line = lines[i];
-        if (!str::startswith(line, ".bsignature:")) { continue; }
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-        names.push_back(str::chunk(line));
-    }
-
-    return names;
+vector<string> assembler::ce::getBlockNames(const vector<cg::lex::Line>& lines) {
+    return getDeclaredNames(lines, ".block:");
+}
+vector<string> assembler::ce::getBlockSignatures(const vector<cg::lex::Line>& lines) {
+    return getDeclaredNames(lines, ".bsignature:");
+}
+vector<string> assembler::ce::getInlined(const vector<cg::lex::Line>& lines) {
+    return getDeclaredNames(lines, ".inline:");
 }
 
-map<string, vector<string> > assembler::ce::getInvokables(const string& type, const vector<string>& lines) {
-    map<string, vector<string> > invokables;
+map<string, vector<cg::lex::Line> > assembler::ce::getInvokables(const string& type, const vector<cg::lex::Line>& lines) {
+    map<string, vector<cg::lex::Line> > invokables;
 
     string opening;
     if (type == "function") {
@@ -189,24 +123,22 @@ map<string, vector<string> > assembler::ce::getInvokables(const string& type, co
         opening = ".block:";
     }
 
-    string line, holdline;
     for (unsigned i = 0; i < lines.size(); ++i) {
-        holdline = line = lines[i];
-        if (!str::startswith(line, opening)) { continue; }
+        if (lines[i][0] != opening) { continue; }
 
-        vector<string> flines;
-        for (int j = i+1; lines[j] != ".end"; ++j, ++i) {
-            if (str::startswith(lines[j], opening)) {
-                throw ("another " + type + " opened before assembler reached .end after '" + str::chunk(str::sub(holdline, str::chunk(holdline).size())) + "' " + type);
+        const cg::lex::Line& holdline = lines[i];
+        vector<cg::lex::Line> flines;
+        for (++i; i < lines.size() and lines[i].text != ".end"; ++i) {
+            if (lines[i][0] == opening) {
+                throw ("another " + type + " opened before assembler reached .end after '" + holdline[1] + "' " + type);
             }
-            flines.push_back(lines[j]);
+            flines.push_back(lines[i]);
+        }
+        if (i == lines.size()) {
+            throw ("missing .end after '" + holdline[1] + "' " + type);
         }
 
-        line = str::lstrip(str::sub(line, opening.size()));
-        string name = str::chunk(line);
-        line = str::lstrip(str::sub(line, name.size()));
-
-        invokables[name] = flines;
+        invokables[holdline[1]] = flines;
     }
 
     return invokables;
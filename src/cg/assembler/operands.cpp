@@ -1,6 +1,7 @@
 #include <string>
 #include <tuple>
 #include <viua/support/string.h>
+#include <viua/cg/lex.h>
 #include <viua/cg/assembler/assembler.h>
 #include <viua/program.h>
 using namespace std;
@@ -8,44 +9,30 @@ using namespace std;
 
 int_op assembler::operands::getint(const string& s) {
     bool ref = s[0] == '@';
-    return tuple<bool, int>(ref, stoi(ref ? str::sub(s, 1) : s));
+    return tuple<bool, int>(ref, stoi(ref ? s.substr(1) : s));
 }
 
 byte_op assembler::operands::getbyte(const string& s) {
     bool ref = s[0] == '@';
-    return tuple<bool, char>(ref, (char)stoi(ref ? str::sub(s, 1) : s));
+    return tuple<bool, char>(ref, (char)stoi(ref ? s.substr(1) : s));
 }
 
 float_op assembler::operands::getfloat(const string& s) {
     bool ref = s[0] == '@';
-    return tuple<bool, float>(ref, stof(ref ? str::sub(s, 1) : s));
+    return tuple<bool, float>(ref, stof(ref ? s.substr(1) : s));
 }
 
-tuple<string, string> assembler::operands::get2(string s) {
-    /** Returns tuple of two strings - two operands chunked from the `s` string.
+tuple<string, string> assembler::operands::get2(const cg::lex::Line& line) {
+    /** Returns tuple of two strings - two operands of the instruction.
      */
-    string op_a, op_b;
-    op_a = str::chunk(s);
-    s = str::sub(s, op_a.size());
-    op_b = str::chunk(s);
-    return tuple<string, string>(op_a, op_b);
+    return tuple<string, string>(line[1], line[2]);
 }
 
-tuple<string, string, string> assembler::operands::get3(string s, bool fill_third) {
-    string op_a, op_b, op_c;
-
-    op_a = str::chunk(s);
-    s = str::lstrip(str::sub(s, op_a.size()));
-
-    op_b = str::chunk(s);
-    s = str::lstrip(str::sub(s, op_b.size()));
-
-    /* If s is empty and fill_third is true, use first operand as a filler.
-     * In any other case, use the chunk of s.
-     * The chunk of empty string will give us empty string and
+tuple<string, string, string> assembler::operands::get3(const cg::lex::Line& line, bool fill_third) {
+    /* If third operand is missing and fill_third is true, use first operand as a filler.
+     * In any other case, use the third operand.
+     * Missing operand is an empty string and
      * it is a valid (and sometimes wanted) value to return.
      */
-    op_c = (s.size() == 0 and fill_third ? op_a : str::chunk(s));
-
-    return tuple<string, string, string>(op_a, op_b, op_c);
+    return tuple<string, string, string>(line[1], line[2], ((line.tokens.size() < 4 and fill_third) ? line[1] : line[3]));
 }
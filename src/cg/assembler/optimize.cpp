@@ -0,0 +1,2312 @@
+#include <climits>
+#include <cmath>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <functional>
+#include <viua/support/string.h>
+#include <viua/cg/lex.h>
+#include <viua/cg/assembler/assembler.h>
+using namespace std;
+
+
+// instructions placing a new object in the register given as their first operand, and reading no registers
+static const set<string> CONSTANT_LOADS = { "izero", "istore", "fstore", "bstore", "strstore", "atom", "vec", };
+
+// `<instr> <result> <lhs> [<rhs>]`, result register doubles as a missing right-hand side operand
+static const set<string> INTEGER_ARITHMETIC = { "iadd", "isub", "imul", "idiv", };
+static const set<string> INTEGER_COMPARISONS = { "ilt", "ilte", "igt", "igte", "ieq", };
+static const set<string> FLOAT_ARITHMETIC = { "fadd", "fsub", "fmul", "fdiv", };
+static const set<string> FLOAT_COMPARISONS = { "flt", "flte", "fgt", "fgte", "feq", };
+
+// `<instr> <result> <lhs> <literal>`, forms of the above taking their right-hand side operand from the instruction
+static const set<string> INTEGER_IMMEDIATES = { "iaddi", "isubi", "imuli", "idivi", "ilti", "iltei", "igti", "igtei", "ieqi", };
+static const set<string> FLOAT_IMMEDIATES = { "faddi", "fsubi", "fmuli", "fdivi", "flti", "fltei", "fgti", "fgtei", "feqi", };
+
+// `<instr> <result> [<source>]`, result register doubles as a missing source operand
+static const set<string> CASTS = { "itof", "ftoi", };
+
+// instructions after which control never reaches the next instruction
+static const set<string> TERMINATORS = { "jump", "end", "halt", "leave", "throw", "tailcall", };
+
+// instructions whose effect on registers is modelled exactly by the passes below
+static const set<string> MODELLED = {
+    "izero", "istore", "fstore", "bstore", "strstore", "atom", "vec",
+    "iadd", "isub", "imul", "idiv",
+    "ilt", "ilte", "igt", "igte", "ieq",
+    "fadd", "fsub", "fmul", "fdiv",
+    "flt", "flte", "fgt", "fgte", "feq",
+    "iaddi", "isubi", "imuli", "idivi", "ilti", "iltei", "igti", "igtei", "ieqi",
+    "faddi", "fsubi", "fmuli", "fdivi", "flti", "fltei", "fgti", "fgtei", "feqi",
+    "iinc", "idec", "itof", "ftoi", "not",
+    "copy", "move", "empty", "free",
+    "print", "echo", "param", "frame",
+    "branch", "jump", "nop", "end", "halt", "leave",
+};
+
+// instructions functions must consist of to be inlined
+static const set<string> INLINABLE = {
+    "izero", "istore", "fstore", "bstore", "strstore", "atom", "vec",
+    "iadd", "isub", "imul", "idiv",
+    "ilt", "ilte", "igt", "igte", "ieq",
+    "fadd", "fsub", "fmul", "fdiv",
+    "flt", "flte", "fgt", "fgte", "feq",
+    "iaddi", "isubi", "imuli", "idivi", "ilti", "iltei", "igti", "igtei", "ieqi",
+    "faddi", "fsubi", "fmuli", "fdivi", "flti", "fltei", "fgti", "fgtei", "feqi",
+    "iinc", "idec", "itof", "ftoi", "not",
+    "copy", "move", "empty", "free",
+    "print", "echo", "arg",
+    "branch", "jump", "nop", "end",
+};
+
+// instructions besides the modelled ones with known register operands (indexes of tokens), which
+// may be given other registers; `call` and `excall` name a register only if they are given a return register
+static const map<string, vector<unsigned> > RENUMBERABLE = {
+    { "arg", { 1 } }, { "argc", { 1 } },
+    { "call", { 1 } }, { "tailcall", {} }, { "excall", { 1 } }, { "fcall", { 1, 2 } }, { "function", { 1 } },
+    { "isnull", { 1, 2 } }, { "swap", { 1, 2 } },
+    { "bool", { 1 } }, { "and", { 1, 2, 3 } }, { "or", { 1, 2, 3 } },
+    { "badd", { 1, 2, 3 } }, { "bsub", { 1, 2, 3 } }, { "binc", { 1 } }, { "bdec", { 1 } },
+    { "blt", { 1, 2, 3 } }, { "blte", { 1, 2, 3 } }, { "bgt", { 1, 2, 3 } }, { "bgte", { 1, 2, 3 } }, { "beq", { 1, 2, 3 } },
+    { "stoi", { 1, 2 } }, { "stof", { 1, 2 } }, { "streq", { 1, 2, 3 } }, { "atomeq", { 1, 2, 3 } },
+    { "vpush", { 1, 2 } }, { "vlen", { 1, 2 } }, { "vinsert", { 1, 2 } }, { "vpop", { 1, 2 } }, { "vat", { 1, 2 } },
+    { "throw", { 1 } }, { "tmpri", { 1 } }, { "tmpro", { 1 } },
+};
+
+// maximum number of times passes are run over a body
+const unsigned OPTIMIZATION_ROUNDS = 16;
+
+// functions of at most this many instructions (not counting `arg` and `end`) are inlined at -O2
+const unsigned INLINING_THRESHOLD = 8;
+
+// number of local registers `frame` gives when it has no operands
+const unsigned DEFAULT_FRAME_SIZE = 16;
+
+
+static string reg(const string& token, const map<string, int>& names) {
+    /** Return index of register given operand refers to, or
+     *  empty string if the operand does not name a register directly (e.g. uses `@` indirection).
+     */
+    if (token.empty() or token[0] == '@') {
+        return "";
+    }
+    if (str::isnum(token, false)) {
+        return (token.size() < 10 ? to_string(stoi(token)) : "");
+    }
+    map<string, int>::const_iterator found = names.find(token);
+    return (found == names.end() ? "" : to_string(found->second));
+}
+
+static bool literal(const string& token, const map<string, int>& names, int& value) {
+    /** Read integer literal the way the assembler reads it (names stand for their register indexes).
+     */
+    if (token.size() and token.size() < 10 and str::isnum(token)) {
+        value = stoi(token);
+        return true;
+    }
+    map<string, int>::const_iterator found = names.find(token);
+    if (token.size() and token[0] != '@' and found != names.end()) {
+        value = found->second;
+        return true;
+    }
+    return false;
+}
+
+static bool immediate(const string& instr) {
+    return (INTEGER_IMMEDIATES.count(instr) or FLOAT_IMMEDIATES.count(instr));
+}
+
+static string registerForm(const string& instr) {
+    /** Return name of instruction taking both operands from registers, given name of its immediate form.
+     */
+    return (immediate(instr) ? instr.substr(0, instr.size()-1) : instr);
+}
+
+static vector<unsigned> targets(const cg::lex::Line& line) {
+    /** Return indexes of tokens that are jump targets.
+     */
+    vector<unsigned> found;
+    if (line[0] == "jump") {
+        found.push_back(1);
+    } else if (line[0] == "branch") {
+        found.push_back(2);
+        if (line[3].size()) {
+            found.push_back(3);
+        }
+    }
+    return found;
+}
+
+static cg::lex::Line rewrite(const cg::lex::Line& line, const vector<string>& tokens) {
+    /** Return line made of given tokens, numbered as the line it replaces.
+     */
+    string text;
+    for (unsigned i = 0; i < tokens.size(); ++i) {
+        text += (i ? " " : "") + tokens[i];
+    }
+    return cg::lex::tokenise(text, line.number);
+}
+
+static set<string> getmarks(const vector<cg::lex::Line>& body) {
+    set<string> marks;
+    for (const cg::lex::Line& line : body) {
+        if (line[0] == ".mark:") {
+            marks.insert(line[1]);
+        }
+    }
+    return marks;
+}
+
+static set<string> gettargeted(const vector<cg::lex::Line>& body) {
+    /** Return marks some jump or branch leads to.
+     */
+    set<string> targeted;
+    for (const cg::lex::Line& line : body) {
+        for (unsigned t : targets(line)) {
+            targeted.insert(line[t]);
+        }
+    }
+    return targeted;
+}
+
+static bool closing(const vector<cg::lex::Line>& body, unsigned i) {
+    /** Check if given line is the returning instruction closing the body.
+     *
+     *  Such instructions are kept even if unreachable so that disassembled code can be assembled again.
+     */
+    if (not (body[i][0] == "end" or body[i][0] == "leave" or body[i][0] == "halt")) {
+        return false;
+    }
+    for (++i; i < body.size(); ++i) {
+        if (not body[i].directive()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+struct Value {
+    /** Object known to be held by a register.
+     */
+    enum Kind { INTEGER, FLOAT, BOOLEAN } kind;
+    int integer;
+    float real;
+    bool truth;
+
+    static Value ofInteger(int n) {
+        return Value{INTEGER, n, 0, (n != 0)};
+    }
+    static Value ofFloat(float f) {
+        return Value{FLOAT, 0, f, (f != 0)};
+    }
+    static Value ofBoolean(bool b) {
+        return Value{BOOLEAN, 0, 0, b};
+    }
+
+    bool operator==(const Value& that) const {
+        return (kind == that.kind and integer == that.integer and real == that.real and truth == that.truth);
+    }
+    bool operator!=(const Value& that) const {
+        return not (*this == that);
+    }
+};
+
+struct Window {
+    /** What is known about registers at a point of code.
+     *
+     *  Values are only recorded for tracked registers (see trackedRegisters()), but
+     *  whether a register is empty does not depend on references so it is recorded for all of them.
+     */
+    map<string, Value> values;
+    set<string> filled;
+    set<string> vacated;
+
+    void forget(const string& r) {
+        values.erase(r);
+        filled.erase(r);
+        vacated.erase(r);
+    }
+    void clear() {
+        values.clear();
+        filled.clear();
+        vacated.clear();
+    }
+
+    bool operator==(const Window& that) const {
+        return (values == that.values and filled == that.filled and vacated == that.vacated);
+    }
+    bool operator!=(const Window& that) const {
+        return not (*this == that);
+    }
+};
+
+static Window meet(const Window& a, const Window& b) {
+    /** Return what is known at a point control reaches from two places.
+     */
+    Window met;
+    for (const pair<const string, Value>& each : a.values) {
+        map<string, Value>::const_iterator other = b.values.find(each.first);
+        if (other != b.values.end() and other->second == each.second) {
+            met.values.insert(each);
+        }
+    }
+    for (const string& r : a.filled) {
+        if (b.filled.count(r)) {
+            met.filled.insert(r);
+        }
+    }
+    for (const string& r : a.vacated) {
+        if (b.vacated.count(r)) {
+            met.vacated.insert(r);
+        }
+    }
+    return met;
+}
+
+struct Body {
+    /** Facts about a function or block being optimized.
+     */
+    map<string, int> names;
+    set<string> marks;
+    // registers that can never hold references, so values written to them can be tracked
+    set<string> tracked;
+    // registers may hold objects before the first instruction runs
+    bool prefilled;
+};
+
+static vector<string> operands(const cg::lex::Line& line, const map<string, int>& names) {
+    /** Return registers given line names directly.
+     */
+    // frame operands are counts and param's first operand is an index, neither is a register
+    unsigned first = ((line[0] == "frame") ? line.tokens.size() : (line[0] == "param" ? 2 : 1));
+    // jump targets are marks, and constants are literals
+    unsigned last = line.tokens.size();
+    if (line[0] == "jump") {
+        last = 1;
+    } else if (line[0] == "branch" or (CONSTANT_LOADS.count(line[0]) and line[0] != "vec")) {
+        last = 2;
+    } else if (immediate(line[0])) {
+        last = 3;
+    }
+
+    vector<string> found;
+    for (unsigned i = first; i < last; ++i) {
+        string r = reg(line[i], names);
+        if (r.size()) {
+            found.push_back(r);
+        }
+    }
+    return found;
+}
+
+static set<string> trackedRegisters(const vector<cg::lex::Line>& body, const map<string, int>& names) {
+    /** Return registers whose values can be tracked.
+     *
+     *  Writing to a register flagged as a reference changes the referenced object (or nothing at all), so
+     *  values can only be tracked in registers that are never flagged.
+     *  Registers are flagged by `ref`, `arg`, calls, closures, etc. and the flags travel with objects moved between registers.
+     *  A register is tracked only if all instructions that use it are ones whose effects are modelled exactly, and
+     *  objects are moved into it only from other tracked registers.
+     */
+    set<string> all, tainted;
+    for (const cg::lex::Line& line : body) {
+        if (line.directive()) {
+            continue;
+        }
+        for (const string& r : operands(line, names)) {
+            all.insert(r);
+            if (not MODELLED.count(line[0])) {
+                tainted.insert(r);
+            }
+        }
+    }
+
+    // flags travel with moved objects
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const cg::lex::Line& line : body) {
+            if (line[0] != "move") {
+                continue;
+            }
+            string target = reg(line[1], names), source = reg(line[2], names);
+            if (tainted.count(source) and not tainted.count(target)) {
+                tainted.insert(target);
+                changed = true;
+            }
+        }
+    }
+
+    set<string> tracked;
+    for (string r : all) {
+        if (not tainted.count(r)) {
+            tracked.insert(r);
+        }
+    }
+    return tracked;
+}
+
+static bool fold(const string& instr, int lhs, int rhs, int& result) {
+    /** Compute result of integer arithmetic, unless it would fail or overflow at run time.
+     */
+    long long value = 0;
+    if (instr == "iadd") {
+        value = (static_cast<long long>(lhs) + rhs);
+    } else if (instr == "isub") {
+        value = (static_cast<long long>(lhs) - rhs);
+    } else if (instr == "imul") {
+        value = (static_cast<long long>(lhs) * rhs);
+    } else if (instr == "idiv") {
+        if (rhs == 0) {
+            return false;
+        }
+        value = (static_cast<long long>(lhs) / rhs);
+    } else {
+        return false;
+    }
+    if (value < INT_MIN or value > INT_MAX) {
+        return false;
+    }
+    result = static_cast<int>(value);
+    return true;
+}
+
+static float fold(const string& instr, float lhs, float rhs) {
+    if (instr == "fadd") {
+        return (lhs + rhs);
+    } else if (instr == "fsub") {
+        return (lhs - rhs);
+    } else if (instr == "fmul") {
+        return (lhs * rhs);
+    }
+    return (lhs / rhs);
+}
+
+template<typename T> static bool compare(const string& instr, T lhs, T rhs) {
+    // integer and float comparisons differ only in their first letter
+    string relation = instr.substr(1);
+    if (relation == "lt") {
+        return (lhs < rhs);
+    } else if (relation == "lte") {
+        return (lhs <= rhs);
+    } else if (relation == "gt") {
+        return (lhs > rhs);
+    } else if (relation == "gte") {
+        return (lhs >= rhs);
+    }
+    return (lhs == rhs);
+}
+
+static bool evaluate(const cg::lex::Line& line, const Window& window, const Body& facts, Value& result) {
+    /** Compute object given instruction places in its first operand, if
+     *  it is known and the instruction cannot fail.
+     */
+    const string& instr = line[0];
+    int integer = 0;
+
+    if (instr == "izero") {
+        result = Value::ofInteger(0);
+        return true;
+    } else if (instr == "istore") {
+        if (not literal(line[2], facts.names, integer)) {
+            return false;
+        }
+        result = Value::ofInteger(integer);
+        return true;
+    } else if (instr == "fstore") {
+        try {
+            result = Value::ofFloat(static_cast<float>(stod(line[2])));
+        } catch (const std::exception& e) {
+            return false;
+        }
+        return true;
+    }
+
+    string first, second;
+    Value given = Value::ofInteger(0);
+    if (INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr) or FLOAT_ARITHMETIC.count(instr) or FLOAT_COMPARISONS.count(instr)) {
+        first = reg(line[2], facts.names);
+        second = reg((line[3].size() ? line[3] : line[1]), facts.names);
+    } else if (INTEGER_IMMEDIATES.count(instr)) {
+        if (not literal(line[3], facts.names, integer)) {
+            return false;
+        }
+        first = reg(line[2], facts.names);
+        given = Value::ofInteger(integer);
+    } else if (FLOAT_IMMEDIATES.count(instr)) {
+        try {
+            // read the way the assembler reads it
+            given = Value::ofFloat(stof(line[3]));
+        } catch (const std::exception& e) {
+            return false;
+        }
+        first = reg(line[2], facts.names);
+    } else if (CASTS.count(instr) or instr == "copy") {
+        first = reg((line[2].size() ? line[2] : line[1]), facts.names);
+    } else if (instr == "iinc" or instr == "idec" or instr == "not") {
+        first = reg(line[1], facts.names);
+    } else {
+        return false;
+    }
+    if (not window.values.count(first) or (second.size() and not window.values.count(second))) {
+        return false;
+    }
+    const Value& a = window.values.at(first);
+    const Value& b = (second.size() ? window.values.at(second) : (immediate(instr) ? given : a));
+
+    if (instr == "copy") {
+        result = a;
+        return true;
+    } else if (instr == "not") {
+        result = Value::ofBoolean(not a.truth);
+        return true;
+    }
+
+    bool integers = (a.kind == Value::INTEGER and b.kind == Value::INTEGER);
+    bool floats = (a.kind == Value::FLOAT and b.kind == Value::FLOAT);
+    const string operation = registerForm(instr);
+    if (INTEGER_ARITHMETIC.count(operation) and integers and fold(operation, a.integer, b.integer, integer)) {
+        result = Value::ofInteger(integer);
+    } else if (INTEGER_COMPARISONS.count(operation) and integers) {
+        result = Value::ofBoolean(compare(operation, a.integer, b.integer));
+    } else if (FLOAT_ARITHMETIC.count(operation) and floats) {
+        result = Value::ofFloat(fold(operation, a.real, b.real));
+    } else if (FLOAT_COMPARISONS.count(operation) and floats) {
+        result = Value::ofBoolean(compare(operation, a.real, b.real));
+    } else if ((instr == "iinc" or instr == "idec") and integers and fold((instr == "iinc" ? "iadd" : "isub"), a.integer, 1, integer)) {
+        result = Value::ofInteger(integer);
+    } else if (instr == "itof" and integers) {
+        result = Value::ofFloat(static_cast<float>(a.integer));
+    } else if (instr == "ftoi" and floats and std::isfinite(a.real) and a.real > INT_MIN and a.real < INT_MAX) {
+        result = Value::ofInteger(static_cast<int>(a.real));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool materialize(const cg::lex::Line& line, const Value& value, cg::lex::Line& load) {
+    /** Make instruction loading given value into register written by given line.
+     *  There is no instruction loading a boolean.
+     */
+    if (value.kind == Value::INTEGER) {
+        load = rewrite(line, { "istore", line[1], to_string(value.integer) });
+        return true;
+    }
+    if (value.kind == Value::FLOAT and std::isfinite(value.real)) {
+        // enough digits for the literal to be read back as exactly the same float
+        ostringstream literal;
+        literal << setprecision(17) << static_cast<double>(value.real);
+        load = rewrite(line, { "fstore", line[1], literal.str() });
+        return true;
+    }
+    return false;
+}
+
+static bool immediateForm(const cg::lex::Line& line, const Window& window, const Body& facts, cg::lex::Line& rewritten) {
+    /** Make instruction taking known operand of given arithmetic or comparison from the instruction itself, so
+     *  the register holding it need not be read (and its load may become dead).
+     *
+     *  Known left-hand side operands are used only if the operands can be swapped: for addition,
+     *  multiplication and equality, and for ordering comparisons which are mirrored.
+     */
+    const string& instr = line[0];
+    bool integer = (INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr));
+    if (not (integer or FLOAT_ARITHMETIC.count(instr) or FLOAT_COMPARISONS.count(instr))) {
+        return false;
+    }
+    const string& rhs_token = (line[3].size() ? line[3] : line[1]);
+    string result = reg(line[1], facts.names), lhs = reg(line[2], facts.names), rhs = reg(rhs_token, facts.names);
+    if (result.empty() or lhs.empty() or rhs.empty()) {
+        return false;
+    }
+
+    Value::Kind kind = (integer ? Value::INTEGER : Value::FLOAT);
+    auto known = [&window, kind](const string& r) -> bool {
+        map<string, Value>::const_iterator found = window.values.find(r);
+        return (found != window.values.end() and found->second.kind == kind);
+    };
+
+    static const map<string, string> swapped = {
+        { "add", "add" }, { "mul", "mul" }, { "eq", "eq" },
+        { "lt", "gt" }, { "lte", "gte" }, { "gt", "lt" }, { "gte", "lte" },
+    };
+    string operation = instr, operand = line[2], constant = rhs;
+    if (not known(rhs)) {
+        map<string, string>::const_iterator mirrored = swapped.find(instr.substr(1));
+        if (not known(lhs) or mirrored == swapped.end()) {
+            return false;
+        }
+        operation = (instr.substr(0, 1) + mirrored->second);
+        operand = rhs_token;
+        constant = lhs;
+    }
+
+    const Value& value = window.values.at(constant);
+    ostringstream literal;
+    if (integer) {
+        literal << value.integer;
+    } else if (std::isfinite(value.real)) {
+        // enough digits for the literal to be read back as exactly the same float
+        literal << setprecision(17) << static_cast<double>(value.real);
+    } else {
+        return false;
+    }
+    rewritten = rewrite(line, { (operation + 'i'), line[1], operand, literal.str() });
+    return true;
+}
+
+static void update(Window& window, const cg::lex::Line& line, const Body& facts) {
+    /** Apply effects of given instruction to what is known about registers.
+     */
+    if (line.directive()) {
+        return;
+    }
+
+    const string& instr = line[0];
+    if (not MODELLED.count(instr)) {
+        // tracked registers are never used by such instructions, but others may be changed in any way
+        for (const string& r : operands(line, facts.names)) {
+            window.forget(r);
+        }
+        for (set<string>* known : { &window.filled, &window.vacated }) {
+            set<string> kept;
+            for (const string& r : *known) {
+                if (facts.tracked.count(r)) {
+                    kept.insert(r);
+                }
+            }
+            *known = kept;
+        }
+        return;
+    }
+
+    if (instr == "copy" or instr == "move") {
+        string target = reg(line[1], facts.names), source = reg(line[2], facts.names);
+        if (target.empty() or source.empty()) {
+            window.clear();
+            return;
+        }
+        bool has_value = window.values.count(source);
+        Value value = (has_value ? window.values.at(source) : Value::ofInteger(0));
+        bool filled = window.filled.count(source), vacated = window.vacated.count(source);
+
+        window.forget(target);
+        if (instr == "move") {
+            // moving an object leaves its source register empty, even if it is also the target
+            window.forget(source);
+            window.vacated.insert(source);
+            if (target == source) {
+                return;
+            }
+            if (vacated) {
+                window.vacated.insert(target);
+            }
+        }
+        if (instr == "copy" or filled) {
+            window.filled.insert(target);
+        }
+        if (has_value and facts.tracked.count(target) and facts.tracked.count(source)) {
+            window.values[target] = value;
+        }
+    } else if (instr == "empty" or instr == "free") {
+        string target = reg(line[1], facts.names);
+        if (target.empty()) {
+            window.clear();
+            return;
+        }
+        window.forget(target);
+        window.vacated.insert(target);
+    } else if (CONSTANT_LOADS.count(instr) or INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr) or
+               FLOAT_ARITHMETIC.count(instr) or FLOAT_COMPARISONS.count(instr) or immediate(instr) or CASTS.count(instr) or
+               instr == "iinc" or instr == "idec" or instr == "not") {
+        string target = reg(line[1], facts.names);
+        if (target.empty()) {
+            window.clear();
+            return;
+        }
+        Value value = Value::ofInteger(0);
+        bool known = evaluate(line, window, facts, value);
+        window.forget(target);
+        window.filled.insert(target);
+        if (known and facts.tracked.count(target)) {
+            window.values[target] = value;
+        }
+    }
+    // remaining modelled instructions do not write registers
+}
+
+static unsigned nextInstruction(const vector<cg::lex::Line>& body, unsigned i, bool& crosses_mark) {
+    /** Return index of first instruction after given line, and
+     *  whether a mark lies between them.
+     */
+    crosses_mark = false;
+    for (++i; i < body.size() and body[i].directive(); ++i) {
+        crosses_mark = (crosses_mark or body[i][0] == ".mark:");
+    }
+    return i;
+}
+
+
+struct BasicBlock {
+    /** Lines [begin, end) of a body, entered only at the first and left only after the last one.
+     *  Successors are indexes of blocks control may go to next; for blocks
+     *  ending with a branch the first one is taken if the condition is true.
+     */
+    unsigned begin;
+    unsigned end;
+    vector<unsigned> successors;
+    // index of branch instruction ending the block, or end if there is none
+    unsigned branch;
+};
+
+static vector<BasicBlock> basicBlocks(const vector<cg::lex::Line>& body) {
+    /** Split body into basic blocks.
+     *
+     *  Blocks begin at marks some jump or branch leads to, and after jumps, branches and returns.
+     */
+    set<string> targeted = gettargeted(body);
+    vector<BasicBlock> blocks;
+    map<string, unsigned> entries;
+    bool leader = true;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        bool entry = (body[i][0] == ".mark:" and targeted.count(body[i][1]));
+        if (leader or entry) {
+            if (blocks.size()) {
+                blocks.back().end = i;
+            }
+            blocks.push_back(BasicBlock{i, 0, {}, 0});
+            leader = false;
+        }
+        if (entry) {
+            entries[body[i][1]] = (blocks.size() - 1);
+        }
+        leader = (TERMINATORS.count(body[i][0]) or body[i][0] == "branch");
+    }
+    if (blocks.size()) {
+        blocks.back().end = body.size();
+    }
+
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        BasicBlock& block = blocks[b];
+        block.branch = block.end;
+        unsigned last = block.end;
+        for (unsigned i = block.begin; i < block.end; ++i) {
+            if (not body[i].directive()) {
+                last = i;
+            }
+        }
+        bool falls_through = (b+1 < blocks.size());
+        if (last == block.end) {
+            // only directives, control passes to the next block
+        } else if (body[last][0] == "jump") {
+            block.successors.push_back(entries.at(body[last][1]));
+            falls_through = false;
+        } else if (body[last][0] == "branch") {
+            block.branch = last;
+            block.successors.push_back(entries.at(body[last][2]));
+            if (body[last][3].size()) {
+                block.successors.push_back(entries.at(body[last][3]));
+                falls_through = false;
+            }
+        } else if (TERMINATORS.count(body[last][0])) {
+            falls_through = false;
+        }
+        if (falls_through) {
+            block.successors.push_back(b+1);
+        }
+    }
+    return blocks;
+}
+
+
+static bool removeJumpsToNext(vector<cg::lex::Line>& body, vector<assembler::optimize::Change>& changes) {
+    /** Remove jumps to marks placed directly after them.
+     */
+    vector<cg::lex::Line> optimized;
+    bool changed = false;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        if (body[i][0] == "jump") {
+            bool next = false;
+            for (unsigned j = i+1; j < body.size() and body[j].directive() and not next; ++j) {
+                next = (body[j][0] == ".mark:" and body[j][1] == body[i][1]);
+            }
+            if (next) {
+                changes.push_back(assembler::optimize::Change{"jump-to-next", body[i].number, body[i].text, ""});
+                changed = true;
+                continue;
+            }
+        }
+        optimized.push_back(body[i]);
+    }
+    body = optimized;
+    return changed;
+}
+
+static string destination(const string& mark, const map<string, string>& forwards, map<string, string>& resolved) {
+    /** Return mark a jump to given mark ends up at after following all jumps placed directly after marks.
+     *
+     *  Destinations are remembered for every mark on the way, so long chains are followed only once.
+     *  Marks whose jumps form a loop are their own destinations.
+     */
+    vector<string> path;
+    set<string> visited;
+    string current = mark;
+    while (forwards.count(current) and not resolved.count(current) and not visited.count(current)) {
+        path.push_back(current);
+        visited.insert(current);
+        current = forwards.at(current);
+    }
+
+    bool loop = (visited.count(current) and not resolved.count(current));
+    string found = (resolved.count(current) ? resolved.at(current) : current);
+    for (const string& each : path) {
+        resolved[each] = (loop ? each : found);
+    }
+    return (resolved.count(mark) ? resolved.at(mark) : mark);
+}
+
+static bool threadJumps(vector<cg::lex::Line>& body, vector<assembler::optimize::Change>& changes) {
+    /** Make jumps to marks followed by other jumps go directly to the final destination.
+     */
+    map<string, string> forwards;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        if (body[i][0] != ".mark:") {
+            continue;
+        }
+        bool crosses_mark = false;
+        unsigned next = nextInstruction(body, i, crosses_mark);
+        if (next < body.size() and body[next][0] == "jump") {
+            forwards[body[i][1]] = body[next][1];
+        }
+    }
+
+    map<string, string> resolved;
+    bool changed = false;
+    for (cg::lex::Line& line : body) {
+        vector<string> tokens = line.tokens;
+        for (unsigned t : targets(line)) {
+            tokens[t] = destination(tokens[t], forwards, resolved);
+        }
+        if (tokens != line.tokens) {
+            cg::lex::Line threaded = rewrite(line, tokens);
+            changes.push_back(assembler::optimize::Change{"jump-threading", line.number, line.text, threaded.text});
+            line = threaded;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static bool removeUnreachable(vector<cg::lex::Line>& body, vector<assembler::optimize::Change>& changes) {
+    /** Remove instructions that follow an instruction control never falls through, up to
+     *  the next mark some jump or branch leads to.
+     */
+    set<string> targeted = gettargeted(body);
+    vector<cg::lex::Line> optimized;
+    bool changed = false, reachable = true;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        const cg::lex::Line& line = body[i];
+        if (line[0] == ".mark:" and targeted.count(line[1])) {
+            reachable = true;
+        }
+        if (not reachable and not line.directive() and not closing(body, i)) {
+            changes.push_back(assembler::optimize::Change{"unreachable", line.number, line.text, ""});
+            changed = true;
+            continue;
+        }
+        if (TERMINATORS.count(line[0])) {
+            reachable = false;
+        }
+        optimized.push_back(line);
+    }
+    body = optimized;
+    return changed;
+}
+
+static bool removeEmptyCalls(vector<cg::lex::Line>& body, const assembler::optimize::Context& context, const Body& facts, vector<assembler::optimize::Change>& changes) {
+    /** Remove `frame` and `call` pairs calling functions that do nothing, and
+     *  whose return value is discarded.
+     */
+    set<unsigned> removed;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        if (body[i][0] != "frame") {
+            continue;
+        }
+        bool crosses_mark = false;
+        unsigned call = nextInstruction(body, i, crosses_mark);
+        if (crosses_mark or call >= body.size() or body[call][0] != "call") {
+            continue;
+        }
+        const cg::lex::Line& line = body[call];
+        string function = (line[2].size() ? line[2] : line[1]);
+        if (context.empty_functions.count(function) and (line[2].empty() or reg(line[1], facts.names) == "0")) {
+            removed.insert(i);
+            removed.insert(call);
+        }
+    }
+
+    vector<cg::lex::Line> optimized;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        if (removed.count(i)) {
+            changes.push_back(assembler::optimize::Change{"empty-call", body[i].number, body[i].text, ""});
+            continue;
+        }
+        optimized.push_back(body[i]);
+    }
+    body = optimized;
+    return removed.size();
+}
+
+static bool simplifyLocally(vector<cg::lex::Line>& body, const Body& facts, vector<assembler::optimize::Change>& changes) {
+    /** Rewrite instructions using what is known about registers in straight-line code:
+     *
+     *  - branches on registers of known truthiness become jumps (or are removed),
+     *  - arithmetic and casts of registers of known values become `istore` or `fstore`,
+     *  - arithmetic and comparisons with one operand of known value take it as an immediate (e.g. `iaddi`),
+     *  - instructions placing an object in a register that the next instruction overwrites are removed,
+     *  - `move B A` followed by `move C B` becomes `move C A` if B was empty before.
+     */
+    vector<cg::lex::Line> optimized;
+    map<unsigned, cg::lex::Line> replacements;
+    Window window;
+    bool changed = false;
+
+    for (unsigned i = 0; i < body.size(); ++i) {
+        cg::lex::Line line = (replacements.count(i) ? replacements.at(i) : body[i]);
+        if (line.directive()) {
+            if (line[0] == ".mark:") {
+                // control may reach a mark from anywhere
+                window.clear();
+            }
+            optimized.push_back(line);
+            continue;
+        }
+
+        const string& instr = line[0];
+        bool crosses_mark = false;
+        unsigned next = nextInstruction(body, i, crosses_mark);
+        const cg::lex::Line* following = ((next < body.size() and not replacements.count(next)) ? &body[next] : 0);
+
+        Value value = Value::ofInteger(0);
+        cg::lex::Line folded;
+        if (instr == "branch") {
+            string condition = reg(line[1], facts.names);
+            if (window.values.count(condition)) {
+                string destination = (window.values.at(condition).truth ? line[2] : line[3]);
+                if (destination.empty()) {
+                    changes.push_back(assembler::optimize::Change{"constant-branch", line.number, line.text, ""});
+                    changed = true;
+                    continue;
+                }
+                cg::lex::Line jump = rewrite(line, { "jump", destination });
+                changes.push_back(assembler::optimize::Change{"constant-branch", line.number, line.text, jump.text});
+                line = jump;
+                changed = true;
+            }
+        } else if ((INTEGER_ARITHMETIC.count(instr) or FLOAT_ARITHMETIC.count(instr) or CASTS.count(instr) or instr == "iinc" or instr == "idec") and
+                   evaluate(line, window, facts, value) and materialize(line, value, folded)) {
+            changes.push_back(assembler::optimize::Change{"constant-arithmetic", line.number, line.text, folded.text});
+            line = folded;
+            changed = true;
+        } else if (immediateForm(line, window, facts, folded)) {
+            changes.push_back(assembler::optimize::Change{"immediate-operand", line.number, line.text, folded.text});
+            line = folded;
+            changed = true;
+        }
+
+        if (following and (CONSTANT_LOADS.count(line[0]) or line[0] == "copy") and CONSTANT_LOADS.count((*following)[0])) {
+            string target = reg(line[1], facts.names);
+            bool harmless = (line[0] != "copy" or window.filled.count(reg(line[2], facts.names)));
+            if (facts.tracked.count(target) and harmless and reg((*following)[1], facts.names) == target) {
+                changes.push_back(assembler::optimize::Change{"dead-write", line.number, line.text, ""});
+                changed = true;
+                continue;
+            }
+        }
+
+        if (following and not crosses_mark and line[0] == "move" and (*following)[0] == "move") {
+            string a = reg(line[2], facts.names), b = reg(line[1], facts.names);
+            string c = reg((*following)[1], facts.names), b_again = reg((*following)[2], facts.names);
+            if (a.size() and b.size() and c.size() and b == b_again and window.vacated.count(b) and a != b and c != b and c != a) {
+                cg::lex::Line merged = rewrite(*following, { "move", (*following)[1], line[2] });
+                changes.push_back(assembler::optimize::Change{"move-chain", line.number, line.text, ""});
+                changes.push_back(assembler::optimize::Change{"move-chain", following->number, following->text, merged.text});
+                replacements[next] = merged;
+                changed = true;
+                continue;
+            }
+        }
+
+        update(window, line, facts);
+        optimized.push_back(line);
+    }
+
+    body = optimized;
+    return changed;
+}
+
+
+static bool propagateConstants(vector<cg::lex::Line>& body, const Body& facts, vector<bool>& pure, vector<assembler::optimize::Change>& changes) {
+    /** Propagate values of registers through the whole body, following only
+     *  those edges of control flow graph that can be taken.
+     *
+     *  Knowledge at the start of each basic block is what is known at the end of
+     *  all its predecessors that can be reached; it is computed optimistically and
+     *  refined until nothing changes.
+     *  Then instructions whose results are known are replaced with loads of constants,
+     *  ones with a single known operand take it as an immediate,
+     *  branches on known conditions become jumps, and code that is never reached is removed.
+     *
+     *  Lines whose results are known (so they cannot fail) are marked as pure.
+     */
+    vector<BasicBlock> blocks = basicBlocks(body);
+    vector<Window> ins(blocks.size()), outs(blocks.size());
+    vector<bool> computed(blocks.size(), false), reached(blocks.size(), false);
+    vector<set<unsigned> > predecessors(blocks.size());
+
+    // blocks whose predecessors changed, in order of appearance so that most of them are visited after their predecessors
+    set<unsigned> worklist;
+    if (blocks.size()) {
+        reached[0] = true;
+        worklist.insert(0);
+    }
+    while (worklist.size()) {
+        unsigned b = *worklist.begin();
+        worklist.erase(worklist.begin());
+        // nothing is known about registers when body is entered
+        bool first = (b != 0);
+        Window in;
+        for (unsigned p : predecessors[b]) {
+            if (not computed[p]) {
+                continue;
+            }
+            in = (first ? outs[p] : meet(in, outs[p]));
+            first = false;
+        }
+
+        Window out = in;
+        for (unsigned i = blocks[b].begin; i < blocks[b].end; ++i) {
+            update(out, body[i], facts);
+        }
+        bool propagated = (not computed[b] or out != outs[b]);
+        ins[b] = in;
+        outs[b] = out;
+        computed[b] = true;
+
+        vector<unsigned> successors = blocks[b].successors;
+        if (blocks[b].branch != blocks[b].end) {
+            string condition = reg(body[blocks[b].branch][1], facts.names);
+            if (out.values.count(condition)) {
+                unsigned taken = (out.values.at(condition).truth ? 0 : 1);
+                successors = (taken < successors.size() ? vector<unsigned>{ successors[taken] } : vector<unsigned>{});
+            }
+        }
+        for (unsigned s : successors) {
+            if (predecessors[s].insert(b).second or propagated) {
+                reached[s] = true;
+                worklist.insert(s);
+            }
+        }
+    }
+
+    vector<cg::lex::Line> optimized;
+    vector<bool> optimized_pure;
+    bool rewritten = false;
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        Window window = ins[b];
+        for (unsigned i = blocks[b].begin; i < blocks[b].end; ++i) {
+            cg::lex::Line line = body[i];
+            if (not reached[b] and not line.directive() and not closing(body, i)) {
+                changes.push_back(assembler::optimize::Change{"dead-code", line.number, line.text, ""});
+                rewritten = true;
+                continue;
+            }
+
+            Value value = Value::ofInteger(0);
+            bool known = (reached[b] and evaluate(line, window, facts, value));
+            cg::lex::Line folded;
+            if (i == blocks[b].branch and window.values.count(reg(line[1], facts.names))) {
+                string destination = (window.values.at(reg(line[1], facts.names)).truth ? line[2] : line[3]);
+                if (destination.empty()) {
+                    changes.push_back(assembler::optimize::Change{"constant-branch", line.number, line.text, ""});
+                    rewritten = true;
+                    continue;
+                }
+                folded = rewrite(line, { "jump", destination });
+                changes.push_back(assembler::optimize::Change{"constant-branch", line.number, line.text, folded.text});
+                line = folded;
+                rewritten = true;
+            } else if (known and not CONSTANT_LOADS.count(line[0]) and facts.tracked.count(reg(line[1], facts.names)) and materialize(line, value, folded)) {
+                changes.push_back(assembler::optimize::Change{"constant-propagation", line.number, line.text, folded.text});
+                update(window, line, facts);
+                optimized.push_back(folded);
+                optimized_pure.push_back(true);
+                rewritten = true;
+                continue;
+            } else if (reached[b] and immediateForm(line, window, facts, folded)) {
+                changes.push_back(assembler::optimize::Change{"immediate-operand", line.number, line.text, folded.text});
+                line = folded;
+                rewritten = true;
+            }
+
+            update(window, line, facts);
+            optimized.push_back(line);
+            optimized_pure.push_back(known);
+        }
+    }
+    body = optimized;
+    pure = optimized_pure;
+    return rewritten;
+}
+
+static void accesses(const cg::lex::Line& line, const Body& facts, set<string>& reads, set<string>& writes) {
+    /** Find tracked registers given instruction reads and writes.
+     */
+    reads.clear();
+    writes.clear();
+    if (line.directive() or not MODELLED.count(line[0])) {
+        // instructions that are not modelled never use tracked registers
+        return;
+    }
+
+    const string& instr = line[0];
+    if (CONSTANT_LOADS.count(instr) or instr == "empty") {
+        writes.insert(reg(line[1], facts.names));
+    } else if (INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr) or FLOAT_ARITHMETIC.count(instr) or FLOAT_COMPARISONS.count(instr)) {
+        writes.insert(reg(line[1], facts.names));
+        reads.insert(reg(line[2], facts.names));
+        reads.insert(reg((line[3].size() ? line[3] : line[1]), facts.names));
+    } else if (immediate(instr)) {
+        writes.insert(reg(line[1], facts.names));
+        reads.insert(reg(line[2], facts.names));
+    } else if (CASTS.count(instr) or instr == "copy") {
+        writes.insert(reg(line[1], facts.names));
+        reads.insert(reg((line[2].size() ? line[2] : line[1]), facts.names));
+    } else if (instr == "move") {
+        // source is left empty
+        writes.insert(reg(line[1], facts.names));
+        writes.insert(reg(line[2], facts.names));
+        reads.insert(reg(line[2], facts.names));
+    } else if (instr == "iinc" or instr == "idec" or instr == "not" or instr == "free") {
+        writes.insert(reg(line[1], facts.names));
+        reads.insert(reg(line[1], facts.names));
+    } else if (instr == "print" or instr == "echo" or instr == "branch") {
+        reads.insert(reg(line[1], facts.names));
+    } else if (instr == "param") {
+        reads.insert(reg(line[2], facts.names));
+    } else if (instr == "end" or instr == "halt") {
+        // returned value
+        reads.insert("0");
+    }
+
+    for (set<string>* accessed : { &reads, &writes }) {
+        set<string> tracked;
+        for (const string& r : *accessed) {
+            if (facts.tracked.count(r)) {
+                tracked.insert(r);
+            }
+        }
+        *accessed = tracked;
+    }
+}
+
+static vector<set<string> > liveOut(const vector<cg::lex::Line>& body, const vector<BasicBlock>& blocks, const Body& facts) {
+    /** Return tracked registers whose objects may be read after each of the blocks.
+     */
+    vector<set<string> > live_in(blocks.size()), live_out(blocks.size());
+    vector<vector<unsigned> > predecessors(blocks.size());
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        for (unsigned s : blocks[b].successors) {
+            predecessors[s].push_back(b);
+        }
+    }
+
+    // liveness flows backwards, so blocks are visited from the last one
+    set<unsigned> worklist;
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        worklist.insert(b);
+    }
+    while (worklist.size()) {
+        unsigned b = *worklist.rbegin();
+        worklist.erase(b);
+        set<string> live;
+        for (unsigned s : blocks[b].successors) {
+            live.insert(live_in[s].begin(), live_in[s].end());
+        }
+        live_out[b] = live;
+        for (unsigned i = blocks[b].end; i-- > blocks[b].begin;) {
+            set<string> reads, writes;
+            accesses(body[i], facts, reads, writes);
+            for (const string& r : writes) {
+                live.erase(r);
+            }
+            live.insert(reads.begin(), reads.end());
+        }
+        if (live != live_in[b]) {
+            live_in[b] = live;
+            worklist.insert(predecessors[b].begin(), predecessors[b].end());
+        }
+    }
+    return live_out;
+}
+
+static bool removeDeadStores(vector<cg::lex::Line>& body, const Body& facts, const vector<bool>& pure, vector<assembler::optimize::Change>& changes) {
+    /** Remove instructions placing objects in tracked registers that are never read afterwards.
+     *
+     *  Only constant loads and instructions whose results are known (so they cannot fail) are removed.
+     */
+    vector<BasicBlock> blocks = basicBlocks(body);
+    vector<set<string> > live_out = liveOut(body, blocks, facts);
+
+    set<unsigned> removed;
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        set<string> live = live_out[b];
+        for (unsigned i = blocks[b].end; i-- > blocks[b].begin;) {
+            set<string> reads, writes;
+            accesses(body[i], facts, reads, writes);
+            string target = reg(body[i][1], facts.names);
+            bool removable = ((CONSTANT_LOADS.count(body[i][0]) or pure[i]) and body[i][0] != "move");
+            if (removable and writes.count(target) and not live.count(target)) {
+                removed.insert(i);
+                continue;
+            }
+            for (const string& r : writes) {
+                live.erase(r);
+            }
+            live.insert(reads.begin(), reads.end());
+        }
+    }
+
+    vector<cg::lex::Line> optimized;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        if (removed.count(i)) {
+            changes.push_back(assembler::optimize::Change{"dead-store", body[i].number, body[i].text, ""});
+            continue;
+        }
+        optimized.push_back(body[i]);
+    }
+    body = optimized;
+    return removed.size();
+}
+
+
+static bool optimizable(const vector<cg::lex::Line>& body) {
+    /** Bodies accessing registers through `@` indirection or switching register sets are left alone,
+     *  as it cannot be known which registers their instructions use.
+     */
+    for (const cg::lex::Line& line : body) {
+        if (line[0] == "ress") {
+            return false;
+        }
+        for (const string& token : line.tokens) {
+            if (token[0] == '@') {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static Body inspect(const string& name, const vector<cg::lex::Line>& body, bool block, const assembler::optimize::Context& context) {
+    /** Gather facts about a function or block.
+     *
+     *  Values of registers are tracked only in functions that start with all registers empty, i.e.
+     *  not in blocks (which use registers of the function they run in), closures, or
+     *  functions that may become closures in other modules.
+     */
+    Body facts;
+    facts.names = assembler::ce::getnames(body);
+    facts.marks = getmarks(body);
+
+    bool prefilled = (block or context.exported or context.closures.count(name));
+    for (const cg::lex::Line& line : body) {
+        // blocks run by `try` use registers of the function
+        prefilled = (prefilled or line[0] == "try");
+    }
+    if (not prefilled) {
+        facts.tracked = trackedRegisters(body, facts.names);
+    }
+    facts.prefilled = prefilled;
+    return facts;
+}
+
+
+static vector<unsigned> registerOperands(const cg::lex::Line& line) {
+    /** Return indexes of tokens of an inlinable instruction that name registers.
+     */
+    vector<unsigned> found;
+    unsigned last = line.tokens.size();
+    if (line[0] == "jump") {
+        last = 1;
+    } else if (line[0] == "branch" or line[0] == "arg" or (CONSTANT_LOADS.count(line[0]) and line[0] != "vec")) {
+        last = 2;
+    } else if (immediate(line[0])) {
+        last = 3;
+    }
+    for (unsigned i = 1; i < last; ++i) {
+        found.push_back(i);
+    }
+    return found;
+}
+
+static bool definitelyAssigned(const vector<cg::lex::Line>& body, const map<string, int>& names, bool& returns) {
+    /** Check that on every path through the body registers are written before they are read, so
+     *  code of the function does the same whatever its registers held before it started.
+     *
+     *  Returns is set if register 0 holds an object whenever `end` is reached.
+     */
+    // register holds an object, or was written but may have been left empty
+    const char FILLED = 'f', WRITTEN = 'w';
+
+    vector<BasicBlock> blocks = basicBlocks(body);
+    vector<map<string, char> > ins(blocks.size());
+    vector<bool> reached(blocks.size(), false);
+    set<unsigned> worklist;
+    if (blocks.size()) {
+        reached[0] = true;
+        worklist.insert(0);
+    }
+
+    returns = true;
+    while (worklist.size()) {
+        unsigned b = *worklist.begin();
+        worklist.erase(worklist.begin());
+
+        map<string, char> state = ins[b];
+        for (unsigned i = blocks[b].begin; i < blocks[b].end; ++i) {
+            const cg::lex::Line& line = body[i];
+            if (line.directive()) {
+                continue;
+            }
+            const string& instr = line[0];
+            string target = reg(line[1], names);
+
+            vector<string> reads;
+            if (INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr) or FLOAT_ARITHMETIC.count(instr) or FLOAT_COMPARISONS.count(instr)) {
+                reads = { reg(line[2], names), reg((line[3].size() ? line[3] : line[1]), names) };
+            } else if (immediate(instr)) {
+                reads = { reg(line[2], names) };
+            } else if (CASTS.count(instr) or instr == "copy" or instr == "move") {
+                reads = { reg((line[2].size() ? line[2] : line[1]), names) };
+            } else if (instr == "iinc" or instr == "idec" or instr == "not" or instr == "free" or instr == "print" or instr == "echo" or instr == "branch") {
+                reads = { target };
+            }
+            for (const string& r : reads) {
+                if (not state.count(r)) {
+                    return false;
+                }
+            }
+
+            if (instr == "move") {
+                char moved = state.at(reads[0]);
+                state[reads[0]] = WRITTEN;
+                state[target] = moved;
+            } else if (instr == "empty" or instr == "free") {
+                state[target] = WRITTEN;
+            } else if (instr == "end") {
+                returns = (returns and state.count("0") and state.at("0") == FILLED);
+            } else if (not (instr == "print" or instr == "echo" or instr == "branch" or instr == "jump" or instr == "nop")) {
+                state[target] = FILLED;
+            }
+        }
+
+        for (unsigned s : blocks[b].successors) {
+            map<string, char> met = state;
+            if (reached[s]) {
+                met.clear();
+                for (const pair<const string, char>& each : ins[s]) {
+                    map<string, char>::const_iterator other = state.find(each.first);
+                    if (other != state.end()) {
+                        met[each.first] = ((each.second == FILLED and other->second == FILLED) ? FILLED : WRITTEN);
+                    }
+                }
+            }
+            if (not reached[s] or met != ins[s]) {
+                ins[s] = met;
+                reached[s] = true;
+                worklist.insert(s);
+            }
+        }
+    }
+    return true;
+}
+
+static bool inlinable(const vector<cg::lex::Line>& body, bool& returns) {
+    /** Check if calls to function with given body may be replaced with its code.
+     *
+     *  Such functions make no calls (so are not recursive), use registers only directly, and
+     *  consist of instructions whose effects on registers are known.
+     *  They must not depend on what their registers held before they started as
+     *  registers their code is moved to are shared by all code inlined into a function.
+     */
+    if (not optimizable(body)) {
+        return false;
+    }
+    map<string, int> names = assembler::ce::getnames(body);
+    set<string> marks = getmarks(body);
+
+    string last;
+    for (const cg::lex::Line& line : body) {
+        if (line.directive()) {
+            if (not (line[0] == ".mark:" or line[0] == ".name:")) {
+                return false;
+            }
+            continue;
+        }
+        if (not INLINABLE.count(line[0])) {
+            return false;
+        }
+        for (unsigned t : targets(line)) {
+            if (not marks.count(line[t])) {
+                return false;
+            }
+        }
+        for (unsigned t : registerOperands(line)) {
+            if (reg(line[t], names).empty()) {
+                return false;
+            }
+        }
+        int slot = 0;
+        if (line[0] == "arg" and not literal(line[2], names, slot)) {
+            return false;
+        }
+        last = line[0];
+    }
+    return (last == "end" and definitelyAssigned(body, names, returns));
+}
+
+static bool inlineCall(const vector<cg::lex::Line>& body, unsigned frame, unsigned call, unsigned level, const Body& facts, const assembler::optimize::Context& context, const vector<string>& free_registers, const string& ret, vector<cg::lex::Line>& code) {
+    /** Produce code replacing call site spanning lines [frame, call] of a body, if
+     *  called function can be inlined there.
+     */
+    const cg::lex::Line& line = body[call];
+    string function = (line[2].size() ? line[2] : line[1]);
+    string result = (line[2].size() ? reg(line[1], facts.names) : "0");
+    if (not context.inlinable.count(function) or context.closures.count(function) or result.empty()) {
+        return false;
+    }
+    if (result != "0" and not context.returning.count(function)) {
+        return false;
+    }
+    const vector<cg::lex::Line>& callee = context.inlinable.at(function);
+    map<string, int> names = assembler::ce::getnames(callee);
+
+    unsigned size = 0;
+    for (const cg::lex::Line& each : callee) {
+        size += not (each.directive() or each[0] == "arg" or each[0] == "end");
+    }
+    if (not (context.always_inlined.count(function) or (level >= 2 and size <= INLINING_THRESHOLD))) {
+        return false;
+    }
+
+    // parameters must fit in the frame, and registers of the function in the register set it would get
+    int arguments = 0, local_registers = DEFAULT_FRAME_SIZE;
+    if ((body[frame][1].size() and not literal(body[frame][1], facts.names, arguments)) or (body[frame][2].size() and not literal(body[frame][2], facts.names, local_registers))) {
+        return false;
+    }
+    set<int> passed;
+    for (unsigned i = frame+1; i < call; ++i) {
+        int slot = 0;
+        if (not literal(body[i][1], facts.names, slot) or slot < 0 or slot >= arguments or reg(body[i][2], facts.names).empty()) {
+            return false;
+        }
+        passed.insert(slot);
+    }
+    set<int> registers;
+    for (const cg::lex::Line& each : callee) {
+        if (each.directive()) {
+            continue;
+        }
+        for (unsigned t : registerOperands(each)) {
+            registers.insert(stoi(reg(each[t], names)));
+        }
+        int slot = 0;
+        if (each[0] == "arg" and not (literal(each[2], names, slot) and passed.count(slot))) {
+            return false;
+        }
+    }
+    if (registers.size() and *registers.rbegin() >= local_registers) {
+        return false;
+    }
+    if ((registers.size() + passed.size()) > free_registers.size()) {
+        return false;
+    }
+
+    // registers keep their indexes if the caller does not use them
+    vector<string> available = free_registers;
+    map<string, string> renamed;
+    for (int r : registers) {
+        vector<string>::iterator same = find(available.begin(), available.end(), to_string(r));
+        if (same != available.end()) {
+            renamed[to_string(r)] = *same;
+            available.erase(same);
+        }
+    }
+    for (int r : registers) {
+        if (not renamed.count(to_string(r))) {
+            renamed[to_string(r)] = available.front();
+            available.erase(available.begin());
+        }
+    }
+    map<int, string> parameters;
+    for (int slot : passed) {
+        parameters[slot] = available.front();
+        available.erase(available.begin());
+    }
+
+    unsigned number = line.number;
+    for (unsigned i = frame+1; i < call; ++i) {
+        int slot = 0;
+        literal(body[i][1], facts.names, slot);
+        code.push_back(cg::lex::tokenise("copy " + parameters.at(slot) + ' ' + reg(body[i][2], facts.names), number));
+    }
+    code.push_back(cg::lex::tokenise(".inlined: " + function + ' ' + to_string(arguments), number));
+    for (const cg::lex::Line& each : callee) {
+        if (each[0] == ".name:") {
+            continue;
+        } else if (each[0] == ".mark:") {
+            code.push_back(cg::lex::tokenise(".mark: " + ret + '_' + each[1], number));
+            continue;
+        } else if (each[0] == "end") {
+            code.push_back(cg::lex::tokenise("jump " + ret, number));
+            continue;
+        } else if (each[0] == "arg") {
+            int slot = 0;
+            literal(each[2], names, slot);
+            code.push_back(cg::lex::tokenise("copy " + renamed.at(reg(each[1], names)) + ' ' + parameters.at(slot), number));
+            continue;
+        }
+
+        vector<string> tokens = each.tokens;
+        for (unsigned t : registerOperands(each)) {
+            tokens[t] = renamed.at(reg(each[t], names));
+        }
+        for (unsigned t : targets(each)) {
+            tokens[t] = (ret + '_' + each[t]);
+        }
+        if (CONSTANT_LOADS.count(each[0]) and names.count(each[2])) {
+            // names stand for indexes of registers they name, which are literals here
+            tokens[2] = to_string(names.at(each[2]));
+        } else if (INTEGER_IMMEDIATES.count(each[0]) and names.count(each[3])) {
+            tokens[3] = to_string(names.at(each[3]));
+        }
+        code.push_back(rewrite(line, tokens));
+    }
+    code.push_back(cg::lex::tokenise(".inlined:", number));
+    code.push_back(cg::lex::tokenise(".mark: " + ret, number));
+    if (result != "0") {
+        code.push_back(cg::lex::tokenise("copy " + result + ' ' + renamed.at("0"), number));
+    }
+    return true;
+}
+
+
+static vector<set<string> > holdingBefore(const vector<cg::lex::Line>& body, const vector<BasicBlock>& blocks, const function<void(const cg::lex::Line&, set<string>&)>& transfer) {
+    /** Return, for every line of body, registers that have some property whenever the line is reached.
+     *
+     *  Transfer function updates the set of registers having the property after a line runs.
+     *  No register has it when body starts, and lines that are never reached are said to have no such registers.
+     */
+    vector<set<string> > holding(body.size());
+    vector<set<string> > ins(blocks.size());
+    vector<bool> reached(blocks.size(), false);
+    set<unsigned> worklist;
+    if (blocks.size()) {
+        reached[0] = true;
+        worklist.insert(0);
+    }
+    while (worklist.size()) {
+        unsigned b = *worklist.begin();
+        worklist.erase(worklist.begin());
+
+        set<string> state = ins[b];
+        for (unsigned i = blocks[b].begin; i < blocks[b].end; ++i) {
+            holding[i] = state;
+            transfer(body[i], state);
+        }
+        for (unsigned s : blocks[b].successors) {
+            set<string> merged;
+            if (not reached[s]) {
+                merged = state;
+            } else {
+                for (const string& r : ins[s]) {
+                    if (state.count(r)) {
+                        merged.insert(r);
+                    }
+                }
+            }
+            if (not reached[s] or merged != ins[s]) {
+                reached[s] = true;
+                ins[s] = merged;
+                worklist.insert(s);
+            }
+        }
+    }
+    return holding;
+}
+
+static void moveHeld(const cg::lex::Line& line, const Body& facts, set<string>& state) {
+    /** Update registers having a property that travels with objects after a `move` or `copy`.
+     */
+    string target = reg(line[1], facts.names), source = reg((line[2].size() ? line[2] : line[1]), facts.names);
+    bool had = state.count(source);
+    if (line[0] == "move") {
+        // source is left empty
+        state.erase(source);
+    }
+    state.erase(target);
+    if (had and (target != source or line[0] == "copy") and facts.tracked.count(target)) {
+        state.insert(target);
+    }
+}
+
+static vector<set<string> > filledBefore(const vector<cg::lex::Line>& body, const vector<BasicBlock>& blocks, const Body& facts) {
+    /** Return, for every line of body, tracked registers that hold an object whenever the line is reached.
+     *  Registers are assumed to be empty when body starts.
+     */
+    return holdingBefore(body, blocks, [&facts](const cg::lex::Line& line, set<string>& state) {
+        set<string> reads, writes;
+        accesses(line, facts, reads, writes);
+        if (line[0] == "move") {
+            moveHeld(line, facts, state);
+        } else if (line[0] == "empty" or line[0] == "free") {
+            for (const string& r : writes) {
+                state.erase(r);
+            }
+        } else {
+            state.insert(writes.begin(), writes.end());
+        }
+    });
+}
+
+static vector<set<string> > integersBefore(const vector<cg::lex::Line>& body, const vector<BasicBlock>& blocks, const Body& facts) {
+    /** Return, for every line of body, tracked registers that hold an Integer whenever the line is reached.
+     *
+     *  Integers are put in registers by integer arithmetic (whatever its operands are), and `ftoi`.
+     *  Incrementing and decrementing changes values of objects, but not their types.
+     */
+    return holdingBefore(body, blocks, [&facts](const cg::lex::Line& line, set<string>& state) {
+        set<string> reads, writes;
+        accesses(line, facts, reads, writes);
+        const string& instr = line[0];
+        if (instr == "move" or instr == "copy") {
+            moveHeld(line, facts, state);
+        } else if (instr == "izero" or instr == "istore" or instr == "ftoi" or INTEGER_ARITHMETIC.count(registerForm(instr))) {
+            state.insert(writes.begin(), writes.end());
+        } else if (instr != "iinc" and instr != "idec") {
+            for (const string& r : writes) {
+                state.erase(r);
+            }
+        }
+    });
+}
+
+static bool registerPositions(const cg::lex::Line& line, vector<unsigned>& positions) {
+    /** Find indexes of tokens of an instruction that name registers.
+     *  Returns false if it is not known which of its tokens do.
+     */
+    positions.clear();
+    const string& instr = line[0];
+    if (MODELLED.count(instr)) {
+        // the same tokens operands() reads registers from
+        unsigned first = ((instr == "frame") ? line.tokens.size() : (instr == "param" ? 2 : 1));
+        unsigned last = line.tokens.size();
+        if (instr == "jump") {
+            last = 1;
+        } else if (instr == "branch" or (CONSTANT_LOADS.count(instr) and instr != "vec")) {
+            last = 2;
+        } else if (immediate(instr)) {
+            last = 3;
+        }
+        for (unsigned i = first; i < last; ++i) {
+            positions.push_back(i);
+        }
+        return true;
+    }
+
+    map<string, vector<unsigned> >::const_iterator known = RENUMBERABLE.find(instr);
+    if (known == RENUMBERABLE.end()) {
+        return false;
+    }
+    for (unsigned i : known->second) {
+        if (i < line.tokens.size() and not ((instr == "call" or instr == "excall") and line[2].empty())) {
+            positions.push_back(i);
+        }
+    }
+    return true;
+}
+
+static string lowestFree(const set<string>& unavailable) {
+    /** Return lowest register index (other than the return register) not in given set.
+     */
+    unsigned r = 1;
+    while (unavailable.count(to_string(r))) {
+        ++r;
+    }
+    return to_string(r);
+}
+
+static bool placesReturnValue(const vector<cg::lex::Line>& body) {
+    /** Check if function may place an object in register 0 (or return an object placed there by another function).
+     *
+     *  Any use of register 0 counts, and so do instructions whose register operands are not known.
+     */
+    if (not optimizable(body)) {
+        return true;
+    }
+    map<string, int> names = assembler::ce::getnames(body);
+    for (const cg::lex::Line& line : body) {
+        vector<unsigned> positions;
+        if (line.directive()) {
+            continue;
+        }
+        if (line[0] == "paref") {
+            // registers passed by reference are not renumbered, but their operand is known
+            positions = { 2 };
+        } else if (line[0] == "tailcall" or not registerPositions(line, positions)) {
+            return true;
+        }
+        for (unsigned p : positions) {
+            if (reg(line[p], names) == "0") {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static bool convertTailCalls(vector<cg::lex::Line>& body, const string& name, const assembler::optimize::Context& context, vector<assembler::optimize::Change>& changes) {
+    /** Replace calls whose return value becomes the return value of the function with tail calls:
+     *
+     *      call <r> <function>         ->  tailcall <function>
+     *      move 0 <r>
+     *      end
+     *
+     *  Calls discarding their return value and followed by `end` are replaced too, if
+     *  neither function ever places an object in register 0, as then neither returns one.
+     *  Functions whose registers may hold objects when they start (closures) could return such an object, so
+     *  they are left alone in the latter case.
+     *
+     *  Instructions after the call are kept for jumps and branches leading to them.
+     */
+    map<string, int> names = assembler::ce::getnames(body);
+    bool silent = (not (context.exported or context.closures.count(name) or placesReturnValue(body)));
+    bool changed = false;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        const cg::lex::Line& line = body[i];
+        if (line[0] != "call") {
+            continue;
+        }
+        bool crosses_mark = false;
+        unsigned next = nextInstruction(body, i, crosses_mark);
+        if (next >= body.size()) {
+            continue;
+        }
+        string function = (line[2].size() ? line[2] : line[1]);
+        string result = (line[2].size() ? reg(line[1], names) : "0");
+        bool tail = false;
+        if (result == "0") {
+            tail = (body[next][0] == "end" and silent and (function == name or context.silent.count(function)));
+        } else if (result.size() and body[next][0] == "move" and reg(body[next][1], names) == "0" and reg(body[next][2], names) == result) {
+            next = nextInstruction(body, next, crosses_mark);
+            tail = (next < body.size() and body[next][0] == "end");
+        }
+        if (tail) {
+            cg::lex::Line converted = rewrite(line, { "tailcall", function });
+            changes.push_back(assembler::optimize::Change{"tail-call", line.number, line.text, converted.text});
+            body[i] = converted;
+            changed = true;
+        }
+    }
+    if (changed) {
+        removeUnreachable(body, changes);
+    }
+    return changed;
+}
+
+
+assembler::optimize::Context assembler::optimize::analyse(const map<string, vector<cg::lex::Line> >& functions, const map<string, vector<cg::lex::Line> >& blocks, const map<string, vector<cg::lex::Line> >& linked, const set<string>& always_inlined, bool exported) {
+    /** Gather facts about the module that optimizations of single functions and blocks rely on.
+     *
+     *  Linked are bodies of functions of statically linked modules, which may be inlined into local ones.
+     */
+    Context context;
+    context.exported = exported;
+    context.fixed_layout = false;
+    context.always_inlined = always_inlined;
+
+    for (const map<string, vector<cg::lex::Line> >* invokables : { &functions, &blocks }) {
+        for (const pair<const string, vector<cg::lex::Line> >& invokable : *invokables) {
+            set<string> marks = getmarks(invokable.second);
+            unsigned instructions = 0;
+            bool ends = false;
+            for (const cg::lex::Line& line : invokable.second) {
+                if (line.directive()) {
+                    continue;
+                }
+                ++instructions;
+                ends = (line[0] == "end");
+                if (line[0] == "closure") {
+                    context.closures.insert(line[2]);
+                }
+                for (unsigned t : targets(line)) {
+                    // instruction indexes and byte offsets change when code is optimized
+                    context.fixed_layout = (context.fixed_layout or not marks.count(line[t]));
+                }
+            }
+            if (invokables == &functions and instructions == 1 and ends) {
+                context.empty_functions.insert(invokable.first);
+            }
+        }
+    }
+
+    for (const map<string, vector<cg::lex::Line> >* invokables : { &functions, &linked }) {
+        for (const pair<const string, vector<cg::lex::Line> >& invokable : *invokables) {
+            bool returns = false;
+            if (context.closures.count(invokable.first) or not inlinable(invokable.second, returns)) {
+                continue;
+            }
+            context.inlinable[invokable.first] = invokable.second;
+            if (returns) {
+                context.returning.insert(invokable.first);
+            }
+        }
+    }
+
+    for (const pair<const string, vector<cg::lex::Line> >& function : functions) {
+        if (not placesReturnValue(function.second)) {
+            context.silent.insert(function.first);
+        }
+    }
+
+    // size of register set of a function is known only if all its calls are, and
+    // functions of modules that may be linked with this one can be called from anywhere
+    set<string> unknown;
+    for (const map<string, vector<cg::lex::Line> >* invokables : { &functions, &blocks, &linked }) {
+        for (const pair<const string, vector<cg::lex::Line> >& invokable : *invokables) {
+            map<string, int> names = assembler::ce::getnames(invokable.second);
+            // local registers given by the last `frame`, or -1 if they are not a literal
+            int local_registers = -1;
+            for (const cg::lex::Line& line : invokable.second) {
+                if (line.directive()) {
+                    continue;
+                }
+                if (line[0] == "frame") {
+                    int size = DEFAULT_FRAME_SIZE;
+                    local_registers = ((line[2].empty() or literal(line[2], names, size)) ? size : -1);
+                } else if (line[0] == "call" or line[0] == "tailcall") {
+                    string function = ((line[0] == "call" and line[2].size()) ? line[2] : line[1]);
+                    if (local_registers < 0) {
+                        unknown.insert(function);
+                    } else if (not context.windows.count(function) or context.windows.at(function) > unsigned(local_registers)) {
+                        context.windows[function] = local_registers;
+                    }
+                } else {
+                    // functions may be used by name (e.g. by `closure` or `function`) and called later
+                    unknown.insert(line.tokens.begin()+1, line.tokens.end());
+                }
+            }
+        }
+    }
+    for (const string& function : unknown) {
+        context.windows.erase(function);
+    }
+    if (exported) {
+        context.windows.clear();
+    }
+    return context;
+}
+
+vector<cg::lex::Line> assembler::optimize::peephole(const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Run peephole optimizations over body of a function or block until none of them finds anything to improve.
+     */
+    if (not optimizable(body)) {
+        return body;
+    }
+    Body facts = inspect(name, body, block, context);
+
+    vector<cg::lex::Line> optimized = body;
+    for (unsigned round = 0; round < OPTIMIZATION_ROUNDS; ++round) {
+        bool changed = false;
+        changed = (threadJumps(optimized, changes) or changed);
+        changed = (removeJumpsToNext(optimized, changes) or changed);
+        changed = (removeUnreachable(optimized, changes) or changed);
+        changed = (removeEmptyCalls(optimized, context, facts, changes) or changed);
+        changed = (simplifyLocally(optimized, facts, changes) or changed);
+        if (not changed) {
+            break;
+        }
+    }
+    return optimized;
+}
+
+vector<cg::lex::Line> assembler::optimize::propagate(const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Propagate constants through body of a function or block, and
+     *  remove code and stores that became dead.
+     */
+    if (not optimizable(body)) {
+        return body;
+    }
+    Body facts = inspect(name, body, block, context);
+
+    vector<cg::lex::Line> optimized = body;
+    for (unsigned round = 0; round < OPTIMIZATION_ROUNDS; ++round) {
+        vector<bool> pure;
+        bool changed = propagateConstants(optimized, facts, pure, changes);
+        changed = (removeDeadStores(optimized, facts, pure, changes) or changed);
+        if (not changed) {
+            break;
+        }
+    }
+    return optimized;
+}
+
+vector<cg::lex::Line> assembler::optimize::inlineCalls(unsigned level, const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Replace calls to inlinable functions with their code.
+     *
+     *  Functions are inlined if `.inline:` directive names them, or at level 2 if they are small.
+     *  Call site consisting of `frame`, `param` instructions and `call` becomes:
+     *
+     *      copy <p> <source>           - for every `param`, as parameters are copied when they are passed
+     *      .inlined: <function> <arguments>
+     *      <code of the function>      - registers renamed to ones the caller does not use,
+     *                                    `arg` turned into copies of <p>, and `end` into jumps to <return>
+     *      .inlined:
+     *      .mark: <return>
+     *      copy <result> <0>           - if return value is used
+     *
+     *  `.inlined:` directives must be taken out with takeInlined() before the body is assembled.
+     *  Blocks and functions whose registers may hold objects when they start are left alone as
+     *  it cannot be known which of their registers are free.
+     */
+    if (level == 0 or context.fixed_layout or context.inlinable.empty() or not optimizable(body)) {
+        return body;
+    }
+    Body facts = inspect(name, body, block, context);
+    if (facts.prefilled) {
+        return body;
+    }
+
+    // code of inlined functions is given registers the caller does not use, below the size of its register set
+    set<string> used = { "0" };
+    unsigned window = 1;
+    for (const cg::lex::Line& line : body) {
+        if (line.directive()) {
+            continue;
+        }
+        for (const string& r : ::operands(line, facts.names)) {
+            used.insert(r);
+            window = max(window, unsigned(stoi(r)+1));
+        }
+    }
+    if (context.windows.count(name)) {
+        window = max(window, context.windows.at(name));
+    }
+    vector<string> free_registers;
+    for (unsigned r = 1; r < window; ++r) {
+        if (not used.count(to_string(r))) {
+            free_registers.push_back(to_string(r));
+        }
+    }
+
+    vector<cg::lex::Line> inlined;
+    unsigned site = 0;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        unsigned call = (i + 1);
+        while (body[i][0] == "frame" and call < body.size() and body[call][0] == "param") {
+            ++call;
+        }
+        if (body[i][0] != "frame" or call >= body.size() or body[call][0] != "call") {
+            inlined.push_back(body[i]);
+            continue;
+        }
+
+        // marks of inlined code are named after the return mark, which must not clash with marks of the caller
+        string ret;
+        bool clashes = true;
+        while (clashes) {
+            ret = ("inline_" + to_string(site++));
+            clashes = false;
+            for (const string& mark : facts.marks) {
+                clashes = (clashes or mark == ret or mark.compare(0, ret.size()+1, (ret + '_')) == 0);
+            }
+        }
+
+        vector<cg::lex::Line> code;
+        if (not inlineCall(body, i, call, level, facts, context, free_registers, ret, code)) {
+            inlined.push_back(body[i]);
+            continue;
+        }
+        const cg::lex::Line& line = body[call];
+        changes.push_back(Change{"inline", line.number, line.text, code[call-i-1].text});
+        inlined.insert(inlined.end(), code.begin(), code.end());
+        i = call;
+    }
+    return inlined;
+}
+
+vector<assembler::optimize::Inlined> assembler::optimize::takeInlined(vector<cg::lex::Line>& body) {
+    /** Take `.inlined:` directives out of a body, and
+     *  return ranges of instructions they enclosed that were not optimized away.
+     */
+    vector<Inlined> inlined;
+    vector<cg::lex::Line> taken;
+    unsigned instructions = 0;
+    for (const cg::lex::Line& line : body) {
+        if (line[0] == ".inlined:") {
+            if (line[1].size()) {
+                inlined.push_back(Inlined{line[1], unsigned(stoi(line[2])), instructions, instructions});
+            } else if (inlined.size()) {
+                inlined.back().end = instructions;
+            }
+            continue;
+        }
+        instructions += not line.directive();
+        taken.push_back(line);
+    }
+    body = taken;
+
+    vector<Inlined> nonempty;
+    for (const Inlined& each : inlined) {
+        if (each.begin < each.end) {
+            nonempty.push_back(each);
+        }
+    }
+    return nonempty;
+}
+
+vector<cg::lex::Line> assembler::optimize::allocate(const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Give registers of a function the lowest indexes possible.
+     *
+     *  Tracked registers (see trackedRegisters()) whose objects are never needed at the same time share an index, and
+     *  registers connected by `move` are given the same index when they can share it, so the move disappears.
+     *  Other registers may hold references, and writing to them would change the referenced objects, so
+     *  each of them gets an index of its own.
+     *  Registers exposed by `ref`, `paref` or `clbind` (or used by instructions whose operands are not known) keep
+     *  their indexes, and so do registers objects are moved to from them, as flags travel with moved objects.
+     *
+     *  Body is left alone unless it ends up using fewer registers, or fewer moves.
+     */
+    if (context.fixed_layout or not optimizable(body)) {
+        return body;
+    }
+    Body facts = inspect(name, body, block, context);
+    if (facts.prefilled) {
+        return body;
+    }
+
+    set<string> fixed = { "0" }, all;
+    vector<string> appearance;
+    for (const cg::lex::Line& line : body) {
+        vector<unsigned> positions;
+        if (line.directive()) {
+            continue;
+        }
+        if (not registerPositions(line, positions)) {
+            for (const string& r : ::operands(line, facts.names)) {
+                fixed.insert(r);
+            }
+            continue;
+        }
+        for (unsigned p : positions) {
+            string r = reg(line[p], facts.names);
+            if (r.empty()) {
+                return body;
+            }
+            if (not all.count(r)) {
+                appearance.push_back(r);
+            }
+            all.insert(r);
+        }
+    }
+    bool spread = true;
+    while (spread) {
+        spread = false;
+        for (const cg::lex::Line& line : body) {
+            string a = reg(line[1], facts.names), b = reg(line[2], facts.names);
+            if (b.empty() or not (line[0] == "move" or line[0] == "swap")) {
+                continue;
+            }
+            if ((fixed.count(b) and not fixed.count(a)) or (line[0] == "swap" and fixed.count(a) and not fixed.count(b))) {
+                fixed.insert(a);
+                fixed.insert(b);
+                spread = true;
+            }
+        }
+    }
+
+    set<string> shared;
+    for (const string& r : all) {
+        if (facts.tracked.count(r) and not fixed.count(r)) {
+            shared.insert(r);
+        }
+    }
+
+    // registers interfere if one of them is written while the object of the other may still be read
+    vector<BasicBlock> blocks = basicBlocks(body);
+    vector<set<string> > live_out = liveOut(body, blocks, facts);
+    map<string, set<string> > interferes;
+    set<string> read_empty;
+    for (unsigned b = 0; b < blocks.size(); ++b) {
+        set<string> live = live_out[b];
+        for (unsigned i = blocks[b].end; i-- > blocks[b].begin;) {
+            const cg::lex::Line& line = body[i];
+            set<string> reads, writes;
+            accesses(line, facts, reads, writes);
+            string target = reg(line[1], facts.names), source = reg(line[2], facts.names);
+            for (const string& w : writes) {
+                for (const string& l : live) {
+                    // source is left empty, which matters only if it is read again
+                    bool moved = (line[0] == "move" and w == source and l == target and not live.count(source));
+                    if (w != l and not moved and shared.count(w) and shared.count(l)) {
+                        interferes[w].insert(l);
+                        interferes[l].insert(w);
+                    }
+                }
+            }
+            for (const string& r : writes) {
+                live.erase(r);
+            }
+            live.insert(reads.begin(), reads.end());
+        }
+        if (blocks[b].begin == 0) {
+            read_empty = live;
+        }
+    }
+    // registers that may be read before anything is put in them must stay empty until then, so
+    // they are not shared (reading them is an error that must not turn into reading some other object)
+    for (const string& r : read_empty) {
+        shared.erase(r);
+    }
+
+    // registers connected by moves are merged into groups sharing an index
+    map<string, set<string> > groups;
+    map<string, string> group_of;
+    for (const string& r : shared) {
+        groups[r] = { r };
+        group_of[r] = r;
+    }
+    for (const cg::lex::Line& line : body) {
+        string target = reg(line[1], facts.names), source = reg(line[2], facts.names);
+        if (line[0] != "move" or not (shared.count(target) and shared.count(source)) or group_of.at(target) == group_of.at(source)) {
+            continue;
+        }
+        set<string>& into = groups.at(group_of.at(target));
+        set<string>& from = groups.at(group_of.at(source));
+        bool separate = true;
+        for (const string& r : from) {
+            for (const string& other : interferes[r]) {
+                separate = (separate and not into.count(other));
+            }
+        }
+        if (not separate) {
+            continue;
+        }
+        string merged = group_of.at(source);
+        for (const string& r : from) {
+            group_of[r] = group_of.at(target);
+        }
+        into.insert(from.begin(), from.end());
+        groups.erase(merged);
+    }
+
+    // registers are given indexes in the order they appear in, those that cannot share theirs go first
+    set<string> taken = fixed;
+    map<string, string> renamed;
+    for (const string& r : appearance) {
+        if (not (fixed.count(r) or shared.count(r))) {
+            renamed[r] = lowestFree(taken);
+            taken.insert(renamed.at(r));
+        }
+    }
+    for (const string& r : appearance) {
+        if (not shared.count(r) or renamed.count(r)) {
+            continue;
+        }
+        set<string> unavailable = taken;
+        for (const string& member : groups.at(group_of.at(r))) {
+            for (const string& other : interferes[member]) {
+                if (renamed.count(other)) {
+                    unavailable.insert(renamed.at(other));
+                }
+            }
+        }
+        string index = lowestFree(unavailable);
+        for (const string& member : groups.at(group_of.at(r))) {
+            renamed[member] = index;
+        }
+    }
+
+    unsigned used = 0, allocated_used = 0;
+    for (const string& r : all) {
+        used = max(used, unsigned(stoi(r)+1));
+        allocated_used = max(allocated_used, unsigned(stoi(renamed.count(r) ? renamed.at(r) : r)+1));
+    }
+    unsigned coalesced = 0;
+    for (const cg::lex::Line& line : body) {
+        string target = reg(line[1], facts.names), source = reg(line[2], facts.names);
+        coalesced += (line[0] == "move" and target != source and shared.count(target) and shared.count(source) and renamed.at(target) == renamed.at(source));
+    }
+    if (allocated_used >= used and coalesced == 0) {
+        return body;
+    }
+
+    // copying from an empty register is an error so copies are removed only if there is always something to copy
+    vector<set<string> > filled = filledBefore(body, blocks, facts);
+    vector<cg::lex::Line> allocated;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        const cg::lex::Line& line = body[i];
+        vector<unsigned> positions;
+        if (line.directive() or not registerPositions(line, positions)) {
+            allocated.push_back(line);
+            continue;
+        }
+        vector<string> tokens = line.tokens;
+        for (unsigned p : positions) {
+            string r = reg(line[p], facts.names);
+            if (renamed.count(r)) {
+                tokens[p] = renamed.at(r);
+            }
+        }
+        // moving an object to the register it is in leaves the register empty so
+        // only moves between registers that were given the same index are removed
+        string target = reg(line[1], facts.names), source = reg(line[2], facts.names);
+        bool removable = (line[0] == "move" or (line[0] == "copy" and filled[i].count(source)));
+        if (removable and target != source and tokens.size() == 3 and tokens[1] == tokens[2]) {
+            changes.push_back(Change{"coalescing", line.number, line.text, ""});
+            continue;
+        }
+        if (tokens != line.tokens) {
+            allocated.push_back(rewrite(line, tokens));
+            changes.push_back(Change{"register-allocation", line.number, line.text, allocated.back().text});
+        } else {
+            allocated.push_back(line);
+        }
+    }
+    return allocated;
+}
+
+vector<cg::lex::Line> assembler::optimize::specialise(const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Replace integer arithmetic and comparisons with variants specialised for their operands.
+     *
+     *  Instructions putting results in tracked registers (which are never referenced, so
+     *  nothing has to be updated when they are written) become ones that skip reference checks.
+     *  If both operands are known to hold integers the `t` variant (e.g. `tiadd`) is used, which
+     *  also skips type conversions; otherwise the `g` variant (e.g. `giadd`) checks types of operands first.
+     */
+    if (context.fixed_layout or not optimizable(body)) {
+        return body;
+    }
+    Body facts = inspect(name, body, block, context);
+    vector<set<string> > integers = integersBefore(body, basicBlocks(body), facts);
+
+    vector<cg::lex::Line> specialised = body;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        const cg::lex::Line& line = body[i];
+        const string& instr = line[0];
+        if (not (INTEGER_ARITHMETIC.count(instr) or INTEGER_COMPARISONS.count(instr)) or not facts.tracked.count(reg(line[1], facts.names))) {
+            continue;
+        }
+        string first = reg(line[2], facts.names), second = reg((line[3].size() ? line[3] : line[1]), facts.names);
+        vector<string> tokens = line.tokens;
+        tokens[0] = ((integers[i].count(first) and integers[i].count(second)) ? "t" : "g") + instr;
+        specialised[i] = rewrite(line, tokens);
+        changes.push_back(Change{"specialisation", line.number, line.text, specialised[i].text});
+    }
+    return specialised;
+}
+
+map<string, unsigned> assembler::optimize::registerSetSizes(const map<string, vector<cg::lex::Line> >& functions) {
+    /** Return numbers of registers functions use, for functions whose registers are all known.
+     *
+     *  Functions running blocks (which use registers of the function they run in), or
+     *  creating closures (which get register sets of the same size) are left out.
+     */
+    map<string, unsigned> sizes;
+    for (const pair<const string, vector<cg::lex::Line> >& function : functions) {
+        if (not optimizable(function.second)) {
+            continue;
+        }
+        map<string, int> names = assembler::ce::getnames(function.second);
+        unsigned size = 1;
+        bool known = true;
+        for (const cg::lex::Line& line : function.second) {
+            if (line.directive()) {
+                continue;
+            }
+            known = (known and not (line[0] == "try" or line[0] == "tryframe" or line[0] == "closure"));
+            for (const string& r : ::operands(line, names)) {
+                size = max(size, unsigned(stoi(r)+1));
+            }
+        }
+        if (known) {
+            sizes[function.first] = size;
+        }
+    }
+    return sizes;
+}
+
+vector<cg::lex::Line> assembler::optimize::resizeFrames(const vector<cg::lex::Line>& body, const map<string, unsigned>& sizes, const Context& context, vector<Change>& changes) {
+    /** Give frames of calls to functions of the module only as many registers as the functions use.
+     */
+    if (context.fixed_layout) {
+        return body;
+    }
+    map<string, int> names = assembler::ce::getnames(body);
+    vector<cg::lex::Line> resized = body;
+    for (unsigned i = 0; i < body.size(); ++i) {
+        unsigned call = (i + 1);
+        while (body[i][0] == "frame" and call < body.size() and (body[call][0] == "param" or body[call][0] == "paref")) {
+            ++call;
+        }
+        if (body[i][0] != "frame" or call >= body.size() or not (body[call][0] == "call" or body[call][0] == "tailcall")) {
+            continue;
+        }
+        string function = ((body[call][0] == "call" and body[call][2].size()) ? body[call][2] : body[call][1]);
+        int arguments = 0, local_registers = DEFAULT_FRAME_SIZE;
+        if ((body[i][1].size() and not literal(body[i][1], names, arguments)) or (body[i][2].size() and not literal(body[i][2], names, local_registers))) {
+            continue;
+        }
+        map<string, unsigned>::const_iterator size = sizes.find(function);
+        if (size == sizes.end() or local_registers <= 0 or size->second >= unsigned(local_registers)) {
+            continue;
+        }
+        resized[i] = rewrite(body[i], { "frame", to_string(arguments), to_string(size->second) });
+        changes.push_back(Change{"frame-size", body[i].number, body[i].text, resized[i].text});
+    }
+    return resized;
+}
+
+vector<cg::lex::Line> assembler::optimize::run(unsigned level, const string& name, const vector<cg::lex::Line>& body, bool block, const Context& context, vector<Change>& changes) {
+    /** Run optimization passes enabled at given level over body of a function or block.
+     */
+    if (level == 0 or context.fixed_layout) {
+        return body;
+    }
+    vector<cg::lex::Line> optimized = inlineCalls(level, name, body, block, context, changes);
+    for (unsigned round = 0; round < OPTIMIZATION_ROUNDS; ++round) {
+        unsigned changed = changes.size();
+        if (level >= 2) {
+            optimized = propagate(name, optimized, block, context, changes);
+        }
+        optimized = peephole(name, optimized, block, context, changes);
+        if (level < 2 or changes.size() == changed) {
+            break;
+        }
+    }
+    if (level >= 2) {
+        optimized = allocate(name, optimized, block, context, changes);
+        optimized = specialise(name, optimized, block, context, changes);
+    }
+    // blocks run in frames of functions, so they cannot give theirs away
+    if (not block and optimizable(optimized)) {
+        convertTailCalls(optimized, name, context, changes);
+    }
+    return optimized;
+}
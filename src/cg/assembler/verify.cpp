@@ -4,64 +4,66 @@
 #include <vector>
 #include <tuple>
 #include <map>
+#include <set>
 #include <algorithm>
 #include <viua/support/string.h>
+#include <viua/cg/lex.h>
 #include <viua/bytecode/maps.h>
 #include <viua/cg/assembler/assembler.h>
 #include <viua/program.h>
 using namespace std;
 
 
-string assembler::verify::functionCallsAreDefined(const vector<string>& lines, const vector<string>& function_names, const vector<string>& function_signatures) {
+string assembler::verify::functionCallsAreDefined(const vector<cg::lex::Line>& lines, const vector<string>& function_names, const vector<string>& function_signatures) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswith(line, "call")) {
+    set<string> defined(function_names.begin(), function_names.end());
+    defined.insert(function_signatures.begin(), function_signatures.end());
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] != "call" and line[0] != "tailcall") {
             continue;
         }
 
-        line = str::lstrip(line.substr(4));
-        string return_register = str::chunk(line);
-        line = str::lstrip(line.substr(return_register.size()));
-        string function = str::chunk(line);
-
         // return register is optional to give
         // if it is not given - second operand is empty, and function name must be taken from first operand
-        string& check_function = (function.size() ? function : return_register);
+        // tail calls take no return register
+        const string& check_function = ((line[0] == "call" and line[2].size()) ? line[2] : line[1]);
 
-        bool is_undefined = (find(function_names.begin(), function_names.end(), check_function) == function_names.end());
-        // if function is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(function_signatures.begin(), function_signatures.end(), check_function) == function_signatures.end());
+        // function may be undefined if we got a signature for it
+        if (not defined.count(check_function)) {
+            report << "fatal: call to undefined function '" << check_function << "' at line " << line.number;
+            break;
         }
+    }
+    return report.str();
+}
 
-        if (is_undefined) {
-            report << "fatal: call to undefined function '" << check_function << "' at line " << (i+1);
+string assembler::verify::inlinedFunctionsAreDefined(const vector<cg::lex::Line>& lines, const vector<string>& function_names) {
+    /** Functions can be inlined only if their code is available to the assembler, so
+     *  `.inline:` directives must not name functions that are only declared by signatures.
+     */
+    ostringstream report("");
+    set<string> defined(function_names.begin(), function_names.end());
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] == ".inline:" and not defined.count(line[1])) {
+            report << "fatal: .inline: directive names undefined function '" << line[1] << "' at line " << line.number;
             break;
         }
     }
     return report.str();
 }
 
-string assembler::verify::frameBalance(const vector<string>& lines) {
+string assembler::verify::frameBalance(const vector<cg::lex::Line>& lines) {
     ostringstream report("");
-    string line;
-    string instruction;
 
     int balance = 0;
-    int previous_frame_spawnline = 0;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (line.size() == 0) { continue; }
-
-        line = str::lstrip(line);
-        instruction = str::chunk(line);
-        if (not (instruction == "call" or instruction == "excall" or instruction == "fcall" or instruction == "frame")) {
+    unsigned previous_frame_spawnline = 0;
+    for (const cg::lex::Line& line : lines) {
+        const string& instruction = line[0];
+        if (not (instruction == "call" or instruction == "tailcall" or instruction == "excall" or instruction == "fcall" or instruction == "frame")) {
             continue;
         }
 
-        if (instruction == "call" or instruction == "excall" or instruction == "fcall") {
+        if (instruction == "call" or instruction == "tailcall" or instruction == "excall" or instruction == "fcall") {
             --balance;
         }
         if (instruction == "frame") {
@@ -69,82 +71,67 @@ string assembler::verify::frameBalance(const vector<string>& lines) {
         }
 
         if (balance < 0) {
-            report << "fatal: call with '" << instruction << "' without a frame at line " << (i+1);
+            report << "fatal: call with '" << instruction << "' without a frame at line " << line.number;
             break;
         }
         if (balance > 1) {
-            report << "fatal: excess frame spawned at line " << (i+1) << " (unused frame spawned at line " << (previous_frame_spawnline+1) << ')';
+            report << "fatal: excess frame spawned at line " << line.number << " (unused frame spawned at line " << previous_frame_spawnline << ')';
             break;
         }
 
         if (instruction == "frame") {
-            previous_frame_spawnline = i;
+            previous_frame_spawnline = line.number;
         }
     }
     return report.str();
 }
 
-string assembler::verify::blockTries(const vector<string>& lines, const vector<string>& block_names, const vector<string>& block_signatures) {
+string assembler::verify::blockTries(const vector<cg::lex::Line>& lines, const vector<string>& block_names, const vector<string>& block_signatures) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswithchunk(line, "try")) {
+    set<string> defined(block_names.begin(), block_names.end());
+    defined.insert(block_signatures.begin(), block_signatures.end());
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] != "try") {
             continue;
         }
 
-        string block = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
-        bool is_undefined = (find(block_names.begin(), block_names.end(), block) == block_names.end());
-        // if block is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(block_signatures.begin(), block_signatures.end(), block) == block_signatures.end());
-        }
-
-        if (is_undefined) {
-            report << "fatal: try of undefined block '" << block << "' at line " << (i+1);
+        // block may be undefined if we got a signature for it
+        if (not defined.count(line[1])) {
+            report << "fatal: try of undefined block '" << line[1] << "' at line " << line.number;
         }
     }
     return report.str();
 }
 
-string assembler::verify::callableCreations(const vector<string>& lines, const vector<string>& function_names, const vector<string>& function_signatures) {
+string assembler::verify::callableCreations(const vector<cg::lex::Line>& lines, const vector<string>& function_names, const vector<string>& function_signatures) {
     ostringstream report("");
-    string line;
-    string callable_type;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswith(line, "closure") and not str::startswith(line, "function")) {
+    set<string> defined(function_names.begin(), function_names.end());
+    defined.insert(function_signatures.begin(), function_signatures.end());
+    for (const cg::lex::Line& line : lines) {
+        const string& callable_type = line[0];
+        if (not (callable_type == "closure" or callable_type == "function")) {
             continue;
         }
 
-        callable_type = str::chunk(line);
-        line = str::lstrip(str::sub(line, callable_type.size()));
-
-        string register_index = str::chunk(line);
-        line = str::lstrip(str::sub(line, register_index.size()));
-
-        string function = str::chunk(line);
-        bool is_undefined = (find(function_names.begin(), function_names.end(), function) == function_names.end());
-        // if function is undefined, check if we got a signature for it
-        if (is_undefined) {
-            is_undefined = (find(function_signatures.begin(), function_signatures.end(), function) == function_signatures.end());
-        }
+        const string& register_index = line[1];
+        const string& function = line[2];
 
-        if (is_undefined) {
-            report << "fatal: " << callable_type << " from undefined function '" << function << "' at line " << (i+1);
+        // function may be undefined if we got a signature for it
+        if (not defined.count(function)) {
+            report << "fatal: " << callable_type << " from undefined function '" << function << "' at line " << line.number;
             break;
         }
 
         // second chunk of closure instruction, must be an integer
         if (not str::isnum(register_index)) {
-            report << "fatal: first operand (register index) is not an integer in " << callable_type << " instruction at line " << (i+1);
+            report << "fatal: first operand (register index) is not an integer in " << callable_type << " instruction at line " << line.number;
             break;
         }
     }
     return report.str();
 }
 
-string assembler::verify::ressInstructions(const vector<string>& lines, bool as_lib) {
+string assembler::verify::ressInstructions(const vector<cg::lex::Line>& lines, bool as_lib) {
     ostringstream report("");
     vector<string> legal_register_sets = {
         "global",   // global register set
@@ -152,38 +139,34 @@ string assembler::verify::ressInstructions(const vector<string>& lines, bool as_
         "static",   // static register set
         "temp",     // temporary register set
     };
-    string line;
     string function;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (str::startswith(line, ".function:")) {
-            function = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
+    for (const cg::lex::Line& line : lines) {
+        if (line[0] == ".function:") {
+            function = line[1];
             continue;
         }
-        if (not str::startswith(line, "ress")) {
+        if (line[0] != "ress") {
             continue;
         }
 
-        string registerset_name = str::chunk(str::lstrip(str::sub(line, str::chunk(line).size())));
+        const string& registerset_name = line[1];
 
         if (find(legal_register_sets.begin(), legal_register_sets.end(), registerset_name) == legal_register_sets.end()) {
-            report << "fatal: illegal register set name in ress instruction: '" << registerset_name << "' at line " << (i+1);
+            report << "fatal: illegal register set name in ress instruction: '" << registerset_name << "' at line " << line.number;
             break;
         }
         if (registerset_name == "global" and as_lib and function != "main") {
-            report << "fatal: global registers used in library function at line " << (i+1);
+            report << "fatal: global registers used in library function at line " << line.number;
             break;
         }
     }
     return report.str();
 }
 
-string assembler::verify::functionBodiesAreNonempty(const vector<string>& lines, map<string, vector<string> >& functions) {
+string assembler::verify::functionBodiesAreNonempty(const vector<cg::lex::Line>& lines, map<string, vector<cg::lex::Line> >& functions) {
     ostringstream report("");
-    string line;
     for (auto function : functions) {
-        vector<string> flines = function.second;
-        if (flines.size() == 0) {
+        if (function.second.size() == 0) {
             report << "fatal: function '" + function.first + "' is empty" << endl;
             break;
         }
@@ -191,35 +174,31 @@ string assembler::verify::functionBodiesAreNonempty(const vector<string>& lines,
     return report.str();
 }
 
-string assembler::verify::directives(const vector<string>& lines) {
+string assembler::verify::directives(const vector<cg::lex::Line>& lines) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (line.size() == 0 or line[0] != '.') {
+    for (const cg::lex::Line& line : lines) {
+        if (not line.directive()) {
             continue;
         }
 
-        string token = str::chunk(line);
-        if (not (token == ".function:" or token == ".signature:" or token == ".bsignature:" or token == ".block:" or token == ".end" or token == ".name:" or token == ".mark:" or token == ".main:")) {
-            report << "fatal: unrecognised assembler directive on line " << (i+1) << ": `" << token << '`';
+        const string& token = line[0];
+        if (not (token == ".function:" or token == ".signature:" or token == ".bsignature:" or token == ".block:" or token == ".end" or token == ".name:" or token == ".mark:" or token == ".main:" or token == ".inline:")) {
+            report << "fatal: unrecognised assembler directive on line " << line.number << ": `" << token << '`';
             break;
         }
     }
     return report.str();
 }
-string assembler::verify::instructions(const vector<string>& lines) {
+string assembler::verify::instructions(const vector<cg::lex::Line>& lines) {
     ostringstream report("");
-    string line;
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (line.size() == 0 or line[0] == '.' or line[0] == ';') {
+    for (const cg::lex::Line& line : lines) {
+        if (line.directive()) {
             continue;
         }
 
-        string token = str::chunk(line);
+        const string& token = line[0];
         if (OP_SIZES.count(token) == 0) {
-            report << "fatal: unrecognised instruction on line " << (i+1) << ": `" << token << '`';
+            report << "fatal: unrecognised instruction on line " << line.number << ": `" << token << '`';
             break;
         }
     }
@@ -1,24 +1,40 @@
+#include <cstring>
+#include <viua/bytecode/operands.h>
 #include <viua/cg/bytecode/instructions.h>
 using namespace std;
 
 
-static byte* insertIntegerOperand(byte* addr_ptr, int_op op) {
-    /** Insert integer operand into bytecode.
+static byte* insertIntegerOperands(byte* addr_ptr, initializer_list<int_op> ops) {
+    /** Insert integer operands into bytecode.
      *
      *  When using integer operand, it usually is a plain number - which translates to a regsiter index.
      *  However, when preceded by `@` integer operand will not be interpreted directly, but instead CPU
      *  will look into a register the integer points to, fetch an integer from this register and
      *  use the fetched register as the operand.
+     *
+     *  Operands are preceded by operand-mode byte holding their `@` flags and widths (see operands.h).
+     *  Numbers that fit in a single unsigned byte are encoded in one byte.
      */
+    byte* mode = addr_ptr++;
+    *mode = 0;
+
     bool ref;
     int num;
-
-    tie(ref, num) = op;
-
-    *((bool*)addr_ptr) = ref;
-    pointer::inc<bool, byte>(addr_ptr);
-    *((int*)addr_ptr)  = num;
-    pointer::inc<int, byte>(addr_ptr);
+    unsigned shift = 0;
+    for (int_op op : ops) {
+        tie(ref, num) = op;
+
+        byte op_mode = (ref ? OPERAND_REF : 0);
+        if (operands::isnarrow(num)) {
+            *(addr_ptr++) = static_cast<byte>(num);
+        } else {
+            op_mode |= OPERAND_WIDE;
+            memcpy(addr_ptr, &num, OPERAND_WIDE_SIZE);
+            addr_ptr += OPERAND_WIDE_SIZE;
+        }
+        *mode |= (op_mode << shift);
+        shift += OPERAND_MODE_BITS;
+    }
 
     return addr_ptr;
 }
@@ -27,8 +43,7 @@ static byte* insertTwoIntegerOpsInstruction(byte* addr_ptr, enum OPCODE instruct
     /** Insert instruction with two integer operands.
      */
     *(addr_ptr++) = instruction;
-    addr_ptr = insertIntegerOperand(addr_ptr, a);
-    addr_ptr = insertIntegerOperand(addr_ptr, b);
+    addr_ptr = insertIntegerOperands(addr_ptr, {a, b});
     return addr_ptr;
 }
 
@@ -36,9 +51,16 @@ static byte* insertThreeIntegerOpsInstruction(byte* addr_ptr, enum OPCODE instru
     /** Insert instruction with two integer operands.
      */
     *(addr_ptr++) = instruction;
-    addr_ptr = insertIntegerOperand(addr_ptr, a);
-    addr_ptr = insertIntegerOperand(addr_ptr, b);
-    addr_ptr = insertIntegerOperand(addr_ptr, c);
+    addr_ptr = insertIntegerOperands(addr_ptr, {a, b, c});
+    return addr_ptr;
+}
+
+static byte* insertFloatImmediateInstruction(byte* addr_ptr, enum OPCODE instruction, int_op a, int_op b, float f) {
+    /** Insert instruction with two integer operands, followed by a float.
+     */
+    addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, instruction, a, b);
+    memcpy(addr_ptr, &f, sizeof(float));
+    addr_ptr += sizeof(float);
     return addr_ptr;
 }
 
@@ -48,15 +70,15 @@ namespace cg {
         byte* nop(byte* addr_ptr) {
             /*  Inserts nop instuction.
              */
-            *(addr_ptr++) = NOP;
+            *(addr_ptr++) = static_cast<byte>(NOP);
             return addr_ptr;
         }
 
         byte* izero(byte* addr_ptr, int_op regno) {
             /*  Inserts izero instuction.
              */
-            *(addr_ptr++) = IZERO;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
+            *(addr_ptr++) = static_cast<byte>(IZERO);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
             return addr_ptr;
         }
 
@@ -127,16 +149,16 @@ namespace cg {
         byte* iinc(byte* addr_ptr, int_op regno) {
             /*  Inserts iinc instuction.
              */
-            *(addr_ptr++) = IINC;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
+            *(addr_ptr++) = static_cast<byte>(IINC);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
             return addr_ptr;
         }
 
         byte* idec(byte* addr_ptr, int_op regno) {
             /*  Inserts idec instuction.
              */
-            *(addr_ptr++) = IDEC;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
+            *(addr_ptr++) = static_cast<byte>(IDEC);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
             return addr_ptr;
         }
 
@@ -205,19 +227,204 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* fstore(byte* addr_ptr, int_op regno, float f) {
+        byte* iaddi(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts iaddi instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IADDI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* isubi(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts isubi instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, ISUBI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* imuli(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts imuli instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IMULI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* idivi(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts idivi instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IDIVI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* ilti(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts ilti instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, ILTI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* iltei(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts iltei instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, ILTEI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* igti(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts igti instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IGTI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* igtei(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts igtei instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IGTEI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* ieqi(byte* addr_ptr, int_op rega, int_op regb, int_op i) {
+            /*  Inserts ieqi instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, IEQI, rega, regb, i);
+            return addr_ptr;
+        }
+
+        byte* tiadd(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tiadd instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIADD, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tisub(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tisub instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TISUB, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* timul(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts timul instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIMUL, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tidiv(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tidiv instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIDIV, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tilt(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tilt instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TILT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tilte(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tilte instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TILTE, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tigt(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tigt instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIGT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tigte(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tigte instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIGTE, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* tieq(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts tieq instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, TIEQ, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* giadd(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts giadd instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIADD, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gisub(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gisub instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GISUB, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gimul(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gimul instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIMUL, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gidiv(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gidiv instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIDIV, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gilt(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gilt instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GILT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gilte(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gilte instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GILTE, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gigt(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gigt instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIGT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gigte(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gigte instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIGTE, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* gieq(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts gieq instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, GIEQ, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* fstore(byte* addr_ptr, int_op regno, int_op constant) {
             /*  Inserts fstore instruction to bytecode.
              *
              *  :params:
              *
-             *  regno - register number
-             *  f     - value to store
+             *  regno    - register number
+             *  constant - index of the value in constant pool
              */
-            *(addr_ptr++) = FSTORE;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
-            *((float*)addr_ptr)  = f;
-            pointer::inc<float, byte>(addr_ptr);
-
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, FSTORE, regno, constant);
             return addr_ptr;
         }
 
@@ -338,6 +545,69 @@ namespace cg {
             return addr_ptr;
         }
 
+        byte* faddi(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts faddi instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FADDI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fsubi(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fsubi instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FSUBI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fmuli(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fmuli instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FMULI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fdivi(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fdivi instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FDIVI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* flti(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts flti instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FLTI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fltei(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fltei instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FLTEI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fgti(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fgti instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FGTI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* fgtei(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts fgtei instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FGTEI, rega, regb, f);
+            return addr_ptr;
+        }
+
+        byte* feqi(byte* addr_ptr, int_op rega, int_op regb, float f) {
+            /*  Inserts feqi instruction to bytecode.
+             */
+            addr_ptr = insertFloatImmediateInstruction(addr_ptr, FEQI, rega, regb, f);
+            return addr_ptr;
+        }
+
         byte* bstore(byte* addr_ptr, int_op regno, byte_op b) {
             /*  Inserts bstore instruction to bytecode.
              *
@@ -351,12 +621,9 @@ namespace cg {
 
             tie(b_ref, bt) = b;
 
-            *(addr_ptr++) = BSTORE;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
-            *((bool*)addr_ptr) = b_ref;
-            pointer::inc<bool, byte>(addr_ptr);
-            *((byte*)addr_ptr)  = bt;
-            ++addr_ptr;
+            // byte operand is encoded as an integer one so it can also be a register index
+            *(addr_ptr++) = static_cast<byte>(BSTORE);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno, int_op(b_ref, static_cast<unsigned char>(bt))});
 
             return addr_ptr;
         }
@@ -389,24 +656,113 @@ namespace cg {
             return addr_ptr;
         }
 
-        byte* strstore(byte* addr_ptr, int_op reg, string s) {
+        byte* strstore(byte* addr_ptr, int_op reg, int_op constant) {
             /*  Inserts strstore instruction.
+             *  String is referred to by its index in constant pool.
              */
-            *(addr_ptr++) = STRSTORE;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, STRSTORE, reg, constant);
+            return addr_ptr;
+        }
 
-            for (unsigned i = 1; i < s.size()-1; ++i) {
-                *((char*)addr_ptr++) = s[i];
-            }
-            *((char*)addr_ptr++) = char(0);
+        byte* streq(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts streq instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, STREQ, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* strbuild(byte* addr_ptr, int_op regno) {
+            /*  Inserts strbuild instruction to bytecode.
+             */
+            *(addr_ptr++) = static_cast<byte>(STRBUILD);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
+            return addr_ptr;
+        }
+
+        byte* strappend(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts strappend instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, STRAPPEND, a, b);
+            return addr_ptr;
+        }
+
+        byte* strappendr(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts strappendr instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, STRAPPENDR, a, b);
+            return addr_ptr;
+        }
+
+        byte* strfinal(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts strfinal instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, STRFINAL, a, b);
+            return addr_ptr;
+        }
+
+        byte* strlen(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts strlen instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, STRLEN, a, b);
+            return addr_ptr;
+        }
+
+        byte* stradd(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts stradd instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, STRADD, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* strsub(byte* addr_ptr, int_op a, int_op b, int_op c, int_op d) {
+            /*  Inserts strsub instruction to bytecode.
+             */
+            *(addr_ptr++) = static_cast<byte>(STRSUB);
+            addr_ptr = insertIntegerOperands(addr_ptr, {a, b, c, d});
+            return addr_ptr;
+        }
+
+        byte* strfind(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts strfind instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, STRFIND, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* strcmp(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts strcmp instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, STRCMP, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* strsplit(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts strsplit instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, STRSPLIT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* atom(byte* addr_ptr, int_op reg, int_op constant) {
+            /*  Inserts atom instruction.
+             *  Atom name is referred to by its index in constant pool.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, ATOM, reg, constant);
+            return addr_ptr;
+        }
+
+        byte* atomeq(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts atomeq instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, ATOMEQ, rega, regb, regr);
             return addr_ptr;
         }
 
         byte* vec(byte* addr_ptr, int_op index) {
             /** Inserts vec instruction.
              */
-            *(addr_ptr++) = VEC;
-            addr_ptr = insertIntegerOperand(addr_ptr, index);
+            *(addr_ptr++) = static_cast<byte>(VEC);
+            addr_ptr = insertIntegerOperands(addr_ptr, {index});
             return addr_ptr;
         }
 
@@ -445,11 +801,40 @@ namespace cg {
             return addr_ptr;
         }
 
+        byte* vslice(byte* addr_ptr, int_op a, int_op b, int_op c, int_op d) {
+            /*  Inserts vslice instruction to bytecode.
+             */
+            *(addr_ptr++) = static_cast<byte>(VSLICE);
+            addr_ptr = insertIntegerOperands(addr_ptr, {a, b, c, d});
+            return addr_ptr;
+        }
+
+        byte* vsat(byte* addr_ptr, int_op rega, int_op regb, int_op regr) {
+            /*  Inserts vsat instruction to bytecode.
+             */
+            addr_ptr = insertThreeIntegerOpsInstruction(addr_ptr, VSAT, rega, regb, regr);
+            return addr_ptr;
+        }
+
+        byte* vslen(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts vslen instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, VSLEN, a, b);
+            return addr_ptr;
+        }
+
+        byte* vsmat(byte* addr_ptr, int_op a, int_op b) {
+            /*  Inserts vsmat instruction to bytecode.
+             */
+            addr_ptr = insertTwoIntegerOpsInstruction(addr_ptr, VSMAT, a, b);
+            return addr_ptr;
+        }
+
         byte* lognot(byte* addr_ptr, int_op reg) {
             /*  Inserts not instuction.
              */
-            *(addr_ptr++) = NOT;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(NOT);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
@@ -530,16 +915,16 @@ namespace cg {
         byte* free(byte* addr_ptr, int_op reg) {
             /*  Inserts free instuction.
              */
-            *(addr_ptr++) = FREE;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(FREE);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* empty(byte* addr_ptr, int_op reg) {
             /*  Inserts empty instuction.
              */
-            *(addr_ptr++) = EMPTY;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(EMPTY);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
@@ -562,7 +947,7 @@ namespace cg {
              *
              *  a - register set ID
              */
-            *(addr_ptr++) = RESS;
+            *(addr_ptr++) = static_cast<byte>(RESS);
             if (a == "global") {
                 *((int*)addr_ptr) = 0;
             } else if (a == "local") {
@@ -579,48 +964,48 @@ namespace cg {
         byte* tmpri(byte* addr_ptr, int_op reg) {
             /*  Inserts tmpri instuction.
              */
-            *(addr_ptr++) = TMPRI;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(TMPRI);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* tmpro(byte* addr_ptr, int_op reg) {
             /*  Inserts tmpro instuction.
              */
-            *(addr_ptr++) = TMPRO;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(TMPRO);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* print(byte* addr_ptr, int_op reg) {
             /*  Inserts print instuction.
              */
-            *(addr_ptr++) = PRINT;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(PRINT);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* echo(byte* addr_ptr, int_op reg) {
             /*  Inserts echo instuction.
              */
-            *(addr_ptr++) = ECHO;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(ECHO);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* clbind(byte* addr_ptr, int_op reg) {
             /*  Inserts clbing instuction.
              */
-            *(addr_ptr++) = CLBIND;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(CLBIND);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             return addr_ptr;
         }
 
         byte* closure(byte* addr_ptr, int_op reg, const string& fn) {
             /*  Inserts closure instuction.
              */
-            *(addr_ptr++) = CLOSURE;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(CLOSURE);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             for (unsigned i = 0; i < fn.size(); ++i) {
                 *((char*)addr_ptr++) = fn[i];
             }
@@ -631,8 +1016,8 @@ namespace cg {
         byte* function(byte* addr_ptr, int_op reg, const string& fn) {
             /*  Inserts function instuction.
              */
-            *(addr_ptr++) = FUNCTION;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(FUNCTION);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             for (unsigned i = 0; i < fn.size(); ++i) {
                 *((char*)addr_ptr++) = fn[i];
             }
@@ -697,8 +1082,8 @@ namespace cg {
              *
              *  a - target register
              */
-            *(addr_ptr++) = ARGC;
-            addr_ptr = insertIntegerOperand(addr_ptr, a);
+            *(addr_ptr++) = static_cast<byte>(ARGC);
+            addr_ptr = insertIntegerOperands(addr_ptr, {a});
             return addr_ptr;
         }
 
@@ -706,8 +1091,20 @@ namespace cg {
             /*  Inserts call instruction.
              *  Byte offset is calculated automatically.
              */
-            *(addr_ptr++) = CALL;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(CALL);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
+            for (unsigned i = 0; i < fn_name.size(); ++i) {
+                *((char*)addr_ptr++) = fn_name[i];
+            }
+            *(addr_ptr++) = '\0';
+            return addr_ptr;
+        }
+
+        byte* tailcall(byte* addr_ptr, const string& fn_name) {
+            /*  Inserts tailcall instruction.
+             *  Byte offset is calculated automatically.
+             */
+            *(addr_ptr++) = static_cast<byte>(TAILCALL);
             for (unsigned i = 0; i < fn_name.size(); ++i) {
                 *((char*)addr_ptr++) = fn_name[i];
             }
@@ -723,7 +1120,7 @@ namespace cg {
              *
              *  addr:int    - index of the instruction to which to branch
              */
-            *(addr_ptr++) = JUMP;
+            *(addr_ptr++) = static_cast<byte>(JUMP);
 
             *((int*)addr_ptr) = addr;
             pointer::inc<int, byte>(addr_ptr);
@@ -735,8 +1132,8 @@ namespace cg {
             /*  Inserts branch instruction.
              *  Byte offset is calculated automatically.
              */
-            *(addr_ptr++) = BRANCH;
-            addr_ptr = insertIntegerOperand(addr_ptr, regc);
+            *(addr_ptr++) = static_cast<byte>(BRANCH);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regc});
 
             *((int*)addr_ptr) = addr_truth;
             pointer::inc<int, byte>(addr_ptr);
@@ -750,14 +1147,14 @@ namespace cg {
         byte* tryframe(byte* addr_ptr) {
             /*  Inserts tryframe instruction.
              */
-            *(addr_ptr++) = TRYFRAME;
+            *(addr_ptr++) = static_cast<byte>(TRYFRAME);
             return addr_ptr;
         }
 
         byte* vmcatch(byte* addr_ptr, const string& type_name, const string& block_name) {
             /*  Inserts catch instruction.
              */
-            *(addr_ptr++) = CATCH;
+            *(addr_ptr++) = static_cast<byte>(CATCH);
 
             // the type
             for (unsigned i = 1; i < type_name.size()-1; ++i) {
@@ -777,8 +1174,8 @@ namespace cg {
         byte* pull(byte* addr_ptr, int_op regno) {
             /*  Inserts throw instuction.
              */
-            *(addr_ptr++) = PULL;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
+            *(addr_ptr++) = static_cast<byte>(PULL);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
             return addr_ptr;
         }
 
@@ -786,7 +1183,7 @@ namespace cg {
             /*  Inserts try instruction.
              *  Byte offset is calculated automatically.
              */
-            *(addr_ptr++) = TRY;
+            *(addr_ptr++) = static_cast<byte>(TRY);
             for (unsigned i = 0; i < block_name.size(); ++i) {
                 *((char*)addr_ptr++) = block_name[i];
             }
@@ -797,22 +1194,22 @@ namespace cg {
         byte* vmthrow(byte* addr_ptr, int_op regno) {
             /*  Inserts throw instuction.
              */
-            *(addr_ptr++) = THROW;
-            addr_ptr = insertIntegerOperand(addr_ptr, regno);
+            *(addr_ptr++) = static_cast<byte>(THROW);
+            addr_ptr = insertIntegerOperands(addr_ptr, {regno});
             return addr_ptr;
         }
 
         byte* leave(byte* addr_ptr) {
             /*  Inserts leave instruction.
              */
-            *(addr_ptr++) = LEAVE;
+            *(addr_ptr++) = static_cast<byte>(LEAVE);
             return addr_ptr;
         }
 
         byte* eximport(byte* addr_ptr, const string& module_name) {
             /*  Inserts eximport instruction.
              */
-            *(addr_ptr++) = EXIMPORT;
+            *(addr_ptr++) = static_cast<byte>(EXIMPORT);
             for (unsigned i = 1; i < module_name.size()-1; ++i) {
                 *((char*)addr_ptr++) = module_name[i];
             }
@@ -824,8 +1221,8 @@ namespace cg {
             /*  Inserts excall instruction.
              *  Byte offset is calculated automatically.
              */
-            *(addr_ptr++) = EXCALL;
-            addr_ptr = insertIntegerOperand(addr_ptr, reg);
+            *(addr_ptr++) = static_cast<byte>(EXCALL);
+            addr_ptr = insertIntegerOperands(addr_ptr, {reg});
             for (unsigned i = 0; i < fn_name.size(); ++i) {
                 *((char*)addr_ptr++) = fn_name[i];
             }
@@ -836,7 +1233,7 @@ namespace cg {
         byte* link(byte* addr_ptr, const string& module_name) {
             /*  Inserts eximport instruction.
              */
-            *(addr_ptr++) = LINK;
+            *(addr_ptr++) = static_cast<byte>(LINK);
             for (unsigned i = 0; i < module_name.size(); ++i) {
                 *((char*)addr_ptr++) = module_name[i];
             }
@@ -847,14 +1244,14 @@ namespace cg {
         byte* end(byte* addr_ptr) {
             /*  Inserts end instruction.
              */
-            *(addr_ptr++) = END;
+            *(addr_ptr++) = static_cast<byte>(END);
             return addr_ptr;
         }
 
         byte* halt(byte* addr_ptr) {
             /*  Inserts halt instruction.
              */
-            *(addr_ptr++) = HALT;
+            *(addr_ptr++) = static_cast<byte>(HALT);
             return addr_ptr;
         }
     }
@@ -1,24 +1,67 @@
 #include <sstream>
+#include <iomanip>
 #include <viua/bytecode/opcodes.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/operands.h>
 #include <viua/support/string.h>
 #include <viua/support/pointer.h>
 #include <viua/cg/disassembler/disassembler.h>
 using namespace std;
 
 
-string disassembler::intop(byte* ptr) {
+string disassembler::intop(byte*& ptr, byte& mode) {
+    /*  Disassemble integer operand at given pointer, and advance past it.
+     *
+     *  Mode is the operand-mode byte of the instruction (see operands.h), and
+     *  is shifted so the next call disassembles next operand.
+     */
+    bool ref = false;
+    int value = 0;
+    operands::getint(ptr, mode, ref, value);
+
     ostringstream oss;
+    oss << (ref ? "@" : "") << value;
+    return oss.str();
+}
 
-    oss << ((*(bool*)ptr) ? "@" : "");
-    pointer::inc<bool, byte>(ptr);
-    oss << *(int*)ptr;
-    pointer::inc<int, byte>(ptr);
+string disassembler::constant(byte*& ptr, byte& mode, bytecode_size_type offset, const ConstantPool* constants) {
+    /*  Disassemble operand referring to constant pool, and advance past it.
+     *
+     *  Literal is printed the way it is written in assembly so disassembled code can be reassembled.
+     *  Offset is the position of the instruction in its module.
+     */
+    bool ref = false;
+    int index = 0;
+    operands::getint(ptr, mode, ref, index);
+
+    uint32_t entry = 0;
+    ostringstream oss;
+    if (constants == 0 or not constants->find(offset, index, entry)) {
+        oss << "<constant " << index << '>';
+        return oss.str();
+    }
 
+    switch (constants->kind(entry)) {
+        case CONSTANT_STRING:
+            oss << str::enquote(constants->text(entry));
+            break;
+        case CONSTANT_ATOM:
+            oss << '\'' << constants->text(entry) << '\'';
+            break;
+        case CONSTANT_FLOAT:
+            oss << constants->real(entry);
+            break;
+    }
     return oss.str();
 }
 
-tuple<string, unsigned> disassembler::instruction(byte* ptr) {
+tuple<string, unsigned> disassembler::instruction(byte* ptr, bytecode_size_type offset, const ConstantPool* constants) {
+    /*  Disassemble instruction at given pointer.
+     *
+     *  Offset is the position of the instruction in its module.
+     *  It is needed to print targets of jumps (which are relative to the jumping instruction)
+     *  as module offsets, and to find literals in constant pool of the module.
+     */
     byte* bptr = ptr;
 
     OPCODE op = OPCODE(*bptr);
@@ -35,195 +78,50 @@ tuple<string, unsigned> disassembler::instruction(byte* ptr) {
 
     ostringstream oss;
     oss << opname;
-    if (in(OP_VARIABLE_LENGTH, op)) {
-    }
 
-    if (not in(OP_VARIABLE_LENGTH, op)) {
-        bptr += (OP_SIZES.at(opname)-1); // -1 because OP_SIZES add one for instruction-storing byte
-    } else if (op == STRSTORE) {
-        oss << " " << intop(bptr);
-        pointer::inc<bool, byte>(bptr);
-        pointer::inc<int, byte>(bptr);
-
-        string s = string(bptr);
-        oss << " " << str::enquote(s);
-        bptr += s.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
-    } else if ((op == CALL) or (op == EXCALL) or (op == CLOSURE) or (op == FUNCTION)) {
-        oss << " " << intop(bptr);
-        pointer::inc<bool, byte>(bptr);
-        pointer::inc<int, byte>(bptr);
-
-        oss << " ";
-        string fn_name = string(bptr);
-        oss << fn_name;
-        bptr += fn_name.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
-    } else if ((op == EXIMPORT) or (op == TRY) or (op == LINK)) {
-        oss << " ";
-        string s = string(bptr);
-        oss << (op == EXIMPORT ? str::enquote(s) : s);
-        bptr += s.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
-    } else if (op == CATCH) {
-        string s;
-
-        oss << " ";
-        s = string(bptr);
-        oss << str::enquote(s);
-        bptr += s.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
-
-        oss << " ";
-        s = string(bptr);
-        oss << s;
-        bptr += s.size();
-        ++bptr; // for null character terminating the C-style string not included in std::string
+    // integer operands come first, and are preceded by operand-mode byte
+    // instructions storing literals refer to constant pool with their last integer operand
+    unsigned integer_operands = OP_INTEGER_OPERANDS.at(opname);
+    bool refers_to_constant = ((op == STRSTORE) or (op == ATOM) or (op == FSTORE));
+    if (integer_operands) {
+        byte mode = operands::getmode(bptr);
+        for (unsigned i = 0; i < integer_operands; ++i) {
+            if (refers_to_constant and i == (integer_operands-1)) {
+                oss << " " << constant(bptr, mode, offset, constants);
+            } else {
+                oss << " " << intop(bptr, mode);
+            }
+        }
     }
 
-    unsigned increase = (bptr-ptr);
-
-    ++ptr;
+    string s;
     switch (op) {
-        case IZERO:
-        case IINC:
-        case IDEC:
-        case BINC:
-        case BDEC:
-        case PRINT:
-        case ECHO:
-        case BOOL:
-        case NOT:
-        case FREE:
-        case EMPTY:
-        case TMPRI:
-        case TMPRO:
-        case VEC:
-        case CLBIND:
-        case ARGC:
-        case THROW:
-        case PULL:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            break;
-        case ISTORE:
-        case ITOF:
-        case FTOI:
-        case STOI:
-        case STOF:
-        case FRAME:
-        case ARG:
-        case PARAM:
-        case PAREF:
-        case MOVE:
-        case COPY:
-        case REF:
-        case SWAP:
-        case ISNULL:
-        case VPUSH:
-        case VLEN:
-        case FCALL:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            break;
-        case IADD:
-        case ISUB:
-        case IMUL:
-        case IDIV:
-        case ILT:
-        case ILTE:
-        case IGT:
-        case IGTE:
-        case IEQ:
-        case FADD:
-        case FSUB:
-        case FMUL:
-        case FDIV:
-        case FLT:
-        case FLTE:
-        case FGT:
-        case FGTE:
-        case FEQ:
-        case BADD:
-        case BSUB:
-        case BLT:
-        case BLTE:
-        case BGT:
-        case BGTE:
-        case BEQ:
-        case STREQ:
-        case AND:
-        case OR:
-        case VINSERT:
-        case VPOP:
-        case VAT:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            break;
         case JUMP:
             oss << " 0x";
             oss << hex;
-            oss << *(int*)ptr;
+            oss << (offset + *(int*)bptr);
+            pointer::inc<int, byte>(bptr);
 
             oss << dec;
 
             break;
         case BRANCH:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
             oss << " 0x";
             oss << hex;
-            oss << *(int*)ptr;
-            pointer::inc<int, byte>(ptr);
+            oss << (offset + *(int*)bptr);
+            pointer::inc<int, byte>(bptr);
 
             oss << " 0x";
             oss << hex;
-            oss << *(int*)ptr;
-            pointer::inc<int, byte>(ptr);
+            oss << (offset + *(int*)bptr);
+            pointer::inc<int, byte>(bptr);
 
             oss << dec;
 
-            break;
-        case FSTORE:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            oss << " ";
-            oss << *(float*)ptr;
-            break;
-        case BSTORE:
-            oss << " " << intop(ptr);
-            pointer::inc<bool, byte>(ptr);
-            pointer::inc<int, byte>(ptr);
-
-            oss << " ";
-            pointer::inc<bool, byte>(ptr);
-            oss << int(*(byte*)ptr);
             break;
         case RESS:
             oss << " ";
-            switch(int(*(byte*)ptr)) {
+            switch(*(int*)bptr) {
                 case 0:
                     oss << "global";
                     break;
@@ -237,11 +135,54 @@ tuple<string, unsigned> disassembler::instruction(byte* ptr) {
                     oss << "temp";
                     break;
             }
+            pointer::inc<int, byte>(bptr);
+            break;
+        case CALL:
+        case TAILCALL:
+        case EXCALL:
+        case CLOSURE:
+        case FUNCTION:
+        case TRY:
+        case LINK:
+            s = string(bptr);
+            oss << " " << s;
+            bptr += s.size();
+            ++bptr; // for null character terminating the C-style string not included in std::string
+            break;
+        case EXIMPORT:
+            s = string(bptr);
+            oss << " " << str::enquote(s);
+            bptr += s.size();
+            ++bptr; // for null character terminating the C-style string not included in std::string
+            break;
+        case FADDI:
+        case FSUBI:
+        case FMULI:
+        case FDIVI:
+        case FLTI:
+        case FLTEI:
+        case FGTI:
+        case FGTEI:
+        case FEQI:
+            // float immediates are printed with enough digits to be read back exactly
+            oss << " " << setprecision(9) << *(float*)bptr;
+            pointer::inc<float, byte>(bptr);
+            break;
+        case CATCH:
+            s = string(bptr);
+            oss << " " << str::enquote(s);
+            bptr += s.size();
+            ++bptr; // for null character terminating the C-style string not included in std::string
+
+            s = string(bptr);
+            oss << " " << s;
+            bptr += s.size();
+            ++bptr; // for null character terminating the C-style string not included in std::string
             break;
         default:
-            // if opcode was not covered here, it means it must have been a variable-length opcode
-            oss << "";
+            // instruction has only integer operands (or no operands at all)
+            break;
     }
 
-    return tuple<string, unsigned>(oss.str(), increase);
+    return tuple<string, unsigned>(oss.str(), (bptr-ptr));
 }
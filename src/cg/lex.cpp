@@ -0,0 +1,72 @@
+#include <string>
+#include <vector>
+#include <viua/cg/lex.h>
+using namespace std;
+
+
+static bool iswhitespace(char c) {
+    return (c == ' ' or c == '\t' or c == '\v' or c == '\n');
+}
+
+
+const string& cg::lex::Line::operator[](unsigned i) const {
+    static const string empty = "";
+    return (i < tokens.size() ? tokens[i] : empty);
+}
+
+bool cg::lex::Line::directive() const {
+    return (text.size() and text[0] == '.');
+}
+
+
+cg::lex::Line cg::lex::tokenise(const string& s, unsigned number) {
+    /** Split a line into tokens.
+     *
+     *  Tokens are separated by whitespace.
+     *  Token beginning with a quote extends up to the matching (unescaped) quote, and
+     *  may contain whitespace.
+     */
+    Line line;
+    line.number = number;
+
+    string::size_type i = 0;
+    while (i < s.size() and iswhitespace(s[i])) { ++i; }
+    line.text = s.substr(i);
+
+    while (i < s.size()) {
+        string::size_type begin = i;
+        char quote = s[i];
+        if (quote == '"' or quote == '\'') {
+            int backs = 0;
+            for (++i; i < s.size(); ++i) {
+                if (s[i] == quote and (backs % 2 == 0)) {
+                    ++i;
+                    break;
+                }
+                if (s[i] == '\\') { ++backs; }
+                if (s[i] == quote) { backs = 0; }
+            }
+        } else {
+            while (i < s.size() and not iswhitespace(s[i])) { ++i; }
+        }
+        line.tokens.push_back(s.substr(begin, (i - begin)));
+        while (i < s.size() and iswhitespace(s[i])) { ++i; }
+    }
+
+    return line;
+}
+
+vector<cg::lex::Line> cg::lex::tokenise(const vector<string>& lines) {
+    /** Tokenise source, dropping empty lines and comments.
+     */
+    vector<Line> tokenised;
+    tokenised.reserve(lines.size());
+    for (unsigned i = 0; i < lines.size(); ++i) {
+        Line line = tokenise(lines[i], (i+1));
+        if (line.tokens.empty() or line.text[0] == ';') {
+            continue;
+        }
+        tokenised.push_back(line);
+    }
+    return tokenised;
+}
@@ -0,0 +1,251 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <utility>
+#include <tuple>
+#include <limits>
+#include <viua/bytecode/format.h>
+#include <viua/constpool.h>
+using namespace std;
+
+
+const uint32_t CONSTPOOL_SEGMENT_FIELDS = 2;
+const uint32_t CONSTPOOL_ENTRY_FIELDS = 2;
+
+
+static void appendField(string& out, uint32_t value) {
+    out.append((const char*)&value, sizeof(uint32_t));
+}
+
+
+uint32_t ConstantPool::field(uint32_t base, uint32_t index) const {
+    uint32_t value;
+    memcpy(&value, section.data()+base+(index*sizeof(uint32_t)), sizeof(uint32_t));
+    return value;
+}
+
+bool ConstantPool::empty() const {
+    return (entry_count == 0);
+}
+uint32_t ConstantPool::size() const {
+    return entry_count;
+}
+
+bool ConstantPool::find(bytecode_size_type offset, uint32_t index, uint32_t& entry) const {
+    /** Find entry used by instruction at given bytecode offset under given index.
+     *
+     *  Returns false if the index is out of range of the segment the instruction belongs to, and
+     *  entry is set otherwise.
+     */
+    uint32_t first = 0, last = 0;
+    bool found = false;
+    for (uint32_t i = segment_count; i > 0 and not found; --i) {
+        uint32_t segment = ((i-1) * CONSTPOOL_SEGMENT_FIELDS);
+        if (field(segments, segment) <= offset) {
+            first = field(segments, segment+1);
+            last = limits[i-1];
+            found = true;
+        }
+    }
+    if (not found or index >= (last - first)) {
+        return false;
+    }
+    entry = (first + index);
+    return true;
+}
+
+ConstantKind ConstantPool::kind(uint32_t entry) const {
+    return ConstantKind(field(entries, (entry * CONSTPOOL_ENTRY_FIELDS)));
+}
+string ConstantPool::text(uint32_t entry) const {
+    return string(section.data()+data+field(entries, (entry * CONSTPOOL_ENTRY_FIELDS)+1));
+}
+float ConstantPool::real(uint32_t entry) const {
+    float value;
+    memcpy(&value, section.data()+data+field(entries, (entry * CONSTPOOL_ENTRY_FIELDS)+1), sizeof(float));
+    return value;
+}
+
+
+ConstantPool::ConstantPool(const char* s, bytecode_size_type sz):
+    section(),
+    segment_count(0), entry_count(0),
+    segments(0), entries(0), data(0),
+    limits()
+{
+    if (s == 0 or sz == 0) {
+        return;
+    }
+    section.assign(s, sz);
+
+    if (section.size() < sizeof(uint32_t)) {
+        throw string("fatal: malformed constant pool");
+    }
+    uint32_t segments_n = field(0, 0);
+    unsigned long long header_size = (1 + (unsigned long long)segments_n*CONSTPOOL_SEGMENT_FIELDS + 1) * sizeof(uint32_t);
+    if (segments_n == 0 or header_size > section.size()) {
+        throw string("fatal: malformed constant pool");
+    }
+    uint32_t entries_n = field(header_size - sizeof(uint32_t), 0);
+    header_size += (unsigned long long)entries_n*CONSTPOOL_ENTRY_FIELDS*sizeof(uint32_t);
+    if (header_size > section.size()) {
+        throw string("fatal: malformed constant pool");
+    }
+
+    segment_count = segments_n;
+    entry_count = entries_n;
+    segments = sizeof(uint32_t);
+    entries = (segments + (segment_count*CONSTPOOL_SEGMENT_FIELDS + 1)*sizeof(uint32_t));
+    data = header_size;
+
+    // entries are checked once here so reading them later needs no bounds checks
+    uint32_t data_size = (section.size() - data);
+    set<uint32_t> firsts;
+    for (uint32_t i = 0; i < segment_count; ++i) {
+        if (field(segments, (i * CONSTPOOL_SEGMENT_FIELDS)+1) > entry_count) {
+            throw string("fatal: malformed constant pool");
+        }
+        firsts.insert(field(segments, (i * CONSTPOOL_SEGMENT_FIELDS)+1));
+    }
+    for (uint32_t i = 0; i < segment_count; ++i) {
+        set<uint32_t>::const_iterator next = firsts.upper_bound(field(segments, (i * CONSTPOOL_SEGMENT_FIELDS)+1));
+        limits.push_back(next == firsts.end() ? entry_count : *next);
+    }
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        uint32_t offset = field(entries, (i * CONSTPOOL_ENTRY_FIELDS)+1);
+        bool valid = false;
+        switch (kind(i)) {
+            case CONSTANT_STRING:
+            case CONSTANT_ATOM:
+                valid = (offset < data_size and memchr(section.data()+data+offset, '\0', data_size-offset) != 0);
+                break;
+            case CONSTANT_FLOAT:
+                valid = (offset < data_size and (data_size - offset) >= sizeof(float));
+                break;
+        }
+        if (not valid) {
+            throw string("fatal: malformed constant pool");
+        }
+    }
+}
+
+
+uint32_t ConstantPoolBuilder::add(ConstantKind kind, const string& value) {
+    /** Return index of given literal, adding it to the pool if it was not there before.
+     */
+    if (segments.size() > 1) {
+        // entries of the module itself must precede entries of linked modules
+        throw string("constant pool: literal added after a module was linked");
+    }
+    pair<ConstantKind, string> key(kind, value);
+    map<pair<ConstantKind, string>, uint32_t>::const_iterator found = indexes.find(key);
+    if (found != indexes.end()) {
+        return found->second;
+    }
+    if (sealed) {
+        throw string("constant pool: literal added to a sealed pool");
+    }
+    entries.push_back(key);
+    return (indexes[key] = (entries.size()-1));
+}
+
+ConstantPoolBuilder& ConstantPoolBuilder::seal(bool s) {
+    sealed = s;
+    return (*this);
+}
+
+uint32_t ConstantPoolBuilder::str(const string& s) {
+    return add(CONSTANT_STRING, s);
+}
+uint32_t ConstantPoolBuilder::atom(const string& s) {
+    return add(CONSTANT_ATOM, s);
+}
+uint32_t ConstantPoolBuilder::real(float f) {
+    return add(CONSTANT_FLOAT, string((const char*)&f, sizeof(float)));
+}
+
+void ConstantPoolBuilder::link(const ConstantPool& pool, bytecode_size_type offset) {
+    /** Append pool of a module linked at given bytecode offset.
+     */
+    vector<tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type> > placement;
+    placement.push_back(tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type>(0, offset, numeric_limits<bytecode_size_type>::max()));
+    link(pool, placement);
+}
+
+void ConstantPoolBuilder::link(const ConstantPool& pool, const vector<tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type> >& placement, const vector<bool>* used) {
+    /** Append pool of a module whose bytecode was placed in pieces.
+     *
+     *  Placement is given as (offset in the module, offset in output, size) triples sorted by offset in output.
+     *  Pieces that were not placed (e.g. functions removed by the linker) do not get segments.
+     *
+     *  If flags of used entries are given, only these entries are appended.
+     *  Entries of a segment are then moved down over the dropped ones, so
+     *  indexes in placed bytecode must be adjusted by the caller.
+     *
+     *  Entries of linked module are not merged with entries already in the pool as
+     *  bytecode of the module refers to them by its own indexes.
+     */
+    uint32_t base = entries.size();
+
+    // new position of every entry (and one past the last one)
+    vector<uint32_t> moved(pool.size()+1, 0);
+    for (uint32_t i = 0; i < pool.size(); ++i) {
+        moved[i+1] = (moved[i] + ((used == 0 or used->at(i)) ? 1 : 0));
+    }
+
+    bytecode_size_type from, to, size;
+    for (tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type> piece : placement) {
+        tie(from, to, size) = piece;
+        for (uint32_t i = 0; i < pool.segment_count; ++i) {
+            uint32_t segment = (i * CONSTPOOL_SEGMENT_FIELDS);
+            bytecode_size_type segment_offset = pool.field(pool.segments, segment);
+            bytecode_size_type next_offset = ((i+1) < pool.segment_count ? pool.field(pool.segments, segment+CONSTPOOL_SEGMENT_FIELDS) : numeric_limits<bytecode_size_type>::max());
+            if (next_offset <= from or (segment_offset > from and (segment_offset - from) >= size)) {
+                // segment does not overlap the piece
+                continue;
+            }
+            bytecode_size_type start = (segment_offset > from ? (to + (segment_offset - from)) : to);
+            segments.push_back(pair<bytecode_size_type, uint32_t>(start, (base + moved.at(pool.field(pool.segments, segment+1)))));
+        }
+    }
+    for (uint32_t i = 0; i < pool.size(); ++i) {
+        if (used and not used->at(i)) {
+            continue;
+        }
+        ConstantKind kind = pool.kind(i);
+        entries.push_back(pair<ConstantKind, string>(kind, (kind == CONSTANT_FLOAT ? string(pool.section.data()+pool.data+pool.field(pool.entries, (i * CONSTPOOL_ENTRY_FIELDS)+1), sizeof(float)) : pool.text(i))));
+    }
+}
+
+uint32_t ConstantPoolBuilder::size() const {
+    return entries.size();
+}
+
+string ConstantPoolBuilder::build() const {
+    /** Build constant pool section.
+     *
+     *  Returned string holds the section without its size field.
+     */
+    string section, entry_section, data_section;
+
+    appendField(section, segments.size());
+    for (pair<bytecode_size_type, uint32_t> segment : segments) {
+        appendField(section, segment.first);
+        appendField(section, segment.second);
+    }
+
+    for (pair<ConstantKind, string> entry : entries) {
+        appendField(entry_section, entry.first);
+        appendField(entry_section, data_section.size());
+        data_section.append(entry.second);
+        if (entry.first != CONSTANT_FLOAT) {
+            data_section.push_back('\0');
+        }
+    }
+    appendField(section, entries.size());
+
+    return (section + entry_section + data_section);
+}
@@ -1,12 +1,20 @@
 #include <iostream>
 #include <vector>
+#include <sstream>
+#include <tuple>
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/bytecode/opcodes.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/operands.h>
 #include <viua/types/type.h>
 #include <viua/types/integer.h>
 #include <viua/types/byte.h>
 #include <viua/types/string.h>
+#include <viua/types/atom.h>
+#include <viua/types/float.h>
 #include <viua/types/vector.h>
 #include <viua/types/exception.h>
 #include <viua/support/pointer.h>
@@ -19,6 +27,8 @@ CPU& CPU::load(byte* bc) {
     /*  Load bytecode into the CPU.
      *  CPU becomes owner of loaded bytecode - meaning it will consider itself responsible for proper
      *  destruction of it, so make sure you have a copy of the bytecode.
+     *  Bytecode living in an image registered with .mapimage() is used in place, and
+     *  its image is unmapped instead.
      *
      *  Any previously loaded bytecode is freed.
      *  To free bytecode without loading anything new it is possible to call .load(0).
@@ -27,13 +37,142 @@ CPU& CPU::load(byte* bc) {
      *
      *  bc:char*    - pointer to byte array containing bytecode with a program to run
      */
-    if (bytecode) { delete[] bytecode; }
+    if (bytecode) { release(bytecode); }
     bytecode = bc;
-    jump_base = bytecode;
     return (*this);
 }
 
-CPU& CPU::bytes(uint16_t sz) {
+CPU& CPU::mapimage(byte* bc, void* image, std::size_t image_size) {
+    /*  Register memory-mapped image containing given bytecode.
+     *  CPU becomes owner of the image, and will unmap it instead of freeing the bytecode.
+     */
+    mapped_images[bc] = pair<void*, std::size_t>(image, image_size);
+    return (*this);
+}
+
+void CPU::release(byte* bc) {
+    /*  Free bytecode, or unmap the image it lives in.
+     */
+    map<byte*, pair<void*, std::size_t> >::iterator found = mapped_images.find(bc);
+    if (found != mapped_images.end()) {
+        munmap(found->second.first, found->second.second);
+        mapped_images.erase(found);
+    } else {
+        delete[] bc;
+    }
+}
+
+CPU& CPU::constpool(byte* bc, bytecode_size_type size, const ConstantPool& cp) {
+    /*  Register constant pool of given bytecode.
+     *  Instructions storing literals find their values in it.
+     */
+    constant_pools[bc] = tuple<bytecode_size_type, ConstantPool, vector<Type*> >(size, cp, vector<Type*>(cp.size(), 0));
+    return (*this);
+}
+
+CPU& CPU::symtab(const SymbolTable& st) {
+    /*  Set symbol table of loaded bytecode.
+     *  Functions and blocks that were not explicitly mapped are looked up in it.
+     */
+    symbol_table = st;
+    return (*this);
+}
+
+bool CPU::resolvefunction(const string& name) {
+    /*  Make sure function is present in address maps.
+     *  Returns false if the function cannot be found.
+     */
+    if (function_addresses.count(name) or linked_functions.count(name)) {
+        return true;
+    }
+
+    bytecode_size_type address = 0;
+    if (symbol_table.lookup(name, SYMBOL_FUNCTION, address)) {
+        function_addresses[name] = address;
+        return true;
+    }
+    for (pair<string, SymbolTable>& lst : linked_symbol_tables) {
+        if (lst.second.lookup(name, SYMBOL_FUNCTION, address)) {
+            linked_functions[name] = pair<string, byte*>(lst.first, materialize(lst.first, address, SYMBOL_FUNCTION));
+            ++get<0>(module_statistics[lst.first]);
+            return true;
+        }
+    }
+    return false;
+}
+
+byte* CPU::materialize(const string& module, bytecode_size_type address, SymbolKind kind) {
+    /*  Check that code of a function or block from linked module can be executed, and
+     *  return its address.
+     *
+     *  Every instruction up to the next boundary of the module is decoded so
+     *  corrupted code is reported before it runs instead of being executed.
+     */
+    string what = (kind == SYMBOL_BLOCK ? "block" : "function");
+    pair<unsigned, byte*> linked_module = linked_modules.at(module);
+    if (address >= linked_module.first) {
+        throw new Exception("corrupted module: " + module + ": " + what + " address out of bounds");
+    }
+
+    const vector<bytecode_size_type>& boundaries = module_boundaries[module];
+    vector<bytecode_size_type>::const_iterator next = upper_bound(boundaries.begin(), boundaries.end(), address);
+    bytecode_size_type end = ((next == boundaries.end() or *next > linked_module.first) ? linked_module.first : *next);
+
+    byte* code = (linked_module.second+address);
+    for (bytecode_size_type offset = address; offset < end;) {
+        OPCODE op = OPCODE(linked_module.second[offset]);
+        bytecode_size_type size = 0;
+        try {
+            string opname = OP_NAMES.at(op);
+            size = OP_SIZES.at(opname);
+            if (OP_INTEGER_OPERANDS.at(opname) and (offset+1) < end) {
+                size += operands::widening(linked_module.second[offset+1]);
+            }
+        } catch (const std::out_of_range& e) {
+            ostringstream oss;
+            oss << "corrupted module: " << module << ": invalid opcode in " << what << " at byte " << offset;
+            throw new Exception(oss.str());
+        }
+        // strings are placed after integer operands
+        unsigned strings = (find(OP_VARIABLE_LENGTH.begin(), OP_VARIABLE_LENGTH.end(), op) == OP_VARIABLE_LENGTH.end() ? 0 : (op == CATCH ? 2 : 1));
+        for (unsigned i = 0; i < strings and size <= (end - offset); ++i) {
+            const void* nul = memchr(linked_module.second+offset+size, '\0', (end - (offset+size)));
+            size = (nul ? (((const byte*)nul - (linked_module.second+offset)) + 1) : (end - offset + 1));
+        }
+        if (size > (end - offset)) {
+            ostringstream oss;
+            oss << "corrupted module: " << module << ": truncated instruction in " << what << " at byte " << offset;
+            throw new Exception(oss.str());
+        }
+        offset += size;
+    }
+    return code;
+}
+
+bool CPU::resolveblock(const string& name) {
+    /*  Make sure block is present in address maps.
+     *  Returns false if the block cannot be found.
+     */
+    if (block_addresses.count(name) or linked_blocks.count(name)) {
+        return true;
+    }
+
+    bytecode_size_type address = 0;
+    if (symbol_table.lookup(name, SYMBOL_BLOCK, address)) {
+        block_addresses[name] = address;
+        return true;
+    }
+    for (pair<string, SymbolTable>& lst : linked_symbol_tables) {
+        if (lst.second.lookup(name, SYMBOL_BLOCK, address)) {
+            linked_blocks[name] = pair<string, byte*>(lst.first, materialize(lst.first, address, SYMBOL_BLOCK));
+            ++get<2>(module_statistics[lst.first]);
+            return true;
+        }
+    }
+    return false;
+}
+
+CPU& CPU::bytes(bytecode_size_type sz) {
     /*  Set bytecode size, so the CPU can stop execution even if it doesn't reach HALT instruction but reaches
      *  bytecode address out of bounds.
      */
@@ -41,7 +180,7 @@ CPU& CPU::bytes(uint16_t sz) {
     return (*this);
 }
 
-CPU& CPU::eoffset(uint16_t o) {
+CPU& CPU::eoffset(bytecode_size_type o) {
     /*  Set offset of first executable instruction.
      */
     executable_offset = o;
@@ -156,6 +295,72 @@ void CPU::ensureStaticRegisters(string function_name) {
 }
 
 
+const std::string* CPU::intern(const string& s) {
+    /** Return pointer to pooled copy of given text.
+     *
+     *  Text is inserted into the pool if it was not there before.
+     *  Pointers returned by this function are valid as long as the CPU lives.
+     */
+    return &(*string_pool.insert(s).first);
+}
+
+map<byte*, tuple<bytecode_size_type, ConstantPool, vector<Type*> > >::iterator CPU::poolof(byte* addr) {
+    /** Return constant pool of the bytecode given address belongs to.
+     *
+     *  Returns end of pools map if the address does not belong to any bytecode with a pool.
+     */
+    map<byte*, tuple<bytecode_size_type, ConstantPool, vector<Type*> > >::iterator pool = constant_pools.upper_bound(addr);
+    if (pool == constant_pools.begin()) {
+        return constant_pools.end();
+    }
+    --pool;
+    if (addr >= (pool->first + get<0>(pool->second))) {
+        return constant_pools.end();
+    }
+    return pool;
+}
+
+Type* CPU::constant(byte* addr, int index, ConstantKind kind) {
+    /** Return object built from constant used by instruction at given address.
+     *
+     *  Returned object is owned by the CPU so instructions must place copies of it in registers.
+     */
+    map<byte*, tuple<bytecode_size_type, ConstantPool, vector<Type*> > >::iterator pool = poolof(addr);
+    if (pool == constant_pools.end()) {
+        throw new Exception("no constant pool for executed bytecode");
+    }
+
+    const ConstantPool& constants = get<1>(pool->second);
+    uint32_t entry = 0;
+    if (index < 0 or not constants.find((addr - pool->first), index, entry)) {
+        ostringstream oss;
+        oss << "invalid constant pool index: " << index;
+        throw new Exception(oss.str());
+    }
+    if (constants.kind(entry) != kind) {
+        ostringstream oss;
+        oss << "constant pool entry " << index << " has invalid type";
+        throw new Exception(oss.str());
+    }
+
+    Type*& prototype = get<2>(pool->second)[entry];
+    if (prototype == 0) {
+        switch (kind) {
+            case CONSTANT_STRING:
+                prototype = new String(intern(constants.text(entry)));
+                break;
+            case CONSTANT_ATOM:
+                prototype = new Atom(&(*symbols.insert(constants.text(entry)).first));
+                break;
+            case CONSTANT_FLOAT:
+                prototype = new Float(constants.real(entry));
+                break;
+        }
+    }
+    return prototype;
+}
+
+
 Frame* CPU::requestNewFrame(int arguments_size, int registers_size) {
     /** Request new frame to be prepared.
      *
@@ -295,9 +500,9 @@ byte* CPU::tick() {
         return_exception = "InstructionUnchanged";
         oss << "instruction pointer did not change, possibly endless loop\n";
         oss << "note: instruction index was " << (long)(instruction_pointer-bytecode) << " and the opcode was '" << OP_NAMES.at(OPCODE(*instruction_pointer)) << "'";
-        if (OPCODE(*instruction_pointer) == CALL) {
+        if (OPCODE(*instruction_pointer) == CALL or OPCODE(*instruction_pointer) == TAILCALL) {
             oss << '\n';
-            oss << "note: this was caused by 'call' opcode immediately calling itself\n"
+            oss << "note: this was caused by '" << OP_NAMES.at(OPCODE(*instruction_pointer)) << "' opcode immediately calling itself\n"
                 << "      such situation may have several sources, e.g. empty function definition or\n"
                 << "      a function which calls itself in its first instruction";
         }
@@ -324,10 +529,15 @@ byte* CPU::tick() {
     }
 
     if (thrown != 0) {
+        /*  Atoms can be caught by value (i.e. `catch "'ok'" block`) and
+         *  such catchers take precedence over catchers for the "Atom" type.
+         */
+        string thrown_tag = (thrown->type() == "Atom" ? thrown->repr() : thrown->type());
         for (unsigned i = tryframes.size(); i > 0; --i) {
             tframe = tryframes[(i-1)];
-            if (tframe->catchers.count(thrown->type())) {
-                instruction_pointer = tframe->catchers.at(thrown->type())->block_address;
+            string catch_tag = (tframe->catchers.count(thrown_tag) ? thrown_tag : thrown->type());
+            if (tframe->catchers.count(catch_tag)) {
+                instruction_pointer = tframe->catchers.at(catch_tag)->block_address;
 
                 unsigned distance = 0;
                 for (unsigned j = (frames.size()-1); j >= 0; --j) {
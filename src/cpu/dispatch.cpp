@@ -8,7 +8,7 @@ using namespace std;
 byte* CPU::dispatch(byte* addr) {
     /** Dispatches instruction at a pointer to its handler.
      */
-    switch (*addr) {
+    switch (OPCODE(*addr)) {
         case IZERO:
             addr = izero(addr+1);
             break;
@@ -48,6 +48,87 @@ byte* CPU::dispatch(byte* addr) {
         case IEQ:
             addr = ieq(addr+1);
             break;
+        case IADDI:
+            addr = iaddi(addr+1);
+            break;
+        case ISUBI:
+            addr = isubi(addr+1);
+            break;
+        case IMULI:
+            addr = imuli(addr+1);
+            break;
+        case IDIVI:
+            addr = idivi(addr+1);
+            break;
+        case ILTI:
+            addr = ilti(addr+1);
+            break;
+        case ILTEI:
+            addr = iltei(addr+1);
+            break;
+        case IGTI:
+            addr = igti(addr+1);
+            break;
+        case IGTEI:
+            addr = igtei(addr+1);
+            break;
+        case IEQI:
+            addr = ieqi(addr+1);
+            break;
+        case TIADD:
+            addr = tiadd(addr+1);
+            break;
+        case TISUB:
+            addr = tisub(addr+1);
+            break;
+        case TIMUL:
+            addr = timul(addr+1);
+            break;
+        case TIDIV:
+            addr = tidiv(addr+1);
+            break;
+        case TILT:
+            addr = tilt(addr+1);
+            break;
+        case TILTE:
+            addr = tilte(addr+1);
+            break;
+        case TIGT:
+            addr = tigt(addr+1);
+            break;
+        case TIGTE:
+            addr = tigte(addr+1);
+            break;
+        case TIEQ:
+            addr = tieq(addr+1);
+            break;
+        case GIADD:
+            addr = giadd(addr+1);
+            break;
+        case GISUB:
+            addr = gisub(addr+1);
+            break;
+        case GIMUL:
+            addr = gimul(addr+1);
+            break;
+        case GIDIV:
+            addr = gidiv(addr+1);
+            break;
+        case GILT:
+            addr = gilt(addr+1);
+            break;
+        case GILTE:
+            addr = gilte(addr+1);
+            break;
+        case GIGT:
+            addr = gigt(addr+1);
+            break;
+        case GIGTE:
+            addr = gigte(addr+1);
+            break;
+        case GIEQ:
+            addr = gieq(addr+1);
+            break;
         case FSTORE:
             addr = fstore(addr+1);
             break;
@@ -78,6 +159,33 @@ byte* CPU::dispatch(byte* addr) {
         case FEQ:
             addr = feq(addr+1);
             break;
+        case FADDI:
+            addr = faddi(addr+1);
+            break;
+        case FSUBI:
+            addr = fsubi(addr+1);
+            break;
+        case FMULI:
+            addr = fmuli(addr+1);
+            break;
+        case FDIVI:
+            addr = fdivi(addr+1);
+            break;
+        case FLTI:
+            addr = flti(addr+1);
+            break;
+        case FLTEI:
+            addr = fltei(addr+1);
+            break;
+        case FGTI:
+            addr = fgti(addr+1);
+            break;
+        case FGTEI:
+            addr = fgtei(addr+1);
+            break;
+        case FEQI:
+            addr = feqi(addr+1);
+            break;
         case BSTORE:
             addr = bstore(addr+1);
             break;
@@ -96,6 +204,45 @@ byte* CPU::dispatch(byte* addr) {
         case STRSTORE:
             addr = strstore(addr+1);
             break;
+        case STREQ:
+            addr = streq(addr+1);
+            break;
+        case STRBUILD:
+            addr = strbuild(addr+1);
+            break;
+        case STRAPPEND:
+            addr = strappend(addr+1);
+            break;
+        case STRAPPENDR:
+            addr = strappendr(addr+1);
+            break;
+        case STRFINAL:
+            addr = strfinal(addr+1);
+            break;
+        case STRLEN:
+            addr = strlen(addr+1);
+            break;
+        case STRADD:
+            addr = stradd(addr+1);
+            break;
+        case STRSUB:
+            addr = strsub(addr+1);
+            break;
+        case STRFIND:
+            addr = strfind(addr+1);
+            break;
+        case STRCMP:
+            addr = strcmp(addr+1);
+            break;
+        case STRSPLIT:
+            addr = strsplit(addr+1);
+            break;
+        case ATOM:
+            addr = atom(addr+1);
+            break;
+        case ATOMEQ:
+            addr = atomeq(addr+1);
+            break;
         case VEC:
             addr = vec(addr+1);
             break;
@@ -114,6 +261,18 @@ byte* CPU::dispatch(byte* addr) {
         case VLEN:
             addr = vlen(addr+1);
             break;
+        case VSLICE:
+            addr = vslice(addr+1);
+            break;
+        case VSAT:
+            addr = vsat(addr+1);
+            break;
+        case VSLEN:
+            addr = vslen(addr+1);
+            break;
+        case VSMAT:
+            addr = vsmat(addr+1);
+            break;
         case NOT:
             addr = lognot(addr+1);
             break;
@@ -189,6 +348,9 @@ byte* CPU::dispatch(byte* addr) {
         case CALL:
             addr = call(addr+1);
             break;
+        case TAILCALL:
+            addr = tailcall(addr+1);
+            break;
         case END:
             addr = end(addr);
             break;
@@ -5,6 +5,7 @@
 #include <viua/types/boolean.h>
 #include <viua/types/byte.h>
 #include <viua/support/pointer.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -12,28 +13,21 @@ using namespace std;
 byte* CPU::bstore(byte* addr) {
     /*  Run bstore instruction.
      */
-    int destination_register;
+    int destination_register, operand;
     bool destination_register_ref = false, operand_ref = false;
-    byte operand;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    operand = *((byte*)addr);
-    ++addr;
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register);
+    operands::getint(addr, operand_mode, operand_ref, operand);
 
     if (destination_register_ref) {
         destination_register = static_cast<Integer*>(fetch(destination_register))->value();
     }
     if (operand_ref) {
-        operand = static_cast<Byte*>(fetch((int)operand))->value();
+        operand = static_cast<Byte*>(fetch(operand))->value();
     }
 
-    place(destination_register, new Byte(operand));
+    place(destination_register, new Byte(static_cast<byte>(operand)));
 
     return addr;
 }
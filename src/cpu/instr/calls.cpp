@@ -1,6 +1,7 @@
 #include <viua/types/boolean.h>
 #include <viua/support/pointer.h>
 #include <viua/exceptions.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -11,15 +12,9 @@ byte* CPU::frame(byte* addr) {
     int arguments, local_registers;
     bool arguments_ref = false, local_registers_ref = false;
 
-    arguments_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    arguments = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    local_registers_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    local_registers = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, arguments_ref, arguments);
+    operands::getint(addr, operand_mode, local_registers_ref, local_registers);
 
     if (arguments_ref) {
         arguments = static_cast<Integer*>(fetch(arguments))->value();
@@ -38,15 +33,9 @@ byte* CPU::param(byte* addr) {
     int parameter_no_operand_index, object_operand_index;
     bool parameter_no_operand_ref = false, object_operand_ref = false;
 
-    parameter_no_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    parameter_no_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, parameter_no_operand_ref, parameter_no_operand_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (parameter_no_operand_ref) {
         parameter_no_operand_index = static_cast<Integer*>(fetch(parameter_no_operand_index))->value();
@@ -68,15 +57,9 @@ byte* CPU::paref(byte* addr) {
     int parameter_no_operand_index, object_operand_index;
     bool parameter_no_operand_ref = false, object_operand_ref = false;
 
-    parameter_no_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    parameter_no_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, parameter_no_operand_ref, parameter_no_operand_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (parameter_no_operand_ref) {
         parameter_no_operand_index = static_cast<Integer*>(fetch(parameter_no_operand_index))->value();
@@ -98,15 +81,9 @@ byte* CPU::arg(byte* addr) {
     int parameter_no_operand_index, destination_register_index;
     bool parameter_no_operand_ref = false, destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    parameter_no_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    parameter_no_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, parameter_no_operand_ref, parameter_no_operand_index);
 
     if (parameter_no_operand_ref) {
         parameter_no_operand_index = static_cast<Integer*>(fetch(parameter_no_operand_index))->value();
@@ -137,10 +114,8 @@ byte* CPU::argc(byte* addr) {
     int destination_register_index;
     bool destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
 
     if (destination_register_ref) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
@@ -154,14 +129,14 @@ byte* CPU::argc(byte* addr) {
 byte* CPU::call(byte* addr) {
     /*  Run call instruction.
      */
-    bool return_register_ref = *(bool*)addr;
-    pointer::inc<bool, byte>(addr);
+    bool return_register_ref;
+    int return_register_index;
 
-    int return_register_index = *(int*)addr;
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, return_register_ref, return_register_index);
 
     string call_name = string(addr);
-    bool function_found = (function_addresses.count(call_name) or linked_functions.count(call_name));
+    bool function_found = resolvefunction(call_name);
 
     if (not function_found) {
         throw new Exception("call to undefined function: " + call_name);
@@ -170,10 +145,8 @@ byte* CPU::call(byte* addr) {
     byte* call_address = 0;
     if (function_addresses.count(call_name)) {
         call_address = bytecode+function_addresses.at(call_name);
-        jump_base = bytecode;
     } else {
         call_address = linked_functions.at(call_name).second;
-        jump_base = linked_modules.at(linked_functions.at(call_name).first).second;
     }
     addr += (call_name.size()+1);
 
@@ -195,6 +168,70 @@ byte* CPU::call(byte* addr) {
     return call_address;
 }
 
+byte* CPU::tailcall(byte* addr) {
+    /*  Run tailcall instruction.
+     *
+     *  Called function takes place of the current one on the call stack, and
+     *  returns its value to where the current function would return its own.
+     */
+    string call_name = string(addr);
+    bool function_found = resolvefunction(call_name);
+
+    if (not function_found) {
+        throw new Exception("tail call to undefined function: " + call_name);
+    }
+
+    byte* call_address = 0;
+    if (function_addresses.count(call_name)) {
+        call_address = bytecode+function_addresses.at(call_name);
+    } else {
+        call_address = linked_functions.at(call_name).second;
+    }
+
+    if (frame_new == 0) {
+        throw new Exception("tail call without a frame: use `frame 0' in source code if the function takes no parameters");
+    }
+    if (frames.size() < 2) {
+        throw new Exception("tail call from entry function");
+    }
+    Frame* current = frames.back();
+    if (tryframes.size() and tryframes.back()->associated_frame == current) {
+        throw new Exception("tail call from a block");
+    }
+
+    frame_new->function_name = call_name;
+    frame_new->return_address = current->return_address;
+    frame_new->resolve_return_value_register = current->resolve_return_value_register;
+    frame_new->place_return_value_in = current->place_return_value_in;
+    frame_new->elided_frames = (current->elided_frames + 1);
+
+    // current frame can be deleted only if the new one refers to none of its objects, i.e.
+    // if every reference parameter is one the current frame got from its caller
+    bool referenced = false;
+    for (unsigned i = 0; i < frame_new->args->size() and not referenced; ++i) {
+        if (frame_new->args->at(i) == 0 or not frame_new->args->isflagged(i, REFERENCE)) {
+            continue;
+        }
+        referenced = true;
+        for (unsigned j = 0; j < current->args->size() and referenced; ++j) {
+            referenced = not (current->args->at(j) == frame_new->args->at(i) and current->args->isflagged(j, REFERENCE));
+        }
+    }
+
+    frames.pop_back();
+    if (referenced) {
+        frame_new->retained = current;
+    } else {
+        frame_new->retained = current->retained;
+        current->retained = 0;
+        delete current;
+    }
+
+    pushFrame();
+
+    return call_address;
+}
+
 byte* CPU::end(byte* addr) {
     /*  Run end instruction.
      */
@@ -233,13 +270,5 @@ byte* CPU::end(byte* addr) {
         }
     }
 
-    if (frames.size() > 0) {
-        if (function_addresses.count(frames.back()->function_name)) {
-            jump_base = bytecode;
-        } else {
-            jump_base = linked_modules.at(linked_functions.at(frames.back()->function_name).first).second;
-        }
-    }
-
     return addr;
 }
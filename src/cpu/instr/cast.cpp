@@ -6,6 +6,7 @@
 #include <viua/types/byte.h>
 #include <viua/types/string.h>
 #include <viua/support/pointer.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -16,15 +17,9 @@ byte* CPU::itof(byte* addr) {
     bool casted_object_ref, destination_register_ref;
     int casted_object_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    casted_object_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    casted_object_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, casted_object_ref, casted_object_index);
 
     if (casted_object_ref) {
         casted_object_index = static_cast<Integer*>(fetch(casted_object_index))->value();
@@ -44,15 +39,9 @@ byte* CPU::ftoi(byte* addr) {
     bool casted_object_ref, destination_register_ref;
     int casted_object_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    casted_object_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    casted_object_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, casted_object_ref, casted_object_index);
 
     if (casted_object_ref) {
         casted_object_index = static_cast<Integer*>(fetch(casted_object_index))->value();
@@ -72,15 +61,9 @@ byte* CPU::stoi(byte* addr) {
     bool casted_object_ref, destination_register_ref;
     int casted_object_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    casted_object_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    casted_object_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, casted_object_ref, casted_object_index);
 
     if (casted_object_ref) {
         casted_object_index = static_cast<Integer*>(fetch(casted_object_index))->value();
@@ -89,7 +72,7 @@ byte* CPU::stoi(byte* addr) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
     }
 
-    place(destination_register_index, new Integer(std::stoi(static_cast<String*>(fetch(casted_object_index))->value())));
+    place(destination_register_index, new Integer(static_cast<String*>(fetch(casted_object_index))->toint()));
 
     return addr;
 }
@@ -100,15 +83,9 @@ byte* CPU::stof(byte* addr) {
     bool casted_object_ref, destination_register_ref;
     int casted_object_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    casted_object_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    casted_object_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, casted_object_ref, casted_object_index);
 
     if (casted_object_ref) {
         casted_object_index = static_cast<Integer*>(fetch(casted_object_index))->value();
@@ -117,7 +94,7 @@ byte* CPU::stof(byte* addr) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
     }
 
-    place(destination_register_index, new Float(std::stod(static_cast<String*>(fetch(casted_object_index))->value())));
+    place(destination_register_index, new Float(static_cast<String*>(fetch(casted_object_index))->tofloat()));
 
     return addr;
 }
@@ -7,6 +7,7 @@
 #include <viua/support/pointer.h>
 #include <viua/exceptions.h>
 #include <viua/cpu/registerset.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -22,10 +23,8 @@ byte* CPU::clbind(byte* addr) {
     int a;
     bool ref = false;
 
-    ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    a = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, ref, a);
 
     if (ref) {
         a = static_cast<Integer*>(fetch(a))->value();
@@ -42,10 +41,8 @@ byte* CPU::closure(byte* addr) {
     int reg;
     bool reg_ref;
 
-    reg_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    reg = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, reg_ref, reg);
 
     string call_name = string(addr);
     addr += (call_name.size()+1);
@@ -92,10 +89,8 @@ byte* CPU::function(byte* addr) {
     int reg;
     bool reg_ref;
 
-    reg_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    reg = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, reg_ref, reg);
 
     string call_name = string(addr);
     addr += (call_name.size()+1);
@@ -118,15 +113,9 @@ byte* CPU::fcall(byte* addr) {
     int fn_reg, return_value_reg;
     bool fn_reg_ref, return_value_ref;
 
-    return_value_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    return_value_reg = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    fn_reg_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    fn_reg = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, return_value_ref, return_value_reg);
+    operands::getint(addr, operand_mode, fn_reg_ref, fn_reg);
 
     if (fn_reg_ref) {
         fn_reg = static_cast<Integer*>(fetch(fn_reg))->value();
@@ -136,7 +125,7 @@ byte* CPU::fcall(byte* addr) {
     Function* fn = static_cast<Function*>(fetch(fn_reg));
 
     string call_name = fn->name();
-    bool function_found = (function_addresses.count(call_name) or linked_functions.count(call_name));
+    bool function_found = resolvefunction(call_name);
 
     if (not function_found) {
         throw new Exception("fcall to undefined function: " + call_name);
@@ -145,10 +134,8 @@ byte* CPU::fcall(byte* addr) {
     byte* call_address = 0;
     if (function_addresses.count(call_name)) {
         call_address = bytecode+function_addresses.at(call_name);
-        jump_base = bytecode;
     } else {
         call_address = linked_functions.at(call_name).second;
-        jump_base = linked_modules.at(linked_functions.at(call_name).first).second;
     }
 
     // save return address for frame
@@ -1,34 +1,34 @@
 #include <iostream>
+#include <functional>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/types/type.h>
 #include <viua/types/boolean.h>
 #include <viua/types/integer.h>
 #include <viua/types/float.h>
 #include <viua/support/pointer.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
 
 byte* CPU::fstore(byte* addr) {
-    /*  Run istore instruction.
+    /*  Run fstore instruction.
+     *
+     *  Value of the float is taken from constant pool.
      */
-    int destination_register_index;
-    float value;
-    bool destination_register_ref = false;
+    byte* instruction_addr = addr;
+    int destination_register_index, index;
+    bool destination_register_ref = false, index_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    value = *((float*)addr);
-    pointer::inc<float, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, index_ref, index);
 
     if (destination_register_ref) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
     }
 
-    place(destination_register_index, new Float(value));
+    place(destination_register_index, constant(instruction_addr, index, CONSTANT_FLOAT)->copy());
 
     return addr;
 }
@@ -39,20 +39,10 @@ byte* CPU::fadd(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -79,20 +69,10 @@ byte* CPU::fsub(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -119,20 +99,10 @@ byte* CPU::fmul(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -159,20 +129,10 @@ byte* CPU::fdiv(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -199,20 +159,10 @@ byte* CPU::flt(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -239,20 +189,10 @@ byte* CPU::flte(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -279,20 +219,10 @@ byte* CPU::fgt(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -319,20 +249,10 @@ byte* CPU::fgte(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -359,20 +279,10 @@ byte* CPU::feq(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_index, second_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -392,3 +302,85 @@ byte* CPU::feq(byte* addr) {
 
     return addr;
 }
+
+template<class Result, class Operation> byte* CPU::floatImmediate(byte* addr, Operation operation) {
+    /** Run float instruction with immediate second operand.
+     *
+     *  Immediate is stored inline, after the register operands.
+     */
+    bool destination_register_ref, operand_ref;
+    int destination_register_index, operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, operand_ref, operand_index);
+    float immediate = *(float*)addr;
+    pointer::inc<float, byte>(addr);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (operand_ref) {
+        operand_index = static_cast<Integer*>(fetch(operand_index))->value();
+    }
+
+    float a = static_cast<Float*>(fetch(operand_index))->value();
+
+    place(destination_register_index, new Result(operation(a, immediate)));
+
+    return addr;
+}
+
+byte* CPU::faddi(byte* addr) {
+    /*  Run faddi instruction.
+     */
+    return floatImmediate<Float>(addr, plus<float>());
+}
+
+byte* CPU::fsubi(byte* addr) {
+    /*  Run fsubi instruction.
+     */
+    return floatImmediate<Float>(addr, minus<float>());
+}
+
+byte* CPU::fmuli(byte* addr) {
+    /*  Run fmuli instruction.
+     */
+    return floatImmediate<Float>(addr, multiplies<float>());
+}
+
+byte* CPU::fdivi(byte* addr) {
+    /*  Run fdivi instruction.
+     */
+    return floatImmediate<Float>(addr, divides<float>());
+}
+
+byte* CPU::flti(byte* addr) {
+    /*  Run flti instruction.
+     */
+    return floatImmediate<Boolean>(addr, less<float>());
+}
+
+byte* CPU::fltei(byte* addr) {
+    /*  Run fltei instruction.
+     */
+    return floatImmediate<Boolean>(addr, less_equal<float>());
+}
+
+byte* CPU::fgti(byte* addr) {
+    /*  Run fgti instruction.
+     */
+    return floatImmediate<Boolean>(addr, greater<float>());
+}
+
+byte* CPU::fgtei(byte* addr) {
+    /*  Run fgtei instruction.
+     */
+    return floatImmediate<Boolean>(addr, greater_equal<float>());
+}
+
+byte* CPU::feqi(byte* addr) {
+    /*  Run feqi instruction.
+     */
+    return floatImmediate<Boolean>(addr, equal_to<float>());
+}
@@ -2,6 +2,7 @@
 #include <viua/types/boolean.h>
 #include <viua/support/pointer.h>
 #include <viua/exceptions.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -12,11 +13,8 @@ byte* CPU::echo(byte* addr) {
     bool ref = false;
     int operand_index;
 
-    ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-
-    operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, ref, operand_index);
 
     if (ref) {
         operand_index = static_cast<Integer*>(fetch(operand_index))->value();
@@ -38,25 +36,29 @@ byte* CPU::print(byte* addr) {
 
 byte* CPU::jump(byte* addr) {
     /*  Run jump instruction.
+     *
+     *  Jump targets are relative to the jump instruction itself so
+     *  the bytecode works unmodified at whatever address it is loaded.
      */
-    byte* target = jump_base+(*(int*)addr);
-    if (target == addr) {
+    int offset = *(int*)addr;
+    if (offset == 0) {
         throw new Exception("aborting: JUMP instruction pointing to itself");
     }
-    return target;
+    return ((addr-1) + offset);
 }
 
 byte* CPU::branch(byte* addr) {
     /*  Run branch instruction.
+     *
+     *  Branch targets are relative to the branch instruction itself.
      */
+    byte* instruction_address = (addr-1);
+
     bool condition_object_ref;
     int condition_object_index;
 
-    condition_object_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-
-    condition_object_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, condition_object_ref, condition_object_index);
 
     int addr_true = *((int*)addr);
     pointer::inc<int, byte>(addr);
@@ -70,7 +72,7 @@ byte* CPU::branch(byte* addr) {
 
     bool result = fetch(condition_object_index)->boolean();
 
-    addr = jump_base + (result ? addr_true : addr_false);
+    addr = instruction_address + (result ? addr_true : addr_false);
 
     return addr;
 }
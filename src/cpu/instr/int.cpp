@@ -1,3 +1,5 @@
+#include <functional>
+#include <typeinfo>
 #include <viua/bytecode/bytetypedef.h>
 #include <viua/types/type.h>
 #include <viua/types/integer.h>
@@ -5,7 +7,9 @@
 #include <viua/types/byte.h>
 #include <viua/types/casts/integer.h>
 #include <viua/support/pointer.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
+#include <viua/cpu/registerset.h>
 using namespace std;
 
 
@@ -15,10 +19,8 @@ byte* CPU::izero(byte* addr) {
     int destination_register;
     bool destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register);
 
     if (destination_register_ref) {
         destination_register = static_cast<Integer*>(fetch(destination_register))->value();
@@ -35,15 +37,9 @@ byte* CPU::istore(byte* addr) {
     int destination_register, operand;
     bool destination_register_ref = false, operand_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    operand = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register);
+    operands::getint(addr, operand_mode, operand_ref, operand);
 
     if (destination_register_ref) {
         destination_register = static_cast<Integer*>(fetch(destination_register))->value();
@@ -63,20 +59,10 @@ byte* CPU::iadd(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -102,20 +88,10 @@ byte* CPU::isub(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -141,20 +117,10 @@ byte* CPU::imul(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -180,20 +146,10 @@ byte* CPU::idiv(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -219,20 +175,10 @@ byte* CPU::ilt(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -258,20 +204,10 @@ byte* CPU::ilte(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -297,20 +233,10 @@ byte* CPU::igt(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -336,20 +262,10 @@ byte* CPU::igte(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -375,20 +291,10 @@ byte* CPU::ieq(byte* addr) {
     bool first_operand_ref, second_operand_ref, destination_register_ref;
     int first_operand_num, second_operand_num, destination_register_num;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_num = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_num);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_num);
 
     if (first_operand_ref) {
         first_operand_num = static_cast<Integer*>(fetch(first_operand_num))->value();
@@ -408,17 +314,245 @@ byte* CPU::ieq(byte* addr) {
     return addr;
 }
 
+template<class Result, class Operation> byte* CPU::integerImmediate(byte* addr, Operation operation) {
+    /** Run integer instruction with immediate second operand.
+     *
+     *  Immediate is encoded as an integer operand, so it may also be taken from a register with `@`.
+     */
+    bool destination_register_ref, operand_ref, immediate_ref;
+    int destination_register_num, operand_num, immediate;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_num);
+    operands::getint(addr, operand_mode, operand_ref, operand_num);
+    operands::getint(addr, operand_mode, immediate_ref, immediate);
+
+    if (destination_register_ref) {
+        destination_register_num = static_cast<Integer*>(fetch(destination_register_num))->value();
+    }
+    if (operand_ref) {
+        operand_num = static_cast<Integer*>(fetch(operand_num))->value();
+    }
+    if (immediate_ref) {
+        immediate = static_cast<Integer*>(fetch(immediate))->value();
+    }
+
+    operand_num = static_cast<IntegerCast*>(fetch(operand_num))->as_integer();
+
+    place(destination_register_num, new Result(operation(operand_num, immediate)));
+
+    return addr;
+}
+
+byte* CPU::iaddi(byte* addr) {
+    /*  Run iaddi instruction.
+     */
+    return integerImmediate<Integer>(addr, plus<int>());
+}
+
+byte* CPU::isubi(byte* addr) {
+    /*  Run isubi instruction.
+     */
+    return integerImmediate<Integer>(addr, minus<int>());
+}
+
+byte* CPU::imuli(byte* addr) {
+    /*  Run imuli instruction.
+     */
+    return integerImmediate<Integer>(addr, multiplies<int>());
+}
+
+byte* CPU::idivi(byte* addr) {
+    /*  Run idivi instruction.
+     */
+    return integerImmediate<Integer>(addr, divides<int>());
+}
+
+byte* CPU::ilti(byte* addr) {
+    /*  Run ilti instruction.
+     */
+    return integerImmediate<Boolean>(addr, less<int>());
+}
+
+byte* CPU::iltei(byte* addr) {
+    /*  Run iltei instruction.
+     */
+    return integerImmediate<Boolean>(addr, less_equal<int>());
+}
+
+byte* CPU::igti(byte* addr) {
+    /*  Run igti instruction.
+     */
+    return integerImmediate<Boolean>(addr, greater<int>());
+}
+
+byte* CPU::igtei(byte* addr) {
+    /*  Run igtei instruction.
+     */
+    return integerImmediate<Boolean>(addr, greater_equal<int>());
+}
+
+byte* CPU::ieqi(byte* addr) {
+    /*  Run ieqi instruction.
+     */
+    return integerImmediate<Boolean>(addr, equal_to<int>());
+}
+
+template<class Result, class Operation> byte* CPU::typedInteger(byte* addr, bool guarded, Operation operation, byte* (CPU::*generic)(byte*)) {
+    /** Run integer instruction specialised by assembler.
+     *
+     *  Assembler emits these only for results going to registers that are never referenced, so
+     *  references are not updated here.
+     *  Operands of unguarded variants are known to be integers.
+     *  Guarded variants check that, and use the generic conversion for operands of other types.
+     *
+     *  Specialised instructions may also be written by hand, and
+     *  those taking operands from other registers (`@` indirection) are run by the generic instruction.
+     */
+    const byte any_ref = (OPERAND_REF | (OPERAND_REF << OPERAND_MODE_BITS) | (OPERAND_REF << (2*OPERAND_MODE_BITS)));
+    if (*addr & any_ref) {
+        return (this->*generic)(addr);
+    }
+
+    bool ref = false;
+    int destination_register_num, first_operand_num, second_operand_num;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, ref, destination_register_num);
+    operands::getint(addr, operand_mode, ref, first_operand_num);
+    operands::getint(addr, operand_mode, ref, second_operand_num);
+
+    Type* first = uregset->get(first_operand_num);
+    Type* second = uregset->get(second_operand_num);
+    if (guarded and not (typeid(*first) == typeid(Integer) and typeid(*second) == typeid(Integer))) {
+        first_operand_num = static_cast<IntegerCast*>(first)->as_integer();
+        second_operand_num = static_cast<IntegerCast*>(second)->as_integer();
+    } else {
+        first_operand_num = static_cast<Integer*>(first)->value();
+        second_operand_num = static_cast<Integer*>(second)->value();
+    }
+
+    uregset->set(destination_register_num, new Result(operation(first_operand_num, second_operand_num)));
+
+    return addr;
+}
+
+byte* CPU::tiadd(byte* addr) {
+    /*  Run tiadd instruction.
+     */
+    return typedInteger<Integer>(addr, false, plus<int>(), &CPU::iadd);
+}
+
+byte* CPU::tisub(byte* addr) {
+    /*  Run tisub instruction.
+     */
+    return typedInteger<Integer>(addr, false, minus<int>(), &CPU::isub);
+}
+
+byte* CPU::timul(byte* addr) {
+    /*  Run timul instruction.
+     */
+    return typedInteger<Integer>(addr, false, multiplies<int>(), &CPU::imul);
+}
+
+byte* CPU::tidiv(byte* addr) {
+    /*  Run tidiv instruction.
+     */
+    return typedInteger<Integer>(addr, false, divides<int>(), &CPU::idiv);
+}
+
+byte* CPU::tilt(byte* addr) {
+    /*  Run tilt instruction.
+     */
+    return typedInteger<Boolean>(addr, false, less<int>(), &CPU::ilt);
+}
+
+byte* CPU::tilte(byte* addr) {
+    /*  Run tilte instruction.
+     */
+    return typedInteger<Boolean>(addr, false, less_equal<int>(), &CPU::ilte);
+}
+
+byte* CPU::tigt(byte* addr) {
+    /*  Run tigt instruction.
+     */
+    return typedInteger<Boolean>(addr, false, greater<int>(), &CPU::igt);
+}
+
+byte* CPU::tigte(byte* addr) {
+    /*  Run tigte instruction.
+     */
+    return typedInteger<Boolean>(addr, false, greater_equal<int>(), &CPU::igte);
+}
+
+byte* CPU::tieq(byte* addr) {
+    /*  Run tieq instruction.
+     */
+    return typedInteger<Boolean>(addr, false, equal_to<int>(), &CPU::ieq);
+}
+
+byte* CPU::giadd(byte* addr) {
+    /*  Run giadd instruction.
+     */
+    return typedInteger<Integer>(addr, true, plus<int>(), &CPU::iadd);
+}
+
+byte* CPU::gisub(byte* addr) {
+    /*  Run gisub instruction.
+     */
+    return typedInteger<Integer>(addr, true, minus<int>(), &CPU::isub);
+}
+
+byte* CPU::gimul(byte* addr) {
+    /*  Run gimul instruction.
+     */
+    return typedInteger<Integer>(addr, true, multiplies<int>(), &CPU::imul);
+}
+
+byte* CPU::gidiv(byte* addr) {
+    /*  Run gidiv instruction.
+     */
+    return typedInteger<Integer>(addr, true, divides<int>(), &CPU::idiv);
+}
+
+byte* CPU::gilt(byte* addr) {
+    /*  Run gilt instruction.
+     */
+    return typedInteger<Boolean>(addr, true, less<int>(), &CPU::ilt);
+}
+
+byte* CPU::gilte(byte* addr) {
+    /*  Run gilte instruction.
+     */
+    return typedInteger<Boolean>(addr, true, less_equal<int>(), &CPU::ilte);
+}
+
+byte* CPU::gigt(byte* addr) {
+    /*  Run gigt instruction.
+     */
+    return typedInteger<Boolean>(addr, true, greater<int>(), &CPU::igt);
+}
+
+byte* CPU::gigte(byte* addr) {
+    /*  Run gigte instruction.
+     */
+    return typedInteger<Boolean>(addr, true, greater_equal<int>(), &CPU::igte);
+}
+
+byte* CPU::gieq(byte* addr) {
+    /*  Run gieq instruction.
+     */
+    return typedInteger<Boolean>(addr, true, equal_to<int>(), &CPU::ieq);
+}
+
 byte* CPU::iinc(byte* addr) {
     /*  Run iinc instruction.
      */
     bool ref = false;
     int target_register;
 
-    ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-
-    target_register = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, ref, target_register);
 
     if (ref) {
         target_register = static_cast<Integer*>(fetch(target_register))->value();
@@ -435,11 +569,8 @@ byte* CPU::idec(byte* addr) {
     bool ref = false;
     int target_register;
 
-    ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-
-    target_register = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, ref, target_register);
 
     if (ref) {
         target_register = static_cast<Integer*>(fetch(target_register))->value();
@@ -7,6 +7,7 @@
 #include <viua/include/module.h>
 #include <viua/exceptions.h>
 #include <viua/loader.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -55,11 +56,11 @@ byte* CPU::eximport(byte* addr) {
 byte* CPU::excall(byte* addr) {
     /** Run excall instruction.
      */
-    bool return_register_ref = *(bool*)addr;
-    pointer::inc<bool, byte>(addr);
+    bool return_register_ref;
+    int return_register_index;
 
-    int return_register_index = *(int*)addr;
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, return_register_ref, return_register_index);
 
     string call_name = string(addr);
     addr += (call_name.size()+1);
@@ -164,24 +165,45 @@ byte* CPU::link(byte* addr) {
 
     if (found) {
         Loader loader(path);
-        loader.load();
-
-        byte* lnk_btcd = loader.getBytecode();
+        loader.useMmap().load();
+
+        byte* lnk_btcd = 0;
+        if (loader.isMapped()) {
+            // mapped module is used in place and is never modified so its pages can be shared
+            void* image = 0;
+            std::size_t image_size = 0;
+            lnk_btcd = loader.getBytecodeInPlace();
+            tie(image, image_size) = loader.detachImage();
+            mapimage(lnk_btcd, image, image_size);
+        } else {
+            lnk_btcd = loader.getBytecode();
+        }
         linked_modules[module] = pair<unsigned, byte*>(unsigned(loader.getBytecodeSize()), lnk_btcd);
+        constpool(lnk_btcd, loader.getBytecodeSize(), loader.getConstantPool());
+
+        if (loader.isMapped() and loader.hasSymbolTable()) {
+            // symbol table lives in the mapped image so functions and blocks can be looked up when first used
+            SymbolTable symbol_table = loader.getSymbolTable();
+            linked_symbol_tables.push_back(pair<string, SymbolTable>(module, symbol_table));
+            module_statistics[module] = tuple<unsigned, unsigned, unsigned, unsigned>(0, symbol_table.count(SYMBOL_FUNCTION), 0, symbol_table.count(SYMBOL_BLOCK));
+            module_boundaries[module] = symbol_table.addresses();
+            return addr;
+        }
 
         vector<string> fn_names = loader.getFunctions();
-        map<string, uint16_t> fn_addrs = loader.getFunctionAddresses();
+        map<string, bytecode_size_type> fn_addrs = loader.getFunctionAddresses();
         for (unsigned i = 0; i < fn_names.size(); ++i) {
             string fn_linkname = fn_names[i];
             linked_functions[fn_linkname] = pair<string, byte*>(module, (lnk_btcd+fn_addrs[fn_names[i]]));
         }
 
         vector<string> bl_names = loader.getBlocks();
-        map<string, uint16_t> bl_addrs = loader.getBlockAddresses();
+        map<string, bytecode_size_type> bl_addrs = loader.getBlockAddresses();
         for (unsigned i = 0; i < bl_names.size(); ++i) {
             string bl_linkname = bl_names[i];
             linked_blocks[bl_linkname] = pair<string, byte*>(module, (lnk_btcd+bl_addrs[bl_linkname]));
         }
+        module_statistics[module] = tuple<unsigned, unsigned, unsigned, unsigned>(fn_names.size(), fn_names.size(), bl_names.size(), bl_names.size());
     } else {
         throw new Exception("failed to link: " + module);
     }
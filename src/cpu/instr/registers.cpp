@@ -2,6 +2,7 @@
 #include <viua/types/boolean.h>
 #include <viua/support/pointer.h>
 #include <viua/exceptions.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -13,15 +14,9 @@ byte* CPU::move(byte* addr) {
     int object_operand_index, destination_register_index;
     bool object_operand_ref = false, destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (object_operand_ref) {
         object_operand_index = static_cast<Integer*>(fetch(object_operand_index))->value();
@@ -40,15 +35,9 @@ byte* CPU::copy(byte* addr) {
     int object_operand_index, destination_register_index;
     bool object_operand_ref = false, destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (object_operand_ref) {
         object_operand_index = static_cast<Integer*>(fetch(object_operand_index))->value();
@@ -69,15 +58,9 @@ byte* CPU::ref(byte* addr) {
     int object_operand_index, destination_register_index;
     bool object_operand_ref = false, destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (object_operand_ref) {
         object_operand_index = static_cast<Integer*>(fetch(object_operand_index))->value();
@@ -98,15 +81,9 @@ byte* CPU::swap(byte* addr) {
     int first_operand_index, second_operand_index;
     bool first_operand_ref = false, second_operand_ref = false;
 
-    first_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    first_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    second_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    second_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
 
     if (first_operand_ref) {
         first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
@@ -124,10 +101,8 @@ byte* CPU::free(byte* addr) {
     int target_register_index;
     bool target_register_ref = false;
 
-    target_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    target_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, target_register_ref, target_register_index);
 
     if (target_register_ref) {
         target_register_index = static_cast<Integer*>(fetch(target_register_index))->value();
@@ -143,10 +118,8 @@ byte* CPU::empty(byte* addr) {
     int target_register_index;
     bool target_register_ref = false;
 
-    target_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    target_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, target_register_ref, target_register_index);
 
     if (target_register_ref) {
         target_register_index = static_cast<Integer*>(fetch(target_register_index))->value();
@@ -168,15 +141,9 @@ byte* CPU::isnull(byte* addr) {
     int checked_register_index, destination_register_index;
     bool checked_register_ref = false, destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    checked_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    checked_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, checked_register_ref, checked_register_index);
 
     if (checked_register_ref) {
         checked_register_index = static_cast<Integer*>(fetch(checked_register_index))->value();
@@ -223,10 +190,8 @@ byte* CPU::tmpri(byte* addr) {
     int object_operand_index;
     bool object_operand_ref = false;
 
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (object_operand_ref) {
         object_operand_index = static_cast<Integer*>(fetch(object_operand_index))->value();
@@ -245,10 +210,8 @@ byte* CPU::tmpro(byte* addr) {
     int destination_register_index;
     bool destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
 
     if (destination_register_ref) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
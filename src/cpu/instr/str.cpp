@@ -4,32 +4,395 @@
 #include <viua/types/integer.h>
 #include <viua/types/boolean.h>
 #include <viua/types/byte.h>
+#include <viua/types/vector.h>
 #include <viua/types/string.h>
+#include <viua/types/stringbuilder.h>
+#include <viua/types/atom.h>
+#include <viua/types/exception.h>
 #include <viua/support/pointer.h>
 #include <viua/support/string.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
 
 byte* CPU::strstore(byte* addr) {
     /*  Run strstore instruction.
+     *
+     *  Text of the string is taken from constant pool.
+     *  Created string is interned - it shares its text with the CPU string pool.
+     */
+    byte* instruction_addr = addr;
+    int reg, index;
+    bool reg_ref = false, index_ref = false;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, reg_ref, reg);
+    operands::getint(addr, operand_mode, index_ref, index);
+
+    if (reg_ref) {
+        reg = static_cast<Integer*>(fetch(reg))->value();
+    }
+
+    place(reg, constant(instruction_addr, index, CONSTANT_STRING)->copy());
+
+    return addr;
+}
+
+byte* CPU::streq(byte* addr) {
+    /*  Run streq instruction.
+     */
+    bool first_operand_ref, second_operand_ref, destination_register_ref;
+    int first_operand_index, second_operand_index, destination_register_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (first_operand_ref) {
+        first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
+    }
+    if (second_operand_ref) {
+        second_operand_index = static_cast<Integer*>(fetch(second_operand_index))->value();
+    }
+
+    String* first = static_cast<String*>(fetch(first_operand_index));
+    String* second = static_cast<String*>(fetch(second_operand_index));
+
+    place(destination_register_index, new Boolean(first->equals(second)));
+
+    return addr;
+}
+
+byte* CPU::strbuild(byte* addr) {
+    /*  Run strbuild instruction.
+     *
+     *  Puts empty StringBuilder in a register.
      */
     int reg;
     bool reg_ref = false;
 
-    reg_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    reg = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, reg_ref, reg);
+
+    if (reg_ref) {
+        reg = static_cast<Integer*>(fetch(reg))->value();
+    }
+
+    place(reg, new StringBuilder());
+
+    return addr;
+}
+
+byte* CPU::strappend(byte* addr) {
+    /*  Run strappend instruction.
+     *
+     *  Appends string representation of an object to a StringBuilder.
+     */
+    int builder_index, object_index;
+    bool builder_ref = false, object_ref = false;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, builder_ref, builder_index);
+    operands::getint(addr, operand_mode, object_ref, object_index);
+
+    if (builder_ref) {
+        builder_index = static_cast<Integer*>(fetch(builder_index))->value();
+    }
+    if (object_ref) {
+        object_index = static_cast<Integer*>(fetch(object_index))->value();
+    }
+
+    static_cast<StringBuilder*>(fetch(builder_index))->append(fetch(object_index));
+
+    return addr;
+}
+
+byte* CPU::strappendr(byte* addr) {
+    /*  Run strappendr instruction.
+     *
+     *  Appends repr of an object to a StringBuilder.
+     */
+    int builder_index, object_index;
+    bool builder_ref = false, object_ref = false;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, builder_ref, builder_index);
+    operands::getint(addr, operand_mode, object_ref, object_index);
+
+    if (builder_ref) {
+        builder_index = static_cast<Integer*>(fetch(builder_index))->value();
+    }
+    if (object_ref) {
+        object_index = static_cast<Integer*>(fetch(object_index))->value();
+    }
+
+    static_cast<StringBuilder*>(fetch(builder_index))->appendrepr(fetch(object_index));
+
+    return addr;
+}
+
+byte* CPU::strfinal(byte* addr) {
+    /*  Run strfinal instruction.
+     *
+     *  Creates flat String from contents of a StringBuilder.
+     */
+    int destination_register_index, builder_index;
+    bool destination_register_ref = false, builder_ref = false;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, builder_ref, builder_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (builder_ref) {
+        builder_index = static_cast<Integer*>(fetch(builder_index))->value();
+    }
+
+    place(destination_register_index, static_cast<StringBuilder*>(fetch(builder_index))->finalize());
+
+    return addr;
+}
+
+byte* CPU::strlen(byte* addr) {
+    /*  Run strlen instruction.
+     */
+    bool destination_register_ref, string_operand_ref;
+    int destination_register_index, string_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, string_operand_ref, string_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (string_operand_ref) {
+        string_operand_index = static_cast<Integer*>(fetch(string_operand_index))->value();
+    }
+
+    place(destination_register_index, static_cast<String*>(fetch(string_operand_index))->size());
+
+    return addr;
+}
+
+byte* CPU::stradd(byte* addr) {
+    /*  Run stradd instruction.
+     *
+     *  Creates new string being a concatenation of two strings.
+     */
+    bool destination_register_ref, first_operand_ref, second_operand_ref;
+    int destination_register_index, first_operand_index, second_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (first_operand_ref) {
+        first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
+    }
+    if (second_operand_ref) {
+        second_operand_index = static_cast<Integer*>(fetch(second_operand_index))->value();
+    }
+
+    String* first = static_cast<String*>(fetch(first_operand_index));
+    String* second = static_cast<String*>(fetch(second_operand_index));
 
-    string svalue = string(addr);
-    addr += svalue.size()+1;
+    place(destination_register_index, first->concat(second));
+
+    return addr;
+}
+
+byte* CPU::strsub(byte* addr) {
+    /*  Run strsub instruction.
+     *
+     *  Extracts substring in [begin, end) range.
+     *  Negative end is counted from the end of the string (-1 is the end).
+     */
+    bool destination_register_ref, string_operand_ref, begin_operand_ref, end_operand_ref;
+    int destination_register_index, string_operand_index, begin_operand_index, end_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, string_operand_ref, string_operand_index);
+    operands::getint(addr, operand_mode, begin_operand_ref, begin_operand_index);
+    operands::getint(addr, operand_mode, end_operand_ref, end_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (string_operand_ref) {
+        string_operand_index = static_cast<Integer*>(fetch(string_operand_index))->value();
+    }
+    if (begin_operand_ref) {
+        begin_operand_index = static_cast<Integer*>(fetch(begin_operand_index))->value();
+    }
+    if (end_operand_ref) {
+        end_operand_index = static_cast<Integer*>(fetch(end_operand_index))->value();
+    }
+
+    place(destination_register_index, static_cast<String*>(fetch(string_operand_index))->sub(begin_operand_index, end_operand_index));
+
+    return addr;
+}
+
+byte* CPU::strfind(byte* addr) {
+    /*  Run strfind instruction.
+     *
+     *  Stores index of first occurence of needle in haystack, or -1.
+     */
+    bool destination_register_ref, haystack_operand_ref, needle_operand_ref;
+    int destination_register_index, haystack_operand_index, needle_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, haystack_operand_ref, haystack_operand_index);
+    operands::getint(addr, operand_mode, needle_operand_ref, needle_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (haystack_operand_ref) {
+        haystack_operand_index = static_cast<Integer*>(fetch(haystack_operand_index))->value();
+    }
+    if (needle_operand_ref) {
+        needle_operand_index = static_cast<Integer*>(fetch(needle_operand_index))->value();
+    }
+
+    String* haystack = static_cast<String*>(fetch(haystack_operand_index));
+    String* needle = static_cast<String*>(fetch(needle_operand_index));
+
+    place(destination_register_index, haystack->find(needle));
+
+    return addr;
+}
+
+byte* CPU::strcmp(byte* addr) {
+    /*  Run strcmp instruction.
+     *
+     *  Stores -1, 0 or 1 depending on ordering of the two strings.
+     */
+    bool destination_register_ref, first_operand_ref, second_operand_ref;
+    int destination_register_index, first_operand_index, second_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, first_operand_ref, first_operand_index);
+    operands::getint(addr, operand_mode, second_operand_ref, second_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (first_operand_ref) {
+        first_operand_index = static_cast<Integer*>(fetch(first_operand_index))->value();
+    }
+    if (second_operand_ref) {
+        second_operand_index = static_cast<Integer*>(fetch(second_operand_index))->value();
+    }
+
+    String* first = static_cast<String*>(fetch(first_operand_index));
+    String* second = static_cast<String*>(fetch(second_operand_index));
+
+    place(destination_register_index, first->compare(second));
+
+    return addr;
+}
+
+byte* CPU::strsplit(byte* addr) {
+    /*  Run strsplit instruction.
+     *
+     *  Splits a string on every occurence of separator and
+     *  stores a vector of the parts.
+     */
+    bool destination_register_ref, string_operand_ref, separator_operand_ref;
+    int destination_register_index, string_operand_index, separator_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, string_operand_ref, string_operand_index);
+    operands::getint(addr, operand_mode, separator_operand_ref, separator_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (string_operand_ref) {
+        string_operand_index = static_cast<Integer*>(fetch(string_operand_index))->value();
+    }
+    if (separator_operand_ref) {
+        separator_operand_index = static_cast<Integer*>(fetch(separator_operand_index))->value();
+    }
+
+    String* s = static_cast<String*>(fetch(string_operand_index));
+    String* separator = static_cast<String*>(fetch(separator_operand_index));
+
+    place(destination_register_index, s->split(separator));
+
+    return addr;
+}
+
+byte* CPU::atom(byte* addr) {
+    /*  Run atom instruction.
+     *
+     *  Atom name is taken from constant pool, and is looked up in the CPU symbol table so that
+     *  every atom with the same name points to the same symbol.
+     */
+    byte* instruction_addr = addr;
+    int reg, index;
+    bool reg_ref = false, index_ref = false;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, reg_ref, reg);
+    operands::getint(addr, operand_mode, index_ref, index);
 
     if (reg_ref) {
         reg = static_cast<Integer*>(fetch(reg))->value();
     }
 
-    place(reg, new String(svalue));
+    place(reg, constant(instruction_addr, index, CONSTANT_ATOM)->copy());
+
+    return addr;
+}
+
+byte* CPU::atomeq(byte* addr) {
+    /*  Run atomeq instruction.
+     *
+     *  Atoms are compared by identity of their symbols, not by their names.
+     */
+    bool destination_register_ref, lhs_ref, rhs_ref;
+    int destination_register_index, lhs_index, rhs_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, lhs_ref, lhs_index);
+    operands::getint(addr, operand_mode, rhs_ref, rhs_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (lhs_ref) {
+        lhs_index = static_cast<Integer*>(fetch(lhs_index))->value();
+    }
+    if (rhs_ref) {
+        rhs_index = static_cast<Integer*>(fetch(rhs_index))->value();
+    }
+
+    Type* lhs = fetch(lhs_index);
+    Type* rhs = fetch(rhs_index);
+    if (lhs->type() != "Atom" or rhs->type() != "Atom") {
+        throw new Exception("atomeq: expected two atoms, got " + lhs->type() + " and " + rhs->type());
+    }
+
+    place(destination_register_index, new Boolean(static_cast<Atom*>(lhs)->equals(static_cast<Atom*>(rhs))));
 
     return addr;
 }
@@ -1,6 +1,7 @@
 #include <viua/types/integer.h>
 #include <viua/support/pointer.h>
 #include <viua/exceptions.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -24,7 +25,7 @@ byte* CPU::vmcatch(byte* addr) {
     string catcher_block_name = string(addr);
     addr += (catcher_block_name.size()+1);
 
-    bool block_found = (block_addresses.count(catcher_block_name) or linked_blocks.count(catcher_block_name));
+    bool block_found = resolveblock(catcher_block_name);
     if (not block_found) {
         throw new Exception("registering undefined handler block: " + catcher_block_name);
     }
@@ -32,10 +33,8 @@ byte* CPU::vmcatch(byte* addr) {
     byte* block_address = 0;
     if (block_addresses.count(catcher_block_name)) {
         block_address = bytecode+block_addresses.at(catcher_block_name);
-        jump_base = bytecode;
     } else {
         block_address = linked_blocks.at(catcher_block_name).second;
-        jump_base = linked_modules.at(linked_blocks.at(catcher_block_name).first).second;
     }
 
     try_frame_new->catchers[type_name] = new Catcher(type_name, catcher_block_name, block_address);
@@ -49,10 +48,8 @@ byte* CPU::pull(byte* addr) {
     int destination_register_index;
     bool destination_register_ref = false;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
 
     if (destination_register_ref) {
         destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
@@ -72,7 +69,7 @@ byte* CPU::vmtry(byte* addr) {
      */
     string block_name = string(addr);
 
-    bool block_found = (block_addresses.count(block_name) or linked_blocks.count(block_name));
+    bool block_found = resolveblock(block_name);
     if (not block_found) {
         throw new Exception("try of undefined block: " + block_name);
     }
@@ -80,10 +77,8 @@ byte* CPU::vmtry(byte* addr) {
     byte* block_address = 0;
     if (block_addresses.count(block_name)) {
         block_address = bytecode+block_addresses.at(block_name);
-        jump_base = bytecode;
     } else {
         block_address = linked_blocks.at(block_name).second;
-        jump_base = linked_modules.at(linked_blocks.at(block_name).first).second;
     }
 
     try_frame_new->return_address = (addr+block_name.size());
@@ -102,10 +97,8 @@ byte* CPU::vmthrow(byte* addr) {
     int source_register_index;
     bool source_register_ref = false;
 
-    source_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    source_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, source_register_ref, source_register_index);
 
     if (source_register_ref) {
         source_register_index = static_cast<Integer*>(fetch(source_register_index))->value();
@@ -138,12 +131,5 @@ byte* CPU::leave(byte* addr) {
     delete tryframes.back();
     tryframes.pop_back();
 
-    if (frames.size() > 0) {
-        if (function_addresses.count(frames.back()->function_name)) {
-            jump_base = bytecode;
-        } else {
-            jump_base = linked_modules.at(linked_functions.at(frames.back()->function_name).first).second;
-        }
-    }
     return addr;
 }
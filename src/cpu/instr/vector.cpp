@@ -3,8 +3,10 @@
 #include <viua/types/type.h>
 #include <viua/types/integer.h>
 #include <viua/types/vector.h>
+#include <viua/types/vectorview.h>
 #include <viua/support/pointer.h>
 #include <viua/cpu/registerset.h>
+#include <viua/bytecode/operands.h>
 #include <viua/cpu/cpu.h>
 using namespace std;
 
@@ -15,10 +17,8 @@ byte* CPU::vec(byte* addr) {
     bool target_register_ref;
     int target_register_index;
 
-    target_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    target_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, target_register_ref, target_register_index);
 
     if (target_register_ref) {
         target_register_index = static_cast<Integer*>(fetch(target_register_index))->value();
@@ -38,20 +38,10 @@ byte* CPU::vinsert(byte* addr) {
     bool vector_operand_ref, object_operand_ref, position_operand_ref;
     int vector_operand_index, object_operand_index, position_operand_index;
 
-    vector_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    vector_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    position_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    position_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
+    operands::getint(addr, operand_mode, position_operand_ref, position_operand_index);
 
     if (vector_operand_ref) {
         vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
@@ -77,15 +67,9 @@ byte* CPU::vpush(byte* addr) {
     bool vector_operand_ref, object_operand_ref;
     int vector_operand_index, object_operand_index;
 
-    vector_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    vector_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    object_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    object_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
+    operands::getint(addr, operand_mode, object_operand_ref, object_operand_index);
 
     if (vector_operand_ref) {
         vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
@@ -108,20 +92,10 @@ byte* CPU::vpop(byte* addr) {
     bool vector_operand_ref, destination_register_ref, position_operand_ref;
     int vector_operand_index, destination_register_index, position_operand_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    vector_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    vector_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    position_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    position_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
+    operands::getint(addr, operand_mode, position_operand_ref, position_operand_index);
 
     if (vector_operand_ref) {
         vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
@@ -152,20 +126,10 @@ byte* CPU::vat(byte* addr) {
     bool vector_operand_ref, destination_register_ref, position_operand_ref;
     int vector_operand_index, destination_register_index, position_operand_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    vector_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    vector_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    position_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    position_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
+    operands::getint(addr, operand_mode, position_operand_ref, position_operand_index);
 
     if (vector_operand_ref) {
         vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
@@ -194,15 +158,9 @@ byte* CPU::vlen(byte* addr) {
     bool vector_operand_ref, destination_register_ref;
     int vector_operand_index, destination_register_index;
 
-    destination_register_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    destination_register_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
-
-    vector_operand_ref = *((bool*)addr);
-    pointer::inc<bool, byte>(addr);
-    vector_operand_index = *((int*)addr);
-    pointer::inc<int, byte>(addr);
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
 
     if (vector_operand_ref) {
         vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
@@ -215,3 +173,119 @@ byte* CPU::vlen(byte* addr) {
 
     return addr;
 }
+
+byte* CPU::vslice(byte* addr) {
+    /*  Run vslice instruction.
+     *
+     *  Creates a view of a range of a vector (or of another view).
+     *  No elements are copied.
+     */
+    bool destination_register_ref, vector_operand_ref, begin_operand_ref, end_operand_ref;
+    int destination_register_index, vector_operand_index, begin_operand_index, end_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, vector_operand_ref, vector_operand_index);
+    operands::getint(addr, operand_mode, begin_operand_ref, begin_operand_index);
+    operands::getint(addr, operand_mode, end_operand_ref, end_operand_index);
+
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (vector_operand_ref) {
+        vector_operand_index = static_cast<Integer*>(fetch(vector_operand_index))->value();
+    }
+    if (begin_operand_ref) {
+        begin_operand_index = static_cast<Integer*>(fetch(begin_operand_index))->value();
+    }
+    if (end_operand_ref) {
+        end_operand_index = static_cast<Integer*>(fetch(end_operand_index))->value();
+    }
+
+    Type* sliced = fetch(vector_operand_index);
+    VectorView* view = 0;
+    if (sliced->type() == "VectorView") {
+        view = static_cast<VectorView*>(sliced)->slice(begin_operand_index, end_operand_index);
+    } else {
+        view = static_cast<Vector*>(sliced)->view(begin_operand_index, end_operand_index);
+    }
+    place(destination_register_index, view);
+
+    return addr;
+}
+
+byte* CPU::vsat(byte* addr) {
+    /*  Run vsat instruction.
+     *
+     *  Like vat, but for vector views.
+     */
+    bool view_operand_ref, destination_register_ref, position_operand_ref;
+    int view_operand_index, destination_register_index, position_operand_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, view_operand_ref, view_operand_index);
+    operands::getint(addr, operand_mode, position_operand_ref, position_operand_index);
+
+    if (view_operand_ref) {
+        view_operand_index = static_cast<Integer*>(fetch(view_operand_index))->value();
+    }
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+    if (position_operand_ref) {
+        position_operand_index = static_cast<Integer*>(fetch(position_operand_index))->value();
+    }
+
+    Type* ptr = static_cast<VectorView*>(fetch(view_operand_index))->at(position_operand_index);
+    place(destination_register_index, ptr);
+    uregset->flag(destination_register_index, REFERENCE);
+
+    return addr;
+}
+
+byte* CPU::vslen(byte* addr) {
+    /*  Run vslen instruction.
+     */
+    bool view_operand_ref, destination_register_ref;
+    int view_operand_index, destination_register_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, view_operand_ref, view_operand_index);
+
+    if (view_operand_ref) {
+        view_operand_index = static_cast<Integer*>(fetch(view_operand_index))->value();
+    }
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+
+    place(destination_register_index, new Integer(static_cast<VectorView*>(fetch(view_operand_index))->len()));
+
+    return addr;
+}
+
+byte* CPU::vsmat(byte* addr) {
+    /*  Run vsmat instruction.
+     *
+     *  Materializes a view, i.e. creates a Vector with copies of its elements.
+     */
+    bool view_operand_ref, destination_register_ref;
+    int view_operand_index, destination_register_index;
+
+    byte operand_mode = operands::getmode(addr);
+    operands::getint(addr, operand_mode, destination_register_ref, destination_register_index);
+    operands::getint(addr, operand_mode, view_operand_ref, view_operand_index);
+
+    if (view_operand_ref) {
+        view_operand_index = static_cast<Integer*>(fetch(view_operand_index))->value();
+    }
+    if (destination_register_ref) {
+        destination_register_index = static_cast<Integer*>(fetch(destination_register_index))->value();
+    }
+
+    place(destination_register_index, static_cast<VectorView*>(fetch(view_operand_index))->materialize());
+
+    return addr;
+}
@@ -1,5 +1,6 @@
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <algorithm>
 #include <fstream>
@@ -7,12 +8,24 @@
 #include <sstream>
 #include <vector>
 #include <map>
+#include <set>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <sys/stat.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/format.h>
 #include <viua/support/string.h>
 #include <viua/version.h>
 #include <viua/loader.h>
+#include <viua/symtab.h>
+#include <viua/constpool.h>
+#include <viua/linker.h>
 #include <viua/program.h>
+#include <viua/cg/lex.h>
 #include <viua/cg/assembler/assembler.h>
+#include <viua/cg/disassembler/disassembler.h>
+#include <viua/inlined.h>
 using namespace std;
 
 
@@ -22,6 +35,8 @@ bool SHOW_VERSION = false;
 
 // are we assembling a library?
 bool AS_LIB = false;
+// are we assembling a relocatable object?
+bool AS_OBJECT = false;
 
 bool VERBOSE = false;
 bool DEBUG = false;
@@ -30,6 +45,20 @@ bool SCREAM = false;
 bool WARNING_ALL = false;
 bool ERROR_ALL = false;
 
+// directory of assembler cache, caching is disabled if empty
+string CACHE_DIRECTORY = "";
+
+// should functions and blocks of linked modules that are never used be left out?
+bool COLLECT_GARBAGE = true;
+bool PRINT_GC_SECTIONS = false;
+
+// number of functions and blocks assembled at the same time
+unsigned JOBS = 1;
+
+// level of optimizations applied to functions and blocks (0 disables them)
+unsigned OPTIMIZATION_LEVEL = 0;
+bool OPTIMIZATION_REPORT = false;
+
 
 // WARNINGS
 bool WARNING_MISSING_END = false;
@@ -143,6 +172,36 @@ const map<string, ThreeIntopAssemblerFunction> THREE_INTOP_ASM_FUNCTIONS = {
     { "igte", &Program::igte },
     { "ieq",  &Program::ieq },
 
+    { "iaddi", &Program::iaddi },
+    { "isubi", &Program::isubi },
+    { "imuli", &Program::imuli },
+    { "idivi", &Program::idivi },
+    { "ilti", &Program::ilti },
+    { "iltei", &Program::iltei },
+    { "igti", &Program::igti },
+    { "igtei", &Program::igtei },
+    { "ieqi", &Program::ieqi },
+
+    { "tiadd", &Program::tiadd },
+    { "tisub", &Program::tisub },
+    { "timul", &Program::timul },
+    { "tidiv", &Program::tidiv },
+    { "tilt", &Program::tilt },
+    { "tilte", &Program::tilte },
+    { "tigt", &Program::tigt },
+    { "tigte", &Program::tigte },
+    { "tieq", &Program::tieq },
+
+    { "giadd", &Program::giadd },
+    { "gisub", &Program::gisub },
+    { "gimul", &Program::gimul },
+    { "gidiv", &Program::gidiv },
+    { "gilt", &Program::gilt },
+    { "gilte", &Program::gilte },
+    { "gigt", &Program::gigt },
+    { "gigte", &Program::gigte },
+    { "gieq", &Program::gieq },
+
     { "fadd", &Program::fadd },
     { "fsub", &Program::fsub },
     { "fmul", &Program::fmul },
@@ -153,13 +212,36 @@ const map<string, ThreeIntopAssemblerFunction> THREE_INTOP_ASM_FUNCTIONS = {
     { "fgte", &Program::fgte },
     { "feq",  &Program::feq },
 
+    { "streq", &Program::streq },
+    { "stradd", &Program::stradd },
+    { "strfind", &Program::strfind },
+    { "strcmp", &Program::strcmp },
+    { "strsplit", &Program::strsplit },
+
+    { "atomeq", &Program::atomeq },
+
+    { "vsat", &Program::vsat },
+
     { "and",  &Program::logand },
     { "or",   &Program::logor },
 };
 
-void assemble_three_intop_instruction(Program& program, map<string, int>& names, const string& instr, const string& operands) {
+typedef Program& (Program::*FloatImmediateAssemblerFunction)(int_op, int_op, float);
+const map<string, FloatImmediateAssemblerFunction> FLOAT_IMMEDIATE_ASM_FUNCTIONS = {
+    { "faddi", &Program::faddi },
+    { "fsubi", &Program::fsubi },
+    { "fmuli", &Program::fmuli },
+    { "fdivi", &Program::fdivi },
+    { "flti", &Program::flti },
+    { "fltei", &Program::fltei },
+    { "fgti", &Program::fgti },
+    { "fgtei", &Program::fgtei },
+    { "feqi", &Program::feqi },
+};
+
+void assemble_three_intop_instruction(Program& program, map<string, int>& names, const string& instr, const cg::lex::Line& line) {
     string rega, regb, regr;
-    tie(rega, regb, regr) = assembler::operands::get3(operands);
+    tie(rega, regb, regr) = assembler::operands::get3(line);
     rega = resolveregister(rega, names);
     regb = resolveregister(regb, names);
     regr = resolveregister(regr, names);
@@ -172,18 +254,41 @@ void assemble_three_intop_instruction(Program& program, map<string, int>& names,
     }
 }
 
+void assemble_immediate_instruction(Program& program, map<string, int>& names, const string& instr, const cg::lex::Line& line) {
+    /** Immediate operands are never filled in from the first one, so they must be given explicitly.
+     *  Integer immediates are encoded as ordinary integer operands (and may be taken from a register with `@`),
+     *  float immediates are stored inline, after the two register operands.
+     */
+    if (line[3] == "") {
+        throw ("missing immediate operand: " + line.text);
+    }
+    if (instr[0] == 'i') {
+        assemble_three_intop_instruction(program, names, instr, line);
+        return;
+    }
+
+    string rega = resolveregister(line[1], names);
+    string regb = resolveregister(line[2], names);
+    float immediate = stof(line[3]);
+    try {
+        (program.*FLOAT_IMMEDIATE_ASM_FUNCTIONS.at(instr))(assembler::operands::getint(rega), assembler::operands::getint(regb), immediate);
+    } catch (const std::out_of_range& e) {
+        throw ("instruction is not present in FLOAT_IMMEDIATE_ASM_FUNCTIONS map but it should be: " + instr);
+    }
+}
+
 
-vector<string> filter(const vector<string>& lines) {
+vector<cg::lex::Line> filter(const vector<cg::lex::Line>& lines) {
     /** Return lines for current function.
      *
      *  Filters out all non-local (i.e. outside the scope of current function) and non-opcode lines.
      */
-    vector<string> filtered;
+    vector<cg::lex::Line> filtered;
 
-    string line;
     for (unsigned i = 0; i < lines.size(); ++i) {
-        line = lines[i];
-        if (str::startswith(line, ".mark:") or str::startswith(line, ".name:") or str::startswith(line, ".main:") or str::startswith(line, ".link:") or str::startswith(line, ".signature:") or str::startswith(line, ".bsignature:")) {
+        const cg::lex::Line& line = lines[i];
+        const string& token = line[0];
+        if (token == ".mark:" or token == ".name:" or token == ".main:" or token == ".link:" or token == ".inline:" or token == ".signature:" or token == ".bsignature:") {
             /*  Lines beginning with `.mark:` are just markers placed in code and
              *  are do not produce any bytecode.
              *  Lines beginning with `.name:` are asm instructions that assign human-rememberable names to
@@ -197,9 +302,9 @@ vector<string> filter(const vector<string>& lines) {
             continue;
         }
 
-        if (str::startswith(line, ".function:") or str::startswith(line, ".block:")) {
+        if (token == ".function:" or token == ".block:") {
             // just skip function and block lines
-            while (lines[++i] != ".end");
+            while (lines[++i].text != ".end");
             continue;
         }
 
@@ -209,13 +314,12 @@ vector<string> filter(const vector<string>& lines) {
     return filtered;
 }
 
-Program& compile(Program& program, const vector<string>& lines, map<string, int>& marks, map<string, int>& names) {
+Program& compile(Program& program, const vector<cg::lex::Line>& lines, map<string, int>& marks, map<string, int>& names) {
     /** Compile instructions into bytecode using bytecode generation API.
      *
      */
-    vector<string> ilines = filter(lines);
+    vector<cg::lex::Line> ilines = filter(lines);
 
-    string line;
     int instruction = 0;  // instruction counter
     for (unsigned i = 0; i < ilines.size(); ++i) {
         /*  This is main assembly loop.
@@ -223,228 +327,360 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
          *  uses bytecode generation API to fill the program with instructions and
          *  from them generate the bytecode.
          */
-        line = ilines[i];
-
-        string instr;
-        string operands;
-        istringstream iss(line);
-
-        instr = str::chunk(line);
-        operands = str::lstrip(str::sub(line, instr.size()));
+        const cg::lex::Line& line = ilines[i];
+        const string& instr = line[0];
 
         if (DEBUG and SCREAM) {
-            cout << "[asm] compiling line: `" << line << "`" << endl;
+            cout << "[asm] compiling line: `" << line.text << "`" << endl;
         }
 
-        if (line == "nop") {
+        if (instr == "nop") {
             program.nop();
-        } else if (str::startswith(line, "izero")) {
+        } else if (instr == "izero") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.izero(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "istore")) {
+        } else if (instr == "istore") {
             string regno_chnk, number_chnk;
-            tie(regno_chnk, number_chnk) = assembler::operands::get2(operands);
+            tie(regno_chnk, number_chnk) = assembler::operands::get2(line);
             program.istore(assembler::operands::getint(resolveregister(regno_chnk, names)), assembler::operands::getint(resolveregister(number_chnk, names)));
-        } else if (str::startswith(line, "iadd")) {
-            assemble_three_intop_instruction(program, names, "iadd", operands);
-        } else if (str::startswith(line, "isub")) {
-            assemble_three_intop_instruction(program, names, "isub", operands);
-        } else if (str::startswith(line, "imul")) {
-            assemble_three_intop_instruction(program, names, "imul", operands);
-        } else if (str::startswith(line, "idiv")) {
-            assemble_three_intop_instruction(program, names, "idiv", operands);
-        } else if (str::startswithchunk(line, "ilt")) {
-            assemble_three_intop_instruction(program, names, "ilt", operands);
-        } else if (str::startswithchunk(line, "ilte")) {
-            assemble_three_intop_instruction(program, names, "ilte", operands);
-        } else if (str::startswith(line, "igte")) {
-            assemble_three_intop_instruction(program, names, "igte", operands);
-        } else if (str::startswith(line, "igt")) {
-            assemble_three_intop_instruction(program, names, "igt", operands);
-        } else if (str::startswith(line, "ieq")) {
-            assemble_three_intop_instruction(program, names, "ieq", operands);
-        } else if (str::startswith(line, "iinc")) {
+        } else if (instr == "iadd") {
+            assemble_three_intop_instruction(program, names, "iadd", line);
+        } else if (instr == "isub") {
+            assemble_three_intop_instruction(program, names, "isub", line);
+        } else if (instr == "imul") {
+            assemble_three_intop_instruction(program, names, "imul", line);
+        } else if (instr == "idiv") {
+            assemble_three_intop_instruction(program, names, "idiv", line);
+        } else if (instr == "ilt") {
+            assemble_three_intop_instruction(program, names, "ilt", line);
+        } else if (instr == "ilte") {
+            assemble_three_intop_instruction(program, names, "ilte", line);
+        } else if (instr == "igte") {
+            assemble_three_intop_instruction(program, names, "igte", line);
+        } else if (instr == "igt") {
+            assemble_three_intop_instruction(program, names, "igt", line);
+        } else if (instr == "ieq") {
+            assemble_three_intop_instruction(program, names, "ieq", line);
+        } else if (instr == "iaddi") {
+            assemble_immediate_instruction(program, names, "iaddi", line);
+        } else if (instr == "isubi") {
+            assemble_immediate_instruction(program, names, "isubi", line);
+        } else if (instr == "imuli") {
+            assemble_immediate_instruction(program, names, "imuli", line);
+        } else if (instr == "idivi") {
+            assemble_immediate_instruction(program, names, "idivi", line);
+        } else if (instr == "ilti") {
+            assemble_immediate_instruction(program, names, "ilti", line);
+        } else if (instr == "iltei") {
+            assemble_immediate_instruction(program, names, "iltei", line);
+        } else if (instr == "igti") {
+            assemble_immediate_instruction(program, names, "igti", line);
+        } else if (instr == "igtei") {
+            assemble_immediate_instruction(program, names, "igtei", line);
+        } else if (instr == "ieqi") {
+            assemble_immediate_instruction(program, names, "ieqi", line);
+        } else if (instr == "tiadd") {
+            assemble_three_intop_instruction(program, names, "tiadd", line);
+        } else if (instr == "tisub") {
+            assemble_three_intop_instruction(program, names, "tisub", line);
+        } else if (instr == "timul") {
+            assemble_three_intop_instruction(program, names, "timul", line);
+        } else if (instr == "tidiv") {
+            assemble_three_intop_instruction(program, names, "tidiv", line);
+        } else if (instr == "tilt") {
+            assemble_three_intop_instruction(program, names, "tilt", line);
+        } else if (instr == "tilte") {
+            assemble_three_intop_instruction(program, names, "tilte", line);
+        } else if (instr == "tigt") {
+            assemble_three_intop_instruction(program, names, "tigt", line);
+        } else if (instr == "tigte") {
+            assemble_three_intop_instruction(program, names, "tigte", line);
+        } else if (instr == "tieq") {
+            assemble_three_intop_instruction(program, names, "tieq", line);
+        } else if (instr == "giadd") {
+            assemble_three_intop_instruction(program, names, "giadd", line);
+        } else if (instr == "gisub") {
+            assemble_three_intop_instruction(program, names, "gisub", line);
+        } else if (instr == "gimul") {
+            assemble_three_intop_instruction(program, names, "gimul", line);
+        } else if (instr == "gidiv") {
+            assemble_three_intop_instruction(program, names, "gidiv", line);
+        } else if (instr == "gilt") {
+            assemble_three_intop_instruction(program, names, "gilt", line);
+        } else if (instr == "gilte") {
+            assemble_three_intop_instruction(program, names, "gilte", line);
+        } else if (instr == "gigt") {
+            assemble_three_intop_instruction(program, names, "gigt", line);
+        } else if (instr == "gigte") {
+            assemble_three_intop_instruction(program, names, "gigte", line);
+        } else if (instr == "gieq") {
+            assemble_three_intop_instruction(program, names, "gieq", line);
+        } else if (instr == "iinc") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.iinc(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "idec")) {
+        } else if (instr == "idec") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.idec(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "fstore")) {
+        } else if (instr == "fstore") {
             string regno_chnk, float_chnk;
-            tie(regno_chnk, float_chnk) = assembler::operands::get2(operands);
+            tie(regno_chnk, float_chnk) = assembler::operands::get2(line);
             program.fstore(assembler::operands::getint(resolveregister(regno_chnk, names)), stod(float_chnk));
-        } else if (str::startswith(line, "fadd")) {
-            assemble_three_intop_instruction(program, names, "fadd", operands);
-        } else if (str::startswith(line, "fsub")) {
-            assemble_three_intop_instruction(program, names, "fsub", operands);
-        } else if (str::startswith(line, "fmul")) {
-            assemble_three_intop_instruction(program, names, "fmul", operands);
-        } else if (str::startswith(line, "fdiv")) {
-            assemble_three_intop_instruction(program, names, "fdiv", operands);
-        } else if (str::startswithchunk(line, "flt")) {
-            assemble_three_intop_instruction(program, names, "flt", operands);
-        } else if (str::startswithchunk(line, "flte")) {
-            assemble_three_intop_instruction(program, names, "flte", operands);
-        } else if (str::startswithchunk(line, "fgt")) {
-            assemble_three_intop_instruction(program, names, "fgt", operands);
-        } else if (str::startswithchunk(line, "fgte")) {
-            assemble_three_intop_instruction(program, names, "fgte", operands);
-        } else if (str::startswith(line, "feq")) {
-            assemble_three_intop_instruction(program, names, "feq", operands);
-        } else if (str::startswith(line, "bstore")) {
+        } else if (instr == "fadd") {
+            assemble_three_intop_instruction(program, names, "fadd", line);
+        } else if (instr == "fsub") {
+            assemble_three_intop_instruction(program, names, "fsub", line);
+        } else if (instr == "fmul") {
+            assemble_three_intop_instruction(program, names, "fmul", line);
+        } else if (instr == "fdiv") {
+            assemble_three_intop_instruction(program, names, "fdiv", line);
+        } else if (instr == "flt") {
+            assemble_three_intop_instruction(program, names, "flt", line);
+        } else if (instr == "flte") {
+            assemble_three_intop_instruction(program, names, "flte", line);
+        } else if (instr == "fgt") {
+            assemble_three_intop_instruction(program, names, "fgt", line);
+        } else if (instr == "fgte") {
+            assemble_three_intop_instruction(program, names, "fgte", line);
+        } else if (instr == "feq") {
+            assemble_three_intop_instruction(program, names, "feq", line);
+        } else if (instr == "faddi") {
+            assemble_immediate_instruction(program, names, "faddi", line);
+        } else if (instr == "fsubi") {
+            assemble_immediate_instruction(program, names, "fsubi", line);
+        } else if (instr == "fmuli") {
+            assemble_immediate_instruction(program, names, "fmuli", line);
+        } else if (instr == "fdivi") {
+            assemble_immediate_instruction(program, names, "fdivi", line);
+        } else if (instr == "flti") {
+            assemble_immediate_instruction(program, names, "flti", line);
+        } else if (instr == "fltei") {
+            assemble_immediate_instruction(program, names, "fltei", line);
+        } else if (instr == "fgti") {
+            assemble_immediate_instruction(program, names, "fgti", line);
+        } else if (instr == "fgtei") {
+            assemble_immediate_instruction(program, names, "fgtei", line);
+        } else if (instr == "feqi") {
+            assemble_immediate_instruction(program, names, "feqi", line);
+        } else if (instr == "bstore") {
             string regno_chnk, byte_chnk;
-            tie(regno_chnk, byte_chnk) = assembler::operands::get2(operands);
+            tie(regno_chnk, byte_chnk) = assembler::operands::get2(line);
             program.bstore(assembler::operands::getint(resolveregister(regno_chnk, names)), assembler::operands::getbyte(resolveregister(byte_chnk, names)));
-        } else if (str::startswith(line, "itof")) {
+        } else if (instr == "itof") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             if (b_chnk.size() == 0) { b_chnk = a_chnk; }
             program.itof(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "ftoi")) {
+        } else if (instr == "ftoi") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             if (b_chnk.size() == 0) { b_chnk = a_chnk; }
             program.ftoi(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "stoi")) {
+        } else if (instr == "stoi") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             if (b_chnk.size() == 0) { b_chnk = a_chnk; }
             program.stoi(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "stof")) {
+        } else if (instr == "stof") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             if (b_chnk.size() == 0) { b_chnk = a_chnk; }
             program.stof(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "strstore")) {
+        } else if (instr == "strstore") {
             string reg_chnk, str_chnk;
-            reg_chnk = str::chunk(operands);
-            operands = str::lstrip(str::sub(operands, reg_chnk.size()));
-            str_chnk = str::extract(operands);
+            reg_chnk = line[1];
+            str_chnk = line[2];
             program.strstore(assembler::operands::getint(resolveregister(reg_chnk, names)), str_chnk);
-        } else if (str::startswith(line, "vec")) {
+        } else if (instr == "streq") {
+            assemble_three_intop_instruction(program, names, "streq", line);
+        } else if (instr == "strbuild") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
+            program.strbuild(assembler::operands::getint(resolveregister(regno_chnk, names)));
+        } else if (instr == "strappend") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.strappend(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "strappendr") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.strappendr(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "strfinal") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.strfinal(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "strlen") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.strlen(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "stradd") {
+            assemble_three_intop_instruction(program, names, "stradd", line);
+        } else if (instr == "strsub") {
+            vector<string> operand_chunks(line.tokens.begin()+1, line.tokens.end());
+            if (operand_chunks.size() < 3) {
+                throw ("invalid number of operands for strsub instruction: " + line.text);
+            }
+            if (operand_chunks.size() == 3) { operand_chunks.push_back("-1"); }
+            program.strsub(assembler::operands::getint(resolveregister(operand_chunks[0], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[1], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[2], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[3], names)));
+        } else if (instr == "strfind") {
+            assemble_three_intop_instruction(program, names, "strfind", line);
+        } else if (instr == "strcmp") {
+            assemble_three_intop_instruction(program, names, "strcmp", line);
+        } else if (instr == "strsplit") {
+            assemble_three_intop_instruction(program, names, "strsplit", line);
+        } else if (instr == "atom") {
+            string reg_chnk, atom_chnk;
+            reg_chnk = line[1];
+            atom_chnk = line[2];
+            program.atom(assembler::operands::getint(resolveregister(reg_chnk, names)), atom_chnk);
+        } else if (instr == "atomeq") {
+            assemble_three_intop_instruction(program, names, "atomeq", line);
+        } else if (instr == "vec") {
+            string regno_chnk;
+            regno_chnk = line[1];
             program.vec(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "vinsert")) {
+        } else if (instr == "vinsert") {
             string vec, src, pos;
-            tie(vec, src, pos) = assembler::operands::get3(operands, false);
+            tie(vec, src, pos) = assembler::operands::get3(line, false);
             if (pos == "") { pos = "0"; }
             program.vinsert(assembler::operands::getint(resolveregister(vec, names)), assembler::operands::getint(resolveregister(src, names)), assembler::operands::getint(resolveregister(pos, names)));
-        } else if (str::startswith(line, "vpush")) {
+        } else if (instr == "vpush") {
             string regno_chnk, number_chnk;
-            tie(regno_chnk, number_chnk) = assembler::operands::get2(operands);
+            tie(regno_chnk, number_chnk) = assembler::operands::get2(line);
             program.vpush(assembler::operands::getint(resolveregister(regno_chnk, names)), assembler::operands::getint(resolveregister(number_chnk, names)));
-        } else if (str::startswith(line, "vpop")) {
+        } else if (instr == "vpop") {
             string vec, dst, pos;
-            tie(vec, dst, pos) = assembler::operands::get3(operands, false);
+            tie(vec, dst, pos) = assembler::operands::get3(line, false);
             if (dst == "") { dst = "0"; }
             if (pos == "") { pos = "-1"; }
             program.vpop(assembler::operands::getint(resolveregister(vec, names)), assembler::operands::getint(resolveregister(dst, names)), assembler::operands::getint(resolveregister(pos, names)));
-        } else if (str::startswith(line, "vat")) {
+        } else if (instr == "vat") {
             string vec, dst, pos;
-            tie(vec, dst, pos) = assembler::operands::get3(operands, false);
+            tie(vec, dst, pos) = assembler::operands::get3(line, false);
             if (pos == "") { pos = "-1"; }
             program.vat(assembler::operands::getint(resolveregister(vec, names)), assembler::operands::getint(resolveregister(dst, names)), assembler::operands::getint(resolveregister(pos, names)));
-        } else if (str::startswith(line, "vlen")) {
+        } else if (instr == "vlen") {
             string regno_chnk, number_chnk;
-            tie(regno_chnk, number_chnk) = assembler::operands::get2(operands);
+            tie(regno_chnk, number_chnk) = assembler::operands::get2(line);
             program.vlen(assembler::operands::getint(resolveregister(regno_chnk, names)), assembler::operands::getint(resolveregister(number_chnk, names)));
-        } else if (str::startswith(line, "not")) {
+        } else if (instr == "vslice") {
+            vector<string> operand_chunks(line.tokens.begin()+1, line.tokens.end());
+            if (operand_chunks.size() < 3) {
+                throw ("invalid number of operands for vslice instruction: " + line.text);
+            }
+            if (operand_chunks.size() == 3) { operand_chunks.push_back("-1"); }
+            program.vslice(assembler::operands::getint(resolveregister(operand_chunks[0], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[1], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[2], names)),
+                           assembler::operands::getint(resolveregister(operand_chunks[3], names)));
+        } else if (instr == "vsat") {
+            assemble_three_intop_instruction(program, names, "vsat", line);
+        } else if (instr == "vslen") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.vslen(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "vsmat") {
+            string a_chnk, b_chnk;
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
+            program.vsmat(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
+        } else if (instr == "not") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.lognot(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "and")) {
-            assemble_three_intop_instruction(program, names, "and", operands);
-        } else if (str::startswith(line, "or")) {
-            assemble_three_intop_instruction(program, names, "or", operands);
-        } else if (str::startswith(line, "move")) {
+        } else if (instr == "and") {
+            assemble_three_intop_instruction(program, names, "and", line);
+        } else if (instr == "or") {
+            assemble_three_intop_instruction(program, names, "or", line);
+        } else if (instr == "move") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.move(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "copy")) {
+        } else if (instr == "copy") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.copy(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "ref")) {
+        } else if (instr == "ref") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.ref(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "swap")) {
+        } else if (instr == "swap") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.swap(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "free")) {
+        } else if (instr == "free") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.free(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "empty")) {
+        } else if (instr == "empty") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.empty(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "isnull")) {
+        } else if (instr == "isnull") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.isnull(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "ress")) {
-            program.ress(operands);
-        } else if (str::startswith(line, "tmpri")) {
+        } else if (instr == "ress") {
+            program.ress(line[1]);
+        } else if (instr == "tmpri") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.tmpri(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "tmpro")) {
+        } else if (instr == "tmpro") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.tmpro(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "print")) {
+        } else if (instr == "print") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.print(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "echo")) {
+        } else if (instr == "echo") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.echo(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "clbind")) {
+        } else if (instr == "clbind") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.clbind(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "closure")) {
+        } else if (instr == "closure") {
             string fn_name, reg;
-            tie(reg, fn_name) = assembler::operands::get2(operands);
+            tie(reg, fn_name) = assembler::operands::get2(line);
             program.closure(assembler::operands::getint(resolveregister(reg, names)), fn_name);
-        } else if (str::startswith(line, "function")) {
+        } else if (instr == "function") {
             string fn_name, reg;
-            tie(reg, fn_name) = assembler::operands::get2(operands);
+            tie(reg, fn_name) = assembler::operands::get2(line);
             program.function(assembler::operands::getint(resolveregister(reg, names)), fn_name);
-        } else if (str::startswith(line, "fcall")) {
+        } else if (instr == "fcall") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.fcall(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "frame")) {
+        } else if (instr == "frame") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             if (a_chnk.size() == 0) { a_chnk = "0"; }
             if (b_chnk.size() == 0) { b_chnk = "16"; }  // default number of local registers
             program.frame(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "param")) {
+        } else if (instr == "param") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.param(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "paref")) {
+        } else if (instr == "paref") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.paref(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswithchunk(line, "arg")) {
+        } else if (instr == "arg") {
             string a_chnk, b_chnk;
-            tie(a_chnk, b_chnk) = assembler::operands::get2(operands);
+            tie(a_chnk, b_chnk) = assembler::operands::get2(line);
             program.arg(assembler::operands::getint(resolveregister(a_chnk, names)), assembler::operands::getint(resolveregister(b_chnk, names)));
-        } else if (str::startswith(line, "argc")) {
+        } else if (instr == "argc") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.argc(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "call")) {
+        } else if (instr == "call") {
             /** Full form of call instruction has two operands: function name and return value register index.
              *  If call is given only one operand - it means it is the instruction index and returned value is discarded.
              *  To explicitly state that return value should be discarderd 0 can be supplied as second operand.
@@ -467,7 +703,7 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
              *  Good luck with debugging your code, then.
              */
             string fn_name, reg;
-            tie(reg, fn_name) = assembler::operands::get2(operands);
+            tie(reg, fn_name) = assembler::operands::get2(line);
 
             // if second operand is empty, fill it with zero
             // which means that return value will be discarded
@@ -477,7 +713,13 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
             }
 
             program.call(assembler::operands::getint(resolveregister(reg, names)), fn_name);
-        } else if (str::startswith(line, "branch")) {
+        } else if (instr == "tailcall") {
+            /** Tail call has only one operand: function name.
+             *  Called function returns its value to the caller of the function making the tail call, so
+             *  there is no return register to give.
+             */
+            program.tailcall(line[1]);
+        } else if (instr == "branch") {
             /*  If branch is given three operands, it means its full, three-operands form is being used.
              *  Otherwise, it is short, two-operands form instruction and assembler should fill third operand accordingly.
              *
@@ -492,7 +734,7 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
              *      * third operands is the address to which to jump if register is false,
              */
             string condition, if_true, if_false;
-            tie(condition, if_true, if_false) = assembler::operands::get3(operands, false);
+            tie(condition, if_true, if_false) = assembler::operands::get3(line, false);
 
             int addrt_target, addrf_target;
             enum JUMPTYPE addrt_jump_type, addrf_jump_type;
@@ -506,26 +748,26 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
 
             if (DEBUG) {
                 if (addrt_jump_type == JMP_TO_BYTE) {
-                    cout << line << " => truth jump to byte";
+                    cout << line.text << " => truth jump to byte";
                 } else if (addrt_jump_type == JMP_ABSOLUTE) {
-                    cout << line << " => truth absolute jump";
+                    cout << line.text << " => truth absolute jump";
                 } else {
-                    cout << line << " => truth relative jump";
+                    cout << line.text << " => truth relative jump";
                 }
                 cout << ": " << addrt_target << endl;
 
                 if (addrf_jump_type == JMP_TO_BYTE) {
-                    cout << line << " => false jump to byte";
+                    cout << line.text << " => false jump to byte";
                 } else if (addrf_jump_type == JMP_ABSOLUTE) {
-                    cout << line << " => false absolute jump";
+                    cout << line.text << " => false absolute jump";
                 } else {
-                    cout << line << " => false relative jump";
+                    cout << line.text << " => false relative jump";
                 }
                 cout << ": " << addrf_target << endl;
             }
 
             program.branch(assembler::operands::getint(resolveregister(condition, names)), addrt_target, addrt_jump_type, addrf_target, addrf_jump_type);
-        } else if (str::startswith(line, "jump")) {
+        } else if (instr == "jump") {
             /*  Jump instruction can be written in two forms:
              *
              *      * `jump <index>`
@@ -541,52 +783,51 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
              */
             int jump_target;
             enum JUMPTYPE jump_type;
-            tie(jump_target, jump_type) = resolvejump(operands, marks);
+            tie(jump_target, jump_type) = resolvejump(line[1], marks);
 
             if (DEBUG) {
                 if (jump_type == JMP_TO_BYTE) {
-                    cout << line << " => false jump to byte";
+                    cout << line.text << " => false jump to byte";
                 } else if (jump_type == JMP_ABSOLUTE) {
-                    cout << line << " => false absolute jump";
+                    cout << line.text << " => false absolute jump";
                 } else {
-                    cout << line << " => false relative jump";
+                    cout << line.text << " => false relative jump";
                 }
                 cout << ": " << jump_target << endl;
             }
 
             program.jump(jump_target, jump_type);
-        } else if (str::startswith(line, "tryframe")) {
+        } else if (instr == "tryframe") {
             program.tryframe();
-        } else if (str::startswith(line, "catch")) {
+        } else if (instr == "catch") {
             string type_chnk, catcher_chnk;
-            type_chnk = str::extract(operands);
-            operands = str::lstrip(str::sub(operands, type_chnk.size()));
-            catcher_chnk = str::chunk(operands);
+            type_chnk = line[1];
+            catcher_chnk = line[2];
             program.vmcatch(type_chnk, catcher_chnk);
-        } else if (str::startswith(line, "pull")) {
+        } else if (instr == "pull") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.pull(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "try")) {
-            string block_name = str::chunk(operands);
+        } else if (instr == "try") {
+            string block_name = line[1];
             program.vmtry(block_name);
-        } else if (str::startswith(line, "throw")) {
+        } else if (instr == "throw") {
             string regno_chnk;
-            regno_chnk = str::chunk(operands);
+            regno_chnk = line[1];
             program.vmthrow(assembler::operands::getint(resolveregister(regno_chnk, names)));
-        } else if (str::startswith(line, "leave")) {
+        } else if (instr == "leave") {
             program.leave();
-        } else if (str::startswith(line, "eximport")) {
+        } else if (instr == "eximport") {
             string str_chnk;
-            str_chnk = str::extract(operands);
+            str_chnk = line[1];
             program.eximport(str_chnk);
-        } else if (str::startswith(line, "excall")) {
+        } else if (instr == "excall") {
             /** Full form of excall instruction has two operands: external function name and return value register index.
              *  If call is given only one operand - it means it is the instruction index and returned value is discarded.
              *  To explicitly state that return value should be discarded, 0 can be supplied as second operand.
              */
             string fn_name, reg;
-            tie(reg, fn_name) = assembler::operands::get2(operands);
+            tie(reg, fn_name) = assembler::operands::get2(line);
 
             // if second operand is empty, fill it with zero
             // which means that return value will be discarded
@@ -596,13 +837,13 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
             }
 
             program.excall(assembler::operands::getint(resolveregister(reg, names)), fn_name);
-        } else if (str::startswith(line, "link")) {
+        } else if (instr == "link") {
             string str_chnk;
-            str_chnk = str::chunk(operands);
+            str_chnk = line[1];
             program.link(str_chnk);
-        } else if (str::startswith(line, "end")) {
+        } else if (instr == "end") {
             program.end();
-        } else if (str::startswith(line, "halt")) {
+        } else if (instr == "halt") {
             program.halt();
         } else {
             throw ("unimplemented instruction: " + instr);
@@ -614,7 +855,7 @@ Program& compile(Program& program, const vector<string>& lines, map<string, int>
 }
 
 
-void assemble(Program& program, const vector<string>& lines) {
+void assemble(Program& program, const vector<cg::lex::Line>& lines) {
     /** Assemble instructions in lines into a program.
      *  This function first garthers required information about markers, named registers and functions.
      *  Then, it passes all gathered data into compilation function.
@@ -630,19 +871,308 @@ void assemble(Program& program, const vector<string>& lines) {
 }
 
 
-map<string, uint16_t> mapInvokableAddresses(uint16_t& starting_instruction, const vector<string>& names, const map<string, vector<string> >& sources) {
-    map<string, uint16_t> addresses;
-    for (string name : names) {
-        addresses[name] = starting_instruction;
+string cacheVersion() {
+    /** Return description of everything besides the source that bytecode generated by the assembler depends on.
+     */
+    ostringstream oss;
+    oss << VERSION << '.' << MICRO << ' ' << COMMIT << ' ' << int(VIUA_BYTECODE_VERSION);
+    return oss.str();
+}
+
+string invokableCachePath(const vector<cg::lex::Line>& body) {
+    /** Return path of cache entry of function or block with given body.
+     *
+     *  Bytecode of a function depends only on its own instructions so
+     *  neither its name, nor the rest of the module are part of the key.
+     */
+    assembler::cache::key_type key = assembler::cache::hash(cacheVersion());
+    for (const cg::lex::Line& line : body) {
+        key = assembler::cache::hash(line.text + '\n', key);
+    }
+    return assembler::cache::path(CACHE_DIRECTORY, key, ".fn");
+}
+
+bool fetchInvokable(const vector<cg::lex::Line>& body, ConstantPoolBuilder& constants, assembler::cache::Invokable& invokable) {
+    /** Fetch bytecode of function or block with given body from cache, and
+     *  place its literals in constant pool.
+     */
+    string entry;
+    return (assembler::cache::fetch(invokableCachePath(body), entry) and assembler::cache::load(entry, invokable) and assembler::cache::relink(invokable, constants));
+}
+
+assembler::cache::Invokable compiledInvokable(Program& func) {
+    /** Return bytecode of assembled function or block in the form it is cached in.
+     */
+    assembler::cache::Invokable invokable;
+    byte* btcode = func.bytecode();
+    invokable.bytecode = string((const char*)btcode, func.size());
+    delete[] btcode;
+    invokable.jumps_absolute = func.jumpsAbsolute();
+    invokable.jumps_to_byte = func.jumpsToByte();
+    invokable.constants = func.constantUses();
+    return invokable;
+}
+
+assembler::cache::Invokable assembleInvokable(const string& name, const vector<cg::lex::Line>& body, ConstantPoolBuilder& constants) {
+    /** Assemble function or block with given body into the form it is cached in.
+     */
+    Program func(Program::countBytes(name == ENTRY_FUNCTION_NAME ? filter(body) : body));
+    func.setconstants(&constants);
+    assemble(func, body);
+    func.calculateJumps(func.jumps());
+    return compiledInvokable(func);
+}
+
+void inParallel(unsigned count, function<void(unsigned)> work) {
+    /** Call work for every index below count, on up to JOBS threads.
+     */
+    atomic<unsigned> next(0);
+    vector<thread> pool;
+    for (unsigned w = 0; (w < JOBS) and (w < count); ++w) {
+        pool.push_back(thread([&next, &work, count]() {
+            for (unsigned i = next++; i < count; i = next++) {
+                work(i);
+            }
+        }));
+    }
+    for (thread& t : pool) {
+        t.join();
+    }
+}
+
+void placeLiterals(const vector<cg::lex::Line>& body, ConstantPoolBuilder& constants) {
+    /** Place literals of function or block with given body in constant pool, in
+     *  the order assembling the body would place them.
+     *
+     *  Body of entry function is the whole source so lines of other functions and blocks are filtered out.
+     */
+    for (const cg::lex::Line& line : filter(body)) {
+        const string& instr = line[0];
+        if (instr == "strstore") {
+            constants.str(line[2].substr(1, line[2].size()-2));
+        } else if (instr == "atom") {
+            constants.atom(line[2].substr(1, line[2].size()-2));
+        } else if (instr == "fstore") {
+            constants.real(stod(line[2]));
+        }
+    }
+}
+
+typedef tuple<string, string, const vector<cg::lex::Line>*> InvokableSource;
+
+map<pair<string, string>, assembler::cache::Invokable> precompile(const vector<InvokableSource>& sources, ConstantPoolBuilder& constants, set<pair<string, string> >& cached) {
+    /** Assemble functions and blocks on up to JOBS threads.
+     *
+     *  Sources are (type, name, body) triples in the order the invokables appear in the image.
+     *  Literals of all of them are placed in constant pool up front, in source order, so that
+     *  the pool (and the whole image) is identical to the one sequential assembly produces.
+     *  The pool is then sealed and only read by the workers.
+     *
+     *  Results are returned only for invokables preceding the first one that could not be assembled;
+     *  the rest is left to sequential assembly so errors are reported as usual.
+     */
+    const char FAILED = 0, ASSEMBLED = 1, FOUND_IN_CACHE = 2;
+
+    vector<assembler::cache::Invokable> compiled(sources.size());
+    vector<char> state(sources.size(), FAILED);
+
+    unsigned prepared = 0;
+    vector<unsigned> pending;
+    for (; prepared < sources.size(); ++prepared) {
+        const vector<cg::lex::Line>& body = *get<2>(sources[prepared]);
         try {
-            starting_instruction += Program::countBytes(sources.at(name));
-        } catch (const std::out_of_range& e) {
-            throw ("could not find block '" + name + "'");
+            if (CACHE_DIRECTORY.size() and fetchInvokable(body, constants, compiled[prepared])) {
+                state[prepared] = FOUND_IN_CACHE;
+                continue;
+            }
+            placeLiterals(body, constants);
+        } catch (...) {
+            break;
+        }
+        pending.push_back(prepared);
+    }
+
+    constants.seal();
+    inParallel(pending.size(), [&sources, &compiled, &state, &pending, &constants](unsigned j) {
+        unsigned i = pending[j];
+        try {
+            compiled[i] = assembleInvokable(get<1>(sources[i]), *get<2>(sources[i]), constants);
+            state[i] = ASSEMBLED;
+        } catch (...) {
+            // sequential assembly reports the error
+        }
+    });
+    constants.seal(false);
+
+    map<pair<string, string>, assembler::cache::Invokable> precompiled;
+    for (unsigned i = 0; (i < prepared) and (state[i] != FAILED); ++i) {
+        pair<string, string> key(get<0>(sources[i]), get<1>(sources[i]));
+        precompiled[key] = compiled[i];
+        if (state[i] == FOUND_IN_CACHE) {
+            cached.insert(key);
+        }
+    }
+    return precompiled;
+}
+
+byte* placeInvokable(const assembler::cache::Invokable& invokable, int offset) {
+    /** Return bytecode of function or block placed at given offset in the module.
+     *
+     *  Targets of jumps to bytes are byte offsets inside the module, and
+     *  are made relative to the jumping instruction here.
+     */
+    byte* btcode = new byte[invokable.bytecode.size()];
+    copy(invokable.bytecode.begin(), invokable.bytecode.end(), btcode);
+
+    int position, instruction, target;
+    for (tuple<int, int> jmp : invokable.jumps_to_byte) {
+        tie(position, instruction) = jmp;
+        memcpy(&target, btcode+position, sizeof(int));
+        target -= (offset + instruction);
+        memcpy(btcode+position, &target, sizeof(int));
+        if (DEBUG) {
+            cout << "[asm] debug: calculated jump to byte at " << (offset+position) << " = " << target << endl;
+        }
+    }
+    return btcode;
+}
+
+string imageCachePath(const string& filename, const vector<string>& commandline_given_links) {
+    /** Return path of cache entry of image assembled from given file.
+     *
+     *  Key includes the source, options affecting the assembly, and
+     *  contents of every module linked into the image.
+     *  Returns empty string if any of the files cannot be read.
+     */
+    string source;
+    if (not assembler::cache::fetch(filename, source)) {
+        return "";
+    }
+
+    ostringstream options;
+    options << AS_LIB << AS_OBJECT << COLLECT_GARBAGE << OPTIMIZATION_LEVEL << WARNING_ALL << ERROR_ALL
+            << WARNING_MISSING_END << WARNING_EMPTY_FUNCTION_BODY << WARNING_OPERANDLESS_FRAME << WARNING_GLOBALS_IN_LIB
+            << ERROR_MISSING_END << ERROR_EMPTY_FUNCTION_BODY << ERROR_OPERANDLESS_FRAME << ERROR_GLOBALS_IN_LIB;
+
+    assembler::cache::key_type key = assembler::cache::hash(cacheVersion());
+    key = assembler::cache::hash(options.str(), key);
+    key = assembler::cache::hash(source, key);
+
+    vector<string> lines;
+    istringstream in(source);
+    string line;
+    while (getline(in, line)) { lines.push_back(line); }
+
+    vector<string> links = assembler::ce::getlinks(cg::lex::tokenise(lines));
+    for (string lnk : commandline_given_links) {
+        if (find(links.begin(), links.end(), lnk) == links.end()) {
+            links.push_back(lnk);
+        }
+    }
+    for (string lnk : links) {
+        string module;
+        if (not assembler::cache::fetch(lnk, module)) {
+            return "";
+        }
+        key = assembler::cache::hash(lnk + '\0', key);
+        key = assembler::cache::hash(module, key);
+    }
+
+    return assembler::cache::path(CACHE_DIRECTORY, key, ".image");
+}
+
+map<string, vector<cg::lex::Line> > disassembleLinked(const vector<Module>& modules) {
+    /** Return bodies of functions of statically linked modules, so they can be inlined.
+     *
+     *  Targets of jumps (printed as module offsets) become marks.
+     *  Functions that cannot be read back exactly are left out, e.g. the ones storing floats
+     *  (which are not printed with full precision), or jumping out of their own code.
+     */
+    map<string, vector<cg::lex::Line> > bodies;
+    for (const Module& module : modules) {
+        for (const Invokable& invokable : module.invokables) {
+            if (invokable.kind != SYMBOL_FUNCTION or bodies.count(invokable.name)) {
+                continue;
+            }
+
+            vector<pair<string, cg::lex::Line> > instructions;
+            set<string> targeted;
+            bool readable = true;
+            bytecode_size_type offset = invokable.address;
+            while (readable and offset < (invokable.address + invokable.size)) {
+                string text;
+                unsigned size = 0;
+                try {
+                    tie(text, size) = disassembler::instruction((byte*)(module.bytecode.data()+offset), offset, &module.constants);
+                } catch (const string& e) {
+                    readable = false;
+                    break;
+                }
+                vector<string> tokens = cg::lex::tokenise(text).tokens;
+                readable = (size and tokens[0] != "fstore" and text.find("<constant ") == string::npos);
+                for (string& token : tokens) {
+                    if (not str::startswith(token, "0x")) {
+                        continue;
+                    }
+                    bytecode_size_type target = stoul(token, 0, 16);
+                    readable = (readable and target >= invokable.address and target < (invokable.address + invokable.size));
+                    token = ("at_" + token.substr(2));
+                    targeted.insert(token);
+                }
+                ostringstream hex_offset;
+                hex_offset << "at_" << hex << offset;
+                instructions.push_back(pair<string, cg::lex::Line>(hex_offset.str(), cg::lex::tokenise(str::join(" ", tokens))));
+                offset += size;
+            }
+            if (not readable) {
+                continue;
+            }
+
+            vector<cg::lex::Line>& body = bodies[invokable.name];
+            for (const pair<string, cg::lex::Line>& each : instructions) {
+                if (targeted.count(each.first)) {
+                    body.push_back(cg::lex::tokenise(".mark: " + each.first));
+                }
+                body.push_back(each.second);
+            }
         }
     }
-    return addresses;
+    return bodies;
 }
 
+void reportOptimizations(const string& type, const string& name, const vector<assembler::optimize::Change>& changes) {
+    for (const assembler::optimize::Change& change : changes) {
+        cout << "[asm:opt] " << type << " '" << name << "': line " << change.line << ": " << change.pass << ": ";
+        if (change.after.size()) {
+            cout << '`' << change.before << "` -> `" << change.after << '`' << endl;
+        } else {
+            cout << "removed `" << change.before << '`' << endl;
+        }
+    }
+}
+
+vector<InlinedCode> locateInlined(const map<string, vector<assembler::optimize::Inlined> >& inlined, const map<string, bytecode_size_type>& function_addresses, byte* program_bytecode) {
+    /** Turn ranges of instructions holding inlined code into ranges of bytes of the image.
+     */
+    vector<InlinedCode> code;
+    for (const pair<const string, vector<assembler::optimize::Inlined> >& function : inlined) {
+        // offsets of instructions of the function, up to the last one any range ends at
+        unsigned last = 0;
+        for (const assembler::optimize::Inlined& each : function.second) {
+            last = max(last, each.end);
+        }
+        vector<bytecode_size_type> offsets = { function_addresses.at(function.first) };
+        while (offsets.size() <= last) {
+            offsets.push_back(offsets.back() + get<1>(disassembler::instruction(program_bytecode+offsets.back(), offsets.back())));
+        }
+
+        for (const assembler::optimize::Inlined& each : function.second) {
+            code.push_back(InlinedCode{ offsets[each.begin], offsets[each.end], each.arity, each.function });
+        }
+    }
+    sort(code.begin(), code.end(), [](const InlinedCode& a, const InlinedCode& b) { return (a.begin < b.begin); });
+    return code;
+}
 
 
 int generate(const string& filename, string& compilename, const vector<string>& commandline_given_links) {
@@ -655,16 +1185,21 @@ int generate(const string& filename, string& compilename, const vector<string>&
     }
 
     vector<string> lines;
-    vector<string> ilines;  // instruction lines
     string line;
 
     while (getline(in, line)) { lines.push_back(line); }
-    ilines = assembler::ce::getilines(lines);
+
+    ////////////////////////////////////////////////
+    // TOKENISE SOURCE
+    //
+    // EVERY LATER STAGE WORKS ON TOKENISED LINES
+    // WHICH REMEMBER THEIR NUMBERS IN SOURCE FILE
+    vector<cg::lex::Line> ilines = cg::lex::tokenise(lines);
 
 
     //////////////////////////////
     // SETUP INITIAL BYTECODE SIZE
-    uint16_t bytes = 0;
+    bytecode_size_type bytes = 0;
 
 
     ///////////////////////////////////////////
@@ -675,7 +1210,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
     // CALLS TO UNDEFINED FUNCTIONS
     vector<string> function_names;
     try {
-        function_names = assembler::ce::getFunctionNames(lines);
+        function_names = assembler::ce::getFunctionNames(ilines);
     } catch (const string& e) {
         cout << "fatal: " << e << endl;
         return 1;
@@ -683,7 +1218,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     vector<string> function_signatures;
     try {
-        function_signatures = assembler::ce::getSignatures(lines);
+        function_signatures = assembler::ce::getSignatures(ilines);
     } catch (const string& e) {
         cout << "fatal: " << e << endl;
         return 1;
@@ -694,7 +1229,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
     // GATHER BLOCK NAMES
     vector<string> block_names;
     try {
-        block_names = assembler::ce::getBlockNames(lines);
+        block_names = assembler::ce::getBlockNames(ilines);
     } catch (const string& e) {
         cout << "fatal: " << e << endl;
         return 1;
@@ -702,7 +1237,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     vector<string> block_signatures;
     try {
-        block_signatures = assembler::ce::getBlockSignatures(lines);
+        block_signatures = assembler::ce::getBlockSignatures(ilines);
     } catch (const string& e) {
         cout << "fatal: " << e << endl;
         return 1;
@@ -712,12 +1247,12 @@ int generate(const string& filename, string& compilename, const vector<string>&
     /////////////////////////
     // GET MAIN FUNCTION NAME
     string main_function = "";
-    for (string line : ilines) {
-        if (str::startswith(line, ".main:")) {
+    for (const cg::lex::Line& line : ilines) {
+        if (line[0] == ".main:") {
             if (DEBUG) {
                 cout << "setting main function to: ";
             }
-            main_function = str::lstrip(str::sub(line, 6));
+            main_function = line[1];
             cout << main_function << endl;
             break;
         }
@@ -732,7 +1267,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     ///////////////////////////////
     // GATHER FUNCTIONS' CODE LINES
-    map<string, vector<string> > functions;
+    map<string, vector<cg::lex::Line> > functions;
     try {
          functions = assembler::ce::getInvokables("function", ilines);
     } catch (const string& e) {
@@ -743,7 +1278,7 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     ///////////////////////////////
     // GATHER BLOCK CODE LINES
-    map<string, vector<string> > blocks;
+    map<string, vector<cg::lex::Line> > blocks;
     try {
          blocks = assembler::ce::getInvokables("block", ilines);
     } catch (const string& e) {
@@ -755,23 +1290,23 @@ int generate(const string& filename, string& compilename, const vector<string>&
     ///////////////////////////////////////////
     // INITIAL VERIFICATION OF CODE CORRECTNESS
     string report;
-    if ((report = assembler::verify::directives(lines)).size()) {
+    if ((report = assembler::verify::directives(ilines)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::instructions(lines)).size()) {
+    if ((report = assembler::verify::instructions(ilines)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::ressInstructions(lines, AS_LIB)).size()) {
+    if ((report = assembler::verify::ressInstructions(ilines, AS_LIB)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::functionBodiesAreNonempty(lines, functions)).size()) {
+    if ((report = assembler::verify::functionBodiesAreNonempty(ilines, functions)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::blockTries(lines, block_names, block_signatures)).size()) {
+    if ((report = assembler::verify::blockTries(ilines, block_names, block_signatures)).size()) {
         cout << report << endl;
         exit(1);
     }
@@ -779,20 +1314,17 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     ////////////////////////////
     // VERIFY FRAME INSTRUCTIONS
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-        if (not str::startswith(line, "frame")) {
+    for (const cg::lex::Line& line : ilines) {
+        if (line[0] != "frame") {
             continue;
         }
 
-        line = str::lstrip(str::sub(line, str::chunk(line).size()));
-
-        if (line.size() == 0) {
+        if (line.tokens.size() == 1) {
             if (ERROR_OPERANDLESS_FRAME or ERROR_ALL) {
-                cout << "fatal: frame instruction without operands at line " << i << " in " << filename;
+                cout << "fatal: frame instruction without operands at line " << line.number << " in " << filename;
                 exit(1);
             } else if (WARNING_OPERANDLESS_FRAME or WARNING_ALL) {
-                cout << "warning: frame instruction without operands at line " << i << " in " << filename;
+                cout << "warning: frame instruction without operands at line " << line.number << " in " << filename;
             }
         }
     }
@@ -800,8 +1332,8 @@ int generate(const string& filename, string& compilename, const vector<string>&
     /////////////////////////
     // VERIFY FUNCTION BODIES
     for (auto function : functions) {
-        vector<string> flines = function.second;
-        if ((flines.size() == 0 or flines.back() != "end") and (function.first != "main" and flines.back() != "halt")) {
+        const vector<cg::lex::Line>& flines = function.second;
+        if ((flines.size() == 0 or flines.back().text != "end") and (function.first != "main" and flines.back().text != "halt")) {
             if (ERROR_MISSING_END or ERROR_ALL) {
                 cout << "fatal: missing 'end' at the end of function '" << function.first << "'" << endl;
                 exit(1);
@@ -814,12 +1346,12 @@ int generate(const string& filename, string& compilename, const vector<string>&
     //////////////////////
     // VERIFY BLOCK BODIES
     for (auto block : blocks) {
-        vector<string> flines = block.second;
+        const vector<cg::lex::Line>& flines = block.second;
         if (flines.size() == 0) {
             cout << "fatal: block '" << block.first << "' has empty body" << endl;
             exit(1);
         }
-        string last_line = flines.back();
+        const string& last_line = flines.back().text;
         if (not (last_line == "leave" or last_line == "end" or last_line == "halt")) {
             cout << "fatal: missing returning instruction ('leave', 'end' or 'halt') at the end of block '" << block.first << "'" << endl;
             exit(1);
@@ -832,10 +1364,12 @@ int generate(const string& filename, string& compilename, const vector<string>&
     // FIXME: this is just a crude check - it does not acctually checks if these instructions set 0 register
     // this must be better implemented or we will receive "function did not set return register" exceptions at runtime
     bool main_is_defined = (find(function_names.begin(), function_names.end(), main_function) != function_names.end());
-    if (not AS_LIB and main_is_defined) {
+    // objects without main function are linked with the object that defines it
+    bool executable = (not AS_LIB and (main_is_defined or not AS_OBJECT));
+    if (executable and main_is_defined) {
         string main_second_but_last;
         try {
-            main_second_but_last = *(functions.at(main_function).end()-2);
+            main_second_but_last = (functions.at(main_function).end()-2)->text;
         } catch (const std::out_of_range& e) {
             cout << "[asm] fatal: could not find main function (during return value check)" << endl;
             exit(1);
@@ -849,104 +1383,83 @@ int generate(const string& filename, string& compilename, const vector<string>&
             return 1;
         }
     }
-    if (not main_is_defined and (DEBUG or VERBOSE) and not AS_LIB) {
+    if (not main_is_defined and (DEBUG or VERBOSE) and executable) {
         cout << "notice: main function (" << main_function << ") is not defined, deferring main function check to post-link phase" << endl;
     }
 
 
-    /////////////////////////////////
-    // MAP FUNCTIONS TO ADDRESSES AND
-    // MAP BLOCKS TO ADDRESSES AND
-    // SET STARTING INSTRUCTION
-    uint16_t starting_instruction = 0;  // the bytecode offset to first executable instruction
-    map<string, uint16_t> function_addresses;
-    map<string, uint16_t> block_addresses;
-    try {
-        block_addresses = mapInvokableAddresses(starting_instruction, block_names, blocks);
-        function_addresses = mapInvokableAddresses(starting_instruction, function_names, functions);
-        bytes = Program::countBytes(ilines);
-    } catch (const string& e) {
-        cout << "error: bytecode size calculation failed: " << e << endl;
-        return 1;
-    }
+    ////////////////////////////////////////////
+    // FUNCTIONS AND BLOCKS ARE MAPPED TO ADDRESSES
+    // WHEN THEIR BYTECODE IS GENERATED AS SIZES OF
+    // INSTRUCTIONS DEPEND ON WIDTHS OF THEIR OPERANDS
+    bytecode_size_type starting_instruction = 0;  // the bytecode offset to first executable instruction
+    map<string, bytecode_size_type> function_addresses;
+    map<string, bytecode_size_type> block_addresses;
 
 
     //////////////////////////
     // GENERATE ENTRY FUNCTION
-    if (not AS_LIB) {
+    if (executable) {
         if (DEBUG) {
             cout << "generating __entry function" << endl;
         }
         function_names.push_back(ENTRY_FUNCTION_NAME);
-        function_addresses[ENTRY_FUNCTION_NAME] = starting_instruction;
         // entry function sets global stuff
-        ilines.insert(ilines.begin(), "ress global");
+        vector<cg::lex::Line> entry_lines = ilines;
+        entry_lines.insert(entry_lines.begin(), cg::lex::tokenise("ress global"));
         // append entry function instructions...
-        ilines.push_back("frame 1");
-        ilines.push_back("paref 0 1");
+        entry_lines.push_back(cg::lex::tokenise("frame 1"));
+        entry_lines.push_back(cg::lex::tokenise("paref 0 1"));
         // this must not be hardcoded because we have '.main:' assembler instruction
         // we also save return value in 1 register since 0 means "drop return value"
-        ilines.push_back("call 1 " + main_function);
+        entry_lines.push_back(cg::lex::tokenise("call 1 " + main_function));
         // then, register 1 is moved to register 0 so it counts as a return code
-        ilines.push_back("move 0 1");
-        ilines.push_back("halt");
-        functions[ENTRY_FUNCTION_NAME] = ilines;
-        // instructions were added so bytecode size must be inreased
-        bytes += OP_SIZES.at("ress");
-        bytes += OP_SIZES.at("frame");
-        bytes += OP_SIZES.at("paref");
-        bytes += OP_SIZES.at("call");
-        bytes += main_function.size()+1;
-        bytes += OP_SIZES.at("move");
-        bytes += OP_SIZES.at("halt");
+        entry_lines.push_back(cg::lex::tokenise("move 0 1"));
+        entry_lines.push_back(cg::lex::tokenise("halt"));
+        functions[ENTRY_FUNCTION_NAME] = entry_lines;
     }
 
 
     /////////////////////////////////////////////////////////
-    // GATHER LINKS, GET THEIR SIZES AND ADJUST BYTECODE SIZE
+    // GATHER LINKS
+    //
+    // LINKED FUNCTIONS GET THEIR ADDRESSES WHEN SIZE OF LOCAL
+    // BYTECODE IS KNOWN, AND ONLY THE ONES THAT ARE USED ARE PLACED
     vector<string> links = assembler::ce::getlinks(ilines);
-    vector<tuple<string, uint16_t, char*> > linked_libs_bytecode;
+    vector<Module> linked_modules;
     vector<string> linked_function_names;
     vector<string> linked_block_names;
-    map<string, vector<unsigned> > linked_libs_jumptables;
-    uint16_t current_link_offset = bytes;
 
     for (string lnk : commandline_given_links) {
         if (find(links.begin(), links.end(), lnk) == links.end()) {
             links.push_back(lnk);
         }
     }
+    if (AS_OBJECT and links.size()) {
+        cout << "fatal: modules are not linked into objects: pass '" << links[0] << "' to viua-ld instead" << endl;
+        return 1;
+    }
 
     for (string lnk : links) {
         if (DEBUG or VERBOSE) {
             cout << "[loader] message: linking with: '" << lnk << "\'" << endl;
         }
 
-        Loader loader(lnk);
-        loader.load();
-
-        vector<unsigned> lib_jumps = loader.getJumps();
-        if (DEBUG) {
-            cout << "[loader] entries in jump table: " << lib_jumps.size() << endl;
-            for (unsigned i = 0; i < lib_jumps.size(); ++i) {
-                cout << "  jump at byte: " << lib_jumps[i] << endl;
-            }
+        try {
+            linked_modules.push_back(Module::load(lnk));
+        } catch (const string& e) {
+            cout << "[loader] " << e << endl;
+            return 1;
         }
 
-        linked_libs_jumptables[lnk] = lib_jumps;
-
-        map<string, uint16_t> fn_addresses = loader.getFunctionAddresses();
-        vector<string> fn_names = loader.getFunctions();
-        for (string fn : fn_names) {
-            function_addresses[fn] = fn_addresses.at(fn) + current_link_offset;
-            linked_function_names.push_back(fn);
+        for (const Invokable& invokable : linked_modules.back().invokables) {
+            if (invokable.kind == SYMBOL_FUNCTION) {
+                linked_function_names.push_back(invokable.name);
+            }
             if (DEBUG) {
-                cout << "  \"" << fn << "\": entry point at byte: " << current_link_offset << '+' << fn_addresses.at(fn) << endl;
+                cout << "  \"" << invokable.name << "\": entry point at module byte: " << invokable.address << endl;
             }
         }
-
-        linked_libs_bytecode.push_back( tuple<string, uint16_t, char*>(lnk, loader.getBytecodeSize(), loader.getBytecode()) );
-        bytes += loader.getBytecodeSize();
     }
 
 
@@ -958,35 +1471,83 @@ int generate(const string& filename, string& compilename, const vector<string>&
     /////////////////////////////////////////////////////////////////////////
     // AFTER HAVING OBTAINED LINKED NAMES, IT IS POSSIBLE TO VERIFY CALLS AND
     // CALLABLE (FUNCTIONS, CLOSURES, ETC.) CREATIONS
-    if ((report = assembler::verify::functionCallsAreDefined(lines, function_names, function_signatures)).size()) {
+    //
+    // FUNCTIONS CALLED BY AN OBJECT MAY BE DEFINED IN OBJECTS IT IS LINKED WITH
+    if ((not AS_OBJECT) and (report = assembler::verify::functionCallsAreDefined(ilines, function_names, function_signatures)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::frameBalance(lines)).size()) {
+    if ((not AS_OBJECT) and (report = assembler::verify::inlinedFunctionsAreDefined(ilines, function_names)).size()) {
         cout << report << endl;
         exit(1);
     }
-    if ((report = assembler::verify::callableCreations(lines, function_names, function_signatures)).size()) {
+    if ((report = assembler::verify::frameBalance(ilines)).size()) {
         cout << report << endl;
         exit(1);
     }
-
-
-    /////////////////////////////
-    // REPORT TOTAL BYTECODE SIZE
-    if ((VERBOSE or DEBUG) and linked_function_names.size() != 0) {
-        cout << "message: total required bytes: " << bytes << " bytes" << endl;
-    }
-    if (DEBUG) {
-        cout << "debug: required bytes: " << (bytes-(bytes-current_link_offset)) << " local" << endl;
-        cout << "debug: required bytes: " << (bytes-current_link_offset) << " linked" << endl;
+    if ((not AS_OBJECT) and (report = assembler::verify::callableCreations(ilines, function_names, function_signatures)).size()) {
+        cout << report << endl;
+        exit(1);
     }
 
 
-    ///////////////////////////
-    // REPORT FIRST INSTRUCTION
-    if ((VERBOSE or DEBUG) and not AS_LIB) {
-        cout << "message: first instruction pointer: " << starting_instruction << endl;
+    /////////////////////////////////////////////////////
+    // OPTIMIZE FUNCTIONS AND BLOCKS
+    //
+    // OPTIMIZATIONS ARE APPLIED ONLY TO CODE THAT HAS BEEN VERIFIED
+    // SO PASSES MAY ASSUME IT IS CORRECT
+    //
+    // FUNCTIONS ARE NOT INLINED INTO OBJECTS AS THE LINKER COULD NOT
+    // CARRY THE INFORMATION STACK TRACES USE TO NAME INLINED CODE
+    map<string, vector<assembler::optimize::Inlined> > inlined_ranges;
+    if (OPTIMIZATION_LEVEL) {
+        vector<string> always_inlined = assembler::ce::getInlined(ilines);
+        assembler::optimize::Context context = assembler::optimize::analyse(functions, blocks, disassembleLinked(linked_modules), set<string>(always_inlined.begin(), always_inlined.end()), (AS_LIB or AS_OBJECT));
+        if (AS_OBJECT) {
+            context.inlinable.clear();
+        }
+        if (context.fixed_layout and (VERBOSE or OPTIMIZATION_REPORT)) {
+            cout << "[asm:opt] note: module jumps to instruction indexes or byte offsets, code is not optimized" << endl;
+        }
+        for (const string& name : always_inlined) {
+            if ((not context.inlinable.count(name)) and (VERBOSE or OPTIMIZATION_REPORT)) {
+                cout << "[asm:opt] note: function '" << name << "' named by .inline: directive cannot be inlined" << endl;
+            }
+        }
+        for (const string& type : { string("block"), string("function") }) {
+            map<string, vector<cg::lex::Line> >& invokables = (type == "block" ? blocks : functions);
+            for (pair<const string, vector<cg::lex::Line> >& invokable : invokables) {
+                if (invokable.first == ENTRY_FUNCTION_NAME) {
+                    continue;
+                }
+                vector<assembler::optimize::Change> changes;
+                invokable.second = assembler::optimize::run(OPTIMIZATION_LEVEL, invokable.first, invokable.second, (type == "block"), context, changes);
+                vector<assembler::optimize::Inlined> ranges = assembler::optimize::takeInlined(invokable.second);
+                if (ranges.size()) {
+                    inlined_ranges[invokable.first] = ranges;
+                }
+                if (OPTIMIZATION_REPORT) {
+                    reportOptimizations(type, invokable.first, changes);
+                }
+            }
+        }
+
+        // frames are resized once all functions are optimized, as
+        // only then is it known how many registers they use
+        map<string, unsigned> sizes = assembler::optimize::registerSetSizes(functions);
+        for (const string& type : { string("block"), string("function") }) {
+            map<string, vector<cg::lex::Line> >& invokables = (type == "block" ? blocks : functions);
+            for (pair<const string, vector<cg::lex::Line> >& invokable : invokables) {
+                if (OPTIMIZATION_LEVEL < 2 or invokable.first == ENTRY_FUNCTION_NAME) {
+                    continue;
+                }
+                vector<assembler::optimize::Change> changes;
+                invokable.second = assembler::optimize::resizeFrames(invokable.second, sizes, context, changes);
+                if (OPTIMIZATION_REPORT) {
+                    reportOptimizations(type, invokable.first, changes);
+                }
+            }
+        }
     }
 
 
@@ -995,9 +1556,10 @@ int generate(const string& filename, string& compilename, const vector<string>&
     ofstream out(compilename, ios::out | ios::binary);
 
 
-    ////////////////////
-    // CREATE JUMP TABLE
-    vector<unsigned> jump_table;
+    //////////////////////////////////
+    // WRITE MAGIC NUMBER AND VERSION
+    out.write((AS_OBJECT ? VIUA_OBJECT_MAGIC_NUMBER : VIUA_MAGIC_NUMBER), VIUA_MAGIC_NUMBER_SIZE);
+    out.put(static_cast<char>(VIUA_BYTECODE_VERSION));
 
 
     /////////////////////////////////////////////////////////
@@ -1012,74 +1574,115 @@ int generate(const string& filename, string& compilename, const vector<string>&
 
     vector<tuple<int, int> > jump_positions;
 
+    // literals of all local functions and blocks share one constant pool
+    ConstantPoolBuilder constants;
+
+    // functions and blocks whose bytecode was found in cache
+    unsigned invokables_from_cache = 0;
+
+    // with more than one job functions and blocks are assembled in parallel up front, and
+    // sequential assembly below only merges the results
+    map<pair<string, string>, assembler::cache::Invokable> precompiled;
+    set<pair<string, string> > precompiled_from_cache;
+    if (JOBS > 1 and not (DEBUG or SCREAM)) {
+        vector<InvokableSource> sources;
+        for (string name : block_names) {
+            if (find(linked_block_names.begin(), linked_block_names.end(), name) == linked_block_names.end()) {
+                sources.push_back(InvokableSource("block", name, &blocks.at(name)));
+            }
+        }
+        for (string name : function_names) {
+            if (find(linked_function_names.begin(), linked_function_names.end(), name) == linked_function_names.end()) {
+                sources.push_back(InvokableSource("function", name, &functions.at(name)));
+            }
+        }
+        precompiled = precompile(sources, constants, precompiled_from_cache);
+        if (VERBOSE) {
+            cout << "[asm] message: assembled " << precompiled.size() << " of " << sources.size() << " functions and blocks on up to " << JOBS << " threads" << endl;
+        }
+    }
+
     for (string name : block_names) {
         // do not generate bytecode for blocks that were linked
         if (find(linked_block_names.begin(), linked_block_names.end(), name) != linked_block_names.end()) { continue; }
 
+        block_addresses[name] = blocks_section_size;
+
         if (VERBOSE or DEBUG) {
             cout << "[asm] message: generating bytecode for block \"" << name << '"';
         }
-        uint16_t fun_bytes = 0;
-        try {
-            fun_bytes = Program::countBytes(blocks.at(name));
+        assembler::cache::Invokable compiled;
+        if (precompiled.count(pair<string, string>("block", name))) {
+            compiled = precompiled.at(pair<string, string>("block", name));
+            bool from_cache = precompiled_from_cache.count(pair<string, string>("block", name));
+            invokables_from_cache += from_cache;
+            if (VERBOSE) {
+                cout << " (" << compiled.bytecode.size() << " bytes at byte " << blocks_section_size << (from_cache ? ", found in cache" : "") << ')' << endl;
+            }
+            if (CACHE_DIRECTORY.size() and not from_cache) {
+                assembler::cache::store(invokableCachePath(blocks.at(name)), assembler::cache::dump(compiled));
+            }
+        } else if (CACHE_DIRECTORY.size() and fetchInvokable(blocks.at(name), constants, compiled)) {
+            ++invokables_from_cache;
             if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte " << blocks_section_size << ')' << endl;
+                cout << " (" << compiled.bytecode.size() << " bytes at byte " << blocks_section_size << ", found in cache)" << endl;
             }
-        } catch (const string& e) {
-            cout << "fatal: error during block size count (pre-assembling): " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << e.what() << endl;
-            exit(1);
-        }
-
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            assemble(func, blocks.at(name));
-        } catch (const string& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const char*& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble block '" << name << "' (" << e.what() << ')' << endl;
-            exit(1);
-        }
-
-        vector<unsigned> jumps = func.jumps();
-        vector<unsigned> jumps_absolute = func.jumpsAbsolute();
+        } else {
+            compiled = assembler::cache::Invokable();
 
-        vector<tuple<int, int> > local_jumps;
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            unsigned jmp = jumps[i];
-            local_jumps.push_back(tuple<int, int>(jmp, blocks_section_size));
-        }
-        func.calculateJumps(local_jumps);
+            bytecode_size_type fun_bytes = 0;
+            try {
+                fun_bytes = Program::countBytes(blocks.at(name));
+                if (VERBOSE or DEBUG) {
+                    cout << " (at most " << fun_bytes << " bytes at byte " << blocks_section_size << ')' << endl;
+                }
+            } catch (const string& e) {
+                cout << "fatal: error during block size count (pre-assembling): " << e << endl;
+                exit(1);
+            } catch (const std::out_of_range& e) {
+                cout << e.what() << endl;
+                exit(1);
+            }
 
-        byte* btcode = func.bytecode();
+            Program func(fun_bytes);
+            func.setdebug(DEBUG).setscream(SCREAM).setconstants(&constants);
+            try {
+                assemble(func, blocks.at(name));
+            } catch (const string& e) {
+                cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
+                exit(1);
+            } catch (const char*& e) {
+                cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
+                exit(1);
+            } catch (const std::out_of_range& e) {
+                cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble block '" << name << "' (" << e.what() << ')' << endl;
+                exit(1);
+            }
 
-        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
-        blocks_bytecode[name] = tuple<int, byte*>(func.size(), btcode);
+            // jumps are relative to the jumping instruction so local ones can be calculated right away
+            func.calculateJumps(func.jumps());
 
-        // extend jump table with jumps from current block
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            unsigned jmp = jumps[i];
-            if (DEBUG) {
-                cout << "[asm] debug: pushed relative jump to jump table: " << jmp << '+' << blocks_section_size << endl;
+            compiled = compiledInvokable(func);
+            if (CACHE_DIRECTORY.size()) {
+                assembler::cache::store(invokableCachePath(blocks.at(name)), assembler::cache::dump(compiled));
             }
-            jump_table.push_back(jmp+blocks_section_size);
         }
 
+        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
+        blocks_bytecode[name] = tuple<int, byte*>(compiled.bytecode.size(), placeInvokable(compiled, blocks_section_size));
+
+        // absolute jumps can be calculated only when whole bytecode is available
+        vector<tuple<int, int> > jumps_absolute = compiled.jumps_absolute;
+        int jmp, jmp_instruction;
         for (unsigned i = 0; i < jumps_absolute.size(); ++i) {
+            tie(jmp, jmp_instruction) = jumps_absolute[i];
             if (DEBUG) {
-                cout << "[asm] debug: pushed absolute jump to jump table: " << jumps_absolute[i] << "+0" << endl;
+                cout << "[asm] debug: pushed absolute jump: " << jmp << '+' << blocks_section_size << endl;
             }
-            jump_positions.push_back(tuple<int, int>(jumps_absolute[i]+blocks_section_size, 0));
+            jump_positions.push_back(tuple<int, int>(jmp+blocks_section_size, jmp_instruction+blocks_section_size));
         }
 
-        blocks_section_size += func.size();
+        blocks_section_size += compiled.bytecode.size();
     }
 
     // functions section size, must be offset by the size of block section
@@ -1089,119 +1692,277 @@ int generate(const string& filename, string& compilename, const vector<string>&
         // do not generate bytecode for functions that were linked
         if (find(linked_function_names.begin(), linked_function_names.end(), name) != linked_function_names.end()) { continue; }
 
+        function_addresses[name] = functions_section_size;
+
         if (VERBOSE or DEBUG) {
             cout << "[asm] message: generating bytecode for function \"" << name << '"';
         }
-        uint16_t fun_bytes = 0;
-        try {
-            fun_bytes = Program::countBytes(name == ENTRY_FUNCTION_NAME ? filter(functions.at(name)) : functions.at(name));
+        assembler::cache::Invokable compiled;
+        if (precompiled.count(pair<string, string>("function", name))) {
+            compiled = precompiled.at(pair<string, string>("function", name));
+            bool from_cache = precompiled_from_cache.count(pair<string, string>("function", name));
+            invokables_from_cache += from_cache;
+            if (VERBOSE) {
+                cout << " (" << compiled.bytecode.size() << " bytes at byte " << functions_section_size << (from_cache ? ", found in cache" : "") << ')' << endl;
+            }
+            if (CACHE_DIRECTORY.size() and not from_cache) {
+                assembler::cache::store(invokableCachePath(functions.at(name)), assembler::cache::dump(compiled));
+            }
+        } else if (CACHE_DIRECTORY.size() and fetchInvokable(functions.at(name), constants, compiled)) {
+            ++invokables_from_cache;
             if (VERBOSE or DEBUG) {
-                cout << " (" << fun_bytes << " bytes at byte " << functions_section_size << ')' << endl;
+                cout << " (" << compiled.bytecode.size() << " bytes at byte " << functions_section_size << ", found in cache)" << endl;
             }
-        } catch (const string& e) {
-            cout << "fatal: error during function size count (pre-assembling): " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << e.what() << endl;
-            exit(1);
-        }
-
-        Program func(fun_bytes);
-        func.setdebug(DEBUG).setscream(SCREAM);
-        try {
-            assemble(func, functions.at(name));
-        } catch (const string& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const char*& e) {
-            cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
-            exit(1);
-        } catch (const std::out_of_range& e) {
-            cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble function '" << name << "' (" << e.what() << ')' << endl;
-            exit(1);
-        }
-
-        vector<unsigned> jumps = func.jumps();
-        vector<unsigned> jumps_absolute = func.jumpsAbsolute();
+        } else {
+            compiled = assembler::cache::Invokable();
 
-        vector<tuple<int, int> > local_jumps;
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            unsigned jmp = jumps[i];
-            local_jumps.push_back(tuple<int, int>(jmp, functions_section_size));
-        }
-        func.calculateJumps(local_jumps);
+            bytecode_size_type fun_bytes = 0;
+            try {
+                fun_bytes = Program::countBytes(name == ENTRY_FUNCTION_NAME ? filter(functions.at(name)) : functions.at(name));
+                if (VERBOSE or DEBUG) {
+                    cout << " (at most " << fun_bytes << " bytes at byte " << functions_section_size << ')' << endl;
+                }
+            } catch (const string& e) {
+                cout << "fatal: error during function size count (pre-assembling): " << e << endl;
+                exit(1);
+            } catch (const std::out_of_range& e) {
+                cout << e.what() << endl;
+                exit(1);
+            }
 
-        byte* btcode = func.bytecode();
+            Program func(fun_bytes);
+            func.setdebug(DEBUG).setscream(SCREAM).setconstants(&constants);
+            try {
+                assemble(func, functions.at(name));
+            } catch (const string& e) {
+                cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
+                exit(1);
+            } catch (const char*& e) {
+                cout << (DEBUG ? "\n" : "") << "fatal: error during assembling: " << e << endl;
+                exit(1);
+            } catch (const std::out_of_range& e) {
+                cout << (DEBUG ? "\n" : "") << "[asm] fatal: could not assemble function '" << name << "' (" << e.what() << ')' << endl;
+                exit(1);
+            }
 
-        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
-        functions_bytecode[name] = tuple<int, byte*>(func.size(), btcode);
+            // jumps are relative to the jumping instruction so local ones can be calculated right away
+            func.calculateJumps(func.jumps());
 
-        // extend jump table with jumps from current function
-        for (unsigned i = 0; i < jumps.size(); ++i) {
-            unsigned jmp = jumps[i];
-            if (DEBUG) {
-                cout << "[asm] debug: pushed relative jump to jump table: " << jmp << '+' << functions_section_size << endl;
+            compiled = compiledInvokable(func);
+            if (CACHE_DIRECTORY.size()) {
+                assembler::cache::store(invokableCachePath(functions.at(name)), assembler::cache::dump(compiled));
             }
-            jump_table.push_back(jmp+functions_section_size);
         }
 
+        // store generated bytecode fragment for future use (we must not yet write it to the file to conform to bytecode format)
+        functions_bytecode[name] = tuple<int, byte*>(compiled.bytecode.size(), placeInvokable(compiled, functions_section_size));
+
+        // absolute jumps can be calculated only when whole bytecode is available
+        vector<tuple<int, int> > jumps_absolute = compiled.jumps_absolute;
+        int jmp, jmp_instruction;
         for (unsigned i = 0; i < jumps_absolute.size(); ++i) {
+            tie(jmp, jmp_instruction) = jumps_absolute[i];
             if (DEBUG) {
-                cout << "[asm] debug: pushed absolute jump to jump table: " << jumps_absolute[i] << "+0" << endl;
+                cout << "[asm] debug: pushed absolute jump: " << jmp << '+' << functions_section_size << endl;
             }
-            jump_positions.push_back(tuple<int, int>(jumps_absolute[i]+functions_section_size, 0));
+            jump_positions.push_back(tuple<int, int>(jmp+functions_section_size, jmp_instruction+functions_section_size));
         }
 
-        functions_section_size += func.size();
+        functions_section_size += compiled.bytecode.size();
     }
 
 
-    //////////////////////////
-    // IF ASSEMBLING A LIBRARY
-    // WRITE OUT JUMP TABLE
-    if (AS_LIB) {
-        if (DEBUG) {
-            cout << "debug: jump table has " << jump_table.size() << " entries" << endl;
+    if ((VERBOSE or DEBUG) and CACHE_DIRECTORY.size()) {
+        cout << "[asm:cache] message: " << invokables_from_cache << " of " << (blocks_bytecode.size() + functions_bytecode.size()) << " functions and blocks found in cache" << endl;
+    }
+
+
+    ////////////////////////////////////////////
+    // LOCAL BYTECODE SIZE IS NOW KNOWN SO LINKED
+    // FUNCTIONS CAN BE PLACED AFTER IT
+    //
+    // FUNCTIONS AND BLOCKS OF LINKED MODULES THAT CANNOT BE REACHED
+    // FROM LOCAL CODE ARE LEFT OUT
+    bytecode_size_type current_link_offset = functions_section_size;
+    set<string> kept;
+    if (COLLECT_GARBAGE and linked_modules.size()) {
+        // every local function and block is kept so names they refer to are roots of reachability
+        vector<string> roots;
+        for (map<string, tuple<int, byte*> >* local : { &blocks_bytecode, &functions_bytecode }) {
+            for (pair<string, tuple<int, byte*>> invokable : *local) {
+                string code((const char*)get<1>(invokable.second), get<0>(invokable.second));
+                try {
+                    for (const Relocation& r : linker::scan(code, { Invokable{ invokable.first, SYMBOL_FUNCTION, 0, bytecode_size_type(code.size()) } })) {
+                        if (r.kind == RELOCATION_REFERENCE) {
+                            roots.push_back(r.symbol);
+                        }
+                    }
+                } catch (const string& e) {
+                    cout << "[asm:link] " << e << " of " << invokable.first << endl;
+                    return 1;
+                }
+            }
         }
-        unsigned total_jumps = jump_table.size();
-        out.write((const char*)&total_jumps, sizeof(unsigned));
+        kept = linker::reachable(linked_modules, roots);
+    }
 
-        unsigned jmp;
-        for (unsigned i = 0; i < total_jumps; ++i) {
-            jmp = jump_table[i];
-            out.write((const char*)&jmp, sizeof(unsigned));
+    string linked_bytecode;
+    vector<pair<string, bytecode_size_type> > linked_functions, linked_blocks;
+    for (const Module& module : linked_modules) {
+        if (PRINT_GC_SECTIONS and COLLECT_GARBAGE) {
+            for (const Invokable& invokable : module.invokables) {
+                if (not kept.count(invokable.name)) {
+                    cout << "[asm:gc] removing unused " << (invokable.kind == SYMBOL_BLOCK ? "block" : "function") << " '" << invokable.name << "' (" << invokable.size << " bytes) from " << module.path << endl;
+                }
+            }
         }
-    } else {
-        if (DEBUG) {
-            cout << "debug: skipping jump table write (not a library)" << endl;
+        // linked bytecode refers to literals by indexes of its own pool
+        try {
+            linker::place(module, (COLLECT_GARBAGE ? &kept : 0), linked_bytecode, constants, linked_functions, linked_blocks, current_link_offset);
+        } catch (const string& e) {
+            cout << "[asm:link] " << e << endl;
+            return 1;
         }
     }
 
+    linked_function_names.clear();
+    for (pair<string, bytecode_size_type> fn : linked_functions) {
+        function_addresses[fn.first] = fn.second;
+        linked_function_names.push_back(fn.first);
+    }
+    function_names.erase(remove_if(function_names.begin(), function_names.end(), [&function_addresses](const string& name) { return (function_addresses.count(name) == 0); }), function_names.end());
+    for (pair<string, bytecode_size_type> bl : linked_blocks) {
+        block_addresses[bl.first] = bl.second;
+        linked_block_names.push_back(bl.first);
+        block_names.push_back(bl.first);
+    }
+    bytes = (current_link_offset + linked_bytecode.size());
+    if (executable) {
+        starting_instruction = function_addresses.at(ENTRY_FUNCTION_NAME);
+    }
+
+
+    /////////////////////////////
+    // REPORT TOTAL BYTECODE SIZE
+    if ((VERBOSE or DEBUG) and linked_function_names.size() != 0) {
+        cout << "message: total required bytes: " << bytes << " bytes" << endl;
+    }
+    if (DEBUG) {
+        cout << "debug: required bytes: " << (bytes-(bytes-current_link_offset)) << " local" << endl;
+        cout << "debug: required bytes: " << (bytes-current_link_offset) << " linked" << endl;
+    }
+
+
+    ///////////////////////////
+    // REPORT FIRST INSTRUCTION
+    if ((VERBOSE or DEBUG) and executable) {
+        cout << "message: first instruction pointer: " << starting_instruction << endl;
+    }
+
 
     ///////////////////////////////////////////////
     // CHECK IF THE FUNCTION SET AS MAIN IS DEFINED
     // AS ALL THE FUNCTIONS (LOCAL OR LINKED) ARE
     // NOW AVAILABLE
-    if (find(function_names.begin(), function_names.end(), main_function) == function_names.end() and not AS_LIB) {
+    if (find(function_names.begin(), function_names.end(), main_function) == function_names.end() and executable) {
         cout << "[asm:pre] fatal: main function is undefined: " << main_function << endl;
         return 1;
     }
 
 
+    /////////////////////////////////////////////////////
+    // BYTECODE IS PUT TOGETHER BEFORE SECTIONS ARE WRITTEN
+    // AS RELOCATIONS OF OBJECTS ARE FOUND IN IT
+    byte* program_bytecode = new byte[bytes];
+    int program_bytecode_used = 0;
+
+    ///////////////////////////////////////////////////////
+    // WRITE BYTECODE OF LOCAL BLOCKS TO BYTECODE BUFFER
+    for (string name : block_names) {
+        // linked blocks are to be inserted later
+        if (find(linked_block_names.begin(), linked_block_names.end(), name) != linked_block_names.end()) { continue; }
+
+        if (DEBUG) {
+            cout << "[asm] pushing bytecode of local block '" << name << "' to final byte array" << endl;
+        }
+        int fun_size = 0;
+        byte* fun_bytecode = 0;
+        tie(fun_size, fun_bytecode) = blocks_bytecode[name];
+
+        for (int i = 0; i < fun_size; ++i) {
+            program_bytecode[program_bytecode_used+i] = fun_bytecode[i];
+        }
+        program_bytecode_used += fun_size;
+    }
+
+
+    ///////////////////////////////////////////////////////
+    // WRITE BYTECODE OF LOCAL FUNCTIONS TO BYTECODE BUFFER
+    for (string name : function_names) {
+        // linked functions are to be inserted later
+        if (find(linked_function_names.begin(), linked_function_names.end(), name) != linked_function_names.end()) { continue; }
+
+        if (DEBUG) {
+            cout << "[asm] pushing bytecode of local function '" << name << "' to final byte array" << endl;
+        }
+        int fun_size = 0;
+        byte* fun_bytecode = 0;
+        tie(fun_size, fun_bytecode) = functions_bytecode[name];
+
+        for (int i = 0; i < fun_size; ++i) {
+            program_bytecode[program_bytecode_used+i] = fun_bytecode[i];
+        }
+        program_bytecode_used += fun_size;
+    }
+
+    // free memory allocated for bytecode of local functions
+    for (pair<string, tuple<int, byte*>> fun : functions_bytecode) {
+        delete[] get<1>(fun.second);
+    }
+
+
+    ////////////////////////////////////
+    // WRITE STATICALLY LINKED LIBRARIES
+    //
+    // JUMPS LEAVING FUNCTIONS OF LINKED MODULES WERE
+    // ALREADY RELOCATED WHEN THE FUNCTIONS WERE PLACED
+    if ((VERBOSE or DEBUG) and linked_modules.size()) {
+        cout << "[linker] message: " << linked_functions.size() << " linked function(s) and " << linked_blocks.size() << " linked block(s) written at offset " << current_link_offset << endl;
+    }
+    for (unsigned i = 0; i < linked_bytecode.size(); ++i) {
+        program_bytecode[program_bytecode_used+i] = linked_bytecode[i];
+    }
+    program_bytecode_used += linked_bytecode.size();
+
+
+    //////////////////////////////////////////////////////////
+    // CALCULATE ABSOLUTE JUMPS
+    //
+    // THIS MUST BE DONE AFTER LINKED BYTECODE IS IN PLACE AS
+    // SIZES OF INSTRUCTIONS ARE READ FROM THE BYTECODE ITSELF
+    Program calculator(bytes);
+    calculator.setdebug(DEBUG).setscream(SCREAM);
+    if (DEBUG) {
+        cout << "[asm:post] calculating absolute jumps..." << endl;
+    }
+    calculator.fill(program_bytecode).calculateJumps(jump_positions);
+
+
+
     ////////////////////////////
     // PREPARE BLOCK IDS SECTION
-    uint16_t block_ids_section_size = 0;
+    bytecode_size_type block_ids_section_size = 0;
     for (string name : block_names) { block_ids_section_size += name.size(); }
-    // we need to insert address (uint16_t) after every block
-    block_ids_section_size += sizeof(uint16_t) * block_names.size();
+    // we need to insert address (bytecode_size_type) after every block
+    block_ids_section_size += sizeof(bytecode_size_type) * block_names.size();
     // for null characters after block names
     block_ids_section_size += block_names.size();
 
     /////////////////////////////////////////////
     // WRITE OUT BLOCK IDS SECTION
     // THIS ALSO INCLUDES IDS OF LINKED BLOCKS
-    out.write((const char*)&block_ids_section_size, sizeof(uint16_t));
-    uint16_t blocks_size_so_far = 0;
+    out.write((const char*)&block_ids_section_size, sizeof(bytecode_size_type));
+    map<string, bytecode_size_type> symtab_blocks;
     for (string name : block_names) {
         if (DEBUG) {
             cout << "[asm:write] writing block '" << name << "' to block address table";
@@ -1221,24 +1982,28 @@ int generate(const string& filename, string& compilename, const vector<string>&
         // ...requires terminating null character
         out.put('\0');
         // mapped address must come after name
-        out.write((const char*)&blocks_size_so_far, sizeof(uint16_t));
-        // blocks size must be incremented by the actual size of block's bytecode size
-        // to give correct offset for next block
-        try {
-            blocks_size_so_far += Program::countBytes(blocks.at(name));
-        } catch (const std::out_of_range& e) {
-            cout << "fatal: could not find block '" << name << "' during address table write" << endl;
-            exit(1);
-        }
+        bytecode_size_type address = block_addresses.at(name);
+        out.write((const char*)&address, sizeof(bytecode_size_type));
+        symtab_blocks[name] = address;
+    }
+    for (string name : linked_block_names) {
+        // block name...
+        out.write((const char*)name.c_str(), name.size());
+        // ...requires terminating null character
+        out.put('\0');
+        // mapped address must come after name
+        bytecode_size_type address = block_addresses.at(name);
+        out.write((const char*)&address, sizeof(bytecode_size_type));
+        symtab_blocks[name] = address;
     }
 
 
     ///////////////////////////////
     // PREPARE FUNCTION IDS SECTION
-    uint16_t function_ids_section_size = 0;
+    bytecode_size_type function_ids_section_size = 0;
     for (string name : function_names) { function_ids_section_size += name.size(); }
-    // we need to insert address (uint16_t) after every function
-    function_ids_section_size += sizeof(uint16_t) * function_names.size();
+    // we need to insert address (bytecode_size_type) after every function
+    function_ids_section_size += sizeof(bytecode_size_type) * function_names.size();
     // for null characters after function names
     function_ids_section_size += function_names.size();
 
@@ -1246,10 +2011,10 @@ int generate(const string& filename, string& compilename, const vector<string>&
     /////////////////////////////////////////////
     // WRITE OUT FUNCTION IDS SECTION
     // THIS ALSO INCLUDES IDS OF LINKED FUNCTIONS
-    out.write((const char*)&function_ids_section_size, sizeof(uint16_t));
-    uint16_t functions_size_so_far = blocks_size_so_far;
+    out.write((const char*)&function_ids_section_size, sizeof(bytecode_size_type));
+    map<string, bytecode_size_type> symtab_functions;
     if (DEBUG) {
-        cout << "[asm:write] function addresses are offset by " << functions_size_so_far << " bytes (size of the block address table)" << endl;
+        cout << "[asm:write] function addresses are offset by " << blocks_section_size << " bytes (size of the block address table)" << endl;
     }
     for (string name : function_names) {
         if (DEBUG) {
@@ -1270,15 +2035,9 @@ int generate(const string& filename, string& compilename, const vector<string>&
         // ...requires terminating null character
         out.put('\0');
         // mapped address must come after name
-        out.write((const char*)&functions_size_so_far, sizeof(uint16_t));
-        // functions size must be incremented by the actual size of function's bytecode size
-        // to give correct offset for next function
-        try {
-            functions_size_so_far += Program::countBytes(functions.at(name));
-        } catch (const std::out_of_range& e) {
-            cout << "fatal: could not find function '" << name << "' during address table write" << endl;
-            exit(1);
-        }
+        bytecode_size_type address = function_addresses.at(name);
+        out.write((const char*)&address, sizeof(bytecode_size_type));
+        symtab_functions[name] = address;
     }
     // FIXME: iteration over linked functions to put them to the address table
     //        should be done in the loop above (for local functions)
@@ -1288,108 +2047,73 @@ int generate(const string& filename, string& compilename, const vector<string>&
         // ...requires terminating null character
         out.put('\0');
         // mapped address must come after name
-        uint16_t address = function_addresses[name];
-        out.write((const char*)&address, sizeof(uint16_t));
+        bytecode_size_type address = function_addresses[name];
+        out.write((const char*)&address, sizeof(bytecode_size_type));
+        symtab_functions[name] = address;
     }
 
 
-    //////////////////////
-    // WRITE BYTECODE SIZE
-    out.write((const char*)&bytes, 16);
-
-    byte* program_bytecode = new byte[bytes];
-    int program_bytecode_used = 0;
-
-    ///////////////////////////////////////////////////////
-    // WRITE BYTECODE OF LOCAL BLOCKS TO BYTECODE BUFFER
-    for (string name : block_names) {
-        // linked blocks are to be inserted later
-        if (find(linked_block_names.begin(), linked_block_names.end(), name) != linked_block_names.end()) { continue; }
-
-        if (DEBUG) {
-            cout << "[asm] pushing bytecode of local block '" << name << "' to final byte array" << endl;
-        }
-        int fun_size = 0;
-        byte* fun_bytecode = 0;
-        tie(fun_size, fun_bytecode) = blocks_bytecode[name];
-
-        for (int i = 0; i < fun_size; ++i) {
-            program_bytecode[program_bytecode_used+i] = fun_bytecode[i];
-        }
-        program_bytecode_used += fun_size;
-    }
-
-
-    ///////////////////////////////////////////////////////
-    // WRITE BYTECODE OF LOCAL FUNCTIONS TO BYTECODE BUFFER
-    for (string name : function_names) {
-        // linked functions are to be inserted later
-        if (find(linked_function_names.begin(), linked_function_names.end(), name) != linked_function_names.end()) { continue; }
-
-        if (DEBUG) {
-            cout << "[asm] pushing bytecode of local function '" << name << "' to final byte array" << endl;
-        }
-        int fun_size = 0;
-        byte* fun_bytecode = 0;
-        tie(fun_size, fun_bytecode) = functions_bytecode[name];
-
-        for (int i = 0; i < fun_size; ++i) {
-            program_bytecode[program_bytecode_used+i] = fun_bytecode[i];
-        }
-        program_bytecode_used += fun_size;
+    /////////////////////////
+    // WRITE OUT SYMBOL TABLE
+    //
+    // OBJECTS ARE NEVER RUN SO THEY DO NOT NEED ONE
+    if (not AS_OBJECT) {
+        string symtab = SymbolTable::build(symtab_functions, symtab_blocks);
+        bytecode_size_type symtab_section_size = symtab.size();
+        out.write((const char*)&symtab_section_size, sizeof(bytecode_size_type));
+        out.write(symtab.c_str(), symtab.size());
     }
 
-    // free memory allocated for bytecode of local functions
-    for (pair<string, tuple<int, byte*>> fun : functions_bytecode) {
-        delete[] get<1>(fun.second);
-    }
 
-    Program calculator(bytes);
-    calculator.setdebug(DEBUG).setscream(SCREAM);
+    /////////////////////////
+    // WRITE OUT CONSTANT POOL
+    string constpool = constants.build();
+    bytecode_size_type constpool_section_size = constpool.size();
+    out.write((const char*)&constpool_section_size, sizeof(bytecode_size_type));
+    out.write(constpool.c_str(), constpool.size());
     if (DEBUG) {
-        cout << "[asm:post] calculating absolute jumps..." << endl;
+        cout << "[asm:write] constant pool: " << constants.size() << " entries in " << constpool_section_size << " bytes" << endl;
     }
-    calculator.fill(program_bytecode).calculateJumps(jump_positions);
 
 
-    ////////////////////////////////////
-    // WRITE STATICALLY LINKED LIBRARIES
-    // FIXME: implement this after we are able to load static libs
-    uint16_t bytes_offset = current_link_offset;
-    for (tuple<string, uint16_t, char*> lnk : linked_libs_bytecode) {
-        string lib_name;
-        byte* linked_bytecode;
-        uint16_t linked_size;
-        tie(lib_name, linked_size, linked_bytecode) = lnk;
+    ////////////////////////////
+    // WRITE OUT INLINED CODE
+    //
+    // STACK TRACES USE IT TO NAME FUNCTIONS WHOSE CODE
+    // WAS INLINED INTO THEIR CALLERS
+    if (not AS_OBJECT) {
+        string inlined_code_section = inlined::dump(locateInlined(inlined_ranges, function_addresses, program_bytecode));
+        bytecode_size_type inlined_code_section_size = inlined_code_section.size();
+        out.write((const char*)&inlined_code_section_size, sizeof(bytecode_size_type));
+        out.write(inlined_code_section.c_str(), inlined_code_section.size());
+    }
 
-        if (VERBOSE or DEBUG) {
-            cout << "[linker] message: linked module \"" << lib_name <<  "\" written at offset " << bytes_offset << endl;
-        }
 
-        vector<unsigned> linked_jumptable;
+    //////////////////////////
+    // WRITE OUT RELOCATIONS
+    //
+    // LINKER USES THEM TO MOVE AND REMOVE FUNCTIONS
+    if (AS_OBJECT) {
+        vector<Relocation> relocations;
         try {
-            linked_jumptable = linked_libs_jumptables[lib_name];
-        } catch (const std::out_of_range& e) {
-            cout << "[linker] fatal: could not find jumptable for '" << lib_name << "' (maybe not loaded?)" << endl;
-            exit(1);
-        }
-
-        unsigned jmp, jmp_target;
-        for (unsigned i = 0; i < linked_jumptable.size(); ++i) {
-            jmp = linked_jumptable[i];
-            jmp_target = *((unsigned*)(linked_bytecode+jmp));
-            if (DEBUG) {
-                cout << "[linker] adjusting jump: at position " << jmp << ", " << jmp_target << '+' << bytes_offset << " -> " << (jmp_target+bytes_offset) << endl;
-            }
-            *((int*)(linked_bytecode+jmp)) += bytes_offset;
+            relocations = linker::scan(string((const char*)program_bytecode, bytes), linker::invokables(symtab_functions, symtab_blocks, bytes));
+        } catch (const string& e) {
+            cout << "[asm:write] " << e << endl;
+            return 1;
         }
-
-        for (int i = 0; i < linked_size; ++i) {
-            program_bytecode[program_bytecode_used+i] = linked_bytecode[i];
+        string relocations_section = linker::dumpRelocations(relocations);
+        bytecode_size_type relocations_section_size = relocations_section.size();
+        out.write((const char*)&relocations_section_size, sizeof(bytecode_size_type));
+        out.write(relocations_section.c_str(), relocations_section.size());
+        if (DEBUG) {
+            cout << "[asm:write] relocations: " << relocations.size() << " entries in " << relocations_section_size << " bytes" << endl;
         }
-        program_bytecode_used += linked_size;
     }
 
+
+    //////////////////////
+    // WRITE BYTECODE SIZE
+    out.write((const char*)&bytes, sizeof(bytecode_size_type));
     out.write((const char*)program_bytecode, bytes);
     out.close();
 
@@ -1422,6 +2146,17 @@ bool usage(const char* program, bool SHOW_HELP, bool SHOW_VERSION, bool VERBOSE)
              << "    " << "    --Eempty-function    - treat empty function as error\n"
              << "    " << "    --Eopless-frame      - treat frames without operands as errors\n"
              << "    " << "-c, --lib                - assemble as a library\n"
+             << "    " << "    --object             - assemble a relocatable object to be linked with viua-ld\n"
+             << "    " << "    --no-gc              - keep functions and blocks of linked modules that are never used\n"
+             << "    " << "    --print-gc-sections  - report functions and blocks of linked modules that were left out\n"
+             << "    " << "    --cache <dir>        - reuse modules and functions assembled earlier, and keep their bytecode in <dir>\n"
+             << "    " << "-j, --jobs <n>           - assemble up to <n> functions and blocks in parallel\n"
+             << "    " << "-O0                      - do not optimize code (default)\n"
+             << "    " << "-O1                      - apply peephole optimizations to functions and blocks, and inline functions named by .inline:\n"
+             << "    " << "-O2                      - also propagate constants through functions, remove dead code, inline small functions,\n"
+             << "    " << "                           allocate registers, shrink frames of calls to local functions,\n"
+             << "    " << "                           and specialise integer instructions for types of their operands\n"
+             << "    " << "    --opt-report         - report every change made by optimizations\n"
              ;
     }
 
@@ -1455,6 +2190,15 @@ int main(int argc, char* argv[]) {
         } else if (option == "--lib" or option == "-c") {
             AS_LIB = true;
             continue;
+        } else if (option == "--object") {
+            AS_OBJECT = true;
+            continue;
+        } else if (option == "--no-gc") {
+            COLLECT_GARBAGE = false;
+            continue;
+        } else if (option == "--print-gc-sections") {
+            PRINT_GC_SECTIONS = true;
+            continue;
         } else if (option == "--Wall" or option == "-W") {
             WARNING_ALL = true;
             continue;
@@ -1485,6 +2229,34 @@ int main(int argc, char* argv[]) {
         } else if (option == "--Eglobals-in-lib") {
             ERROR_GLOBALS_IN_LIB = true;
             continue;
+        } else if (option == "--cache") {
+            if (i < argc-1) {
+                CACHE_DIRECTORY = string(argv[++i]);
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: directory" << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "--jobs" or option == "-j") {
+            if (i < argc-1 and str::isnum(argv[i+1]) and stoi(argv[i+1]) > 0) {
+                JOBS = stoi(argv[++i]);
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: positive number of jobs" << endl;
+                exit(1);
+            }
+            continue;
+        } else if (option == "-O0") {
+            OPTIMIZATION_LEVEL = 0;
+            continue;
+        } else if (option == "-O1") {
+            OPTIMIZATION_LEVEL = 1;
+            continue;
+        } else if (option == "-O2") {
+            OPTIMIZATION_LEVEL = 2;
+            continue;
+        } else if (option == "--opt-report") {
+            OPTIMIZATION_REPORT = true;
+            continue;
         } else if (option == "--out" or option == "-o") {
             if (i < argc-1) {
                 compilename = string(argv[++i]);
@@ -1513,7 +2285,9 @@ int main(int argc, char* argv[]) {
     }
 
     if (compilename == "") {
-        if (AS_LIB) {
+        if (AS_OBJECT) {
+            compilename = (filename + ".vo");
+        } else if (AS_LIB) {
             compilename = (filename + ".wlib");
         } else {
             compilename = "a.out";
@@ -1532,7 +2306,33 @@ int main(int argc, char* argv[]) {
         commandline_given_links.push_back(args[i]);
     }
 
+    ///////////////////////////////////////////
+    // REUSE IMAGE FOUND IN CACHE
+    //
+    // UNCHANGED MODULE IS NEITHER VERIFIED NOR
+    // ASSEMBLED AGAIN, AND ITS LINKS ARE NOT LOADED
+    string image_cache_path = "";
+    if (CACHE_DIRECTORY.size()) {
+        mkdir(CACHE_DIRECTORY.c_str(), 0755);
+        image_cache_path = imageCachePath(filename, commandline_given_links);
+
+        string image;
+        if (image_cache_path.size() and assembler::cache::fetch(image_cache_path, image)) {
+            if (VERBOSE or DEBUG) {
+                cout << "[asm:cache] message: image found in cache: " << image_cache_path << endl;
+            }
+            ofstream out(compilename, ios::out | ios::binary);
+            out.write(image.data(), image.size());
+            return 0;
+        }
+    }
+
     int ret_code = generate(filename, compilename, commandline_given_links);
 
+    string image;
+    if (ret_code == 0 and image_cache_path.size() and assembler::cache::fetch(compilename, image)) {
+        assembler::cache::store(image_cache_path, image);
+    }
+
     return ret_code;
 }
@@ -7,6 +7,7 @@
 #include <viua/version.h>
 #include <viua/support/string.h>
 #include <viua/loader.h>
+#include <viua/inlined.h>
 #include <viua/cpu/cpu.h>
 #include <viua/program.h>
 #include <viua/printutils.h>
@@ -20,6 +21,7 @@ const char* NOTE_LOADED_ASM = "note: seems like you have loaded an .asm file whi
 bool SHOW_HELP = false;
 bool SHOW_VERSION = false;
 bool VERBOSE = false;
+bool USE_MMAP = true;
 
 
 bool usage(const char* program, bool SHOW_HELP, bool SHOW_VERSION, bool VERBOSE) {
@@ -36,6 +38,7 @@ bool usage(const char* program, bool SHOW_HELP, bool SHOW_VERSION, bool VERBOSE)
         cout << "    " << "-V, --version            - show version\n"
              << "    " << "-h, --help               - display this message\n"
              << "    " << "-v, --verbose            - show verbose output\n"
+             << "    " << "    --no-mmap            - read executable into memory instead of mapping it\n"
              ;
     }
 
@@ -57,6 +60,9 @@ int main(int argc, char* argv[]) {
         } else if (option == "--verbose") {
             VERBOSE = true;
             continue;
+        } else if (option == "--no-mmap") {
+            USE_MMAP = false;
+            continue;
         }
         args.push_back(argv[i]);
     }
@@ -77,17 +83,51 @@ int main(int argc, char* argv[]) {
     }
 
     Loader loader(filename);
-    loader.executable();
+    try {
+        loader.useMmap(USE_MMAP).executable();
+    } catch (const string& e) {
+        cout << e << endl;
+        return 1;
+    }
 
-    uint16_t bytes = loader.getBytecodeSize();
-    byte* bytecode = loader.getBytecode();
+    bytecode_size_type bytes = loader.getBytecodeSize();
+
+    vector<InlinedCode> inlined_code;
+    try {
+        string inlined_code_section = loader.getInlinedCode();
+        inlined_code = inlined::load(inlined_code_section.data(), inlined_code_section.size());
+    } catch (const string& e) {
+        cout << e << endl;
+        return 1;
+    }
 
     CPU cpu;
 
-    map<string, uint16_t> function_address_mapping = loader.getFunctionAddresses();
-    uint16_t starting_instruction = function_address_mapping["__entry"];
-    for (auto p : function_address_mapping) { cpu.mapfunction(p.first, p.second); }
-    for (auto p : loader.getBlockAddresses()) { cpu.mapblock(p.first, p.second); }
+    byte* bytecode = 0;
+    if (loader.isMapped()) {
+        void* image = 0;
+        size_t image_size = 0;
+        bytecode = loader.getBytecodeInPlace();
+        tie(image, image_size) = loader.detachImage();
+        cpu.mapimage(bytecode, image, image_size);
+    } else {
+        bytecode = loader.getBytecode();
+    }
+    cpu.constpool(bytecode, bytes, loader.getConstantPool());
+
+    bytecode_size_type starting_instruction = 0;
+    if (loader.isMapped() and loader.hasSymbolTable()) {
+        // symbol table lives in the mapped image owned by the CPU so
+        // functions and blocks are looked up in it lazily instead of being mapped up front
+        SymbolTable symbol_table = loader.getSymbolTable();
+        symbol_table.lookup("__entry", SYMBOL_FUNCTION, starting_instruction);
+        cpu.symtab(symbol_table).mapfunction("__entry", starting_instruction);
+    } else {
+        map<string, bytecode_size_type> function_address_mapping = loader.getFunctionAddresses();
+        starting_instruction = function_address_mapping["__entry"];
+        for (auto p : function_address_mapping) { cpu.mapfunction(p.first, p.second); }
+        for (auto p : loader.getBlockAddresses()) { cpu.mapblock(p.first, p.second); }
+    }
 
     vector<string> cmdline_args;
     for (int i = 1; i < argc; ++i) {
@@ -102,6 +142,18 @@ int main(int argc, char* argv[]) {
     string return_exception = "", return_message = "";
     tie(ret_code, return_exception, return_message) = cpu.exitcondition();
 
+    if (VERBOSE) {
+        for (auto stats : cpu.linkstats()) {
+            unsigned functions = 0, all_functions = 0, blocks = 0, all_blocks = 0;
+            tie(functions, all_functions, blocks, all_blocks) = stats.second;
+            cout << "[cpu] message: module \"" << stats.first << "\": materialized " << functions << " of " << all_functions << " functions";
+            if (all_blocks) {
+                cout << " and " << blocks << " of " << all_blocks << " blocks";
+            }
+            cout << endl;
+        }
+    }
+
     if (ret_code != 0 and return_exception.size()) {
         cout << "exception after " << cpu.counter() << " ticks" << endl;
         cout << "uncaught object: " << return_exception << " = " << return_message << endl;
@@ -110,8 +162,17 @@ int main(int argc, char* argv[]) {
         vector<Frame*> trace = cpu.trace();
         cout << "stack trace: from entry point, most recent call last...\n";
         for (unsigned i = 1; i < trace.size(); ++i) {
+            // frames replaced by tail calls are gone, only their number is known
+            if (trace[i]->elided_frames) {
+                cout << "  ... " << trace[i]->elided_frames << " frame" << (trace[i]->elided_frames == 1 ? "" : "s") << " elided by tail calls\n";
+            }
             cout << "  " << stringifyFunctionInvocation(trace[i]) << "\n";
         }
+        // code of functions inlined by the assembler runs in frames of their callers
+        InlinedCode inlined_function;
+        if (cpu.address() >= bytecode and cpu.address() < (bytecode+bytes) and inlined::find(inlined_code, (cpu.address()-bytecode), inlined_function)) {
+            cout << "  " << inlined_function.function << '/' << inlined_function.arity << " (inlined)\n";
+        }
         cout << "\n";
         cout << "frame details:\n";
 
@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <tuple>
@@ -114,18 +115,19 @@ int main(int argc, char* argv[]) {
     Loader loader(filename);
     loader.executable();
 
-    uint16_t bytes = loader.getBytecodeSize();
+    bytecode_size_type bytes = loader.getBytecodeSize();
     byte* bytecode = loader.getBytecode();
+    ConstantPool constants = loader.getConstantPool();
 
-    map<string, uint16_t> function_address_mapping = loader.getFunctionAddresses();
+    map<string, bytecode_size_type> function_address_mapping = loader.getFunctionAddresses();
     vector<string> functions = loader.getFunctions();
     map<string, unsigned> function_sizes = loader.getFunctionSizes();
 
-    map<string, uint16_t> block_address_mapping = loader.getBlockAddresses();
+    map<string, bytecode_size_type> block_address_mapping = loader.getBlockAddresses();
     vector<string> blocks = loader.getBlocks();
     map<string, unsigned> block_sizes;
 
-    map<string, uint16_t> element_address_mapping;
+    map<string, bytecode_size_type> element_address_mapping;
     vector<string> elements;
     map<string, unsigned> element_sizes;
     map<string, string> element_types;
@@ -203,7 +205,7 @@ int main(int argc, char* argv[]) {
             string instruction;
             try {
                 unsigned size;
-                tie(instruction, size) = disassembler::instruction((bytecode+element_address_mapping[name]+j));
+                tie(instruction, size) = disassembler::instruction((bytecode+element_address_mapping[name]+j), (element_address_mapping[name]+j), &constants);
                 oss << "    " << instruction << '\n';
                 j += size;
             } catch (const out_of_range& e) {
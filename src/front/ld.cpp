@@ -0,0 +1,266 @@
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <thread>
+#include <utility>
+#include <viua/bytecode/format.h>
+#include <viua/support/string.h>
+#include <viua/version.h>
+#include <viua/symtab.h>
+#include <viua/constpool.h>
+#include <viua/linker.h>
+using namespace std;
+
+
+// MISC FLAGS
+bool SHOW_HELP = false;
+bool SHOW_VERSION = false;
+bool VERBOSE = false;
+
+// are we linking a library?
+bool AS_LIB = false;
+// should functions and blocks unreachable from the entry function be removed?
+bool COLLECT_GARBAGE = true;
+bool PRINT_GC_SECTIONS = false;
+
+// number of modules loaded at the same time
+unsigned JOBS = 1;
+
+
+// LINKING CONSTANTS
+const string ENTRY_FUNCTION_NAME = "__entry";
+
+
+bool usage(const char* program, bool SHOW_HELP, bool SHOW_VERSION, bool VERBOSE) {
+    if (SHOW_HELP or (SHOW_VERSION and VERBOSE)) {
+        cout << "Viua VM linker, version ";
+    }
+    if (SHOW_HELP or SHOW_VERSION) {
+        cout << VERSION << '.' << MICRO << ' ' << COMMIT << endl;
+    }
+    if (SHOW_HELP) {
+        cout << "\nUSAGE:\n";
+        cout << "    " << program << " [option...] [-o <outfile>] <infile>...\n" << endl;
+        cout << "OPTIONS:\n";
+        cout << "    " << "-V, --version            - show version\n"
+             << "    " << "-h, --help               - display this message\n"
+             << "    " << "-v, --verbose            - show verbose output\n"
+             << "    " << "-o, --out <file>         - output to given path (by default a.out)\n"
+             << "    " << "-c, --lib                - link a library instead of an executable\n"
+             << "    " << "-j, --jobs <n>           - load up to <n> input modules in parallel\n"
+             << "    " << "    --no-gc              - keep functions and blocks unreachable from the entry function\n"
+             << "    " << "    --print-gc-sections  - report functions and blocks that were removed\n"
+             ;
+    }
+
+    return (SHOW_HELP or SHOW_VERSION);
+}
+
+
+static void loadModules(const vector<string>& paths, vector<Module>& modules) {
+    /** Load modules to be linked.
+     *
+     *  Inputs are independent of each other so up to JOBS of them are loaded at the same time.
+     *  First error (in order of inputs) is rethrown after all workers finish.
+     */
+    modules.resize(paths.size());
+    vector<string> errors(paths.size());
+
+    unsigned workers = (JOBS < paths.size() ? JOBS : paths.size());
+    vector<thread> pool;
+    for (unsigned w = 0; w < workers; ++w) {
+        pool.push_back(thread([&paths, &modules, &errors, w, workers]() {
+            for (unsigned i = w; i < paths.size(); i += workers) {
+                try {
+                    modules[i] = Module::load(paths[i]);
+                } catch (const string& e) {
+                    errors[i] = (e.size() ? e : ("fatal: could not load " + paths[i]));
+                } catch (const char* e) {
+                    errors[i] = e;
+                }
+            }
+        }));
+    }
+    for (thread& t : pool) {
+        t.join();
+    }
+
+    for (string e : errors) {
+        if (e.size()) {
+            throw e;
+        }
+    }
+}
+
+static void writeIds(ofstream& out, const vector<pair<string, bytecode_size_type> >& ids) {
+    bytecode_size_type section_size = 0;
+    for (pair<string, bytecode_size_type> id : ids) {
+        // name, its terminating null character, and address
+        section_size += (id.first.size() + 1 + sizeof(bytecode_size_type));
+    }
+    out.write((const char*)&section_size, sizeof(bytecode_size_type));
+    for (pair<string, bytecode_size_type> id : ids) {
+        out.write(id.first.c_str(), id.first.size());
+        out.put('\0');
+        out.write((const char*)&id.second, sizeof(bytecode_size_type));
+    }
+}
+
+static void writeSection(ofstream& out, const string& section) {
+    bytecode_size_type section_size = section.size();
+    out.write((const char*)&section_size, sizeof(bytecode_size_type));
+    out.write(section.data(), section.size());
+}
+
+
+int link(const vector<string>& inputs, const string& output) {
+    vector<Module> modules;
+    loadModules(inputs, modules);
+
+    map<string, string> definitions;
+    for (const Module& module : modules) {
+        for (const Invokable& invokable : module.invokables) {
+            if (definitions.count(invokable.name)) {
+                cout << "fatal: duplicate symbol '" << invokable.name << "': defined in " << definitions.at(invokable.name) << " and " << module.path << endl;
+                return 1;
+            }
+            definitions[invokable.name] = module.path;
+        }
+    }
+
+    if (not AS_LIB and not definitions.count(ENTRY_FUNCTION_NAME)) {
+        cout << "fatal: no entry function: none of the inputs defines main function" << endl;
+        return 1;
+    }
+
+    set<string> kept;
+    if (COLLECT_GARBAGE) {
+        vector<string> roots;
+        if (AS_LIB) {
+            // every function of a library may be called by modules it is linked with
+            for (const Module& module : modules) {
+                for (const Invokable& invokable : module.invokables) {
+                    if (invokable.kind == SYMBOL_FUNCTION) {
+                        roots.push_back(invokable.name);
+                    }
+                }
+            }
+        } else {
+            roots.push_back(ENTRY_FUNCTION_NAME);
+        }
+        kept = linker::reachable(modules, roots);
+
+        for (const Module& module : modules) {
+            for (const Invokable& invokable : module.invokables) {
+                if (PRINT_GC_SECTIONS and not kept.count(invokable.name)) {
+                    cout << "[ld:gc] removing unused " << (invokable.kind == SYMBOL_BLOCK ? "block" : "function") << " '" << invokable.name << "' (" << invokable.size << " bytes) from " << module.path << endl;
+                }
+            }
+        }
+    }
+
+    string bytecode;
+    ConstantPoolBuilder constants;
+    vector<pair<string, bytecode_size_type> > functions, blocks;
+    // entry function is placed first so that executables start at byte 0
+    for (unsigned pass = 0; pass < 2; ++pass) {
+        for (const Module& module : modules) {
+            bool has_entry = false;
+            for (const Invokable& invokable : module.invokables) {
+                has_entry = (has_entry or invokable.name == ENTRY_FUNCTION_NAME);
+            }
+            if (has_entry == (pass == 0)) {
+                linker::place(module, (COLLECT_GARBAGE ? &kept : 0), bytecode, constants, functions, blocks);
+            }
+        }
+    }
+
+    if (VERBOSE) {
+        cout << "[ld] message: linked " << functions.size() << " function(s) and " << blocks.size() << " block(s) from " << modules.size() << " module(s)";
+        cout << " (" << bytecode.size() << " bytes of bytecode, " << constants.size() << " constant(s))" << endl;
+    }
+
+    map<string, bytecode_size_type> symtab_functions(functions.begin(), functions.end());
+    map<string, bytecode_size_type> symtab_blocks(blocks.begin(), blocks.end());
+
+    ofstream out(output, ios::out | ios::binary);
+    if (not out) {
+        cout << "fatal: could not open output file: " << output << endl;
+        return 1;
+    }
+    out.write(VIUA_MAGIC_NUMBER, VIUA_MAGIC_NUMBER_SIZE);
+    out.put(static_cast<char>(VIUA_BYTECODE_VERSION));
+    writeIds(out, blocks);
+    writeIds(out, functions);
+    writeSection(out, SymbolTable::build(symtab_functions, symtab_blocks));
+    writeSection(out, constants.build());
+    // objects carry no inlined code
+    writeSection(out, string());
+    writeSection(out, bytecode);
+    out.close();
+
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    vector<string> args;
+    string option;
+
+    string output = "a.out";
+    for (int i = 1; i < argc; ++i) {
+        option = string(argv[i]);
+        if (option == "--help" or option == "-h") {
+            SHOW_HELP = true;
+        } else if (option == "--version" or option == "-V") {
+            SHOW_VERSION = true;
+        } else if (option == "--verbose" or option == "-v") {
+            VERBOSE = true;
+        } else if (option == "--lib" or option == "-c") {
+            AS_LIB = true;
+        } else if (option == "--no-gc") {
+            COLLECT_GARBAGE = false;
+        } else if (option == "--print-gc-sections") {
+            PRINT_GC_SECTIONS = true;
+        } else if (option == "--out" or option == "-o") {
+            if (i < argc-1) {
+                output = string(argv[++i]);
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: filename" << endl;
+                exit(1);
+            }
+        } else if (option == "--jobs" or option == "-j") {
+            if (i < argc-1 and str::isnum(argv[i+1]) and stoi(argv[i+1]) > 0) {
+                JOBS = stoi(argv[++i]);
+            } else {
+                cout << "error: option '" << argv[i] << "' requires an argument: positive number of jobs" << endl;
+                exit(1);
+            }
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (usage(argv[0], SHOW_HELP, SHOW_VERSION, VERBOSE)) { return 0; }
+
+    if (args.size() == 0) {
+        cout << "fatal: no input file" << endl;
+        return 1;
+    }
+
+    int ret_code = 0;
+    try {
+        ret_code = link(args, output);
+    } catch (const string& e) {
+        cout << e << endl;
+        ret_code = 1;
+    } catch (const char* e) {
+        cout << e << endl;
+        ret_code = 1;
+    }
+    return ret_code;
+}
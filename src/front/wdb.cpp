@@ -93,7 +93,7 @@ OPCODE printInstruction(const CPU& cpu) {
 
     string instruction;
     unsigned size;
-    tie(instruction, size) = disassembler::instruction(iptr);
+    tie(instruction, size) = disassembler::instruction(iptr, (iptr-cpu.bytecode), &get<1>(cpu.constant_pools.at(cpu.bytecode)));
 
     cout << "byte " << (iptr-cpu.bytecode) << hex << " (0x" << (iptr-cpu.bytecode) << ") ";
     cout << "at 0x" << long(iptr) << dec << ": ";
@@ -218,8 +218,9 @@ tuple<bool, string> if_breakpoint_function(CPU& cpu, vector<string>& breakpoints
 
     string op_name = OP_NAMES.at(OPCODE(*cpu.instruction_pointer));
 
-    if (op_name == "call" or op_name == "excall") {
-        string function_name = string(cpu.instruction_pointer+1+sizeof(bool)+sizeof(int));
+    if (op_name == "call" or op_name == "excall" or op_name == "tailcall") {
+        // tail calls have no return register operand before function name
+        string function_name = string(cpu.instruction_pointer+1+(op_name == "tailcall" ? 0 : sizeof(bool)+sizeof(int)));
         if (find(breakpoints_function.begin(), breakpoints_function.end(), function_name) != breakpoints_function.end()) {
             reason << "info: execution halted by function breakpoint: " << function_name;
             pause = true;
@@ -244,6 +245,7 @@ tuple<bool, string> if_watchpoint_local_register_write(CPU& cpu, const State& st
         opcode == PARAM or
         opcode == PAREF or
         opcode == CALL or
+        opcode == TAILCALL or
         opcode == JUMP or
         opcode == BRANCH or
         opcode == END or
@@ -262,9 +264,15 @@ tuple<bool, string> if_watchpoint_local_register_write(CPU& cpu, const State& st
         opcode == FSTORE or
         opcode == BSTORE or
         opcode == STRSTORE or
+        opcode == STRBUILD or
+        opcode == STRAPPEND or
+        opcode == STRAPPENDR or
+        opcode == STRSUB or
+        opcode == ATOM or
         opcode == VEC or
         opcode == VINSERT or
         opcode == VPUSH or
+        opcode == VSLICE or
         opcode == BOOL or
         opcode == NOT or
         opcode == FREE or
@@ -274,10 +282,23 @@ tuple<bool, string> if_watchpoint_local_register_write(CPU& cpu, const State& st
         register_index[0] = *(int*)(register_index_ptr+1);
         writes_to = 1;
     } else if (opcode == ITOF or
+               opcode == FADDI or
+               opcode == FSUBI or
+               opcode == FMULI or
+               opcode == FDIVI or
+               opcode == FLTI or
+               opcode == FLTEI or
+               opcode == FGTI or
+               opcode == FGTEI or
+               opcode == FEQI or
                opcode == FTOI or
                opcode == STOI or
                opcode == STOF or
+               opcode == STRFINAL or
+               opcode == STRLEN or
                opcode == VLEN or
+               opcode == VSLEN or
+               opcode == VSMAT or
                opcode == MOVE or
                opcode == COPY or
                opcode == REF or
@@ -295,6 +316,33 @@ tuple<bool, string> if_watchpoint_local_register_write(CPU& cpu, const State& st
                opcode == IGT or
                opcode == IGTE or
                opcode == IEQ or
+               opcode == IADDI or
+               opcode == ISUBI or
+               opcode == IMULI or
+               opcode == IDIVI or
+               opcode == ILTI or
+               opcode == ILTEI or
+               opcode == IGTI or
+               opcode == IGTEI or
+               opcode == IEQI or
+               opcode == TIADD or
+               opcode == TISUB or
+               opcode == TIMUL or
+               opcode == TIDIV or
+               opcode == TILT or
+               opcode == TILTE or
+               opcode == TIGT or
+               opcode == TIGTE or
+               opcode == TIEQ or
+               opcode == GIADD or
+               opcode == GISUB or
+               opcode == GIMUL or
+               opcode == GIDIV or
+               opcode == GILT or
+               opcode == GILTE or
+               opcode == GIGT or
+               opcode == GIGTE or
+               opcode == GIEQ or
                opcode == FADD or
                opcode == FSUB or
                opcode == FMUL or
@@ -311,7 +359,14 @@ tuple<bool, string> if_watchpoint_local_register_write(CPU& cpu, const State& st
                opcode == BGT or
                opcode == BGTE or
                opcode == BEQ or
+               opcode == STREQ or
+               opcode == STRADD or
+               opcode == STRFIND or
+               opcode == STRCMP or
+               opcode == STRSPLIT or
+               opcode == ATOMEQ or
                opcode == VAT or
+               opcode == VSAT or
                opcode == AND or
                opcode == OR
                ) {
@@ -579,7 +634,7 @@ bool command_dispatch(string& command, vector<string>& operands, CPU& cpu, State
             while (j > 0) {
                 string instruction;
                 unsigned size;
-                tie(instruction, size) = disassembler::instruction(cpu.instruction_pointer);
+                tie(instruction, size) = disassembler::instruction(cpu.instruction_pointer, (cpu.instruction_pointer-cpu.bytecode), &get<1>(cpu.constant_pools.at(cpu.bytecode)));
                 cpu.instruction_pointer += size;
                 --j;
             }
@@ -912,16 +967,17 @@ int main(int argc, char* argv[]) {
     Loader loader(filename);
     loader.executable();
 
-    uint16_t bytes = loader.getBytecodeSize();
+    bytecode_size_type bytes = loader.getBytecodeSize();
     byte* bytecode = loader.getBytecode();
 
     cout << "bytecode size: " << bytes << endl;
 
     CPU cpu;
     cpu.debug = true;
+    cpu.constpool(bytecode, bytes, loader.getConstantPool());
 
-    map<string, uint16_t> function_address_mapping = loader.getFunctionAddresses();
-    uint16_t starting_instruction = function_address_mapping["__entry"];
+    map<string, bytecode_size_type> function_address_mapping = loader.getFunctionAddresses();
+    bytecode_size_type starting_instruction = function_address_mapping["__entry"];
     for (auto p : function_address_mapping) { cpu.mapfunction(p.first, p.second); }
     for (auto p : loader.getBlockAddresses()) { cpu.mapblock(p.first, p.second); }
 
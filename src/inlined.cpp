@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <viua/inlined.h>
+using namespace std;
+
+
+string inlined::dump(const vector<InlinedCode>& code) {
+    /** Return inlined code section of an image (without its size field).
+     */
+    string section;
+    for (const InlinedCode& each : code) {
+        for (uint32_t field : { each.begin, each.end, each.arity }) {
+            section.append((const char*)&field, sizeof(uint32_t));
+        }
+        section.append(each.function);
+        section.push_back('\0');
+    }
+    return section;
+}
+
+vector<InlinedCode> inlined::load(const char* section, bytecode_size_type size) {
+    /** Parse inlined code section of an image.
+     */
+    vector<InlinedCode> code;
+    bytecode_size_type i = 0;
+    while (i < size) {
+        if ((size - i) <= (3 * sizeof(uint32_t)) or memchr(section+i+(3 * sizeof(uint32_t)), '\0', size-i-(3 * sizeof(uint32_t))) == 0) {
+            throw string("fatal: malformed inlined code section");
+        }
+        uint32_t fields[3];
+        memcpy(fields, section+i, sizeof(fields));
+        string function(section+i+sizeof(fields));
+        code.push_back(InlinedCode{ fields[0], fields[1], fields[2], function });
+        i += (sizeof(fields) + function.size() + 1);
+    }
+    return code;
+}
+
+bool inlined::find(const vector<InlinedCode>& code, bytecode_size_type offset, InlinedCode& found) {
+    /** Find inlined code containing instruction at given offset.
+     */
+    vector<InlinedCode>::const_iterator after = upper_bound(code.begin(), code.end(), offset, [](bytecode_size_type o, const InlinedCode& each) { return (o < each.begin); });
+    if (after == code.begin() or offset >= (after-1)->end) {
+        return false;
+    }
+    found = *(after-1);
+    return true;
+}
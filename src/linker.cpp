@@ -0,0 +1,371 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <viua/bytecode/bytetypedef.h>
+#include <viua/bytecode/opcodes.h>
+#include <viua/bytecode/maps.h>
+#include <viua/bytecode/operands.h>
+#include <viua/loader.h>
+#include <viua/linker.h>
+using namespace std;
+
+
+static void appendField(string& out, uint32_t value) {
+    out.append((const char*)&value, sizeof(uint32_t));
+}
+
+static int readInt(const string& s, bytecode_size_type position) {
+    int value;
+    memcpy(&value, s.data()+position, sizeof(int));
+    return value;
+}
+
+static void writeInt(string& s, bytecode_size_type position, int value) {
+    memcpy(&s[position], &value, sizeof(int));
+}
+
+static unsigned decode(const string& bytecode, bytecode_size_type offset, vector<string>& strings) {
+    /** Return size of instruction at given offset, and append strings it carries.
+     */
+    const byte* code = bytecode.data();
+    bytecode_size_type size = bytecode.size();
+
+    OPCODE op = OPCODE(code[offset]);
+    string opname;
+    unsigned inc = 0;
+    try {
+        opname = OP_NAMES.at(op);
+        inc = OP_SIZES.at(opname);
+        if (OP_INTEGER_OPERANDS.at(opname) and (offset+1) < size) {
+            inc += operands::widening(code[offset+1]);
+        }
+    } catch (const std::out_of_range& e) {
+        ostringstream oss;
+        oss << "fatal: invalid instruction at byte " << offset;
+        throw oss.str();
+    }
+    if (inc > (size - offset)) {
+        ostringstream oss;
+        oss << "fatal: truncated instruction at byte " << offset;
+        throw oss.str();
+    }
+
+    // strings are placed after integer operands
+    unsigned count = 0;
+    if ((op == EXIMPORT) or (op == TRY) or (op == LINK) or (op == CALL) or (op == TAILCALL) or (op == EXCALL) or (op == CLOSURE) or (op == FUNCTION)) {
+        count = 1;
+    } else if (op == CATCH) {
+        count = 2;
+    }
+    for (unsigned i = 0; i < count; ++i) {
+        const void* nul = memchr(code+offset+inc, '\0', (size - (offset+inc)));
+        if (nul == 0) {
+            ostringstream oss;
+            oss << "fatal: truncated instruction at byte " << offset;
+            throw oss.str();
+        }
+        strings.push_back(string(code+offset+inc));
+        inc += (strings.back().size() + 1);
+    }
+    return inc;
+}
+
+
+unsigned Module::at(bytecode_size_type offset) const {
+    /** Return index of function or block containing given bytecode offset.
+     *
+     *  Returns number of invokables if the offset lies outside of all of them.
+     */
+    vector<Invokable>::const_iterator found = upper_bound(invokables.begin(), invokables.end(), offset, [](bytecode_size_type o, const Invokable& i) { return (o < i.address); });
+    if (found == invokables.begin() or offset >= ((found-1)->address + (found-1)->size)) {
+        return invokables.size();
+    }
+    return ((found-1) - invokables.begin());
+}
+
+vector<string> Module::references(unsigned index) const {
+    /** Return names of functions and blocks the invokable with given index refers to.
+     *
+     *  Targets of jumps leaving the invokable are included.
+     */
+    vector<string> refs;
+    const Invokable& invokable = invokables.at(index);
+    vector<Relocation>::const_iterator first = lower_bound(relocations.begin(), relocations.end(), invokable.address, [](const Relocation& r, bytecode_size_type o) { return (r.instruction < o); });
+    for (vector<Relocation>::const_iterator r = first; r != relocations.end() and r->instruction < (invokable.address + invokable.size); ++r) {
+        if (r->kind == RELOCATION_REFERENCE) {
+            refs.push_back(r->symbol);
+        } else {
+            unsigned target = at(r->instruction + readInt(bytecode, r->position));
+            if (target < invokables.size()) {
+                refs.push_back(invokables[target].name);
+            }
+        }
+    }
+    return refs;
+}
+
+Module Module::load(const string& path) {
+    /** Load module to be linked.
+     *
+     *  Both relocatable objects and images (e.g. libraries) can be linked.
+     */
+    Loader loader(path);
+    loader.load();
+
+    Module module;
+    module.path = path;
+    module.bytecode = string((const char*)loader.getBytecodeInPlace(), loader.getBytecodeSize());
+    module.constants = loader.getConstantPool();
+    module.invokables = linker::invokables(loader.getFunctionAddresses(), loader.getBlockAddresses(), loader.getBytecodeSize());
+
+    if (loader.isRelocatable()) {
+        string relocations = loader.getRelocations();
+        module.relocations = linker::loadRelocations(relocations.data(), relocations.size());
+        stable_sort(module.relocations.begin(), module.relocations.end(), [](const Relocation& a, const Relocation& b) { return (a.instruction < b.instruction); });
+    } else {
+        module.relocations = linker::scan(module.bytecode, module.invokables);
+    }
+    for (const Relocation& r : module.relocations) {
+        if (r.instruction >= module.bytecode.size() or r.kind > RELOCATION_REFERENCE or
+            (r.kind == RELOCATION_JUMP and (r.position > module.bytecode.size() or (module.bytecode.size() - r.position) < sizeof(int)))) {
+            throw ("fatal: invalid relocation in " + path);
+        }
+    }
+
+    return module;
+}
+
+
+vector<Invokable> linker::invokables(const map<string, bytecode_size_type>& functions, const map<string, bytecode_size_type>& blocks, bytecode_size_type size) {
+    /** Return functions and blocks of a module sorted by address.
+     *
+     *  Every invokable extends up to the next one, and the last one up to the end of bytecode.
+     */
+    vector<Invokable> all;
+    for (pair<string, bytecode_size_type> fn : functions) {
+        all.push_back(Invokable{ fn.first, SYMBOL_FUNCTION, fn.second, 0 });
+    }
+    for (pair<string, bytecode_size_type> bl : blocks) {
+        all.push_back(Invokable{ bl.first, SYMBOL_BLOCK, bl.second, 0 });
+    }
+    stable_sort(all.begin(), all.end(), [](const Invokable& a, const Invokable& b) { return (a.address < b.address); });
+
+    for (unsigned i = 0; i < all.size(); ++i) {
+        if (all[i].address > size) {
+            throw string("fatal: function or block placed outside of bytecode: " + all[i].name);
+        }
+        all[i].size = (((i+1) < all.size() ? all[i+1].address : size) - all[i].address);
+    }
+    return all;
+}
+
+vector<Relocation> linker::scan(const string& bytecode, const vector<Invokable>& invokables) {
+    /** Find relocations in bytecode of an image.
+     *
+     *  Every instruction is decoded so names it refers to and targets of its jumps can be found.
+     */
+    vector<Relocation> relocations;
+
+    const byte* code = bytecode.data();
+    bytecode_size_type size = bytecode.size();
+    unsigned current = 0;
+    for (bytecode_size_type offset = (invokables.size() ? invokables[0].address : size); offset < size;) {
+        while ((current+1) < invokables.size() and invokables[current+1].address <= offset) {
+            ++current;
+        }
+        bytecode_size_type begin = invokables[current].address;
+        bytecode_size_type end = (begin + invokables[current].size);
+
+        OPCODE op = OPCODE(code[offset]);
+        vector<string> s;
+        unsigned inc = decode(bytecode, offset, s);
+
+        if ((op == CALL) or (op == TAILCALL) or (op == CLOSURE) or (op == FUNCTION) or (op == TRY) or (op == CATCH)) {
+            relocations.push_back(Relocation{ RELOCATION_REFERENCE, offset, offset, s.back() });
+        } else if ((op == JUMP) or (op == BRANCH)) {
+            // targets are placed at the very end of jumping instructions
+            for (unsigned i = (op == JUMP ? 1 : 2); i > 0; --i) {
+                bytecode_size_type position = (offset + inc - (i * sizeof(int)));
+                long target = ((long)offset + readInt(bytecode, position));
+                if (target < (long)begin or target >= (long)end) {
+                    relocations.push_back(Relocation{ RELOCATION_JUMP, offset, position, "" });
+                }
+            }
+        }
+
+        offset += inc;
+    }
+
+    return relocations;
+}
+
+string linker::dumpRelocations(const vector<Relocation>& relocations) {
+    /** Return relocation section of an object (without its size field).
+     */
+    string section;
+    for (const Relocation& r : relocations) {
+        appendField(section, r.kind);
+        appendField(section, r.instruction);
+        appendField(section, r.position);
+        section.append(r.symbol);
+        section.push_back('\0');
+    }
+    return section;
+}
+
+vector<Relocation> linker::loadRelocations(const char* section, bytecode_size_type size) {
+    /** Parse relocation section of an object.
+     */
+    vector<Relocation> relocations;
+    bytecode_size_type i = 0;
+    while (i < size) {
+        const void* nul = 0;
+        if ((size - i) <= (3 * sizeof(uint32_t)) or (nul = memchr(section+i+(3 * sizeof(uint32_t)), '\0', size-i-(3 * sizeof(uint32_t)))) == 0) {
+            throw string("fatal: malformed relocation section");
+        }
+        uint32_t fields[3];
+        memcpy(fields, section+i, sizeof(fields));
+        string symbol(section+i+sizeof(fields));
+        relocations.push_back(Relocation{ RelocationKind(fields[0]), fields[1], fields[2], symbol });
+        i += (sizeof(fields) + symbol.size() + 1);
+    }
+    return relocations;
+}
+
+
+set<string> linker::reachable(const vector<Module>& modules, const vector<string>& roots) {
+    /** Return names of functions and blocks reachable from given roots.
+     *
+     *  Names that are not defined in any of the modules are skipped as
+     *  they may be provided by modules linked at runtime.
+     */
+    map<string, pair<unsigned, unsigned> > definitions;
+    for (unsigned m = 0; m < modules.size(); ++m) {
+        for (unsigned i = 0; i < modules[m].invokables.size(); ++i) {
+            definitions[modules[m].invokables[i].name] = pair<unsigned, unsigned>(m, i);
+        }
+    }
+
+    set<string> found;
+    deque<string> pending(roots.begin(), roots.end());
+    while (pending.size()) {
+        string name = pending.front();
+        pending.pop_front();
+        if (found.count(name) or not definitions.count(name)) {
+            continue;
+        }
+        found.insert(name);
+
+        pair<unsigned, unsigned> definition = definitions.at(name);
+        for (string ref : modules[definition.first].references(definition.second)) {
+            pending.push_back(ref);
+        }
+    }
+    return found;
+}
+
+void linker::place(const Module& module, const set<string>* kept, string& bytecode, ConstantPoolBuilder& constants, vector<pair<string, bytecode_size_type> >& functions, vector<pair<string, bytecode_size_type> >& blocks, bytecode_size_type origin) {
+    /** Append bytecode of functions and blocks of given module to linked bytecode.
+     *
+     *  If the set of kept names is given, only functions and blocks in it are placed.
+     *  Addresses of placed invokables are appended to functions and blocks, and
+     *  constant pool of the module is linked into the pool of output.
+     *
+     *  Origin is the address at which linked bytecode begins in output (e.g.
+     *  the assembler places it after bytecode of the module being assembled).
+     */
+    vector<tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type> > placement;
+    vector<bytecode_size_type> addresses(module.invokables.size(), 0);
+    vector<bool> placed(module.invokables.size(), false);
+
+    for (unsigned i = 0; i < module.invokables.size(); ++i) {
+        const Invokable& invokable = module.invokables[i];
+        if (kept and not kept->count(invokable.name)) {
+            continue;
+        }
+        addresses[i] = (origin + bytecode.size());
+        placed[i] = true;
+        placement.push_back(tuple<bytecode_size_type, bytecode_size_type, bytecode_size_type>(invokable.address, addresses[i], invokable.size));
+        (invokable.kind == SYMBOL_BLOCK ? blocks : functions).push_back(pair<string, bytecode_size_type>(invokable.name, addresses[i]));
+        bytecode.append(module.bytecode, invokable.address, invokable.size);
+    }
+
+    // jumps inside a function or block are relative so only the ones leaving it must be recalculated
+    for (const Relocation& r : module.relocations) {
+        unsigned source = module.at(r.instruction);
+        if (r.kind != RELOCATION_JUMP or source == module.invokables.size() or not placed[source]) {
+            continue;
+        }
+        bytecode_size_type target_offset = (r.instruction + readInt(module.bytecode, r.position));
+        unsigned target = module.at(target_offset);
+        if (target == module.invokables.size() or not placed[target]) {
+            ostringstream oss;
+            oss << "fatal: jump at byte " << r.instruction << " of " << module.path << " leads to code that was not linked";
+            throw oss.str();
+        }
+        bytecode_size_type shift = (addresses[source] - module.invokables[source].address);
+        int jump = ((addresses[target] + (target_offset - module.invokables[target].address)) - (r.instruction + shift));
+        writeInt(bytecode, (r.position + shift - origin), jump);
+    }
+
+    // literals used only by code that was not placed are dropped from the pool,
+    // so indexes of the ones that are kept are moved down over them
+    vector<bool> used(module.constants.size(), false);
+    vector<tuple<bytecode_size_type, bool, uint32_t, uint32_t> > literals;
+    for (unsigned i = 0; i < module.invokables.size(); ++i) {
+        if (not placed[i]) {
+            continue;
+        }
+        const Invokable& invokable = module.invokables[i];
+        vector<string> strings;
+        for (bytecode_size_type offset = invokable.address; offset < (invokable.address + invokable.size); offset += decode(module.bytecode, offset, strings)) {
+            OPCODE op = OPCODE(module.bytecode[offset]);
+            if (not ((op == STRSTORE) or (op == ATOM) or (op == FSTORE))) {
+                continue;
+            }
+            // index of the literal is the second operand
+            byte mode = module.bytecode[offset+1];
+            bytecode_size_type position = (offset + 1 + OPERAND_MODE_SIZE + ((mode & OPERAND_WIDE) ? OPERAND_WIDE_SIZE : OPERAND_NARROW_SIZE));
+            bool wide = ((mode >> OPERAND_MODE_BITS) & OPERAND_WIDE);
+            int index = (wide ? readInt(module.bytecode, position) : (unsigned char)module.bytecode[position]);
+
+            // CPU looks literals up by address following the opcode
+            uint32_t entry = 0;
+            if (index < 0 or not module.constants.find((offset+1), index, entry)) {
+                ostringstream oss;
+                oss << "fatal: invalid constant pool index at byte " << offset << " of " << module.path;
+                throw oss.str();
+            }
+            used[entry] = true;
+            literals.push_back(tuple<bytecode_size_type, bool, uint32_t, uint32_t>((position + (addresses[i] - invokable.address) - origin), wide, entry, (entry - index)));
+        }
+    }
+
+    vector<uint32_t> moved(module.constants.size()+1, 0);
+    for (uint32_t i = 0; i < module.constants.size(); ++i) {
+        moved[i+1] = (moved[i] + (used[i] ? 1 : 0));
+    }
+    bytecode_size_type position;
+    bool wide;
+    uint32_t entry, first;
+    for (tuple<bytecode_size_type, bool, uint32_t, uint32_t> literal : literals) {
+        tie(position, wide, entry, first) = literal;
+        // entries are only moved down within their segment so narrow indexes stay narrow
+        int index = (moved[entry] - moved[first]);
+        if (wide) {
+            writeInt(bytecode, position, index);
+        } else {
+            bytecode[position] = (char)index;
+        }
+    }
+
+    constants.link(module.constants, placement, &used);
+}
@@ -1,30 +1,94 @@
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <sstream>
 #include <fstream>
 #include <tuple>
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <viua/bytecode/bytetypedef.h>
+#include <viua/bytecode/format.h>
+#include <viua/bytecode/opcodes.h>
+#include <viua/bytecode/operands.h>
+#include <viua/bytecode/maps.h>
 #include <viua/loader.h>
 using namespace std;
 
 
+static void appendField(string& out, bytecode_size_type value) {
+    out.append((const char*)&value, sizeof(bytecode_size_type));
+}
+
+static void appendIntegerOperands(string& out, const vector<tuple<bool, int> >& ops) {
+    /** Append integer operands encoded behind operand-mode byte (see operands.h).
+     */
+    unsigned char mode = 0;
+    string encoded;
+
+    bool ref;
+    int num;
+    for (unsigned i = 0; i < ops.size(); ++i) {
+        tie(ref, num) = ops[i];
+
+        unsigned char op_mode = (ref ? OPERAND_REF : 0);
+        if (operands::isnarrow(num)) {
+            encoded.push_back(static_cast<char>(num));
+        } else {
+            op_mode |= OPERAND_WIDE;
+            encoded.append((const char*)&num, OPERAND_WIDE_SIZE);
+        }
+        mode |= (op_mode << (i * OPERAND_MODE_BITS));
+    }
+
+    out.push_back(static_cast<char>(mode));
+    out.append(encoded);
+}
+
+static byte* advance(byte*& ptr, byte* end, size_t n) {
+    /** Return pointer to next n bytes of legacy bytecode and advance past them.
+     */
+    if (n > static_cast<size_t>(end - ptr)) {
+        throw string("truncated instruction");
+    }
+    byte* p = ptr;
+    ptr += n;
+    return p;
+}
+
+static string advanceString(byte*& ptr, byte* end) {
+    /** Return NUL-terminated string embedded in legacy bytecode and advance past it.
+     */
+    byte* terminator = static_cast<byte*>(memchr(ptr, '\0', (end - ptr)));
+    if (terminator == 0) {
+        throw string("unterminated string");
+    }
+    string s(ptr, terminator);
+    ptr = terminator+1;
+    return s;
+}
 
-IdToAddressMapping Loader::loadmap(char* bytedump, const uint16_t& bytedump_size) {
+
+
+IdToAddressMapping Loader::loadmap(char* bytedump, const bytecode_size_type& bytedump_size) {
     vector<string> order;
-    map<string, uint16_t> mapping;
+    map<string, bytecode_size_type> mapping;
 
     char *lib_function_ids_map = bytedump;
 
-    int i = 0;
+    bytecode_size_type i = 0;
     string lib_fn_name;
-    uint16_t lib_fn_address;
+    bytecode_size_type lib_fn_address;
     while (i < bytedump_size) {
         lib_fn_name = string(lib_function_ids_map);
         i += lib_fn_name.size() + 1;  // one for null character
-        lib_fn_address = *((uint16_t*)(bytedump+i));
-        i += sizeof(uint16_t);
+        lib_fn_address = *((bytecode_size_type*)(bytedump+i));
+        i += sizeof(bytecode_size_type);
         lib_function_ids_map = bytedump+i;
         mapping[lib_fn_name] = lib_fn_address;
         order.push_back(lib_fn_name);
@@ -54,91 +118,433 @@ void Loader::calculateFunctionSizes() {
     }
 }
 
-void Loader::loadJumpTable(ifstream& in) {
-    // load jump table
-    unsigned lib_total_jumps;
-    in.read((char*)&lib_total_jumps, sizeof(unsigned));
-
-    unsigned lib_jmp;
-    for (unsigned i = 0; i < lib_total_jumps; ++i) {
-        in.read((char*)&lib_jmp, sizeof(unsigned));
-        jumps.push_back(lib_jmp);
+void Loader::loadIds() {
+    /** Parse ID sections into lookup tables.
+     *
+     *  This is done only once, when any of the tables is first requested.
+     */
+    if (ids_loaded) {
+        return;
     }
-}
-void Loader::loadFunctionsMap(ifstream& in) {
-    uint16_t lib_function_ids_section_size = 0;
-    in.read((char*)&lib_function_ids_section_size, sizeof(uint16_t));
-
-    char *lib_buffer_function_ids = new char[lib_function_ids_section_size];
-    in.read(lib_buffer_function_ids, lib_function_ids_section_size);
 
     vector<string> order;
-    map<string, uint16_t> mapping;
+    map<string, bytecode_size_type> mapping;
 
-    tie(order, mapping) = loadmap(lib_buffer_function_ids, lib_function_ids_section_size);
+    tie(order, mapping) = loadmap(block_ids_section, block_ids_section_size);
+    for (string p : order) {
+        blocks.push_back(p);
+        block_addresses[p] = mapping[p];
+    }
 
+    tie(order, mapping) = loadmap(function_ids_section, function_ids_section_size);
     for (string p : order) {
         functions.push_back(p);
         function_addresses[p] = mapping[p];
     }
-    delete[] lib_buffer_function_ids;
+
+    calculateFunctionSizes();
+    ids_loaded = true;
 }
-void Loader::loadBlocksMap(ifstream& in) {
-    uint16_t lib_block_ids_section_size = 0;
-    in.read((char*)&lib_block_ids_section_size, sizeof(uint16_t));
 
-    char *lib_buffer_block_ids = new char[lib_block_ids_section_size];
-    in.read(lib_buffer_block_ids, lib_block_ids_section_size);
 
-    vector<string> order;
-    map<string, uint16_t> mapping;
+void Loader::mapImage() {
+    /** Map the file read-only into memory.
+     *
+     *  Pages are shared so several processes running the same program use the same memory.
+     *  Returns without mapping anything if the file cannot be mapped, and
+     *  the loader falls back to reading the file.
+     */
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
 
-    tie(order, mapping) = loadmap(lib_buffer_block_ids, lib_block_ids_section_size);
+    struct stat sf;
+    if (fstat(fd, &sf) == -1 or sf.st_size == 0) {
+        close(fd);
+        return;
+    }
 
-    for (string p : order) {
-        blocks.push_back(p);
-        block_addresses[p] = mapping[p];
+    void* addr = mmap(0, sf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return;
     }
-    delete[] lib_buffer_block_ids;
-}
-void Loader::loadBytecode(ifstream& in) {
-    in.read((char*)&size, 16);
-    bytecode = new byte[size];
-    in.read((char*)bytecode, size);
-}
 
-Loader& Loader::load() {
-    ifstream in(path, ios::in | ios::binary);
+    image = static_cast<char*>(addr);
+    image_size = sf.st_size;
+    mapped = true;
+}
+void Loader::readImage() {
+    /** Read whole file into a buffer owned by the loader.
+     */
+    ifstream in(path, ios::in | ios::binary | ios::ate);
     if (!in) {
         throw ("fatal: failed to link " + path);
     }
 
-    // jump table must be loaded if loading a library
-    loadJumpTable(in);
+    image_size = in.tellg();
+    in.seekg(0);
+    image = new char[image_size];
+    in.read(image, image_size);
+}
+void Loader::loadImage() {
+    if (use_mmap) {
+        mapImage();
+    }
+    if (not mapped) {
+        readImage();
+    }
+    cursor = 0;
+}
+void Loader::releaseImage() {
+    if (image == 0) {
+        return;
+    }
+    if (mapped) {
+        munmap(image, image_size);
+    } else {
+        delete[] image;
+    }
+    image = 0;
+    image_size = 0;
+}
 
-    loadBlocksMap(in);
-    loadFunctionsMap(in);
-    loadBytecode(in);
-    calculateFunctionSizes();
+char* Loader::take(size_t n) {
+    /** Return pointer to next n bytes of the image and advance past them.
+     */
+    if (n > (image_size - cursor)) {
+        throw ("fatal: truncated bytecode image: " + path);
+    }
+    char* p = image+cursor;
+    cursor += n;
+    return p;
+}
+
+bytecode_size_type Loader::loadSize() {
+    /** Read section size field.
+     */
+    bytecode_size_type sz = 0;
+    memcpy(&sz, take(sizeof(bytecode_size_type)), sizeof(bytecode_size_type));
+    return sz;
+}
+
+void Loader::loadFormatHeader() {
+    /** Read magic number and format version.
+     *
+     *  Images without the magic number are legacy images, and
+     *  are read from the very beginning.
+     */
+    if (image_size > VIUA_MAGIC_NUMBER_SIZE and memcmp(image, VIUA_MAGIC_NUMBER, VIUA_MAGIC_NUMBER_SIZE) == 0) {
+        take(VIUA_MAGIC_NUMBER_SIZE);
+        version = *((uint8_t*)take(sizeof(uint8_t)));
+    } else if (image_size > VIUA_MAGIC_NUMBER_SIZE and memcmp(image, VIUA_OBJECT_MAGIC_NUMBER, VIUA_MAGIC_NUMBER_SIZE) == 0) {
+        take(VIUA_MAGIC_NUMBER_SIZE);
+        version = *((uint8_t*)take(sizeof(uint8_t)));
+        relocatable = true;
+    } else {
+        version = VIUA_BYTECODE_LEGACY_VERSION;
+    }
+
+    if (version > VIUA_BYTECODE_VERSION or (relocatable and version < VIUA_BYTECODE_CONSTANT_POOL_VERSION)) {
+        ostringstream oss;
+        oss << "fatal: unsupported bytecode format version " << unsigned(version) << " in " << path;
+        throw oss.str();
+    }
+}
+
+void Loader::upgradeImage(bool library) {
+    /** Re-encode image of an older format into the current one.
+     *
+     *  Images older than version 5 embed literals in bytecode,
+     *  images older than version 4 encode integer operands as (bool, int) pairs, and
+     *  images older than version 3 encode jump targets
+     *  as offsets from the beginning of the bytecode, and
+     *  libraries of these versions begin with a table of jumps for the linker.
+     *  Images without the header (version 0) use 16 bit sizes and addresses, and
+     *  their bytecode size field spans 16 bytes of which only the first two are meaningful.
+     *
+     *  Literals are moved into a constant pool built during loading,
+     *  addresses in ID sections and jump targets are adjusted to the new encoding, and
+     *  symbol table is rebuilt for them.
+     *  Loaded image (mapped or not) is then replaced by a private buffer holding
+     *  the upgraded one so the rest of loading treats it as any current image.
+     *
+     *  Files without the magic number that do not parse as version 0 images are rejected.
+     */
+    string upgraded;
+    try {
+        const bool legacy = (version == VIUA_BYTECODE_LEGACY_VERSION);
+        const unsigned size_field_size = (legacy ? VIUA_LEGACY_SIZE_FIELD_SIZE : sizeof(bytecode_size_type));
+
+        if (library and version < VIUA_BYTECODE_PIC_VERSION) {
+            // jumps are made relative below so the table is not needed
+            unsigned jump_count = 0;
+            memcpy(&jump_count, take(sizeof(unsigned)), sizeof(unsigned));
+            take(static_cast<size_t>(jump_count) * sizeof(unsigned));
+        }
+
+        vector<tuple<string, bytecode_size_type> > ids[2];
+        for (vector<tuple<string, bytecode_size_type> >& entries : ids) {
+            bytecode_size_type section_size = 0;
+            memcpy(&section_size, take(size_field_size), size_field_size);
+            byte* ptr = take(section_size);
+            byte* end = (ptr + section_size);
+            while (ptr < end) {
+                string name = advanceString(ptr, end);
+                bytecode_size_type address = 0;
+                memcpy(&address, advance(ptr, end, size_field_size), size_field_size);
+                entries.push_back(tuple<string, bytecode_size_type>(name, address));
+            }
+        }
+
+        if (version >= VIUA_BYTECODE_SYMTAB_VERSION) {
+            // addresses change so symbol table is rebuilt
+            take(loadSize());
+        }
+
+        bytecode_size_type legacy_size = 0;
+        memcpy(&legacy_size, take(legacy ? VIUA_LEGACY_BYTECODE_SIZE_FIELD_SIZE : sizeof(bytecode_size_type)), size_field_size);
+        byte* legacy_bytecode = take(legacy_size);
+        if (cursor != image_size) {
+            throw string("trailing data");
+        }
+
+        ConstantPoolBuilder constants;
+        string converted;
+
+        // offsets of instructions in legacy bytecode mapped to their offsets in converted bytecode
+        map<bytecode_size_type, bytecode_size_type> offsets;
+
+        // (offset of target field, offset of jumping instruction, target in legacy bytecode) triples
+        vector<tuple<bytecode_size_type, bytecode_size_type, int> > targets;
+
+        byte* end = (legacy_bytecode + legacy_size);
+        byte* ptr = legacy_bytecode;
+        while (ptr < end) {
+            bytecode_size_type legacy_offset = (ptr - legacy_bytecode);
+            bytecode_size_type offset = converted.size();
+            offsets[legacy_offset] = offset;
+
+            OPCODE op = OPCODE(*(ptr++));
+            if ((version == 0 and op > HALT) or op >= IADDI) {
+                // instructions added later are never found in older images
+                throw string("unknown instruction");
+            }
+            string name = OP_NAMES.at(op);
+
+            // instructions taking literals got their constant pool index operand with the pool
+            unsigned count = OP_INTEGER_OPERANDS.at(name);
+            if (op == FSTORE or op == STRSTORE or op == ATOM) {
+                --count;
+            }
+
+            vector<tuple<bool, int> > ops;
+            byte mode = 0;
+            if (version >= VIUA_BYTECODE_OPERAND_MODE_VERSION and count) {
+                mode = *advance(ptr, end, OPERAND_MODE_SIZE);
+            }
+            for (unsigned i = 0; i < count; ++i) {
+                bool ref = false;
+                int value = 0;
+                if (version >= VIUA_BYTECODE_OPERAND_MODE_VERSION) {
+                    byte* operand = advance(ptr, end, ((mode & OPERAND_WIDE) ? OPERAND_WIDE_SIZE : OPERAND_NARROW_SIZE));
+                    operands::getint(operand, mode, ref, value);
+                } else if (op == BSTORE and i == 1) {
+                    // byte operand of bstore was a (bool, byte) pair
+                    ref = (*advance(ptr, end, sizeof(bool)) != 0);
+                    value = static_cast<unsigned char>(*advance(ptr, end, sizeof(byte)));
+                } else {
+                    ref = (*advance(ptr, end, sizeof(bool)) != 0);
+                    memcpy(&value, advance(ptr, end, sizeof(int)), sizeof(int));
+                }
+                ops.push_back(tuple<bool, int>(ref, value));
+            }
+
+            if (op == FSTORE) {
+                float f = 0;
+                memcpy(&f, advance(ptr, end, sizeof(float)), sizeof(float));
+                ops.push_back(tuple<bool, int>(false, constants.real(f)));
+            } else if (op == STRSTORE) {
+                ops.push_back(tuple<bool, int>(false, constants.str(advanceString(ptr, end))));
+            } else if (op == ATOM) {
+                ops.push_back(tuple<bool, int>(false, constants.atom(advanceString(ptr, end))));
+            }
+
+            converted.push_back(static_cast<char>(op));
+            if (ops.size()) {
+                appendIntegerOperands(converted, ops);
+            }
+
+            if (op == RESS) {
+                converted.append(advance(ptr, end, sizeof(int)), sizeof(int));
+            } else if (op == JUMP or op == BRANCH) {
+                for (unsigned i = 0; i < (op == JUMP ? 1 : 2); ++i) {
+                    int target = 0;
+                    memcpy(&target, advance(ptr, end, sizeof(int)), sizeof(int));
+                    if (version >= VIUA_BYTECODE_PIC_VERSION) {
+                        target += legacy_offset;
+                    }
+                    targets.push_back(tuple<bytecode_size_type, bytecode_size_type, int>(converted.size(), offset, target));
+                    converted.append(sizeof(int), '\0');
+                }
+            } else if (find(OP_VARIABLE_LENGTH.begin(), OP_VARIABLE_LENGTH.end(), op) != OP_VARIABLE_LENGTH.end()) {
+                for (unsigned i = 0; i < (op == CATCH ? 2 : 1); ++i) {
+                    converted.append(advanceString(ptr, end));
+                    converted.push_back('\0');
+                }
+            }
+        }
+        offsets[legacy_size] = converted.size();
+
+        bytecode_size_type field, instruction;
+        int target;
+        for (tuple<bytecode_size_type, bytecode_size_type, int> t : targets) {
+            tie(field, instruction, target) = t;
+            if (target < 0 or offsets.count(target) == 0) {
+                throw string("jump into the middle of an instruction");
+            }
+            int relative = (static_cast<int>(offsets[target]) - static_cast<int>(instruction));
+            memcpy(&converted[field], &relative, sizeof(int));
+        }
+
+        string id_sections[2];
+        map<string, bytecode_size_type> addresses[2];
+        string id;
+        bytecode_size_type address;
+        for (unsigned i = 0; i < 2; ++i) {
+            for (tuple<string, bytecode_size_type> entry : ids[i]) {
+                tie(id, address) = entry;
+                if (offsets.count(address) == 0) {
+                    throw string("address in the middle of an instruction");
+                }
+                id_sections[i].append(id.c_str(), id.size()+1);
+                appendField(id_sections[i], offsets[address]);
+                addresses[i][id] = offsets[address];
+            }
+        }
+
+        upgraded.append(VIUA_MAGIC_NUMBER, VIUA_MAGIC_NUMBER_SIZE);
+        upgraded.push_back(static_cast<char>(VIUA_BYTECODE_VERSION));
+        for (const string& section : { id_sections[0], id_sections[1], SymbolTable::build(addresses[1], addresses[0]), constants.build(), string(), converted }) {
+            appendField(upgraded, section.size());
+            upgraded.append(section);
+        }
+    } catch (const string&) {
+        ostringstream oss;
+        if (version == VIUA_BYTECODE_LEGACY_VERSION) {
+            oss << "fatal: " << path << " is not a valid bytecode image";
+        } else {
+            oss << "fatal: malformed bytecode image (format version " << unsigned(version) << "): " << path;
+        }
+        throw oss.str();
+    }
+
+    releaseImage();
+    mapped = false;
+    image_size = upgraded.size();
+    image = new char[image_size];
+    memcpy(image, upgraded.data(), image_size);
+    cursor = (VIUA_MAGIC_NUMBER_SIZE + sizeof(uint8_t));
+    version = VIUA_BYTECODE_VERSION;
+}
+
+void Loader::loadFunctionsMap() {
+    function_ids_section_size = loadSize();
+    function_ids_section = take(function_ids_section_size);
+}
+void Loader::loadBlocksMap() {
+    block_ids_section_size = loadSize();
+    block_ids_section = take(block_ids_section_size);
+}
+void Loader::loadSymbolTable() {
+    symtab_section_size = loadSize();
+    symtab_section = take(symtab_section_size);
+}
+void Loader::loadConstantPool() {
+    constpool_section_size = loadSize();
+    constpool_section = take(constpool_section_size);
+}
+void Loader::loadRelocations() {
+    relocations_section_size = loadSize();
+    relocations_section = take(relocations_section_size);
+}
+void Loader::loadInlinedCode() {
+    if (version >= VIUA_BYTECODE_INLINED_CODE_VERSION) {
+        inlined_code_section_size = loadSize();
+        inlined_code_section = take(inlined_code_section_size);
+    }
+}
+void Loader::loadBytecode() {
+    size = loadSize();
+    bytecode = take(size);
+}
+
+Loader& Loader::useMmap(bool m) {
+    /** Set whether the image should be mapped into memory instead of being read.
+     *
+     *  Must be called before load() or executable().
+     */
+    use_mmap = m;
+    return (*this);
+}
+bool Loader::isMapped() const {
+    return mapped;
+}
+
+Loader& Loader::load() {
+    /** Load image or relocatable object.
+     */
+    loadImage();
+    loadFormatHeader();
+    if (version < VIUA_BYTECODE_CONSTANT_POOL_VERSION) {
+        // libraries of older formats begin with a jump table
+        upgradeImage(true);
+    }
+
+    loadBlocksMap();
+    loadFunctionsMap();
+    if (relocatable) {
+        loadConstantPool();
+        loadRelocations();
+    } else {
+        loadSymbolTable();
+        loadConstantPool();
+        loadInlinedCode();
+    }
+    loadBytecode();
 
     return (*this);
 }
 
 Loader& Loader::executable() {
-    ifstream in(path, ios::in | ios::binary);
-    if (!in) {
-        throw ("fatal: failed to link " + path);
+    loadImage();
+    loadFormatHeader();
+    if (relocatable) {
+        throw ("fatal: " + path + " is a relocatable object: link it with viua-ld");
+    }
+    if (version < VIUA_BYTECODE_CONSTANT_POOL_VERSION) {
+        upgradeImage(false);
     }
 
-    loadBlocksMap(in);
-    loadFunctionsMap(in);
-    loadBytecode(in);
-    calculateFunctionSizes();
+    loadBlocksMap();
+    loadFunctionsMap();
+    loadSymbolTable();
+    loadConstantPool();
+    loadInlinedCode();
+    loadBytecode();
 
     return (*this);
 }
 
-uint16_t Loader::getBytecodeSize() {
+uint8_t Loader::getVersion() {
+    return version;
+}
+bool Loader::isRelocatable() const {
+    return relocatable;
+}
+
+bytecode_size_type Loader::getBytecodeSize() {
     return size;
 }
 byte* Loader::getBytecode() {
@@ -148,24 +554,79 @@ byte* Loader::getBytecode() {
     }
     return copy;
 }
-
-vector<unsigned> Loader::getJumps() {
-    return jumps;
+byte* Loader::getBytecodeInPlace() {
+    /** Return pointer to bytecode inside loaded image without copying it.
+     *
+     *  Pointer is valid only as long as the image is, so
+     *  callers that outlive the loader must take the image over with detachImage().
+     *  Bytecode must not be modified if the image is mapped.
+     */
+    return bytecode;
+}
+tuple<void*, size_t> Loader::detachImage() {
+    /** Give up ownership of loaded image.
+     *
+     *  Caller becomes responsible for unmapping the image if it was mapped (see isMapped()),
+     *  or for freeing it with delete[] otherwise.
+     */
+    tuple<void*, size_t> detached(image, image_size);
+    image = 0;
+    image_size = 0;
+    return detached;
 }
 
-map<string, uint16_t> Loader::getFunctionAddresses() {
+map<string, bytecode_size_type> Loader::getFunctionAddresses() {
+    loadIds();
     return function_addresses;
 }
 map<string, unsigned> Loader::getFunctionSizes() {
+    loadIds();
     return function_sizes;
 }
 vector<string> Loader::getFunctions() {
+    loadIds();
     return functions;
 }
 
-map<string, uint16_t> Loader::getBlockAddresses() {
+map<string, bytecode_size_type> Loader::getBlockAddresses() {
+    loadIds();
     return block_addresses;
 }
 vector<string> Loader::getBlocks() {
+    loadIds();
     return blocks;
 }
+
+bool Loader::hasSymbolTable() {
+    return (symtab_section != 0);
+}
+SymbolTable Loader::getSymbolTable() {
+    /** Return view of symbol table section of loaded image.
+     *
+     *  Returned table points into the image so it is valid only as long as the image is.
+     *  Images without a symbol table give an empty table.
+     */
+    return SymbolTable(symtab_section, symtab_section_size);
+}
+ConstantPool Loader::getConstantPool() {
+    /** Return constant pool of loaded image.
+     *
+     *  Returned pool holds its own copy of the section so it is valid after the image is released.
+     */
+    return ConstantPool(constpool_section, constpool_section_size);
+}
+string Loader::getRelocations() {
+    /** Return relocation section of loaded object.
+     *
+     *  Images have no relocations, and give an empty section.
+     */
+    return (relocations_section ? string(relocations_section, relocations_section_size) : string());
+}
+
+string Loader::getInlinedCode() {
+    /** Return inlined code section of loaded image.
+     *
+     *  Objects, and images older than the section, give an empty section.
+     */
+    return (inlined_code_section ? string(inlined_code_section, inlined_code_section_size) : string());
+}
@@ -1,9 +1,9 @@
 #include <cstdint>
 #include <iostream>
 #include <sstream>
-#include <viua/support/string.h>
 #include <viua/bytecode/opcodes.h>
 #include <viua/bytecode/maps.h>
+#include <viua/bytecode/operands.h>
 #include <viua/program.h>
 using namespace std;
 
@@ -14,8 +14,9 @@ byte* Program::bytecode() {
      *
      *  Calling code is responsible for proper destruction of the allocated memory.
      */
-    byte* tmp = new byte[bytes];
-    for (int i = 0; i < bytes; ++i) {
+    int generated = size();
+    byte* tmp = new byte[generated];
+    for (int i = 0; i < generated; ++i) {
         tmp[i] = program[i];
     }
     return tmp;
@@ -26,10 +27,13 @@ Program& Program::fill(byte* code) {
      *
      *  Previous copy is deleted.
      *  Calling code must not delete passed bytecode.
+     *  Passed bytecode must be as long as the size the generator was created with.
      */
     delete[] program;
     program = code;
-    addr_ptr = program;
+    addr_ptr = program+bytes;
+    instruction_offsets.clear();
+    offsets_end = 0;
     return (*this);
 }
 
@@ -48,132 +52,168 @@ Program& Program::setscream(bool d) {
     return (*this);
 }
 
+Program& Program::setconstants(ConstantPoolBuilder* c) {
+    /** Sets constant pool literals are placed in.
+     */
+    constants = c;
+    return (*this);
+}
 
-int Program::size() {
-    /*  Returns program size in bytes.
+ConstantPoolBuilder& Program::pool() {
+    if (constants == 0) {
+        throw "no constant pool to place literals in";
+    }
+    return (*constants);
+}
+
+int_op Program::constant(ConstantKind kind, const string& value) {
+    /** Place literal in constant pool, and return operand referring to it.
+     *
+     *  Must be called before the instruction using the literal is inserted.
      */
-    return bytes;
+    uint32_t index = pool().add(kind, value);
+    constant_uses.push_back(tuple<int, ConstantKind, string>((addr_ptr-program), kind, value));
+    return int_op(false, index);
 }
 
-int Program::instructionCount() {
-    /** Returns total number of instructions in the program.
+
+int Program::size() {
+    /*  Returns size of generated bytecode in bytes.
      *
-     *  This function should only be called after the program is fully constructed as the size is calculated by
-     *  performing bytecode analysis.
+     *  Sizes of instructions depend on widths of their operands so
+     *  this may be less than the size the program was created with.
+     */
+    return (addr_ptr - program);
+}
+
+int Program::getInstructionSize(int offset) {
+    /** Returns size of instruction at given bytecode offset.
      */
-    int counter = 0;
-    for (int i = 0; i < bytes; ++i) {
-        switch (program[i]) {
-            case IADD:
-            case ISUB:
-            case IMUL:
-            case IDIV:
-            case ILT:
-            case ILTE:
-            case IGT:
-            case IGTE:
-            case IEQ:
-            case BRANCH:
-                i += 3 * sizeof(int);
-                break;
-            case ISTORE:
-                i += 2 * sizeof(int);
-                break;
-            case IINC:
-            case IDEC:
-            case PRINT:
-            case JUMP:
-                i += sizeof(int);
-                break;
+    OPCODE opcode = OPCODE(program[offset]);
+    string opcode_name;
+    try {
+        opcode_name = OP_NAMES.at(opcode);
+    } catch (const std::out_of_range& e) {
+        ostringstream oss;
+        oss << "instruction not found in OP_NAMES: " << opcode;
+        throw oss.str();
+    }
+
+    int inc;
+    try {
+        inc = OP_SIZES.at(opcode_name);
+        if (OP_INTEGER_OPERANDS.at(opcode_name)) {
+            // operand-mode byte directly follows the opcode
+            inc += operands::widening(program[offset+1]);
+        }
+    } catch (const std::out_of_range& e) {
+        throw ("instruction " + opcode_name + " not found in OP_SIZES");
+    }
+
+    if (scream) {
+        cout << "[asm] debug: offsetting: " << opcode_name << ": +" << inc;
+    }
+
+    // strings are placed after integer operands
+    unsigned strings = 0;
+    if ((opcode == EXIMPORT) or (opcode == TRY) or (opcode == LINK) or (opcode == CALL) or (opcode == TAILCALL) or (opcode == EXCALL) or (opcode == CLOSURE) or (opcode == FUNCTION)) {
+        strings = 1;
+    } else if (opcode == CATCH) {
+        strings = 2;
+    }
+    for (unsigned i = 0; i < strings; ++i) {
+        string s(program+offset+inc);
+        if (scream) {
+            cout << '+' << s.size()+1 << " (string at byte " << offset+inc << ": `" << s << "`)";
         }
-        ++counter;
+        inc += s.size()+1;
     }
-    return counter;
+
+    if (scream) {
+        cout << " bytes" << endl;
+    }
+
+    return inc;
+}
+
+const vector<int>& Program::instructionOffsets() {
+    /** Returns byte offsets of instructions, indexed by instruction number.
+     *
+     *  Only the bytecode generated since the previous call is analysed so
+     *  every instruction is sized exactly once, no matter how many jumps refer to it.
+     */
+    int generated = size();
+    while (offsets_end < generated) {
+        instruction_offsets.push_back(offsets_end);
+        offsets_end += getInstructionSize(offsets_end);
+    }
+    return instruction_offsets;
+}
+
+int Program::instructionCount() {
+    /** Returns total number of instructions in the program.
+     */
+    return instructionOffsets().size();
 }
 
 
-uint16_t Program::countBytes(const vector<string>& lines) {
+bytecode_size_type Program::countBytes(const vector<cg::lex::Line>& lines) {
     /** Counts bytecode size required for a program.
      *
      *  Knowing how many instructions are in a program, and
      *  size of each instruction, required bytecode size can
      *  be calculated by a simple for loop adding sizes of
      *  instructions it encounters.
-     *
-     *  Passed lines must be sanitized, i.e. the comments and blanks must be removed.
+     *  Every integer operand is counted as wide so the result is an upper bound, and
+     *  real size of the program is known only after it is generated.
      */
-    uint16_t bytes = 0;
+    bytecode_size_type bytes = 0;
     int inc = 0;
-    string instr, line;
 
-    for (unsigned i = 0; i < lines.size(); ++i) {
-        line = str::lstrip(lines[i]);
-
-        if (line[0] == '.') {
+    for (const cg::lex::Line& line : lines) {
+        if (line.directive()) {
             /*  Assembler annotations must be skipped here or they would cause the code below to
              *  throw exceptions.
              */
             continue;
         }
 
-        instr = "";
+        const string& instr = line[0];
         inc = 0;
 
-        instr = str::chunk(line);
         try {
             inc = OP_SIZES.at(instr);
+            inc += OP_INTEGER_OPERANDS.at(instr) * (OPERAND_WIDE_SIZE - OPERAND_NARROW_SIZE);
             if (instr == "try") {
-                // clear first chunk
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (function or block name)
-                inc += str::chunk(line).size() + 1;
+                // second token is function or block name
+                inc += line[1].size() + 1;
             } else if ((instr == "call") or (instr == "excall")) {
-                // clear first chunk (opcode mnemonic)
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (optional register index)
-                string first_op = str::chunk(line);
-                line = str::lstrip(str::sub(line, first_op.size()));
-                // get third chunk (function name if register index was given, empty otherwise)
-                string second_op = str::chunk(line);
-                inc += (second_op.size() ? second_op : first_op).size() + 1;
+                // third token is function name if register index was given, and empty otherwise
+                inc += (line[2].size() ? line[2] : line[1]).size() + 1;
+            } else if (instr == "tailcall") {
+                // second token is function name
+                inc += line[1].size() + 1;
             } else if ((instr == "closure") or (instr == "function")) {
-                // clear first chunk (opcode mnemonic)
-                line = str::lstrip(str::sub(line, instr.size()));
-                // clear second chunk (register index)
-                line = str::lstrip(str::sub(line, str::chunk(line).size()));
-                // get third chunk (function name)
-                inc += str::chunk(line).size() + 1;
+                // third token is function name
+                inc += line[2].size() + 1;
             } else if (instr == "eximport") {
-                // clear first chunk
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (which is a string)
-                inc += (str::extract(line).size() - 2 + 1); // +1: null-terminator, -2: quotes around module name
+                // second token is a string
+                inc += (line[1].size() - 2 + 1); // +1: null-terminator, -2: quotes around module name
             } else if (instr == "link") {
-                // clear first chunk
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (which is a module name)
-                inc += (str::extract(line).size() + 1); // +1: null-terminator
+                // second token is a module name
+                inc += (line[1].size() + 1); // +1: null-terminator
             } else if (instr == "catch") {
-                // clear first chunk (the opcode)
-                line = str::lstrip(str::sub(line, instr.size()));
-                // get second chunk (the type as a string)
-                inc += (str::extract(line).size() - 2 + 1); // +1: null-terminator, -2: quotes
-                line = str::lstrip(str::sub(line, str::extract(line).size()));
-                // get third chunk (which is a block name)
-                inc += str::chunk(line).size() + 1;
-            } else if (instr == "strstore") {
-                // clear first chunk
-                line = str::lstrip(str::sub(line, instr.size()));
-                line = str::lstrip(str::sub(line, str::chunk(line).size()));
-                // get third chunk (which is a string)
-                inc += (str::extract(line).size() - 2 + 1); // +1: null-terminator
+                // second token is the type as a string
+                inc += (line[1].size() - 2 + 1); // +1: null-terminator, -2: quotes
+                // third token is a block name
+                inc += line[2].size() + 1;
             }
         } catch (const std::out_of_range &e) {
             throw ("unrecognised instruction: `" + instr + '`');
         }
 
         if (inc == 0) {
-            throw ("fail: line is not empty and requires 0 bytes: " + line);
+            throw ("fail: line is not empty and requires 0 bytes: " + line.text);
         }
 
         bytes += inc;
@@ -183,80 +223,25 @@ uint16_t Program::countBytes(const vector<string>& lines) {
 }
 
 
-int Program::getInstructionBytecodeOffset(int instr, int count) {
+int Program::getInstructionBytecodeOffset(int instr) {
     /** Returns bytecode offset for given instruction index.
      *
-     *  The "count" parameter is there to pass assumed instruction count to
-     *  avoid recalculating it on every call to this function.
-     *  It can be passed as 0 to trigger calculation.
+     *  Negative indexes count from the end of the program.
      */
+    const vector<int>& offsets = instructionOffsets();
+    int count = offsets.size();
+    int index = (instr >= 0 ? instr : count+instr);
 
-    // check if instruction count was passed, and calculate it if not
-    count = (count >= 0 ? count : instructionCount());
-
-    int offset = 0;
-    int inc;
-    for (int i = 0; i < (instr >= 0 ? instr : count+instr); ++i) {
-        /*  This loop iterates over so many instructions as needed to find bytecode offset for requested instruction.
-         *
-         *  Each time, the offset is increased by `inc` - which is equal to *1 plus size of operands of instructions at current index*.
-         */
-        string opcode_name;
-        try {
-            opcode_name = OP_NAMES.at(OPCODE(program[offset]));
-        } catch (const std::out_of_range& e) {
-            ostringstream oss;
-            oss << "instruction not found in OP_NAMES: " << OPCODE(program[offset]);
-            throw oss.str();
-        }
-
-
-        try {
-            inc = OP_SIZES.at(opcode_name);
-        } catch (const std::out_of_range& e) {
-            throw ("instruction " + opcode_name + " not found in OP_SIZES");
-        }
-
-        if (scream) {
-            cout << "[asm] debug: offsetting: " << opcode_name << ": +" << inc;
-        }
-
-        OPCODE opcode = OPCODE(program[offset]);
-        if ((opcode == EXIMPORT) or (opcode == TRY) or (opcode == LINK)) {
-            string s(program+offset+1);
-            if (scream) {
-                cout << '+' << s.size() << " (function/module name at byte " << offset+1 << ": `" << s << "`)";
-            }
-            inc += s.size()+1;
-        }
-        if ((opcode == CALL) or (opcode == EXCALL) or (opcode == CLOSURE) or (opcode == FUNCTION)) {
-            string s(program+offset+sizeof(bool)+sizeof(int)+1);
-            if (scream) {
-                cout << '+' << s.size() << " (function/module name at byte " << offset+1 << ": `" << s << "`)";
-            }
-            inc += s.size()+1;
-        }
-        if (opcode == STRSTORE) {
-            string s(program+offset+inc);
-            if (scream) {
-                cout << '+' << s.size()+1 << " (string at byte " << offset+inc << ": `" << s << "`)";
-            }
-            inc += s.size()+1;
-        }
-
-        if (scream) {
-            cout << " bytes" << endl;
-        }
-
-        offset += inc;
-        if (offset+1 > bytes) {
-            cout << "instruction offset out of bounds: check your branches: ";
-            cout << "offset/bytecode size: ";
-            cout << offset << '/' << bytes << endl;
-            throw "instruction offset out of bounds: check your branches";
-        }
+    if (index == 0) {
+        return 0;
+    }
+    if (index < 0 or index >= count) {
+        cout << "instruction offset out of bounds: check your branches: ";
+        cout << "instruction/instruction count: ";
+        cout << index << '/' << count << endl;
+        throw "instruction offset out of bounds: check your branches";
     }
-    return offset;
+    return offsets[index];
 }
 
 // FIXME: is unused, scheduled for removal
@@ -264,20 +249,19 @@ Program& Program::calculateBranches(unsigned offset) {
     /*  This function should be called after program is constructed
      *  to calculate correct bytecode offsets for BRANCH and JUMP instructions.
      */
-    int instruction_count = instructionCount();
     int* ptr;
 
     for (unsigned i = 0; i < branches.size(); ++i) {
         ptr = (int*)(branches[i]);
         cout << "[brch] calculating jump at " << (int)(branches[i]-program) << ", " << hex << (long)branches[i] << dec << " (target: " << *ptr << ") with offset " << offset << " = ";
-        (*ptr) = offset + getInstructionBytecodeOffset(*ptr, instruction_count);
+        (*ptr) = offset + getInstructionBytecodeOffset(*ptr);
         cout << *ptr << endl;
     }
 
     for (unsigned i = 0; i < branches_absolute.size(); ++i) {
         ptr = (int*)(branches_absolute[i]);
         cout << "[brch] calculating jump at " << (int)(branches_absolute[i]-program) << ", " << hex << (long)branches_absolute[i] << dec << " (target: " << *ptr << ") with offset " << 0 << " = ";
-        (*ptr) = getInstructionBytecodeOffset(*ptr, instruction_count);
+        (*ptr) = getInstructionBytecodeOffset(*ptr);
         cout << *ptr << endl;
     }
 
@@ -286,21 +270,25 @@ Program& Program::calculateBranches(unsigned offset) {
 
 Program& Program::calculateJumps(vector<tuple<int, int> > jump_positions) {
     /** Calculate jump targets in given bytecode.
+     *
+     *  Each jump is given as a (jump position, position of jumping instruction) pair.
+     *  Targets are instruction indexes, and
+     *  are replaced with byte offsets relative to the jumping instruction.
+     *  Instruction offsets are looked up in a table built in a single pass over the bytecode.
      */
-    int instruction_count = instructionCount();
     int* ptr;
 
-    int position, offset, adjustment;
+    int position, instruction, adjustment;
     for (tuple<int, int> jmp : jump_positions) {
-        tie(position, offset) = jmp;
+        tie(position, instruction) = jmp;
         ptr = (int*)(program+position);
         if (debug) {
-            cout << "[bcgen:jump] calculating jump at " << position << " (target: " << *ptr << ") with offset " << offset << endl;
+            cout << "[bcgen:jump] calculating jump at " << position << " (target: " << *ptr << ") from instruction at " << instruction << endl;
         }
-        adjustment = getInstructionBytecodeOffset(*ptr, instruction_count);
-        (*ptr) = offset + adjustment;
+        adjustment = getInstructionBytecodeOffset(*ptr);
+        (*ptr) = adjustment - instruction;
         if (debug) {
-            cout << "[bcgen:jump] calculated jump at " << position << " (total: " << adjustment << ") with offset " << offset << " = ";
+            cout << "[bcgen:jump] calculated jump at " << position << " (total: " << adjustment << ") from instruction at " << instruction << " = ";
             cout << *ptr << endl;
         }
     }
@@ -308,18 +296,55 @@ Program& Program::calculateJumps(vector<tuple<int, int> > jump_positions) {
     return (*this);
 }
 
-vector<unsigned> Program::jumps() {
-    /** Returns vector if bytecode points which contain jumps.
+Program& Program::calculateJumpsToByte(int offset) {
+    /** Calculate targets of jumps to bytes.
+     *
+     *  Targets of such jumps are byte offsets inside the module, and
+     *  are replaced with byte offsets relative to the jumping instruction.
+     *  Offset is the position at which this program is placed in the module.
+     */
+    int* ptr;
+    for (byte* jmp : branches_to_byte) {
+        ptr = (int*)jmp;
+        (*ptr) -= (offset + (int)(branch_instructions.at(jmp)-program));
+        if (debug) {
+            cout << "[bcgen:jump] calculated jump to byte at " << (int)(jmp-program) << " = " << *ptr << endl;
+        }
+    }
+
+    return (*this);
+}
+
+vector<tuple<int, int> > Program::jumps() {
+    /** Returns vector of bytecode points which contain jumps, and
+     *  positions of instructions these jumps belong to.
+     */
+    vector<tuple<int, int> > jmps;
+    for (byte* jmp : branches) { jmps.push_back(tuple<int, int>((jmp-program), (branch_instructions.at(jmp)-program))); }
+    return jmps;
+}
+
+vector<tuple<int, int> > Program::jumpsToByte() {
+    /** Returns vector of bytecode points which contain jumps to bytes, and
+     *  positions of instructions these jumps belong to.
      */
-    vector<unsigned> jmps;
-    for (byte* jmp : branches) { jmps.push_back( (unsigned)(jmp-program) ); }
+    vector<tuple<int, int> > jmps;
+    for (byte* jmp : branches_to_byte) { jmps.push_back(tuple<int, int>((jmp-program), (branch_instructions.at(jmp)-program))); }
     return jmps;
 }
 
-vector<unsigned> Program::jumpsAbsolute() {
-    /** Returns vector if bytecode points which contain absolute jumps.
+vector<tuple<int, ConstantKind, string> > Program::constantUses() {
+    /** Returns literals used by the program as (instruction offset, kind, value) triples,
+     *  in the order they were placed in constant pool.
+     */
+    return constant_uses;
+}
+
+vector<tuple<int, int> > Program::jumpsAbsolute() {
+    /** Returns vector of bytecode points which contain absolute jumps, and
+     *  positions of instructions these jumps belong to.
      */
-    vector<unsigned> jmps;
-    for (byte* jmp : branches_absolute) { jmps.push_back( (unsigned)(jmp-program) ); }
+    vector<tuple<int, int> > jmps;
+    for (byte* jmp : branches_absolute) { jmps.push_back(tuple<int, int>((jmp-program), (branch_instructions.at(jmp)-program))); }
     return jmps;
 }
@@ -161,6 +161,195 @@ Program& Program::ieq(int_op rega, int_op regb, int_op regr) {
     return (*this);
 }
 
+Program& Program::iaddi(int_op rega, int_op regb, int_op i) {
+    /*  Inserts iaddi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::iaddi(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::isubi(int_op rega, int_op regb, int_op i) {
+    /*  Inserts isubi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::isubi(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::imuli(int_op rega, int_op regb, int_op i) {
+    /*  Inserts imuli instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::imuli(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::idivi(int_op rega, int_op regb, int_op i) {
+    /*  Inserts idivi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::idivi(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::ilti(int_op rega, int_op regb, int_op i) {
+    /*  Inserts ilti instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::ilti(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::iltei(int_op rega, int_op regb, int_op i) {
+    /*  Inserts iltei instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::iltei(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::igti(int_op rega, int_op regb, int_op i) {
+    /*  Inserts igti instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::igti(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::igtei(int_op rega, int_op regb, int_op i) {
+    /*  Inserts igtei instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::igtei(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::ieqi(int_op rega, int_op regb, int_op i) {
+    /*  Inserts ieqi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::ieqi(addr_ptr, rega, regb, i);
+    return (*this);
+}
+
+Program& Program::tiadd(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tiadd instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tiadd(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tisub(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tisub instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tisub(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::timul(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts timul instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::timul(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tidiv(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tidiv instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tidiv(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tilt(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tilt instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tilt(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tilte(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tilte instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tilte(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tigt(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tigt instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tigt(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tigte(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tigte instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tigte(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::tieq(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts tieq instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::tieq(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::giadd(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts giadd instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::giadd(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gisub(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gisub instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gisub(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gimul(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gimul instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gimul(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gidiv(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gidiv instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gidiv(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gilt(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gilt instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gilt(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gilte(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gilte instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gilte(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gigt(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gigt instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gigt(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gigte(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gigte instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gigte(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::gieq(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts gieq instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::gieq(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
 Program& Program::fstore(int_op regno, float f) {
     /*  Inserts fstore instruction to bytecode.
      *
@@ -169,7 +358,7 @@ Program& Program::fstore(int_op regno, float f) {
      *  regno - register number
      *  f     - value to store
      */
-    addr_ptr = cg::bytecode::fstore(addr_ptr, regno, f);
+    addr_ptr = cg::bytecode::fstore(addr_ptr, regno, constant(CONSTANT_FLOAT, string((const char*)&f, sizeof(float))));
     return (*this);
 }
 
@@ -290,6 +479,69 @@ Program& Program::feq(int_op rega, int_op regb, int_op regr) {
     return (*this);
 }
 
+Program& Program::faddi(int_op rega, int_op regb, float f) {
+    /*  Inserts faddi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::faddi(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fsubi(int_op rega, int_op regb, float f) {
+    /*  Inserts fsubi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fsubi(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fmuli(int_op rega, int_op regb, float f) {
+    /*  Inserts fmuli instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fmuli(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fdivi(int_op rega, int_op regb, float f) {
+    /*  Inserts fdivi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fdivi(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::flti(int_op rega, int_op regb, float f) {
+    /*  Inserts flti instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::flti(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fltei(int_op rega, int_op regb, float f) {
+    /*  Inserts fltei instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fltei(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fgti(int_op rega, int_op regb, float f) {
+    /*  Inserts fgti instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fgti(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::fgtei(int_op rega, int_op regb, float f) {
+    /*  Inserts fgtei instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::fgtei(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
+Program& Program::feqi(int_op rega, int_op regb, float f) {
+    /*  Inserts feqi instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::feqi(addr_ptr, rega, regb, f);
+    return (*this);
+}
+
 Program& Program::bstore(int_op regno, byte_op b) {
     /*  Inserts bstore instruction to bytecode.
      *
@@ -332,8 +584,107 @@ Program& Program::stof(int_op a, int_op b) {
 
 Program& Program::strstore(int_op reg, string s) {
     /*  Inserts strstore instruction.
+     *  Literal is given with its quotes, and is placed in constant pool without them.
+     */
+    addr_ptr = cg::bytecode::strstore(addr_ptr, reg, constant(CONSTANT_STRING, s.substr(1, s.size()-2)));
+    return (*this);
+}
+
+Program& Program::streq(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts streq instruction to bytecode.
+     *
+     *  :params:
+     *
+     *  rega    - register index in which to store the result
+     *  regb    - register index of first operand
+     *  regr    - register index of second operand
+     */
+    addr_ptr = cg::bytecode::streq(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::strbuild(int_op regno) {
+    /*  Inserts strbuild instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strbuild(addr_ptr, regno);
+    return (*this);
+}
+
+Program& Program::strappend(int_op a, int_op b) {
+    /*  Inserts strappend instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strappend(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::strappendr(int_op a, int_op b) {
+    /*  Inserts strappendr instruction to bytecode.
      */
-    addr_ptr = cg::bytecode::strstore(addr_ptr, reg, s);
+    addr_ptr = cg::bytecode::strappendr(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::strfinal(int_op a, int_op b) {
+    /*  Inserts strfinal instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strfinal(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::strlen(int_op a, int_op b) {
+    /*  Inserts strlen instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strlen(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::stradd(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts stradd instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::stradd(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::strsub(int_op a, int_op b, int_op c, int_op d) {
+    /*  Inserts strsub instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strsub(addr_ptr, a, b, c, d);
+    return (*this);
+}
+
+Program& Program::strfind(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts strfind instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strfind(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::strcmp(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts strcmp instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strcmp(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::strsplit(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts strsplit instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::strsplit(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::atom(int_op reg, string s) {
+    /*  Inserts atom instruction.
+     *  Name is given with its quotes, and is placed in constant pool without them.
+     */
+    addr_ptr = cg::bytecode::atom(addr_ptr, reg, constant(CONSTANT_ATOM, s.substr(1, s.size()-2)));
+    return (*this);
+}
+
+Program& Program::atomeq(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts atomeq instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::atomeq(addr_ptr, rega, regb, regr);
     return (*this);
 }
 
@@ -379,6 +730,34 @@ Program& Program::vlen(int_op vec, int_op reg) {
     return (*this);
 }
 
+Program& Program::vslice(int_op a, int_op b, int_op c, int_op d) {
+    /*  Inserts vslice instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::vslice(addr_ptr, a, b, c, d);
+    return (*this);
+}
+
+Program& Program::vsat(int_op rega, int_op regb, int_op regr) {
+    /*  Inserts vsat instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::vsat(addr_ptr, rega, regb, regr);
+    return (*this);
+}
+
+Program& Program::vslen(int_op a, int_op b) {
+    /*  Inserts vslen instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::vslen(addr_ptr, a, b);
+    return (*this);
+}
+
+Program& Program::vsmat(int_op a, int_op b) {
+    /*  Inserts vsmat instruction to bytecode.
+     */
+    addr_ptr = cg::bytecode::vsmat(addr_ptr, a, b);
+    return (*this);
+}
+
 Program& Program::lognot(int_op reg) {
     /*  Inserts not instuction.
      */
@@ -615,6 +994,14 @@ Program& Program::call(int_op reg, const string& fn_name) {
     return (*this);
 }
 
+Program& Program::tailcall(const string& fn_name) {
+    /*  Inserts tailcall instruction.
+     *  Byte offset is calculated automatically.
+     */
+    addr_ptr = cg::bytecode::tailcall(addr_ptr, fn_name);
+    return (*this);
+}
+
 Program& Program::jump(int addr, enum JUMPTYPE is_absolute) {
     /*  Inserts jump instruction. Parameter is instruction index.
      *  Byte offset is calculated automatically.
@@ -623,10 +1010,13 @@ Program& Program::jump(int addr, enum JUMPTYPE is_absolute) {
      *
      *  addr:int    - index of the instruction to which to branch
      */
-    // save jump position if jump is not to byte
-    if (is_absolute != JMP_TO_BYTE) {
+    // save jump position
+    if (is_absolute == JMP_TO_BYTE) {
+        branches_to_byte.push_back(addr_ptr+1);
+    } else {
         (is_absolute == JMP_ABSOLUTE ? branches_absolute : branches).push_back((addr_ptr+1));
     }
+    branch_instructions[addr_ptr+1] = addr_ptr;
 
     addr_ptr = cg::bytecode::jump(addr_ptr, addr);
     return (*this);
@@ -636,23 +1026,29 @@ Program& Program::branch(int_op regc, int addr_truth, enum JUMPTYPE absolute_tru
     /*  Inserts branch instruction.
      *  Byte offset is calculated automatically.
      */
-    byte* jump_position_in_bytecode = addr_ptr;
+    byte* branch_instruction = addr_ptr;
+    addr_ptr = cg::bytecode::branch(addr_ptr, regc, addr_truth, addr_false);
 
-    jump_position_in_bytecode += sizeof(byte); // for opcode
-    jump_position_in_bytecode += sizeof(bool); // for at-register flag
-    jump_position_in_bytecode += sizeof(int);  // for integer with register index
-    // save jump position if jump is not to byte
-    if (absolute_truth != JMP_TO_BYTE) {
+    // jump addresses are the last operands of branch, and
+    // their position depends on the width of condition register operand
+    byte* jump_position_in_bytecode = (addr_ptr - 2*sizeof(int));
+    // save jump position
+    if (absolute_truth == JMP_TO_BYTE) {
+        branches_to_byte.push_back(jump_position_in_bytecode);
+    } else {
         (absolute_truth == JMP_ABSOLUTE ? branches_absolute : branches).push_back(jump_position_in_bytecode);
     }
+    branch_instructions[jump_position_in_bytecode] = branch_instruction;
 
     jump_position_in_bytecode += sizeof(int);  // for integer with jump address
-    // save jump position if jump is not to byte
-    if (absolute_false != JMP_TO_BYTE) {
-        (absolute_truth == JMP_ABSOLUTE ? branches_absolute : branches).push_back(jump_position_in_bytecode);
+    // save jump position
+    if (absolute_false == JMP_TO_BYTE) {
+        branches_to_byte.push_back(jump_position_in_bytecode);
+    } else {
+        (absolute_false == JMP_ABSOLUTE ? branches_absolute : branches).push_back(jump_position_in_bytecode);
     }
+    branch_instructions[jump_position_in_bytecode] = branch_instruction;
 
-    addr_ptr = cg::bytecode::branch(addr_ptr, regc, addr_truth, addr_false);
     return (*this);
 }
 
@@ -0,0 +1,170 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <tuple>
+#include <map>
+#include <algorithm>
+#include <viua/bytecode/format.h>
+#include <viua/symtab.h>
+using namespace std;
+
+
+const uint32_t SYMTAB_ENTRY_FIELDS = 4;
+
+
+static void appendField(string& out, uint32_t value) {
+    out.append((const char*)&value, sizeof(uint32_t));
+}
+
+
+uint32_t SymbolTable::hash(const string& name) {
+    /** FNV-1a hash of symbol name.
+     */
+    uint32_t h = 2166136261u;
+    for (unsigned i = 0; i < name.size(); ++i) {
+        h ^= static_cast<unsigned char>(name[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+string SymbolTable::build(const map<string, bytecode_size_type>& functions, const map<string, bytecode_size_type>& blocks) {
+    /** Build symbol table section for given functions and blocks.
+     *
+     *  Returned string holds the section without its size field.
+     */
+    vector<tuple<string, bytecode_size_type, SymbolKind> > symbols;
+    for (auto p : functions) { symbols.push_back(make_tuple(p.first, p.second, SYMBOL_FUNCTION)); }
+    for (auto p : blocks) { symbols.push_back(make_tuple(p.first, p.second, SYMBOL_BLOCK)); }
+
+    // bucket count is a power of two so bucket can be selected with a mask
+    uint32_t bucket_count = 1;
+    while (bucket_count < symbols.size()) { bucket_count *= 2; }
+
+    vector<vector<unsigned> > chains(bucket_count);
+    for (unsigned i = 0; i < symbols.size(); ++i) {
+        chains[hash(get<0>(symbols[i])) & (bucket_count-1)].push_back(i);
+    }
+
+    string bucket_section, entry_section, string_section;
+    uint32_t entries_so_far = 0;
+    for (uint32_t b = 0; b < bucket_count; ++b) {
+        appendField(bucket_section, entries_so_far);
+        for (unsigned i : chains[b]) {
+            const string& name = get<0>(symbols[i]);
+            appendField(entry_section, hash(name));
+            appendField(entry_section, string_section.size());
+            appendField(entry_section, get<1>(symbols[i]));
+            appendField(entry_section, get<2>(symbols[i]));
+            string_section.append(name.c_str(), name.size()+1);
+            ++entries_so_far;
+        }
+    }
+    appendField(bucket_section, entries_so_far);
+
+    string section;
+    appendField(section, bucket_count);
+    appendField(section, entries_so_far);
+    return (section + bucket_section + entry_section + string_section);
+}
+
+
+uint32_t SymbolTable::field(const char* base, uint32_t index) const {
+    uint32_t value;
+    memcpy(&value, base+(index*sizeof(uint32_t)), sizeof(uint32_t));
+    return value;
+}
+
+bool SymbolTable::lookup(const string& name, SymbolKind kind, bytecode_size_type& address) const {
+    /** Find address of a function or block.
+     *
+     *  Returns false if there is no such symbol, address is set otherwise.
+     */
+    if (empty()) {
+        return false;
+    }
+
+    uint32_t h = hash(name);
+    uint32_t bucket = (h & (bucket_count-1));
+    uint32_t first = field(buckets, bucket), last = field(buckets, bucket+1);
+    if (last > entry_count) {
+        return false;
+    }
+    for (uint32_t i = first; i < last; ++i) {
+        uint32_t entry = (i * SYMTAB_ENTRY_FIELDS);
+        if (field(entries, entry) != h or field(entries, entry+3) != kind) {
+            continue;
+        }
+        uint32_t name_offset = field(entries, entry+1);
+        if (name_offset < strings_size and name == (strings+name_offset)) {
+            address = field(entries, entry+2);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SymbolTable::empty() const {
+    return (entry_count == 0);
+}
+uint32_t SymbolTable::size() const {
+    return entry_count;
+}
+uint32_t SymbolTable::count(SymbolKind kind) const {
+    /** Count symbols of given kind.
+     *
+     *  This has to walk all entries so should not be used on hot paths.
+     */
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        if (field(entries, (i * SYMTAB_ENTRY_FIELDS)+3) == kind) { ++n; }
+    }
+    return n;
+}
+vector<bytecode_size_type> SymbolTable::addresses() const {
+    /** Return sorted addresses of all symbols.
+     *
+     *  Code of a function or block extends up to the next address, so
+     *  these are boundaries of its code.
+     *  This has to walk all entries so should not be used on hot paths.
+     */
+    vector<bytecode_size_type> all;
+    for (uint32_t i = 0; i < entry_count; ++i) {
+        all.push_back(field(entries, (i * SYMTAB_ENTRY_FIELDS)+2));
+    }
+    sort(all.begin(), all.end());
+    return all;
+}
+
+
+SymbolTable::SymbolTable(const char* s, bytecode_size_type sz):
+    section(s), section_size(sz),
+    bucket_count(0), entry_count(0),
+    buckets(0), entries(0), strings(0), strings_size(0)
+{
+    if (section == 0 or section_size == 0) {
+        return;
+    }
+    if (section_size < 2*sizeof(uint32_t)) {
+        throw string("fatal: malformed symbol table");
+    }
+
+    uint32_t buckets_n = field(section, 0);
+    uint32_t entries_n = field(section, 1);
+    unsigned long long header_size = (2 + (unsigned long long)buckets_n + 1 + (unsigned long long)entries_n*SYMTAB_ENTRY_FIELDS) * sizeof(uint32_t);
+    if (buckets_n == 0 or (buckets_n & (buckets_n-1)) != 0 or header_size > section_size) {
+        throw string("fatal: malformed symbol table");
+    }
+
+    bucket_count = buckets_n;
+    entry_count = entries_n;
+    buckets = section + 2*sizeof(uint32_t);
+    entries = buckets + (bucket_count+1)*sizeof(uint32_t);
+    strings = section + header_size;
+    strings_size = (section_size - header_size);
+
+    if (field(buckets, bucket_count) != entry_count or (strings_size > 0 and strings[strings_size-1] != '\0')) {
+        throw string("fatal: malformed symbol table");
+    }
+}
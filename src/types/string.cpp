@@ -1,3 +1,5 @@
+#include <cstdlib>
+#include <cerrno>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -6,38 +8,164 @@
 #include <viua/types/type.h>
 #include <viua/types/vector.h>
 #include <viua/types/string.h>
+#include <viua/types/stringbuilder.h>
+#include <viua/types/exception.h>
 using namespace std;
 
 
+std::string& String::value() {
+    /** Return modifiable text of the string.
+     *
+     *  Interned strings are detached from the pool first (their text is copied) because
+     *  the pool is shared by every string created from the same literal and
+     *  must not be modified.
+     */
+    if (interned) {
+        svalue = *interned;
+        interned = 0;
+    }
+    return svalue;
+}
+
+bool String::equals(const String* that) const {
+    /** Check if two strings are equal.
+     *
+     *  Pool contains every text only once so two interned strings are equal only if
+     *  they point to the same pool entry, and
+     *  comparing the pointers is enough.
+     */
+    if (interned and that->interned) {
+        return (interned == that->interned);
+    }
+    return (view() == that->view());
+}
+
 Integer* String::size() {
     /** Return size of the string.
      */
-    return new Integer(int(svalue.size()));
+    return new Integer(int(view().size()));
 }
 
 String* String::sub(int b, int e) {
     /** Return substring extracted from this object.
+     *
+     *  Negative begin index is counted from the end of the string, and
+     *  negative end index means "up to this index from the end" (-1 is the end of the string).
      */
-    return new String(str::sub(svalue, b, e));
+    const string& s = view();
+    int size = int(s.size());
+    if (b < 0) { b = (size+b); }
+    if (e < 0) { e = (size+e+1); }
+    if (b < 0) { b = 0; }
+    if (e > size) { e = size; }
+    if (b >= e) {
+        return new String();
+    }
+    return new String(s.substr(b, (e-b)));
 }
 
 String* String::add(String* s) {
     /** Append string to this string.
      */
-    svalue += s->value();
+    value() += s->view();
     return this;
 }
 
 String* String::join(Vector* v) {
     /** Use this string to join objects in vector.
+     *
+     *  Pieces are collected first and
+     *  the result is then allocated once, with its final size.
      */
-    string s = "";
+    StringBuilder sb;
     int vector_len = v->len();
     for (int i = 0; i < vector_len; ++i) {
-        s += v->at(i)->str();
+        sb.append(v->at(i));
         if (i < (vector_len-1)) {
-            s += svalue;
+            sb.append(this);
         }
     }
-    return new String(s);
+    return sb.finalize();
+}
+
+String* String::concat(const String* s) const {
+    /** Return new string being a concatenation of this string and s.
+     *
+     *  Result is allocated once, with its final size.
+     */
+    string result;
+    result.reserve(view().size() + s->view().size());
+    result += view();
+    result += s->view();
+    return new String(result);
+}
+
+Integer* String::find(const String* s) const {
+    /** Return index of first occurence of s in this string, or
+     *  -1 if s does not occur in this string.
+     */
+    string::size_type position = view().find(s->view());
+    return new Integer(position == string::npos ? -1 : int(position));
+}
+
+Integer* String::compare(const String* s) const {
+    /** Compare this string with s.
+     *
+     *  Returns -1 if this string sorts before s, 1 if it sorts after s, and
+     *  0 if the strings are equal.
+     */
+    if (equals(s)) {
+        return new Integer(0);
+    }
+    int result = view().compare(s->view());
+    return new Integer(result < 0 ? -1 : (result > 0 ? 1 : 0));
+}
+
+Vector* String::split(const String* separator) const {
+    /** Split this string on every occurence of separator.
+     */
+    const string& sep = separator->view();
+    if (sep.size() == 0) {
+        throw new Exception("empty separator");
+    }
+
+    const string& s = view();
+    Vector* parts = new Vector();
+    string::size_type begin = 0, end = 0;
+    while ((end = s.find(sep, begin)) != string::npos) {
+        parts->push(new String(s.substr(begin, (end-begin))));
+        begin = (end + sep.size());
+    }
+    parts->push(new String(s.substr(begin)));
+    return parts;
+}
+
+int String::toint() const {
+    /** Convert text of the string to an integer.
+     *
+     *  Text is parsed in place, without making a copy of it.
+     */
+    const char* begin = view().c_str();
+    char* end = 0;
+    errno = 0;
+    long n = strtol(begin, &end, 10);
+    if (end == begin or errno == ERANGE or n != (int)n) {
+        throw new Exception("invalid integer: " + str::enquote(view()));
+    }
+    return int(n);
+}
+
+float String::tofloat() const {
+    /** Convert text of the string to a floating point number.
+     *
+     *  Text is parsed in place, without making a copy of it.
+     */
+    const char* begin = view().c_str();
+    char* end = 0;
+    errno = 0;
+    float f = strtof(begin, &end);
+    if (end == begin or errno == ERANGE) {
+        throw new Exception("invalid float: " + str::enquote(view()));
+    }
+    return f;
 }
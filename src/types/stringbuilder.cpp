@@ -0,0 +1,68 @@
+#include <string>
+#include <vector>
+#include <deque>
+#include <viua/types/type.h>
+#include <viua/types/string.h>
+#include <viua/types/stringbuilder.h>
+using namespace std;
+
+
+string StringBuilder::flatten() const {
+    /** Concatenate all pieces into one string.
+     *
+     *  Size of the result is known in advance so it is allocated only once.
+     */
+    string s;
+    s.reserve(length);
+    for (unsigned i = 0; i < pieces.size(); ++i) {
+        s += *pieces[i];
+    }
+    return s;
+}
+
+StringBuilder* StringBuilder::append(const string& s) {
+    /** Append a copy of given text.
+     */
+    owned.push_back(s);
+    pieces.push_back(&owned.back());
+    length += s.size();
+    return this;
+}
+
+StringBuilder* StringBuilder::append(const String* s) {
+    /** Append text of a string.
+     *
+     *  Text of interned strings lives in the string pool and is immutable so
+     *  it is referenced instead of being copied.
+     */
+    if (s->isinterned()) {
+        pieces.push_back(&s->view());
+        length += s->view().size();
+    } else {
+        append(s->view());
+    }
+    return this;
+}
+
+StringBuilder* StringBuilder::append(Type* object) {
+    /** Append string representation of an object.
+     */
+    if (object->type() == "String") {
+        return append(static_cast<String*>(object));
+    }
+    return append(object->str());
+}
+
+StringBuilder* StringBuilder::appendrepr(Type* object) {
+    /** Append repr of an object.
+     */
+    return append(object->repr());
+}
+
+String* StringBuilder::finalize() const {
+    /** Return flat String with text of the builder.
+     *
+     *  Builder is left intact and can be appended to and finalized again.
+     */
+    return new String(flatten());
+}
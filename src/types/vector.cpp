@@ -3,11 +3,13 @@
 #include <sstream>
 #include <viua/types/type.h>
 #include <viua/types/vector.h>
+#include <viua/types/vectorview.h>
 #include <viua/exceptions.h>
 using namespace std;
 
 
 Type* Vector::insert(int index, Type* object) {
+    detachViews();
     if (index < 0) { index = (internal_object.size()+index); }
     if ((index < 0) or (index >= (int)internal_object.size() and internal_object.size() != 0)) {
         throw new OutOfRangeException("vector index out of range");
@@ -18,11 +20,13 @@ Type* Vector::insert(int index, Type* object) {
 }
 
 Type* Vector::push(Type* object) {
+    detachViews();
     internal_object.push_back(object);
     return object;
 }
 
 Type* Vector::pop(int index) {
+    detachViews();
     // FIXME: allow popping from arbitrary indexes
     Type* ptr = internal_object.back();
     internal_object.pop_back();
@@ -52,3 +56,44 @@ string Vector::str() const {
     oss << "]";
     return oss.str();
 }
+
+VectorView* Vector::view(int begin, int end) {
+    /** Create a view of [begin, end) range of this vector.
+     *
+     *  Negative begin is counted from the end of the vector, and
+     *  negative end means "up to the element at this index from the end" (-1 is the end of vector).
+     */
+    int size = (int)internal_object.size();
+    if (begin < 0) { begin = (size+begin); }
+    if (end < 0) { end = (size+end+1); }
+    if (begin < 0 or end > size or begin > end) {
+        throw new OutOfRangeException("vector slice out of range");
+    }
+    VectorView* v = new VectorView(this, begin, (end-begin));
+    views.push_back(v);
+    return v;
+}
+
+void Vector::detachViews() {
+    /** Detach all views of this vector.
+     *
+     *  Views copy the elements they refer to and
+     *  stop referring to this vector.
+     */
+    while (views.size()) {
+        views.back()->detach();
+        views.pop_back();
+    }
+}
+
+void Vector::forget(VectorView* v) {
+    /** Stop tracking a view.
+     *  Called by views that are destroyed while this vector is still alive.
+     */
+    for (unsigned i = 0; i < views.size(); ++i) {
+        if (views[i] == v) {
+            views.erase(views.begin()+i);
+            break;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include <string>
+#include <vector>
+#include <sstream>
+#include <viua/types/type.h>
+#include <viua/types/vector.h>
+#include <viua/types/vectorview.h>
+#include <viua/exceptions.h>
+using namespace std;
+
+
+Type* VectorView::at(int index) {
+    /** Return element at given index of the view.
+     *
+     *  Returned value is a reference, just like in Vector::at().
+     */
+    if (index < 0) { index = (length+index); }
+    if ((index < 0) or (index >= length)) {
+        throw new OutOfRangeException("vector view index out of range");
+    }
+    return (parent ? parent->element(offset+index) : detached[index]);
+}
+
+VectorView* VectorView::slice(int begin, int end) {
+    /** Create a view of a range of this view.
+     *
+     *  Attached views create views of their parent so no copying is done.
+     */
+    if (begin < 0) { begin = (length+begin); }
+    if (end < 0) { end = (length+end+1); }
+    if (begin < 0 or end > length or begin > end) {
+        throw new OutOfRangeException("vector slice out of range");
+    }
+    if (parent) {
+        return parent->view(offset+begin, offset+end);
+    }
+    vector<Type*> elements;
+    for (int i = begin; i < end; ++i) {
+        elements.push_back(detached[i]->copy());
+    }
+    return new VectorView(elements);
+}
+
+Vector* VectorView::materialize() const {
+    /** Create a Vector with copies of the elements in this view.
+     */
+    Vector* v = new Vector();
+    for (int i = 0; i < length; ++i) {
+        v->push((parent ? parent->element(offset+i) : detached[i])->copy());
+    }
+    return v;
+}
+
+void VectorView::detach() {
+    /** Take private copies of elements and stop referring to parent vector.
+     *
+     *  Parent is not notified - it is the caller of this function.
+     */
+    if (parent == 0) { return; }
+    for (int i = 0; i < length; ++i) {
+        detached.push_back(parent->element(offset+i)->copy());
+    }
+    offset = 0;
+    parent = 0;
+}
+
+Type* VectorView::copy() const {
+    if (parent) {
+        return parent->view(offset, offset+length);
+    }
+    vector<Type*> elements;
+    for (int i = 0; i < length; ++i) {
+        elements.push_back(detached[i]->copy());
+    }
+    return new VectorView(elements);
+}
+
+string VectorView::str() const {
+    ostringstream oss;
+    oss << "[";
+    for (int i = 0; i < length; ++i) {
+        oss << (parent ? parent->element(offset+i) : detached[i])->repr() << (i < length-1 ? ", " : "");
+    }
+    oss << "]";
+    return oss.str();
+}
+
+VectorView::~VectorView() {
+    if (parent) {
+        parent->forget(this);
+    }
+    while (detached.size()) {
+        delete detached.back();
+        detached.pop_back();
+    }
+}
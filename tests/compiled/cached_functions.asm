@@ -0,0 +1,24 @@
+.function: bar
+    strstore 1 "bar"
+    print 1
+    end
+.end
+
+.function: foo
+    strstore 1 "foo"
+    print 1
+    atom 2 'ok'
+    print 2
+    end
+.end
+
+.function: main
+    strstore 1 "main"
+    print 1
+    frame 0
+    call foo
+    frame 0
+    call bar
+    izero 0
+    end
+.end
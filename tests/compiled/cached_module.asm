@@ -0,0 +1,14 @@
+.function: foo
+    strstore 1 "foo"
+    print 1
+    atom 2 'ok'
+    print 2
+    end
+.end
+
+.function: main
+    frame 0
+    call foo
+    izero 0
+    end
+.end
@@ -0,0 +1,22 @@
+.function: main
+    strstore 1 "Hello World!"
+    print 1
+    fstore 2 0.5
+    fstore 3 0.5
+    fadd 2 3 2
+    print 2
+    atom 4 'ok'
+    print 4
+    frame 0
+    call foo
+    izero 0
+    end
+.end
+
+.function: foo
+    strstore 1 "Hello World!"
+    print 1
+    atom 2 'ok'
+    print 2
+    end
+.end
@@ -0,0 +1,6 @@
+.signature: foo
+.inline: foo
+.function: main
+    izero 0
+    end
+.end
@@ -0,0 +1,13 @@
+.function: unused
+    strstore 0 "dead"
+    fstore 1 0.5
+    end
+.end
+
+.function: foo
+    strstore 1 "foo"
+    print 1
+    fstore 2 1.5
+    print 2
+    end
+.end
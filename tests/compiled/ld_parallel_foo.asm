@@ -0,0 +1,22 @@
+.function: unused
+    strstore 1 "unused"
+    print 1
+    end
+.end
+
+.function: foo
+    istore 1 0
+    istore 2 2
+    .mark: loop
+    ilt 3 1 2
+    branch 3 body done
+    .mark: body
+    strstore 4 "foo"
+    print 4
+    iinc 1
+    jump loop
+    .mark: done
+    atom 5 'ok'
+    print 5
+    end
+.end
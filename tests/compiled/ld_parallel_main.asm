@@ -0,0 +1,8 @@
+.function: main
+    strstore 1 "main"
+    print 1
+    frame 0
+    call foo
+    izero 0
+    end
+.end
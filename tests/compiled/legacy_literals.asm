@@ -0,0 +1,17 @@
+.function: main
+    strstore 1 "Hello World!"
+    print 1
+    fstore 2 0.5
+    fadd 2 2 2
+    print 2
+    atom 3 'ok'
+    print 3
+    istore 4 300
+    istore 5 4
+    iadd 4 @5 4
+    print 4
+    bstore 6 65
+    print 6
+    izero 0
+    end
+.end
@@ -0,0 +1,12010 @@
+.function: main
+    istore 1 0
+    jump state_0
+    .mark: state_0
+    iinc 1
+    jump state_2
+    .mark: state_1
+    iinc 1
+    jump state_-1
+    .mark: state_2
+    iinc 1
+    jump state_4
+    .mark: state_3
+    iinc 1
+    jump state_1
+    .mark: state_4
+    iinc 1
+    jump state_6
+    .mark: state_5
+    iinc 1
+    jump state_3
+    .mark: state_6
+    iinc 1
+    jump state_8
+    .mark: state_7
+    iinc 1
+    jump state_5
+    .mark: state_8
+    iinc 1
+    jump state_10
+    .mark: state_9
+    iinc 1
+    jump state_7
+    .mark: state_10
+    iinc 1
+    jump state_12
+    .mark: state_11
+    iinc 1
+    jump state_9
+    .mark: state_12
+    iinc 1
+    jump state_14
+    .mark: state_13
+    iinc 1
+    jump state_11
+    .mark: state_14
+    iinc 1
+    jump state_16
+    .mark: state_15
+    iinc 1
+    jump state_13
+    .mark: state_16
+    iinc 1
+    jump state_18
+    .mark: state_17
+    iinc 1
+    jump state_15
+    .mark: state_18
+    iinc 1
+    jump state_20
+    .mark: state_19
+    iinc 1
+    jump state_17
+    .mark: state_20
+    iinc 1
+    jump state_22
+    .mark: state_21
+    iinc 1
+    jump state_19
+    .mark: state_22
+    iinc 1
+    jump state_24
+    .mark: state_23
+    iinc 1
+    jump state_21
+    .mark: state_24
+    iinc 1
+    jump state_26
+    .mark: state_25
+    iinc 1
+    jump state_23
+    .mark: state_26
+    iinc 1
+    jump state_28
+    .mark: state_27
+    iinc 1
+    jump state_25
+    .mark: state_28
+    iinc 1
+    jump state_30
+    .mark: state_29
+    iinc 1
+    jump state_27
+    .mark: state_30
+    iinc 1
+    jump state_32
+    .mark: state_31
+    iinc 1
+    jump state_29
+    .mark: state_32
+    iinc 1
+    jump state_34
+    .mark: state_33
+    iinc 1
+    jump state_31
+    .mark: state_34
+    iinc 1
+    jump state_36
+    .mark: state_35
+    iinc 1
+    jump state_33
+    .mark: state_36
+    iinc 1
+    jump state_38
+    .mark: state_37
+    iinc 1
+    jump state_35
+    .mark: state_38
+    iinc 1
+    jump state_40
+    .mark: state_39
+    iinc 1
+    jump state_37
+    .mark: state_40
+    iinc 1
+    jump state_42
+    .mark: state_41
+    iinc 1
+    jump state_39
+    .mark: state_42
+    iinc 1
+    jump state_44
+    .mark: state_43
+    iinc 1
+    jump state_41
+    .mark: state_44
+    iinc 1
+    jump state_46
+    .mark: state_45
+    iinc 1
+    jump state_43
+    .mark: state_46
+    iinc 1
+    jump state_48
+    .mark: state_47
+    iinc 1
+    jump state_45
+    .mark: state_48
+    iinc 1
+    jump state_50
+    .mark: state_49
+    iinc 1
+    jump state_47
+    .mark: state_50
+    iinc 1
+    jump state_52
+    .mark: state_51
+    iinc 1
+    jump state_49
+    .mark: state_52
+    iinc 1
+    jump state_54
+    .mark: state_53
+    iinc 1
+    jump state_51
+    .mark: state_54
+    iinc 1
+    jump state_56
+    .mark: state_55
+    iinc 1
+    jump state_53
+    .mark: state_56
+    iinc 1
+    jump state_58
+    .mark: state_57
+    iinc 1
+    jump state_55
+    .mark: state_58
+    iinc 1
+    jump state_60
+    .mark: state_59
+    iinc 1
+    jump state_57
+    .mark: state_60
+    iinc 1
+    jump state_62
+    .mark: state_61
+    iinc 1
+    jump state_59
+    .mark: state_62
+    iinc 1
+    jump state_64
+    .mark: state_63
+    iinc 1
+    jump state_61
+    .mark: state_64
+    iinc 1
+    jump state_66
+    .mark: state_65
+    iinc 1
+    jump state_63
+    .mark: state_66
+    iinc 1
+    jump state_68
+    .mark: state_67
+    iinc 1
+    jump state_65
+    .mark: state_68
+    iinc 1
+    jump state_70
+    .mark: state_69
+    iinc 1
+    jump state_67
+    .mark: state_70
+    iinc 1
+    jump state_72
+    .mark: state_71
+    iinc 1
+    jump state_69
+    .mark: state_72
+    iinc 1
+    jump state_74
+    .mark: state_73
+    iinc 1
+    jump state_71
+    .mark: state_74
+    iinc 1
+    jump state_76
+    .mark: state_75
+    iinc 1
+    jump state_73
+    .mark: state_76
+    iinc 1
+    jump state_78
+    .mark: state_77
+    iinc 1
+    jump state_75
+    .mark: state_78
+    iinc 1
+    jump state_80
+    .mark: state_79
+    iinc 1
+    jump state_77
+    .mark: state_80
+    iinc 1
+    jump state_82
+    .mark: state_81
+    iinc 1
+    jump state_79
+    .mark: state_82
+    iinc 1
+    jump state_84
+    .mark: state_83
+    iinc 1
+    jump state_81
+    .mark: state_84
+    iinc 1
+    jump state_86
+    .mark: state_85
+    iinc 1
+    jump state_83
+    .mark: state_86
+    iinc 1
+    jump state_88
+    .mark: state_87
+    iinc 1
+    jump state_85
+    .mark: state_88
+    iinc 1
+    jump state_90
+    .mark: state_89
+    iinc 1
+    jump state_87
+    .mark: state_90
+    iinc 1
+    jump state_92
+    .mark: state_91
+    iinc 1
+    jump state_89
+    .mark: state_92
+    iinc 1
+    jump state_94
+    .mark: state_93
+    iinc 1
+    jump state_91
+    .mark: state_94
+    iinc 1
+    jump state_96
+    .mark: state_95
+    iinc 1
+    jump state_93
+    .mark: state_96
+    iinc 1
+    jump state_98
+    .mark: state_97
+    iinc 1
+    jump state_95
+    .mark: state_98
+    iinc 1
+    jump state_100
+    .mark: state_99
+    iinc 1
+    jump state_97
+    .mark: state_100
+    iinc 1
+    jump state_102
+    .mark: state_101
+    iinc 1
+    jump state_99
+    .mark: state_102
+    iinc 1
+    jump state_104
+    .mark: state_103
+    iinc 1
+    jump state_101
+    .mark: state_104
+    iinc 1
+    jump state_106
+    .mark: state_105
+    iinc 1
+    jump state_103
+    .mark: state_106
+    iinc 1
+    jump state_108
+    .mark: state_107
+    iinc 1
+    jump state_105
+    .mark: state_108
+    iinc 1
+    jump state_110
+    .mark: state_109
+    iinc 1
+    jump state_107
+    .mark: state_110
+    iinc 1
+    jump state_112
+    .mark: state_111
+    iinc 1
+    jump state_109
+    .mark: state_112
+    iinc 1
+    jump state_114
+    .mark: state_113
+    iinc 1
+    jump state_111
+    .mark: state_114
+    iinc 1
+    jump state_116
+    .mark: state_115
+    iinc 1
+    jump state_113
+    .mark: state_116
+    iinc 1
+    jump state_118
+    .mark: state_117
+    iinc 1
+    jump state_115
+    .mark: state_118
+    iinc 1
+    jump state_120
+    .mark: state_119
+    iinc 1
+    jump state_117
+    .mark: state_120
+    iinc 1
+    jump state_122
+    .mark: state_121
+    iinc 1
+    jump state_119
+    .mark: state_122
+    iinc 1
+    jump state_124
+    .mark: state_123
+    iinc 1
+    jump state_121
+    .mark: state_124
+    iinc 1
+    jump state_126
+    .mark: state_125
+    iinc 1
+    jump state_123
+    .mark: state_126
+    iinc 1
+    jump state_128
+    .mark: state_127
+    iinc 1
+    jump state_125
+    .mark: state_128
+    iinc 1
+    jump state_130
+    .mark: state_129
+    iinc 1
+    jump state_127
+    .mark: state_130
+    iinc 1
+    jump state_132
+    .mark: state_131
+    iinc 1
+    jump state_129
+    .mark: state_132
+    iinc 1
+    jump state_134
+    .mark: state_133
+    iinc 1
+    jump state_131
+    .mark: state_134
+    iinc 1
+    jump state_136
+    .mark: state_135
+    iinc 1
+    jump state_133
+    .mark: state_136
+    iinc 1
+    jump state_138
+    .mark: state_137
+    iinc 1
+    jump state_135
+    .mark: state_138
+    iinc 1
+    jump state_140
+    .mark: state_139
+    iinc 1
+    jump state_137
+    .mark: state_140
+    iinc 1
+    jump state_142
+    .mark: state_141
+    iinc 1
+    jump state_139
+    .mark: state_142
+    iinc 1
+    jump state_144
+    .mark: state_143
+    iinc 1
+    jump state_141
+    .mark: state_144
+    iinc 1
+    jump state_146
+    .mark: state_145
+    iinc 1
+    jump state_143
+    .mark: state_146
+    iinc 1
+    jump state_148
+    .mark: state_147
+    iinc 1
+    jump state_145
+    .mark: state_148
+    iinc 1
+    jump state_150
+    .mark: state_149
+    iinc 1
+    jump state_147
+    .mark: state_150
+    iinc 1
+    jump state_152
+    .mark: state_151
+    iinc 1
+    jump state_149
+    .mark: state_152
+    iinc 1
+    jump state_154
+    .mark: state_153
+    iinc 1
+    jump state_151
+    .mark: state_154
+    iinc 1
+    jump state_156
+    .mark: state_155
+    iinc 1
+    jump state_153
+    .mark: state_156
+    iinc 1
+    jump state_158
+    .mark: state_157
+    iinc 1
+    jump state_155
+    .mark: state_158
+    iinc 1
+    jump state_160
+    .mark: state_159
+    iinc 1
+    jump state_157
+    .mark: state_160
+    iinc 1
+    jump state_162
+    .mark: state_161
+    iinc 1
+    jump state_159
+    .mark: state_162
+    iinc 1
+    jump state_164
+    .mark: state_163
+    iinc 1
+    jump state_161
+    .mark: state_164
+    iinc 1
+    jump state_166
+    .mark: state_165
+    iinc 1
+    jump state_163
+    .mark: state_166
+    iinc 1
+    jump state_168
+    .mark: state_167
+    iinc 1
+    jump state_165
+    .mark: state_168
+    iinc 1
+    jump state_170
+    .mark: state_169
+    iinc 1
+    jump state_167
+    .mark: state_170
+    iinc 1
+    jump state_172
+    .mark: state_171
+    iinc 1
+    jump state_169
+    .mark: state_172
+    iinc 1
+    jump state_174
+    .mark: state_173
+    iinc 1
+    jump state_171
+    .mark: state_174
+    iinc 1
+    jump state_176
+    .mark: state_175
+    iinc 1
+    jump state_173
+    .mark: state_176
+    iinc 1
+    jump state_178
+    .mark: state_177
+    iinc 1
+    jump state_175
+    .mark: state_178
+    iinc 1
+    jump state_180
+    .mark: state_179
+    iinc 1
+    jump state_177
+    .mark: state_180
+    iinc 1
+    jump state_182
+    .mark: state_181
+    iinc 1
+    jump state_179
+    .mark: state_182
+    iinc 1
+    jump state_184
+    .mark: state_183
+    iinc 1
+    jump state_181
+    .mark: state_184
+    iinc 1
+    jump state_186
+    .mark: state_185
+    iinc 1
+    jump state_183
+    .mark: state_186
+    iinc 1
+    jump state_188
+    .mark: state_187
+    iinc 1
+    jump state_185
+    .mark: state_188
+    iinc 1
+    jump state_190
+    .mark: state_189
+    iinc 1
+    jump state_187
+    .mark: state_190
+    iinc 1
+    jump state_192
+    .mark: state_191
+    iinc 1
+    jump state_189
+    .mark: state_192
+    iinc 1
+    jump state_194
+    .mark: state_193
+    iinc 1
+    jump state_191
+    .mark: state_194
+    iinc 1
+    jump state_196
+    .mark: state_195
+    iinc 1
+    jump state_193
+    .mark: state_196
+    iinc 1
+    jump state_198
+    .mark: state_197
+    iinc 1
+    jump state_195
+    .mark: state_198
+    iinc 1
+    jump state_200
+    .mark: state_199
+    iinc 1
+    jump state_197
+    .mark: state_200
+    iinc 1
+    jump state_202
+    .mark: state_201
+    iinc 1
+    jump state_199
+    .mark: state_202
+    iinc 1
+    jump state_204
+    .mark: state_203
+    iinc 1
+    jump state_201
+    .mark: state_204
+    iinc 1
+    jump state_206
+    .mark: state_205
+    iinc 1
+    jump state_203
+    .mark: state_206
+    iinc 1
+    jump state_208
+    .mark: state_207
+    iinc 1
+    jump state_205
+    .mark: state_208
+    iinc 1
+    jump state_210
+    .mark: state_209
+    iinc 1
+    jump state_207
+    .mark: state_210
+    iinc 1
+    jump state_212
+    .mark: state_211
+    iinc 1
+    jump state_209
+    .mark: state_212
+    iinc 1
+    jump state_214
+    .mark: state_213
+    iinc 1
+    jump state_211
+    .mark: state_214
+    iinc 1
+    jump state_216
+    .mark: state_215
+    iinc 1
+    jump state_213
+    .mark: state_216
+    iinc 1
+    jump state_218
+    .mark: state_217
+    iinc 1
+    jump state_215
+    .mark: state_218
+    iinc 1
+    jump state_220
+    .mark: state_219
+    iinc 1
+    jump state_217
+    .mark: state_220
+    iinc 1
+    jump state_222
+    .mark: state_221
+    iinc 1
+    jump state_219
+    .mark: state_222
+    iinc 1
+    jump state_224
+    .mark: state_223
+    iinc 1
+    jump state_221
+    .mark: state_224
+    iinc 1
+    jump state_226
+    .mark: state_225
+    iinc 1
+    jump state_223
+    .mark: state_226
+    iinc 1
+    jump state_228
+    .mark: state_227
+    iinc 1
+    jump state_225
+    .mark: state_228
+    iinc 1
+    jump state_230
+    .mark: state_229
+    iinc 1
+    jump state_227
+    .mark: state_230
+    iinc 1
+    jump state_232
+    .mark: state_231
+    iinc 1
+    jump state_229
+    .mark: state_232
+    iinc 1
+    jump state_234
+    .mark: state_233
+    iinc 1
+    jump state_231
+    .mark: state_234
+    iinc 1
+    jump state_236
+    .mark: state_235
+    iinc 1
+    jump state_233
+    .mark: state_236
+    iinc 1
+    jump state_238
+    .mark: state_237
+    iinc 1
+    jump state_235
+    .mark: state_238
+    iinc 1
+    jump state_240
+    .mark: state_239
+    iinc 1
+    jump state_237
+    .mark: state_240
+    iinc 1
+    jump state_242
+    .mark: state_241
+    iinc 1
+    jump state_239
+    .mark: state_242
+    iinc 1
+    jump state_244
+    .mark: state_243
+    iinc 1
+    jump state_241
+    .mark: state_244
+    iinc 1
+    jump state_246
+    .mark: state_245
+    iinc 1
+    jump state_243
+    .mark: state_246
+    iinc 1
+    jump state_248
+    .mark: state_247
+    iinc 1
+    jump state_245
+    .mark: state_248
+    iinc 1
+    jump state_250
+    .mark: state_249
+    iinc 1
+    jump state_247
+    .mark: state_250
+    iinc 1
+    jump state_252
+    .mark: state_251
+    iinc 1
+    jump state_249
+    .mark: state_252
+    iinc 1
+    jump state_254
+    .mark: state_253
+    iinc 1
+    jump state_251
+    .mark: state_254
+    iinc 1
+    jump state_256
+    .mark: state_255
+    iinc 1
+    jump state_253
+    .mark: state_256
+    iinc 1
+    jump state_258
+    .mark: state_257
+    iinc 1
+    jump state_255
+    .mark: state_258
+    iinc 1
+    jump state_260
+    .mark: state_259
+    iinc 1
+    jump state_257
+    .mark: state_260
+    iinc 1
+    jump state_262
+    .mark: state_261
+    iinc 1
+    jump state_259
+    .mark: state_262
+    iinc 1
+    jump state_264
+    .mark: state_263
+    iinc 1
+    jump state_261
+    .mark: state_264
+    iinc 1
+    jump state_266
+    .mark: state_265
+    iinc 1
+    jump state_263
+    .mark: state_266
+    iinc 1
+    jump state_268
+    .mark: state_267
+    iinc 1
+    jump state_265
+    .mark: state_268
+    iinc 1
+    jump state_270
+    .mark: state_269
+    iinc 1
+    jump state_267
+    .mark: state_270
+    iinc 1
+    jump state_272
+    .mark: state_271
+    iinc 1
+    jump state_269
+    .mark: state_272
+    iinc 1
+    jump state_274
+    .mark: state_273
+    iinc 1
+    jump state_271
+    .mark: state_274
+    iinc 1
+    jump state_276
+    .mark: state_275
+    iinc 1
+    jump state_273
+    .mark: state_276
+    iinc 1
+    jump state_278
+    .mark: state_277
+    iinc 1
+    jump state_275
+    .mark: state_278
+    iinc 1
+    jump state_280
+    .mark: state_279
+    iinc 1
+    jump state_277
+    .mark: state_280
+    iinc 1
+    jump state_282
+    .mark: state_281
+    iinc 1
+    jump state_279
+    .mark: state_282
+    iinc 1
+    jump state_284
+    .mark: state_283
+    iinc 1
+    jump state_281
+    .mark: state_284
+    iinc 1
+    jump state_286
+    .mark: state_285
+    iinc 1
+    jump state_283
+    .mark: state_286
+    iinc 1
+    jump state_288
+    .mark: state_287
+    iinc 1
+    jump state_285
+    .mark: state_288
+    iinc 1
+    jump state_290
+    .mark: state_289
+    iinc 1
+    jump state_287
+    .mark: state_290
+    iinc 1
+    jump state_292
+    .mark: state_291
+    iinc 1
+    jump state_289
+    .mark: state_292
+    iinc 1
+    jump state_294
+    .mark: state_293
+    iinc 1
+    jump state_291
+    .mark: state_294
+    iinc 1
+    jump state_296
+    .mark: state_295
+    iinc 1
+    jump state_293
+    .mark: state_296
+    iinc 1
+    jump state_298
+    .mark: state_297
+    iinc 1
+    jump state_295
+    .mark: state_298
+    iinc 1
+    jump state_300
+    .mark: state_299
+    iinc 1
+    jump state_297
+    .mark: state_300
+    iinc 1
+    jump state_302
+    .mark: state_301
+    iinc 1
+    jump state_299
+    .mark: state_302
+    iinc 1
+    jump state_304
+    .mark: state_303
+    iinc 1
+    jump state_301
+    .mark: state_304
+    iinc 1
+    jump state_306
+    .mark: state_305
+    iinc 1
+    jump state_303
+    .mark: state_306
+    iinc 1
+    jump state_308
+    .mark: state_307
+    iinc 1
+    jump state_305
+    .mark: state_308
+    iinc 1
+    jump state_310
+    .mark: state_309
+    iinc 1
+    jump state_307
+    .mark: state_310
+    iinc 1
+    jump state_312
+    .mark: state_311
+    iinc 1
+    jump state_309
+    .mark: state_312
+    iinc 1
+    jump state_314
+    .mark: state_313
+    iinc 1
+    jump state_311
+    .mark: state_314
+    iinc 1
+    jump state_316
+    .mark: state_315
+    iinc 1
+    jump state_313
+    .mark: state_316
+    iinc 1
+    jump state_318
+    .mark: state_317
+    iinc 1
+    jump state_315
+    .mark: state_318
+    iinc 1
+    jump state_320
+    .mark: state_319
+    iinc 1
+    jump state_317
+    .mark: state_320
+    iinc 1
+    jump state_322
+    .mark: state_321
+    iinc 1
+    jump state_319
+    .mark: state_322
+    iinc 1
+    jump state_324
+    .mark: state_323
+    iinc 1
+    jump state_321
+    .mark: state_324
+    iinc 1
+    jump state_326
+    .mark: state_325
+    iinc 1
+    jump state_323
+    .mark: state_326
+    iinc 1
+    jump state_328
+    .mark: state_327
+    iinc 1
+    jump state_325
+    .mark: state_328
+    iinc 1
+    jump state_330
+    .mark: state_329
+    iinc 1
+    jump state_327
+    .mark: state_330
+    iinc 1
+    jump state_332
+    .mark: state_331
+    iinc 1
+    jump state_329
+    .mark: state_332
+    iinc 1
+    jump state_334
+    .mark: state_333
+    iinc 1
+    jump state_331
+    .mark: state_334
+    iinc 1
+    jump state_336
+    .mark: state_335
+    iinc 1
+    jump state_333
+    .mark: state_336
+    iinc 1
+    jump state_338
+    .mark: state_337
+    iinc 1
+    jump state_335
+    .mark: state_338
+    iinc 1
+    jump state_340
+    .mark: state_339
+    iinc 1
+    jump state_337
+    .mark: state_340
+    iinc 1
+    jump state_342
+    .mark: state_341
+    iinc 1
+    jump state_339
+    .mark: state_342
+    iinc 1
+    jump state_344
+    .mark: state_343
+    iinc 1
+    jump state_341
+    .mark: state_344
+    iinc 1
+    jump state_346
+    .mark: state_345
+    iinc 1
+    jump state_343
+    .mark: state_346
+    iinc 1
+    jump state_348
+    .mark: state_347
+    iinc 1
+    jump state_345
+    .mark: state_348
+    iinc 1
+    jump state_350
+    .mark: state_349
+    iinc 1
+    jump state_347
+    .mark: state_350
+    iinc 1
+    jump state_352
+    .mark: state_351
+    iinc 1
+    jump state_349
+    .mark: state_352
+    iinc 1
+    jump state_354
+    .mark: state_353
+    iinc 1
+    jump state_351
+    .mark: state_354
+    iinc 1
+    jump state_356
+    .mark: state_355
+    iinc 1
+    jump state_353
+    .mark: state_356
+    iinc 1
+    jump state_358
+    .mark: state_357
+    iinc 1
+    jump state_355
+    .mark: state_358
+    iinc 1
+    jump state_360
+    .mark: state_359
+    iinc 1
+    jump state_357
+    .mark: state_360
+    iinc 1
+    jump state_362
+    .mark: state_361
+    iinc 1
+    jump state_359
+    .mark: state_362
+    iinc 1
+    jump state_364
+    .mark: state_363
+    iinc 1
+    jump state_361
+    .mark: state_364
+    iinc 1
+    jump state_366
+    .mark: state_365
+    iinc 1
+    jump state_363
+    .mark: state_366
+    iinc 1
+    jump state_368
+    .mark: state_367
+    iinc 1
+    jump state_365
+    .mark: state_368
+    iinc 1
+    jump state_370
+    .mark: state_369
+    iinc 1
+    jump state_367
+    .mark: state_370
+    iinc 1
+    jump state_372
+    .mark: state_371
+    iinc 1
+    jump state_369
+    .mark: state_372
+    iinc 1
+    jump state_374
+    .mark: state_373
+    iinc 1
+    jump state_371
+    .mark: state_374
+    iinc 1
+    jump state_376
+    .mark: state_375
+    iinc 1
+    jump state_373
+    .mark: state_376
+    iinc 1
+    jump state_378
+    .mark: state_377
+    iinc 1
+    jump state_375
+    .mark: state_378
+    iinc 1
+    jump state_380
+    .mark: state_379
+    iinc 1
+    jump state_377
+    .mark: state_380
+    iinc 1
+    jump state_382
+    .mark: state_381
+    iinc 1
+    jump state_379
+    .mark: state_382
+    iinc 1
+    jump state_384
+    .mark: state_383
+    iinc 1
+    jump state_381
+    .mark: state_384
+    iinc 1
+    jump state_386
+    .mark: state_385
+    iinc 1
+    jump state_383
+    .mark: state_386
+    iinc 1
+    jump state_388
+    .mark: state_387
+    iinc 1
+    jump state_385
+    .mark: state_388
+    iinc 1
+    jump state_390
+    .mark: state_389
+    iinc 1
+    jump state_387
+    .mark: state_390
+    iinc 1
+    jump state_392
+    .mark: state_391
+    iinc 1
+    jump state_389
+    .mark: state_392
+    iinc 1
+    jump state_394
+    .mark: state_393
+    iinc 1
+    jump state_391
+    .mark: state_394
+    iinc 1
+    jump state_396
+    .mark: state_395
+    iinc 1
+    jump state_393
+    .mark: state_396
+    iinc 1
+    jump state_398
+    .mark: state_397
+    iinc 1
+    jump state_395
+    .mark: state_398
+    iinc 1
+    jump state_400
+    .mark: state_399
+    iinc 1
+    jump state_397
+    .mark: state_400
+    iinc 1
+    jump state_402
+    .mark: state_401
+    iinc 1
+    jump state_399
+    .mark: state_402
+    iinc 1
+    jump state_404
+    .mark: state_403
+    iinc 1
+    jump state_401
+    .mark: state_404
+    iinc 1
+    jump state_406
+    .mark: state_405
+    iinc 1
+    jump state_403
+    .mark: state_406
+    iinc 1
+    jump state_408
+    .mark: state_407
+    iinc 1
+    jump state_405
+    .mark: state_408
+    iinc 1
+    jump state_410
+    .mark: state_409
+    iinc 1
+    jump state_407
+    .mark: state_410
+    iinc 1
+    jump state_412
+    .mark: state_411
+    iinc 1
+    jump state_409
+    .mark: state_412
+    iinc 1
+    jump state_414
+    .mark: state_413
+    iinc 1
+    jump state_411
+    .mark: state_414
+    iinc 1
+    jump state_416
+    .mark: state_415
+    iinc 1
+    jump state_413
+    .mark: state_416
+    iinc 1
+    jump state_418
+    .mark: state_417
+    iinc 1
+    jump state_415
+    .mark: state_418
+    iinc 1
+    jump state_420
+    .mark: state_419
+    iinc 1
+    jump state_417
+    .mark: state_420
+    iinc 1
+    jump state_422
+    .mark: state_421
+    iinc 1
+    jump state_419
+    .mark: state_422
+    iinc 1
+    jump state_424
+    .mark: state_423
+    iinc 1
+    jump state_421
+    .mark: state_424
+    iinc 1
+    jump state_426
+    .mark: state_425
+    iinc 1
+    jump state_423
+    .mark: state_426
+    iinc 1
+    jump state_428
+    .mark: state_427
+    iinc 1
+    jump state_425
+    .mark: state_428
+    iinc 1
+    jump state_430
+    .mark: state_429
+    iinc 1
+    jump state_427
+    .mark: state_430
+    iinc 1
+    jump state_432
+    .mark: state_431
+    iinc 1
+    jump state_429
+    .mark: state_432
+    iinc 1
+    jump state_434
+    .mark: state_433
+    iinc 1
+    jump state_431
+    .mark: state_434
+    iinc 1
+    jump state_436
+    .mark: state_435
+    iinc 1
+    jump state_433
+    .mark: state_436
+    iinc 1
+    jump state_438
+    .mark: state_437
+    iinc 1
+    jump state_435
+    .mark: state_438
+    iinc 1
+    jump state_440
+    .mark: state_439
+    iinc 1
+    jump state_437
+    .mark: state_440
+    iinc 1
+    jump state_442
+    .mark: state_441
+    iinc 1
+    jump state_439
+    .mark: state_442
+    iinc 1
+    jump state_444
+    .mark: state_443
+    iinc 1
+    jump state_441
+    .mark: state_444
+    iinc 1
+    jump state_446
+    .mark: state_445
+    iinc 1
+    jump state_443
+    .mark: state_446
+    iinc 1
+    jump state_448
+    .mark: state_447
+    iinc 1
+    jump state_445
+    .mark: state_448
+    iinc 1
+    jump state_450
+    .mark: state_449
+    iinc 1
+    jump state_447
+    .mark: state_450
+    iinc 1
+    jump state_452
+    .mark: state_451
+    iinc 1
+    jump state_449
+    .mark: state_452
+    iinc 1
+    jump state_454
+    .mark: state_453
+    iinc 1
+    jump state_451
+    .mark: state_454
+    iinc 1
+    jump state_456
+    .mark: state_455
+    iinc 1
+    jump state_453
+    .mark: state_456
+    iinc 1
+    jump state_458
+    .mark: state_457
+    iinc 1
+    jump state_455
+    .mark: state_458
+    iinc 1
+    jump state_460
+    .mark: state_459
+    iinc 1
+    jump state_457
+    .mark: state_460
+    iinc 1
+    jump state_462
+    .mark: state_461
+    iinc 1
+    jump state_459
+    .mark: state_462
+    iinc 1
+    jump state_464
+    .mark: state_463
+    iinc 1
+    jump state_461
+    .mark: state_464
+    iinc 1
+    jump state_466
+    .mark: state_465
+    iinc 1
+    jump state_463
+    .mark: state_466
+    iinc 1
+    jump state_468
+    .mark: state_467
+    iinc 1
+    jump state_465
+    .mark: state_468
+    iinc 1
+    jump state_470
+    .mark: state_469
+    iinc 1
+    jump state_467
+    .mark: state_470
+    iinc 1
+    jump state_472
+    .mark: state_471
+    iinc 1
+    jump state_469
+    .mark: state_472
+    iinc 1
+    jump state_474
+    .mark: state_473
+    iinc 1
+    jump state_471
+    .mark: state_474
+    iinc 1
+    jump state_476
+    .mark: state_475
+    iinc 1
+    jump state_473
+    .mark: state_476
+    iinc 1
+    jump state_478
+    .mark: state_477
+    iinc 1
+    jump state_475
+    .mark: state_478
+    iinc 1
+    jump state_480
+    .mark: state_479
+    iinc 1
+    jump state_477
+    .mark: state_480
+    iinc 1
+    jump state_482
+    .mark: state_481
+    iinc 1
+    jump state_479
+    .mark: state_482
+    iinc 1
+    jump state_484
+    .mark: state_483
+    iinc 1
+    jump state_481
+    .mark: state_484
+    iinc 1
+    jump state_486
+    .mark: state_485
+    iinc 1
+    jump state_483
+    .mark: state_486
+    iinc 1
+    jump state_488
+    .mark: state_487
+    iinc 1
+    jump state_485
+    .mark: state_488
+    iinc 1
+    jump state_490
+    .mark: state_489
+    iinc 1
+    jump state_487
+    .mark: state_490
+    iinc 1
+    jump state_492
+    .mark: state_491
+    iinc 1
+    jump state_489
+    .mark: state_492
+    iinc 1
+    jump state_494
+    .mark: state_493
+    iinc 1
+    jump state_491
+    .mark: state_494
+    iinc 1
+    jump state_496
+    .mark: state_495
+    iinc 1
+    jump state_493
+    .mark: state_496
+    iinc 1
+    jump state_498
+    .mark: state_497
+    iinc 1
+    jump state_495
+    .mark: state_498
+    iinc 1
+    jump state_500
+    .mark: state_499
+    iinc 1
+    jump state_497
+    .mark: state_500
+    iinc 1
+    jump state_502
+    .mark: state_501
+    iinc 1
+    jump state_499
+    .mark: state_502
+    iinc 1
+    jump state_504
+    .mark: state_503
+    iinc 1
+    jump state_501
+    .mark: state_504
+    iinc 1
+    jump state_506
+    .mark: state_505
+    iinc 1
+    jump state_503
+    .mark: state_506
+    iinc 1
+    jump state_508
+    .mark: state_507
+    iinc 1
+    jump state_505
+    .mark: state_508
+    iinc 1
+    jump state_510
+    .mark: state_509
+    iinc 1
+    jump state_507
+    .mark: state_510
+    iinc 1
+    jump state_512
+    .mark: state_511
+    iinc 1
+    jump state_509
+    .mark: state_512
+    iinc 1
+    jump state_514
+    .mark: state_513
+    iinc 1
+    jump state_511
+    .mark: state_514
+    iinc 1
+    jump state_516
+    .mark: state_515
+    iinc 1
+    jump state_513
+    .mark: state_516
+    iinc 1
+    jump state_518
+    .mark: state_517
+    iinc 1
+    jump state_515
+    .mark: state_518
+    iinc 1
+    jump state_520
+    .mark: state_519
+    iinc 1
+    jump state_517
+    .mark: state_520
+    iinc 1
+    jump state_522
+    .mark: state_521
+    iinc 1
+    jump state_519
+    .mark: state_522
+    iinc 1
+    jump state_524
+    .mark: state_523
+    iinc 1
+    jump state_521
+    .mark: state_524
+    iinc 1
+    jump state_526
+    .mark: state_525
+    iinc 1
+    jump state_523
+    .mark: state_526
+    iinc 1
+    jump state_528
+    .mark: state_527
+    iinc 1
+    jump state_525
+    .mark: state_528
+    iinc 1
+    jump state_530
+    .mark: state_529
+    iinc 1
+    jump state_527
+    .mark: state_530
+    iinc 1
+    jump state_532
+    .mark: state_531
+    iinc 1
+    jump state_529
+    .mark: state_532
+    iinc 1
+    jump state_534
+    .mark: state_533
+    iinc 1
+    jump state_531
+    .mark: state_534
+    iinc 1
+    jump state_536
+    .mark: state_535
+    iinc 1
+    jump state_533
+    .mark: state_536
+    iinc 1
+    jump state_538
+    .mark: state_537
+    iinc 1
+    jump state_535
+    .mark: state_538
+    iinc 1
+    jump state_540
+    .mark: state_539
+    iinc 1
+    jump state_537
+    .mark: state_540
+    iinc 1
+    jump state_542
+    .mark: state_541
+    iinc 1
+    jump state_539
+    .mark: state_542
+    iinc 1
+    jump state_544
+    .mark: state_543
+    iinc 1
+    jump state_541
+    .mark: state_544
+    iinc 1
+    jump state_546
+    .mark: state_545
+    iinc 1
+    jump state_543
+    .mark: state_546
+    iinc 1
+    jump state_548
+    .mark: state_547
+    iinc 1
+    jump state_545
+    .mark: state_548
+    iinc 1
+    jump state_550
+    .mark: state_549
+    iinc 1
+    jump state_547
+    .mark: state_550
+    iinc 1
+    jump state_552
+    .mark: state_551
+    iinc 1
+    jump state_549
+    .mark: state_552
+    iinc 1
+    jump state_554
+    .mark: state_553
+    iinc 1
+    jump state_551
+    .mark: state_554
+    iinc 1
+    jump state_556
+    .mark: state_555
+    iinc 1
+    jump state_553
+    .mark: state_556
+    iinc 1
+    jump state_558
+    .mark: state_557
+    iinc 1
+    jump state_555
+    .mark: state_558
+    iinc 1
+    jump state_560
+    .mark: state_559
+    iinc 1
+    jump state_557
+    .mark: state_560
+    iinc 1
+    jump state_562
+    .mark: state_561
+    iinc 1
+    jump state_559
+    .mark: state_562
+    iinc 1
+    jump state_564
+    .mark: state_563
+    iinc 1
+    jump state_561
+    .mark: state_564
+    iinc 1
+    jump state_566
+    .mark: state_565
+    iinc 1
+    jump state_563
+    .mark: state_566
+    iinc 1
+    jump state_568
+    .mark: state_567
+    iinc 1
+    jump state_565
+    .mark: state_568
+    iinc 1
+    jump state_570
+    .mark: state_569
+    iinc 1
+    jump state_567
+    .mark: state_570
+    iinc 1
+    jump state_572
+    .mark: state_571
+    iinc 1
+    jump state_569
+    .mark: state_572
+    iinc 1
+    jump state_574
+    .mark: state_573
+    iinc 1
+    jump state_571
+    .mark: state_574
+    iinc 1
+    jump state_576
+    .mark: state_575
+    iinc 1
+    jump state_573
+    .mark: state_576
+    iinc 1
+    jump state_578
+    .mark: state_577
+    iinc 1
+    jump state_575
+    .mark: state_578
+    iinc 1
+    jump state_580
+    .mark: state_579
+    iinc 1
+    jump state_577
+    .mark: state_580
+    iinc 1
+    jump state_582
+    .mark: state_581
+    iinc 1
+    jump state_579
+    .mark: state_582
+    iinc 1
+    jump state_584
+    .mark: state_583
+    iinc 1
+    jump state_581
+    .mark: state_584
+    iinc 1
+    jump state_586
+    .mark: state_585
+    iinc 1
+    jump state_583
+    .mark: state_586
+    iinc 1
+    jump state_588
+    .mark: state_587
+    iinc 1
+    jump state_585
+    .mark: state_588
+    iinc 1
+    jump state_590
+    .mark: state_589
+    iinc 1
+    jump state_587
+    .mark: state_590
+    iinc 1
+    jump state_592
+    .mark: state_591
+    iinc 1
+    jump state_589
+    .mark: state_592
+    iinc 1
+    jump state_594
+    .mark: state_593
+    iinc 1
+    jump state_591
+    .mark: state_594
+    iinc 1
+    jump state_596
+    .mark: state_595
+    iinc 1
+    jump state_593
+    .mark: state_596
+    iinc 1
+    jump state_598
+    .mark: state_597
+    iinc 1
+    jump state_595
+    .mark: state_598
+    iinc 1
+    jump state_600
+    .mark: state_599
+    iinc 1
+    jump state_597
+    .mark: state_600
+    iinc 1
+    jump state_602
+    .mark: state_601
+    iinc 1
+    jump state_599
+    .mark: state_602
+    iinc 1
+    jump state_604
+    .mark: state_603
+    iinc 1
+    jump state_601
+    .mark: state_604
+    iinc 1
+    jump state_606
+    .mark: state_605
+    iinc 1
+    jump state_603
+    .mark: state_606
+    iinc 1
+    jump state_608
+    .mark: state_607
+    iinc 1
+    jump state_605
+    .mark: state_608
+    iinc 1
+    jump state_610
+    .mark: state_609
+    iinc 1
+    jump state_607
+    .mark: state_610
+    iinc 1
+    jump state_612
+    .mark: state_611
+    iinc 1
+    jump state_609
+    .mark: state_612
+    iinc 1
+    jump state_614
+    .mark: state_613
+    iinc 1
+    jump state_611
+    .mark: state_614
+    iinc 1
+    jump state_616
+    .mark: state_615
+    iinc 1
+    jump state_613
+    .mark: state_616
+    iinc 1
+    jump state_618
+    .mark: state_617
+    iinc 1
+    jump state_615
+    .mark: state_618
+    iinc 1
+    jump state_620
+    .mark: state_619
+    iinc 1
+    jump state_617
+    .mark: state_620
+    iinc 1
+    jump state_622
+    .mark: state_621
+    iinc 1
+    jump state_619
+    .mark: state_622
+    iinc 1
+    jump state_624
+    .mark: state_623
+    iinc 1
+    jump state_621
+    .mark: state_624
+    iinc 1
+    jump state_626
+    .mark: state_625
+    iinc 1
+    jump state_623
+    .mark: state_626
+    iinc 1
+    jump state_628
+    .mark: state_627
+    iinc 1
+    jump state_625
+    .mark: state_628
+    iinc 1
+    jump state_630
+    .mark: state_629
+    iinc 1
+    jump state_627
+    .mark: state_630
+    iinc 1
+    jump state_632
+    .mark: state_631
+    iinc 1
+    jump state_629
+    .mark: state_632
+    iinc 1
+    jump state_634
+    .mark: state_633
+    iinc 1
+    jump state_631
+    .mark: state_634
+    iinc 1
+    jump state_636
+    .mark: state_635
+    iinc 1
+    jump state_633
+    .mark: state_636
+    iinc 1
+    jump state_638
+    .mark: state_637
+    iinc 1
+    jump state_635
+    .mark: state_638
+    iinc 1
+    jump state_640
+    .mark: state_639
+    iinc 1
+    jump state_637
+    .mark: state_640
+    iinc 1
+    jump state_642
+    .mark: state_641
+    iinc 1
+    jump state_639
+    .mark: state_642
+    iinc 1
+    jump state_644
+    .mark: state_643
+    iinc 1
+    jump state_641
+    .mark: state_644
+    iinc 1
+    jump state_646
+    .mark: state_645
+    iinc 1
+    jump state_643
+    .mark: state_646
+    iinc 1
+    jump state_648
+    .mark: state_647
+    iinc 1
+    jump state_645
+    .mark: state_648
+    iinc 1
+    jump state_650
+    .mark: state_649
+    iinc 1
+    jump state_647
+    .mark: state_650
+    iinc 1
+    jump state_652
+    .mark: state_651
+    iinc 1
+    jump state_649
+    .mark: state_652
+    iinc 1
+    jump state_654
+    .mark: state_653
+    iinc 1
+    jump state_651
+    .mark: state_654
+    iinc 1
+    jump state_656
+    .mark: state_655
+    iinc 1
+    jump state_653
+    .mark: state_656
+    iinc 1
+    jump state_658
+    .mark: state_657
+    iinc 1
+    jump state_655
+    .mark: state_658
+    iinc 1
+    jump state_660
+    .mark: state_659
+    iinc 1
+    jump state_657
+    .mark: state_660
+    iinc 1
+    jump state_662
+    .mark: state_661
+    iinc 1
+    jump state_659
+    .mark: state_662
+    iinc 1
+    jump state_664
+    .mark: state_663
+    iinc 1
+    jump state_661
+    .mark: state_664
+    iinc 1
+    jump state_666
+    .mark: state_665
+    iinc 1
+    jump state_663
+    .mark: state_666
+    iinc 1
+    jump state_668
+    .mark: state_667
+    iinc 1
+    jump state_665
+    .mark: state_668
+    iinc 1
+    jump state_670
+    .mark: state_669
+    iinc 1
+    jump state_667
+    .mark: state_670
+    iinc 1
+    jump state_672
+    .mark: state_671
+    iinc 1
+    jump state_669
+    .mark: state_672
+    iinc 1
+    jump state_674
+    .mark: state_673
+    iinc 1
+    jump state_671
+    .mark: state_674
+    iinc 1
+    jump state_676
+    .mark: state_675
+    iinc 1
+    jump state_673
+    .mark: state_676
+    iinc 1
+    jump state_678
+    .mark: state_677
+    iinc 1
+    jump state_675
+    .mark: state_678
+    iinc 1
+    jump state_680
+    .mark: state_679
+    iinc 1
+    jump state_677
+    .mark: state_680
+    iinc 1
+    jump state_682
+    .mark: state_681
+    iinc 1
+    jump state_679
+    .mark: state_682
+    iinc 1
+    jump state_684
+    .mark: state_683
+    iinc 1
+    jump state_681
+    .mark: state_684
+    iinc 1
+    jump state_686
+    .mark: state_685
+    iinc 1
+    jump state_683
+    .mark: state_686
+    iinc 1
+    jump state_688
+    .mark: state_687
+    iinc 1
+    jump state_685
+    .mark: state_688
+    iinc 1
+    jump state_690
+    .mark: state_689
+    iinc 1
+    jump state_687
+    .mark: state_690
+    iinc 1
+    jump state_692
+    .mark: state_691
+    iinc 1
+    jump state_689
+    .mark: state_692
+    iinc 1
+    jump state_694
+    .mark: state_693
+    iinc 1
+    jump state_691
+    .mark: state_694
+    iinc 1
+    jump state_696
+    .mark: state_695
+    iinc 1
+    jump state_693
+    .mark: state_696
+    iinc 1
+    jump state_698
+    .mark: state_697
+    iinc 1
+    jump state_695
+    .mark: state_698
+    iinc 1
+    jump state_700
+    .mark: state_699
+    iinc 1
+    jump state_697
+    .mark: state_700
+    iinc 1
+    jump state_702
+    .mark: state_701
+    iinc 1
+    jump state_699
+    .mark: state_702
+    iinc 1
+    jump state_704
+    .mark: state_703
+    iinc 1
+    jump state_701
+    .mark: state_704
+    iinc 1
+    jump state_706
+    .mark: state_705
+    iinc 1
+    jump state_703
+    .mark: state_706
+    iinc 1
+    jump state_708
+    .mark: state_707
+    iinc 1
+    jump state_705
+    .mark: state_708
+    iinc 1
+    jump state_710
+    .mark: state_709
+    iinc 1
+    jump state_707
+    .mark: state_710
+    iinc 1
+    jump state_712
+    .mark: state_711
+    iinc 1
+    jump state_709
+    .mark: state_712
+    iinc 1
+    jump state_714
+    .mark: state_713
+    iinc 1
+    jump state_711
+    .mark: state_714
+    iinc 1
+    jump state_716
+    .mark: state_715
+    iinc 1
+    jump state_713
+    .mark: state_716
+    iinc 1
+    jump state_718
+    .mark: state_717
+    iinc 1
+    jump state_715
+    .mark: state_718
+    iinc 1
+    jump state_720
+    .mark: state_719
+    iinc 1
+    jump state_717
+    .mark: state_720
+    iinc 1
+    jump state_722
+    .mark: state_721
+    iinc 1
+    jump state_719
+    .mark: state_722
+    iinc 1
+    jump state_724
+    .mark: state_723
+    iinc 1
+    jump state_721
+    .mark: state_724
+    iinc 1
+    jump state_726
+    .mark: state_725
+    iinc 1
+    jump state_723
+    .mark: state_726
+    iinc 1
+    jump state_728
+    .mark: state_727
+    iinc 1
+    jump state_725
+    .mark: state_728
+    iinc 1
+    jump state_730
+    .mark: state_729
+    iinc 1
+    jump state_727
+    .mark: state_730
+    iinc 1
+    jump state_732
+    .mark: state_731
+    iinc 1
+    jump state_729
+    .mark: state_732
+    iinc 1
+    jump state_734
+    .mark: state_733
+    iinc 1
+    jump state_731
+    .mark: state_734
+    iinc 1
+    jump state_736
+    .mark: state_735
+    iinc 1
+    jump state_733
+    .mark: state_736
+    iinc 1
+    jump state_738
+    .mark: state_737
+    iinc 1
+    jump state_735
+    .mark: state_738
+    iinc 1
+    jump state_740
+    .mark: state_739
+    iinc 1
+    jump state_737
+    .mark: state_740
+    iinc 1
+    jump state_742
+    .mark: state_741
+    iinc 1
+    jump state_739
+    .mark: state_742
+    iinc 1
+    jump state_744
+    .mark: state_743
+    iinc 1
+    jump state_741
+    .mark: state_744
+    iinc 1
+    jump state_746
+    .mark: state_745
+    iinc 1
+    jump state_743
+    .mark: state_746
+    iinc 1
+    jump state_748
+    .mark: state_747
+    iinc 1
+    jump state_745
+    .mark: state_748
+    iinc 1
+    jump state_750
+    .mark: state_749
+    iinc 1
+    jump state_747
+    .mark: state_750
+    iinc 1
+    jump state_752
+    .mark: state_751
+    iinc 1
+    jump state_749
+    .mark: state_752
+    iinc 1
+    jump state_754
+    .mark: state_753
+    iinc 1
+    jump state_751
+    .mark: state_754
+    iinc 1
+    jump state_756
+    .mark: state_755
+    iinc 1
+    jump state_753
+    .mark: state_756
+    iinc 1
+    jump state_758
+    .mark: state_757
+    iinc 1
+    jump state_755
+    .mark: state_758
+    iinc 1
+    jump state_760
+    .mark: state_759
+    iinc 1
+    jump state_757
+    .mark: state_760
+    iinc 1
+    jump state_762
+    .mark: state_761
+    iinc 1
+    jump state_759
+    .mark: state_762
+    iinc 1
+    jump state_764
+    .mark: state_763
+    iinc 1
+    jump state_761
+    .mark: state_764
+    iinc 1
+    jump state_766
+    .mark: state_765
+    iinc 1
+    jump state_763
+    .mark: state_766
+    iinc 1
+    jump state_768
+    .mark: state_767
+    iinc 1
+    jump state_765
+    .mark: state_768
+    iinc 1
+    jump state_770
+    .mark: state_769
+    iinc 1
+    jump state_767
+    .mark: state_770
+    iinc 1
+    jump state_772
+    .mark: state_771
+    iinc 1
+    jump state_769
+    .mark: state_772
+    iinc 1
+    jump state_774
+    .mark: state_773
+    iinc 1
+    jump state_771
+    .mark: state_774
+    iinc 1
+    jump state_776
+    .mark: state_775
+    iinc 1
+    jump state_773
+    .mark: state_776
+    iinc 1
+    jump state_778
+    .mark: state_777
+    iinc 1
+    jump state_775
+    .mark: state_778
+    iinc 1
+    jump state_780
+    .mark: state_779
+    iinc 1
+    jump state_777
+    .mark: state_780
+    iinc 1
+    jump state_782
+    .mark: state_781
+    iinc 1
+    jump state_779
+    .mark: state_782
+    iinc 1
+    jump state_784
+    .mark: state_783
+    iinc 1
+    jump state_781
+    .mark: state_784
+    iinc 1
+    jump state_786
+    .mark: state_785
+    iinc 1
+    jump state_783
+    .mark: state_786
+    iinc 1
+    jump state_788
+    .mark: state_787
+    iinc 1
+    jump state_785
+    .mark: state_788
+    iinc 1
+    jump state_790
+    .mark: state_789
+    iinc 1
+    jump state_787
+    .mark: state_790
+    iinc 1
+    jump state_792
+    .mark: state_791
+    iinc 1
+    jump state_789
+    .mark: state_792
+    iinc 1
+    jump state_794
+    .mark: state_793
+    iinc 1
+    jump state_791
+    .mark: state_794
+    iinc 1
+    jump state_796
+    .mark: state_795
+    iinc 1
+    jump state_793
+    .mark: state_796
+    iinc 1
+    jump state_798
+    .mark: state_797
+    iinc 1
+    jump state_795
+    .mark: state_798
+    iinc 1
+    jump state_800
+    .mark: state_799
+    iinc 1
+    jump state_797
+    .mark: state_800
+    iinc 1
+    jump state_802
+    .mark: state_801
+    iinc 1
+    jump state_799
+    .mark: state_802
+    iinc 1
+    jump state_804
+    .mark: state_803
+    iinc 1
+    jump state_801
+    .mark: state_804
+    iinc 1
+    jump state_806
+    .mark: state_805
+    iinc 1
+    jump state_803
+    .mark: state_806
+    iinc 1
+    jump state_808
+    .mark: state_807
+    iinc 1
+    jump state_805
+    .mark: state_808
+    iinc 1
+    jump state_810
+    .mark: state_809
+    iinc 1
+    jump state_807
+    .mark: state_810
+    iinc 1
+    jump state_812
+    .mark: state_811
+    iinc 1
+    jump state_809
+    .mark: state_812
+    iinc 1
+    jump state_814
+    .mark: state_813
+    iinc 1
+    jump state_811
+    .mark: state_814
+    iinc 1
+    jump state_816
+    .mark: state_815
+    iinc 1
+    jump state_813
+    .mark: state_816
+    iinc 1
+    jump state_818
+    .mark: state_817
+    iinc 1
+    jump state_815
+    .mark: state_818
+    iinc 1
+    jump state_820
+    .mark: state_819
+    iinc 1
+    jump state_817
+    .mark: state_820
+    iinc 1
+    jump state_822
+    .mark: state_821
+    iinc 1
+    jump state_819
+    .mark: state_822
+    iinc 1
+    jump state_824
+    .mark: state_823
+    iinc 1
+    jump state_821
+    .mark: state_824
+    iinc 1
+    jump state_826
+    .mark: state_825
+    iinc 1
+    jump state_823
+    .mark: state_826
+    iinc 1
+    jump state_828
+    .mark: state_827
+    iinc 1
+    jump state_825
+    .mark: state_828
+    iinc 1
+    jump state_830
+    .mark: state_829
+    iinc 1
+    jump state_827
+    .mark: state_830
+    iinc 1
+    jump state_832
+    .mark: state_831
+    iinc 1
+    jump state_829
+    .mark: state_832
+    iinc 1
+    jump state_834
+    .mark: state_833
+    iinc 1
+    jump state_831
+    .mark: state_834
+    iinc 1
+    jump state_836
+    .mark: state_835
+    iinc 1
+    jump state_833
+    .mark: state_836
+    iinc 1
+    jump state_838
+    .mark: state_837
+    iinc 1
+    jump state_835
+    .mark: state_838
+    iinc 1
+    jump state_840
+    .mark: state_839
+    iinc 1
+    jump state_837
+    .mark: state_840
+    iinc 1
+    jump state_842
+    .mark: state_841
+    iinc 1
+    jump state_839
+    .mark: state_842
+    iinc 1
+    jump state_844
+    .mark: state_843
+    iinc 1
+    jump state_841
+    .mark: state_844
+    iinc 1
+    jump state_846
+    .mark: state_845
+    iinc 1
+    jump state_843
+    .mark: state_846
+    iinc 1
+    jump state_848
+    .mark: state_847
+    iinc 1
+    jump state_845
+    .mark: state_848
+    iinc 1
+    jump state_850
+    .mark: state_849
+    iinc 1
+    jump state_847
+    .mark: state_850
+    iinc 1
+    jump state_852
+    .mark: state_851
+    iinc 1
+    jump state_849
+    .mark: state_852
+    iinc 1
+    jump state_854
+    .mark: state_853
+    iinc 1
+    jump state_851
+    .mark: state_854
+    iinc 1
+    jump state_856
+    .mark: state_855
+    iinc 1
+    jump state_853
+    .mark: state_856
+    iinc 1
+    jump state_858
+    .mark: state_857
+    iinc 1
+    jump state_855
+    .mark: state_858
+    iinc 1
+    jump state_860
+    .mark: state_859
+    iinc 1
+    jump state_857
+    .mark: state_860
+    iinc 1
+    jump state_862
+    .mark: state_861
+    iinc 1
+    jump state_859
+    .mark: state_862
+    iinc 1
+    jump state_864
+    .mark: state_863
+    iinc 1
+    jump state_861
+    .mark: state_864
+    iinc 1
+    jump state_866
+    .mark: state_865
+    iinc 1
+    jump state_863
+    .mark: state_866
+    iinc 1
+    jump state_868
+    .mark: state_867
+    iinc 1
+    jump state_865
+    .mark: state_868
+    iinc 1
+    jump state_870
+    .mark: state_869
+    iinc 1
+    jump state_867
+    .mark: state_870
+    iinc 1
+    jump state_872
+    .mark: state_871
+    iinc 1
+    jump state_869
+    .mark: state_872
+    iinc 1
+    jump state_874
+    .mark: state_873
+    iinc 1
+    jump state_871
+    .mark: state_874
+    iinc 1
+    jump state_876
+    .mark: state_875
+    iinc 1
+    jump state_873
+    .mark: state_876
+    iinc 1
+    jump state_878
+    .mark: state_877
+    iinc 1
+    jump state_875
+    .mark: state_878
+    iinc 1
+    jump state_880
+    .mark: state_879
+    iinc 1
+    jump state_877
+    .mark: state_880
+    iinc 1
+    jump state_882
+    .mark: state_881
+    iinc 1
+    jump state_879
+    .mark: state_882
+    iinc 1
+    jump state_884
+    .mark: state_883
+    iinc 1
+    jump state_881
+    .mark: state_884
+    iinc 1
+    jump state_886
+    .mark: state_885
+    iinc 1
+    jump state_883
+    .mark: state_886
+    iinc 1
+    jump state_888
+    .mark: state_887
+    iinc 1
+    jump state_885
+    .mark: state_888
+    iinc 1
+    jump state_890
+    .mark: state_889
+    iinc 1
+    jump state_887
+    .mark: state_890
+    iinc 1
+    jump state_892
+    .mark: state_891
+    iinc 1
+    jump state_889
+    .mark: state_892
+    iinc 1
+    jump state_894
+    .mark: state_893
+    iinc 1
+    jump state_891
+    .mark: state_894
+    iinc 1
+    jump state_896
+    .mark: state_895
+    iinc 1
+    jump state_893
+    .mark: state_896
+    iinc 1
+    jump state_898
+    .mark: state_897
+    iinc 1
+    jump state_895
+    .mark: state_898
+    iinc 1
+    jump state_900
+    .mark: state_899
+    iinc 1
+    jump state_897
+    .mark: state_900
+    iinc 1
+    jump state_902
+    .mark: state_901
+    iinc 1
+    jump state_899
+    .mark: state_902
+    iinc 1
+    jump state_904
+    .mark: state_903
+    iinc 1
+    jump state_901
+    .mark: state_904
+    iinc 1
+    jump state_906
+    .mark: state_905
+    iinc 1
+    jump state_903
+    .mark: state_906
+    iinc 1
+    jump state_908
+    .mark: state_907
+    iinc 1
+    jump state_905
+    .mark: state_908
+    iinc 1
+    jump state_910
+    .mark: state_909
+    iinc 1
+    jump state_907
+    .mark: state_910
+    iinc 1
+    jump state_912
+    .mark: state_911
+    iinc 1
+    jump state_909
+    .mark: state_912
+    iinc 1
+    jump state_914
+    .mark: state_913
+    iinc 1
+    jump state_911
+    .mark: state_914
+    iinc 1
+    jump state_916
+    .mark: state_915
+    iinc 1
+    jump state_913
+    .mark: state_916
+    iinc 1
+    jump state_918
+    .mark: state_917
+    iinc 1
+    jump state_915
+    .mark: state_918
+    iinc 1
+    jump state_920
+    .mark: state_919
+    iinc 1
+    jump state_917
+    .mark: state_920
+    iinc 1
+    jump state_922
+    .mark: state_921
+    iinc 1
+    jump state_919
+    .mark: state_922
+    iinc 1
+    jump state_924
+    .mark: state_923
+    iinc 1
+    jump state_921
+    .mark: state_924
+    iinc 1
+    jump state_926
+    .mark: state_925
+    iinc 1
+    jump state_923
+    .mark: state_926
+    iinc 1
+    jump state_928
+    .mark: state_927
+    iinc 1
+    jump state_925
+    .mark: state_928
+    iinc 1
+    jump state_930
+    .mark: state_929
+    iinc 1
+    jump state_927
+    .mark: state_930
+    iinc 1
+    jump state_932
+    .mark: state_931
+    iinc 1
+    jump state_929
+    .mark: state_932
+    iinc 1
+    jump state_934
+    .mark: state_933
+    iinc 1
+    jump state_931
+    .mark: state_934
+    iinc 1
+    jump state_936
+    .mark: state_935
+    iinc 1
+    jump state_933
+    .mark: state_936
+    iinc 1
+    jump state_938
+    .mark: state_937
+    iinc 1
+    jump state_935
+    .mark: state_938
+    iinc 1
+    jump state_940
+    .mark: state_939
+    iinc 1
+    jump state_937
+    .mark: state_940
+    iinc 1
+    jump state_942
+    .mark: state_941
+    iinc 1
+    jump state_939
+    .mark: state_942
+    iinc 1
+    jump state_944
+    .mark: state_943
+    iinc 1
+    jump state_941
+    .mark: state_944
+    iinc 1
+    jump state_946
+    .mark: state_945
+    iinc 1
+    jump state_943
+    .mark: state_946
+    iinc 1
+    jump state_948
+    .mark: state_947
+    iinc 1
+    jump state_945
+    .mark: state_948
+    iinc 1
+    jump state_950
+    .mark: state_949
+    iinc 1
+    jump state_947
+    .mark: state_950
+    iinc 1
+    jump state_952
+    .mark: state_951
+    iinc 1
+    jump state_949
+    .mark: state_952
+    iinc 1
+    jump state_954
+    .mark: state_953
+    iinc 1
+    jump state_951
+    .mark: state_954
+    iinc 1
+    jump state_956
+    .mark: state_955
+    iinc 1
+    jump state_953
+    .mark: state_956
+    iinc 1
+    jump state_958
+    .mark: state_957
+    iinc 1
+    jump state_955
+    .mark: state_958
+    iinc 1
+    jump state_960
+    .mark: state_959
+    iinc 1
+    jump state_957
+    .mark: state_960
+    iinc 1
+    jump state_962
+    .mark: state_961
+    iinc 1
+    jump state_959
+    .mark: state_962
+    iinc 1
+    jump state_964
+    .mark: state_963
+    iinc 1
+    jump state_961
+    .mark: state_964
+    iinc 1
+    jump state_966
+    .mark: state_965
+    iinc 1
+    jump state_963
+    .mark: state_966
+    iinc 1
+    jump state_968
+    .mark: state_967
+    iinc 1
+    jump state_965
+    .mark: state_968
+    iinc 1
+    jump state_970
+    .mark: state_969
+    iinc 1
+    jump state_967
+    .mark: state_970
+    iinc 1
+    jump state_972
+    .mark: state_971
+    iinc 1
+    jump state_969
+    .mark: state_972
+    iinc 1
+    jump state_974
+    .mark: state_973
+    iinc 1
+    jump state_971
+    .mark: state_974
+    iinc 1
+    jump state_976
+    .mark: state_975
+    iinc 1
+    jump state_973
+    .mark: state_976
+    iinc 1
+    jump state_978
+    .mark: state_977
+    iinc 1
+    jump state_975
+    .mark: state_978
+    iinc 1
+    jump state_980
+    .mark: state_979
+    iinc 1
+    jump state_977
+    .mark: state_980
+    iinc 1
+    jump state_982
+    .mark: state_981
+    iinc 1
+    jump state_979
+    .mark: state_982
+    iinc 1
+    jump state_984
+    .mark: state_983
+    iinc 1
+    jump state_981
+    .mark: state_984
+    iinc 1
+    jump state_986
+    .mark: state_985
+    iinc 1
+    jump state_983
+    .mark: state_986
+    iinc 1
+    jump state_988
+    .mark: state_987
+    iinc 1
+    jump state_985
+    .mark: state_988
+    iinc 1
+    jump state_990
+    .mark: state_989
+    iinc 1
+    jump state_987
+    .mark: state_990
+    iinc 1
+    jump state_992
+    .mark: state_991
+    iinc 1
+    jump state_989
+    .mark: state_992
+    iinc 1
+    jump state_994
+    .mark: state_993
+    iinc 1
+    jump state_991
+    .mark: state_994
+    iinc 1
+    jump state_996
+    .mark: state_995
+    iinc 1
+    jump state_993
+    .mark: state_996
+    iinc 1
+    jump state_998
+    .mark: state_997
+    iinc 1
+    jump state_995
+    .mark: state_998
+    iinc 1
+    jump state_1000
+    .mark: state_999
+    iinc 1
+    jump state_997
+    .mark: state_1000
+    iinc 1
+    jump state_1002
+    .mark: state_1001
+    iinc 1
+    jump state_999
+    .mark: state_1002
+    iinc 1
+    jump state_1004
+    .mark: state_1003
+    iinc 1
+    jump state_1001
+    .mark: state_1004
+    iinc 1
+    jump state_1006
+    .mark: state_1005
+    iinc 1
+    jump state_1003
+    .mark: state_1006
+    iinc 1
+    jump state_1008
+    .mark: state_1007
+    iinc 1
+    jump state_1005
+    .mark: state_1008
+    iinc 1
+    jump state_1010
+    .mark: state_1009
+    iinc 1
+    jump state_1007
+    .mark: state_1010
+    iinc 1
+    jump state_1012
+    .mark: state_1011
+    iinc 1
+    jump state_1009
+    .mark: state_1012
+    iinc 1
+    jump state_1014
+    .mark: state_1013
+    iinc 1
+    jump state_1011
+    .mark: state_1014
+    iinc 1
+    jump state_1016
+    .mark: state_1015
+    iinc 1
+    jump state_1013
+    .mark: state_1016
+    iinc 1
+    jump state_1018
+    .mark: state_1017
+    iinc 1
+    jump state_1015
+    .mark: state_1018
+    iinc 1
+    jump state_1020
+    .mark: state_1019
+    iinc 1
+    jump state_1017
+    .mark: state_1020
+    iinc 1
+    jump state_1022
+    .mark: state_1021
+    iinc 1
+    jump state_1019
+    .mark: state_1022
+    iinc 1
+    jump state_1024
+    .mark: state_1023
+    iinc 1
+    jump state_1021
+    .mark: state_1024
+    iinc 1
+    jump state_1026
+    .mark: state_1025
+    iinc 1
+    jump state_1023
+    .mark: state_1026
+    iinc 1
+    jump state_1028
+    .mark: state_1027
+    iinc 1
+    jump state_1025
+    .mark: state_1028
+    iinc 1
+    jump state_1030
+    .mark: state_1029
+    iinc 1
+    jump state_1027
+    .mark: state_1030
+    iinc 1
+    jump state_1032
+    .mark: state_1031
+    iinc 1
+    jump state_1029
+    .mark: state_1032
+    iinc 1
+    jump state_1034
+    .mark: state_1033
+    iinc 1
+    jump state_1031
+    .mark: state_1034
+    iinc 1
+    jump state_1036
+    .mark: state_1035
+    iinc 1
+    jump state_1033
+    .mark: state_1036
+    iinc 1
+    jump state_1038
+    .mark: state_1037
+    iinc 1
+    jump state_1035
+    .mark: state_1038
+    iinc 1
+    jump state_1040
+    .mark: state_1039
+    iinc 1
+    jump state_1037
+    .mark: state_1040
+    iinc 1
+    jump state_1042
+    .mark: state_1041
+    iinc 1
+    jump state_1039
+    .mark: state_1042
+    iinc 1
+    jump state_1044
+    .mark: state_1043
+    iinc 1
+    jump state_1041
+    .mark: state_1044
+    iinc 1
+    jump state_1046
+    .mark: state_1045
+    iinc 1
+    jump state_1043
+    .mark: state_1046
+    iinc 1
+    jump state_1048
+    .mark: state_1047
+    iinc 1
+    jump state_1045
+    .mark: state_1048
+    iinc 1
+    jump state_1050
+    .mark: state_1049
+    iinc 1
+    jump state_1047
+    .mark: state_1050
+    iinc 1
+    jump state_1052
+    .mark: state_1051
+    iinc 1
+    jump state_1049
+    .mark: state_1052
+    iinc 1
+    jump state_1054
+    .mark: state_1053
+    iinc 1
+    jump state_1051
+    .mark: state_1054
+    iinc 1
+    jump state_1056
+    .mark: state_1055
+    iinc 1
+    jump state_1053
+    .mark: state_1056
+    iinc 1
+    jump state_1058
+    .mark: state_1057
+    iinc 1
+    jump state_1055
+    .mark: state_1058
+    iinc 1
+    jump state_1060
+    .mark: state_1059
+    iinc 1
+    jump state_1057
+    .mark: state_1060
+    iinc 1
+    jump state_1062
+    .mark: state_1061
+    iinc 1
+    jump state_1059
+    .mark: state_1062
+    iinc 1
+    jump state_1064
+    .mark: state_1063
+    iinc 1
+    jump state_1061
+    .mark: state_1064
+    iinc 1
+    jump state_1066
+    .mark: state_1065
+    iinc 1
+    jump state_1063
+    .mark: state_1066
+    iinc 1
+    jump state_1068
+    .mark: state_1067
+    iinc 1
+    jump state_1065
+    .mark: state_1068
+    iinc 1
+    jump state_1070
+    .mark: state_1069
+    iinc 1
+    jump state_1067
+    .mark: state_1070
+    iinc 1
+    jump state_1072
+    .mark: state_1071
+    iinc 1
+    jump state_1069
+    .mark: state_1072
+    iinc 1
+    jump state_1074
+    .mark: state_1073
+    iinc 1
+    jump state_1071
+    .mark: state_1074
+    iinc 1
+    jump state_1076
+    .mark: state_1075
+    iinc 1
+    jump state_1073
+    .mark: state_1076
+    iinc 1
+    jump state_1078
+    .mark: state_1077
+    iinc 1
+    jump state_1075
+    .mark: state_1078
+    iinc 1
+    jump state_1080
+    .mark: state_1079
+    iinc 1
+    jump state_1077
+    .mark: state_1080
+    iinc 1
+    jump state_1082
+    .mark: state_1081
+    iinc 1
+    jump state_1079
+    .mark: state_1082
+    iinc 1
+    jump state_1084
+    .mark: state_1083
+    iinc 1
+    jump state_1081
+    .mark: state_1084
+    iinc 1
+    jump state_1086
+    .mark: state_1085
+    iinc 1
+    jump state_1083
+    .mark: state_1086
+    iinc 1
+    jump state_1088
+    .mark: state_1087
+    iinc 1
+    jump state_1085
+    .mark: state_1088
+    iinc 1
+    jump state_1090
+    .mark: state_1089
+    iinc 1
+    jump state_1087
+    .mark: state_1090
+    iinc 1
+    jump state_1092
+    .mark: state_1091
+    iinc 1
+    jump state_1089
+    .mark: state_1092
+    iinc 1
+    jump state_1094
+    .mark: state_1093
+    iinc 1
+    jump state_1091
+    .mark: state_1094
+    iinc 1
+    jump state_1096
+    .mark: state_1095
+    iinc 1
+    jump state_1093
+    .mark: state_1096
+    iinc 1
+    jump state_1098
+    .mark: state_1097
+    iinc 1
+    jump state_1095
+    .mark: state_1098
+    iinc 1
+    jump state_1100
+    .mark: state_1099
+    iinc 1
+    jump state_1097
+    .mark: state_1100
+    iinc 1
+    jump state_1102
+    .mark: state_1101
+    iinc 1
+    jump state_1099
+    .mark: state_1102
+    iinc 1
+    jump state_1104
+    .mark: state_1103
+    iinc 1
+    jump state_1101
+    .mark: state_1104
+    iinc 1
+    jump state_1106
+    .mark: state_1105
+    iinc 1
+    jump state_1103
+    .mark: state_1106
+    iinc 1
+    jump state_1108
+    .mark: state_1107
+    iinc 1
+    jump state_1105
+    .mark: state_1108
+    iinc 1
+    jump state_1110
+    .mark: state_1109
+    iinc 1
+    jump state_1107
+    .mark: state_1110
+    iinc 1
+    jump state_1112
+    .mark: state_1111
+    iinc 1
+    jump state_1109
+    .mark: state_1112
+    iinc 1
+    jump state_1114
+    .mark: state_1113
+    iinc 1
+    jump state_1111
+    .mark: state_1114
+    iinc 1
+    jump state_1116
+    .mark: state_1115
+    iinc 1
+    jump state_1113
+    .mark: state_1116
+    iinc 1
+    jump state_1118
+    .mark: state_1117
+    iinc 1
+    jump state_1115
+    .mark: state_1118
+    iinc 1
+    jump state_1120
+    .mark: state_1119
+    iinc 1
+    jump state_1117
+    .mark: state_1120
+    iinc 1
+    jump state_1122
+    .mark: state_1121
+    iinc 1
+    jump state_1119
+    .mark: state_1122
+    iinc 1
+    jump state_1124
+    .mark: state_1123
+    iinc 1
+    jump state_1121
+    .mark: state_1124
+    iinc 1
+    jump state_1126
+    .mark: state_1125
+    iinc 1
+    jump state_1123
+    .mark: state_1126
+    iinc 1
+    jump state_1128
+    .mark: state_1127
+    iinc 1
+    jump state_1125
+    .mark: state_1128
+    iinc 1
+    jump state_1130
+    .mark: state_1129
+    iinc 1
+    jump state_1127
+    .mark: state_1130
+    iinc 1
+    jump state_1132
+    .mark: state_1131
+    iinc 1
+    jump state_1129
+    .mark: state_1132
+    iinc 1
+    jump state_1134
+    .mark: state_1133
+    iinc 1
+    jump state_1131
+    .mark: state_1134
+    iinc 1
+    jump state_1136
+    .mark: state_1135
+    iinc 1
+    jump state_1133
+    .mark: state_1136
+    iinc 1
+    jump state_1138
+    .mark: state_1137
+    iinc 1
+    jump state_1135
+    .mark: state_1138
+    iinc 1
+    jump state_1140
+    .mark: state_1139
+    iinc 1
+    jump state_1137
+    .mark: state_1140
+    iinc 1
+    jump state_1142
+    .mark: state_1141
+    iinc 1
+    jump state_1139
+    .mark: state_1142
+    iinc 1
+    jump state_1144
+    .mark: state_1143
+    iinc 1
+    jump state_1141
+    .mark: state_1144
+    iinc 1
+    jump state_1146
+    .mark: state_1145
+    iinc 1
+    jump state_1143
+    .mark: state_1146
+    iinc 1
+    jump state_1148
+    .mark: state_1147
+    iinc 1
+    jump state_1145
+    .mark: state_1148
+    iinc 1
+    jump state_1150
+    .mark: state_1149
+    iinc 1
+    jump state_1147
+    .mark: state_1150
+    iinc 1
+    jump state_1152
+    .mark: state_1151
+    iinc 1
+    jump state_1149
+    .mark: state_1152
+    iinc 1
+    jump state_1154
+    .mark: state_1153
+    iinc 1
+    jump state_1151
+    .mark: state_1154
+    iinc 1
+    jump state_1156
+    .mark: state_1155
+    iinc 1
+    jump state_1153
+    .mark: state_1156
+    iinc 1
+    jump state_1158
+    .mark: state_1157
+    iinc 1
+    jump state_1155
+    .mark: state_1158
+    iinc 1
+    jump state_1160
+    .mark: state_1159
+    iinc 1
+    jump state_1157
+    .mark: state_1160
+    iinc 1
+    jump state_1162
+    .mark: state_1161
+    iinc 1
+    jump state_1159
+    .mark: state_1162
+    iinc 1
+    jump state_1164
+    .mark: state_1163
+    iinc 1
+    jump state_1161
+    .mark: state_1164
+    iinc 1
+    jump state_1166
+    .mark: state_1165
+    iinc 1
+    jump state_1163
+    .mark: state_1166
+    iinc 1
+    jump state_1168
+    .mark: state_1167
+    iinc 1
+    jump state_1165
+    .mark: state_1168
+    iinc 1
+    jump state_1170
+    .mark: state_1169
+    iinc 1
+    jump state_1167
+    .mark: state_1170
+    iinc 1
+    jump state_1172
+    .mark: state_1171
+    iinc 1
+    jump state_1169
+    .mark: state_1172
+    iinc 1
+    jump state_1174
+    .mark: state_1173
+    iinc 1
+    jump state_1171
+    .mark: state_1174
+    iinc 1
+    jump state_1176
+    .mark: state_1175
+    iinc 1
+    jump state_1173
+    .mark: state_1176
+    iinc 1
+    jump state_1178
+    .mark: state_1177
+    iinc 1
+    jump state_1175
+    .mark: state_1178
+    iinc 1
+    jump state_1180
+    .mark: state_1179
+    iinc 1
+    jump state_1177
+    .mark: state_1180
+    iinc 1
+    jump state_1182
+    .mark: state_1181
+    iinc 1
+    jump state_1179
+    .mark: state_1182
+    iinc 1
+    jump state_1184
+    .mark: state_1183
+    iinc 1
+    jump state_1181
+    .mark: state_1184
+    iinc 1
+    jump state_1186
+    .mark: state_1185
+    iinc 1
+    jump state_1183
+    .mark: state_1186
+    iinc 1
+    jump state_1188
+    .mark: state_1187
+    iinc 1
+    jump state_1185
+    .mark: state_1188
+    iinc 1
+    jump state_1190
+    .mark: state_1189
+    iinc 1
+    jump state_1187
+    .mark: state_1190
+    iinc 1
+    jump state_1192
+    .mark: state_1191
+    iinc 1
+    jump state_1189
+    .mark: state_1192
+    iinc 1
+    jump state_1194
+    .mark: state_1193
+    iinc 1
+    jump state_1191
+    .mark: state_1194
+    iinc 1
+    jump state_1196
+    .mark: state_1195
+    iinc 1
+    jump state_1193
+    .mark: state_1196
+    iinc 1
+    jump state_1198
+    .mark: state_1197
+    iinc 1
+    jump state_1195
+    .mark: state_1198
+    iinc 1
+    jump state_1200
+    .mark: state_1199
+    iinc 1
+    jump state_1197
+    .mark: state_1200
+    iinc 1
+    jump state_1202
+    .mark: state_1201
+    iinc 1
+    jump state_1199
+    .mark: state_1202
+    iinc 1
+    jump state_1204
+    .mark: state_1203
+    iinc 1
+    jump state_1201
+    .mark: state_1204
+    iinc 1
+    jump state_1206
+    .mark: state_1205
+    iinc 1
+    jump state_1203
+    .mark: state_1206
+    iinc 1
+    jump state_1208
+    .mark: state_1207
+    iinc 1
+    jump state_1205
+    .mark: state_1208
+    iinc 1
+    jump state_1210
+    .mark: state_1209
+    iinc 1
+    jump state_1207
+    .mark: state_1210
+    iinc 1
+    jump state_1212
+    .mark: state_1211
+    iinc 1
+    jump state_1209
+    .mark: state_1212
+    iinc 1
+    jump state_1214
+    .mark: state_1213
+    iinc 1
+    jump state_1211
+    .mark: state_1214
+    iinc 1
+    jump state_1216
+    .mark: state_1215
+    iinc 1
+    jump state_1213
+    .mark: state_1216
+    iinc 1
+    jump state_1218
+    .mark: state_1217
+    iinc 1
+    jump state_1215
+    .mark: state_1218
+    iinc 1
+    jump state_1220
+    .mark: state_1219
+    iinc 1
+    jump state_1217
+    .mark: state_1220
+    iinc 1
+    jump state_1222
+    .mark: state_1221
+    iinc 1
+    jump state_1219
+    .mark: state_1222
+    iinc 1
+    jump state_1224
+    .mark: state_1223
+    iinc 1
+    jump state_1221
+    .mark: state_1224
+    iinc 1
+    jump state_1226
+    .mark: state_1225
+    iinc 1
+    jump state_1223
+    .mark: state_1226
+    iinc 1
+    jump state_1228
+    .mark: state_1227
+    iinc 1
+    jump state_1225
+    .mark: state_1228
+    iinc 1
+    jump state_1230
+    .mark: state_1229
+    iinc 1
+    jump state_1227
+    .mark: state_1230
+    iinc 1
+    jump state_1232
+    .mark: state_1231
+    iinc 1
+    jump state_1229
+    .mark: state_1232
+    iinc 1
+    jump state_1234
+    .mark: state_1233
+    iinc 1
+    jump state_1231
+    .mark: state_1234
+    iinc 1
+    jump state_1236
+    .mark: state_1235
+    iinc 1
+    jump state_1233
+    .mark: state_1236
+    iinc 1
+    jump state_1238
+    .mark: state_1237
+    iinc 1
+    jump state_1235
+    .mark: state_1238
+    iinc 1
+    jump state_1240
+    .mark: state_1239
+    iinc 1
+    jump state_1237
+    .mark: state_1240
+    iinc 1
+    jump state_1242
+    .mark: state_1241
+    iinc 1
+    jump state_1239
+    .mark: state_1242
+    iinc 1
+    jump state_1244
+    .mark: state_1243
+    iinc 1
+    jump state_1241
+    .mark: state_1244
+    iinc 1
+    jump state_1246
+    .mark: state_1245
+    iinc 1
+    jump state_1243
+    .mark: state_1246
+    iinc 1
+    jump state_1248
+    .mark: state_1247
+    iinc 1
+    jump state_1245
+    .mark: state_1248
+    iinc 1
+    jump state_1250
+    .mark: state_1249
+    iinc 1
+    jump state_1247
+    .mark: state_1250
+    iinc 1
+    jump state_1252
+    .mark: state_1251
+    iinc 1
+    jump state_1249
+    .mark: state_1252
+    iinc 1
+    jump state_1254
+    .mark: state_1253
+    iinc 1
+    jump state_1251
+    .mark: state_1254
+    iinc 1
+    jump state_1256
+    .mark: state_1255
+    iinc 1
+    jump state_1253
+    .mark: state_1256
+    iinc 1
+    jump state_1258
+    .mark: state_1257
+    iinc 1
+    jump state_1255
+    .mark: state_1258
+    iinc 1
+    jump state_1260
+    .mark: state_1259
+    iinc 1
+    jump state_1257
+    .mark: state_1260
+    iinc 1
+    jump state_1262
+    .mark: state_1261
+    iinc 1
+    jump state_1259
+    .mark: state_1262
+    iinc 1
+    jump state_1264
+    .mark: state_1263
+    iinc 1
+    jump state_1261
+    .mark: state_1264
+    iinc 1
+    jump state_1266
+    .mark: state_1265
+    iinc 1
+    jump state_1263
+    .mark: state_1266
+    iinc 1
+    jump state_1268
+    .mark: state_1267
+    iinc 1
+    jump state_1265
+    .mark: state_1268
+    iinc 1
+    jump state_1270
+    .mark: state_1269
+    iinc 1
+    jump state_1267
+    .mark: state_1270
+    iinc 1
+    jump state_1272
+    .mark: state_1271
+    iinc 1
+    jump state_1269
+    .mark: state_1272
+    iinc 1
+    jump state_1274
+    .mark: state_1273
+    iinc 1
+    jump state_1271
+    .mark: state_1274
+    iinc 1
+    jump state_1276
+    .mark: state_1275
+    iinc 1
+    jump state_1273
+    .mark: state_1276
+    iinc 1
+    jump state_1278
+    .mark: state_1277
+    iinc 1
+    jump state_1275
+    .mark: state_1278
+    iinc 1
+    jump state_1280
+    .mark: state_1279
+    iinc 1
+    jump state_1277
+    .mark: state_1280
+    iinc 1
+    jump state_1282
+    .mark: state_1281
+    iinc 1
+    jump state_1279
+    .mark: state_1282
+    iinc 1
+    jump state_1284
+    .mark: state_1283
+    iinc 1
+    jump state_1281
+    .mark: state_1284
+    iinc 1
+    jump state_1286
+    .mark: state_1285
+    iinc 1
+    jump state_1283
+    .mark: state_1286
+    iinc 1
+    jump state_1288
+    .mark: state_1287
+    iinc 1
+    jump state_1285
+    .mark: state_1288
+    iinc 1
+    jump state_1290
+    .mark: state_1289
+    iinc 1
+    jump state_1287
+    .mark: state_1290
+    iinc 1
+    jump state_1292
+    .mark: state_1291
+    iinc 1
+    jump state_1289
+    .mark: state_1292
+    iinc 1
+    jump state_1294
+    .mark: state_1293
+    iinc 1
+    jump state_1291
+    .mark: state_1294
+    iinc 1
+    jump state_1296
+    .mark: state_1295
+    iinc 1
+    jump state_1293
+    .mark: state_1296
+    iinc 1
+    jump state_1298
+    .mark: state_1297
+    iinc 1
+    jump state_1295
+    .mark: state_1298
+    iinc 1
+    jump state_1300
+    .mark: state_1299
+    iinc 1
+    jump state_1297
+    .mark: state_1300
+    iinc 1
+    jump state_1302
+    .mark: state_1301
+    iinc 1
+    jump state_1299
+    .mark: state_1302
+    iinc 1
+    jump state_1304
+    .mark: state_1303
+    iinc 1
+    jump state_1301
+    .mark: state_1304
+    iinc 1
+    jump state_1306
+    .mark: state_1305
+    iinc 1
+    jump state_1303
+    .mark: state_1306
+    iinc 1
+    jump state_1308
+    .mark: state_1307
+    iinc 1
+    jump state_1305
+    .mark: state_1308
+    iinc 1
+    jump state_1310
+    .mark: state_1309
+    iinc 1
+    jump state_1307
+    .mark: state_1310
+    iinc 1
+    jump state_1312
+    .mark: state_1311
+    iinc 1
+    jump state_1309
+    .mark: state_1312
+    iinc 1
+    jump state_1314
+    .mark: state_1313
+    iinc 1
+    jump state_1311
+    .mark: state_1314
+    iinc 1
+    jump state_1316
+    .mark: state_1315
+    iinc 1
+    jump state_1313
+    .mark: state_1316
+    iinc 1
+    jump state_1318
+    .mark: state_1317
+    iinc 1
+    jump state_1315
+    .mark: state_1318
+    iinc 1
+    jump state_1320
+    .mark: state_1319
+    iinc 1
+    jump state_1317
+    .mark: state_1320
+    iinc 1
+    jump state_1322
+    .mark: state_1321
+    iinc 1
+    jump state_1319
+    .mark: state_1322
+    iinc 1
+    jump state_1324
+    .mark: state_1323
+    iinc 1
+    jump state_1321
+    .mark: state_1324
+    iinc 1
+    jump state_1326
+    .mark: state_1325
+    iinc 1
+    jump state_1323
+    .mark: state_1326
+    iinc 1
+    jump state_1328
+    .mark: state_1327
+    iinc 1
+    jump state_1325
+    .mark: state_1328
+    iinc 1
+    jump state_1330
+    .mark: state_1329
+    iinc 1
+    jump state_1327
+    .mark: state_1330
+    iinc 1
+    jump state_1332
+    .mark: state_1331
+    iinc 1
+    jump state_1329
+    .mark: state_1332
+    iinc 1
+    jump state_1334
+    .mark: state_1333
+    iinc 1
+    jump state_1331
+    .mark: state_1334
+    iinc 1
+    jump state_1336
+    .mark: state_1335
+    iinc 1
+    jump state_1333
+    .mark: state_1336
+    iinc 1
+    jump state_1338
+    .mark: state_1337
+    iinc 1
+    jump state_1335
+    .mark: state_1338
+    iinc 1
+    jump state_1340
+    .mark: state_1339
+    iinc 1
+    jump state_1337
+    .mark: state_1340
+    iinc 1
+    jump state_1342
+    .mark: state_1341
+    iinc 1
+    jump state_1339
+    .mark: state_1342
+    iinc 1
+    jump state_1344
+    .mark: state_1343
+    iinc 1
+    jump state_1341
+    .mark: state_1344
+    iinc 1
+    jump state_1346
+    .mark: state_1345
+    iinc 1
+    jump state_1343
+    .mark: state_1346
+    iinc 1
+    jump state_1348
+    .mark: state_1347
+    iinc 1
+    jump state_1345
+    .mark: state_1348
+    iinc 1
+    jump state_1350
+    .mark: state_1349
+    iinc 1
+    jump state_1347
+    .mark: state_1350
+    iinc 1
+    jump state_1352
+    .mark: state_1351
+    iinc 1
+    jump state_1349
+    .mark: state_1352
+    iinc 1
+    jump state_1354
+    .mark: state_1353
+    iinc 1
+    jump state_1351
+    .mark: state_1354
+    iinc 1
+    jump state_1356
+    .mark: state_1355
+    iinc 1
+    jump state_1353
+    .mark: state_1356
+    iinc 1
+    jump state_1358
+    .mark: state_1357
+    iinc 1
+    jump state_1355
+    .mark: state_1358
+    iinc 1
+    jump state_1360
+    .mark: state_1359
+    iinc 1
+    jump state_1357
+    .mark: state_1360
+    iinc 1
+    jump state_1362
+    .mark: state_1361
+    iinc 1
+    jump state_1359
+    .mark: state_1362
+    iinc 1
+    jump state_1364
+    .mark: state_1363
+    iinc 1
+    jump state_1361
+    .mark: state_1364
+    iinc 1
+    jump state_1366
+    .mark: state_1365
+    iinc 1
+    jump state_1363
+    .mark: state_1366
+    iinc 1
+    jump state_1368
+    .mark: state_1367
+    iinc 1
+    jump state_1365
+    .mark: state_1368
+    iinc 1
+    jump state_1370
+    .mark: state_1369
+    iinc 1
+    jump state_1367
+    .mark: state_1370
+    iinc 1
+    jump state_1372
+    .mark: state_1371
+    iinc 1
+    jump state_1369
+    .mark: state_1372
+    iinc 1
+    jump state_1374
+    .mark: state_1373
+    iinc 1
+    jump state_1371
+    .mark: state_1374
+    iinc 1
+    jump state_1376
+    .mark: state_1375
+    iinc 1
+    jump state_1373
+    .mark: state_1376
+    iinc 1
+    jump state_1378
+    .mark: state_1377
+    iinc 1
+    jump state_1375
+    .mark: state_1378
+    iinc 1
+    jump state_1380
+    .mark: state_1379
+    iinc 1
+    jump state_1377
+    .mark: state_1380
+    iinc 1
+    jump state_1382
+    .mark: state_1381
+    iinc 1
+    jump state_1379
+    .mark: state_1382
+    iinc 1
+    jump state_1384
+    .mark: state_1383
+    iinc 1
+    jump state_1381
+    .mark: state_1384
+    iinc 1
+    jump state_1386
+    .mark: state_1385
+    iinc 1
+    jump state_1383
+    .mark: state_1386
+    iinc 1
+    jump state_1388
+    .mark: state_1387
+    iinc 1
+    jump state_1385
+    .mark: state_1388
+    iinc 1
+    jump state_1390
+    .mark: state_1389
+    iinc 1
+    jump state_1387
+    .mark: state_1390
+    iinc 1
+    jump state_1392
+    .mark: state_1391
+    iinc 1
+    jump state_1389
+    .mark: state_1392
+    iinc 1
+    jump state_1394
+    .mark: state_1393
+    iinc 1
+    jump state_1391
+    .mark: state_1394
+    iinc 1
+    jump state_1396
+    .mark: state_1395
+    iinc 1
+    jump state_1393
+    .mark: state_1396
+    iinc 1
+    jump state_1398
+    .mark: state_1397
+    iinc 1
+    jump state_1395
+    .mark: state_1398
+    iinc 1
+    jump state_1400
+    .mark: state_1399
+    iinc 1
+    jump state_1397
+    .mark: state_1400
+    iinc 1
+    jump state_1402
+    .mark: state_1401
+    iinc 1
+    jump state_1399
+    .mark: state_1402
+    iinc 1
+    jump state_1404
+    .mark: state_1403
+    iinc 1
+    jump state_1401
+    .mark: state_1404
+    iinc 1
+    jump state_1406
+    .mark: state_1405
+    iinc 1
+    jump state_1403
+    .mark: state_1406
+    iinc 1
+    jump state_1408
+    .mark: state_1407
+    iinc 1
+    jump state_1405
+    .mark: state_1408
+    iinc 1
+    jump state_1410
+    .mark: state_1409
+    iinc 1
+    jump state_1407
+    .mark: state_1410
+    iinc 1
+    jump state_1412
+    .mark: state_1411
+    iinc 1
+    jump state_1409
+    .mark: state_1412
+    iinc 1
+    jump state_1414
+    .mark: state_1413
+    iinc 1
+    jump state_1411
+    .mark: state_1414
+    iinc 1
+    jump state_1416
+    .mark: state_1415
+    iinc 1
+    jump state_1413
+    .mark: state_1416
+    iinc 1
+    jump state_1418
+    .mark: state_1417
+    iinc 1
+    jump state_1415
+    .mark: state_1418
+    iinc 1
+    jump state_1420
+    .mark: state_1419
+    iinc 1
+    jump state_1417
+    .mark: state_1420
+    iinc 1
+    jump state_1422
+    .mark: state_1421
+    iinc 1
+    jump state_1419
+    .mark: state_1422
+    iinc 1
+    jump state_1424
+    .mark: state_1423
+    iinc 1
+    jump state_1421
+    .mark: state_1424
+    iinc 1
+    jump state_1426
+    .mark: state_1425
+    iinc 1
+    jump state_1423
+    .mark: state_1426
+    iinc 1
+    jump state_1428
+    .mark: state_1427
+    iinc 1
+    jump state_1425
+    .mark: state_1428
+    iinc 1
+    jump state_1430
+    .mark: state_1429
+    iinc 1
+    jump state_1427
+    .mark: state_1430
+    iinc 1
+    jump state_1432
+    .mark: state_1431
+    iinc 1
+    jump state_1429
+    .mark: state_1432
+    iinc 1
+    jump state_1434
+    .mark: state_1433
+    iinc 1
+    jump state_1431
+    .mark: state_1434
+    iinc 1
+    jump state_1436
+    .mark: state_1435
+    iinc 1
+    jump state_1433
+    .mark: state_1436
+    iinc 1
+    jump state_1438
+    .mark: state_1437
+    iinc 1
+    jump state_1435
+    .mark: state_1438
+    iinc 1
+    jump state_1440
+    .mark: state_1439
+    iinc 1
+    jump state_1437
+    .mark: state_1440
+    iinc 1
+    jump state_1442
+    .mark: state_1441
+    iinc 1
+    jump state_1439
+    .mark: state_1442
+    iinc 1
+    jump state_1444
+    .mark: state_1443
+    iinc 1
+    jump state_1441
+    .mark: state_1444
+    iinc 1
+    jump state_1446
+    .mark: state_1445
+    iinc 1
+    jump state_1443
+    .mark: state_1446
+    iinc 1
+    jump state_1448
+    .mark: state_1447
+    iinc 1
+    jump state_1445
+    .mark: state_1448
+    iinc 1
+    jump state_1450
+    .mark: state_1449
+    iinc 1
+    jump state_1447
+    .mark: state_1450
+    iinc 1
+    jump state_1452
+    .mark: state_1451
+    iinc 1
+    jump state_1449
+    .mark: state_1452
+    iinc 1
+    jump state_1454
+    .mark: state_1453
+    iinc 1
+    jump state_1451
+    .mark: state_1454
+    iinc 1
+    jump state_1456
+    .mark: state_1455
+    iinc 1
+    jump state_1453
+    .mark: state_1456
+    iinc 1
+    jump state_1458
+    .mark: state_1457
+    iinc 1
+    jump state_1455
+    .mark: state_1458
+    iinc 1
+    jump state_1460
+    .mark: state_1459
+    iinc 1
+    jump state_1457
+    .mark: state_1460
+    iinc 1
+    jump state_1462
+    .mark: state_1461
+    iinc 1
+    jump state_1459
+    .mark: state_1462
+    iinc 1
+    jump state_1464
+    .mark: state_1463
+    iinc 1
+    jump state_1461
+    .mark: state_1464
+    iinc 1
+    jump state_1466
+    .mark: state_1465
+    iinc 1
+    jump state_1463
+    .mark: state_1466
+    iinc 1
+    jump state_1468
+    .mark: state_1467
+    iinc 1
+    jump state_1465
+    .mark: state_1468
+    iinc 1
+    jump state_1470
+    .mark: state_1469
+    iinc 1
+    jump state_1467
+    .mark: state_1470
+    iinc 1
+    jump state_1472
+    .mark: state_1471
+    iinc 1
+    jump state_1469
+    .mark: state_1472
+    iinc 1
+    jump state_1474
+    .mark: state_1473
+    iinc 1
+    jump state_1471
+    .mark: state_1474
+    iinc 1
+    jump state_1476
+    .mark: state_1475
+    iinc 1
+    jump state_1473
+    .mark: state_1476
+    iinc 1
+    jump state_1478
+    .mark: state_1477
+    iinc 1
+    jump state_1475
+    .mark: state_1478
+    iinc 1
+    jump state_1480
+    .mark: state_1479
+    iinc 1
+    jump state_1477
+    .mark: state_1480
+    iinc 1
+    jump state_1482
+    .mark: state_1481
+    iinc 1
+    jump state_1479
+    .mark: state_1482
+    iinc 1
+    jump state_1484
+    .mark: state_1483
+    iinc 1
+    jump state_1481
+    .mark: state_1484
+    iinc 1
+    jump state_1486
+    .mark: state_1485
+    iinc 1
+    jump state_1483
+    .mark: state_1486
+    iinc 1
+    jump state_1488
+    .mark: state_1487
+    iinc 1
+    jump state_1485
+    .mark: state_1488
+    iinc 1
+    jump state_1490
+    .mark: state_1489
+    iinc 1
+    jump state_1487
+    .mark: state_1490
+    iinc 1
+    jump state_1492
+    .mark: state_1491
+    iinc 1
+    jump state_1489
+    .mark: state_1492
+    iinc 1
+    jump state_1494
+    .mark: state_1493
+    iinc 1
+    jump state_1491
+    .mark: state_1494
+    iinc 1
+    jump state_1496
+    .mark: state_1495
+    iinc 1
+    jump state_1493
+    .mark: state_1496
+    iinc 1
+    jump state_1498
+    .mark: state_1497
+    iinc 1
+    jump state_1495
+    .mark: state_1498
+    iinc 1
+    jump state_1500
+    .mark: state_1499
+    iinc 1
+    jump state_1497
+    .mark: state_1500
+    iinc 1
+    jump state_1502
+    .mark: state_1501
+    iinc 1
+    jump state_1499
+    .mark: state_1502
+    iinc 1
+    jump state_1504
+    .mark: state_1503
+    iinc 1
+    jump state_1501
+    .mark: state_1504
+    iinc 1
+    jump state_1506
+    .mark: state_1505
+    iinc 1
+    jump state_1503
+    .mark: state_1506
+    iinc 1
+    jump state_1508
+    .mark: state_1507
+    iinc 1
+    jump state_1505
+    .mark: state_1508
+    iinc 1
+    jump state_1510
+    .mark: state_1509
+    iinc 1
+    jump state_1507
+    .mark: state_1510
+    iinc 1
+    jump state_1512
+    .mark: state_1511
+    iinc 1
+    jump state_1509
+    .mark: state_1512
+    iinc 1
+    jump state_1514
+    .mark: state_1513
+    iinc 1
+    jump state_1511
+    .mark: state_1514
+    iinc 1
+    jump state_1516
+    .mark: state_1515
+    iinc 1
+    jump state_1513
+    .mark: state_1516
+    iinc 1
+    jump state_1518
+    .mark: state_1517
+    iinc 1
+    jump state_1515
+    .mark: state_1518
+    iinc 1
+    jump state_1520
+    .mark: state_1519
+    iinc 1
+    jump state_1517
+    .mark: state_1520
+    iinc 1
+    jump state_1522
+    .mark: state_1521
+    iinc 1
+    jump state_1519
+    .mark: state_1522
+    iinc 1
+    jump state_1524
+    .mark: state_1523
+    iinc 1
+    jump state_1521
+    .mark: state_1524
+    iinc 1
+    jump state_1526
+    .mark: state_1525
+    iinc 1
+    jump state_1523
+    .mark: state_1526
+    iinc 1
+    jump state_1528
+    .mark: state_1527
+    iinc 1
+    jump state_1525
+    .mark: state_1528
+    iinc 1
+    jump state_1530
+    .mark: state_1529
+    iinc 1
+    jump state_1527
+    .mark: state_1530
+    iinc 1
+    jump state_1532
+    .mark: state_1531
+    iinc 1
+    jump state_1529
+    .mark: state_1532
+    iinc 1
+    jump state_1534
+    .mark: state_1533
+    iinc 1
+    jump state_1531
+    .mark: state_1534
+    iinc 1
+    jump state_1536
+    .mark: state_1535
+    iinc 1
+    jump state_1533
+    .mark: state_1536
+    iinc 1
+    jump state_1538
+    .mark: state_1537
+    iinc 1
+    jump state_1535
+    .mark: state_1538
+    iinc 1
+    jump state_1540
+    .mark: state_1539
+    iinc 1
+    jump state_1537
+    .mark: state_1540
+    iinc 1
+    jump state_1542
+    .mark: state_1541
+    iinc 1
+    jump state_1539
+    .mark: state_1542
+    iinc 1
+    jump state_1544
+    .mark: state_1543
+    iinc 1
+    jump state_1541
+    .mark: state_1544
+    iinc 1
+    jump state_1546
+    .mark: state_1545
+    iinc 1
+    jump state_1543
+    .mark: state_1546
+    iinc 1
+    jump state_1548
+    .mark: state_1547
+    iinc 1
+    jump state_1545
+    .mark: state_1548
+    iinc 1
+    jump state_1550
+    .mark: state_1549
+    iinc 1
+    jump state_1547
+    .mark: state_1550
+    iinc 1
+    jump state_1552
+    .mark: state_1551
+    iinc 1
+    jump state_1549
+    .mark: state_1552
+    iinc 1
+    jump state_1554
+    .mark: state_1553
+    iinc 1
+    jump state_1551
+    .mark: state_1554
+    iinc 1
+    jump state_1556
+    .mark: state_1555
+    iinc 1
+    jump state_1553
+    .mark: state_1556
+    iinc 1
+    jump state_1558
+    .mark: state_1557
+    iinc 1
+    jump state_1555
+    .mark: state_1558
+    iinc 1
+    jump state_1560
+    .mark: state_1559
+    iinc 1
+    jump state_1557
+    .mark: state_1560
+    iinc 1
+    jump state_1562
+    .mark: state_1561
+    iinc 1
+    jump state_1559
+    .mark: state_1562
+    iinc 1
+    jump state_1564
+    .mark: state_1563
+    iinc 1
+    jump state_1561
+    .mark: state_1564
+    iinc 1
+    jump state_1566
+    .mark: state_1565
+    iinc 1
+    jump state_1563
+    .mark: state_1566
+    iinc 1
+    jump state_1568
+    .mark: state_1567
+    iinc 1
+    jump state_1565
+    .mark: state_1568
+    iinc 1
+    jump state_1570
+    .mark: state_1569
+    iinc 1
+    jump state_1567
+    .mark: state_1570
+    iinc 1
+    jump state_1572
+    .mark: state_1571
+    iinc 1
+    jump state_1569
+    .mark: state_1572
+    iinc 1
+    jump state_1574
+    .mark: state_1573
+    iinc 1
+    jump state_1571
+    .mark: state_1574
+    iinc 1
+    jump state_1576
+    .mark: state_1575
+    iinc 1
+    jump state_1573
+    .mark: state_1576
+    iinc 1
+    jump state_1578
+    .mark: state_1577
+    iinc 1
+    jump state_1575
+    .mark: state_1578
+    iinc 1
+    jump state_1580
+    .mark: state_1579
+    iinc 1
+    jump state_1577
+    .mark: state_1580
+    iinc 1
+    jump state_1582
+    .mark: state_1581
+    iinc 1
+    jump state_1579
+    .mark: state_1582
+    iinc 1
+    jump state_1584
+    .mark: state_1583
+    iinc 1
+    jump state_1581
+    .mark: state_1584
+    iinc 1
+    jump state_1586
+    .mark: state_1585
+    iinc 1
+    jump state_1583
+    .mark: state_1586
+    iinc 1
+    jump state_1588
+    .mark: state_1587
+    iinc 1
+    jump state_1585
+    .mark: state_1588
+    iinc 1
+    jump state_1590
+    .mark: state_1589
+    iinc 1
+    jump state_1587
+    .mark: state_1590
+    iinc 1
+    jump state_1592
+    .mark: state_1591
+    iinc 1
+    jump state_1589
+    .mark: state_1592
+    iinc 1
+    jump state_1594
+    .mark: state_1593
+    iinc 1
+    jump state_1591
+    .mark: state_1594
+    iinc 1
+    jump state_1596
+    .mark: state_1595
+    iinc 1
+    jump state_1593
+    .mark: state_1596
+    iinc 1
+    jump state_1598
+    .mark: state_1597
+    iinc 1
+    jump state_1595
+    .mark: state_1598
+    iinc 1
+    jump state_1600
+    .mark: state_1599
+    iinc 1
+    jump state_1597
+    .mark: state_1600
+    iinc 1
+    jump state_1602
+    .mark: state_1601
+    iinc 1
+    jump state_1599
+    .mark: state_1602
+    iinc 1
+    jump state_1604
+    .mark: state_1603
+    iinc 1
+    jump state_1601
+    .mark: state_1604
+    iinc 1
+    jump state_1606
+    .mark: state_1605
+    iinc 1
+    jump state_1603
+    .mark: state_1606
+    iinc 1
+    jump state_1608
+    .mark: state_1607
+    iinc 1
+    jump state_1605
+    .mark: state_1608
+    iinc 1
+    jump state_1610
+    .mark: state_1609
+    iinc 1
+    jump state_1607
+    .mark: state_1610
+    iinc 1
+    jump state_1612
+    .mark: state_1611
+    iinc 1
+    jump state_1609
+    .mark: state_1612
+    iinc 1
+    jump state_1614
+    .mark: state_1613
+    iinc 1
+    jump state_1611
+    .mark: state_1614
+    iinc 1
+    jump state_1616
+    .mark: state_1615
+    iinc 1
+    jump state_1613
+    .mark: state_1616
+    iinc 1
+    jump state_1618
+    .mark: state_1617
+    iinc 1
+    jump state_1615
+    .mark: state_1618
+    iinc 1
+    jump state_1620
+    .mark: state_1619
+    iinc 1
+    jump state_1617
+    .mark: state_1620
+    iinc 1
+    jump state_1622
+    .mark: state_1621
+    iinc 1
+    jump state_1619
+    .mark: state_1622
+    iinc 1
+    jump state_1624
+    .mark: state_1623
+    iinc 1
+    jump state_1621
+    .mark: state_1624
+    iinc 1
+    jump state_1626
+    .mark: state_1625
+    iinc 1
+    jump state_1623
+    .mark: state_1626
+    iinc 1
+    jump state_1628
+    .mark: state_1627
+    iinc 1
+    jump state_1625
+    .mark: state_1628
+    iinc 1
+    jump state_1630
+    .mark: state_1629
+    iinc 1
+    jump state_1627
+    .mark: state_1630
+    iinc 1
+    jump state_1632
+    .mark: state_1631
+    iinc 1
+    jump state_1629
+    .mark: state_1632
+    iinc 1
+    jump state_1634
+    .mark: state_1633
+    iinc 1
+    jump state_1631
+    .mark: state_1634
+    iinc 1
+    jump state_1636
+    .mark: state_1635
+    iinc 1
+    jump state_1633
+    .mark: state_1636
+    iinc 1
+    jump state_1638
+    .mark: state_1637
+    iinc 1
+    jump state_1635
+    .mark: state_1638
+    iinc 1
+    jump state_1640
+    .mark: state_1639
+    iinc 1
+    jump state_1637
+    .mark: state_1640
+    iinc 1
+    jump state_1642
+    .mark: state_1641
+    iinc 1
+    jump state_1639
+    .mark: state_1642
+    iinc 1
+    jump state_1644
+    .mark: state_1643
+    iinc 1
+    jump state_1641
+    .mark: state_1644
+    iinc 1
+    jump state_1646
+    .mark: state_1645
+    iinc 1
+    jump state_1643
+    .mark: state_1646
+    iinc 1
+    jump state_1648
+    .mark: state_1647
+    iinc 1
+    jump state_1645
+    .mark: state_1648
+    iinc 1
+    jump state_1650
+    .mark: state_1649
+    iinc 1
+    jump state_1647
+    .mark: state_1650
+    iinc 1
+    jump state_1652
+    .mark: state_1651
+    iinc 1
+    jump state_1649
+    .mark: state_1652
+    iinc 1
+    jump state_1654
+    .mark: state_1653
+    iinc 1
+    jump state_1651
+    .mark: state_1654
+    iinc 1
+    jump state_1656
+    .mark: state_1655
+    iinc 1
+    jump state_1653
+    .mark: state_1656
+    iinc 1
+    jump state_1658
+    .mark: state_1657
+    iinc 1
+    jump state_1655
+    .mark: state_1658
+    iinc 1
+    jump state_1660
+    .mark: state_1659
+    iinc 1
+    jump state_1657
+    .mark: state_1660
+    iinc 1
+    jump state_1662
+    .mark: state_1661
+    iinc 1
+    jump state_1659
+    .mark: state_1662
+    iinc 1
+    jump state_1664
+    .mark: state_1663
+    iinc 1
+    jump state_1661
+    .mark: state_1664
+    iinc 1
+    jump state_1666
+    .mark: state_1665
+    iinc 1
+    jump state_1663
+    .mark: state_1666
+    iinc 1
+    jump state_1668
+    .mark: state_1667
+    iinc 1
+    jump state_1665
+    .mark: state_1668
+    iinc 1
+    jump state_1670
+    .mark: state_1669
+    iinc 1
+    jump state_1667
+    .mark: state_1670
+    iinc 1
+    jump state_1672
+    .mark: state_1671
+    iinc 1
+    jump state_1669
+    .mark: state_1672
+    iinc 1
+    jump state_1674
+    .mark: state_1673
+    iinc 1
+    jump state_1671
+    .mark: state_1674
+    iinc 1
+    jump state_1676
+    .mark: state_1675
+    iinc 1
+    jump state_1673
+    .mark: state_1676
+    iinc 1
+    jump state_1678
+    .mark: state_1677
+    iinc 1
+    jump state_1675
+    .mark: state_1678
+    iinc 1
+    jump state_1680
+    .mark: state_1679
+    iinc 1
+    jump state_1677
+    .mark: state_1680
+    iinc 1
+    jump state_1682
+    .mark: state_1681
+    iinc 1
+    jump state_1679
+    .mark: state_1682
+    iinc 1
+    jump state_1684
+    .mark: state_1683
+    iinc 1
+    jump state_1681
+    .mark: state_1684
+    iinc 1
+    jump state_1686
+    .mark: state_1685
+    iinc 1
+    jump state_1683
+    .mark: state_1686
+    iinc 1
+    jump state_1688
+    .mark: state_1687
+    iinc 1
+    jump state_1685
+    .mark: state_1688
+    iinc 1
+    jump state_1690
+    .mark: state_1689
+    iinc 1
+    jump state_1687
+    .mark: state_1690
+    iinc 1
+    jump state_1692
+    .mark: state_1691
+    iinc 1
+    jump state_1689
+    .mark: state_1692
+    iinc 1
+    jump state_1694
+    .mark: state_1693
+    iinc 1
+    jump state_1691
+    .mark: state_1694
+    iinc 1
+    jump state_1696
+    .mark: state_1695
+    iinc 1
+    jump state_1693
+    .mark: state_1696
+    iinc 1
+    jump state_1698
+    .mark: state_1697
+    iinc 1
+    jump state_1695
+    .mark: state_1698
+    iinc 1
+    jump state_1700
+    .mark: state_1699
+    iinc 1
+    jump state_1697
+    .mark: state_1700
+    iinc 1
+    jump state_1702
+    .mark: state_1701
+    iinc 1
+    jump state_1699
+    .mark: state_1702
+    iinc 1
+    jump state_1704
+    .mark: state_1703
+    iinc 1
+    jump state_1701
+    .mark: state_1704
+    iinc 1
+    jump state_1706
+    .mark: state_1705
+    iinc 1
+    jump state_1703
+    .mark: state_1706
+    iinc 1
+    jump state_1708
+    .mark: state_1707
+    iinc 1
+    jump state_1705
+    .mark: state_1708
+    iinc 1
+    jump state_1710
+    .mark: state_1709
+    iinc 1
+    jump state_1707
+    .mark: state_1710
+    iinc 1
+    jump state_1712
+    .mark: state_1711
+    iinc 1
+    jump state_1709
+    .mark: state_1712
+    iinc 1
+    jump state_1714
+    .mark: state_1713
+    iinc 1
+    jump state_1711
+    .mark: state_1714
+    iinc 1
+    jump state_1716
+    .mark: state_1715
+    iinc 1
+    jump state_1713
+    .mark: state_1716
+    iinc 1
+    jump state_1718
+    .mark: state_1717
+    iinc 1
+    jump state_1715
+    .mark: state_1718
+    iinc 1
+    jump state_1720
+    .mark: state_1719
+    iinc 1
+    jump state_1717
+    .mark: state_1720
+    iinc 1
+    jump state_1722
+    .mark: state_1721
+    iinc 1
+    jump state_1719
+    .mark: state_1722
+    iinc 1
+    jump state_1724
+    .mark: state_1723
+    iinc 1
+    jump state_1721
+    .mark: state_1724
+    iinc 1
+    jump state_1726
+    .mark: state_1725
+    iinc 1
+    jump state_1723
+    .mark: state_1726
+    iinc 1
+    jump state_1728
+    .mark: state_1727
+    iinc 1
+    jump state_1725
+    .mark: state_1728
+    iinc 1
+    jump state_1730
+    .mark: state_1729
+    iinc 1
+    jump state_1727
+    .mark: state_1730
+    iinc 1
+    jump state_1732
+    .mark: state_1731
+    iinc 1
+    jump state_1729
+    .mark: state_1732
+    iinc 1
+    jump state_1734
+    .mark: state_1733
+    iinc 1
+    jump state_1731
+    .mark: state_1734
+    iinc 1
+    jump state_1736
+    .mark: state_1735
+    iinc 1
+    jump state_1733
+    .mark: state_1736
+    iinc 1
+    jump state_1738
+    .mark: state_1737
+    iinc 1
+    jump state_1735
+    .mark: state_1738
+    iinc 1
+    jump state_1740
+    .mark: state_1739
+    iinc 1
+    jump state_1737
+    .mark: state_1740
+    iinc 1
+    jump state_1742
+    .mark: state_1741
+    iinc 1
+    jump state_1739
+    .mark: state_1742
+    iinc 1
+    jump state_1744
+    .mark: state_1743
+    iinc 1
+    jump state_1741
+    .mark: state_1744
+    iinc 1
+    jump state_1746
+    .mark: state_1745
+    iinc 1
+    jump state_1743
+    .mark: state_1746
+    iinc 1
+    jump state_1748
+    .mark: state_1747
+    iinc 1
+    jump state_1745
+    .mark: state_1748
+    iinc 1
+    jump state_1750
+    .mark: state_1749
+    iinc 1
+    jump state_1747
+    .mark: state_1750
+    iinc 1
+    jump state_1752
+    .mark: state_1751
+    iinc 1
+    jump state_1749
+    .mark: state_1752
+    iinc 1
+    jump state_1754
+    .mark: state_1753
+    iinc 1
+    jump state_1751
+    .mark: state_1754
+    iinc 1
+    jump state_1756
+    .mark: state_1755
+    iinc 1
+    jump state_1753
+    .mark: state_1756
+    iinc 1
+    jump state_1758
+    .mark: state_1757
+    iinc 1
+    jump state_1755
+    .mark: state_1758
+    iinc 1
+    jump state_1760
+    .mark: state_1759
+    iinc 1
+    jump state_1757
+    .mark: state_1760
+    iinc 1
+    jump state_1762
+    .mark: state_1761
+    iinc 1
+    jump state_1759
+    .mark: state_1762
+    iinc 1
+    jump state_1764
+    .mark: state_1763
+    iinc 1
+    jump state_1761
+    .mark: state_1764
+    iinc 1
+    jump state_1766
+    .mark: state_1765
+    iinc 1
+    jump state_1763
+    .mark: state_1766
+    iinc 1
+    jump state_1768
+    .mark: state_1767
+    iinc 1
+    jump state_1765
+    .mark: state_1768
+    iinc 1
+    jump state_1770
+    .mark: state_1769
+    iinc 1
+    jump state_1767
+    .mark: state_1770
+    iinc 1
+    jump state_1772
+    .mark: state_1771
+    iinc 1
+    jump state_1769
+    .mark: state_1772
+    iinc 1
+    jump state_1774
+    .mark: state_1773
+    iinc 1
+    jump state_1771
+    .mark: state_1774
+    iinc 1
+    jump state_1776
+    .mark: state_1775
+    iinc 1
+    jump state_1773
+    .mark: state_1776
+    iinc 1
+    jump state_1778
+    .mark: state_1777
+    iinc 1
+    jump state_1775
+    .mark: state_1778
+    iinc 1
+    jump state_1780
+    .mark: state_1779
+    iinc 1
+    jump state_1777
+    .mark: state_1780
+    iinc 1
+    jump state_1782
+    .mark: state_1781
+    iinc 1
+    jump state_1779
+    .mark: state_1782
+    iinc 1
+    jump state_1784
+    .mark: state_1783
+    iinc 1
+    jump state_1781
+    .mark: state_1784
+    iinc 1
+    jump state_1786
+    .mark: state_1785
+    iinc 1
+    jump state_1783
+    .mark: state_1786
+    iinc 1
+    jump state_1788
+    .mark: state_1787
+    iinc 1
+    jump state_1785
+    .mark: state_1788
+    iinc 1
+    jump state_1790
+    .mark: state_1789
+    iinc 1
+    jump state_1787
+    .mark: state_1790
+    iinc 1
+    jump state_1792
+    .mark: state_1791
+    iinc 1
+    jump state_1789
+    .mark: state_1792
+    iinc 1
+    jump state_1794
+    .mark: state_1793
+    iinc 1
+    jump state_1791
+    .mark: state_1794
+    iinc 1
+    jump state_1796
+    .mark: state_1795
+    iinc 1
+    jump state_1793
+    .mark: state_1796
+    iinc 1
+    jump state_1798
+    .mark: state_1797
+    iinc 1
+    jump state_1795
+    .mark: state_1798
+    iinc 1
+    jump state_1800
+    .mark: state_1799
+    iinc 1
+    jump state_1797
+    .mark: state_1800
+    iinc 1
+    jump state_1802
+    .mark: state_1801
+    iinc 1
+    jump state_1799
+    .mark: state_1802
+    iinc 1
+    jump state_1804
+    .mark: state_1803
+    iinc 1
+    jump state_1801
+    .mark: state_1804
+    iinc 1
+    jump state_1806
+    .mark: state_1805
+    iinc 1
+    jump state_1803
+    .mark: state_1806
+    iinc 1
+    jump state_1808
+    .mark: state_1807
+    iinc 1
+    jump state_1805
+    .mark: state_1808
+    iinc 1
+    jump state_1810
+    .mark: state_1809
+    iinc 1
+    jump state_1807
+    .mark: state_1810
+    iinc 1
+    jump state_1812
+    .mark: state_1811
+    iinc 1
+    jump state_1809
+    .mark: state_1812
+    iinc 1
+    jump state_1814
+    .mark: state_1813
+    iinc 1
+    jump state_1811
+    .mark: state_1814
+    iinc 1
+    jump state_1816
+    .mark: state_1815
+    iinc 1
+    jump state_1813
+    .mark: state_1816
+    iinc 1
+    jump state_1818
+    .mark: state_1817
+    iinc 1
+    jump state_1815
+    .mark: state_1818
+    iinc 1
+    jump state_1820
+    .mark: state_1819
+    iinc 1
+    jump state_1817
+    .mark: state_1820
+    iinc 1
+    jump state_1822
+    .mark: state_1821
+    iinc 1
+    jump state_1819
+    .mark: state_1822
+    iinc 1
+    jump state_1824
+    .mark: state_1823
+    iinc 1
+    jump state_1821
+    .mark: state_1824
+    iinc 1
+    jump state_1826
+    .mark: state_1825
+    iinc 1
+    jump state_1823
+    .mark: state_1826
+    iinc 1
+    jump state_1828
+    .mark: state_1827
+    iinc 1
+    jump state_1825
+    .mark: state_1828
+    iinc 1
+    jump state_1830
+    .mark: state_1829
+    iinc 1
+    jump state_1827
+    .mark: state_1830
+    iinc 1
+    jump state_1832
+    .mark: state_1831
+    iinc 1
+    jump state_1829
+    .mark: state_1832
+    iinc 1
+    jump state_1834
+    .mark: state_1833
+    iinc 1
+    jump state_1831
+    .mark: state_1834
+    iinc 1
+    jump state_1836
+    .mark: state_1835
+    iinc 1
+    jump state_1833
+    .mark: state_1836
+    iinc 1
+    jump state_1838
+    .mark: state_1837
+    iinc 1
+    jump state_1835
+    .mark: state_1838
+    iinc 1
+    jump state_1840
+    .mark: state_1839
+    iinc 1
+    jump state_1837
+    .mark: state_1840
+    iinc 1
+    jump state_1842
+    .mark: state_1841
+    iinc 1
+    jump state_1839
+    .mark: state_1842
+    iinc 1
+    jump state_1844
+    .mark: state_1843
+    iinc 1
+    jump state_1841
+    .mark: state_1844
+    iinc 1
+    jump state_1846
+    .mark: state_1845
+    iinc 1
+    jump state_1843
+    .mark: state_1846
+    iinc 1
+    jump state_1848
+    .mark: state_1847
+    iinc 1
+    jump state_1845
+    .mark: state_1848
+    iinc 1
+    jump state_1850
+    .mark: state_1849
+    iinc 1
+    jump state_1847
+    .mark: state_1850
+    iinc 1
+    jump state_1852
+    .mark: state_1851
+    iinc 1
+    jump state_1849
+    .mark: state_1852
+    iinc 1
+    jump state_1854
+    .mark: state_1853
+    iinc 1
+    jump state_1851
+    .mark: state_1854
+    iinc 1
+    jump state_1856
+    .mark: state_1855
+    iinc 1
+    jump state_1853
+    .mark: state_1856
+    iinc 1
+    jump state_1858
+    .mark: state_1857
+    iinc 1
+    jump state_1855
+    .mark: state_1858
+    iinc 1
+    jump state_1860
+    .mark: state_1859
+    iinc 1
+    jump state_1857
+    .mark: state_1860
+    iinc 1
+    jump state_1862
+    .mark: state_1861
+    iinc 1
+    jump state_1859
+    .mark: state_1862
+    iinc 1
+    jump state_1864
+    .mark: state_1863
+    iinc 1
+    jump state_1861
+    .mark: state_1864
+    iinc 1
+    jump state_1866
+    .mark: state_1865
+    iinc 1
+    jump state_1863
+    .mark: state_1866
+    iinc 1
+    jump state_1868
+    .mark: state_1867
+    iinc 1
+    jump state_1865
+    .mark: state_1868
+    iinc 1
+    jump state_1870
+    .mark: state_1869
+    iinc 1
+    jump state_1867
+    .mark: state_1870
+    iinc 1
+    jump state_1872
+    .mark: state_1871
+    iinc 1
+    jump state_1869
+    .mark: state_1872
+    iinc 1
+    jump state_1874
+    .mark: state_1873
+    iinc 1
+    jump state_1871
+    .mark: state_1874
+    iinc 1
+    jump state_1876
+    .mark: state_1875
+    iinc 1
+    jump state_1873
+    .mark: state_1876
+    iinc 1
+    jump state_1878
+    .mark: state_1877
+    iinc 1
+    jump state_1875
+    .mark: state_1878
+    iinc 1
+    jump state_1880
+    .mark: state_1879
+    iinc 1
+    jump state_1877
+    .mark: state_1880
+    iinc 1
+    jump state_1882
+    .mark: state_1881
+    iinc 1
+    jump state_1879
+    .mark: state_1882
+    iinc 1
+    jump state_1884
+    .mark: state_1883
+    iinc 1
+    jump state_1881
+    .mark: state_1884
+    iinc 1
+    jump state_1886
+    .mark: state_1885
+    iinc 1
+    jump state_1883
+    .mark: state_1886
+    iinc 1
+    jump state_1888
+    .mark: state_1887
+    iinc 1
+    jump state_1885
+    .mark: state_1888
+    iinc 1
+    jump state_1890
+    .mark: state_1889
+    iinc 1
+    jump state_1887
+    .mark: state_1890
+    iinc 1
+    jump state_1892
+    .mark: state_1891
+    iinc 1
+    jump state_1889
+    .mark: state_1892
+    iinc 1
+    jump state_1894
+    .mark: state_1893
+    iinc 1
+    jump state_1891
+    .mark: state_1894
+    iinc 1
+    jump state_1896
+    .mark: state_1895
+    iinc 1
+    jump state_1893
+    .mark: state_1896
+    iinc 1
+    jump state_1898
+    .mark: state_1897
+    iinc 1
+    jump state_1895
+    .mark: state_1898
+    iinc 1
+    jump state_1900
+    .mark: state_1899
+    iinc 1
+    jump state_1897
+    .mark: state_1900
+    iinc 1
+    jump state_1902
+    .mark: state_1901
+    iinc 1
+    jump state_1899
+    .mark: state_1902
+    iinc 1
+    jump state_1904
+    .mark: state_1903
+    iinc 1
+    jump state_1901
+    .mark: state_1904
+    iinc 1
+    jump state_1906
+    .mark: state_1905
+    iinc 1
+    jump state_1903
+    .mark: state_1906
+    iinc 1
+    jump state_1908
+    .mark: state_1907
+    iinc 1
+    jump state_1905
+    .mark: state_1908
+    iinc 1
+    jump state_1910
+    .mark: state_1909
+    iinc 1
+    jump state_1907
+    .mark: state_1910
+    iinc 1
+    jump state_1912
+    .mark: state_1911
+    iinc 1
+    jump state_1909
+    .mark: state_1912
+    iinc 1
+    jump state_1914
+    .mark: state_1913
+    iinc 1
+    jump state_1911
+    .mark: state_1914
+    iinc 1
+    jump state_1916
+    .mark: state_1915
+    iinc 1
+    jump state_1913
+    .mark: state_1916
+    iinc 1
+    jump state_1918
+    .mark: state_1917
+    iinc 1
+    jump state_1915
+    .mark: state_1918
+    iinc 1
+    jump state_1920
+    .mark: state_1919
+    iinc 1
+    jump state_1917
+    .mark: state_1920
+    iinc 1
+    jump state_1922
+    .mark: state_1921
+    iinc 1
+    jump state_1919
+    .mark: state_1922
+    iinc 1
+    jump state_1924
+    .mark: state_1923
+    iinc 1
+    jump state_1921
+    .mark: state_1924
+    iinc 1
+    jump state_1926
+    .mark: state_1925
+    iinc 1
+    jump state_1923
+    .mark: state_1926
+    iinc 1
+    jump state_1928
+    .mark: state_1927
+    iinc 1
+    jump state_1925
+    .mark: state_1928
+    iinc 1
+    jump state_1930
+    .mark: state_1929
+    iinc 1
+    jump state_1927
+    .mark: state_1930
+    iinc 1
+    jump state_1932
+    .mark: state_1931
+    iinc 1
+    jump state_1929
+    .mark: state_1932
+    iinc 1
+    jump state_1934
+    .mark: state_1933
+    iinc 1
+    jump state_1931
+    .mark: state_1934
+    iinc 1
+    jump state_1936
+    .mark: state_1935
+    iinc 1
+    jump state_1933
+    .mark: state_1936
+    iinc 1
+    jump state_1938
+    .mark: state_1937
+    iinc 1
+    jump state_1935
+    .mark: state_1938
+    iinc 1
+    jump state_1940
+    .mark: state_1939
+    iinc 1
+    jump state_1937
+    .mark: state_1940
+    iinc 1
+    jump state_1942
+    .mark: state_1941
+    iinc 1
+    jump state_1939
+    .mark: state_1942
+    iinc 1
+    jump state_1944
+    .mark: state_1943
+    iinc 1
+    jump state_1941
+    .mark: state_1944
+    iinc 1
+    jump state_1946
+    .mark: state_1945
+    iinc 1
+    jump state_1943
+    .mark: state_1946
+    iinc 1
+    jump state_1948
+    .mark: state_1947
+    iinc 1
+    jump state_1945
+    .mark: state_1948
+    iinc 1
+    jump state_1950
+    .mark: state_1949
+    iinc 1
+    jump state_1947
+    .mark: state_1950
+    iinc 1
+    jump state_1952
+    .mark: state_1951
+    iinc 1
+    jump state_1949
+    .mark: state_1952
+    iinc 1
+    jump state_1954
+    .mark: state_1953
+    iinc 1
+    jump state_1951
+    .mark: state_1954
+    iinc 1
+    jump state_1956
+    .mark: state_1955
+    iinc 1
+    jump state_1953
+    .mark: state_1956
+    iinc 1
+    jump state_1958
+    .mark: state_1957
+    iinc 1
+    jump state_1955
+    .mark: state_1958
+    iinc 1
+    jump state_1960
+    .mark: state_1959
+    iinc 1
+    jump state_1957
+    .mark: state_1960
+    iinc 1
+    jump state_1962
+    .mark: state_1961
+    iinc 1
+    jump state_1959
+    .mark: state_1962
+    iinc 1
+    jump state_1964
+    .mark: state_1963
+    iinc 1
+    jump state_1961
+    .mark: state_1964
+    iinc 1
+    jump state_1966
+    .mark: state_1965
+    iinc 1
+    jump state_1963
+    .mark: state_1966
+    iinc 1
+    jump state_1968
+    .mark: state_1967
+    iinc 1
+    jump state_1965
+    .mark: state_1968
+    iinc 1
+    jump state_1970
+    .mark: state_1969
+    iinc 1
+    jump state_1967
+    .mark: state_1970
+    iinc 1
+    jump state_1972
+    .mark: state_1971
+    iinc 1
+    jump state_1969
+    .mark: state_1972
+    iinc 1
+    jump state_1974
+    .mark: state_1973
+    iinc 1
+    jump state_1971
+    .mark: state_1974
+    iinc 1
+    jump state_1976
+    .mark: state_1975
+    iinc 1
+    jump state_1973
+    .mark: state_1976
+    iinc 1
+    jump state_1978
+    .mark: state_1977
+    iinc 1
+    jump state_1975
+    .mark: state_1978
+    iinc 1
+    jump state_1980
+    .mark: state_1979
+    iinc 1
+    jump state_1977
+    .mark: state_1980
+    iinc 1
+    jump state_1982
+    .mark: state_1981
+    iinc 1
+    jump state_1979
+    .mark: state_1982
+    iinc 1
+    jump state_1984
+    .mark: state_1983
+    iinc 1
+    jump state_1981
+    .mark: state_1984
+    iinc 1
+    jump state_1986
+    .mark: state_1985
+    iinc 1
+    jump state_1983
+    .mark: state_1986
+    iinc 1
+    jump state_1988
+    .mark: state_1987
+    iinc 1
+    jump state_1985
+    .mark: state_1988
+    iinc 1
+    jump state_1990
+    .mark: state_1989
+    iinc 1
+    jump state_1987
+    .mark: state_1990
+    iinc 1
+    jump state_1992
+    .mark: state_1991
+    iinc 1
+    jump state_1989
+    .mark: state_1992
+    iinc 1
+    jump state_1994
+    .mark: state_1993
+    iinc 1
+    jump state_1991
+    .mark: state_1994
+    iinc 1
+    jump state_1996
+    .mark: state_1995
+    iinc 1
+    jump state_1993
+    .mark: state_1996
+    iinc 1
+    jump state_1998
+    .mark: state_1997
+    iinc 1
+    jump state_1995
+    .mark: state_1998
+    iinc 1
+    jump state_2000
+    .mark: state_1999
+    iinc 1
+    jump state_1997
+    .mark: state_2000
+    iinc 1
+    jump state_2002
+    .mark: state_2001
+    iinc 1
+    jump state_1999
+    .mark: state_2002
+    iinc 1
+    jump state_2004
+    .mark: state_2003
+    iinc 1
+    jump state_2001
+    .mark: state_2004
+    iinc 1
+    jump state_2006
+    .mark: state_2005
+    iinc 1
+    jump state_2003
+    .mark: state_2006
+    iinc 1
+    jump state_2008
+    .mark: state_2007
+    iinc 1
+    jump state_2005
+    .mark: state_2008
+    iinc 1
+    jump state_2010
+    .mark: state_2009
+    iinc 1
+    jump state_2007
+    .mark: state_2010
+    iinc 1
+    jump state_2012
+    .mark: state_2011
+    iinc 1
+    jump state_2009
+    .mark: state_2012
+    iinc 1
+    jump state_2014
+    .mark: state_2013
+    iinc 1
+    jump state_2011
+    .mark: state_2014
+    iinc 1
+    jump state_2016
+    .mark: state_2015
+    iinc 1
+    jump state_2013
+    .mark: state_2016
+    iinc 1
+    jump state_2018
+    .mark: state_2017
+    iinc 1
+    jump state_2015
+    .mark: state_2018
+    iinc 1
+    jump state_2020
+    .mark: state_2019
+    iinc 1
+    jump state_2017
+    .mark: state_2020
+    iinc 1
+    jump state_2022
+    .mark: state_2021
+    iinc 1
+    jump state_2019
+    .mark: state_2022
+    iinc 1
+    jump state_2024
+    .mark: state_2023
+    iinc 1
+    jump state_2021
+    .mark: state_2024
+    iinc 1
+    jump state_2026
+    .mark: state_2025
+    iinc 1
+    jump state_2023
+    .mark: state_2026
+    iinc 1
+    jump state_2028
+    .mark: state_2027
+    iinc 1
+    jump state_2025
+    .mark: state_2028
+    iinc 1
+    jump state_2030
+    .mark: state_2029
+    iinc 1
+    jump state_2027
+    .mark: state_2030
+    iinc 1
+    jump state_2032
+    .mark: state_2031
+    iinc 1
+    jump state_2029
+    .mark: state_2032
+    iinc 1
+    jump state_2034
+    .mark: state_2033
+    iinc 1
+    jump state_2031
+    .mark: state_2034
+    iinc 1
+    jump state_2036
+    .mark: state_2035
+    iinc 1
+    jump state_2033
+    .mark: state_2036
+    iinc 1
+    jump state_2038
+    .mark: state_2037
+    iinc 1
+    jump state_2035
+    .mark: state_2038
+    iinc 1
+    jump state_2040
+    .mark: state_2039
+    iinc 1
+    jump state_2037
+    .mark: state_2040
+    iinc 1
+    jump state_2042
+    .mark: state_2041
+    iinc 1
+    jump state_2039
+    .mark: state_2042
+    iinc 1
+    jump state_2044
+    .mark: state_2043
+    iinc 1
+    jump state_2041
+    .mark: state_2044
+    iinc 1
+    jump state_2046
+    .mark: state_2045
+    iinc 1
+    jump state_2043
+    .mark: state_2046
+    iinc 1
+    jump state_2048
+    .mark: state_2047
+    iinc 1
+    jump state_2045
+    .mark: state_2048
+    iinc 1
+    jump state_2050
+    .mark: state_2049
+    iinc 1
+    jump state_2047
+    .mark: state_2050
+    iinc 1
+    jump state_2052
+    .mark: state_2051
+    iinc 1
+    jump state_2049
+    .mark: state_2052
+    iinc 1
+    jump state_2054
+    .mark: state_2053
+    iinc 1
+    jump state_2051
+    .mark: state_2054
+    iinc 1
+    jump state_2056
+    .mark: state_2055
+    iinc 1
+    jump state_2053
+    .mark: state_2056
+    iinc 1
+    jump state_2058
+    .mark: state_2057
+    iinc 1
+    jump state_2055
+    .mark: state_2058
+    iinc 1
+    jump state_2060
+    .mark: state_2059
+    iinc 1
+    jump state_2057
+    .mark: state_2060
+    iinc 1
+    jump state_2062
+    .mark: state_2061
+    iinc 1
+    jump state_2059
+    .mark: state_2062
+    iinc 1
+    jump state_2064
+    .mark: state_2063
+    iinc 1
+    jump state_2061
+    .mark: state_2064
+    iinc 1
+    jump state_2066
+    .mark: state_2065
+    iinc 1
+    jump state_2063
+    .mark: state_2066
+    iinc 1
+    jump state_2068
+    .mark: state_2067
+    iinc 1
+    jump state_2065
+    .mark: state_2068
+    iinc 1
+    jump state_2070
+    .mark: state_2069
+    iinc 1
+    jump state_2067
+    .mark: state_2070
+    iinc 1
+    jump state_2072
+    .mark: state_2071
+    iinc 1
+    jump state_2069
+    .mark: state_2072
+    iinc 1
+    jump state_2074
+    .mark: state_2073
+    iinc 1
+    jump state_2071
+    .mark: state_2074
+    iinc 1
+    jump state_2076
+    .mark: state_2075
+    iinc 1
+    jump state_2073
+    .mark: state_2076
+    iinc 1
+    jump state_2078
+    .mark: state_2077
+    iinc 1
+    jump state_2075
+    .mark: state_2078
+    iinc 1
+    jump state_2080
+    .mark: state_2079
+    iinc 1
+    jump state_2077
+    .mark: state_2080
+    iinc 1
+    jump state_2082
+    .mark: state_2081
+    iinc 1
+    jump state_2079
+    .mark: state_2082
+    iinc 1
+    jump state_2084
+    .mark: state_2083
+    iinc 1
+    jump state_2081
+    .mark: state_2084
+    iinc 1
+    jump state_2086
+    .mark: state_2085
+    iinc 1
+    jump state_2083
+    .mark: state_2086
+    iinc 1
+    jump state_2088
+    .mark: state_2087
+    iinc 1
+    jump state_2085
+    .mark: state_2088
+    iinc 1
+    jump state_2090
+    .mark: state_2089
+    iinc 1
+    jump state_2087
+    .mark: state_2090
+    iinc 1
+    jump state_2092
+    .mark: state_2091
+    iinc 1
+    jump state_2089
+    .mark: state_2092
+    iinc 1
+    jump state_2094
+    .mark: state_2093
+    iinc 1
+    jump state_2091
+    .mark: state_2094
+    iinc 1
+    jump state_2096
+    .mark: state_2095
+    iinc 1
+    jump state_2093
+    .mark: state_2096
+    iinc 1
+    jump state_2098
+    .mark: state_2097
+    iinc 1
+    jump state_2095
+    .mark: state_2098
+    iinc 1
+    jump state_2100
+    .mark: state_2099
+    iinc 1
+    jump state_2097
+    .mark: state_2100
+    iinc 1
+    jump state_2102
+    .mark: state_2101
+    iinc 1
+    jump state_2099
+    .mark: state_2102
+    iinc 1
+    jump state_2104
+    .mark: state_2103
+    iinc 1
+    jump state_2101
+    .mark: state_2104
+    iinc 1
+    jump state_2106
+    .mark: state_2105
+    iinc 1
+    jump state_2103
+    .mark: state_2106
+    iinc 1
+    jump state_2108
+    .mark: state_2107
+    iinc 1
+    jump state_2105
+    .mark: state_2108
+    iinc 1
+    jump state_2110
+    .mark: state_2109
+    iinc 1
+    jump state_2107
+    .mark: state_2110
+    iinc 1
+    jump state_2112
+    .mark: state_2111
+    iinc 1
+    jump state_2109
+    .mark: state_2112
+    iinc 1
+    jump state_2114
+    .mark: state_2113
+    iinc 1
+    jump state_2111
+    .mark: state_2114
+    iinc 1
+    jump state_2116
+    .mark: state_2115
+    iinc 1
+    jump state_2113
+    .mark: state_2116
+    iinc 1
+    jump state_2118
+    .mark: state_2117
+    iinc 1
+    jump state_2115
+    .mark: state_2118
+    iinc 1
+    jump state_2120
+    .mark: state_2119
+    iinc 1
+    jump state_2117
+    .mark: state_2120
+    iinc 1
+    jump state_2122
+    .mark: state_2121
+    iinc 1
+    jump state_2119
+    .mark: state_2122
+    iinc 1
+    jump state_2124
+    .mark: state_2123
+    iinc 1
+    jump state_2121
+    .mark: state_2124
+    iinc 1
+    jump state_2126
+    .mark: state_2125
+    iinc 1
+    jump state_2123
+    .mark: state_2126
+    iinc 1
+    jump state_2128
+    .mark: state_2127
+    iinc 1
+    jump state_2125
+    .mark: state_2128
+    iinc 1
+    jump state_2130
+    .mark: state_2129
+    iinc 1
+    jump state_2127
+    .mark: state_2130
+    iinc 1
+    jump state_2132
+    .mark: state_2131
+    iinc 1
+    jump state_2129
+    .mark: state_2132
+    iinc 1
+    jump state_2134
+    .mark: state_2133
+    iinc 1
+    jump state_2131
+    .mark: state_2134
+    iinc 1
+    jump state_2136
+    .mark: state_2135
+    iinc 1
+    jump state_2133
+    .mark: state_2136
+    iinc 1
+    jump state_2138
+    .mark: state_2137
+    iinc 1
+    jump state_2135
+    .mark: state_2138
+    iinc 1
+    jump state_2140
+    .mark: state_2139
+    iinc 1
+    jump state_2137
+    .mark: state_2140
+    iinc 1
+    jump state_2142
+    .mark: state_2141
+    iinc 1
+    jump state_2139
+    .mark: state_2142
+    iinc 1
+    jump state_2144
+    .mark: state_2143
+    iinc 1
+    jump state_2141
+    .mark: state_2144
+    iinc 1
+    jump state_2146
+    .mark: state_2145
+    iinc 1
+    jump state_2143
+    .mark: state_2146
+    iinc 1
+    jump state_2148
+    .mark: state_2147
+    iinc 1
+    jump state_2145
+    .mark: state_2148
+    iinc 1
+    jump state_2150
+    .mark: state_2149
+    iinc 1
+    jump state_2147
+    .mark: state_2150
+    iinc 1
+    jump state_2152
+    .mark: state_2151
+    iinc 1
+    jump state_2149
+    .mark: state_2152
+    iinc 1
+    jump state_2154
+    .mark: state_2153
+    iinc 1
+    jump state_2151
+    .mark: state_2154
+    iinc 1
+    jump state_2156
+    .mark: state_2155
+    iinc 1
+    jump state_2153
+    .mark: state_2156
+    iinc 1
+    jump state_2158
+    .mark: state_2157
+    iinc 1
+    jump state_2155
+    .mark: state_2158
+    iinc 1
+    jump state_2160
+    .mark: state_2159
+    iinc 1
+    jump state_2157
+    .mark: state_2160
+    iinc 1
+    jump state_2162
+    .mark: state_2161
+    iinc 1
+    jump state_2159
+    .mark: state_2162
+    iinc 1
+    jump state_2164
+    .mark: state_2163
+    iinc 1
+    jump state_2161
+    .mark: state_2164
+    iinc 1
+    jump state_2166
+    .mark: state_2165
+    iinc 1
+    jump state_2163
+    .mark: state_2166
+    iinc 1
+    jump state_2168
+    .mark: state_2167
+    iinc 1
+    jump state_2165
+    .mark: state_2168
+    iinc 1
+    jump state_2170
+    .mark: state_2169
+    iinc 1
+    jump state_2167
+    .mark: state_2170
+    iinc 1
+    jump state_2172
+    .mark: state_2171
+    iinc 1
+    jump state_2169
+    .mark: state_2172
+    iinc 1
+    jump state_2174
+    .mark: state_2173
+    iinc 1
+    jump state_2171
+    .mark: state_2174
+    iinc 1
+    jump state_2176
+    .mark: state_2175
+    iinc 1
+    jump state_2173
+    .mark: state_2176
+    iinc 1
+    jump state_2178
+    .mark: state_2177
+    iinc 1
+    jump state_2175
+    .mark: state_2178
+    iinc 1
+    jump state_2180
+    .mark: state_2179
+    iinc 1
+    jump state_2177
+    .mark: state_2180
+    iinc 1
+    jump state_2182
+    .mark: state_2181
+    iinc 1
+    jump state_2179
+    .mark: state_2182
+    iinc 1
+    jump state_2184
+    .mark: state_2183
+    iinc 1
+    jump state_2181
+    .mark: state_2184
+    iinc 1
+    jump state_2186
+    .mark: state_2185
+    iinc 1
+    jump state_2183
+    .mark: state_2186
+    iinc 1
+    jump state_2188
+    .mark: state_2187
+    iinc 1
+    jump state_2185
+    .mark: state_2188
+    iinc 1
+    jump state_2190
+    .mark: state_2189
+    iinc 1
+    jump state_2187
+    .mark: state_2190
+    iinc 1
+    jump state_2192
+    .mark: state_2191
+    iinc 1
+    jump state_2189
+    .mark: state_2192
+    iinc 1
+    jump state_2194
+    .mark: state_2193
+    iinc 1
+    jump state_2191
+    .mark: state_2194
+    iinc 1
+    jump state_2196
+    .mark: state_2195
+    iinc 1
+    jump state_2193
+    .mark: state_2196
+    iinc 1
+    jump state_2198
+    .mark: state_2197
+    iinc 1
+    jump state_2195
+    .mark: state_2198
+    iinc 1
+    jump state_2200
+    .mark: state_2199
+    iinc 1
+    jump state_2197
+    .mark: state_2200
+    iinc 1
+    jump state_2202
+    .mark: state_2201
+    iinc 1
+    jump state_2199
+    .mark: state_2202
+    iinc 1
+    jump state_2204
+    .mark: state_2203
+    iinc 1
+    jump state_2201
+    .mark: state_2204
+    iinc 1
+    jump state_2206
+    .mark: state_2205
+    iinc 1
+    jump state_2203
+    .mark: state_2206
+    iinc 1
+    jump state_2208
+    .mark: state_2207
+    iinc 1
+    jump state_2205
+    .mark: state_2208
+    iinc 1
+    jump state_2210
+    .mark: state_2209
+    iinc 1
+    jump state_2207
+    .mark: state_2210
+    iinc 1
+    jump state_2212
+    .mark: state_2211
+    iinc 1
+    jump state_2209
+    .mark: state_2212
+    iinc 1
+    jump state_2214
+    .mark: state_2213
+    iinc 1
+    jump state_2211
+    .mark: state_2214
+    iinc 1
+    jump state_2216
+    .mark: state_2215
+    iinc 1
+    jump state_2213
+    .mark: state_2216
+    iinc 1
+    jump state_2218
+    .mark: state_2217
+    iinc 1
+    jump state_2215
+    .mark: state_2218
+    iinc 1
+    jump state_2220
+    .mark: state_2219
+    iinc 1
+    jump state_2217
+    .mark: state_2220
+    iinc 1
+    jump state_2222
+    .mark: state_2221
+    iinc 1
+    jump state_2219
+    .mark: state_2222
+    iinc 1
+    jump state_2224
+    .mark: state_2223
+    iinc 1
+    jump state_2221
+    .mark: state_2224
+    iinc 1
+    jump state_2226
+    .mark: state_2225
+    iinc 1
+    jump state_2223
+    .mark: state_2226
+    iinc 1
+    jump state_2228
+    .mark: state_2227
+    iinc 1
+    jump state_2225
+    .mark: state_2228
+    iinc 1
+    jump state_2230
+    .mark: state_2229
+    iinc 1
+    jump state_2227
+    .mark: state_2230
+    iinc 1
+    jump state_2232
+    .mark: state_2231
+    iinc 1
+    jump state_2229
+    .mark: state_2232
+    iinc 1
+    jump state_2234
+    .mark: state_2233
+    iinc 1
+    jump state_2231
+    .mark: state_2234
+    iinc 1
+    jump state_2236
+    .mark: state_2235
+    iinc 1
+    jump state_2233
+    .mark: state_2236
+    iinc 1
+    jump state_2238
+    .mark: state_2237
+    iinc 1
+    jump state_2235
+    .mark: state_2238
+    iinc 1
+    jump state_2240
+    .mark: state_2239
+    iinc 1
+    jump state_2237
+    .mark: state_2240
+    iinc 1
+    jump state_2242
+    .mark: state_2241
+    iinc 1
+    jump state_2239
+    .mark: state_2242
+    iinc 1
+    jump state_2244
+    .mark: state_2243
+    iinc 1
+    jump state_2241
+    .mark: state_2244
+    iinc 1
+    jump state_2246
+    .mark: state_2245
+    iinc 1
+    jump state_2243
+    .mark: state_2246
+    iinc 1
+    jump state_2248
+    .mark: state_2247
+    iinc 1
+    jump state_2245
+    .mark: state_2248
+    iinc 1
+    jump state_2250
+    .mark: state_2249
+    iinc 1
+    jump state_2247
+    .mark: state_2250
+    iinc 1
+    jump state_2252
+    .mark: state_2251
+    iinc 1
+    jump state_2249
+    .mark: state_2252
+    iinc 1
+    jump state_2254
+    .mark: state_2253
+    iinc 1
+    jump state_2251
+    .mark: state_2254
+    iinc 1
+    jump state_2256
+    .mark: state_2255
+    iinc 1
+    jump state_2253
+    .mark: state_2256
+    iinc 1
+    jump state_2258
+    .mark: state_2257
+    iinc 1
+    jump state_2255
+    .mark: state_2258
+    iinc 1
+    jump state_2260
+    .mark: state_2259
+    iinc 1
+    jump state_2257
+    .mark: state_2260
+    iinc 1
+    jump state_2262
+    .mark: state_2261
+    iinc 1
+    jump state_2259
+    .mark: state_2262
+    iinc 1
+    jump state_2264
+    .mark: state_2263
+    iinc 1
+    jump state_2261
+    .mark: state_2264
+    iinc 1
+    jump state_2266
+    .mark: state_2265
+    iinc 1
+    jump state_2263
+    .mark: state_2266
+    iinc 1
+    jump state_2268
+    .mark: state_2267
+    iinc 1
+    jump state_2265
+    .mark: state_2268
+    iinc 1
+    jump state_2270
+    .mark: state_2269
+    iinc 1
+    jump state_2267
+    .mark: state_2270
+    iinc 1
+    jump state_2272
+    .mark: state_2271
+    iinc 1
+    jump state_2269
+    .mark: state_2272
+    iinc 1
+    jump state_2274
+    .mark: state_2273
+    iinc 1
+    jump state_2271
+    .mark: state_2274
+    iinc 1
+    jump state_2276
+    .mark: state_2275
+    iinc 1
+    jump state_2273
+    .mark: state_2276
+    iinc 1
+    jump state_2278
+    .mark: state_2277
+    iinc 1
+    jump state_2275
+    .mark: state_2278
+    iinc 1
+    jump state_2280
+    .mark: state_2279
+    iinc 1
+    jump state_2277
+    .mark: state_2280
+    iinc 1
+    jump state_2282
+    .mark: state_2281
+    iinc 1
+    jump state_2279
+    .mark: state_2282
+    iinc 1
+    jump state_2284
+    .mark: state_2283
+    iinc 1
+    jump state_2281
+    .mark: state_2284
+    iinc 1
+    jump state_2286
+    .mark: state_2285
+    iinc 1
+    jump state_2283
+    .mark: state_2286
+    iinc 1
+    jump state_2288
+    .mark: state_2287
+    iinc 1
+    jump state_2285
+    .mark: state_2288
+    iinc 1
+    jump state_2290
+    .mark: state_2289
+    iinc 1
+    jump state_2287
+    .mark: state_2290
+    iinc 1
+    jump state_2292
+    .mark: state_2291
+    iinc 1
+    jump state_2289
+    .mark: state_2292
+    iinc 1
+    jump state_2294
+    .mark: state_2293
+    iinc 1
+    jump state_2291
+    .mark: state_2294
+    iinc 1
+    jump state_2296
+    .mark: state_2295
+    iinc 1
+    jump state_2293
+    .mark: state_2296
+    iinc 1
+    jump state_2298
+    .mark: state_2297
+    iinc 1
+    jump state_2295
+    .mark: state_2298
+    iinc 1
+    jump state_2300
+    .mark: state_2299
+    iinc 1
+    jump state_2297
+    .mark: state_2300
+    iinc 1
+    jump state_2302
+    .mark: state_2301
+    iinc 1
+    jump state_2299
+    .mark: state_2302
+    iinc 1
+    jump state_2304
+    .mark: state_2303
+    iinc 1
+    jump state_2301
+    .mark: state_2304
+    iinc 1
+    jump state_2306
+    .mark: state_2305
+    iinc 1
+    jump state_2303
+    .mark: state_2306
+    iinc 1
+    jump state_2308
+    .mark: state_2307
+    iinc 1
+    jump state_2305
+    .mark: state_2308
+    iinc 1
+    jump state_2310
+    .mark: state_2309
+    iinc 1
+    jump state_2307
+    .mark: state_2310
+    iinc 1
+    jump state_2312
+    .mark: state_2311
+    iinc 1
+    jump state_2309
+    .mark: state_2312
+    iinc 1
+    jump state_2314
+    .mark: state_2313
+    iinc 1
+    jump state_2311
+    .mark: state_2314
+    iinc 1
+    jump state_2316
+    .mark: state_2315
+    iinc 1
+    jump state_2313
+    .mark: state_2316
+    iinc 1
+    jump state_2318
+    .mark: state_2317
+    iinc 1
+    jump state_2315
+    .mark: state_2318
+    iinc 1
+    jump state_2320
+    .mark: state_2319
+    iinc 1
+    jump state_2317
+    .mark: state_2320
+    iinc 1
+    jump state_2322
+    .mark: state_2321
+    iinc 1
+    jump state_2319
+    .mark: state_2322
+    iinc 1
+    jump state_2324
+    .mark: state_2323
+    iinc 1
+    jump state_2321
+    .mark: state_2324
+    iinc 1
+    jump state_2326
+    .mark: state_2325
+    iinc 1
+    jump state_2323
+    .mark: state_2326
+    iinc 1
+    jump state_2328
+    .mark: state_2327
+    iinc 1
+    jump state_2325
+    .mark: state_2328
+    iinc 1
+    jump state_2330
+    .mark: state_2329
+    iinc 1
+    jump state_2327
+    .mark: state_2330
+    iinc 1
+    jump state_2332
+    .mark: state_2331
+    iinc 1
+    jump state_2329
+    .mark: state_2332
+    iinc 1
+    jump state_2334
+    .mark: state_2333
+    iinc 1
+    jump state_2331
+    .mark: state_2334
+    iinc 1
+    jump state_2336
+    .mark: state_2335
+    iinc 1
+    jump state_2333
+    .mark: state_2336
+    iinc 1
+    jump state_2338
+    .mark: state_2337
+    iinc 1
+    jump state_2335
+    .mark: state_2338
+    iinc 1
+    jump state_2340
+    .mark: state_2339
+    iinc 1
+    jump state_2337
+    .mark: state_2340
+    iinc 1
+    jump state_2342
+    .mark: state_2341
+    iinc 1
+    jump state_2339
+    .mark: state_2342
+    iinc 1
+    jump state_2344
+    .mark: state_2343
+    iinc 1
+    jump state_2341
+    .mark: state_2344
+    iinc 1
+    jump state_2346
+    .mark: state_2345
+    iinc 1
+    jump state_2343
+    .mark: state_2346
+    iinc 1
+    jump state_2348
+    .mark: state_2347
+    iinc 1
+    jump state_2345
+    .mark: state_2348
+    iinc 1
+    jump state_2350
+    .mark: state_2349
+    iinc 1
+    jump state_2347
+    .mark: state_2350
+    iinc 1
+    jump state_2352
+    .mark: state_2351
+    iinc 1
+    jump state_2349
+    .mark: state_2352
+    iinc 1
+    jump state_2354
+    .mark: state_2353
+    iinc 1
+    jump state_2351
+    .mark: state_2354
+    iinc 1
+    jump state_2356
+    .mark: state_2355
+    iinc 1
+    jump state_2353
+    .mark: state_2356
+    iinc 1
+    jump state_2358
+    .mark: state_2357
+    iinc 1
+    jump state_2355
+    .mark: state_2358
+    iinc 1
+    jump state_2360
+    .mark: state_2359
+    iinc 1
+    jump state_2357
+    .mark: state_2360
+    iinc 1
+    jump state_2362
+    .mark: state_2361
+    iinc 1
+    jump state_2359
+    .mark: state_2362
+    iinc 1
+    jump state_2364
+    .mark: state_2363
+    iinc 1
+    jump state_2361
+    .mark: state_2364
+    iinc 1
+    jump state_2366
+    .mark: state_2365
+    iinc 1
+    jump state_2363
+    .mark: state_2366
+    iinc 1
+    jump state_2368
+    .mark: state_2367
+    iinc 1
+    jump state_2365
+    .mark: state_2368
+    iinc 1
+    jump state_2370
+    .mark: state_2369
+    iinc 1
+    jump state_2367
+    .mark: state_2370
+    iinc 1
+    jump state_2372
+    .mark: state_2371
+    iinc 1
+    jump state_2369
+    .mark: state_2372
+    iinc 1
+    jump state_2374
+    .mark: state_2373
+    iinc 1
+    jump state_2371
+    .mark: state_2374
+    iinc 1
+    jump state_2376
+    .mark: state_2375
+    iinc 1
+    jump state_2373
+    .mark: state_2376
+    iinc 1
+    jump state_2378
+    .mark: state_2377
+    iinc 1
+    jump state_2375
+    .mark: state_2378
+    iinc 1
+    jump state_2380
+    .mark: state_2379
+    iinc 1
+    jump state_2377
+    .mark: state_2380
+    iinc 1
+    jump state_2382
+    .mark: state_2381
+    iinc 1
+    jump state_2379
+    .mark: state_2382
+    iinc 1
+    jump state_2384
+    .mark: state_2383
+    iinc 1
+    jump state_2381
+    .mark: state_2384
+    iinc 1
+    jump state_2386
+    .mark: state_2385
+    iinc 1
+    jump state_2383
+    .mark: state_2386
+    iinc 1
+    jump state_2388
+    .mark: state_2387
+    iinc 1
+    jump state_2385
+    .mark: state_2388
+    iinc 1
+    jump state_2390
+    .mark: state_2389
+    iinc 1
+    jump state_2387
+    .mark: state_2390
+    iinc 1
+    jump state_2392
+    .mark: state_2391
+    iinc 1
+    jump state_2389
+    .mark: state_2392
+    iinc 1
+    jump state_2394
+    .mark: state_2393
+    iinc 1
+    jump state_2391
+    .mark: state_2394
+    iinc 1
+    jump state_2396
+    .mark: state_2395
+    iinc 1
+    jump state_2393
+    .mark: state_2396
+    iinc 1
+    jump state_2398
+    .mark: state_2397
+    iinc 1
+    jump state_2395
+    .mark: state_2398
+    iinc 1
+    jump state_2400
+    .mark: state_2399
+    iinc 1
+    jump state_2397
+    .mark: state_2400
+    iinc 1
+    jump state_2402
+    .mark: state_2401
+    iinc 1
+    jump state_2399
+    .mark: state_2402
+    iinc 1
+    jump state_2404
+    .mark: state_2403
+    iinc 1
+    jump state_2401
+    .mark: state_2404
+    iinc 1
+    jump state_2406
+    .mark: state_2405
+    iinc 1
+    jump state_2403
+    .mark: state_2406
+    iinc 1
+    jump state_2408
+    .mark: state_2407
+    iinc 1
+    jump state_2405
+    .mark: state_2408
+    iinc 1
+    jump state_2410
+    .mark: state_2409
+    iinc 1
+    jump state_2407
+    .mark: state_2410
+    iinc 1
+    jump state_2412
+    .mark: state_2411
+    iinc 1
+    jump state_2409
+    .mark: state_2412
+    iinc 1
+    jump state_2414
+    .mark: state_2413
+    iinc 1
+    jump state_2411
+    .mark: state_2414
+    iinc 1
+    jump state_2416
+    .mark: state_2415
+    iinc 1
+    jump state_2413
+    .mark: state_2416
+    iinc 1
+    jump state_2418
+    .mark: state_2417
+    iinc 1
+    jump state_2415
+    .mark: state_2418
+    iinc 1
+    jump state_2420
+    .mark: state_2419
+    iinc 1
+    jump state_2417
+    .mark: state_2420
+    iinc 1
+    jump state_2422
+    .mark: state_2421
+    iinc 1
+    jump state_2419
+    .mark: state_2422
+    iinc 1
+    jump state_2424
+    .mark: state_2423
+    iinc 1
+    jump state_2421
+    .mark: state_2424
+    iinc 1
+    jump state_2426
+    .mark: state_2425
+    iinc 1
+    jump state_2423
+    .mark: state_2426
+    iinc 1
+    jump state_2428
+    .mark: state_2427
+    iinc 1
+    jump state_2425
+    .mark: state_2428
+    iinc 1
+    jump state_2430
+    .mark: state_2429
+    iinc 1
+    jump state_2427
+    .mark: state_2430
+    iinc 1
+    jump state_2432
+    .mark: state_2431
+    iinc 1
+    jump state_2429
+    .mark: state_2432
+    iinc 1
+    jump state_2434
+    .mark: state_2433
+    iinc 1
+    jump state_2431
+    .mark: state_2434
+    iinc 1
+    jump state_2436
+    .mark: state_2435
+    iinc 1
+    jump state_2433
+    .mark: state_2436
+    iinc 1
+    jump state_2438
+    .mark: state_2437
+    iinc 1
+    jump state_2435
+    .mark: state_2438
+    iinc 1
+    jump state_2440
+    .mark: state_2439
+    iinc 1
+    jump state_2437
+    .mark: state_2440
+    iinc 1
+    jump state_2442
+    .mark: state_2441
+    iinc 1
+    jump state_2439
+    .mark: state_2442
+    iinc 1
+    jump state_2444
+    .mark: state_2443
+    iinc 1
+    jump state_2441
+    .mark: state_2444
+    iinc 1
+    jump state_2446
+    .mark: state_2445
+    iinc 1
+    jump state_2443
+    .mark: state_2446
+    iinc 1
+    jump state_2448
+    .mark: state_2447
+    iinc 1
+    jump state_2445
+    .mark: state_2448
+    iinc 1
+    jump state_2450
+    .mark: state_2449
+    iinc 1
+    jump state_2447
+    .mark: state_2450
+    iinc 1
+    jump state_2452
+    .mark: state_2451
+    iinc 1
+    jump state_2449
+    .mark: state_2452
+    iinc 1
+    jump state_2454
+    .mark: state_2453
+    iinc 1
+    jump state_2451
+    .mark: state_2454
+    iinc 1
+    jump state_2456
+    .mark: state_2455
+    iinc 1
+    jump state_2453
+    .mark: state_2456
+    iinc 1
+    jump state_2458
+    .mark: state_2457
+    iinc 1
+    jump state_2455
+    .mark: state_2458
+    iinc 1
+    jump state_2460
+    .mark: state_2459
+    iinc 1
+    jump state_2457
+    .mark: state_2460
+    iinc 1
+    jump state_2462
+    .mark: state_2461
+    iinc 1
+    jump state_2459
+    .mark: state_2462
+    iinc 1
+    jump state_2464
+    .mark: state_2463
+    iinc 1
+    jump state_2461
+    .mark: state_2464
+    iinc 1
+    jump state_2466
+    .mark: state_2465
+    iinc 1
+    jump state_2463
+    .mark: state_2466
+    iinc 1
+    jump state_2468
+    .mark: state_2467
+    iinc 1
+    jump state_2465
+    .mark: state_2468
+    iinc 1
+    jump state_2470
+    .mark: state_2469
+    iinc 1
+    jump state_2467
+    .mark: state_2470
+    iinc 1
+    jump state_2472
+    .mark: state_2471
+    iinc 1
+    jump state_2469
+    .mark: state_2472
+    iinc 1
+    jump state_2474
+    .mark: state_2473
+    iinc 1
+    jump state_2471
+    .mark: state_2474
+    iinc 1
+    jump state_2476
+    .mark: state_2475
+    iinc 1
+    jump state_2473
+    .mark: state_2476
+    iinc 1
+    jump state_2478
+    .mark: state_2477
+    iinc 1
+    jump state_2475
+    .mark: state_2478
+    iinc 1
+    jump state_2480
+    .mark: state_2479
+    iinc 1
+    jump state_2477
+    .mark: state_2480
+    iinc 1
+    jump state_2482
+    .mark: state_2481
+    iinc 1
+    jump state_2479
+    .mark: state_2482
+    iinc 1
+    jump state_2484
+    .mark: state_2483
+    iinc 1
+    jump state_2481
+    .mark: state_2484
+    iinc 1
+    jump state_2486
+    .mark: state_2485
+    iinc 1
+    jump state_2483
+    .mark: state_2486
+    iinc 1
+    jump state_2488
+    .mark: state_2487
+    iinc 1
+    jump state_2485
+    .mark: state_2488
+    iinc 1
+    jump state_2490
+    .mark: state_2489
+    iinc 1
+    jump state_2487
+    .mark: state_2490
+    iinc 1
+    jump state_2492
+    .mark: state_2491
+    iinc 1
+    jump state_2489
+    .mark: state_2492
+    iinc 1
+    jump state_2494
+    .mark: state_2493
+    iinc 1
+    jump state_2491
+    .mark: state_2494
+    iinc 1
+    jump state_2496
+    .mark: state_2495
+    iinc 1
+    jump state_2493
+    .mark: state_2496
+    iinc 1
+    jump state_2498
+    .mark: state_2497
+    iinc 1
+    jump state_2495
+    .mark: state_2498
+    iinc 1
+    jump state_2500
+    .mark: state_2499
+    iinc 1
+    jump state_2497
+    .mark: state_2500
+    iinc 1
+    jump state_2502
+    .mark: state_2501
+    iinc 1
+    jump state_2499
+    .mark: state_2502
+    iinc 1
+    jump state_2504
+    .mark: state_2503
+    iinc 1
+    jump state_2501
+    .mark: state_2504
+    iinc 1
+    jump state_2506
+    .mark: state_2505
+    iinc 1
+    jump state_2503
+    .mark: state_2506
+    iinc 1
+    jump state_2508
+    .mark: state_2507
+    iinc 1
+    jump state_2505
+    .mark: state_2508
+    iinc 1
+    jump state_2510
+    .mark: state_2509
+    iinc 1
+    jump state_2507
+    .mark: state_2510
+    iinc 1
+    jump state_2512
+    .mark: state_2511
+    iinc 1
+    jump state_2509
+    .mark: state_2512
+    iinc 1
+    jump state_2514
+    .mark: state_2513
+    iinc 1
+    jump state_2511
+    .mark: state_2514
+    iinc 1
+    jump state_2516
+    .mark: state_2515
+    iinc 1
+    jump state_2513
+    .mark: state_2516
+    iinc 1
+    jump state_2518
+    .mark: state_2517
+    iinc 1
+    jump state_2515
+    .mark: state_2518
+    iinc 1
+    jump state_2520
+    .mark: state_2519
+    iinc 1
+    jump state_2517
+    .mark: state_2520
+    iinc 1
+    jump state_2522
+    .mark: state_2521
+    iinc 1
+    jump state_2519
+    .mark: state_2522
+    iinc 1
+    jump state_2524
+    .mark: state_2523
+    iinc 1
+    jump state_2521
+    .mark: state_2524
+    iinc 1
+    jump state_2526
+    .mark: state_2525
+    iinc 1
+    jump state_2523
+    .mark: state_2526
+    iinc 1
+    jump state_2528
+    .mark: state_2527
+    iinc 1
+    jump state_2525
+    .mark: state_2528
+    iinc 1
+    jump state_2530
+    .mark: state_2529
+    iinc 1
+    jump state_2527
+    .mark: state_2530
+    iinc 1
+    jump state_2532
+    .mark: state_2531
+    iinc 1
+    jump state_2529
+    .mark: state_2532
+    iinc 1
+    jump state_2534
+    .mark: state_2533
+    iinc 1
+    jump state_2531
+    .mark: state_2534
+    iinc 1
+    jump state_2536
+    .mark: state_2535
+    iinc 1
+    jump state_2533
+    .mark: state_2536
+    iinc 1
+    jump state_2538
+    .mark: state_2537
+    iinc 1
+    jump state_2535
+    .mark: state_2538
+    iinc 1
+    jump state_2540
+    .mark: state_2539
+    iinc 1
+    jump state_2537
+    .mark: state_2540
+    iinc 1
+    jump state_2542
+    .mark: state_2541
+    iinc 1
+    jump state_2539
+    .mark: state_2542
+    iinc 1
+    jump state_2544
+    .mark: state_2543
+    iinc 1
+    jump state_2541
+    .mark: state_2544
+    iinc 1
+    jump state_2546
+    .mark: state_2545
+    iinc 1
+    jump state_2543
+    .mark: state_2546
+    iinc 1
+    jump state_2548
+    .mark: state_2547
+    iinc 1
+    jump state_2545
+    .mark: state_2548
+    iinc 1
+    jump state_2550
+    .mark: state_2549
+    iinc 1
+    jump state_2547
+    .mark: state_2550
+    iinc 1
+    jump state_2552
+    .mark: state_2551
+    iinc 1
+    jump state_2549
+    .mark: state_2552
+    iinc 1
+    jump state_2554
+    .mark: state_2553
+    iinc 1
+    jump state_2551
+    .mark: state_2554
+    iinc 1
+    jump state_2556
+    .mark: state_2555
+    iinc 1
+    jump state_2553
+    .mark: state_2556
+    iinc 1
+    jump state_2558
+    .mark: state_2557
+    iinc 1
+    jump state_2555
+    .mark: state_2558
+    iinc 1
+    jump state_2560
+    .mark: state_2559
+    iinc 1
+    jump state_2557
+    .mark: state_2560
+    iinc 1
+    jump state_2562
+    .mark: state_2561
+    iinc 1
+    jump state_2559
+    .mark: state_2562
+    iinc 1
+    jump state_2564
+    .mark: state_2563
+    iinc 1
+    jump state_2561
+    .mark: state_2564
+    iinc 1
+    jump state_2566
+    .mark: state_2565
+    iinc 1
+    jump state_2563
+    .mark: state_2566
+    iinc 1
+    jump state_2568
+    .mark: state_2567
+    iinc 1
+    jump state_2565
+    .mark: state_2568
+    iinc 1
+    jump state_2570
+    .mark: state_2569
+    iinc 1
+    jump state_2567
+    .mark: state_2570
+    iinc 1
+    jump state_2572
+    .mark: state_2571
+    iinc 1
+    jump state_2569
+    .mark: state_2572
+    iinc 1
+    jump state_2574
+    .mark: state_2573
+    iinc 1
+    jump state_2571
+    .mark: state_2574
+    iinc 1
+    jump state_2576
+    .mark: state_2575
+    iinc 1
+    jump state_2573
+    .mark: state_2576
+    iinc 1
+    jump state_2578
+    .mark: state_2577
+    iinc 1
+    jump state_2575
+    .mark: state_2578
+    iinc 1
+    jump state_2580
+    .mark: state_2579
+    iinc 1
+    jump state_2577
+    .mark: state_2580
+    iinc 1
+    jump state_2582
+    .mark: state_2581
+    iinc 1
+    jump state_2579
+    .mark: state_2582
+    iinc 1
+    jump state_2584
+    .mark: state_2583
+    iinc 1
+    jump state_2581
+    .mark: state_2584
+    iinc 1
+    jump state_2586
+    .mark: state_2585
+    iinc 1
+    jump state_2583
+    .mark: state_2586
+    iinc 1
+    jump state_2588
+    .mark: state_2587
+    iinc 1
+    jump state_2585
+    .mark: state_2588
+    iinc 1
+    jump state_2590
+    .mark: state_2589
+    iinc 1
+    jump state_2587
+    .mark: state_2590
+    iinc 1
+    jump state_2592
+    .mark: state_2591
+    iinc 1
+    jump state_2589
+    .mark: state_2592
+    iinc 1
+    jump state_2594
+    .mark: state_2593
+    iinc 1
+    jump state_2591
+    .mark: state_2594
+    iinc 1
+    jump state_2596
+    .mark: state_2595
+    iinc 1
+    jump state_2593
+    .mark: state_2596
+    iinc 1
+    jump state_2598
+    .mark: state_2597
+    iinc 1
+    jump state_2595
+    .mark: state_2598
+    iinc 1
+    jump state_2600
+    .mark: state_2599
+    iinc 1
+    jump state_2597
+    .mark: state_2600
+    iinc 1
+    jump state_2602
+    .mark: state_2601
+    iinc 1
+    jump state_2599
+    .mark: state_2602
+    iinc 1
+    jump state_2604
+    .mark: state_2603
+    iinc 1
+    jump state_2601
+    .mark: state_2604
+    iinc 1
+    jump state_2606
+    .mark: state_2605
+    iinc 1
+    jump state_2603
+    .mark: state_2606
+    iinc 1
+    jump state_2608
+    .mark: state_2607
+    iinc 1
+    jump state_2605
+    .mark: state_2608
+    iinc 1
+    jump state_2610
+    .mark: state_2609
+    iinc 1
+    jump state_2607
+    .mark: state_2610
+    iinc 1
+    jump state_2612
+    .mark: state_2611
+    iinc 1
+    jump state_2609
+    .mark: state_2612
+    iinc 1
+    jump state_2614
+    .mark: state_2613
+    iinc 1
+    jump state_2611
+    .mark: state_2614
+    iinc 1
+    jump state_2616
+    .mark: state_2615
+    iinc 1
+    jump state_2613
+    .mark: state_2616
+    iinc 1
+    jump state_2618
+    .mark: state_2617
+    iinc 1
+    jump state_2615
+    .mark: state_2618
+    iinc 1
+    jump state_2620
+    .mark: state_2619
+    iinc 1
+    jump state_2617
+    .mark: state_2620
+    iinc 1
+    jump state_2622
+    .mark: state_2621
+    iinc 1
+    jump state_2619
+    .mark: state_2622
+    iinc 1
+    jump state_2624
+    .mark: state_2623
+    iinc 1
+    jump state_2621
+    .mark: state_2624
+    iinc 1
+    jump state_2626
+    .mark: state_2625
+    iinc 1
+    jump state_2623
+    .mark: state_2626
+    iinc 1
+    jump state_2628
+    .mark: state_2627
+    iinc 1
+    jump state_2625
+    .mark: state_2628
+    iinc 1
+    jump state_2630
+    .mark: state_2629
+    iinc 1
+    jump state_2627
+    .mark: state_2630
+    iinc 1
+    jump state_2632
+    .mark: state_2631
+    iinc 1
+    jump state_2629
+    .mark: state_2632
+    iinc 1
+    jump state_2634
+    .mark: state_2633
+    iinc 1
+    jump state_2631
+    .mark: state_2634
+    iinc 1
+    jump state_2636
+    .mark: state_2635
+    iinc 1
+    jump state_2633
+    .mark: state_2636
+    iinc 1
+    jump state_2638
+    .mark: state_2637
+    iinc 1
+    jump state_2635
+    .mark: state_2638
+    iinc 1
+    jump state_2640
+    .mark: state_2639
+    iinc 1
+    jump state_2637
+    .mark: state_2640
+    iinc 1
+    jump state_2642
+    .mark: state_2641
+    iinc 1
+    jump state_2639
+    .mark: state_2642
+    iinc 1
+    jump state_2644
+    .mark: state_2643
+    iinc 1
+    jump state_2641
+    .mark: state_2644
+    iinc 1
+    jump state_2646
+    .mark: state_2645
+    iinc 1
+    jump state_2643
+    .mark: state_2646
+    iinc 1
+    jump state_2648
+    .mark: state_2647
+    iinc 1
+    jump state_2645
+    .mark: state_2648
+    iinc 1
+    jump state_2650
+    .mark: state_2649
+    iinc 1
+    jump state_2647
+    .mark: state_2650
+    iinc 1
+    jump state_2652
+    .mark: state_2651
+    iinc 1
+    jump state_2649
+    .mark: state_2652
+    iinc 1
+    jump state_2654
+    .mark: state_2653
+    iinc 1
+    jump state_2651
+    .mark: state_2654
+    iinc 1
+    jump state_2656
+    .mark: state_2655
+    iinc 1
+    jump state_2653
+    .mark: state_2656
+    iinc 1
+    jump state_2658
+    .mark: state_2657
+    iinc 1
+    jump state_2655
+    .mark: state_2658
+    iinc 1
+    jump state_2660
+    .mark: state_2659
+    iinc 1
+    jump state_2657
+    .mark: state_2660
+    iinc 1
+    jump state_2662
+    .mark: state_2661
+    iinc 1
+    jump state_2659
+    .mark: state_2662
+    iinc 1
+    jump state_2664
+    .mark: state_2663
+    iinc 1
+    jump state_2661
+    .mark: state_2664
+    iinc 1
+    jump state_2666
+    .mark: state_2665
+    iinc 1
+    jump state_2663
+    .mark: state_2666
+    iinc 1
+    jump state_2668
+    .mark: state_2667
+    iinc 1
+    jump state_2665
+    .mark: state_2668
+    iinc 1
+    jump state_2670
+    .mark: state_2669
+    iinc 1
+    jump state_2667
+    .mark: state_2670
+    iinc 1
+    jump state_2672
+    .mark: state_2671
+    iinc 1
+    jump state_2669
+    .mark: state_2672
+    iinc 1
+    jump state_2674
+    .mark: state_2673
+    iinc 1
+    jump state_2671
+    .mark: state_2674
+    iinc 1
+    jump state_2676
+    .mark: state_2675
+    iinc 1
+    jump state_2673
+    .mark: state_2676
+    iinc 1
+    jump state_2678
+    .mark: state_2677
+    iinc 1
+    jump state_2675
+    .mark: state_2678
+    iinc 1
+    jump state_2680
+    .mark: state_2679
+    iinc 1
+    jump state_2677
+    .mark: state_2680
+    iinc 1
+    jump state_2682
+    .mark: state_2681
+    iinc 1
+    jump state_2679
+    .mark: state_2682
+    iinc 1
+    jump state_2684
+    .mark: state_2683
+    iinc 1
+    jump state_2681
+    .mark: state_2684
+    iinc 1
+    jump state_2686
+    .mark: state_2685
+    iinc 1
+    jump state_2683
+    .mark: state_2686
+    iinc 1
+    jump state_2688
+    .mark: state_2687
+    iinc 1
+    jump state_2685
+    .mark: state_2688
+    iinc 1
+    jump state_2690
+    .mark: state_2689
+    iinc 1
+    jump state_2687
+    .mark: state_2690
+    iinc 1
+    jump state_2692
+    .mark: state_2691
+    iinc 1
+    jump state_2689
+    .mark: state_2692
+    iinc 1
+    jump state_2694
+    .mark: state_2693
+    iinc 1
+    jump state_2691
+    .mark: state_2694
+    iinc 1
+    jump state_2696
+    .mark: state_2695
+    iinc 1
+    jump state_2693
+    .mark: state_2696
+    iinc 1
+    jump state_2698
+    .mark: state_2697
+    iinc 1
+    jump state_2695
+    .mark: state_2698
+    iinc 1
+    jump state_2700
+    .mark: state_2699
+    iinc 1
+    jump state_2697
+    .mark: state_2700
+    iinc 1
+    jump state_2702
+    .mark: state_2701
+    iinc 1
+    jump state_2699
+    .mark: state_2702
+    iinc 1
+    jump state_2704
+    .mark: state_2703
+    iinc 1
+    jump state_2701
+    .mark: state_2704
+    iinc 1
+    jump state_2706
+    .mark: state_2705
+    iinc 1
+    jump state_2703
+    .mark: state_2706
+    iinc 1
+    jump state_2708
+    .mark: state_2707
+    iinc 1
+    jump state_2705
+    .mark: state_2708
+    iinc 1
+    jump state_2710
+    .mark: state_2709
+    iinc 1
+    jump state_2707
+    .mark: state_2710
+    iinc 1
+    jump state_2712
+    .mark: state_2711
+    iinc 1
+    jump state_2709
+    .mark: state_2712
+    iinc 1
+    jump state_2714
+    .mark: state_2713
+    iinc 1
+    jump state_2711
+    .mark: state_2714
+    iinc 1
+    jump state_2716
+    .mark: state_2715
+    iinc 1
+    jump state_2713
+    .mark: state_2716
+    iinc 1
+    jump state_2718
+    .mark: state_2717
+    iinc 1
+    jump state_2715
+    .mark: state_2718
+    iinc 1
+    jump state_2720
+    .mark: state_2719
+    iinc 1
+    jump state_2717
+    .mark: state_2720
+    iinc 1
+    jump state_2722
+    .mark: state_2721
+    iinc 1
+    jump state_2719
+    .mark: state_2722
+    iinc 1
+    jump state_2724
+    .mark: state_2723
+    iinc 1
+    jump state_2721
+    .mark: state_2724
+    iinc 1
+    jump state_2726
+    .mark: state_2725
+    iinc 1
+    jump state_2723
+    .mark: state_2726
+    iinc 1
+    jump state_2728
+    .mark: state_2727
+    iinc 1
+    jump state_2725
+    .mark: state_2728
+    iinc 1
+    jump state_2730
+    .mark: state_2729
+    iinc 1
+    jump state_2727
+    .mark: state_2730
+    iinc 1
+    jump state_2732
+    .mark: state_2731
+    iinc 1
+    jump state_2729
+    .mark: state_2732
+    iinc 1
+    jump state_2734
+    .mark: state_2733
+    iinc 1
+    jump state_2731
+    .mark: state_2734
+    iinc 1
+    jump state_2736
+    .mark: state_2735
+    iinc 1
+    jump state_2733
+    .mark: state_2736
+    iinc 1
+    jump state_2738
+    .mark: state_2737
+    iinc 1
+    jump state_2735
+    .mark: state_2738
+    iinc 1
+    jump state_2740
+    .mark: state_2739
+    iinc 1
+    jump state_2737
+    .mark: state_2740
+    iinc 1
+    jump state_2742
+    .mark: state_2741
+    iinc 1
+    jump state_2739
+    .mark: state_2742
+    iinc 1
+    jump state_2744
+    .mark: state_2743
+    iinc 1
+    jump state_2741
+    .mark: state_2744
+    iinc 1
+    jump state_2746
+    .mark: state_2745
+    iinc 1
+    jump state_2743
+    .mark: state_2746
+    iinc 1
+    jump state_2748
+    .mark: state_2747
+    iinc 1
+    jump state_2745
+    .mark: state_2748
+    iinc 1
+    jump state_2750
+    .mark: state_2749
+    iinc 1
+    jump state_2747
+    .mark: state_2750
+    iinc 1
+    jump state_2752
+    .mark: state_2751
+    iinc 1
+    jump state_2749
+    .mark: state_2752
+    iinc 1
+    jump state_2754
+    .mark: state_2753
+    iinc 1
+    jump state_2751
+    .mark: state_2754
+    iinc 1
+    jump state_2756
+    .mark: state_2755
+    iinc 1
+    jump state_2753
+    .mark: state_2756
+    iinc 1
+    jump state_2758
+    .mark: state_2757
+    iinc 1
+    jump state_2755
+    .mark: state_2758
+    iinc 1
+    jump state_2760
+    .mark: state_2759
+    iinc 1
+    jump state_2757
+    .mark: state_2760
+    iinc 1
+    jump state_2762
+    .mark: state_2761
+    iinc 1
+    jump state_2759
+    .mark: state_2762
+    iinc 1
+    jump state_2764
+    .mark: state_2763
+    iinc 1
+    jump state_2761
+    .mark: state_2764
+    iinc 1
+    jump state_2766
+    .mark: state_2765
+    iinc 1
+    jump state_2763
+    .mark: state_2766
+    iinc 1
+    jump state_2768
+    .mark: state_2767
+    iinc 1
+    jump state_2765
+    .mark: state_2768
+    iinc 1
+    jump state_2770
+    .mark: state_2769
+    iinc 1
+    jump state_2767
+    .mark: state_2770
+    iinc 1
+    jump state_2772
+    .mark: state_2771
+    iinc 1
+    jump state_2769
+    .mark: state_2772
+    iinc 1
+    jump state_2774
+    .mark: state_2773
+    iinc 1
+    jump state_2771
+    .mark: state_2774
+    iinc 1
+    jump state_2776
+    .mark: state_2775
+    iinc 1
+    jump state_2773
+    .mark: state_2776
+    iinc 1
+    jump state_2778
+    .mark: state_2777
+    iinc 1
+    jump state_2775
+    .mark: state_2778
+    iinc 1
+    jump state_2780
+    .mark: state_2779
+    iinc 1
+    jump state_2777
+    .mark: state_2780
+    iinc 1
+    jump state_2782
+    .mark: state_2781
+    iinc 1
+    jump state_2779
+    .mark: state_2782
+    iinc 1
+    jump state_2784
+    .mark: state_2783
+    iinc 1
+    jump state_2781
+    .mark: state_2784
+    iinc 1
+    jump state_2786
+    .mark: state_2785
+    iinc 1
+    jump state_2783
+    .mark: state_2786
+    iinc 1
+    jump state_2788
+    .mark: state_2787
+    iinc 1
+    jump state_2785
+    .mark: state_2788
+    iinc 1
+    jump state_2790
+    .mark: state_2789
+    iinc 1
+    jump state_2787
+    .mark: state_2790
+    iinc 1
+    jump state_2792
+    .mark: state_2791
+    iinc 1
+    jump state_2789
+    .mark: state_2792
+    iinc 1
+    jump state_2794
+    .mark: state_2793
+    iinc 1
+    jump state_2791
+    .mark: state_2794
+    iinc 1
+    jump state_2796
+    .mark: state_2795
+    iinc 1
+    jump state_2793
+    .mark: state_2796
+    iinc 1
+    jump state_2798
+    .mark: state_2797
+    iinc 1
+    jump state_2795
+    .mark: state_2798
+    iinc 1
+    jump state_2800
+    .mark: state_2799
+    iinc 1
+    jump state_2797
+    .mark: state_2800
+    iinc 1
+    jump state_2802
+    .mark: state_2801
+    iinc 1
+    jump state_2799
+    .mark: state_2802
+    iinc 1
+    jump state_2804
+    .mark: state_2803
+    iinc 1
+    jump state_2801
+    .mark: state_2804
+    iinc 1
+    jump state_2806
+    .mark: state_2805
+    iinc 1
+    jump state_2803
+    .mark: state_2806
+    iinc 1
+    jump state_2808
+    .mark: state_2807
+    iinc 1
+    jump state_2805
+    .mark: state_2808
+    iinc 1
+    jump state_2810
+    .mark: state_2809
+    iinc 1
+    jump state_2807
+    .mark: state_2810
+    iinc 1
+    jump state_2812
+    .mark: state_2811
+    iinc 1
+    jump state_2809
+    .mark: state_2812
+    iinc 1
+    jump state_2814
+    .mark: state_2813
+    iinc 1
+    jump state_2811
+    .mark: state_2814
+    iinc 1
+    jump state_2816
+    .mark: state_2815
+    iinc 1
+    jump state_2813
+    .mark: state_2816
+    iinc 1
+    jump state_2818
+    .mark: state_2817
+    iinc 1
+    jump state_2815
+    .mark: state_2818
+    iinc 1
+    jump state_2820
+    .mark: state_2819
+    iinc 1
+    jump state_2817
+    .mark: state_2820
+    iinc 1
+    jump state_2822
+    .mark: state_2821
+    iinc 1
+    jump state_2819
+    .mark: state_2822
+    iinc 1
+    jump state_2824
+    .mark: state_2823
+    iinc 1
+    jump state_2821
+    .mark: state_2824
+    iinc 1
+    jump state_2826
+    .mark: state_2825
+    iinc 1
+    jump state_2823
+    .mark: state_2826
+    iinc 1
+    jump state_2828
+    .mark: state_2827
+    iinc 1
+    jump state_2825
+    .mark: state_2828
+    iinc 1
+    jump state_2830
+    .mark: state_2829
+    iinc 1
+    jump state_2827
+    .mark: state_2830
+    iinc 1
+    jump state_2832
+    .mark: state_2831
+    iinc 1
+    jump state_2829
+    .mark: state_2832
+    iinc 1
+    jump state_2834
+    .mark: state_2833
+    iinc 1
+    jump state_2831
+    .mark: state_2834
+    iinc 1
+    jump state_2836
+    .mark: state_2835
+    iinc 1
+    jump state_2833
+    .mark: state_2836
+    iinc 1
+    jump state_2838
+    .mark: state_2837
+    iinc 1
+    jump state_2835
+    .mark: state_2838
+    iinc 1
+    jump state_2840
+    .mark: state_2839
+    iinc 1
+    jump state_2837
+    .mark: state_2840
+    iinc 1
+    jump state_2842
+    .mark: state_2841
+    iinc 1
+    jump state_2839
+    .mark: state_2842
+    iinc 1
+    jump state_2844
+    .mark: state_2843
+    iinc 1
+    jump state_2841
+    .mark: state_2844
+    iinc 1
+    jump state_2846
+    .mark: state_2845
+    iinc 1
+    jump state_2843
+    .mark: state_2846
+    iinc 1
+    jump state_2848
+    .mark: state_2847
+    iinc 1
+    jump state_2845
+    .mark: state_2848
+    iinc 1
+    jump state_2850
+    .mark: state_2849
+    iinc 1
+    jump state_2847
+    .mark: state_2850
+    iinc 1
+    jump state_2852
+    .mark: state_2851
+    iinc 1
+    jump state_2849
+    .mark: state_2852
+    iinc 1
+    jump state_2854
+    .mark: state_2853
+    iinc 1
+    jump state_2851
+    .mark: state_2854
+    iinc 1
+    jump state_2856
+    .mark: state_2855
+    iinc 1
+    jump state_2853
+    .mark: state_2856
+    iinc 1
+    jump state_2858
+    .mark: state_2857
+    iinc 1
+    jump state_2855
+    .mark: state_2858
+    iinc 1
+    jump state_2860
+    .mark: state_2859
+    iinc 1
+    jump state_2857
+    .mark: state_2860
+    iinc 1
+    jump state_2862
+    .mark: state_2861
+    iinc 1
+    jump state_2859
+    .mark: state_2862
+    iinc 1
+    jump state_2864
+    .mark: state_2863
+    iinc 1
+    jump state_2861
+    .mark: state_2864
+    iinc 1
+    jump state_2866
+    .mark: state_2865
+    iinc 1
+    jump state_2863
+    .mark: state_2866
+    iinc 1
+    jump state_2868
+    .mark: state_2867
+    iinc 1
+    jump state_2865
+    .mark: state_2868
+    iinc 1
+    jump state_2870
+    .mark: state_2869
+    iinc 1
+    jump state_2867
+    .mark: state_2870
+    iinc 1
+    jump state_2872
+    .mark: state_2871
+    iinc 1
+    jump state_2869
+    .mark: state_2872
+    iinc 1
+    jump state_2874
+    .mark: state_2873
+    iinc 1
+    jump state_2871
+    .mark: state_2874
+    iinc 1
+    jump state_2876
+    .mark: state_2875
+    iinc 1
+    jump state_2873
+    .mark: state_2876
+    iinc 1
+    jump state_2878
+    .mark: state_2877
+    iinc 1
+    jump state_2875
+    .mark: state_2878
+    iinc 1
+    jump state_2880
+    .mark: state_2879
+    iinc 1
+    jump state_2877
+    .mark: state_2880
+    iinc 1
+    jump state_2882
+    .mark: state_2881
+    iinc 1
+    jump state_2879
+    .mark: state_2882
+    iinc 1
+    jump state_2884
+    .mark: state_2883
+    iinc 1
+    jump state_2881
+    .mark: state_2884
+    iinc 1
+    jump state_2886
+    .mark: state_2885
+    iinc 1
+    jump state_2883
+    .mark: state_2886
+    iinc 1
+    jump state_2888
+    .mark: state_2887
+    iinc 1
+    jump state_2885
+    .mark: state_2888
+    iinc 1
+    jump state_2890
+    .mark: state_2889
+    iinc 1
+    jump state_2887
+    .mark: state_2890
+    iinc 1
+    jump state_2892
+    .mark: state_2891
+    iinc 1
+    jump state_2889
+    .mark: state_2892
+    iinc 1
+    jump state_2894
+    .mark: state_2893
+    iinc 1
+    jump state_2891
+    .mark: state_2894
+    iinc 1
+    jump state_2896
+    .mark: state_2895
+    iinc 1
+    jump state_2893
+    .mark: state_2896
+    iinc 1
+    jump state_2898
+    .mark: state_2897
+    iinc 1
+    jump state_2895
+    .mark: state_2898
+    iinc 1
+    jump state_2900
+    .mark: state_2899
+    iinc 1
+    jump state_2897
+    .mark: state_2900
+    iinc 1
+    jump state_2902
+    .mark: state_2901
+    iinc 1
+    jump state_2899
+    .mark: state_2902
+    iinc 1
+    jump state_2904
+    .mark: state_2903
+    iinc 1
+    jump state_2901
+    .mark: state_2904
+    iinc 1
+    jump state_2906
+    .mark: state_2905
+    iinc 1
+    jump state_2903
+    .mark: state_2906
+    iinc 1
+    jump state_2908
+    .mark: state_2907
+    iinc 1
+    jump state_2905
+    .mark: state_2908
+    iinc 1
+    jump state_2910
+    .mark: state_2909
+    iinc 1
+    jump state_2907
+    .mark: state_2910
+    iinc 1
+    jump state_2912
+    .mark: state_2911
+    iinc 1
+    jump state_2909
+    .mark: state_2912
+    iinc 1
+    jump state_2914
+    .mark: state_2913
+    iinc 1
+    jump state_2911
+    .mark: state_2914
+    iinc 1
+    jump state_2916
+    .mark: state_2915
+    iinc 1
+    jump state_2913
+    .mark: state_2916
+    iinc 1
+    jump state_2918
+    .mark: state_2917
+    iinc 1
+    jump state_2915
+    .mark: state_2918
+    iinc 1
+    jump state_2920
+    .mark: state_2919
+    iinc 1
+    jump state_2917
+    .mark: state_2920
+    iinc 1
+    jump state_2922
+    .mark: state_2921
+    iinc 1
+    jump state_2919
+    .mark: state_2922
+    iinc 1
+    jump state_2924
+    .mark: state_2923
+    iinc 1
+    jump state_2921
+    .mark: state_2924
+    iinc 1
+    jump state_2926
+    .mark: state_2925
+    iinc 1
+    jump state_2923
+    .mark: state_2926
+    iinc 1
+    jump state_2928
+    .mark: state_2927
+    iinc 1
+    jump state_2925
+    .mark: state_2928
+    iinc 1
+    jump state_2930
+    .mark: state_2929
+    iinc 1
+    jump state_2927
+    .mark: state_2930
+    iinc 1
+    jump state_2932
+    .mark: state_2931
+    iinc 1
+    jump state_2929
+    .mark: state_2932
+    iinc 1
+    jump state_2934
+    .mark: state_2933
+    iinc 1
+    jump state_2931
+    .mark: state_2934
+    iinc 1
+    jump state_2936
+    .mark: state_2935
+    iinc 1
+    jump state_2933
+    .mark: state_2936
+    iinc 1
+    jump state_2938
+    .mark: state_2937
+    iinc 1
+    jump state_2935
+    .mark: state_2938
+    iinc 1
+    jump state_2940
+    .mark: state_2939
+    iinc 1
+    jump state_2937
+    .mark: state_2940
+    iinc 1
+    jump state_2942
+    .mark: state_2941
+    iinc 1
+    jump state_2939
+    .mark: state_2942
+    iinc 1
+    jump state_2944
+    .mark: state_2943
+    iinc 1
+    jump state_2941
+    .mark: state_2944
+    iinc 1
+    jump state_2946
+    .mark: state_2945
+    iinc 1
+    jump state_2943
+    .mark: state_2946
+    iinc 1
+    jump state_2948
+    .mark: state_2947
+    iinc 1
+    jump state_2945
+    .mark: state_2948
+    iinc 1
+    jump state_2950
+    .mark: state_2949
+    iinc 1
+    jump state_2947
+    .mark: state_2950
+    iinc 1
+    jump state_2952
+    .mark: state_2951
+    iinc 1
+    jump state_2949
+    .mark: state_2952
+    iinc 1
+    jump state_2954
+    .mark: state_2953
+    iinc 1
+    jump state_2951
+    .mark: state_2954
+    iinc 1
+    jump state_2956
+    .mark: state_2955
+    iinc 1
+    jump state_2953
+    .mark: state_2956
+    iinc 1
+    jump state_2958
+    .mark: state_2957
+    iinc 1
+    jump state_2955
+    .mark: state_2958
+    iinc 1
+    jump state_2960
+    .mark: state_2959
+    iinc 1
+    jump state_2957
+    .mark: state_2960
+    iinc 1
+    jump state_2962
+    .mark: state_2961
+    iinc 1
+    jump state_2959
+    .mark: state_2962
+    iinc 1
+    jump state_2964
+    .mark: state_2963
+    iinc 1
+    jump state_2961
+    .mark: state_2964
+    iinc 1
+    jump state_2966
+    .mark: state_2965
+    iinc 1
+    jump state_2963
+    .mark: state_2966
+    iinc 1
+    jump state_2968
+    .mark: state_2967
+    iinc 1
+    jump state_2965
+    .mark: state_2968
+    iinc 1
+    jump state_2970
+    .mark: state_2969
+    iinc 1
+    jump state_2967
+    .mark: state_2970
+    iinc 1
+    jump state_2972
+    .mark: state_2971
+    iinc 1
+    jump state_2969
+    .mark: state_2972
+    iinc 1
+    jump state_2974
+    .mark: state_2973
+    iinc 1
+    jump state_2971
+    .mark: state_2974
+    iinc 1
+    jump state_2976
+    .mark: state_2975
+    iinc 1
+    jump state_2973
+    .mark: state_2976
+    iinc 1
+    jump state_2978
+    .mark: state_2977
+    iinc 1
+    jump state_2975
+    .mark: state_2978
+    iinc 1
+    jump state_2980
+    .mark: state_2979
+    iinc 1
+    jump state_2977
+    .mark: state_2980
+    iinc 1
+    jump state_2982
+    .mark: state_2981
+    iinc 1
+    jump state_2979
+    .mark: state_2982
+    iinc 1
+    jump state_2984
+    .mark: state_2983
+    iinc 1
+    jump state_2981
+    .mark: state_2984
+    iinc 1
+    jump state_2986
+    .mark: state_2985
+    iinc 1
+    jump state_2983
+    .mark: state_2986
+    iinc 1
+    jump state_2988
+    .mark: state_2987
+    iinc 1
+    jump state_2985
+    .mark: state_2988
+    iinc 1
+    jump state_2990
+    .mark: state_2989
+    iinc 1
+    jump state_2987
+    .mark: state_2990
+    iinc 1
+    jump state_2992
+    .mark: state_2991
+    iinc 1
+    jump state_2989
+    .mark: state_2992
+    iinc 1
+    jump state_2994
+    .mark: state_2993
+    iinc 1
+    jump state_2991
+    .mark: state_2994
+    iinc 1
+    jump state_2996
+    .mark: state_2995
+    iinc 1
+    jump state_2993
+    .mark: state_2996
+    iinc 1
+    jump state_2998
+    .mark: state_2997
+    iinc 1
+    jump state_2995
+    .mark: state_2998
+    iinc 1
+    jump state_3000
+    .mark: state_2999
+    iinc 1
+    jump state_2997
+    .mark: state_3000
+    iinc 1
+    jump state_3002
+    .mark: state_3001
+    iinc 1
+    jump state_2999
+    .mark: state_3002
+    iinc 1
+    jump state_3004
+    .mark: state_3003
+    iinc 1
+    jump state_3001
+    .mark: state_3004
+    iinc 1
+    jump state_3006
+    .mark: state_3005
+    iinc 1
+    jump state_3003
+    .mark: state_3006
+    iinc 1
+    jump state_3008
+    .mark: state_3007
+    iinc 1
+    jump state_3005
+    .mark: state_3008
+    iinc 1
+    jump state_3010
+    .mark: state_3009
+    iinc 1
+    jump state_3007
+    .mark: state_3010
+    iinc 1
+    jump state_3012
+    .mark: state_3011
+    iinc 1
+    jump state_3009
+    .mark: state_3012
+    iinc 1
+    jump state_3014
+    .mark: state_3013
+    iinc 1
+    jump state_3011
+    .mark: state_3014
+    iinc 1
+    jump state_3016
+    .mark: state_3015
+    iinc 1
+    jump state_3013
+    .mark: state_3016
+    iinc 1
+    jump state_3018
+    .mark: state_3017
+    iinc 1
+    jump state_3015
+    .mark: state_3018
+    iinc 1
+    jump state_3020
+    .mark: state_3019
+    iinc 1
+    jump state_3017
+    .mark: state_3020
+    iinc 1
+    jump state_3022
+    .mark: state_3021
+    iinc 1
+    jump state_3019
+    .mark: state_3022
+    iinc 1
+    jump state_3024
+    .mark: state_3023
+    iinc 1
+    jump state_3021
+    .mark: state_3024
+    iinc 1
+    jump state_3026
+    .mark: state_3025
+    iinc 1
+    jump state_3023
+    .mark: state_3026
+    iinc 1
+    jump state_3028
+    .mark: state_3027
+    iinc 1
+    jump state_3025
+    .mark: state_3028
+    iinc 1
+    jump state_3030
+    .mark: state_3029
+    iinc 1
+    jump state_3027
+    .mark: state_3030
+    iinc 1
+    jump state_3032
+    .mark: state_3031
+    iinc 1
+    jump state_3029
+    .mark: state_3032
+    iinc 1
+    jump state_3034
+    .mark: state_3033
+    iinc 1
+    jump state_3031
+    .mark: state_3034
+    iinc 1
+    jump state_3036
+    .mark: state_3035
+    iinc 1
+    jump state_3033
+    .mark: state_3036
+    iinc 1
+    jump state_3038
+    .mark: state_3037
+    iinc 1
+    jump state_3035
+    .mark: state_3038
+    iinc 1
+    jump state_3040
+    .mark: state_3039
+    iinc 1
+    jump state_3037
+    .mark: state_3040
+    iinc 1
+    jump state_3042
+    .mark: state_3041
+    iinc 1
+    jump state_3039
+    .mark: state_3042
+    iinc 1
+    jump state_3044
+    .mark: state_3043
+    iinc 1
+    jump state_3041
+    .mark: state_3044
+    iinc 1
+    jump state_3046
+    .mark: state_3045
+    iinc 1
+    jump state_3043
+    .mark: state_3046
+    iinc 1
+    jump state_3048
+    .mark: state_3047
+    iinc 1
+    jump state_3045
+    .mark: state_3048
+    iinc 1
+    jump state_3050
+    .mark: state_3049
+    iinc 1
+    jump state_3047
+    .mark: state_3050
+    iinc 1
+    jump state_3052
+    .mark: state_3051
+    iinc 1
+    jump state_3049
+    .mark: state_3052
+    iinc 1
+    jump state_3054
+    .mark: state_3053
+    iinc 1
+    jump state_3051
+    .mark: state_3054
+    iinc 1
+    jump state_3056
+    .mark: state_3055
+    iinc 1
+    jump state_3053
+    .mark: state_3056
+    iinc 1
+    jump state_3058
+    .mark: state_3057
+    iinc 1
+    jump state_3055
+    .mark: state_3058
+    iinc 1
+    jump state_3060
+    .mark: state_3059
+    iinc 1
+    jump state_3057
+    .mark: state_3060
+    iinc 1
+    jump state_3062
+    .mark: state_3061
+    iinc 1
+    jump state_3059
+    .mark: state_3062
+    iinc 1
+    jump state_3064
+    .mark: state_3063
+    iinc 1
+    jump state_3061
+    .mark: state_3064
+    iinc 1
+    jump state_3066
+    .mark: state_3065
+    iinc 1
+    jump state_3063
+    .mark: state_3066
+    iinc 1
+    jump state_3068
+    .mark: state_3067
+    iinc 1
+    jump state_3065
+    .mark: state_3068
+    iinc 1
+    jump state_3070
+    .mark: state_3069
+    iinc 1
+    jump state_3067
+    .mark: state_3070
+    iinc 1
+    jump state_3072
+    .mark: state_3071
+    iinc 1
+    jump state_3069
+    .mark: state_3072
+    iinc 1
+    jump state_3074
+    .mark: state_3073
+    iinc 1
+    jump state_3071
+    .mark: state_3074
+    iinc 1
+    jump state_3076
+    .mark: state_3075
+    iinc 1
+    jump state_3073
+    .mark: state_3076
+    iinc 1
+    jump state_3078
+    .mark: state_3077
+    iinc 1
+    jump state_3075
+    .mark: state_3078
+    iinc 1
+    jump state_3080
+    .mark: state_3079
+    iinc 1
+    jump state_3077
+    .mark: state_3080
+    iinc 1
+    jump state_3082
+    .mark: state_3081
+    iinc 1
+    jump state_3079
+    .mark: state_3082
+    iinc 1
+    jump state_3084
+    .mark: state_3083
+    iinc 1
+    jump state_3081
+    .mark: state_3084
+    iinc 1
+    jump state_3086
+    .mark: state_3085
+    iinc 1
+    jump state_3083
+    .mark: state_3086
+    iinc 1
+    jump state_3088
+    .mark: state_3087
+    iinc 1
+    jump state_3085
+    .mark: state_3088
+    iinc 1
+    jump state_3090
+    .mark: state_3089
+    iinc 1
+    jump state_3087
+    .mark: state_3090
+    iinc 1
+    jump state_3092
+    .mark: state_3091
+    iinc 1
+    jump state_3089
+    .mark: state_3092
+    iinc 1
+    jump state_3094
+    .mark: state_3093
+    iinc 1
+    jump state_3091
+    .mark: state_3094
+    iinc 1
+    jump state_3096
+    .mark: state_3095
+    iinc 1
+    jump state_3093
+    .mark: state_3096
+    iinc 1
+    jump state_3098
+    .mark: state_3097
+    iinc 1
+    jump state_3095
+    .mark: state_3098
+    iinc 1
+    jump state_3100
+    .mark: state_3099
+    iinc 1
+    jump state_3097
+    .mark: state_3100
+    iinc 1
+    jump state_3102
+    .mark: state_3101
+    iinc 1
+    jump state_3099
+    .mark: state_3102
+    iinc 1
+    jump state_3104
+    .mark: state_3103
+    iinc 1
+    jump state_3101
+    .mark: state_3104
+    iinc 1
+    jump state_3106
+    .mark: state_3105
+    iinc 1
+    jump state_3103
+    .mark: state_3106
+    iinc 1
+    jump state_3108
+    .mark: state_3107
+    iinc 1
+    jump state_3105
+    .mark: state_3108
+    iinc 1
+    jump state_3110
+    .mark: state_3109
+    iinc 1
+    jump state_3107
+    .mark: state_3110
+    iinc 1
+    jump state_3112
+    .mark: state_3111
+    iinc 1
+    jump state_3109
+    .mark: state_3112
+    iinc 1
+    jump state_3114
+    .mark: state_3113
+    iinc 1
+    jump state_3111
+    .mark: state_3114
+    iinc 1
+    jump state_3116
+    .mark: state_3115
+    iinc 1
+    jump state_3113
+    .mark: state_3116
+    iinc 1
+    jump state_3118
+    .mark: state_3117
+    iinc 1
+    jump state_3115
+    .mark: state_3118
+    iinc 1
+    jump state_3120
+    .mark: state_3119
+    iinc 1
+    jump state_3117
+    .mark: state_3120
+    iinc 1
+    jump state_3122
+    .mark: state_3121
+    iinc 1
+    jump state_3119
+    .mark: state_3122
+    iinc 1
+    jump state_3124
+    .mark: state_3123
+    iinc 1
+    jump state_3121
+    .mark: state_3124
+    iinc 1
+    jump state_3126
+    .mark: state_3125
+    iinc 1
+    jump state_3123
+    .mark: state_3126
+    iinc 1
+    jump state_3128
+    .mark: state_3127
+    iinc 1
+    jump state_3125
+    .mark: state_3128
+    iinc 1
+    jump state_3130
+    .mark: state_3129
+    iinc 1
+    jump state_3127
+    .mark: state_3130
+    iinc 1
+    jump state_3132
+    .mark: state_3131
+    iinc 1
+    jump state_3129
+    .mark: state_3132
+    iinc 1
+    jump state_3134
+    .mark: state_3133
+    iinc 1
+    jump state_3131
+    .mark: state_3134
+    iinc 1
+    jump state_3136
+    .mark: state_3135
+    iinc 1
+    jump state_3133
+    .mark: state_3136
+    iinc 1
+    jump state_3138
+    .mark: state_3137
+    iinc 1
+    jump state_3135
+    .mark: state_3138
+    iinc 1
+    jump state_3140
+    .mark: state_3139
+    iinc 1
+    jump state_3137
+    .mark: state_3140
+    iinc 1
+    jump state_3142
+    .mark: state_3141
+    iinc 1
+    jump state_3139
+    .mark: state_3142
+    iinc 1
+    jump state_3144
+    .mark: state_3143
+    iinc 1
+    jump state_3141
+    .mark: state_3144
+    iinc 1
+    jump state_3146
+    .mark: state_3145
+    iinc 1
+    jump state_3143
+    .mark: state_3146
+    iinc 1
+    jump state_3148
+    .mark: state_3147
+    iinc 1
+    jump state_3145
+    .mark: state_3148
+    iinc 1
+    jump state_3150
+    .mark: state_3149
+    iinc 1
+    jump state_3147
+    .mark: state_3150
+    iinc 1
+    jump state_3152
+    .mark: state_3151
+    iinc 1
+    jump state_3149
+    .mark: state_3152
+    iinc 1
+    jump state_3154
+    .mark: state_3153
+    iinc 1
+    jump state_3151
+    .mark: state_3154
+    iinc 1
+    jump state_3156
+    .mark: state_3155
+    iinc 1
+    jump state_3153
+    .mark: state_3156
+    iinc 1
+    jump state_3158
+    .mark: state_3157
+    iinc 1
+    jump state_3155
+    .mark: state_3158
+    iinc 1
+    jump state_3160
+    .mark: state_3159
+    iinc 1
+    jump state_3157
+    .mark: state_3160
+    iinc 1
+    jump state_3162
+    .mark: state_3161
+    iinc 1
+    jump state_3159
+    .mark: state_3162
+    iinc 1
+    jump state_3164
+    .mark: state_3163
+    iinc 1
+    jump state_3161
+    .mark: state_3164
+    iinc 1
+    jump state_3166
+    .mark: state_3165
+    iinc 1
+    jump state_3163
+    .mark: state_3166
+    iinc 1
+    jump state_3168
+    .mark: state_3167
+    iinc 1
+    jump state_3165
+    .mark: state_3168
+    iinc 1
+    jump state_3170
+    .mark: state_3169
+    iinc 1
+    jump state_3167
+    .mark: state_3170
+    iinc 1
+    jump state_3172
+    .mark: state_3171
+    iinc 1
+    jump state_3169
+    .mark: state_3172
+    iinc 1
+    jump state_3174
+    .mark: state_3173
+    iinc 1
+    jump state_3171
+    .mark: state_3174
+    iinc 1
+    jump state_3176
+    .mark: state_3175
+    iinc 1
+    jump state_3173
+    .mark: state_3176
+    iinc 1
+    jump state_3178
+    .mark: state_3177
+    iinc 1
+    jump state_3175
+    .mark: state_3178
+    iinc 1
+    jump state_3180
+    .mark: state_3179
+    iinc 1
+    jump state_3177
+    .mark: state_3180
+    iinc 1
+    jump state_3182
+    .mark: state_3181
+    iinc 1
+    jump state_3179
+    .mark: state_3182
+    iinc 1
+    jump state_3184
+    .mark: state_3183
+    iinc 1
+    jump state_3181
+    .mark: state_3184
+    iinc 1
+    jump state_3186
+    .mark: state_3185
+    iinc 1
+    jump state_3183
+    .mark: state_3186
+    iinc 1
+    jump state_3188
+    .mark: state_3187
+    iinc 1
+    jump state_3185
+    .mark: state_3188
+    iinc 1
+    jump state_3190
+    .mark: state_3189
+    iinc 1
+    jump state_3187
+    .mark: state_3190
+    iinc 1
+    jump state_3192
+    .mark: state_3191
+    iinc 1
+    jump state_3189
+    .mark: state_3192
+    iinc 1
+    jump state_3194
+    .mark: state_3193
+    iinc 1
+    jump state_3191
+    .mark: state_3194
+    iinc 1
+    jump state_3196
+    .mark: state_3195
+    iinc 1
+    jump state_3193
+    .mark: state_3196
+    iinc 1
+    jump state_3198
+    .mark: state_3197
+    iinc 1
+    jump state_3195
+    .mark: state_3198
+    iinc 1
+    jump state_3200
+    .mark: state_3199
+    iinc 1
+    jump state_3197
+    .mark: state_3200
+    iinc 1
+    jump state_3202
+    .mark: state_3201
+    iinc 1
+    jump state_3199
+    .mark: state_3202
+    iinc 1
+    jump state_3204
+    .mark: state_3203
+    iinc 1
+    jump state_3201
+    .mark: state_3204
+    iinc 1
+    jump state_3206
+    .mark: state_3205
+    iinc 1
+    jump state_3203
+    .mark: state_3206
+    iinc 1
+    jump state_3208
+    .mark: state_3207
+    iinc 1
+    jump state_3205
+    .mark: state_3208
+    iinc 1
+    jump state_3210
+    .mark: state_3209
+    iinc 1
+    jump state_3207
+    .mark: state_3210
+    iinc 1
+    jump state_3212
+    .mark: state_3211
+    iinc 1
+    jump state_3209
+    .mark: state_3212
+    iinc 1
+    jump state_3214
+    .mark: state_3213
+    iinc 1
+    jump state_3211
+    .mark: state_3214
+    iinc 1
+    jump state_3216
+    .mark: state_3215
+    iinc 1
+    jump state_3213
+    .mark: state_3216
+    iinc 1
+    jump state_3218
+    .mark: state_3217
+    iinc 1
+    jump state_3215
+    .mark: state_3218
+    iinc 1
+    jump state_3220
+    .mark: state_3219
+    iinc 1
+    jump state_3217
+    .mark: state_3220
+    iinc 1
+    jump state_3222
+    .mark: state_3221
+    iinc 1
+    jump state_3219
+    .mark: state_3222
+    iinc 1
+    jump state_3224
+    .mark: state_3223
+    iinc 1
+    jump state_3221
+    .mark: state_3224
+    iinc 1
+    jump state_3226
+    .mark: state_3225
+    iinc 1
+    jump state_3223
+    .mark: state_3226
+    iinc 1
+    jump state_3228
+    .mark: state_3227
+    iinc 1
+    jump state_3225
+    .mark: state_3228
+    iinc 1
+    jump state_3230
+    .mark: state_3229
+    iinc 1
+    jump state_3227
+    .mark: state_3230
+    iinc 1
+    jump state_3232
+    .mark: state_3231
+    iinc 1
+    jump state_3229
+    .mark: state_3232
+    iinc 1
+    jump state_3234
+    .mark: state_3233
+    iinc 1
+    jump state_3231
+    .mark: state_3234
+    iinc 1
+    jump state_3236
+    .mark: state_3235
+    iinc 1
+    jump state_3233
+    .mark: state_3236
+    iinc 1
+    jump state_3238
+    .mark: state_3237
+    iinc 1
+    jump state_3235
+    .mark: state_3238
+    iinc 1
+    jump state_3240
+    .mark: state_3239
+    iinc 1
+    jump state_3237
+    .mark: state_3240
+    iinc 1
+    jump state_3242
+    .mark: state_3241
+    iinc 1
+    jump state_3239
+    .mark: state_3242
+    iinc 1
+    jump state_3244
+    .mark: state_3243
+    iinc 1
+    jump state_3241
+    .mark: state_3244
+    iinc 1
+    jump state_3246
+    .mark: state_3245
+    iinc 1
+    jump state_3243
+    .mark: state_3246
+    iinc 1
+    jump state_3248
+    .mark: state_3247
+    iinc 1
+    jump state_3245
+    .mark: state_3248
+    iinc 1
+    jump state_3250
+    .mark: state_3249
+    iinc 1
+    jump state_3247
+    .mark: state_3250
+    iinc 1
+    jump state_3252
+    .mark: state_3251
+    iinc 1
+    jump state_3249
+    .mark: state_3252
+    iinc 1
+    jump state_3254
+    .mark: state_3253
+    iinc 1
+    jump state_3251
+    .mark: state_3254
+    iinc 1
+    jump state_3256
+    .mark: state_3255
+    iinc 1
+    jump state_3253
+    .mark: state_3256
+    iinc 1
+    jump state_3258
+    .mark: state_3257
+    iinc 1
+    jump state_3255
+    .mark: state_3258
+    iinc 1
+    jump state_3260
+    .mark: state_3259
+    iinc 1
+    jump state_3257
+    .mark: state_3260
+    iinc 1
+    jump state_3262
+    .mark: state_3261
+    iinc 1
+    jump state_3259
+    .mark: state_3262
+    iinc 1
+    jump state_3264
+    .mark: state_3263
+    iinc 1
+    jump state_3261
+    .mark: state_3264
+    iinc 1
+    jump state_3266
+    .mark: state_3265
+    iinc 1
+    jump state_3263
+    .mark: state_3266
+    iinc 1
+    jump state_3268
+    .mark: state_3267
+    iinc 1
+    jump state_3265
+    .mark: state_3268
+    iinc 1
+    jump state_3270
+    .mark: state_3269
+    iinc 1
+    jump state_3267
+    .mark: state_3270
+    iinc 1
+    jump state_3272
+    .mark: state_3271
+    iinc 1
+    jump state_3269
+    .mark: state_3272
+    iinc 1
+    jump state_3274
+    .mark: state_3273
+    iinc 1
+    jump state_3271
+    .mark: state_3274
+    iinc 1
+    jump state_3276
+    .mark: state_3275
+    iinc 1
+    jump state_3273
+    .mark: state_3276
+    iinc 1
+    jump state_3278
+    .mark: state_3277
+    iinc 1
+    jump state_3275
+    .mark: state_3278
+    iinc 1
+    jump state_3280
+    .mark: state_3279
+    iinc 1
+    jump state_3277
+    .mark: state_3280
+    iinc 1
+    jump state_3282
+    .mark: state_3281
+    iinc 1
+    jump state_3279
+    .mark: state_3282
+    iinc 1
+    jump state_3284
+    .mark: state_3283
+    iinc 1
+    jump state_3281
+    .mark: state_3284
+    iinc 1
+    jump state_3286
+    .mark: state_3285
+    iinc 1
+    jump state_3283
+    .mark: state_3286
+    iinc 1
+    jump state_3288
+    .mark: state_3287
+    iinc 1
+    jump state_3285
+    .mark: state_3288
+    iinc 1
+    jump state_3290
+    .mark: state_3289
+    iinc 1
+    jump state_3287
+    .mark: state_3290
+    iinc 1
+    jump state_3292
+    .mark: state_3291
+    iinc 1
+    jump state_3289
+    .mark: state_3292
+    iinc 1
+    jump state_3294
+    .mark: state_3293
+    iinc 1
+    jump state_3291
+    .mark: state_3294
+    iinc 1
+    jump state_3296
+    .mark: state_3295
+    iinc 1
+    jump state_3293
+    .mark: state_3296
+    iinc 1
+    jump state_3298
+    .mark: state_3297
+    iinc 1
+    jump state_3295
+    .mark: state_3298
+    iinc 1
+    jump state_3300
+    .mark: state_3299
+    iinc 1
+    jump state_3297
+    .mark: state_3300
+    iinc 1
+    jump state_3302
+    .mark: state_3301
+    iinc 1
+    jump state_3299
+    .mark: state_3302
+    iinc 1
+    jump state_3304
+    .mark: state_3303
+    iinc 1
+    jump state_3301
+    .mark: state_3304
+    iinc 1
+    jump state_3306
+    .mark: state_3305
+    iinc 1
+    jump state_3303
+    .mark: state_3306
+    iinc 1
+    jump state_3308
+    .mark: state_3307
+    iinc 1
+    jump state_3305
+    .mark: state_3308
+    iinc 1
+    jump state_3310
+    .mark: state_3309
+    iinc 1
+    jump state_3307
+    .mark: state_3310
+    iinc 1
+    jump state_3312
+    .mark: state_3311
+    iinc 1
+    jump state_3309
+    .mark: state_3312
+    iinc 1
+    jump state_3314
+    .mark: state_3313
+    iinc 1
+    jump state_3311
+    .mark: state_3314
+    iinc 1
+    jump state_3316
+    .mark: state_3315
+    iinc 1
+    jump state_3313
+    .mark: state_3316
+    iinc 1
+    jump state_3318
+    .mark: state_3317
+    iinc 1
+    jump state_3315
+    .mark: state_3318
+    iinc 1
+    jump state_3320
+    .mark: state_3319
+    iinc 1
+    jump state_3317
+    .mark: state_3320
+    iinc 1
+    jump state_3322
+    .mark: state_3321
+    iinc 1
+    jump state_3319
+    .mark: state_3322
+    iinc 1
+    jump state_3324
+    .mark: state_3323
+    iinc 1
+    jump state_3321
+    .mark: state_3324
+    iinc 1
+    jump state_3326
+    .mark: state_3325
+    iinc 1
+    jump state_3323
+    .mark: state_3326
+    iinc 1
+    jump state_3328
+    .mark: state_3327
+    iinc 1
+    jump state_3325
+    .mark: state_3328
+    iinc 1
+    jump state_3330
+    .mark: state_3329
+    iinc 1
+    jump state_3327
+    .mark: state_3330
+    iinc 1
+    jump state_3332
+    .mark: state_3331
+    iinc 1
+    jump state_3329
+    .mark: state_3332
+    iinc 1
+    jump state_3334
+    .mark: state_3333
+    iinc 1
+    jump state_3331
+    .mark: state_3334
+    iinc 1
+    jump state_3336
+    .mark: state_3335
+    iinc 1
+    jump state_3333
+    .mark: state_3336
+    iinc 1
+    jump state_3338
+    .mark: state_3337
+    iinc 1
+    jump state_3335
+    .mark: state_3338
+    iinc 1
+    jump state_3340
+    .mark: state_3339
+    iinc 1
+    jump state_3337
+    .mark: state_3340
+    iinc 1
+    jump state_3342
+    .mark: state_3341
+    iinc 1
+    jump state_3339
+    .mark: state_3342
+    iinc 1
+    jump state_3344
+    .mark: state_3343
+    iinc 1
+    jump state_3341
+    .mark: state_3344
+    iinc 1
+    jump state_3346
+    .mark: state_3345
+    iinc 1
+    jump state_3343
+    .mark: state_3346
+    iinc 1
+    jump state_3348
+    .mark: state_3347
+    iinc 1
+    jump state_3345
+    .mark: state_3348
+    iinc 1
+    jump state_3350
+    .mark: state_3349
+    iinc 1
+    jump state_3347
+    .mark: state_3350
+    iinc 1
+    jump state_3352
+    .mark: state_3351
+    iinc 1
+    jump state_3349
+    .mark: state_3352
+    iinc 1
+    jump state_3354
+    .mark: state_3353
+    iinc 1
+    jump state_3351
+    .mark: state_3354
+    iinc 1
+    jump state_3356
+    .mark: state_3355
+    iinc 1
+    jump state_3353
+    .mark: state_3356
+    iinc 1
+    jump state_3358
+    .mark: state_3357
+    iinc 1
+    jump state_3355
+    .mark: state_3358
+    iinc 1
+    jump state_3360
+    .mark: state_3359
+    iinc 1
+    jump state_3357
+    .mark: state_3360
+    iinc 1
+    jump state_3362
+    .mark: state_3361
+    iinc 1
+    jump state_3359
+    .mark: state_3362
+    iinc 1
+    jump state_3364
+    .mark: state_3363
+    iinc 1
+    jump state_3361
+    .mark: state_3364
+    iinc 1
+    jump state_3366
+    .mark: state_3365
+    iinc 1
+    jump state_3363
+    .mark: state_3366
+    iinc 1
+    jump state_3368
+    .mark: state_3367
+    iinc 1
+    jump state_3365
+    .mark: state_3368
+    iinc 1
+    jump state_3370
+    .mark: state_3369
+    iinc 1
+    jump state_3367
+    .mark: state_3370
+    iinc 1
+    jump state_3372
+    .mark: state_3371
+    iinc 1
+    jump state_3369
+    .mark: state_3372
+    iinc 1
+    jump state_3374
+    .mark: state_3373
+    iinc 1
+    jump state_3371
+    .mark: state_3374
+    iinc 1
+    jump state_3376
+    .mark: state_3375
+    iinc 1
+    jump state_3373
+    .mark: state_3376
+    iinc 1
+    jump state_3378
+    .mark: state_3377
+    iinc 1
+    jump state_3375
+    .mark: state_3378
+    iinc 1
+    jump state_3380
+    .mark: state_3379
+    iinc 1
+    jump state_3377
+    .mark: state_3380
+    iinc 1
+    jump state_3382
+    .mark: state_3381
+    iinc 1
+    jump state_3379
+    .mark: state_3382
+    iinc 1
+    jump state_3384
+    .mark: state_3383
+    iinc 1
+    jump state_3381
+    .mark: state_3384
+    iinc 1
+    jump state_3386
+    .mark: state_3385
+    iinc 1
+    jump state_3383
+    .mark: state_3386
+    iinc 1
+    jump state_3388
+    .mark: state_3387
+    iinc 1
+    jump state_3385
+    .mark: state_3388
+    iinc 1
+    jump state_3390
+    .mark: state_3389
+    iinc 1
+    jump state_3387
+    .mark: state_3390
+    iinc 1
+    jump state_3392
+    .mark: state_3391
+    iinc 1
+    jump state_3389
+    .mark: state_3392
+    iinc 1
+    jump state_3394
+    .mark: state_3393
+    iinc 1
+    jump state_3391
+    .mark: state_3394
+    iinc 1
+    jump state_3396
+    .mark: state_3395
+    iinc 1
+    jump state_3393
+    .mark: state_3396
+    iinc 1
+    jump state_3398
+    .mark: state_3397
+    iinc 1
+    jump state_3395
+    .mark: state_3398
+    iinc 1
+    jump state_3400
+    .mark: state_3399
+    iinc 1
+    jump state_3397
+    .mark: state_3400
+    iinc 1
+    jump state_3402
+    .mark: state_3401
+    iinc 1
+    jump state_3399
+    .mark: state_3402
+    iinc 1
+    jump state_3404
+    .mark: state_3403
+    iinc 1
+    jump state_3401
+    .mark: state_3404
+    iinc 1
+    jump state_3406
+    .mark: state_3405
+    iinc 1
+    jump state_3403
+    .mark: state_3406
+    iinc 1
+    jump state_3408
+    .mark: state_3407
+    iinc 1
+    jump state_3405
+    .mark: state_3408
+    iinc 1
+    jump state_3410
+    .mark: state_3409
+    iinc 1
+    jump state_3407
+    .mark: state_3410
+    iinc 1
+    jump state_3412
+    .mark: state_3411
+    iinc 1
+    jump state_3409
+    .mark: state_3412
+    iinc 1
+    jump state_3414
+    .mark: state_3413
+    iinc 1
+    jump state_3411
+    .mark: state_3414
+    iinc 1
+    jump state_3416
+    .mark: state_3415
+    iinc 1
+    jump state_3413
+    .mark: state_3416
+    iinc 1
+    jump state_3418
+    .mark: state_3417
+    iinc 1
+    jump state_3415
+    .mark: state_3418
+    iinc 1
+    jump state_3420
+    .mark: state_3419
+    iinc 1
+    jump state_3417
+    .mark: state_3420
+    iinc 1
+    jump state_3422
+    .mark: state_3421
+    iinc 1
+    jump state_3419
+    .mark: state_3422
+    iinc 1
+    jump state_3424
+    .mark: state_3423
+    iinc 1
+    jump state_3421
+    .mark: state_3424
+    iinc 1
+    jump state_3426
+    .mark: state_3425
+    iinc 1
+    jump state_3423
+    .mark: state_3426
+    iinc 1
+    jump state_3428
+    .mark: state_3427
+    iinc 1
+    jump state_3425
+    .mark: state_3428
+    iinc 1
+    jump state_3430
+    .mark: state_3429
+    iinc 1
+    jump state_3427
+    .mark: state_3430
+    iinc 1
+    jump state_3432
+    .mark: state_3431
+    iinc 1
+    jump state_3429
+    .mark: state_3432
+    iinc 1
+    jump state_3434
+    .mark: state_3433
+    iinc 1
+    jump state_3431
+    .mark: state_3434
+    iinc 1
+    jump state_3436
+    .mark: state_3435
+    iinc 1
+    jump state_3433
+    .mark: state_3436
+    iinc 1
+    jump state_3438
+    .mark: state_3437
+    iinc 1
+    jump state_3435
+    .mark: state_3438
+    iinc 1
+    jump state_3440
+    .mark: state_3439
+    iinc 1
+    jump state_3437
+    .mark: state_3440
+    iinc 1
+    jump state_3442
+    .mark: state_3441
+    iinc 1
+    jump state_3439
+    .mark: state_3442
+    iinc 1
+    jump state_3444
+    .mark: state_3443
+    iinc 1
+    jump state_3441
+    .mark: state_3444
+    iinc 1
+    jump state_3446
+    .mark: state_3445
+    iinc 1
+    jump state_3443
+    .mark: state_3446
+    iinc 1
+    jump state_3448
+    .mark: state_3447
+    iinc 1
+    jump state_3445
+    .mark: state_3448
+    iinc 1
+    jump state_3450
+    .mark: state_3449
+    iinc 1
+    jump state_3447
+    .mark: state_3450
+    iinc 1
+    jump state_3452
+    .mark: state_3451
+    iinc 1
+    jump state_3449
+    .mark: state_3452
+    iinc 1
+    jump state_3454
+    .mark: state_3453
+    iinc 1
+    jump state_3451
+    .mark: state_3454
+    iinc 1
+    jump state_3456
+    .mark: state_3455
+    iinc 1
+    jump state_3453
+    .mark: state_3456
+    iinc 1
+    jump state_3458
+    .mark: state_3457
+    iinc 1
+    jump state_3455
+    .mark: state_3458
+    iinc 1
+    jump state_3460
+    .mark: state_3459
+    iinc 1
+    jump state_3457
+    .mark: state_3460
+    iinc 1
+    jump state_3462
+    .mark: state_3461
+    iinc 1
+    jump state_3459
+    .mark: state_3462
+    iinc 1
+    jump state_3464
+    .mark: state_3463
+    iinc 1
+    jump state_3461
+    .mark: state_3464
+    iinc 1
+    jump state_3466
+    .mark: state_3465
+    iinc 1
+    jump state_3463
+    .mark: state_3466
+    iinc 1
+    jump state_3468
+    .mark: state_3467
+    iinc 1
+    jump state_3465
+    .mark: state_3468
+    iinc 1
+    jump state_3470
+    .mark: state_3469
+    iinc 1
+    jump state_3467
+    .mark: state_3470
+    iinc 1
+    jump state_3472
+    .mark: state_3471
+    iinc 1
+    jump state_3469
+    .mark: state_3472
+    iinc 1
+    jump state_3474
+    .mark: state_3473
+    iinc 1
+    jump state_3471
+    .mark: state_3474
+    iinc 1
+    jump state_3476
+    .mark: state_3475
+    iinc 1
+    jump state_3473
+    .mark: state_3476
+    iinc 1
+    jump state_3478
+    .mark: state_3477
+    iinc 1
+    jump state_3475
+    .mark: state_3478
+    iinc 1
+    jump state_3480
+    .mark: state_3479
+    iinc 1
+    jump state_3477
+    .mark: state_3480
+    iinc 1
+    jump state_3482
+    .mark: state_3481
+    iinc 1
+    jump state_3479
+    .mark: state_3482
+    iinc 1
+    jump state_3484
+    .mark: state_3483
+    iinc 1
+    jump state_3481
+    .mark: state_3484
+    iinc 1
+    jump state_3486
+    .mark: state_3485
+    iinc 1
+    jump state_3483
+    .mark: state_3486
+    iinc 1
+    jump state_3488
+    .mark: state_3487
+    iinc 1
+    jump state_3485
+    .mark: state_3488
+    iinc 1
+    jump state_3490
+    .mark: state_3489
+    iinc 1
+    jump state_3487
+    .mark: state_3490
+    iinc 1
+    jump state_3492
+    .mark: state_3491
+    iinc 1
+    jump state_3489
+    .mark: state_3492
+    iinc 1
+    jump state_3494
+    .mark: state_3493
+    iinc 1
+    jump state_3491
+    .mark: state_3494
+    iinc 1
+    jump state_3496
+    .mark: state_3495
+    iinc 1
+    jump state_3493
+    .mark: state_3496
+    iinc 1
+    jump state_3498
+    .mark: state_3497
+    iinc 1
+    jump state_3495
+    .mark: state_3498
+    iinc 1
+    jump state_3500
+    .mark: state_3499
+    iinc 1
+    jump state_3497
+    .mark: state_3500
+    iinc 1
+    jump state_3502
+    .mark: state_3501
+    iinc 1
+    jump state_3499
+    .mark: state_3502
+    iinc 1
+    jump state_3504
+    .mark: state_3503
+    iinc 1
+    jump state_3501
+    .mark: state_3504
+    iinc 1
+    jump state_3506
+    .mark: state_3505
+    iinc 1
+    jump state_3503
+    .mark: state_3506
+    iinc 1
+    jump state_3508
+    .mark: state_3507
+    iinc 1
+    jump state_3505
+    .mark: state_3508
+    iinc 1
+    jump state_3510
+    .mark: state_3509
+    iinc 1
+    jump state_3507
+    .mark: state_3510
+    iinc 1
+    jump state_3512
+    .mark: state_3511
+    iinc 1
+    jump state_3509
+    .mark: state_3512
+    iinc 1
+    jump state_3514
+    .mark: state_3513
+    iinc 1
+    jump state_3511
+    .mark: state_3514
+    iinc 1
+    jump state_3516
+    .mark: state_3515
+    iinc 1
+    jump state_3513
+    .mark: state_3516
+    iinc 1
+    jump state_3518
+    .mark: state_3517
+    iinc 1
+    jump state_3515
+    .mark: state_3518
+    iinc 1
+    jump state_3520
+    .mark: state_3519
+    iinc 1
+    jump state_3517
+    .mark: state_3520
+    iinc 1
+    jump state_3522
+    .mark: state_3521
+    iinc 1
+    jump state_3519
+    .mark: state_3522
+    iinc 1
+    jump state_3524
+    .mark: state_3523
+    iinc 1
+    jump state_3521
+    .mark: state_3524
+    iinc 1
+    jump state_3526
+    .mark: state_3525
+    iinc 1
+    jump state_3523
+    .mark: state_3526
+    iinc 1
+    jump state_3528
+    .mark: state_3527
+    iinc 1
+    jump state_3525
+    .mark: state_3528
+    iinc 1
+    jump state_3530
+    .mark: state_3529
+    iinc 1
+    jump state_3527
+    .mark: state_3530
+    iinc 1
+    jump state_3532
+    .mark: state_3531
+    iinc 1
+    jump state_3529
+    .mark: state_3532
+    iinc 1
+    jump state_3534
+    .mark: state_3533
+    iinc 1
+    jump state_3531
+    .mark: state_3534
+    iinc 1
+    jump state_3536
+    .mark: state_3535
+    iinc 1
+    jump state_3533
+    .mark: state_3536
+    iinc 1
+    jump state_3538
+    .mark: state_3537
+    iinc 1
+    jump state_3535
+    .mark: state_3538
+    iinc 1
+    jump state_3540
+    .mark: state_3539
+    iinc 1
+    jump state_3537
+    .mark: state_3540
+    iinc 1
+    jump state_3542
+    .mark: state_3541
+    iinc 1
+    jump state_3539
+    .mark: state_3542
+    iinc 1
+    jump state_3544
+    .mark: state_3543
+    iinc 1
+    jump state_3541
+    .mark: state_3544
+    iinc 1
+    jump state_3546
+    .mark: state_3545
+    iinc 1
+    jump state_3543
+    .mark: state_3546
+    iinc 1
+    jump state_3548
+    .mark: state_3547
+    iinc 1
+    jump state_3545
+    .mark: state_3548
+    iinc 1
+    jump state_3550
+    .mark: state_3549
+    iinc 1
+    jump state_3547
+    .mark: state_3550
+    iinc 1
+    jump state_3552
+    .mark: state_3551
+    iinc 1
+    jump state_3549
+    .mark: state_3552
+    iinc 1
+    jump state_3554
+    .mark: state_3553
+    iinc 1
+    jump state_3551
+    .mark: state_3554
+    iinc 1
+    jump state_3556
+    .mark: state_3555
+    iinc 1
+    jump state_3553
+    .mark: state_3556
+    iinc 1
+    jump state_3558
+    .mark: state_3557
+    iinc 1
+    jump state_3555
+    .mark: state_3558
+    iinc 1
+    jump state_3560
+    .mark: state_3559
+    iinc 1
+    jump state_3557
+    .mark: state_3560
+    iinc 1
+    jump state_3562
+    .mark: state_3561
+    iinc 1
+    jump state_3559
+    .mark: state_3562
+    iinc 1
+    jump state_3564
+    .mark: state_3563
+    iinc 1
+    jump state_3561
+    .mark: state_3564
+    iinc 1
+    jump state_3566
+    .mark: state_3565
+    iinc 1
+    jump state_3563
+    .mark: state_3566
+    iinc 1
+    jump state_3568
+    .mark: state_3567
+    iinc 1
+    jump state_3565
+    .mark: state_3568
+    iinc 1
+    jump state_3570
+    .mark: state_3569
+    iinc 1
+    jump state_3567
+    .mark: state_3570
+    iinc 1
+    jump state_3572
+    .mark: state_3571
+    iinc 1
+    jump state_3569
+    .mark: state_3572
+    iinc 1
+    jump state_3574
+    .mark: state_3573
+    iinc 1
+    jump state_3571
+    .mark: state_3574
+    iinc 1
+    jump state_3576
+    .mark: state_3575
+    iinc 1
+    jump state_3573
+    .mark: state_3576
+    iinc 1
+    jump state_3578
+    .mark: state_3577
+    iinc 1
+    jump state_3575
+    .mark: state_3578
+    iinc 1
+    jump state_3580
+    .mark: state_3579
+    iinc 1
+    jump state_3577
+    .mark: state_3580
+    iinc 1
+    jump state_3582
+    .mark: state_3581
+    iinc 1
+    jump state_3579
+    .mark: state_3582
+    iinc 1
+    jump state_3584
+    .mark: state_3583
+    iinc 1
+    jump state_3581
+    .mark: state_3584
+    iinc 1
+    jump state_3586
+    .mark: state_3585
+    iinc 1
+    jump state_3583
+    .mark: state_3586
+    iinc 1
+    jump state_3588
+    .mark: state_3587
+    iinc 1
+    jump state_3585
+    .mark: state_3588
+    iinc 1
+    jump state_3590
+    .mark: state_3589
+    iinc 1
+    jump state_3587
+    .mark: state_3590
+    iinc 1
+    jump state_3592
+    .mark: state_3591
+    iinc 1
+    jump state_3589
+    .mark: state_3592
+    iinc 1
+    jump state_3594
+    .mark: state_3593
+    iinc 1
+    jump state_3591
+    .mark: state_3594
+    iinc 1
+    jump state_3596
+    .mark: state_3595
+    iinc 1
+    jump state_3593
+    .mark: state_3596
+    iinc 1
+    jump state_3598
+    .mark: state_3597
+    iinc 1
+    jump state_3595
+    .mark: state_3598
+    iinc 1
+    jump state_3600
+    .mark: state_3599
+    iinc 1
+    jump state_3597
+    .mark: state_3600
+    iinc 1
+    jump state_3602
+    .mark: state_3601
+    iinc 1
+    jump state_3599
+    .mark: state_3602
+    iinc 1
+    jump state_3604
+    .mark: state_3603
+    iinc 1
+    jump state_3601
+    .mark: state_3604
+    iinc 1
+    jump state_3606
+    .mark: state_3605
+    iinc 1
+    jump state_3603
+    .mark: state_3606
+    iinc 1
+    jump state_3608
+    .mark: state_3607
+    iinc 1
+    jump state_3605
+    .mark: state_3608
+    iinc 1
+    jump state_3610
+    .mark: state_3609
+    iinc 1
+    jump state_3607
+    .mark: state_3610
+    iinc 1
+    jump state_3612
+    .mark: state_3611
+    iinc 1
+    jump state_3609
+    .mark: state_3612
+    iinc 1
+    jump state_3614
+    .mark: state_3613
+    iinc 1
+    jump state_3611
+    .mark: state_3614
+    iinc 1
+    jump state_3616
+    .mark: state_3615
+    iinc 1
+    jump state_3613
+    .mark: state_3616
+    iinc 1
+    jump state_3618
+    .mark: state_3617
+    iinc 1
+    jump state_3615
+    .mark: state_3618
+    iinc 1
+    jump state_3620
+    .mark: state_3619
+    iinc 1
+    jump state_3617
+    .mark: state_3620
+    iinc 1
+    jump state_3622
+    .mark: state_3621
+    iinc 1
+    jump state_3619
+    .mark: state_3622
+    iinc 1
+    jump state_3624
+    .mark: state_3623
+    iinc 1
+    jump state_3621
+    .mark: state_3624
+    iinc 1
+    jump state_3626
+    .mark: state_3625
+    iinc 1
+    jump state_3623
+    .mark: state_3626
+    iinc 1
+    jump state_3628
+    .mark: state_3627
+    iinc 1
+    jump state_3625
+    .mark: state_3628
+    iinc 1
+    jump state_3630
+    .mark: state_3629
+    iinc 1
+    jump state_3627
+    .mark: state_3630
+    iinc 1
+    jump state_3632
+    .mark: state_3631
+    iinc 1
+    jump state_3629
+    .mark: state_3632
+    iinc 1
+    jump state_3634
+    .mark: state_3633
+    iinc 1
+    jump state_3631
+    .mark: state_3634
+    iinc 1
+    jump state_3636
+    .mark: state_3635
+    iinc 1
+    jump state_3633
+    .mark: state_3636
+    iinc 1
+    jump state_3638
+    .mark: state_3637
+    iinc 1
+    jump state_3635
+    .mark: state_3638
+    iinc 1
+    jump state_3640
+    .mark: state_3639
+    iinc 1
+    jump state_3637
+    .mark: state_3640
+    iinc 1
+    jump state_3642
+    .mark: state_3641
+    iinc 1
+    jump state_3639
+    .mark: state_3642
+    iinc 1
+    jump state_3644
+    .mark: state_3643
+    iinc 1
+    jump state_3641
+    .mark: state_3644
+    iinc 1
+    jump state_3646
+    .mark: state_3645
+    iinc 1
+    jump state_3643
+    .mark: state_3646
+    iinc 1
+    jump state_3648
+    .mark: state_3647
+    iinc 1
+    jump state_3645
+    .mark: state_3648
+    iinc 1
+    jump state_3650
+    .mark: state_3649
+    iinc 1
+    jump state_3647
+    .mark: state_3650
+    iinc 1
+    jump state_3652
+    .mark: state_3651
+    iinc 1
+    jump state_3649
+    .mark: state_3652
+    iinc 1
+    jump state_3654
+    .mark: state_3653
+    iinc 1
+    jump state_3651
+    .mark: state_3654
+    iinc 1
+    jump state_3656
+    .mark: state_3655
+    iinc 1
+    jump state_3653
+    .mark: state_3656
+    iinc 1
+    jump state_3658
+    .mark: state_3657
+    iinc 1
+    jump state_3655
+    .mark: state_3658
+    iinc 1
+    jump state_3660
+    .mark: state_3659
+    iinc 1
+    jump state_3657
+    .mark: state_3660
+    iinc 1
+    jump state_3662
+    .mark: state_3661
+    iinc 1
+    jump state_3659
+    .mark: state_3662
+    iinc 1
+    jump state_3664
+    .mark: state_3663
+    iinc 1
+    jump state_3661
+    .mark: state_3664
+    iinc 1
+    jump state_3666
+    .mark: state_3665
+    iinc 1
+    jump state_3663
+    .mark: state_3666
+    iinc 1
+    jump state_3668
+    .mark: state_3667
+    iinc 1
+    jump state_3665
+    .mark: state_3668
+    iinc 1
+    jump state_3670
+    .mark: state_3669
+    iinc 1
+    jump state_3667
+    .mark: state_3670
+    iinc 1
+    jump state_3672
+    .mark: state_3671
+    iinc 1
+    jump state_3669
+    .mark: state_3672
+    iinc 1
+    jump state_3674
+    .mark: state_3673
+    iinc 1
+    jump state_3671
+    .mark: state_3674
+    iinc 1
+    jump state_3676
+    .mark: state_3675
+    iinc 1
+    jump state_3673
+    .mark: state_3676
+    iinc 1
+    jump state_3678
+    .mark: state_3677
+    iinc 1
+    jump state_3675
+    .mark: state_3678
+    iinc 1
+    jump state_3680
+    .mark: state_3679
+    iinc 1
+    jump state_3677
+    .mark: state_3680
+    iinc 1
+    jump state_3682
+    .mark: state_3681
+    iinc 1
+    jump state_3679
+    .mark: state_3682
+    iinc 1
+    jump state_3684
+    .mark: state_3683
+    iinc 1
+    jump state_3681
+    .mark: state_3684
+    iinc 1
+    jump state_3686
+    .mark: state_3685
+    iinc 1
+    jump state_3683
+    .mark: state_3686
+    iinc 1
+    jump state_3688
+    .mark: state_3687
+    iinc 1
+    jump state_3685
+    .mark: state_3688
+    iinc 1
+    jump state_3690
+    .mark: state_3689
+    iinc 1
+    jump state_3687
+    .mark: state_3690
+    iinc 1
+    jump state_3692
+    .mark: state_3691
+    iinc 1
+    jump state_3689
+    .mark: state_3692
+    iinc 1
+    jump state_3694
+    .mark: state_3693
+    iinc 1
+    jump state_3691
+    .mark: state_3694
+    iinc 1
+    jump state_3696
+    .mark: state_3695
+    iinc 1
+    jump state_3693
+    .mark: state_3696
+    iinc 1
+    jump state_3698
+    .mark: state_3697
+    iinc 1
+    jump state_3695
+    .mark: state_3698
+    iinc 1
+    jump state_3700
+    .mark: state_3699
+    iinc 1
+    jump state_3697
+    .mark: state_3700
+    iinc 1
+    jump state_3702
+    .mark: state_3701
+    iinc 1
+    jump state_3699
+    .mark: state_3702
+    iinc 1
+    jump state_3704
+    .mark: state_3703
+    iinc 1
+    jump state_3701
+    .mark: state_3704
+    iinc 1
+    jump state_3706
+    .mark: state_3705
+    iinc 1
+    jump state_3703
+    .mark: state_3706
+    iinc 1
+    jump state_3708
+    .mark: state_3707
+    iinc 1
+    jump state_3705
+    .mark: state_3708
+    iinc 1
+    jump state_3710
+    .mark: state_3709
+    iinc 1
+    jump state_3707
+    .mark: state_3710
+    iinc 1
+    jump state_3712
+    .mark: state_3711
+    iinc 1
+    jump state_3709
+    .mark: state_3712
+    iinc 1
+    jump state_3714
+    .mark: state_3713
+    iinc 1
+    jump state_3711
+    .mark: state_3714
+    iinc 1
+    jump state_3716
+    .mark: state_3715
+    iinc 1
+    jump state_3713
+    .mark: state_3716
+    iinc 1
+    jump state_3718
+    .mark: state_3717
+    iinc 1
+    jump state_3715
+    .mark: state_3718
+    iinc 1
+    jump state_3720
+    .mark: state_3719
+    iinc 1
+    jump state_3717
+    .mark: state_3720
+    iinc 1
+    jump state_3722
+    .mark: state_3721
+    iinc 1
+    jump state_3719
+    .mark: state_3722
+    iinc 1
+    jump state_3724
+    .mark: state_3723
+    iinc 1
+    jump state_3721
+    .mark: state_3724
+    iinc 1
+    jump state_3726
+    .mark: state_3725
+    iinc 1
+    jump state_3723
+    .mark: state_3726
+    iinc 1
+    jump state_3728
+    .mark: state_3727
+    iinc 1
+    jump state_3725
+    .mark: state_3728
+    iinc 1
+    jump state_3730
+    .mark: state_3729
+    iinc 1
+    jump state_3727
+    .mark: state_3730
+    iinc 1
+    jump state_3732
+    .mark: state_3731
+    iinc 1
+    jump state_3729
+    .mark: state_3732
+    iinc 1
+    jump state_3734
+    .mark: state_3733
+    iinc 1
+    jump state_3731
+    .mark: state_3734
+    iinc 1
+    jump state_3736
+    .mark: state_3735
+    iinc 1
+    jump state_3733
+    .mark: state_3736
+    iinc 1
+    jump state_3738
+    .mark: state_3737
+    iinc 1
+    jump state_3735
+    .mark: state_3738
+    iinc 1
+    jump state_3740
+    .mark: state_3739
+    iinc 1
+    jump state_3737
+    .mark: state_3740
+    iinc 1
+    jump state_3742
+    .mark: state_3741
+    iinc 1
+    jump state_3739
+    .mark: state_3742
+    iinc 1
+    jump state_3744
+    .mark: state_3743
+    iinc 1
+    jump state_3741
+    .mark: state_3744
+    iinc 1
+    jump state_3746
+    .mark: state_3745
+    iinc 1
+    jump state_3743
+    .mark: state_3746
+    iinc 1
+    jump state_3748
+    .mark: state_3747
+    iinc 1
+    jump state_3745
+    .mark: state_3748
+    iinc 1
+    jump state_3750
+    .mark: state_3749
+    iinc 1
+    jump state_3747
+    .mark: state_3750
+    iinc 1
+    jump state_3752
+    .mark: state_3751
+    iinc 1
+    jump state_3749
+    .mark: state_3752
+    iinc 1
+    jump state_3754
+    .mark: state_3753
+    iinc 1
+    jump state_3751
+    .mark: state_3754
+    iinc 1
+    jump state_3756
+    .mark: state_3755
+    iinc 1
+    jump state_3753
+    .mark: state_3756
+    iinc 1
+    jump state_3758
+    .mark: state_3757
+    iinc 1
+    jump state_3755
+    .mark: state_3758
+    iinc 1
+    jump state_3760
+    .mark: state_3759
+    iinc 1
+    jump state_3757
+    .mark: state_3760
+    iinc 1
+    jump state_3762
+    .mark: state_3761
+    iinc 1
+    jump state_3759
+    .mark: state_3762
+    iinc 1
+    jump state_3764
+    .mark: state_3763
+    iinc 1
+    jump state_3761
+    .mark: state_3764
+    iinc 1
+    jump state_3766
+    .mark: state_3765
+    iinc 1
+    jump state_3763
+    .mark: state_3766
+    iinc 1
+    jump state_3768
+    .mark: state_3767
+    iinc 1
+    jump state_3765
+    .mark: state_3768
+    iinc 1
+    jump state_3770
+    .mark: state_3769
+    iinc 1
+    jump state_3767
+    .mark: state_3770
+    iinc 1
+    jump state_3772
+    .mark: state_3771
+    iinc 1
+    jump state_3769
+    .mark: state_3772
+    iinc 1
+    jump state_3774
+    .mark: state_3773
+    iinc 1
+    jump state_3771
+    .mark: state_3774
+    iinc 1
+    jump state_3776
+    .mark: state_3775
+    iinc 1
+    jump state_3773
+    .mark: state_3776
+    iinc 1
+    jump state_3778
+    .mark: state_3777
+    iinc 1
+    jump state_3775
+    .mark: state_3778
+    iinc 1
+    jump state_3780
+    .mark: state_3779
+    iinc 1
+    jump state_3777
+    .mark: state_3780
+    iinc 1
+    jump state_3782
+    .mark: state_3781
+    iinc 1
+    jump state_3779
+    .mark: state_3782
+    iinc 1
+    jump state_3784
+    .mark: state_3783
+    iinc 1
+    jump state_3781
+    .mark: state_3784
+    iinc 1
+    jump state_3786
+    .mark: state_3785
+    iinc 1
+    jump state_3783
+    .mark: state_3786
+    iinc 1
+    jump state_3788
+    .mark: state_3787
+    iinc 1
+    jump state_3785
+    .mark: state_3788
+    iinc 1
+    jump state_3790
+    .mark: state_3789
+    iinc 1
+    jump state_3787
+    .mark: state_3790
+    iinc 1
+    jump state_3792
+    .mark: state_3791
+    iinc 1
+    jump state_3789
+    .mark: state_3792
+    iinc 1
+    jump state_3794
+    .mark: state_3793
+    iinc 1
+    jump state_3791
+    .mark: state_3794
+    iinc 1
+    jump state_3796
+    .mark: state_3795
+    iinc 1
+    jump state_3793
+    .mark: state_3796
+    iinc 1
+    jump state_3798
+    .mark: state_3797
+    iinc 1
+    jump state_3795
+    .mark: state_3798
+    iinc 1
+    jump state_3800
+    .mark: state_3799
+    iinc 1
+    jump state_3797
+    .mark: state_3800
+    iinc 1
+    jump state_3802
+    .mark: state_3801
+    iinc 1
+    jump state_3799
+    .mark: state_3802
+    iinc 1
+    jump state_3804
+    .mark: state_3803
+    iinc 1
+    jump state_3801
+    .mark: state_3804
+    iinc 1
+    jump state_3806
+    .mark: state_3805
+    iinc 1
+    jump state_3803
+    .mark: state_3806
+    iinc 1
+    jump state_3808
+    .mark: state_3807
+    iinc 1
+    jump state_3805
+    .mark: state_3808
+    iinc 1
+    jump state_3810
+    .mark: state_3809
+    iinc 1
+    jump state_3807
+    .mark: state_3810
+    iinc 1
+    jump state_3812
+    .mark: state_3811
+    iinc 1
+    jump state_3809
+    .mark: state_3812
+    iinc 1
+    jump state_3814
+    .mark: state_3813
+    iinc 1
+    jump state_3811
+    .mark: state_3814
+    iinc 1
+    jump state_3816
+    .mark: state_3815
+    iinc 1
+    jump state_3813
+    .mark: state_3816
+    iinc 1
+    jump state_3818
+    .mark: state_3817
+    iinc 1
+    jump state_3815
+    .mark: state_3818
+    iinc 1
+    jump state_3820
+    .mark: state_3819
+    iinc 1
+    jump state_3817
+    .mark: state_3820
+    iinc 1
+    jump state_3822
+    .mark: state_3821
+    iinc 1
+    jump state_3819
+    .mark: state_3822
+    iinc 1
+    jump state_3824
+    .mark: state_3823
+    iinc 1
+    jump state_3821
+    .mark: state_3824
+    iinc 1
+    jump state_3826
+    .mark: state_3825
+    iinc 1
+    jump state_3823
+    .mark: state_3826
+    iinc 1
+    jump state_3828
+    .mark: state_3827
+    iinc 1
+    jump state_3825
+    .mark: state_3828
+    iinc 1
+    jump state_3830
+    .mark: state_3829
+    iinc 1
+    jump state_3827
+    .mark: state_3830
+    iinc 1
+    jump state_3832
+    .mark: state_3831
+    iinc 1
+    jump state_3829
+    .mark: state_3832
+    iinc 1
+    jump state_3834
+    .mark: state_3833
+    iinc 1
+    jump state_3831
+    .mark: state_3834
+    iinc 1
+    jump state_3836
+    .mark: state_3835
+    iinc 1
+    jump state_3833
+    .mark: state_3836
+    iinc 1
+    jump state_3838
+    .mark: state_3837
+    iinc 1
+    jump state_3835
+    .mark: state_3838
+    iinc 1
+    jump state_3840
+    .mark: state_3839
+    iinc 1
+    jump state_3837
+    .mark: state_3840
+    iinc 1
+    jump state_3842
+    .mark: state_3841
+    iinc 1
+    jump state_3839
+    .mark: state_3842
+    iinc 1
+    jump state_3844
+    .mark: state_3843
+    iinc 1
+    jump state_3841
+    .mark: state_3844
+    iinc 1
+    jump state_3846
+    .mark: state_3845
+    iinc 1
+    jump state_3843
+    .mark: state_3846
+    iinc 1
+    jump state_3848
+    .mark: state_3847
+    iinc 1
+    jump state_3845
+    .mark: state_3848
+    iinc 1
+    jump state_3850
+    .mark: state_3849
+    iinc 1
+    jump state_3847
+    .mark: state_3850
+    iinc 1
+    jump state_3852
+    .mark: state_3851
+    iinc 1
+    jump state_3849
+    .mark: state_3852
+    iinc 1
+    jump state_3854
+    .mark: state_3853
+    iinc 1
+    jump state_3851
+    .mark: state_3854
+    iinc 1
+    jump state_3856
+    .mark: state_3855
+    iinc 1
+    jump state_3853
+    .mark: state_3856
+    iinc 1
+    jump state_3858
+    .mark: state_3857
+    iinc 1
+    jump state_3855
+    .mark: state_3858
+    iinc 1
+    jump state_3860
+    .mark: state_3859
+    iinc 1
+    jump state_3857
+    .mark: state_3860
+    iinc 1
+    jump state_3862
+    .mark: state_3861
+    iinc 1
+    jump state_3859
+    .mark: state_3862
+    iinc 1
+    jump state_3864
+    .mark: state_3863
+    iinc 1
+    jump state_3861
+    .mark: state_3864
+    iinc 1
+    jump state_3866
+    .mark: state_3865
+    iinc 1
+    jump state_3863
+    .mark: state_3866
+    iinc 1
+    jump state_3868
+    .mark: state_3867
+    iinc 1
+    jump state_3865
+    .mark: state_3868
+    iinc 1
+    jump state_3870
+    .mark: state_3869
+    iinc 1
+    jump state_3867
+    .mark: state_3870
+    iinc 1
+    jump state_3872
+    .mark: state_3871
+    iinc 1
+    jump state_3869
+    .mark: state_3872
+    iinc 1
+    jump state_3874
+    .mark: state_3873
+    iinc 1
+    jump state_3871
+    .mark: state_3874
+    iinc 1
+    jump state_3876
+    .mark: state_3875
+    iinc 1
+    jump state_3873
+    .mark: state_3876
+    iinc 1
+    jump state_3878
+    .mark: state_3877
+    iinc 1
+    jump state_3875
+    .mark: state_3878
+    iinc 1
+    jump state_3880
+    .mark: state_3879
+    iinc 1
+    jump state_3877
+    .mark: state_3880
+    iinc 1
+    jump state_3882
+    .mark: state_3881
+    iinc 1
+    jump state_3879
+    .mark: state_3882
+    iinc 1
+    jump state_3884
+    .mark: state_3883
+    iinc 1
+    jump state_3881
+    .mark: state_3884
+    iinc 1
+    jump state_3886
+    .mark: state_3885
+    iinc 1
+    jump state_3883
+    .mark: state_3886
+    iinc 1
+    jump state_3888
+    .mark: state_3887
+    iinc 1
+    jump state_3885
+    .mark: state_3888
+    iinc 1
+    jump state_3890
+    .mark: state_3889
+    iinc 1
+    jump state_3887
+    .mark: state_3890
+    iinc 1
+    jump state_3892
+    .mark: state_3891
+    iinc 1
+    jump state_3889
+    .mark: state_3892
+    iinc 1
+    jump state_3894
+    .mark: state_3893
+    iinc 1
+    jump state_3891
+    .mark: state_3894
+    iinc 1
+    jump state_3896
+    .mark: state_3895
+    iinc 1
+    jump state_3893
+    .mark: state_3896
+    iinc 1
+    jump state_3898
+    .mark: state_3897
+    iinc 1
+    jump state_3895
+    .mark: state_3898
+    iinc 1
+    jump state_3900
+    .mark: state_3899
+    iinc 1
+    jump state_3897
+    .mark: state_3900
+    iinc 1
+    jump state_3902
+    .mark: state_3901
+    iinc 1
+    jump state_3899
+    .mark: state_3902
+    iinc 1
+    jump state_3904
+    .mark: state_3903
+    iinc 1
+    jump state_3901
+    .mark: state_3904
+    iinc 1
+    jump state_3906
+    .mark: state_3905
+    iinc 1
+    jump state_3903
+    .mark: state_3906
+    iinc 1
+    jump state_3908
+    .mark: state_3907
+    iinc 1
+    jump state_3905
+    .mark: state_3908
+    iinc 1
+    jump state_3910
+    .mark: state_3909
+    iinc 1
+    jump state_3907
+    .mark: state_3910
+    iinc 1
+    jump state_3912
+    .mark: state_3911
+    iinc 1
+    jump state_3909
+    .mark: state_3912
+    iinc 1
+    jump state_3914
+    .mark: state_3913
+    iinc 1
+    jump state_3911
+    .mark: state_3914
+    iinc 1
+    jump state_3916
+    .mark: state_3915
+    iinc 1
+    jump state_3913
+    .mark: state_3916
+    iinc 1
+    jump state_3918
+    .mark: state_3917
+    iinc 1
+    jump state_3915
+    .mark: state_3918
+    iinc 1
+    jump state_3920
+    .mark: state_3919
+    iinc 1
+    jump state_3917
+    .mark: state_3920
+    iinc 1
+    jump state_3922
+    .mark: state_3921
+    iinc 1
+    jump state_3919
+    .mark: state_3922
+    iinc 1
+    jump state_3924
+    .mark: state_3923
+    iinc 1
+    jump state_3921
+    .mark: state_3924
+    iinc 1
+    jump state_3926
+    .mark: state_3925
+    iinc 1
+    jump state_3923
+    .mark: state_3926
+    iinc 1
+    jump state_3928
+    .mark: state_3927
+    iinc 1
+    jump state_3925
+    .mark: state_3928
+    iinc 1
+    jump state_3930
+    .mark: state_3929
+    iinc 1
+    jump state_3927
+    .mark: state_3930
+    iinc 1
+    jump state_3932
+    .mark: state_3931
+    iinc 1
+    jump state_3929
+    .mark: state_3932
+    iinc 1
+    jump state_3934
+    .mark: state_3933
+    iinc 1
+    jump state_3931
+    .mark: state_3934
+    iinc 1
+    jump state_3936
+    .mark: state_3935
+    iinc 1
+    jump state_3933
+    .mark: state_3936
+    iinc 1
+    jump state_3938
+    .mark: state_3937
+    iinc 1
+    jump state_3935
+    .mark: state_3938
+    iinc 1
+    jump state_3940
+    .mark: state_3939
+    iinc 1
+    jump state_3937
+    .mark: state_3940
+    iinc 1
+    jump state_3942
+    .mark: state_3941
+    iinc 1
+    jump state_3939
+    .mark: state_3942
+    iinc 1
+    jump state_3944
+    .mark: state_3943
+    iinc 1
+    jump state_3941
+    .mark: state_3944
+    iinc 1
+    jump state_3946
+    .mark: state_3945
+    iinc 1
+    jump state_3943
+    .mark: state_3946
+    iinc 1
+    jump state_3948
+    .mark: state_3947
+    iinc 1
+    jump state_3945
+    .mark: state_3948
+    iinc 1
+    jump state_3950
+    .mark: state_3949
+    iinc 1
+    jump state_3947
+    .mark: state_3950
+    iinc 1
+    jump state_3952
+    .mark: state_3951
+    iinc 1
+    jump state_3949
+    .mark: state_3952
+    iinc 1
+    jump state_3954
+    .mark: state_3953
+    iinc 1
+    jump state_3951
+    .mark: state_3954
+    iinc 1
+    jump state_3956
+    .mark: state_3955
+    iinc 1
+    jump state_3953
+    .mark: state_3956
+    iinc 1
+    jump state_3958
+    .mark: state_3957
+    iinc 1
+    jump state_3955
+    .mark: state_3958
+    iinc 1
+    jump state_3960
+    .mark: state_3959
+    iinc 1
+    jump state_3957
+    .mark: state_3960
+    iinc 1
+    jump state_3962
+    .mark: state_3961
+    iinc 1
+    jump state_3959
+    .mark: state_3962
+    iinc 1
+    jump state_3964
+    .mark: state_3963
+    iinc 1
+    jump state_3961
+    .mark: state_3964
+    iinc 1
+    jump state_3966
+    .mark: state_3965
+    iinc 1
+    jump state_3963
+    .mark: state_3966
+    iinc 1
+    jump state_3968
+    .mark: state_3967
+    iinc 1
+    jump state_3965
+    .mark: state_3968
+    iinc 1
+    jump state_3970
+    .mark: state_3969
+    iinc 1
+    jump state_3967
+    .mark: state_3970
+    iinc 1
+    jump state_3972
+    .mark: state_3971
+    iinc 1
+    jump state_3969
+    .mark: state_3972
+    iinc 1
+    jump state_3974
+    .mark: state_3973
+    iinc 1
+    jump state_3971
+    .mark: state_3974
+    iinc 1
+    jump state_3976
+    .mark: state_3975
+    iinc 1
+    jump state_3973
+    .mark: state_3976
+    iinc 1
+    jump state_3978
+    .mark: state_3977
+    iinc 1
+    jump state_3975
+    .mark: state_3978
+    iinc 1
+    jump state_3980
+    .mark: state_3979
+    iinc 1
+    jump state_3977
+    .mark: state_3980
+    iinc 1
+    jump state_3982
+    .mark: state_3981
+    iinc 1
+    jump state_3979
+    .mark: state_3982
+    iinc 1
+    jump state_3984
+    .mark: state_3983
+    iinc 1
+    jump state_3981
+    .mark: state_3984
+    iinc 1
+    jump state_3986
+    .mark: state_3985
+    iinc 1
+    jump state_3983
+    .mark: state_3986
+    iinc 1
+    jump state_3988
+    .mark: state_3987
+    iinc 1
+    jump state_3985
+    .mark: state_3988
+    iinc 1
+    jump state_3990
+    .mark: state_3989
+    iinc 1
+    jump state_3987
+    .mark: state_3990
+    iinc 1
+    jump state_3992
+    .mark: state_3991
+    iinc 1
+    jump state_3989
+    .mark: state_3992
+    iinc 1
+    jump state_3994
+    .mark: state_3993
+    iinc 1
+    jump state_3991
+    .mark: state_3994
+    iinc 1
+    jump state_3996
+    .mark: state_3995
+    iinc 1
+    jump state_3993
+    .mark: state_3996
+    iinc 1
+    jump state_3998
+    .mark: state_3997
+    iinc 1
+    jump state_3995
+    .mark: state_3998
+    iinc 1
+    jump state_4000
+    .mark: state_3999
+    iinc 1
+    jump state_3997
+    .mark: state_4000
+    jump state_3999
+    .mark: state_-1
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,2705 @@
+.function: main
+    frame 0
+    call f0
+    frame 0
+    call f1
+    frame 0
+    call f2
+    frame 0
+    call f3
+    frame 0
+    call f4
+    frame 0
+    call f5
+    frame 0
+    call f6
+    frame 0
+    call f7
+    frame 0
+    call f8
+    frame 0
+    call f9
+    frame 0
+    call f10
+    frame 0
+    call f11
+    frame 0
+    call f12
+    frame 0
+    call f13
+    frame 0
+    call f14
+    frame 0
+    call f15
+    frame 0
+    call f16
+    frame 0
+    call f17
+    frame 0
+    call f18
+    frame 0
+    call f19
+    frame 0
+    call f20
+    frame 0
+    call f21
+    frame 0
+    call f22
+    frame 0
+    call f23
+    frame 0
+    call f24
+    frame 0
+    call f25
+    frame 0
+    call f26
+    frame 0
+    call f27
+    frame 0
+    call f28
+    frame 0
+    call f29
+    frame 0
+    call f30
+    frame 0
+    call f31
+    frame 0
+    call f32
+    frame 0
+    call f33
+    frame 0
+    call f34
+    frame 0
+    call f35
+    frame 0
+    call f36
+    frame 0
+    call f37
+    frame 0
+    call f38
+    frame 0
+    call f39
+    frame 0
+    call f40
+    frame 0
+    call f41
+    frame 0
+    call f42
+    frame 0
+    call f43
+    frame 0
+    call f44
+    frame 0
+    call f45
+    frame 0
+    call f46
+    frame 0
+    call f47
+    frame 0
+    call f48
+    frame 0
+    call f49
+    frame 0
+    call f50
+    frame 0
+    call f51
+    frame 0
+    call f52
+    frame 0
+    call f53
+    frame 0
+    call f54
+    frame 0
+    call f55
+    frame 0
+    call f56
+    frame 0
+    call f57
+    frame 0
+    call f58
+    frame 0
+    call f59
+    frame 0
+    call f60
+    frame 0
+    call f61
+    frame 0
+    call f62
+    frame 0
+    call f63
+    frame 0
+    call f64
+    frame 0
+    call f65
+    frame 0
+    call f66
+    frame 0
+    call f67
+    frame 0
+    call f68
+    frame 0
+    call f69
+    frame 0
+    call f70
+    frame 0
+    call f71
+    frame 0
+    call f72
+    frame 0
+    call f73
+    frame 0
+    call f74
+    frame 0
+    call f75
+    frame 0
+    call f76
+    frame 0
+    call f77
+    frame 0
+    call f78
+    frame 0
+    call f79
+    frame 0
+    call f80
+    frame 0
+    call f81
+    frame 0
+    call f82
+    frame 0
+    call f83
+    frame 0
+    call f84
+    frame 0
+    call f85
+    frame 0
+    call f86
+    frame 0
+    call f87
+    frame 0
+    call f88
+    frame 0
+    call f89
+    frame 0
+    call f90
+    frame 0
+    call f91
+    frame 0
+    call f92
+    frame 0
+    call f93
+    frame 0
+    call f94
+    frame 0
+    call f95
+    frame 0
+    call f96
+    frame 0
+    call f97
+    frame 0
+    call f98
+    frame 0
+    call f99
+    frame 0
+    call f100
+    frame 0
+    call f101
+    frame 0
+    call f102
+    frame 0
+    call f103
+    frame 0
+    call f104
+    frame 0
+    call f105
+    frame 0
+    call f106
+    frame 0
+    call f107
+    frame 0
+    call f108
+    frame 0
+    call f109
+    frame 0
+    call f110
+    frame 0
+    call f111
+    frame 0
+    call f112
+    frame 0
+    call f113
+    frame 0
+    call f114
+    frame 0
+    call f115
+    frame 0
+    call f116
+    frame 0
+    call f117
+    frame 0
+    call f118
+    frame 0
+    call f119
+    frame 0
+    call f120
+    frame 0
+    call f121
+    frame 0
+    call f122
+    frame 0
+    call f123
+    frame 0
+    call f124
+    frame 0
+    call f125
+    frame 0
+    call f126
+    frame 0
+    call f127
+    frame 0
+    call f128
+    frame 0
+    call f129
+    frame 0
+    call f130
+    frame 0
+    call f131
+    frame 0
+    call f132
+    frame 0
+    call f133
+    frame 0
+    call f134
+    frame 0
+    call f135
+    frame 0
+    call f136
+    frame 0
+    call f137
+    frame 0
+    call f138
+    frame 0
+    call f139
+    frame 0
+    call f140
+    frame 0
+    call f141
+    frame 0
+    call f142
+    frame 0
+    call f143
+    frame 0
+    call f144
+    frame 0
+    call f145
+    frame 0
+    call f146
+    frame 0
+    call f147
+    frame 0
+    call f148
+    frame 0
+    call f149
+    frame 0
+    call f150
+    frame 0
+    call f151
+    frame 0
+    call f152
+    frame 0
+    call f153
+    frame 0
+    call f154
+    frame 0
+    call f155
+    frame 0
+    call f156
+    frame 0
+    call f157
+    frame 0
+    call f158
+    frame 0
+    call f159
+    frame 0
+    call f160
+    frame 0
+    call f161
+    frame 0
+    call f162
+    frame 0
+    call f163
+    frame 0
+    call f164
+    frame 0
+    call f165
+    frame 0
+    call f166
+    frame 0
+    call f167
+    frame 0
+    call f168
+    frame 0
+    call f169
+    frame 0
+    call f170
+    frame 0
+    call f171
+    frame 0
+    call f172
+    frame 0
+    call f173
+    frame 0
+    call f174
+    frame 0
+    call f175
+    frame 0
+    call f176
+    frame 0
+    call f177
+    frame 0
+    call f178
+    frame 0
+    call f179
+    frame 0
+    call f180
+    frame 0
+    call f181
+    frame 0
+    call f182
+    frame 0
+    call f183
+    frame 0
+    call f184
+    frame 0
+    call f185
+    frame 0
+    call f186
+    frame 0
+    call f187
+    frame 0
+    call f188
+    frame 0
+    call f189
+    frame 0
+    call f190
+    frame 0
+    call f191
+    frame 0
+    call f192
+    frame 0
+    call f193
+    frame 0
+    call f194
+    frame 0
+    call f195
+    frame 0
+    call f196
+    frame 0
+    call f197
+    frame 0
+    call f198
+    frame 0
+    call f199
+    frame 0
+    call f200
+    frame 0
+    call f201
+    frame 0
+    call f202
+    frame 0
+    call f203
+    frame 0
+    call f204
+    frame 0
+    call f205
+    frame 0
+    call f206
+    frame 0
+    call f207
+    frame 0
+    call f208
+    frame 0
+    call f209
+    frame 0
+    call f210
+    frame 0
+    call f211
+    frame 0
+    call f212
+    frame 0
+    call f213
+    frame 0
+    call f214
+    frame 0
+    call f215
+    frame 0
+    call f216
+    frame 0
+    call f217
+    frame 0
+    call f218
+    frame 0
+    call f219
+    frame 0
+    call f220
+    frame 0
+    call f221
+    frame 0
+    call f222
+    frame 0
+    call f223
+    frame 0
+    call f224
+    frame 0
+    call f225
+    frame 0
+    call f226
+    frame 0
+    call f227
+    frame 0
+    call f228
+    frame 0
+    call f229
+    frame 0
+    call f230
+    frame 0
+    call f231
+    frame 0
+    call f232
+    frame 0
+    call f233
+    frame 0
+    call f234
+    frame 0
+    call f235
+    frame 0
+    call f236
+    frame 0
+    call f237
+    frame 0
+    call f238
+    frame 0
+    call f239
+    frame 0
+    call f240
+    frame 0
+    call f241
+    frame 0
+    call f242
+    frame 0
+    call f243
+    frame 0
+    call f244
+    frame 0
+    call f245
+    frame 0
+    call f246
+    frame 0
+    call f247
+    frame 0
+    call f248
+    frame 0
+    call f249
+    frame 0
+    call f250
+    frame 0
+    call f251
+    frame 0
+    call f252
+    frame 0
+    call f253
+    frame 0
+    call f254
+    frame 0
+    call f255
+    frame 0
+    call f256
+    frame 0
+    call f257
+    frame 0
+    call f258
+    frame 0
+    call f259
+    frame 0
+    call f260
+    frame 0
+    call f261
+    frame 0
+    call f262
+    frame 0
+    call f263
+    frame 0
+    call f264
+    frame 0
+    call f265
+    frame 0
+    call f266
+    frame 0
+    call f267
+    frame 0
+    call f268
+    frame 0
+    call f269
+    frame 0
+    call f270
+    frame 0
+    call f271
+    frame 0
+    call f272
+    frame 0
+    call f273
+    frame 0
+    call f274
+    frame 0
+    call f275
+    frame 0
+    call f276
+    frame 0
+    call f277
+    frame 0
+    call f278
+    frame 0
+    call f279
+    frame 0
+    call f280
+    frame 0
+    call f281
+    frame 0
+    call f282
+    frame 0
+    call f283
+    frame 0
+    call f284
+    frame 0
+    call f285
+    frame 0
+    call f286
+    frame 0
+    call f287
+    frame 0
+    call f288
+    frame 0
+    call f289
+    frame 0
+    call f290
+    frame 0
+    call f291
+    frame 0
+    call f292
+    frame 0
+    call f293
+    frame 0
+    call f294
+    frame 0
+    call f295
+    frame 0
+    call f296
+    frame 0
+    call f297
+    frame 0
+    call f298
+    frame 0
+    call f299
+    izero 0
+    end
+.end
+
+.function: f0
+    strstore 1 "s0"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f1
+    strstore 1 "s1"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f2
+    strstore 1 "s2"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f3
+    strstore 1 "s3"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f4
+    strstore 1 "s4"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f5
+    strstore 1 "s5"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f6
+    strstore 1 "s6"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f7
+    strstore 1 "s7"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f8
+    strstore 1 "s8"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f9
+    strstore 1 "s9"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f10
+    strstore 1 "s10"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f11
+    strstore 1 "s11"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f12
+    strstore 1 "s12"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f13
+    strstore 1 "s13"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f14
+    strstore 1 "s14"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f15
+    strstore 1 "s15"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f16
+    strstore 1 "s16"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f17
+    strstore 1 "s17"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f18
+    strstore 1 "s18"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f19
+    strstore 1 "s19"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f20
+    strstore 1 "s20"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f21
+    strstore 1 "s21"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f22
+    strstore 1 "s22"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f23
+    strstore 1 "s23"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f24
+    strstore 1 "s24"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f25
+    strstore 1 "s25"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f26
+    strstore 1 "s26"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f27
+    strstore 1 "s27"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f28
+    strstore 1 "s28"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f29
+    strstore 1 "s29"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f30
+    strstore 1 "s30"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f31
+    strstore 1 "s31"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f32
+    strstore 1 "s32"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f33
+    strstore 1 "s33"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f34
+    strstore 1 "s34"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f35
+    strstore 1 "s35"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f36
+    strstore 1 "s36"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f37
+    strstore 1 "s37"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f38
+    strstore 1 "s38"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f39
+    strstore 1 "s39"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f40
+    strstore 1 "s40"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f41
+    strstore 1 "s41"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f42
+    strstore 1 "s42"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f43
+    strstore 1 "s43"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f44
+    strstore 1 "s44"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f45
+    strstore 1 "s45"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f46
+    strstore 1 "s46"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f47
+    strstore 1 "s47"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f48
+    strstore 1 "s48"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f49
+    strstore 1 "s49"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f50
+    strstore 1 "s50"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f51
+    strstore 1 "s51"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f52
+    strstore 1 "s52"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f53
+    strstore 1 "s53"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f54
+    strstore 1 "s54"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f55
+    strstore 1 "s55"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f56
+    strstore 1 "s56"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f57
+    strstore 1 "s57"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f58
+    strstore 1 "s58"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f59
+    strstore 1 "s59"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f60
+    strstore 1 "s60"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f61
+    strstore 1 "s61"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f62
+    strstore 1 "s62"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f63
+    strstore 1 "s63"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f64
+    strstore 1 "s64"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f65
+    strstore 1 "s65"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f66
+    strstore 1 "s66"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f67
+    strstore 1 "s67"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f68
+    strstore 1 "s68"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f69
+    strstore 1 "s69"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f70
+    strstore 1 "s70"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f71
+    strstore 1 "s71"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f72
+    strstore 1 "s72"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f73
+    strstore 1 "s73"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f74
+    strstore 1 "s74"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f75
+    strstore 1 "s75"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f76
+    strstore 1 "s76"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f77
+    strstore 1 "s77"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f78
+    strstore 1 "s78"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f79
+    strstore 1 "s79"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f80
+    strstore 1 "s80"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f81
+    strstore 1 "s81"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f82
+    strstore 1 "s82"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f83
+    strstore 1 "s83"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f84
+    strstore 1 "s84"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f85
+    strstore 1 "s85"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f86
+    strstore 1 "s86"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f87
+    strstore 1 "s87"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f88
+    strstore 1 "s88"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f89
+    strstore 1 "s89"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f90
+    strstore 1 "s90"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f91
+    strstore 1 "s91"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f92
+    strstore 1 "s92"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f93
+    strstore 1 "s93"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f94
+    strstore 1 "s94"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f95
+    strstore 1 "s95"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f96
+    strstore 1 "s96"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f97
+    strstore 1 "s97"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f98
+    strstore 1 "s98"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f99
+    strstore 1 "s99"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f100
+    strstore 1 "s100"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f101
+    strstore 1 "s101"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f102
+    strstore 1 "s102"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f103
+    strstore 1 "s103"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f104
+    strstore 1 "s104"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f105
+    strstore 1 "s105"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f106
+    strstore 1 "s106"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f107
+    strstore 1 "s107"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f108
+    strstore 1 "s108"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f109
+    strstore 1 "s109"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f110
+    strstore 1 "s110"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f111
+    strstore 1 "s111"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f112
+    strstore 1 "s112"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f113
+    strstore 1 "s113"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f114
+    strstore 1 "s114"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f115
+    strstore 1 "s115"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f116
+    strstore 1 "s116"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f117
+    strstore 1 "s117"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f118
+    strstore 1 "s118"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f119
+    strstore 1 "s119"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f120
+    strstore 1 "s120"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f121
+    strstore 1 "s121"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f122
+    strstore 1 "s122"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f123
+    strstore 1 "s123"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f124
+    strstore 1 "s124"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f125
+    strstore 1 "s125"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f126
+    strstore 1 "s126"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f127
+    strstore 1 "s127"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f128
+    strstore 1 "s128"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f129
+    strstore 1 "s129"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f130
+    strstore 1 "s130"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f131
+    strstore 1 "s131"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f132
+    strstore 1 "s132"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f133
+    strstore 1 "s133"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f134
+    strstore 1 "s134"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f135
+    strstore 1 "s135"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f136
+    strstore 1 "s136"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f137
+    strstore 1 "s137"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f138
+    strstore 1 "s138"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f139
+    strstore 1 "s139"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f140
+    strstore 1 "s140"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f141
+    strstore 1 "s141"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f142
+    strstore 1 "s142"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f143
+    strstore 1 "s143"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f144
+    strstore 1 "s144"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f145
+    strstore 1 "s145"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f146
+    strstore 1 "s146"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f147
+    strstore 1 "s147"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f148
+    strstore 1 "s148"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f149
+    strstore 1 "s149"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f150
+    strstore 1 "s150"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f151
+    strstore 1 "s151"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f152
+    strstore 1 "s152"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f153
+    strstore 1 "s153"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f154
+    strstore 1 "s154"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f155
+    strstore 1 "s155"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f156
+    strstore 1 "s156"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f157
+    strstore 1 "s157"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f158
+    strstore 1 "s158"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f159
+    strstore 1 "s159"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f160
+    strstore 1 "s160"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f161
+    strstore 1 "s161"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f162
+    strstore 1 "s162"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f163
+    strstore 1 "s163"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f164
+    strstore 1 "s164"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f165
+    strstore 1 "s165"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f166
+    strstore 1 "s166"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f167
+    strstore 1 "s167"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f168
+    strstore 1 "s168"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f169
+    strstore 1 "s169"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f170
+    strstore 1 "s170"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f171
+    strstore 1 "s171"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f172
+    strstore 1 "s172"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f173
+    strstore 1 "s173"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f174
+    strstore 1 "s174"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f175
+    strstore 1 "s175"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f176
+    strstore 1 "s176"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f177
+    strstore 1 "s177"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f178
+    strstore 1 "s178"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f179
+    strstore 1 "s179"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f180
+    strstore 1 "s180"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f181
+    strstore 1 "s181"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f182
+    strstore 1 "s182"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f183
+    strstore 1 "s183"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f184
+    strstore 1 "s184"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f185
+    strstore 1 "s185"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f186
+    strstore 1 "s186"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f187
+    strstore 1 "s187"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f188
+    strstore 1 "s188"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f189
+    strstore 1 "s189"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f190
+    strstore 1 "s190"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f191
+    strstore 1 "s191"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f192
+    strstore 1 "s192"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f193
+    strstore 1 "s193"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f194
+    strstore 1 "s194"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f195
+    strstore 1 "s195"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f196
+    strstore 1 "s196"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f197
+    strstore 1 "s197"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f198
+    strstore 1 "s198"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f199
+    strstore 1 "s199"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f200
+    strstore 1 "s200"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f201
+    strstore 1 "s201"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f202
+    strstore 1 "s202"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f203
+    strstore 1 "s203"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f204
+    strstore 1 "s204"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f205
+    strstore 1 "s205"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f206
+    strstore 1 "s206"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f207
+    strstore 1 "s207"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f208
+    strstore 1 "s208"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f209
+    strstore 1 "s209"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f210
+    strstore 1 "s210"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f211
+    strstore 1 "s211"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f212
+    strstore 1 "s212"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f213
+    strstore 1 "s213"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f214
+    strstore 1 "s214"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f215
+    strstore 1 "s215"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f216
+    strstore 1 "s216"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f217
+    strstore 1 "s217"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f218
+    strstore 1 "s218"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f219
+    strstore 1 "s219"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f220
+    strstore 1 "s220"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f221
+    strstore 1 "s221"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f222
+    strstore 1 "s222"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f223
+    strstore 1 "s223"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f224
+    strstore 1 "s224"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f225
+    strstore 1 "s225"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f226
+    strstore 1 "s226"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f227
+    strstore 1 "s227"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f228
+    strstore 1 "s228"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f229
+    strstore 1 "s229"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f230
+    strstore 1 "s230"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f231
+    strstore 1 "s231"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f232
+    strstore 1 "s232"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f233
+    strstore 1 "s233"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f234
+    strstore 1 "s234"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f235
+    strstore 1 "s235"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f236
+    strstore 1 "s236"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f237
+    strstore 1 "s237"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f238
+    strstore 1 "s238"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f239
+    strstore 1 "s239"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f240
+    strstore 1 "s240"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f241
+    strstore 1 "s241"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f242
+    strstore 1 "s242"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f243
+    strstore 1 "s243"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f244
+    strstore 1 "s244"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f245
+    strstore 1 "s245"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f246
+    strstore 1 "s246"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f247
+    strstore 1 "s247"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f248
+    strstore 1 "s248"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f249
+    strstore 1 "s249"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f250
+    strstore 1 "s250"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f251
+    strstore 1 "s251"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f252
+    strstore 1 "s252"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f253
+    strstore 1 "s253"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f254
+    strstore 1 "s254"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f255
+    strstore 1 "s255"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f256
+    strstore 1 "s256"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f257
+    strstore 1 "s257"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f258
+    strstore 1 "s258"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f259
+    strstore 1 "s259"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f260
+    strstore 1 "s260"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f261
+    strstore 1 "s261"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f262
+    strstore 1 "s262"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f263
+    strstore 1 "s263"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f264
+    strstore 1 "s264"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f265
+    strstore 1 "s265"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f266
+    strstore 1 "s266"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f267
+    strstore 1 "s267"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f268
+    strstore 1 "s268"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f269
+    strstore 1 "s269"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f270
+    strstore 1 "s270"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f271
+    strstore 1 "s271"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f272
+    strstore 1 "s272"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f273
+    strstore 1 "s273"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f274
+    strstore 1 "s274"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f275
+    strstore 1 "s275"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f276
+    strstore 1 "s276"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f277
+    strstore 1 "s277"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f278
+    strstore 1 "s278"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f279
+    strstore 1 "s279"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f280
+    strstore 1 "s280"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f281
+    strstore 1 "s281"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f282
+    strstore 1 "s282"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f283
+    strstore 1 "s283"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f284
+    strstore 1 "s284"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f285
+    strstore 1 "s285"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f286
+    strstore 1 "s286"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f287
+    strstore 1 "s287"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f288
+    strstore 1 "s288"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f289
+    strstore 1 "s289"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f290
+    strstore 1 "s290"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f291
+    strstore 1 "s291"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f292
+    strstore 1 "s292"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
+.function: f293
+    strstore 1 "s293"
+    atom 2 'a6'
+    fstore 3 6.5
+    end
+.end
+
+.function: f294
+    strstore 1 "s294"
+    atom 2 'a0'
+    fstore 3 0.5
+    end
+.end
+
+.function: f295
+    strstore 1 "s295"
+    atom 2 'a1'
+    fstore 3 1.5
+    end
+.end
+
+.function: f296
+    strstore 1 "s296"
+    atom 2 'a2'
+    fstore 3 2.5
+    end
+.end
+
+.function: f297
+    strstore 1 "s297"
+    atom 2 'a3'
+    fstore 3 3.5
+    end
+.end
+
+.function: f298
+    strstore 1 "s298"
+    atom 2 'a4'
+    fstore 3 4.5
+    end
+.end
+
+.function: f299
+    strstore 1 "s299"
+    atom 2 'a5'
+    fstore 3 5.5
+    end
+.end
+
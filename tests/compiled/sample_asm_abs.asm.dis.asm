@@ -0,0 +1,12 @@
+.function: main
+    istore 1 -17
+    istore 2 0
+    ilt 3 1 2
+    not 3
+    branch 3 0x2a 0x1e
+    istore 4 -1
+    imul 1 4 1
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,15 @@
+.function: hey_im_absolute
+    strstore 1 "Hey babe, I'm absolute."
+    jump 0x19
+    print 1
+    izero 0
+    end
+.end
+
+.function: main
+    strstore 1 "My morals are relative."
+    jump 0x0
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,39 @@
+.block: handle_ok
+    pull 2
+    print 2
+    leave
+.end
+
+.block: handle_any_atom
+    pull 2
+    strstore 3 "any atom"
+    print 3
+    leave
+.end
+
+.block: throw_atom
+    arg 1 0
+    throw 1
+    leave
+.end
+
+.function: catch_atom
+    tryframe
+    catch "'ok'" handle_ok
+    catch "Atom" handle_any_atom
+    try throw_atom
+    end
+.end
+
+.function: main
+    atom 1 'ok'
+    frame 1 16
+    param 0 1
+    call 0 catch_atom
+    atom 1 'error'
+    frame 1 16
+    param 0 1
+    call 0 catch_atom
+    izero 0
+    end
+.end
@@ -0,0 +1,12 @@
+.function: main
+    atom 1 'ok'
+    atom 2 'ok'
+    atom 3 'error'
+    print 1
+    atomeq 4 1 2
+    print 4
+    atomeq 5 1 3
+    print 5
+    izero 0
+    end
+.end
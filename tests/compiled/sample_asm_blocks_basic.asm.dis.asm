@@ -0,0 +1,12 @@
+.block: main_block
+    istore 1 42
+    leave
+.end
+
+.function: main
+    tryframe
+    try main_block
+    print 1
+    izero 0
+    end
+.end
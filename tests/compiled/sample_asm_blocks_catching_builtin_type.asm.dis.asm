@@ -0,0 +1,19 @@
+.block: handle_integer
+    pull 2
+    print 2
+    leave
+.end
+
+.block: main_block
+    istore 1 42
+    throw 1
+    leave
+.end
+
+.function: main
+    tryframe
+    catch "Integer" handle_integer
+    try main_block
+    izero 0
+    end
+.end
@@ -0,0 +1,7 @@
+.function: main
+    fstore 1 3.14159
+    ftoi 2 1
+    print 2
+    izero 0
+    end
+.end
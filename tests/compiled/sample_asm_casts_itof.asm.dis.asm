@@ -0,0 +1,7 @@
+.function: main
+    istore 1 4
+    itof 2 1
+    print 2
+    izero 0
+    end
+.end
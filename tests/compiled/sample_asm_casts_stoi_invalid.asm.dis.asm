@@ -0,0 +1,22 @@
+.block: exception_handler
+    strstore 1 "exception encountered: "
+    pull 2
+    echo 1
+    print 2
+    leave
+.end
+
+.block: convert
+    strstore 1 "fourty two"
+    stoi 2 1
+    print 2
+    leave
+.end
+
+.function: main
+    tryframe
+    catch "Exception" exception_handler
+    try convert
+    izero 0
+    end
+.end
@@ -0,0 +1,7 @@
+.function: main
+    eximport "World"
+    frame 0 16
+    excall 0 World::print_hello
+    izero 0
+    end
+.end
@@ -0,0 +1,10 @@
+.function: main
+    fstore 1 3
+    eximport "math"
+    frame 1 16
+    param 0 1
+    excall 2 math::sqrt
+    print 2
+    izero 0
+    end
+.end
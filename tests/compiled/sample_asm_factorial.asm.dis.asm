@@ -0,0 +1,26 @@
+.function: factorial
+    arg 1 0
+    arg 2 1
+    imul 2 2 1
+    idec 1
+    istore 3 0
+    ieq 4 1 3
+    branch 4 0x3d 0x24
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 factorial
+    end
+.end
+
+.function: main
+    istore 1 8
+    istore 2 1
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 factorial
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,8 @@
+.function: main
+    fstore 1 3.99
+    fstore 2 3.98
+    fgt 1 1 2
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,8 @@
+.function: main
+    fstore 1 4
+    fstore 2 2.001
+    fmul 3 1 2
+    print 3
+    izero 0
+    end
+.end
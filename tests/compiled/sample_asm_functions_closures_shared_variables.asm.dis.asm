@@ -0,0 +1,40 @@
+.function: closure_a
+    print 2
+    end
+.end
+
+.function: closure_b
+    arg 1 0
+    istore 2 @1
+    end
+.end
+
+.function: returns_closures
+    vec 1
+    istore 2 42
+    clbind 2
+    closure 3 closure_a
+    clbind 2
+    closure 4 closure_b
+    vpush 1 3
+    vpush 1 4
+    move 0 1
+    end
+.end
+
+.function: main
+    frame 0 16
+    call 1 returns_closures
+    frame 0 0
+    vat 2 1 0
+    fcall 0 2
+    istore 4 69
+    frame 1 0
+    param 0 4
+    vat 3 1 1
+    fcall 0 3
+    frame 0 0
+    fcall 0 2
+    izero 0
+    end
+.end
@@ -0,0 +1,21 @@
+.function: foo
+    print 1
+    end
+.end
+
+.function: returns_closure
+    istore 1 42
+    clbind 1
+    closure 2 foo
+    move 0 2
+    end
+.end
+
+.function: main
+    frame 0 16
+    call 1 returns_closure
+    frame 0 0
+    fcall 0 1
+    izero 0
+    end
+.end
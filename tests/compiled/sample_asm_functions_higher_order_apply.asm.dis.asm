@@ -0,0 +1,27 @@
+.function: square
+    arg 1 0
+    imul 0 1 1
+    end
+.end
+
+.function: apply
+    arg 1 0
+    arg 2 1
+    frame 1 16
+    param 0 2
+    fcall 3 1
+    move 0 3
+    end
+.end
+
+.function: main
+    istore 1 5
+    function 2 square
+    frame 2 16
+    param 0 2
+    paref 1 1
+    call 3 apply
+    print 3
+    izero 0
+    end
+.end
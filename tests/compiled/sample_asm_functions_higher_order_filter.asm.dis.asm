@@ -0,0 +1,55 @@
+.function: is_divisible_by_2
+    arg 1 0
+    istore 2 2
+    ilt 3 1 2
+    branch 3 0x22 0x18
+    isub 1 1 2
+    jump 0x8
+    move 0 1
+    not 0
+    end
+.end
+
+.function: filter
+    arg 1 0
+    arg 2 1
+    vec 3
+    izero 4
+    vlen 5 2
+    igte 6 4 5
+    branch 6 0x77 0x4c
+    frame 1 16
+    vat 7 2 @4
+    param 0 7
+    fcall 8 1
+    branch 8 0x68 0x6c
+    vpush 3 7
+    empty 7
+    iinc 4
+    jump 0x3c
+    move 0 3
+    end
+.end
+
+.function: main
+    vec 1
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    print 1
+    function 3 is_divisible_by_2
+    frame 2 16
+    param 0 3
+    paref 1 1
+    call 4 filter
+    print 4
+    izero 0
+    end
+.end
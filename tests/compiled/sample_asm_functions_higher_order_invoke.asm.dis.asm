@@ -0,0 +1,58 @@
+.function: sum4
+    arg 1 0
+    arg 2 1
+    arg 3 2
+    arg 4 3
+    iadd 0 1 2
+    iadd 0 3 0
+    iadd 0 4 0
+    end
+.end
+
+.function: invoke
+    arg 1 0
+    arg 2 1
+    vlen 4 2
+    frame @4 16
+    izero 3
+    igte 5 3 4
+    branch 5 0x57 0x43
+    vat 7 2 @3
+    param @3 7
+    empty 7
+    iinc 3
+    jump 0x33
+    fcall 8 1
+    move 0 8
+    end
+.end
+
+.function: main
+    vec 1
+    istore 2 20
+    vpush 1 2
+    istore 3 16
+    vpush 1 3
+    istore 4 8
+    vpush 1 4
+    istore 5 -2
+    vpush 1 5
+    frame 4 16
+    param 0 2
+    param 1 3
+    param 2 4
+    param 3 5
+    call 6 sum4
+    print 6
+    function 7 sum4
+    istore 9 2
+    frame @9 16
+    izero 9
+    param @9 7
+    iinc 9
+    param @9 1
+    call 8 invoke
+    print 8
+    izero 0
+    end
+.end
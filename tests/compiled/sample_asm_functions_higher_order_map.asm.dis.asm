@@ -0,0 +1,58 @@
+.function: square
+    arg 1 0
+    imul 0 1 1
+    end
+.end
+
+.function: apply
+    arg 1 0
+    arg 2 1
+    frame 1 16
+    param 0 2
+    fcall 3 1
+    move 0 3
+    end
+.end
+
+.function: map
+    arg 1 0
+    arg 2 1
+    vec 3
+    izero 4
+    vlen 5 2
+    igte 6 4 5
+    branch 6 0x65 0x45
+    frame 1 16
+    vat 7 2 @4
+    param 0 7
+    fcall 8 1
+    vpush 3 8
+    empty 7
+    iinc 4
+    jump 0x35
+    move 0 3
+    end
+.end
+
+.function: main
+    vec 1
+    istore 2 1
+    vpush 1 2
+    istore 2 2
+    vpush 1 2
+    istore 2 3
+    vpush 1 2
+    istore 2 4
+    vpush 1 2
+    istore 2 5
+    vpush 1 2
+    print 1
+    function 3 square
+    frame 2 16
+    param 0 3
+    paref 1 1
+    call 4 map
+    print 4
+    izero 0
+    end
+.end
@@ -0,0 +1,36 @@
+.function: foo
+    istore 1 42
+    print 1
+    end
+.end
+
+.function: bar
+    istore 1 69
+    print 1
+    frame 0 16
+    call 0 foo
+    end
+.end
+
+.function: baz
+    istore 1 1995
+    print 1
+    frame 0 16
+    call 0 bar
+    end
+.end
+
+.function: bay
+    istore 1 2015
+    print 1
+    frame 0 16
+    call 0 baz
+    end
+.end
+
+.function: main
+    frame 0 16
+    call 0 bay
+    izero 0
+    end
+.end
@@ -0,0 +1,24 @@
+.function: rec__VOID__INT__INT
+    arg 1 0
+    arg 2 1
+    idec 1
+    ilt 3 1 2
+    branch 3 0x41 0x1b
+    print 1
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 rec__VOID__INT__INT
+    end
+.end
+
+.function: main
+    istore 1 10
+    istore 2 0
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 rec__VOID__INT__INT
+    izero 0
+    end
+.end
@@ -0,0 +1,15 @@
+.function: by_reference
+    arg 0 0
+    end
+.end
+
+.function: main
+    istore 1 69
+    frame 1 16
+    paref 0 1
+    call 2 by_reference
+    istore 2 42
+    print 1
+    izero 0
+    end
+.end
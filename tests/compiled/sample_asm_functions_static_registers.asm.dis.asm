@@ -0,0 +1,31 @@
+.function: counter
+    ress static
+    isnull 2 1
+    not 2
+    branch 2 0x24 0x17
+    istore 1 0
+    arg 3 0
+    jump 0x49
+    iinc 1
+    tmpri 1
+    ress local
+    tmpro 1
+    arg 3 0
+    ilt 4 1 3
+    not 4
+    branch 4 0x5f 0x49
+    print 1
+    frame 1 16
+    param 0 3
+    call 0 counter
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1 16
+    param 0 1
+    call 0 counter
+    izero 0
+    end
+.end
@@ -0,0 +1,9 @@
+.function: main
+    istore 1 42
+    istore 2 69
+    ilt 3 1 2
+    iadd 4 2 3
+    print 4
+    izero 0
+    end
+.end
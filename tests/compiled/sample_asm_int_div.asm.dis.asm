@@ -0,0 +1,8 @@
+.function: main
+    istore 1 4
+    istore 2 4
+    idiv 3 1 2
+    print 3
+    izero 0
+    end
+.end
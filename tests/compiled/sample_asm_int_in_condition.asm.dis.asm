@@ -0,0 +1,11 @@
+.function: main
+    istore 1 1
+    istore 2 0
+    istore 3 1
+    ieq 2 2 3
+    branch 1 0x1c 0x1f
+    not 2
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,7 @@
+.function: main
+    istore 1 0
+    iinc 1
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,8 @@
+.function: main
+    istore 1 2
+    istore 2 1
+    ilt 3 2 1
+    print 3
+    izero 0
+    end
+.end
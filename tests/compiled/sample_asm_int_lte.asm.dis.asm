@@ -0,0 +1,8 @@
+.function: main
+    istore 1 2
+    istore 2 1
+    ilte 3 2 1
+    print 3
+    izero 0
+    end
+.end
@@ -0,0 +1,13 @@
+.function: main
+    istore 1 166737
+    istore 2 176
+    istore 3 @1
+    ilt 4 1 2
+    branch 4 0x2e 0x1f
+    idiv 1 1 2
+    imul 1 1 2
+    isub 3 3 1
+    print 3
+    izero 0
+    end
+.end
@@ -0,0 +1,10 @@
+.function: main
+    istore 1 4
+    istore 2 4
+    istore 3 -15
+    imul 4 1 2
+    iadd 3 4 3
+    print 3
+    izero 0
+    end
+.end
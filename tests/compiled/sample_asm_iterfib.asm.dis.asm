@@ -0,0 +1,37 @@
+.function: iterfib
+    ress static
+    isnull 2 1
+    not 2
+    branch 2 0x26 0x17
+    vec 1
+    istore 2 1
+    vpush 1 2
+    vpush 1 2
+    arg 3 0
+    vlen 4 1
+    ilt 5 4 3
+    not 5
+    branch 5 0x65 0x41
+    vat 6 1 -1
+    vat 7 1 -2
+    iadd 8 6 7
+    vpush 1 8
+    empty 6
+    empty 7
+    jump 0x2a
+    vat 9 1 -1
+    copy 0 9
+    empty 9
+    end
+.end
+
+.function: main
+    istore 3 1134903170
+    istore 1 45
+    frame 1 16
+    param 0 1
+    call 2 iterfib
+    print 2
+    izero 0
+    end
+.end
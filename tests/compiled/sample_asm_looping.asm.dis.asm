@@ -0,0 +1,13 @@
+.function: main
+    istore 1 0
+    istore 2 10
+    ilt 3 1 2
+    not 3
+    branch 3 0x26 0x1b
+    print 1
+    iinc 1
+    jump 0x8
+    print 1
+    izero 0
+    end
+.end
@@ -0,0 +1,15 @@
+.function: main
+    istore 1 0
+    istore 2 0
+    ilti 3 1 10
+    branch 3 0x18 0x27
+    tiadd 2 2 1
+    iaddi 1 1 3
+    jump 0x8
+    print 2
+    itof 1 2
+    fmuli 1 1 0.5
+    print 1
+    izero 0
+    end
+.end
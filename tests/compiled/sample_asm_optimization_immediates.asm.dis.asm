@@ -0,0 +1,18 @@
+.function: main
+    istore 1 0
+    istore 2 0
+    istore 3 10
+    istore 4 3
+    fstore 5 0.5
+    ilt 6 1 3
+    branch 6 0x24 0x33
+    iadd 2 2 1
+    iadd 1 4 1
+    jump 0x14
+    print 2
+    itof 7 2
+    fmul 7 5 7
+    print 7
+    izero 0
+    end
+.end
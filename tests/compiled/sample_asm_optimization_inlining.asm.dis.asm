@@ -0,0 +1,43 @@
+.function: square
+    arg 1 0
+    imul 0 1 1
+    end
+.end
+
+.function: clamp
+    arg 1 0
+    istore 2 100
+    igt 3 1 2
+    branch 3 0x22 0x2b
+    copy 0 2
+    jump 0x2f
+    copy 0 1
+    iinc 2
+    idec 2
+    iinc 2
+    idec 2
+    iinc 2
+    idec 2
+    end
+.end
+
+.function: main
+    istore 1 7
+    frame 1 16
+    param 0 1
+    call 2 square
+    frame 1 16
+    param 0 2
+    call 3 square
+    frame 1 16
+    param 0 2
+    call 4 clamp
+    frame 1 16
+    param 0 3
+    call 5 clamp
+    print 2
+    print 4
+    print 5
+    izero 0
+    end
+.end
@@ -0,0 +1,13 @@
+.function: nothing
+    end
+.end
+
+.function: main
+    istore 1 6
+    istore 2 7
+    istore 3 42
+    ilti 4 1 7
+    print 3
+    izero 0
+    end
+.end
@@ -0,0 +1,19 @@
+.function: nothing
+    end
+.end
+
+.function: main
+    istore 1 6
+    istore 2 7
+    imul 3 1 2
+    ilt 4 1 2
+    branch 4 0x25 0x1e
+    strstore 5 "wrong"
+    print 5
+    frame 0 16
+    call 0 nothing
+    jump 0x39
+    print 3
+    izero 0
+    end
+.end
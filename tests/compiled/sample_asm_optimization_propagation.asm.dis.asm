@@ -0,0 +1,21 @@
+.function: main
+    istore 1 10
+    istore 2 3
+    imul 3 1 2
+    itof 4 3
+    fstore 5 0.5
+    fmul 6 4 5
+    istore 7 0
+    ilt 8 7 3
+    branch 8 0x2e 0x36
+    iinc 7
+    jump 0x1e
+    igt 9 3 1
+    branch 9 0x4d 0x46
+    strstore 10 "wrong"
+    print 10
+    print 7
+    print 6
+    izero 0
+    end
+.end
@@ -0,0 +1,24 @@
+.function: sum
+    arg 20 0
+    istore 30 0
+    istore 40 0
+    ilt 50 40 20
+    branch 50 0x1c 0x2d
+    iadd 60 30 40
+    move 30 60
+    iinc 40
+    jump 0xc
+    move 70 30
+    move 0 70
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1 128
+    param 0 1
+    call 2 sum
+    print 2
+    izero 0
+    end
+.end
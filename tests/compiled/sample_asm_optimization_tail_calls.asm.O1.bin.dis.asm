@@ -0,0 +1,49 @@
+.function: sum
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieqi 4 1 0
+    branch 4 0x34 0x1b
+    iadd 2 2 1
+    idec 1
+    frame 2 16
+    param 0 1
+    paref 1 2
+    tailcall sum
+    end
+.end
+
+.function: count
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieqi 4 1 0
+    branch 4 0x69 0x50
+    iinc 2
+    idec 1
+    frame 2 16
+    param 0 1
+    param 1 2
+    tailcall count
+    move 0 2
+    end
+.end
+
+.function: main
+    istore 1 1000
+    izero 2
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 sum
+    print 2
+    istore 3 2000
+    izero 4
+    frame 2 16
+    param 0 3
+    param 1 4
+    call 5 count
+    print 5
+    izero 0
+    end
+.end
@@ -0,0 +1,51 @@
+.function: sum
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieq 4 1 3
+    branch 4 0x36 0x1b
+    iadd 2 2 1
+    idec 1
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 sum
+    end
+.end
+
+.function: count
+    arg 1 0
+    arg 2 1
+    izero 3
+    ieq 4 1 3
+    branch 4 0x72 0x52
+    iinc 2
+    idec 1
+    frame 2 16
+    param 0 1
+    param 1 2
+    call 5 count
+    move 0 5
+    end
+    move 0 2
+    end
+.end
+
+.function: main
+    istore 1 1000
+    izero 2
+    frame 2 16
+    param 0 1
+    paref 1 2
+    call 0 sum
+    print 2
+    istore 3 2000
+    izero 4
+    frame 2 16
+    param 0 3
+    param 1 4
+    call 5 count
+    print 5
+    izero 0
+    end
+.end
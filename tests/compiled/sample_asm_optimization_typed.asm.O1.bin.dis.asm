@@ -0,0 +1,24 @@
+.function: scaled
+    arg 1 0
+    istore 2 0
+    istore 3 0
+    gilt 4 3 1
+    branch 4 0x1c 0x29
+    tiadd 2 2 3
+    iinc 3
+    jump 0xc
+    gimul 2 2 1
+    print 2
+    move 0 2
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1 5
+    param 0 1
+    call 2 scaled
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,24 @@
+.function: scaled
+    arg 1 0
+    istore 2 0
+    istore 3 0
+    ilt 4 3 1
+    branch 4 0x1c 0x29
+    iadd 2 2 3
+    iinc 3
+    jump 0xc
+    imul 6 2 1
+    print 6
+    move 0 6
+    end
+.end
+
+.function: main
+    istore 1 10
+    frame 1 16
+    param 0 1
+    call 2 scaled
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,37 @@
+.function: dummy
+    izero 0
+    end
+.end
+
+.function: power_of
+    arg 1 0
+    arg 2 1
+    istore 3 0
+    ieq 4 2 3
+    not 4
+    branch 4 0x2c 0x23
+    istore 6 1
+    jump 0x52
+    istore 5 1
+    istore 6 @1
+    ilt 4 5 2
+    branch 4 0x44 0x52
+    imul 6 6 1
+    nop
+    iinc 5
+    jump 0x34
+    move 0 6
+    end
+.end
+
+.function: main
+    istore 1 4
+    istore 2 3
+    frame 2 16
+    param 0 1
+    param 1 2
+    call 1 power_of
+    print 1
+    izero 0
+    end
+.end
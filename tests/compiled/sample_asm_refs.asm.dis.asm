@@ -0,0 +1,12 @@
+.function: main
+    istore 1 0
+    ref 2 1
+    istore 2 2
+    print 1
+    ref 3 2
+    istore 3 4
+    imul 2 3 2
+    print 1
+    izero 0
+    end
+.end
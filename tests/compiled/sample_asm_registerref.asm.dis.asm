@@ -0,0 +1,16 @@
+.function: foo
+    istore 1 16
+    istore 16 1
+    print 1
+    print @1
+    print 16
+    print @16
+    end
+.end
+
+.function: main
+    frame 0 17
+    call 0 foo
+    izero 0
+    end
+.end
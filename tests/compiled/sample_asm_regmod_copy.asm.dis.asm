@@ -0,0 +1,7 @@
+.function: main
+    istore 1 1
+    copy 2 1
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,8 @@
+.function: main
+    istore 1 42
+    free 1
+    isnull 2 1
+    print 2
+    izero 0
+    end
+.end
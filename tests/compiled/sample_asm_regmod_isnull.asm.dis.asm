@@ -0,0 +1,6 @@
+.function: main
+    isnull 2 1
+    print 2
+    izero 0
+    end
+.end
@@ -0,0 +1,20 @@
+.function: main
+    strbuild 1
+    strstore 2 "n:"
+    strstore 3 " "
+    istore 4 0
+    istore 5 4
+    ilt 6 4 5
+    not 6
+    branch 6 0x3a 0x26
+    strappend 1 2
+    strappend 1 4
+    strappend 1 3
+    iinc 4
+    jump 0x13
+    strappendr 1 2
+    strfinal 7 1
+    print 7
+    izero 0
+    end
+.end
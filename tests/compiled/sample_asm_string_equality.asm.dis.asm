@@ -0,0 +1,14 @@
+.function: main
+    strstore 1 "Hello World!"
+    strstore 2 "Hello World!"
+    strstore 3 "Hello Perl!"
+    streq 4 1 2
+    print 4
+    streq 4 1 3
+    print 4
+    copy 5 1
+    streq 4 5 2
+    print 4
+    izero 0
+    end
+.end
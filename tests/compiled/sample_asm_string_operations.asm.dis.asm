@@ -0,0 +1,36 @@
+.function: main
+    strstore 1 "Hello"
+    strstore 2 " World!"
+    stradd 3 1 2
+    print 3
+    strlen 4 3
+    print 4
+    strsub 4 3 6 -1
+    print 4
+    strsub 4 3 0 5
+    print 4
+    strsub 4 3 -6 -2
+    print 4
+    strstore 5 "World"
+    strfind 6 3 5
+    print 6
+    strstore 5 "Perl"
+    strfind 6 3 5
+    print 6
+    strcmp 6 1 2
+    print 6
+    strcmp 6 2 1
+    print 6
+    strcmp 6 1 1
+    print 6
+    strstore 5 "a,b,,c"
+    strstore 7 ","
+    strsplit 8 5 7
+    print 8
+    strstore 5 "42"
+    stoi 6 5
+    iinc 6
+    print 6
+    izero 0
+    end
+.end
@@ -0,0 +1,50 @@
+.function: sum
+    arg 1 0
+    vslen 2 1
+    istore 6 1
+    igt 6 2 6
+    branch 6 0x22 0x1c
+    vsat 0 1 0
+    end
+    istore 6 2
+    idiv 3 2 6
+    vslice 4 1 0 @3
+    vslice 5 1 @3 -1
+    frame 1 16
+    param 0 4
+    call 4 sum
+    frame 1 16
+    param 0 5
+    call 5 sum
+    iadd 0 4 5
+    end
+.end
+
+.function: main
+    vec 1
+    istore 2 1
+    vpush 1 2
+    iinc 2
+    istore 3 9
+    ilt 3 2 3
+    branch 3 0x65 0x80
+    vslice 4 1 2 6
+    print 4
+    vslice 5 4 1 -2
+    print 5
+    vslen 6 5
+    print 6
+    vsat 6 5 0
+    print 6
+    vslice 7 1 0 -1
+    frame 1 16
+    param 0 7
+    call 8 sum
+    print 8
+    vpush 1 2
+    print 4
+    vsmat 9 4
+    print 9
+    izero 0
+    end
+.end
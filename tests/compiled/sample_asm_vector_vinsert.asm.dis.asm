@@ -0,0 +1,22 @@
+.function: main
+    strstore 2 "Hurr"
+    strstore 3 "durr"
+    strstore 4 "Im'a"
+    strstore 5 "sheep!"
+    vec 1
+    vinsert 1 5 0
+    vinsert 1 2 0
+    vinsert 1 3 1
+    vinsert 1 4 2
+    istore 7 0
+    vlen 6 1
+    ilt 8 7 6
+    branch 8 0x3f 0x52
+    vat 9 1 @7
+    print 9
+    empty 9
+    iinc 7
+    jump 0x2f
+    izero 0
+    end
+.end
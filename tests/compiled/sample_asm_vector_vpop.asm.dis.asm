@@ -0,0 +1,15 @@
+.function: main
+    strstore 1 "Hello World!"
+    vec 2
+    vlen 3 2
+    print 3
+    vpush 2 1
+    vlen 3 2
+    print 3
+    vpop 4 2 -1
+    vlen 3 2
+    print 3
+    print 4
+    izero 0
+    end
+.end
@@ -0,0 +1,12013 @@
+.function: main
+    istore 1 0
+    istore 1 1
+    istore 1 2
+    istore 1 3
+    istore 1 4
+    istore 1 5
+    istore 1 6
+    istore 1 7
+    istore 1 8
+    istore 1 9
+    istore 1 10
+    istore 1 11
+    istore 1 12
+    istore 1 13
+    istore 1 14
+    istore 1 15
+    istore 1 16
+    istore 1 17
+    istore 1 18
+    istore 1 19
+    istore 1 20
+    istore 1 21
+    istore 1 22
+    istore 1 23
+    istore 1 24
+    istore 1 25
+    istore 1 26
+    istore 1 27
+    istore 1 28
+    istore 1 29
+    istore 1 30
+    istore 1 31
+    istore 1 32
+    istore 1 33
+    istore 1 34
+    istore 1 35
+    istore 1 36
+    istore 1 37
+    istore 1 38
+    istore 1 39
+    istore 1 40
+    istore 1 41
+    istore 1 42
+    istore 1 43
+    istore 1 44
+    istore 1 45
+    istore 1 46
+    istore 1 47
+    istore 1 48
+    istore 1 49
+    istore 1 50
+    istore 1 51
+    istore 1 52
+    istore 1 53
+    istore 1 54
+    istore 1 55
+    istore 1 56
+    istore 1 57
+    istore 1 58
+    istore 1 59
+    istore 1 60
+    istore 1 61
+    istore 1 62
+    istore 1 63
+    istore 1 64
+    istore 1 65
+    istore 1 66
+    istore 1 67
+    istore 1 68
+    istore 1 69
+    istore 1 70
+    istore 1 71
+    istore 1 72
+    istore 1 73
+    istore 1 74
+    istore 1 75
+    istore 1 76
+    istore 1 77
+    istore 1 78
+    istore 1 79
+    istore 1 80
+    istore 1 81
+    istore 1 82
+    istore 1 83
+    istore 1 84
+    istore 1 85
+    istore 1 86
+    istore 1 87
+    istore 1 88
+    istore 1 89
+    istore 1 90
+    istore 1 91
+    istore 1 92
+    istore 1 93
+    istore 1 94
+    istore 1 95
+    istore 1 96
+    istore 1 97
+    istore 1 98
+    istore 1 99
+    istore 1 100
+    istore 1 101
+    istore 1 102
+    istore 1 103
+    istore 1 104
+    istore 1 105
+    istore 1 106
+    istore 1 107
+    istore 1 108
+    istore 1 109
+    istore 1 110
+    istore 1 111
+    istore 1 112
+    istore 1 113
+    istore 1 114
+    istore 1 115
+    istore 1 116
+    istore 1 117
+    istore 1 118
+    istore 1 119
+    istore 1 120
+    istore 1 121
+    istore 1 122
+    istore 1 123
+    istore 1 124
+    istore 1 125
+    istore 1 126
+    istore 1 127
+    istore 1 128
+    istore 1 129
+    istore 1 130
+    istore 1 131
+    istore 1 132
+    istore 1 133
+    istore 1 134
+    istore 1 135
+    istore 1 136
+    istore 1 137
+    istore 1 138
+    istore 1 139
+    istore 1 140
+    istore 1 141
+    istore 1 142
+    istore 1 143
+    istore 1 144
+    istore 1 145
+    istore 1 146
+    istore 1 147
+    istore 1 148
+    istore 1 149
+    istore 1 150
+    istore 1 151
+    istore 1 152
+    istore 1 153
+    istore 1 154
+    istore 1 155
+    istore 1 156
+    istore 1 157
+    istore 1 158
+    istore 1 159
+    istore 1 160
+    istore 1 161
+    istore 1 162
+    istore 1 163
+    istore 1 164
+    istore 1 165
+    istore 1 166
+    istore 1 167
+    istore 1 168
+    istore 1 169
+    istore 1 170
+    istore 1 171
+    istore 1 172
+    istore 1 173
+    istore 1 174
+    istore 1 175
+    istore 1 176
+    istore 1 177
+    istore 1 178
+    istore 1 179
+    istore 1 180
+    istore 1 181
+    istore 1 182
+    istore 1 183
+    istore 1 184
+    istore 1 185
+    istore 1 186
+    istore 1 187
+    istore 1 188
+    istore 1 189
+    istore 1 190
+    istore 1 191
+    istore 1 192
+    istore 1 193
+    istore 1 194
+    istore 1 195
+    istore 1 196
+    istore 1 197
+    istore 1 198
+    istore 1 199
+    istore 1 200
+    istore 1 201
+    istore 1 202
+    istore 1 203
+    istore 1 204
+    istore 1 205
+    istore 1 206
+    istore 1 207
+    istore 1 208
+    istore 1 209
+    istore 1 210
+    istore 1 211
+    istore 1 212
+    istore 1 213
+    istore 1 214
+    istore 1 215
+    istore 1 216
+    istore 1 217
+    istore 1 218
+    istore 1 219
+    istore 1 220
+    istore 1 221
+    istore 1 222
+    istore 1 223
+    istore 1 224
+    istore 1 225
+    istore 1 226
+    istore 1 227
+    istore 1 228
+    istore 1 229
+    istore 1 230
+    istore 1 231
+    istore 1 232
+    istore 1 233
+    istore 1 234
+    istore 1 235
+    istore 1 236
+    istore 1 237
+    istore 1 238
+    istore 1 239
+    istore 1 240
+    istore 1 241
+    istore 1 242
+    istore 1 243
+    istore 1 244
+    istore 1 245
+    istore 1 246
+    istore 1 247
+    istore 1 248
+    istore 1 249
+    istore 1 250
+    istore 1 251
+    istore 1 252
+    istore 1 253
+    istore 1 254
+    istore 1 255
+    istore 1 256
+    istore 1 257
+    istore 1 258
+    istore 1 259
+    istore 1 260
+    istore 1 261
+    istore 1 262
+    istore 1 263
+    istore 1 264
+    istore 1 265
+    istore 1 266
+    istore 1 267
+    istore 1 268
+    istore 1 269
+    istore 1 270
+    istore 1 271
+    istore 1 272
+    istore 1 273
+    istore 1 274
+    istore 1 275
+    istore 1 276
+    istore 1 277
+    istore 1 278
+    istore 1 279
+    istore 1 280
+    istore 1 281
+    istore 1 282
+    istore 1 283
+    istore 1 284
+    istore 1 285
+    istore 1 286
+    istore 1 287
+    istore 1 288
+    istore 1 289
+    istore 1 290
+    istore 1 291
+    istore 1 292
+    istore 1 293
+    istore 1 294
+    istore 1 295
+    istore 1 296
+    istore 1 297
+    istore 1 298
+    istore 1 299
+    istore 1 300
+    istore 1 301
+    istore 1 302
+    istore 1 303
+    istore 1 304
+    istore 1 305
+    istore 1 306
+    istore 1 307
+    istore 1 308
+    istore 1 309
+    istore 1 310
+    istore 1 311
+    istore 1 312
+    istore 1 313
+    istore 1 314
+    istore 1 315
+    istore 1 316
+    istore 1 317
+    istore 1 318
+    istore 1 319
+    istore 1 320
+    istore 1 321
+    istore 1 322
+    istore 1 323
+    istore 1 324
+    istore 1 325
+    istore 1 326
+    istore 1 327
+    istore 1 328
+    istore 1 329
+    istore 1 330
+    istore 1 331
+    istore 1 332
+    istore 1 333
+    istore 1 334
+    istore 1 335
+    istore 1 336
+    istore 1 337
+    istore 1 338
+    istore 1 339
+    istore 1 340
+    istore 1 341
+    istore 1 342
+    istore 1 343
+    istore 1 344
+    istore 1 345
+    istore 1 346
+    istore 1 347
+    istore 1 348
+    istore 1 349
+    istore 1 350
+    istore 1 351
+    istore 1 352
+    istore 1 353
+    istore 1 354
+    istore 1 355
+    istore 1 356
+    istore 1 357
+    istore 1 358
+    istore 1 359
+    istore 1 360
+    istore 1 361
+    istore 1 362
+    istore 1 363
+    istore 1 364
+    istore 1 365
+    istore 1 366
+    istore 1 367
+    istore 1 368
+    istore 1 369
+    istore 1 370
+    istore 1 371
+    istore 1 372
+    istore 1 373
+    istore 1 374
+    istore 1 375
+    istore 1 376
+    istore 1 377
+    istore 1 378
+    istore 1 379
+    istore 1 380
+    istore 1 381
+    istore 1 382
+    istore 1 383
+    istore 1 384
+    istore 1 385
+    istore 1 386
+    istore 1 387
+    istore 1 388
+    istore 1 389
+    istore 1 390
+    istore 1 391
+    istore 1 392
+    istore 1 393
+    istore 1 394
+    istore 1 395
+    istore 1 396
+    istore 1 397
+    istore 1 398
+    istore 1 399
+    istore 1 400
+    istore 1 401
+    istore 1 402
+    istore 1 403
+    istore 1 404
+    istore 1 405
+    istore 1 406
+    istore 1 407
+    istore 1 408
+    istore 1 409
+    istore 1 410
+    istore 1 411
+    istore 1 412
+    istore 1 413
+    istore 1 414
+    istore 1 415
+    istore 1 416
+    istore 1 417
+    istore 1 418
+    istore 1 419
+    istore 1 420
+    istore 1 421
+    istore 1 422
+    istore 1 423
+    istore 1 424
+    istore 1 425
+    istore 1 426
+    istore 1 427
+    istore 1 428
+    istore 1 429
+    istore 1 430
+    istore 1 431
+    istore 1 432
+    istore 1 433
+    istore 1 434
+    istore 1 435
+    istore 1 436
+    istore 1 437
+    istore 1 438
+    istore 1 439
+    istore 1 440
+    istore 1 441
+    istore 1 442
+    istore 1 443
+    istore 1 444
+    istore 1 445
+    istore 1 446
+    istore 1 447
+    istore 1 448
+    istore 1 449
+    istore 1 450
+    istore 1 451
+    istore 1 452
+    istore 1 453
+    istore 1 454
+    istore 1 455
+    istore 1 456
+    istore 1 457
+    istore 1 458
+    istore 1 459
+    istore 1 460
+    istore 1 461
+    istore 1 462
+    istore 1 463
+    istore 1 464
+    istore 1 465
+    istore 1 466
+    istore 1 467
+    istore 1 468
+    istore 1 469
+    istore 1 470
+    istore 1 471
+    istore 1 472
+    istore 1 473
+    istore 1 474
+    istore 1 475
+    istore 1 476
+    istore 1 477
+    istore 1 478
+    istore 1 479
+    istore 1 480
+    istore 1 481
+    istore 1 482
+    istore 1 483
+    istore 1 484
+    istore 1 485
+    istore 1 486
+    istore 1 487
+    istore 1 488
+    istore 1 489
+    istore 1 490
+    istore 1 491
+    istore 1 492
+    istore 1 493
+    istore 1 494
+    istore 1 495
+    istore 1 496
+    istore 1 497
+    istore 1 498
+    istore 1 499
+    istore 1 500
+    istore 1 501
+    istore 1 502
+    istore 1 503
+    istore 1 504
+    istore 1 505
+    istore 1 506
+    istore 1 507
+    istore 1 508
+    istore 1 509
+    istore 1 510
+    istore 1 511
+    istore 1 512
+    istore 1 513
+    istore 1 514
+    istore 1 515
+    istore 1 516
+    istore 1 517
+    istore 1 518
+    istore 1 519
+    istore 1 520
+    istore 1 521
+    istore 1 522
+    istore 1 523
+    istore 1 524
+    istore 1 525
+    istore 1 526
+    istore 1 527
+    istore 1 528
+    istore 1 529
+    istore 1 530
+    istore 1 531
+    istore 1 532
+    istore 1 533
+    istore 1 534
+    istore 1 535
+    istore 1 536
+    istore 1 537
+    istore 1 538
+    istore 1 539
+    istore 1 540
+    istore 1 541
+    istore 1 542
+    istore 1 543
+    istore 1 544
+    istore 1 545
+    istore 1 546
+    istore 1 547
+    istore 1 548
+    istore 1 549
+    istore 1 550
+    istore 1 551
+    istore 1 552
+    istore 1 553
+    istore 1 554
+    istore 1 555
+    istore 1 556
+    istore 1 557
+    istore 1 558
+    istore 1 559
+    istore 1 560
+    istore 1 561
+    istore 1 562
+    istore 1 563
+    istore 1 564
+    istore 1 565
+    istore 1 566
+    istore 1 567
+    istore 1 568
+    istore 1 569
+    istore 1 570
+    istore 1 571
+    istore 1 572
+    istore 1 573
+    istore 1 574
+    istore 1 575
+    istore 1 576
+    istore 1 577
+    istore 1 578
+    istore 1 579
+    istore 1 580
+    istore 1 581
+    istore 1 582
+    istore 1 583
+    istore 1 584
+    istore 1 585
+    istore 1 586
+    istore 1 587
+    istore 1 588
+    istore 1 589
+    istore 1 590
+    istore 1 591
+    istore 1 592
+    istore 1 593
+    istore 1 594
+    istore 1 595
+    istore 1 596
+    istore 1 597
+    istore 1 598
+    istore 1 599
+    istore 1 600
+    istore 1 601
+    istore 1 602
+    istore 1 603
+    istore 1 604
+    istore 1 605
+    istore 1 606
+    istore 1 607
+    istore 1 608
+    istore 1 609
+    istore 1 610
+    istore 1 611
+    istore 1 612
+    istore 1 613
+    istore 1 614
+    istore 1 615
+    istore 1 616
+    istore 1 617
+    istore 1 618
+    istore 1 619
+    istore 1 620
+    istore 1 621
+    istore 1 622
+    istore 1 623
+    istore 1 624
+    istore 1 625
+    istore 1 626
+    istore 1 627
+    istore 1 628
+    istore 1 629
+    istore 1 630
+    istore 1 631
+    istore 1 632
+    istore 1 633
+    istore 1 634
+    istore 1 635
+    istore 1 636
+    istore 1 637
+    istore 1 638
+    istore 1 639
+    istore 1 640
+    istore 1 641
+    istore 1 642
+    istore 1 643
+    istore 1 644
+    istore 1 645
+    istore 1 646
+    istore 1 647
+    istore 1 648
+    istore 1 649
+    istore 1 650
+    istore 1 651
+    istore 1 652
+    istore 1 653
+    istore 1 654
+    istore 1 655
+    istore 1 656
+    istore 1 657
+    istore 1 658
+    istore 1 659
+    istore 1 660
+    istore 1 661
+    istore 1 662
+    istore 1 663
+    istore 1 664
+    istore 1 665
+    istore 1 666
+    istore 1 667
+    istore 1 668
+    istore 1 669
+    istore 1 670
+    istore 1 671
+    istore 1 672
+    istore 1 673
+    istore 1 674
+    istore 1 675
+    istore 1 676
+    istore 1 677
+    istore 1 678
+    istore 1 679
+    istore 1 680
+    istore 1 681
+    istore 1 682
+    istore 1 683
+    istore 1 684
+    istore 1 685
+    istore 1 686
+    istore 1 687
+    istore 1 688
+    istore 1 689
+    istore 1 690
+    istore 1 691
+    istore 1 692
+    istore 1 693
+    istore 1 694
+    istore 1 695
+    istore 1 696
+    istore 1 697
+    istore 1 698
+    istore 1 699
+    istore 1 700
+    istore 1 701
+    istore 1 702
+    istore 1 703
+    istore 1 704
+    istore 1 705
+    istore 1 706
+    istore 1 707
+    istore 1 708
+    istore 1 709
+    istore 1 710
+    istore 1 711
+    istore 1 712
+    istore 1 713
+    istore 1 714
+    istore 1 715
+    istore 1 716
+    istore 1 717
+    istore 1 718
+    istore 1 719
+    istore 1 720
+    istore 1 721
+    istore 1 722
+    istore 1 723
+    istore 1 724
+    istore 1 725
+    istore 1 726
+    istore 1 727
+    istore 1 728
+    istore 1 729
+    istore 1 730
+    istore 1 731
+    istore 1 732
+    istore 1 733
+    istore 1 734
+    istore 1 735
+    istore 1 736
+    istore 1 737
+    istore 1 738
+    istore 1 739
+    istore 1 740
+    istore 1 741
+    istore 1 742
+    istore 1 743
+    istore 1 744
+    istore 1 745
+    istore 1 746
+    istore 1 747
+    istore 1 748
+    istore 1 749
+    istore 1 750
+    istore 1 751
+    istore 1 752
+    istore 1 753
+    istore 1 754
+    istore 1 755
+    istore 1 756
+    istore 1 757
+    istore 1 758
+    istore 1 759
+    istore 1 760
+    istore 1 761
+    istore 1 762
+    istore 1 763
+    istore 1 764
+    istore 1 765
+    istore 1 766
+    istore 1 767
+    istore 1 768
+    istore 1 769
+    istore 1 770
+    istore 1 771
+    istore 1 772
+    istore 1 773
+    istore 1 774
+    istore 1 775
+    istore 1 776
+    istore 1 777
+    istore 1 778
+    istore 1 779
+    istore 1 780
+    istore 1 781
+    istore 1 782
+    istore 1 783
+    istore 1 784
+    istore 1 785
+    istore 1 786
+    istore 1 787
+    istore 1 788
+    istore 1 789
+    istore 1 790
+    istore 1 791
+    istore 1 792
+    istore 1 793
+    istore 1 794
+    istore 1 795
+    istore 1 796
+    istore 1 797
+    istore 1 798
+    istore 1 799
+    istore 1 800
+    istore 1 801
+    istore 1 802
+    istore 1 803
+    istore 1 804
+    istore 1 805
+    istore 1 806
+    istore 1 807
+    istore 1 808
+    istore 1 809
+    istore 1 810
+    istore 1 811
+    istore 1 812
+    istore 1 813
+    istore 1 814
+    istore 1 815
+    istore 1 816
+    istore 1 817
+    istore 1 818
+    istore 1 819
+    istore 1 820
+    istore 1 821
+    istore 1 822
+    istore 1 823
+    istore 1 824
+    istore 1 825
+    istore 1 826
+    istore 1 827
+    istore 1 828
+    istore 1 829
+    istore 1 830
+    istore 1 831
+    istore 1 832
+    istore 1 833
+    istore 1 834
+    istore 1 835
+    istore 1 836
+    istore 1 837
+    istore 1 838
+    istore 1 839
+    istore 1 840
+    istore 1 841
+    istore 1 842
+    istore 1 843
+    istore 1 844
+    istore 1 845
+    istore 1 846
+    istore 1 847
+    istore 1 848
+    istore 1 849
+    istore 1 850
+    istore 1 851
+    istore 1 852
+    istore 1 853
+    istore 1 854
+    istore 1 855
+    istore 1 856
+    istore 1 857
+    istore 1 858
+    istore 1 859
+    istore 1 860
+    istore 1 861
+    istore 1 862
+    istore 1 863
+    istore 1 864
+    istore 1 865
+    istore 1 866
+    istore 1 867
+    istore 1 868
+    istore 1 869
+    istore 1 870
+    istore 1 871
+    istore 1 872
+    istore 1 873
+    istore 1 874
+    istore 1 875
+    istore 1 876
+    istore 1 877
+    istore 1 878
+    istore 1 879
+    istore 1 880
+    istore 1 881
+    istore 1 882
+    istore 1 883
+    istore 1 884
+    istore 1 885
+    istore 1 886
+    istore 1 887
+    istore 1 888
+    istore 1 889
+    istore 1 890
+    istore 1 891
+    istore 1 892
+    istore 1 893
+    istore 1 894
+    istore 1 895
+    istore 1 896
+    istore 1 897
+    istore 1 898
+    istore 1 899
+    istore 1 900
+    istore 1 901
+    istore 1 902
+    istore 1 903
+    istore 1 904
+    istore 1 905
+    istore 1 906
+    istore 1 907
+    istore 1 908
+    istore 1 909
+    istore 1 910
+    istore 1 911
+    istore 1 912
+    istore 1 913
+    istore 1 914
+    istore 1 915
+    istore 1 916
+    istore 1 917
+    istore 1 918
+    istore 1 919
+    istore 1 920
+    istore 1 921
+    istore 1 922
+    istore 1 923
+    istore 1 924
+    istore 1 925
+    istore 1 926
+    istore 1 927
+    istore 1 928
+    istore 1 929
+    istore 1 930
+    istore 1 931
+    istore 1 932
+    istore 1 933
+    istore 1 934
+    istore 1 935
+    istore 1 936
+    istore 1 937
+    istore 1 938
+    istore 1 939
+    istore 1 940
+    istore 1 941
+    istore 1 942
+    istore 1 943
+    istore 1 944
+    istore 1 945
+    istore 1 946
+    istore 1 947
+    istore 1 948
+    istore 1 949
+    istore 1 950
+    istore 1 951
+    istore 1 952
+    istore 1 953
+    istore 1 954
+    istore 1 955
+    istore 1 956
+    istore 1 957
+    istore 1 958
+    istore 1 959
+    istore 1 960
+    istore 1 961
+    istore 1 962
+    istore 1 963
+    istore 1 964
+    istore 1 965
+    istore 1 966
+    istore 1 967
+    istore 1 968
+    istore 1 969
+    istore 1 970
+    istore 1 971
+    istore 1 972
+    istore 1 973
+    istore 1 974
+    istore 1 975
+    istore 1 976
+    istore 1 977
+    istore 1 978
+    istore 1 979
+    istore 1 980
+    istore 1 981
+    istore 1 982
+    istore 1 983
+    istore 1 984
+    istore 1 985
+    istore 1 986
+    istore 1 987
+    istore 1 988
+    istore 1 989
+    istore 1 990
+    istore 1 991
+    istore 1 992
+    istore 1 993
+    istore 1 994
+    istore 1 995
+    istore 1 996
+    istore 1 997
+    istore 1 998
+    istore 1 999
+    istore 1 1000
+    istore 1 1001
+    istore 1 1002
+    istore 1 1003
+    istore 1 1004
+    istore 1 1005
+    istore 1 1006
+    istore 1 1007
+    istore 1 1008
+    istore 1 1009
+    istore 1 1010
+    istore 1 1011
+    istore 1 1012
+    istore 1 1013
+    istore 1 1014
+    istore 1 1015
+    istore 1 1016
+    istore 1 1017
+    istore 1 1018
+    istore 1 1019
+    istore 1 1020
+    istore 1 1021
+    istore 1 1022
+    istore 1 1023
+    istore 1 1024
+    istore 1 1025
+    istore 1 1026
+    istore 1 1027
+    istore 1 1028
+    istore 1 1029
+    istore 1 1030
+    istore 1 1031
+    istore 1 1032
+    istore 1 1033
+    istore 1 1034
+    istore 1 1035
+    istore 1 1036
+    istore 1 1037
+    istore 1 1038
+    istore 1 1039
+    istore 1 1040
+    istore 1 1041
+    istore 1 1042
+    istore 1 1043
+    istore 1 1044
+    istore 1 1045
+    istore 1 1046
+    istore 1 1047
+    istore 1 1048
+    istore 1 1049
+    istore 1 1050
+    istore 1 1051
+    istore 1 1052
+    istore 1 1053
+    istore 1 1054
+    istore 1 1055
+    istore 1 1056
+    istore 1 1057
+    istore 1 1058
+    istore 1 1059
+    istore 1 1060
+    istore 1 1061
+    istore 1 1062
+    istore 1 1063
+    istore 1 1064
+    istore 1 1065
+    istore 1 1066
+    istore 1 1067
+    istore 1 1068
+    istore 1 1069
+    istore 1 1070
+    istore 1 1071
+    istore 1 1072
+    istore 1 1073
+    istore 1 1074
+    istore 1 1075
+    istore 1 1076
+    istore 1 1077
+    istore 1 1078
+    istore 1 1079
+    istore 1 1080
+    istore 1 1081
+    istore 1 1082
+    istore 1 1083
+    istore 1 1084
+    istore 1 1085
+    istore 1 1086
+    istore 1 1087
+    istore 1 1088
+    istore 1 1089
+    istore 1 1090
+    istore 1 1091
+    istore 1 1092
+    istore 1 1093
+    istore 1 1094
+    istore 1 1095
+    istore 1 1096
+    istore 1 1097
+    istore 1 1098
+    istore 1 1099
+    istore 1 1100
+    istore 1 1101
+    istore 1 1102
+    istore 1 1103
+    istore 1 1104
+    istore 1 1105
+    istore 1 1106
+    istore 1 1107
+    istore 1 1108
+    istore 1 1109
+    istore 1 1110
+    istore 1 1111
+    istore 1 1112
+    istore 1 1113
+    istore 1 1114
+    istore 1 1115
+    istore 1 1116
+    istore 1 1117
+    istore 1 1118
+    istore 1 1119
+    istore 1 1120
+    istore 1 1121
+    istore 1 1122
+    istore 1 1123
+    istore 1 1124
+    istore 1 1125
+    istore 1 1126
+    istore 1 1127
+    istore 1 1128
+    istore 1 1129
+    istore 1 1130
+    istore 1 1131
+    istore 1 1132
+    istore 1 1133
+    istore 1 1134
+    istore 1 1135
+    istore 1 1136
+    istore 1 1137
+    istore 1 1138
+    istore 1 1139
+    istore 1 1140
+    istore 1 1141
+    istore 1 1142
+    istore 1 1143
+    istore 1 1144
+    istore 1 1145
+    istore 1 1146
+    istore 1 1147
+    istore 1 1148
+    istore 1 1149
+    istore 1 1150
+    istore 1 1151
+    istore 1 1152
+    istore 1 1153
+    istore 1 1154
+    istore 1 1155
+    istore 1 1156
+    istore 1 1157
+    istore 1 1158
+    istore 1 1159
+    istore 1 1160
+    istore 1 1161
+    istore 1 1162
+    istore 1 1163
+    istore 1 1164
+    istore 1 1165
+    istore 1 1166
+    istore 1 1167
+    istore 1 1168
+    istore 1 1169
+    istore 1 1170
+    istore 1 1171
+    istore 1 1172
+    istore 1 1173
+    istore 1 1174
+    istore 1 1175
+    istore 1 1176
+    istore 1 1177
+    istore 1 1178
+    istore 1 1179
+    istore 1 1180
+    istore 1 1181
+    istore 1 1182
+    istore 1 1183
+    istore 1 1184
+    istore 1 1185
+    istore 1 1186
+    istore 1 1187
+    istore 1 1188
+    istore 1 1189
+    istore 1 1190
+    istore 1 1191
+    istore 1 1192
+    istore 1 1193
+    istore 1 1194
+    istore 1 1195
+    istore 1 1196
+    istore 1 1197
+    istore 1 1198
+    istore 1 1199
+    istore 1 1200
+    istore 1 1201
+    istore 1 1202
+    istore 1 1203
+    istore 1 1204
+    istore 1 1205
+    istore 1 1206
+    istore 1 1207
+    istore 1 1208
+    istore 1 1209
+    istore 1 1210
+    istore 1 1211
+    istore 1 1212
+    istore 1 1213
+    istore 1 1214
+    istore 1 1215
+    istore 1 1216
+    istore 1 1217
+    istore 1 1218
+    istore 1 1219
+    istore 1 1220
+    istore 1 1221
+    istore 1 1222
+    istore 1 1223
+    istore 1 1224
+    istore 1 1225
+    istore 1 1226
+    istore 1 1227
+    istore 1 1228
+    istore 1 1229
+    istore 1 1230
+    istore 1 1231
+    istore 1 1232
+    istore 1 1233
+    istore 1 1234
+    istore 1 1235
+    istore 1 1236
+    istore 1 1237
+    istore 1 1238
+    istore 1 1239
+    istore 1 1240
+    istore 1 1241
+    istore 1 1242
+    istore 1 1243
+    istore 1 1244
+    istore 1 1245
+    istore 1 1246
+    istore 1 1247
+    istore 1 1248
+    istore 1 1249
+    istore 1 1250
+    istore 1 1251
+    istore 1 1252
+    istore 1 1253
+    istore 1 1254
+    istore 1 1255
+    istore 1 1256
+    istore 1 1257
+    istore 1 1258
+    istore 1 1259
+    istore 1 1260
+    istore 1 1261
+    istore 1 1262
+    istore 1 1263
+    istore 1 1264
+    istore 1 1265
+    istore 1 1266
+    istore 1 1267
+    istore 1 1268
+    istore 1 1269
+    istore 1 1270
+    istore 1 1271
+    istore 1 1272
+    istore 1 1273
+    istore 1 1274
+    istore 1 1275
+    istore 1 1276
+    istore 1 1277
+    istore 1 1278
+    istore 1 1279
+    istore 1 1280
+    istore 1 1281
+    istore 1 1282
+    istore 1 1283
+    istore 1 1284
+    istore 1 1285
+    istore 1 1286
+    istore 1 1287
+    istore 1 1288
+    istore 1 1289
+    istore 1 1290
+    istore 1 1291
+    istore 1 1292
+    istore 1 1293
+    istore 1 1294
+    istore 1 1295
+    istore 1 1296
+    istore 1 1297
+    istore 1 1298
+    istore 1 1299
+    istore 1 1300
+    istore 1 1301
+    istore 1 1302
+    istore 1 1303
+    istore 1 1304
+    istore 1 1305
+    istore 1 1306
+    istore 1 1307
+    istore 1 1308
+    istore 1 1309
+    istore 1 1310
+    istore 1 1311
+    istore 1 1312
+    istore 1 1313
+    istore 1 1314
+    istore 1 1315
+    istore 1 1316
+    istore 1 1317
+    istore 1 1318
+    istore 1 1319
+    istore 1 1320
+    istore 1 1321
+    istore 1 1322
+    istore 1 1323
+    istore 1 1324
+    istore 1 1325
+    istore 1 1326
+    istore 1 1327
+    istore 1 1328
+    istore 1 1329
+    istore 1 1330
+    istore 1 1331
+    istore 1 1332
+    istore 1 1333
+    istore 1 1334
+    istore 1 1335
+    istore 1 1336
+    istore 1 1337
+    istore 1 1338
+    istore 1 1339
+    istore 1 1340
+    istore 1 1341
+    istore 1 1342
+    istore 1 1343
+    istore 1 1344
+    istore 1 1345
+    istore 1 1346
+    istore 1 1347
+    istore 1 1348
+    istore 1 1349
+    istore 1 1350
+    istore 1 1351
+    istore 1 1352
+    istore 1 1353
+    istore 1 1354
+    istore 1 1355
+    istore 1 1356
+    istore 1 1357
+    istore 1 1358
+    istore 1 1359
+    istore 1 1360
+    istore 1 1361
+    istore 1 1362
+    istore 1 1363
+    istore 1 1364
+    istore 1 1365
+    istore 1 1366
+    istore 1 1367
+    istore 1 1368
+    istore 1 1369
+    istore 1 1370
+    istore 1 1371
+    istore 1 1372
+    istore 1 1373
+    istore 1 1374
+    istore 1 1375
+    istore 1 1376
+    istore 1 1377
+    istore 1 1378
+    istore 1 1379
+    istore 1 1380
+    istore 1 1381
+    istore 1 1382
+    istore 1 1383
+    istore 1 1384
+    istore 1 1385
+    istore 1 1386
+    istore 1 1387
+    istore 1 1388
+    istore 1 1389
+    istore 1 1390
+    istore 1 1391
+    istore 1 1392
+    istore 1 1393
+    istore 1 1394
+    istore 1 1395
+    istore 1 1396
+    istore 1 1397
+    istore 1 1398
+    istore 1 1399
+    istore 1 1400
+    istore 1 1401
+    istore 1 1402
+    istore 1 1403
+    istore 1 1404
+    istore 1 1405
+    istore 1 1406
+    istore 1 1407
+    istore 1 1408
+    istore 1 1409
+    istore 1 1410
+    istore 1 1411
+    istore 1 1412
+    istore 1 1413
+    istore 1 1414
+    istore 1 1415
+    istore 1 1416
+    istore 1 1417
+    istore 1 1418
+    istore 1 1419
+    istore 1 1420
+    istore 1 1421
+    istore 1 1422
+    istore 1 1423
+    istore 1 1424
+    istore 1 1425
+    istore 1 1426
+    istore 1 1427
+    istore 1 1428
+    istore 1 1429
+    istore 1 1430
+    istore 1 1431
+    istore 1 1432
+    istore 1 1433
+    istore 1 1434
+    istore 1 1435
+    istore 1 1436
+    istore 1 1437
+    istore 1 1438
+    istore 1 1439
+    istore 1 1440
+    istore 1 1441
+    istore 1 1442
+    istore 1 1443
+    istore 1 1444
+    istore 1 1445
+    istore 1 1446
+    istore 1 1447
+    istore 1 1448
+    istore 1 1449
+    istore 1 1450
+    istore 1 1451
+    istore 1 1452
+    istore 1 1453
+    istore 1 1454
+    istore 1 1455
+    istore 1 1456
+    istore 1 1457
+    istore 1 1458
+    istore 1 1459
+    istore 1 1460
+    istore 1 1461
+    istore 1 1462
+    istore 1 1463
+    istore 1 1464
+    istore 1 1465
+    istore 1 1466
+    istore 1 1467
+    istore 1 1468
+    istore 1 1469
+    istore 1 1470
+    istore 1 1471
+    istore 1 1472
+    istore 1 1473
+    istore 1 1474
+    istore 1 1475
+    istore 1 1476
+    istore 1 1477
+    istore 1 1478
+    istore 1 1479
+    istore 1 1480
+    istore 1 1481
+    istore 1 1482
+    istore 1 1483
+    istore 1 1484
+    istore 1 1485
+    istore 1 1486
+    istore 1 1487
+    istore 1 1488
+    istore 1 1489
+    istore 1 1490
+    istore 1 1491
+    istore 1 1492
+    istore 1 1493
+    istore 1 1494
+    istore 1 1495
+    istore 1 1496
+    istore 1 1497
+    istore 1 1498
+    istore 1 1499
+    istore 1 1500
+    istore 1 1501
+    istore 1 1502
+    istore 1 1503
+    istore 1 1504
+    istore 1 1505
+    istore 1 1506
+    istore 1 1507
+    istore 1 1508
+    istore 1 1509
+    istore 1 1510
+    istore 1 1511
+    istore 1 1512
+    istore 1 1513
+    istore 1 1514
+    istore 1 1515
+    istore 1 1516
+    istore 1 1517
+    istore 1 1518
+    istore 1 1519
+    istore 1 1520
+    istore 1 1521
+    istore 1 1522
+    istore 1 1523
+    istore 1 1524
+    istore 1 1525
+    istore 1 1526
+    istore 1 1527
+    istore 1 1528
+    istore 1 1529
+    istore 1 1530
+    istore 1 1531
+    istore 1 1532
+    istore 1 1533
+    istore 1 1534
+    istore 1 1535
+    istore 1 1536
+    istore 1 1537
+    istore 1 1538
+    istore 1 1539
+    istore 1 1540
+    istore 1 1541
+    istore 1 1542
+    istore 1 1543
+    istore 1 1544
+    istore 1 1545
+    istore 1 1546
+    istore 1 1547
+    istore 1 1548
+    istore 1 1549
+    istore 1 1550
+    istore 1 1551
+    istore 1 1552
+    istore 1 1553
+    istore 1 1554
+    istore 1 1555
+    istore 1 1556
+    istore 1 1557
+    istore 1 1558
+    istore 1 1559
+    istore 1 1560
+    istore 1 1561
+    istore 1 1562
+    istore 1 1563
+    istore 1 1564
+    istore 1 1565
+    istore 1 1566
+    istore 1 1567
+    istore 1 1568
+    istore 1 1569
+    istore 1 1570
+    istore 1 1571
+    istore 1 1572
+    istore 1 1573
+    istore 1 1574
+    istore 1 1575
+    istore 1 1576
+    istore 1 1577
+    istore 1 1578
+    istore 1 1579
+    istore 1 1580
+    istore 1 1581
+    istore 1 1582
+    istore 1 1583
+    istore 1 1584
+    istore 1 1585
+    istore 1 1586
+    istore 1 1587
+    istore 1 1588
+    istore 1 1589
+    istore 1 1590
+    istore 1 1591
+    istore 1 1592
+    istore 1 1593
+    istore 1 1594
+    istore 1 1595
+    istore 1 1596
+    istore 1 1597
+    istore 1 1598
+    istore 1 1599
+    istore 1 1600
+    istore 1 1601
+    istore 1 1602
+    istore 1 1603
+    istore 1 1604
+    istore 1 1605
+    istore 1 1606
+    istore 1 1607
+    istore 1 1608
+    istore 1 1609
+    istore 1 1610
+    istore 1 1611
+    istore 1 1612
+    istore 1 1613
+    istore 1 1614
+    istore 1 1615
+    istore 1 1616
+    istore 1 1617
+    istore 1 1618
+    istore 1 1619
+    istore 1 1620
+    istore 1 1621
+    istore 1 1622
+    istore 1 1623
+    istore 1 1624
+    istore 1 1625
+    istore 1 1626
+    istore 1 1627
+    istore 1 1628
+    istore 1 1629
+    istore 1 1630
+    istore 1 1631
+    istore 1 1632
+    istore 1 1633
+    istore 1 1634
+    istore 1 1635
+    istore 1 1636
+    istore 1 1637
+    istore 1 1638
+    istore 1 1639
+    istore 1 1640
+    istore 1 1641
+    istore 1 1642
+    istore 1 1643
+    istore 1 1644
+    istore 1 1645
+    istore 1 1646
+    istore 1 1647
+    istore 1 1648
+    istore 1 1649
+    istore 1 1650
+    istore 1 1651
+    istore 1 1652
+    istore 1 1653
+    istore 1 1654
+    istore 1 1655
+    istore 1 1656
+    istore 1 1657
+    istore 1 1658
+    istore 1 1659
+    istore 1 1660
+    istore 1 1661
+    istore 1 1662
+    istore 1 1663
+    istore 1 1664
+    istore 1 1665
+    istore 1 1666
+    istore 1 1667
+    istore 1 1668
+    istore 1 1669
+    istore 1 1670
+    istore 1 1671
+    istore 1 1672
+    istore 1 1673
+    istore 1 1674
+    istore 1 1675
+    istore 1 1676
+    istore 1 1677
+    istore 1 1678
+    istore 1 1679
+    istore 1 1680
+    istore 1 1681
+    istore 1 1682
+    istore 1 1683
+    istore 1 1684
+    istore 1 1685
+    istore 1 1686
+    istore 1 1687
+    istore 1 1688
+    istore 1 1689
+    istore 1 1690
+    istore 1 1691
+    istore 1 1692
+    istore 1 1693
+    istore 1 1694
+    istore 1 1695
+    istore 1 1696
+    istore 1 1697
+    istore 1 1698
+    istore 1 1699
+    istore 1 1700
+    istore 1 1701
+    istore 1 1702
+    istore 1 1703
+    istore 1 1704
+    istore 1 1705
+    istore 1 1706
+    istore 1 1707
+    istore 1 1708
+    istore 1 1709
+    istore 1 1710
+    istore 1 1711
+    istore 1 1712
+    istore 1 1713
+    istore 1 1714
+    istore 1 1715
+    istore 1 1716
+    istore 1 1717
+    istore 1 1718
+    istore 1 1719
+    istore 1 1720
+    istore 1 1721
+    istore 1 1722
+    istore 1 1723
+    istore 1 1724
+    istore 1 1725
+    istore 1 1726
+    istore 1 1727
+    istore 1 1728
+    istore 1 1729
+    istore 1 1730
+    istore 1 1731
+    istore 1 1732
+    istore 1 1733
+    istore 1 1734
+    istore 1 1735
+    istore 1 1736
+    istore 1 1737
+    istore 1 1738
+    istore 1 1739
+    istore 1 1740
+    istore 1 1741
+    istore 1 1742
+    istore 1 1743
+    istore 1 1744
+    istore 1 1745
+    istore 1 1746
+    istore 1 1747
+    istore 1 1748
+    istore 1 1749
+    istore 1 1750
+    istore 1 1751
+    istore 1 1752
+    istore 1 1753
+    istore 1 1754
+    istore 1 1755
+    istore 1 1756
+    istore 1 1757
+    istore 1 1758
+    istore 1 1759
+    istore 1 1760
+    istore 1 1761
+    istore 1 1762
+    istore 1 1763
+    istore 1 1764
+    istore 1 1765
+    istore 1 1766
+    istore 1 1767
+    istore 1 1768
+    istore 1 1769
+    istore 1 1770
+    istore 1 1771
+    istore 1 1772
+    istore 1 1773
+    istore 1 1774
+    istore 1 1775
+    istore 1 1776
+    istore 1 1777
+    istore 1 1778
+    istore 1 1779
+    istore 1 1780
+    istore 1 1781
+    istore 1 1782
+    istore 1 1783
+    istore 1 1784
+    istore 1 1785
+    istore 1 1786
+    istore 1 1787
+    istore 1 1788
+    istore 1 1789
+    istore 1 1790
+    istore 1 1791
+    istore 1 1792
+    istore 1 1793
+    istore 1 1794
+    istore 1 1795
+    istore 1 1796
+    istore 1 1797
+    istore 1 1798
+    istore 1 1799
+    istore 1 1800
+    istore 1 1801
+    istore 1 1802
+    istore 1 1803
+    istore 1 1804
+    istore 1 1805
+    istore 1 1806
+    istore 1 1807
+    istore 1 1808
+    istore 1 1809
+    istore 1 1810
+    istore 1 1811
+    istore 1 1812
+    istore 1 1813
+    istore 1 1814
+    istore 1 1815
+    istore 1 1816
+    istore 1 1817
+    istore 1 1818
+    istore 1 1819
+    istore 1 1820
+    istore 1 1821
+    istore 1 1822
+    istore 1 1823
+    istore 1 1824
+    istore 1 1825
+    istore 1 1826
+    istore 1 1827
+    istore 1 1828
+    istore 1 1829
+    istore 1 1830
+    istore 1 1831
+    istore 1 1832
+    istore 1 1833
+    istore 1 1834
+    istore 1 1835
+    istore 1 1836
+    istore 1 1837
+    istore 1 1838
+    istore 1 1839
+    istore 1 1840
+    istore 1 1841
+    istore 1 1842
+    istore 1 1843
+    istore 1 1844
+    istore 1 1845
+    istore 1 1846
+    istore 1 1847
+    istore 1 1848
+    istore 1 1849
+    istore 1 1850
+    istore 1 1851
+    istore 1 1852
+    istore 1 1853
+    istore 1 1854
+    istore 1 1855
+    istore 1 1856
+    istore 1 1857
+    istore 1 1858
+    istore 1 1859
+    istore 1 1860
+    istore 1 1861
+    istore 1 1862
+    istore 1 1863
+    istore 1 1864
+    istore 1 1865
+    istore 1 1866
+    istore 1 1867
+    istore 1 1868
+    istore 1 1869
+    istore 1 1870
+    istore 1 1871
+    istore 1 1872
+    istore 1 1873
+    istore 1 1874
+    istore 1 1875
+    istore 1 1876
+    istore 1 1877
+    istore 1 1878
+    istore 1 1879
+    istore 1 1880
+    istore 1 1881
+    istore 1 1882
+    istore 1 1883
+    istore 1 1884
+    istore 1 1885
+    istore 1 1886
+    istore 1 1887
+    istore 1 1888
+    istore 1 1889
+    istore 1 1890
+    istore 1 1891
+    istore 1 1892
+    istore 1 1893
+    istore 1 1894
+    istore 1 1895
+    istore 1 1896
+    istore 1 1897
+    istore 1 1898
+    istore 1 1899
+    istore 1 1900
+    istore 1 1901
+    istore 1 1902
+    istore 1 1903
+    istore 1 1904
+    istore 1 1905
+    istore 1 1906
+    istore 1 1907
+    istore 1 1908
+    istore 1 1909
+    istore 1 1910
+    istore 1 1911
+    istore 1 1912
+    istore 1 1913
+    istore 1 1914
+    istore 1 1915
+    istore 1 1916
+    istore 1 1917
+    istore 1 1918
+    istore 1 1919
+    istore 1 1920
+    istore 1 1921
+    istore 1 1922
+    istore 1 1923
+    istore 1 1924
+    istore 1 1925
+    istore 1 1926
+    istore 1 1927
+    istore 1 1928
+    istore 1 1929
+    istore 1 1930
+    istore 1 1931
+    istore 1 1932
+    istore 1 1933
+    istore 1 1934
+    istore 1 1935
+    istore 1 1936
+    istore 1 1937
+    istore 1 1938
+    istore 1 1939
+    istore 1 1940
+    istore 1 1941
+    istore 1 1942
+    istore 1 1943
+    istore 1 1944
+    istore 1 1945
+    istore 1 1946
+    istore 1 1947
+    istore 1 1948
+    istore 1 1949
+    istore 1 1950
+    istore 1 1951
+    istore 1 1952
+    istore 1 1953
+    istore 1 1954
+    istore 1 1955
+    istore 1 1956
+    istore 1 1957
+    istore 1 1958
+    istore 1 1959
+    istore 1 1960
+    istore 1 1961
+    istore 1 1962
+    istore 1 1963
+    istore 1 1964
+    istore 1 1965
+    istore 1 1966
+    istore 1 1967
+    istore 1 1968
+    istore 1 1969
+    istore 1 1970
+    istore 1 1971
+    istore 1 1972
+    istore 1 1973
+    istore 1 1974
+    istore 1 1975
+    istore 1 1976
+    istore 1 1977
+    istore 1 1978
+    istore 1 1979
+    istore 1 1980
+    istore 1 1981
+    istore 1 1982
+    istore 1 1983
+    istore 1 1984
+    istore 1 1985
+    istore 1 1986
+    istore 1 1987
+    istore 1 1988
+    istore 1 1989
+    istore 1 1990
+    istore 1 1991
+    istore 1 1992
+    istore 1 1993
+    istore 1 1994
+    istore 1 1995
+    istore 1 1996
+    istore 1 1997
+    istore 1 1998
+    istore 1 1999
+    istore 1 2000
+    istore 1 2001
+    istore 1 2002
+    istore 1 2003
+    istore 1 2004
+    istore 1 2005
+    istore 1 2006
+    istore 1 2007
+    istore 1 2008
+    istore 1 2009
+    istore 1 2010
+    istore 1 2011
+    istore 1 2012
+    istore 1 2013
+    istore 1 2014
+    istore 1 2015
+    istore 1 2016
+    istore 1 2017
+    istore 1 2018
+    istore 1 2019
+    istore 1 2020
+    istore 1 2021
+    istore 1 2022
+    istore 1 2023
+    istore 1 2024
+    istore 1 2025
+    istore 1 2026
+    istore 1 2027
+    istore 1 2028
+    istore 1 2029
+    istore 1 2030
+    istore 1 2031
+    istore 1 2032
+    istore 1 2033
+    istore 1 2034
+    istore 1 2035
+    istore 1 2036
+    istore 1 2037
+    istore 1 2038
+    istore 1 2039
+    istore 1 2040
+    istore 1 2041
+    istore 1 2042
+    istore 1 2043
+    istore 1 2044
+    istore 1 2045
+    istore 1 2046
+    istore 1 2047
+    istore 1 2048
+    istore 1 2049
+    istore 1 2050
+    istore 1 2051
+    istore 1 2052
+    istore 1 2053
+    istore 1 2054
+    istore 1 2055
+    istore 1 2056
+    istore 1 2057
+    istore 1 2058
+    istore 1 2059
+    istore 1 2060
+    istore 1 2061
+    istore 1 2062
+    istore 1 2063
+    istore 1 2064
+    istore 1 2065
+    istore 1 2066
+    istore 1 2067
+    istore 1 2068
+    istore 1 2069
+    istore 1 2070
+    istore 1 2071
+    istore 1 2072
+    istore 1 2073
+    istore 1 2074
+    istore 1 2075
+    istore 1 2076
+    istore 1 2077
+    istore 1 2078
+    istore 1 2079
+    istore 1 2080
+    istore 1 2081
+    istore 1 2082
+    istore 1 2083
+    istore 1 2084
+    istore 1 2085
+    istore 1 2086
+    istore 1 2087
+    istore 1 2088
+    istore 1 2089
+    istore 1 2090
+    istore 1 2091
+    istore 1 2092
+    istore 1 2093
+    istore 1 2094
+    istore 1 2095
+    istore 1 2096
+    istore 1 2097
+    istore 1 2098
+    istore 1 2099
+    istore 1 2100
+    istore 1 2101
+    istore 1 2102
+    istore 1 2103
+    istore 1 2104
+    istore 1 2105
+    istore 1 2106
+    istore 1 2107
+    istore 1 2108
+    istore 1 2109
+    istore 1 2110
+    istore 1 2111
+    istore 1 2112
+    istore 1 2113
+    istore 1 2114
+    istore 1 2115
+    istore 1 2116
+    istore 1 2117
+    istore 1 2118
+    istore 1 2119
+    istore 1 2120
+    istore 1 2121
+    istore 1 2122
+    istore 1 2123
+    istore 1 2124
+    istore 1 2125
+    istore 1 2126
+    istore 1 2127
+    istore 1 2128
+    istore 1 2129
+    istore 1 2130
+    istore 1 2131
+    istore 1 2132
+    istore 1 2133
+    istore 1 2134
+    istore 1 2135
+    istore 1 2136
+    istore 1 2137
+    istore 1 2138
+    istore 1 2139
+    istore 1 2140
+    istore 1 2141
+    istore 1 2142
+    istore 1 2143
+    istore 1 2144
+    istore 1 2145
+    istore 1 2146
+    istore 1 2147
+    istore 1 2148
+    istore 1 2149
+    istore 1 2150
+    istore 1 2151
+    istore 1 2152
+    istore 1 2153
+    istore 1 2154
+    istore 1 2155
+    istore 1 2156
+    istore 1 2157
+    istore 1 2158
+    istore 1 2159
+    istore 1 2160
+    istore 1 2161
+    istore 1 2162
+    istore 1 2163
+    istore 1 2164
+    istore 1 2165
+    istore 1 2166
+    istore 1 2167
+    istore 1 2168
+    istore 1 2169
+    istore 1 2170
+    istore 1 2171
+    istore 1 2172
+    istore 1 2173
+    istore 1 2174
+    istore 1 2175
+    istore 1 2176
+    istore 1 2177
+    istore 1 2178
+    istore 1 2179
+    istore 1 2180
+    istore 1 2181
+    istore 1 2182
+    istore 1 2183
+    istore 1 2184
+    istore 1 2185
+    istore 1 2186
+    istore 1 2187
+    istore 1 2188
+    istore 1 2189
+    istore 1 2190
+    istore 1 2191
+    istore 1 2192
+    istore 1 2193
+    istore 1 2194
+    istore 1 2195
+    istore 1 2196
+    istore 1 2197
+    istore 1 2198
+    istore 1 2199
+    istore 1 2200
+    istore 1 2201
+    istore 1 2202
+    istore 1 2203
+    istore 1 2204
+    istore 1 2205
+    istore 1 2206
+    istore 1 2207
+    istore 1 2208
+    istore 1 2209
+    istore 1 2210
+    istore 1 2211
+    istore 1 2212
+    istore 1 2213
+    istore 1 2214
+    istore 1 2215
+    istore 1 2216
+    istore 1 2217
+    istore 1 2218
+    istore 1 2219
+    istore 1 2220
+    istore 1 2221
+    istore 1 2222
+    istore 1 2223
+    istore 1 2224
+    istore 1 2225
+    istore 1 2226
+    istore 1 2227
+    istore 1 2228
+    istore 1 2229
+    istore 1 2230
+    istore 1 2231
+    istore 1 2232
+    istore 1 2233
+    istore 1 2234
+    istore 1 2235
+    istore 1 2236
+    istore 1 2237
+    istore 1 2238
+    istore 1 2239
+    istore 1 2240
+    istore 1 2241
+    istore 1 2242
+    istore 1 2243
+    istore 1 2244
+    istore 1 2245
+    istore 1 2246
+    istore 1 2247
+    istore 1 2248
+    istore 1 2249
+    istore 1 2250
+    istore 1 2251
+    istore 1 2252
+    istore 1 2253
+    istore 1 2254
+    istore 1 2255
+    istore 1 2256
+    istore 1 2257
+    istore 1 2258
+    istore 1 2259
+    istore 1 2260
+    istore 1 2261
+    istore 1 2262
+    istore 1 2263
+    istore 1 2264
+    istore 1 2265
+    istore 1 2266
+    istore 1 2267
+    istore 1 2268
+    istore 1 2269
+    istore 1 2270
+    istore 1 2271
+    istore 1 2272
+    istore 1 2273
+    istore 1 2274
+    istore 1 2275
+    istore 1 2276
+    istore 1 2277
+    istore 1 2278
+    istore 1 2279
+    istore 1 2280
+    istore 1 2281
+    istore 1 2282
+    istore 1 2283
+    istore 1 2284
+    istore 1 2285
+    istore 1 2286
+    istore 1 2287
+    istore 1 2288
+    istore 1 2289
+    istore 1 2290
+    istore 1 2291
+    istore 1 2292
+    istore 1 2293
+    istore 1 2294
+    istore 1 2295
+    istore 1 2296
+    istore 1 2297
+    istore 1 2298
+    istore 1 2299
+    istore 1 2300
+    istore 1 2301
+    istore 1 2302
+    istore 1 2303
+    istore 1 2304
+    istore 1 2305
+    istore 1 2306
+    istore 1 2307
+    istore 1 2308
+    istore 1 2309
+    istore 1 2310
+    istore 1 2311
+    istore 1 2312
+    istore 1 2313
+    istore 1 2314
+    istore 1 2315
+    istore 1 2316
+    istore 1 2317
+    istore 1 2318
+    istore 1 2319
+    istore 1 2320
+    istore 1 2321
+    istore 1 2322
+    istore 1 2323
+    istore 1 2324
+    istore 1 2325
+    istore 1 2326
+    istore 1 2327
+    istore 1 2328
+    istore 1 2329
+    istore 1 2330
+    istore 1 2331
+    istore 1 2332
+    istore 1 2333
+    istore 1 2334
+    istore 1 2335
+    istore 1 2336
+    istore 1 2337
+    istore 1 2338
+    istore 1 2339
+    istore 1 2340
+    istore 1 2341
+    istore 1 2342
+    istore 1 2343
+    istore 1 2344
+    istore 1 2345
+    istore 1 2346
+    istore 1 2347
+    istore 1 2348
+    istore 1 2349
+    istore 1 2350
+    istore 1 2351
+    istore 1 2352
+    istore 1 2353
+    istore 1 2354
+    istore 1 2355
+    istore 1 2356
+    istore 1 2357
+    istore 1 2358
+    istore 1 2359
+    istore 1 2360
+    istore 1 2361
+    istore 1 2362
+    istore 1 2363
+    istore 1 2364
+    istore 1 2365
+    istore 1 2366
+    istore 1 2367
+    istore 1 2368
+    istore 1 2369
+    istore 1 2370
+    istore 1 2371
+    istore 1 2372
+    istore 1 2373
+    istore 1 2374
+    istore 1 2375
+    istore 1 2376
+    istore 1 2377
+    istore 1 2378
+    istore 1 2379
+    istore 1 2380
+    istore 1 2381
+    istore 1 2382
+    istore 1 2383
+    istore 1 2384
+    istore 1 2385
+    istore 1 2386
+    istore 1 2387
+    istore 1 2388
+    istore 1 2389
+    istore 1 2390
+    istore 1 2391
+    istore 1 2392
+    istore 1 2393
+    istore 1 2394
+    istore 1 2395
+    istore 1 2396
+    istore 1 2397
+    istore 1 2398
+    istore 1 2399
+    istore 1 2400
+    istore 1 2401
+    istore 1 2402
+    istore 1 2403
+    istore 1 2404
+    istore 1 2405
+    istore 1 2406
+    istore 1 2407
+    istore 1 2408
+    istore 1 2409
+    istore 1 2410
+    istore 1 2411
+    istore 1 2412
+    istore 1 2413
+    istore 1 2414
+    istore 1 2415
+    istore 1 2416
+    istore 1 2417
+    istore 1 2418
+    istore 1 2419
+    istore 1 2420
+    istore 1 2421
+    istore 1 2422
+    istore 1 2423
+    istore 1 2424
+    istore 1 2425
+    istore 1 2426
+    istore 1 2427
+    istore 1 2428
+    istore 1 2429
+    istore 1 2430
+    istore 1 2431
+    istore 1 2432
+    istore 1 2433
+    istore 1 2434
+    istore 1 2435
+    istore 1 2436
+    istore 1 2437
+    istore 1 2438
+    istore 1 2439
+    istore 1 2440
+    istore 1 2441
+    istore 1 2442
+    istore 1 2443
+    istore 1 2444
+    istore 1 2445
+    istore 1 2446
+    istore 1 2447
+    istore 1 2448
+    istore 1 2449
+    istore 1 2450
+    istore 1 2451
+    istore 1 2452
+    istore 1 2453
+    istore 1 2454
+    istore 1 2455
+    istore 1 2456
+    istore 1 2457
+    istore 1 2458
+    istore 1 2459
+    istore 1 2460
+    istore 1 2461
+    istore 1 2462
+    istore 1 2463
+    istore 1 2464
+    istore 1 2465
+    istore 1 2466
+    istore 1 2467
+    istore 1 2468
+    istore 1 2469
+    istore 1 2470
+    istore 1 2471
+    istore 1 2472
+    istore 1 2473
+    istore 1 2474
+    istore 1 2475
+    istore 1 2476
+    istore 1 2477
+    istore 1 2478
+    istore 1 2479
+    istore 1 2480
+    istore 1 2481
+    istore 1 2482
+    istore 1 2483
+    istore 1 2484
+    istore 1 2485
+    istore 1 2486
+    istore 1 2487
+    istore 1 2488
+    istore 1 2489
+    istore 1 2490
+    istore 1 2491
+    istore 1 2492
+    istore 1 2493
+    istore 1 2494
+    istore 1 2495
+    istore 1 2496
+    istore 1 2497
+    istore 1 2498
+    istore 1 2499
+    istore 1 2500
+    istore 1 2501
+    istore 1 2502
+    istore 1 2503
+    istore 1 2504
+    istore 1 2505
+    istore 1 2506
+    istore 1 2507
+    istore 1 2508
+    istore 1 2509
+    istore 1 2510
+    istore 1 2511
+    istore 1 2512
+    istore 1 2513
+    istore 1 2514
+    istore 1 2515
+    istore 1 2516
+    istore 1 2517
+    istore 1 2518
+    istore 1 2519
+    istore 1 2520
+    istore 1 2521
+    istore 1 2522
+    istore 1 2523
+    istore 1 2524
+    istore 1 2525
+    istore 1 2526
+    istore 1 2527
+    istore 1 2528
+    istore 1 2529
+    istore 1 2530
+    istore 1 2531
+    istore 1 2532
+    istore 1 2533
+    istore 1 2534
+    istore 1 2535
+    istore 1 2536
+    istore 1 2537
+    istore 1 2538
+    istore 1 2539
+    istore 1 2540
+    istore 1 2541
+    istore 1 2542
+    istore 1 2543
+    istore 1 2544
+    istore 1 2545
+    istore 1 2546
+    istore 1 2547
+    istore 1 2548
+    istore 1 2549
+    istore 1 2550
+    istore 1 2551
+    istore 1 2552
+    istore 1 2553
+    istore 1 2554
+    istore 1 2555
+    istore 1 2556
+    istore 1 2557
+    istore 1 2558
+    istore 1 2559
+    istore 1 2560
+    istore 1 2561
+    istore 1 2562
+    istore 1 2563
+    istore 1 2564
+    istore 1 2565
+    istore 1 2566
+    istore 1 2567
+    istore 1 2568
+    istore 1 2569
+    istore 1 2570
+    istore 1 2571
+    istore 1 2572
+    istore 1 2573
+    istore 1 2574
+    istore 1 2575
+    istore 1 2576
+    istore 1 2577
+    istore 1 2578
+    istore 1 2579
+    istore 1 2580
+    istore 1 2581
+    istore 1 2582
+    istore 1 2583
+    istore 1 2584
+    istore 1 2585
+    istore 1 2586
+    istore 1 2587
+    istore 1 2588
+    istore 1 2589
+    istore 1 2590
+    istore 1 2591
+    istore 1 2592
+    istore 1 2593
+    istore 1 2594
+    istore 1 2595
+    istore 1 2596
+    istore 1 2597
+    istore 1 2598
+    istore 1 2599
+    istore 1 2600
+    istore 1 2601
+    istore 1 2602
+    istore 1 2603
+    istore 1 2604
+    istore 1 2605
+    istore 1 2606
+    istore 1 2607
+    istore 1 2608
+    istore 1 2609
+    istore 1 2610
+    istore 1 2611
+    istore 1 2612
+    istore 1 2613
+    istore 1 2614
+    istore 1 2615
+    istore 1 2616
+    istore 1 2617
+    istore 1 2618
+    istore 1 2619
+    istore 1 2620
+    istore 1 2621
+    istore 1 2622
+    istore 1 2623
+    istore 1 2624
+    istore 1 2625
+    istore 1 2626
+    istore 1 2627
+    istore 1 2628
+    istore 1 2629
+    istore 1 2630
+    istore 1 2631
+    istore 1 2632
+    istore 1 2633
+    istore 1 2634
+    istore 1 2635
+    istore 1 2636
+    istore 1 2637
+    istore 1 2638
+    istore 1 2639
+    istore 1 2640
+    istore 1 2641
+    istore 1 2642
+    istore 1 2643
+    istore 1 2644
+    istore 1 2645
+    istore 1 2646
+    istore 1 2647
+    istore 1 2648
+    istore 1 2649
+    istore 1 2650
+    istore 1 2651
+    istore 1 2652
+    istore 1 2653
+    istore 1 2654
+    istore 1 2655
+    istore 1 2656
+    istore 1 2657
+    istore 1 2658
+    istore 1 2659
+    istore 1 2660
+    istore 1 2661
+    istore 1 2662
+    istore 1 2663
+    istore 1 2664
+    istore 1 2665
+    istore 1 2666
+    istore 1 2667
+    istore 1 2668
+    istore 1 2669
+    istore 1 2670
+    istore 1 2671
+    istore 1 2672
+    istore 1 2673
+    istore 1 2674
+    istore 1 2675
+    istore 1 2676
+    istore 1 2677
+    istore 1 2678
+    istore 1 2679
+    istore 1 2680
+    istore 1 2681
+    istore 1 2682
+    istore 1 2683
+    istore 1 2684
+    istore 1 2685
+    istore 1 2686
+    istore 1 2687
+    istore 1 2688
+    istore 1 2689
+    istore 1 2690
+    istore 1 2691
+    istore 1 2692
+    istore 1 2693
+    istore 1 2694
+    istore 1 2695
+    istore 1 2696
+    istore 1 2697
+    istore 1 2698
+    istore 1 2699
+    istore 1 2700
+    istore 1 2701
+    istore 1 2702
+    istore 1 2703
+    istore 1 2704
+    istore 1 2705
+    istore 1 2706
+    istore 1 2707
+    istore 1 2708
+    istore 1 2709
+    istore 1 2710
+    istore 1 2711
+    istore 1 2712
+    istore 1 2713
+    istore 1 2714
+    istore 1 2715
+    istore 1 2716
+    istore 1 2717
+    istore 1 2718
+    istore 1 2719
+    istore 1 2720
+    istore 1 2721
+    istore 1 2722
+    istore 1 2723
+    istore 1 2724
+    istore 1 2725
+    istore 1 2726
+    istore 1 2727
+    istore 1 2728
+    istore 1 2729
+    istore 1 2730
+    istore 1 2731
+    istore 1 2732
+    istore 1 2733
+    istore 1 2734
+    istore 1 2735
+    istore 1 2736
+    istore 1 2737
+    istore 1 2738
+    istore 1 2739
+    istore 1 2740
+    istore 1 2741
+    istore 1 2742
+    istore 1 2743
+    istore 1 2744
+    istore 1 2745
+    istore 1 2746
+    istore 1 2747
+    istore 1 2748
+    istore 1 2749
+    istore 1 2750
+    istore 1 2751
+    istore 1 2752
+    istore 1 2753
+    istore 1 2754
+    istore 1 2755
+    istore 1 2756
+    istore 1 2757
+    istore 1 2758
+    istore 1 2759
+    istore 1 2760
+    istore 1 2761
+    istore 1 2762
+    istore 1 2763
+    istore 1 2764
+    istore 1 2765
+    istore 1 2766
+    istore 1 2767
+    istore 1 2768
+    istore 1 2769
+    istore 1 2770
+    istore 1 2771
+    istore 1 2772
+    istore 1 2773
+    istore 1 2774
+    istore 1 2775
+    istore 1 2776
+    istore 1 2777
+    istore 1 2778
+    istore 1 2779
+    istore 1 2780
+    istore 1 2781
+    istore 1 2782
+    istore 1 2783
+    istore 1 2784
+    istore 1 2785
+    istore 1 2786
+    istore 1 2787
+    istore 1 2788
+    istore 1 2789
+    istore 1 2790
+    istore 1 2791
+    istore 1 2792
+    istore 1 2793
+    istore 1 2794
+    istore 1 2795
+    istore 1 2796
+    istore 1 2797
+    istore 1 2798
+    istore 1 2799
+    istore 1 2800
+    istore 1 2801
+    istore 1 2802
+    istore 1 2803
+    istore 1 2804
+    istore 1 2805
+    istore 1 2806
+    istore 1 2807
+    istore 1 2808
+    istore 1 2809
+    istore 1 2810
+    istore 1 2811
+    istore 1 2812
+    istore 1 2813
+    istore 1 2814
+    istore 1 2815
+    istore 1 2816
+    istore 1 2817
+    istore 1 2818
+    istore 1 2819
+    istore 1 2820
+    istore 1 2821
+    istore 1 2822
+    istore 1 2823
+    istore 1 2824
+    istore 1 2825
+    istore 1 2826
+    istore 1 2827
+    istore 1 2828
+    istore 1 2829
+    istore 1 2830
+    istore 1 2831
+    istore 1 2832
+    istore 1 2833
+    istore 1 2834
+    istore 1 2835
+    istore 1 2836
+    istore 1 2837
+    istore 1 2838
+    istore 1 2839
+    istore 1 2840
+    istore 1 2841
+    istore 1 2842
+    istore 1 2843
+    istore 1 2844
+    istore 1 2845
+    istore 1 2846
+    istore 1 2847
+    istore 1 2848
+    istore 1 2849
+    istore 1 2850
+    istore 1 2851
+    istore 1 2852
+    istore 1 2853
+    istore 1 2854
+    istore 1 2855
+    istore 1 2856
+    istore 1 2857
+    istore 1 2858
+    istore 1 2859
+    istore 1 2860
+    istore 1 2861
+    istore 1 2862
+    istore 1 2863
+    istore 1 2864
+    istore 1 2865
+    istore 1 2866
+    istore 1 2867
+    istore 1 2868
+    istore 1 2869
+    istore 1 2870
+    istore 1 2871
+    istore 1 2872
+    istore 1 2873
+    istore 1 2874
+    istore 1 2875
+    istore 1 2876
+    istore 1 2877
+    istore 1 2878
+    istore 1 2879
+    istore 1 2880
+    istore 1 2881
+    istore 1 2882
+    istore 1 2883
+    istore 1 2884
+    istore 1 2885
+    istore 1 2886
+    istore 1 2887
+    istore 1 2888
+    istore 1 2889
+    istore 1 2890
+    istore 1 2891
+    istore 1 2892
+    istore 1 2893
+    istore 1 2894
+    istore 1 2895
+    istore 1 2896
+    istore 1 2897
+    istore 1 2898
+    istore 1 2899
+    istore 1 2900
+    istore 1 2901
+    istore 1 2902
+    istore 1 2903
+    istore 1 2904
+    istore 1 2905
+    istore 1 2906
+    istore 1 2907
+    istore 1 2908
+    istore 1 2909
+    istore 1 2910
+    istore 1 2911
+    istore 1 2912
+    istore 1 2913
+    istore 1 2914
+    istore 1 2915
+    istore 1 2916
+    istore 1 2917
+    istore 1 2918
+    istore 1 2919
+    istore 1 2920
+    istore 1 2921
+    istore 1 2922
+    istore 1 2923
+    istore 1 2924
+    istore 1 2925
+    istore 1 2926
+    istore 1 2927
+    istore 1 2928
+    istore 1 2929
+    istore 1 2930
+    istore 1 2931
+    istore 1 2932
+    istore 1 2933
+    istore 1 2934
+    istore 1 2935
+    istore 1 2936
+    istore 1 2937
+    istore 1 2938
+    istore 1 2939
+    istore 1 2940
+    istore 1 2941
+    istore 1 2942
+    istore 1 2943
+    istore 1 2944
+    istore 1 2945
+    istore 1 2946
+    istore 1 2947
+    istore 1 2948
+    istore 1 2949
+    istore 1 2950
+    istore 1 2951
+    istore 1 2952
+    istore 1 2953
+    istore 1 2954
+    istore 1 2955
+    istore 1 2956
+    istore 1 2957
+    istore 1 2958
+    istore 1 2959
+    istore 1 2960
+    istore 1 2961
+    istore 1 2962
+    istore 1 2963
+    istore 1 2964
+    istore 1 2965
+    istore 1 2966
+    istore 1 2967
+    istore 1 2968
+    istore 1 2969
+    istore 1 2970
+    istore 1 2971
+    istore 1 2972
+    istore 1 2973
+    istore 1 2974
+    istore 1 2975
+    istore 1 2976
+    istore 1 2977
+    istore 1 2978
+    istore 1 2979
+    istore 1 2980
+    istore 1 2981
+    istore 1 2982
+    istore 1 2983
+    istore 1 2984
+    istore 1 2985
+    istore 1 2986
+    istore 1 2987
+    istore 1 2988
+    istore 1 2989
+    istore 1 2990
+    istore 1 2991
+    istore 1 2992
+    istore 1 2993
+    istore 1 2994
+    istore 1 2995
+    istore 1 2996
+    istore 1 2997
+    istore 1 2998
+    istore 1 2999
+    istore 1 3000
+    istore 1 3001
+    istore 1 3002
+    istore 1 3003
+    istore 1 3004
+    istore 1 3005
+    istore 1 3006
+    istore 1 3007
+    istore 1 3008
+    istore 1 3009
+    istore 1 3010
+    istore 1 3011
+    istore 1 3012
+    istore 1 3013
+    istore 1 3014
+    istore 1 3015
+    istore 1 3016
+    istore 1 3017
+    istore 1 3018
+    istore 1 3019
+    istore 1 3020
+    istore 1 3021
+    istore 1 3022
+    istore 1 3023
+    istore 1 3024
+    istore 1 3025
+    istore 1 3026
+    istore 1 3027
+    istore 1 3028
+    istore 1 3029
+    istore 1 3030
+    istore 1 3031
+    istore 1 3032
+    istore 1 3033
+    istore 1 3034
+    istore 1 3035
+    istore 1 3036
+    istore 1 3037
+    istore 1 3038
+    istore 1 3039
+    istore 1 3040
+    istore 1 3041
+    istore 1 3042
+    istore 1 3043
+    istore 1 3044
+    istore 1 3045
+    istore 1 3046
+    istore 1 3047
+    istore 1 3048
+    istore 1 3049
+    istore 1 3050
+    istore 1 3051
+    istore 1 3052
+    istore 1 3053
+    istore 1 3054
+    istore 1 3055
+    istore 1 3056
+    istore 1 3057
+    istore 1 3058
+    istore 1 3059
+    istore 1 3060
+    istore 1 3061
+    istore 1 3062
+    istore 1 3063
+    istore 1 3064
+    istore 1 3065
+    istore 1 3066
+    istore 1 3067
+    istore 1 3068
+    istore 1 3069
+    istore 1 3070
+    istore 1 3071
+    istore 1 3072
+    istore 1 3073
+    istore 1 3074
+    istore 1 3075
+    istore 1 3076
+    istore 1 3077
+    istore 1 3078
+    istore 1 3079
+    istore 1 3080
+    istore 1 3081
+    istore 1 3082
+    istore 1 3083
+    istore 1 3084
+    istore 1 3085
+    istore 1 3086
+    istore 1 3087
+    istore 1 3088
+    istore 1 3089
+    istore 1 3090
+    istore 1 3091
+    istore 1 3092
+    istore 1 3093
+    istore 1 3094
+    istore 1 3095
+    istore 1 3096
+    istore 1 3097
+    istore 1 3098
+    istore 1 3099
+    istore 1 3100
+    istore 1 3101
+    istore 1 3102
+    istore 1 3103
+    istore 1 3104
+    istore 1 3105
+    istore 1 3106
+    istore 1 3107
+    istore 1 3108
+    istore 1 3109
+    istore 1 3110
+    istore 1 3111
+    istore 1 3112
+    istore 1 3113
+    istore 1 3114
+    istore 1 3115
+    istore 1 3116
+    istore 1 3117
+    istore 1 3118
+    istore 1 3119
+    istore 1 3120
+    istore 1 3121
+    istore 1 3122
+    istore 1 3123
+    istore 1 3124
+    istore 1 3125
+    istore 1 3126
+    istore 1 3127
+    istore 1 3128
+    istore 1 3129
+    istore 1 3130
+    istore 1 3131
+    istore 1 3132
+    istore 1 3133
+    istore 1 3134
+    istore 1 3135
+    istore 1 3136
+    istore 1 3137
+    istore 1 3138
+    istore 1 3139
+    istore 1 3140
+    istore 1 3141
+    istore 1 3142
+    istore 1 3143
+    istore 1 3144
+    istore 1 3145
+    istore 1 3146
+    istore 1 3147
+    istore 1 3148
+    istore 1 3149
+    istore 1 3150
+    istore 1 3151
+    istore 1 3152
+    istore 1 3153
+    istore 1 3154
+    istore 1 3155
+    istore 1 3156
+    istore 1 3157
+    istore 1 3158
+    istore 1 3159
+    istore 1 3160
+    istore 1 3161
+    istore 1 3162
+    istore 1 3163
+    istore 1 3164
+    istore 1 3165
+    istore 1 3166
+    istore 1 3167
+    istore 1 3168
+    istore 1 3169
+    istore 1 3170
+    istore 1 3171
+    istore 1 3172
+    istore 1 3173
+    istore 1 3174
+    istore 1 3175
+    istore 1 3176
+    istore 1 3177
+    istore 1 3178
+    istore 1 3179
+    istore 1 3180
+    istore 1 3181
+    istore 1 3182
+    istore 1 3183
+    istore 1 3184
+    istore 1 3185
+    istore 1 3186
+    istore 1 3187
+    istore 1 3188
+    istore 1 3189
+    istore 1 3190
+    istore 1 3191
+    istore 1 3192
+    istore 1 3193
+    istore 1 3194
+    istore 1 3195
+    istore 1 3196
+    istore 1 3197
+    istore 1 3198
+    istore 1 3199
+    istore 1 3200
+    istore 1 3201
+    istore 1 3202
+    istore 1 3203
+    istore 1 3204
+    istore 1 3205
+    istore 1 3206
+    istore 1 3207
+    istore 1 3208
+    istore 1 3209
+    istore 1 3210
+    istore 1 3211
+    istore 1 3212
+    istore 1 3213
+    istore 1 3214
+    istore 1 3215
+    istore 1 3216
+    istore 1 3217
+    istore 1 3218
+    istore 1 3219
+    istore 1 3220
+    istore 1 3221
+    istore 1 3222
+    istore 1 3223
+    istore 1 3224
+    istore 1 3225
+    istore 1 3226
+    istore 1 3227
+    istore 1 3228
+    istore 1 3229
+    istore 1 3230
+    istore 1 3231
+    istore 1 3232
+    istore 1 3233
+    istore 1 3234
+    istore 1 3235
+    istore 1 3236
+    istore 1 3237
+    istore 1 3238
+    istore 1 3239
+    istore 1 3240
+    istore 1 3241
+    istore 1 3242
+    istore 1 3243
+    istore 1 3244
+    istore 1 3245
+    istore 1 3246
+    istore 1 3247
+    istore 1 3248
+    istore 1 3249
+    istore 1 3250
+    istore 1 3251
+    istore 1 3252
+    istore 1 3253
+    istore 1 3254
+    istore 1 3255
+    istore 1 3256
+    istore 1 3257
+    istore 1 3258
+    istore 1 3259
+    istore 1 3260
+    istore 1 3261
+    istore 1 3262
+    istore 1 3263
+    istore 1 3264
+    istore 1 3265
+    istore 1 3266
+    istore 1 3267
+    istore 1 3268
+    istore 1 3269
+    istore 1 3270
+    istore 1 3271
+    istore 1 3272
+    istore 1 3273
+    istore 1 3274
+    istore 1 3275
+    istore 1 3276
+    istore 1 3277
+    istore 1 3278
+    istore 1 3279
+    istore 1 3280
+    istore 1 3281
+    istore 1 3282
+    istore 1 3283
+    istore 1 3284
+    istore 1 3285
+    istore 1 3286
+    istore 1 3287
+    istore 1 3288
+    istore 1 3289
+    istore 1 3290
+    istore 1 3291
+    istore 1 3292
+    istore 1 3293
+    istore 1 3294
+    istore 1 3295
+    istore 1 3296
+    istore 1 3297
+    istore 1 3298
+    istore 1 3299
+    istore 1 3300
+    istore 1 3301
+    istore 1 3302
+    istore 1 3303
+    istore 1 3304
+    istore 1 3305
+    istore 1 3306
+    istore 1 3307
+    istore 1 3308
+    istore 1 3309
+    istore 1 3310
+    istore 1 3311
+    istore 1 3312
+    istore 1 3313
+    istore 1 3314
+    istore 1 3315
+    istore 1 3316
+    istore 1 3317
+    istore 1 3318
+    istore 1 3319
+    istore 1 3320
+    istore 1 3321
+    istore 1 3322
+    istore 1 3323
+    istore 1 3324
+    istore 1 3325
+    istore 1 3326
+    istore 1 3327
+    istore 1 3328
+    istore 1 3329
+    istore 1 3330
+    istore 1 3331
+    istore 1 3332
+    istore 1 3333
+    istore 1 3334
+    istore 1 3335
+    istore 1 3336
+    istore 1 3337
+    istore 1 3338
+    istore 1 3339
+    istore 1 3340
+    istore 1 3341
+    istore 1 3342
+    istore 1 3343
+    istore 1 3344
+    istore 1 3345
+    istore 1 3346
+    istore 1 3347
+    istore 1 3348
+    istore 1 3349
+    istore 1 3350
+    istore 1 3351
+    istore 1 3352
+    istore 1 3353
+    istore 1 3354
+    istore 1 3355
+    istore 1 3356
+    istore 1 3357
+    istore 1 3358
+    istore 1 3359
+    istore 1 3360
+    istore 1 3361
+    istore 1 3362
+    istore 1 3363
+    istore 1 3364
+    istore 1 3365
+    istore 1 3366
+    istore 1 3367
+    istore 1 3368
+    istore 1 3369
+    istore 1 3370
+    istore 1 3371
+    istore 1 3372
+    istore 1 3373
+    istore 1 3374
+    istore 1 3375
+    istore 1 3376
+    istore 1 3377
+    istore 1 3378
+    istore 1 3379
+    istore 1 3380
+    istore 1 3381
+    istore 1 3382
+    istore 1 3383
+    istore 1 3384
+    istore 1 3385
+    istore 1 3386
+    istore 1 3387
+    istore 1 3388
+    istore 1 3389
+    istore 1 3390
+    istore 1 3391
+    istore 1 3392
+    istore 1 3393
+    istore 1 3394
+    istore 1 3395
+    istore 1 3396
+    istore 1 3397
+    istore 1 3398
+    istore 1 3399
+    istore 1 3400
+    istore 1 3401
+    istore 1 3402
+    istore 1 3403
+    istore 1 3404
+    istore 1 3405
+    istore 1 3406
+    istore 1 3407
+    istore 1 3408
+    istore 1 3409
+    istore 1 3410
+    istore 1 3411
+    istore 1 3412
+    istore 1 3413
+    istore 1 3414
+    istore 1 3415
+    istore 1 3416
+    istore 1 3417
+    istore 1 3418
+    istore 1 3419
+    istore 1 3420
+    istore 1 3421
+    istore 1 3422
+    istore 1 3423
+    istore 1 3424
+    istore 1 3425
+    istore 1 3426
+    istore 1 3427
+    istore 1 3428
+    istore 1 3429
+    istore 1 3430
+    istore 1 3431
+    istore 1 3432
+    istore 1 3433
+    istore 1 3434
+    istore 1 3435
+    istore 1 3436
+    istore 1 3437
+    istore 1 3438
+    istore 1 3439
+    istore 1 3440
+    istore 1 3441
+    istore 1 3442
+    istore 1 3443
+    istore 1 3444
+    istore 1 3445
+    istore 1 3446
+    istore 1 3447
+    istore 1 3448
+    istore 1 3449
+    istore 1 3450
+    istore 1 3451
+    istore 1 3452
+    istore 1 3453
+    istore 1 3454
+    istore 1 3455
+    istore 1 3456
+    istore 1 3457
+    istore 1 3458
+    istore 1 3459
+    istore 1 3460
+    istore 1 3461
+    istore 1 3462
+    istore 1 3463
+    istore 1 3464
+    istore 1 3465
+    istore 1 3466
+    istore 1 3467
+    istore 1 3468
+    istore 1 3469
+    istore 1 3470
+    istore 1 3471
+    istore 1 3472
+    istore 1 3473
+    istore 1 3474
+    istore 1 3475
+    istore 1 3476
+    istore 1 3477
+    istore 1 3478
+    istore 1 3479
+    istore 1 3480
+    istore 1 3481
+    istore 1 3482
+    istore 1 3483
+    istore 1 3484
+    istore 1 3485
+    istore 1 3486
+    istore 1 3487
+    istore 1 3488
+    istore 1 3489
+    istore 1 3490
+    istore 1 3491
+    istore 1 3492
+    istore 1 3493
+    istore 1 3494
+    istore 1 3495
+    istore 1 3496
+    istore 1 3497
+    istore 1 3498
+    istore 1 3499
+    istore 1 3500
+    istore 1 3501
+    istore 1 3502
+    istore 1 3503
+    istore 1 3504
+    istore 1 3505
+    istore 1 3506
+    istore 1 3507
+    istore 1 3508
+    istore 1 3509
+    istore 1 3510
+    istore 1 3511
+    istore 1 3512
+    istore 1 3513
+    istore 1 3514
+    istore 1 3515
+    istore 1 3516
+    istore 1 3517
+    istore 1 3518
+    istore 1 3519
+    istore 1 3520
+    istore 1 3521
+    istore 1 3522
+    istore 1 3523
+    istore 1 3524
+    istore 1 3525
+    istore 1 3526
+    istore 1 3527
+    istore 1 3528
+    istore 1 3529
+    istore 1 3530
+    istore 1 3531
+    istore 1 3532
+    istore 1 3533
+    istore 1 3534
+    istore 1 3535
+    istore 1 3536
+    istore 1 3537
+    istore 1 3538
+    istore 1 3539
+    istore 1 3540
+    istore 1 3541
+    istore 1 3542
+    istore 1 3543
+    istore 1 3544
+    istore 1 3545
+    istore 1 3546
+    istore 1 3547
+    istore 1 3548
+    istore 1 3549
+    istore 1 3550
+    istore 1 3551
+    istore 1 3552
+    istore 1 3553
+    istore 1 3554
+    istore 1 3555
+    istore 1 3556
+    istore 1 3557
+    istore 1 3558
+    istore 1 3559
+    istore 1 3560
+    istore 1 3561
+    istore 1 3562
+    istore 1 3563
+    istore 1 3564
+    istore 1 3565
+    istore 1 3566
+    istore 1 3567
+    istore 1 3568
+    istore 1 3569
+    istore 1 3570
+    istore 1 3571
+    istore 1 3572
+    istore 1 3573
+    istore 1 3574
+    istore 1 3575
+    istore 1 3576
+    istore 1 3577
+    istore 1 3578
+    istore 1 3579
+    istore 1 3580
+    istore 1 3581
+    istore 1 3582
+    istore 1 3583
+    istore 1 3584
+    istore 1 3585
+    istore 1 3586
+    istore 1 3587
+    istore 1 3588
+    istore 1 3589
+    istore 1 3590
+    istore 1 3591
+    istore 1 3592
+    istore 1 3593
+    istore 1 3594
+    istore 1 3595
+    istore 1 3596
+    istore 1 3597
+    istore 1 3598
+    istore 1 3599
+    istore 1 3600
+    istore 1 3601
+    istore 1 3602
+    istore 1 3603
+    istore 1 3604
+    istore 1 3605
+    istore 1 3606
+    istore 1 3607
+    istore 1 3608
+    istore 1 3609
+    istore 1 3610
+    istore 1 3611
+    istore 1 3612
+    istore 1 3613
+    istore 1 3614
+    istore 1 3615
+    istore 1 3616
+    istore 1 3617
+    istore 1 3618
+    istore 1 3619
+    istore 1 3620
+    istore 1 3621
+    istore 1 3622
+    istore 1 3623
+    istore 1 3624
+    istore 1 3625
+    istore 1 3626
+    istore 1 3627
+    istore 1 3628
+    istore 1 3629
+    istore 1 3630
+    istore 1 3631
+    istore 1 3632
+    istore 1 3633
+    istore 1 3634
+    istore 1 3635
+    istore 1 3636
+    istore 1 3637
+    istore 1 3638
+    istore 1 3639
+    istore 1 3640
+    istore 1 3641
+    istore 1 3642
+    istore 1 3643
+    istore 1 3644
+    istore 1 3645
+    istore 1 3646
+    istore 1 3647
+    istore 1 3648
+    istore 1 3649
+    istore 1 3650
+    istore 1 3651
+    istore 1 3652
+    istore 1 3653
+    istore 1 3654
+    istore 1 3655
+    istore 1 3656
+    istore 1 3657
+    istore 1 3658
+    istore 1 3659
+    istore 1 3660
+    istore 1 3661
+    istore 1 3662
+    istore 1 3663
+    istore 1 3664
+    istore 1 3665
+    istore 1 3666
+    istore 1 3667
+    istore 1 3668
+    istore 1 3669
+    istore 1 3670
+    istore 1 3671
+    istore 1 3672
+    istore 1 3673
+    istore 1 3674
+    istore 1 3675
+    istore 1 3676
+    istore 1 3677
+    istore 1 3678
+    istore 1 3679
+    istore 1 3680
+    istore 1 3681
+    istore 1 3682
+    istore 1 3683
+    istore 1 3684
+    istore 1 3685
+    istore 1 3686
+    istore 1 3687
+    istore 1 3688
+    istore 1 3689
+    istore 1 3690
+    istore 1 3691
+    istore 1 3692
+    istore 1 3693
+    istore 1 3694
+    istore 1 3695
+    istore 1 3696
+    istore 1 3697
+    istore 1 3698
+    istore 1 3699
+    istore 1 3700
+    istore 1 3701
+    istore 1 3702
+    istore 1 3703
+    istore 1 3704
+    istore 1 3705
+    istore 1 3706
+    istore 1 3707
+    istore 1 3708
+    istore 1 3709
+    istore 1 3710
+    istore 1 3711
+    istore 1 3712
+    istore 1 3713
+    istore 1 3714
+    istore 1 3715
+    istore 1 3716
+    istore 1 3717
+    istore 1 3718
+    istore 1 3719
+    istore 1 3720
+    istore 1 3721
+    istore 1 3722
+    istore 1 3723
+    istore 1 3724
+    istore 1 3725
+    istore 1 3726
+    istore 1 3727
+    istore 1 3728
+    istore 1 3729
+    istore 1 3730
+    istore 1 3731
+    istore 1 3732
+    istore 1 3733
+    istore 1 3734
+    istore 1 3735
+    istore 1 3736
+    istore 1 3737
+    istore 1 3738
+    istore 1 3739
+    istore 1 3740
+    istore 1 3741
+    istore 1 3742
+    istore 1 3743
+    istore 1 3744
+    istore 1 3745
+    istore 1 3746
+    istore 1 3747
+    istore 1 3748
+    istore 1 3749
+    istore 1 3750
+    istore 1 3751
+    istore 1 3752
+    istore 1 3753
+    istore 1 3754
+    istore 1 3755
+    istore 1 3756
+    istore 1 3757
+    istore 1 3758
+    istore 1 3759
+    istore 1 3760
+    istore 1 3761
+    istore 1 3762
+    istore 1 3763
+    istore 1 3764
+    istore 1 3765
+    istore 1 3766
+    istore 1 3767
+    istore 1 3768
+    istore 1 3769
+    istore 1 3770
+    istore 1 3771
+    istore 1 3772
+    istore 1 3773
+    istore 1 3774
+    istore 1 3775
+    istore 1 3776
+    istore 1 3777
+    istore 1 3778
+    istore 1 3779
+    istore 1 3780
+    istore 1 3781
+    istore 1 3782
+    istore 1 3783
+    istore 1 3784
+    istore 1 3785
+    istore 1 3786
+    istore 1 3787
+    istore 1 3788
+    istore 1 3789
+    istore 1 3790
+    istore 1 3791
+    istore 1 3792
+    istore 1 3793
+    istore 1 3794
+    istore 1 3795
+    istore 1 3796
+    istore 1 3797
+    istore 1 3798
+    istore 1 3799
+    istore 1 3800
+    istore 1 3801
+    istore 1 3802
+    istore 1 3803
+    istore 1 3804
+    istore 1 3805
+    istore 1 3806
+    istore 1 3807
+    istore 1 3808
+    istore 1 3809
+    istore 1 3810
+    istore 1 3811
+    istore 1 3812
+    istore 1 3813
+    istore 1 3814
+    istore 1 3815
+    istore 1 3816
+    istore 1 3817
+    istore 1 3818
+    istore 1 3819
+    istore 1 3820
+    istore 1 3821
+    istore 1 3822
+    istore 1 3823
+    istore 1 3824
+    istore 1 3825
+    istore 1 3826
+    istore 1 3827
+    istore 1 3828
+    istore 1 3829
+    istore 1 3830
+    istore 1 3831
+    istore 1 3832
+    istore 1 3833
+    istore 1 3834
+    istore 1 3835
+    istore 1 3836
+    istore 1 3837
+    istore 1 3838
+    istore 1 3839
+    istore 1 3840
+    istore 1 3841
+    istore 1 3842
+    istore 1 3843
+    istore 1 3844
+    istore 1 3845
+    istore 1 3846
+    istore 1 3847
+    istore 1 3848
+    istore 1 3849
+    istore 1 3850
+    istore 1 3851
+    istore 1 3852
+    istore 1 3853
+    istore 1 3854
+    istore 1 3855
+    istore 1 3856
+    istore 1 3857
+    istore 1 3858
+    istore 1 3859
+    istore 1 3860
+    istore 1 3861
+    istore 1 3862
+    istore 1 3863
+    istore 1 3864
+    istore 1 3865
+    istore 1 3866
+    istore 1 3867
+    istore 1 3868
+    istore 1 3869
+    istore 1 3870
+    istore 1 3871
+    istore 1 3872
+    istore 1 3873
+    istore 1 3874
+    istore 1 3875
+    istore 1 3876
+    istore 1 3877
+    istore 1 3878
+    istore 1 3879
+    istore 1 3880
+    istore 1 3881
+    istore 1 3882
+    istore 1 3883
+    istore 1 3884
+    istore 1 3885
+    istore 1 3886
+    istore 1 3887
+    istore 1 3888
+    istore 1 3889
+    istore 1 3890
+    istore 1 3891
+    istore 1 3892
+    istore 1 3893
+    istore 1 3894
+    istore 1 3895
+    istore 1 3896
+    istore 1 3897
+    istore 1 3898
+    istore 1 3899
+    istore 1 3900
+    istore 1 3901
+    istore 1 3902
+    istore 1 3903
+    istore 1 3904
+    istore 1 3905
+    istore 1 3906
+    istore 1 3907
+    istore 1 3908
+    istore 1 3909
+    istore 1 3910
+    istore 1 3911
+    istore 1 3912
+    istore 1 3913
+    istore 1 3914
+    istore 1 3915
+    istore 1 3916
+    istore 1 3917
+    istore 1 3918
+    istore 1 3919
+    istore 1 3920
+    istore 1 3921
+    istore 1 3922
+    istore 1 3923
+    istore 1 3924
+    istore 1 3925
+    istore 1 3926
+    istore 1 3927
+    istore 1 3928
+    istore 1 3929
+    istore 1 3930
+    istore 1 3931
+    istore 1 3932
+    istore 1 3933
+    istore 1 3934
+    istore 1 3935
+    istore 1 3936
+    istore 1 3937
+    istore 1 3938
+    istore 1 3939
+    istore 1 3940
+    istore 1 3941
+    istore 1 3942
+    istore 1 3943
+    istore 1 3944
+    istore 1 3945
+    istore 1 3946
+    istore 1 3947
+    istore 1 3948
+    istore 1 3949
+    istore 1 3950
+    istore 1 3951
+    istore 1 3952
+    istore 1 3953
+    istore 1 3954
+    istore 1 3955
+    istore 1 3956
+    istore 1 3957
+    istore 1 3958
+    istore 1 3959
+    istore 1 3960
+    istore 1 3961
+    istore 1 3962
+    istore 1 3963
+    istore 1 3964
+    istore 1 3965
+    istore 1 3966
+    istore 1 3967
+    istore 1 3968
+    istore 1 3969
+    istore 1 3970
+    istore 1 3971
+    istore 1 3972
+    istore 1 3973
+    istore 1 3974
+    istore 1 3975
+    istore 1 3976
+    istore 1 3977
+    istore 1 3978
+    istore 1 3979
+    istore 1 3980
+    istore 1 3981
+    istore 1 3982
+    istore 1 3983
+    istore 1 3984
+    istore 1 3985
+    istore 1 3986
+    istore 1 3987
+    istore 1 3988
+    istore 1 3989
+    istore 1 3990
+    istore 1 3991
+    istore 1 3992
+    istore 1 3993
+    istore 1 3994
+    istore 1 3995
+    istore 1 3996
+    istore 1 3997
+    istore 1 3998
+    istore 1 3999
+    istore 1 4000
+    istore 1 4001
+    istore 1 4002
+    istore 1 4003
+    istore 1 4004
+    istore 1 4005
+    istore 1 4006
+    istore 1 4007
+    istore 1 4008
+    istore 1 4009
+    istore 1 4010
+    istore 1 4011
+    istore 1 4012
+    istore 1 4013
+    istore 1 4014
+    istore 1 4015
+    istore 1 4016
+    istore 1 4017
+    istore 1 4018
+    istore 1 4019
+    istore 1 4020
+    istore 1 4021
+    istore 1 4022
+    istore 1 4023
+    istore 1 4024
+    istore 1 4025
+    istore 1 4026
+    istore 1 4027
+    istore 1 4028
+    istore 1 4029
+    istore 1 4030
+    istore 1 4031
+    istore 1 4032
+    istore 1 4033
+    istore 1 4034
+    istore 1 4035
+    istore 1 4036
+    istore 1 4037
+    istore 1 4038
+    istore 1 4039
+    istore 1 4040
+    istore 1 4041
+    istore 1 4042
+    istore 1 4043
+    istore 1 4044
+    istore 1 4045
+    istore 1 4046
+    istore 1 4047
+    istore 1 4048
+    istore 1 4049
+    istore 1 4050
+    istore 1 4051
+    istore 1 4052
+    istore 1 4053
+    istore 1 4054
+    istore 1 4055
+    istore 1 4056
+    istore 1 4057
+    istore 1 4058
+    istore 1 4059
+    istore 1 4060
+    istore 1 4061
+    istore 1 4062
+    istore 1 4063
+    istore 1 4064
+    istore 1 4065
+    istore 1 4066
+    istore 1 4067
+    istore 1 4068
+    istore 1 4069
+    istore 1 4070
+    istore 1 4071
+    istore 1 4072
+    istore 1 4073
+    istore 1 4074
+    istore 1 4075
+    istore 1 4076
+    istore 1 4077
+    istore 1 4078
+    istore 1 4079
+    istore 1 4080
+    istore 1 4081
+    istore 1 4082
+    istore 1 4083
+    istore 1 4084
+    istore 1 4085
+    istore 1 4086
+    istore 1 4087
+    istore 1 4088
+    istore 1 4089
+    istore 1 4090
+    istore 1 4091
+    istore 1 4092
+    istore 1 4093
+    istore 1 4094
+    istore 1 4095
+    istore 1 4096
+    istore 1 4097
+    istore 1 4098
+    istore 1 4099
+    istore 1 4100
+    istore 1 4101
+    istore 1 4102
+    istore 1 4103
+    istore 1 4104
+    istore 1 4105
+    istore 1 4106
+    istore 1 4107
+    istore 1 4108
+    istore 1 4109
+    istore 1 4110
+    istore 1 4111
+    istore 1 4112
+    istore 1 4113
+    istore 1 4114
+    istore 1 4115
+    istore 1 4116
+    istore 1 4117
+    istore 1 4118
+    istore 1 4119
+    istore 1 4120
+    istore 1 4121
+    istore 1 4122
+    istore 1 4123
+    istore 1 4124
+    istore 1 4125
+    istore 1 4126
+    istore 1 4127
+    istore 1 4128
+    istore 1 4129
+    istore 1 4130
+    istore 1 4131
+    istore 1 4132
+    istore 1 4133
+    istore 1 4134
+    istore 1 4135
+    istore 1 4136
+    istore 1 4137
+    istore 1 4138
+    istore 1 4139
+    istore 1 4140
+    istore 1 4141
+    istore 1 4142
+    istore 1 4143
+    istore 1 4144
+    istore 1 4145
+    istore 1 4146
+    istore 1 4147
+    istore 1 4148
+    istore 1 4149
+    istore 1 4150
+    istore 1 4151
+    istore 1 4152
+    istore 1 4153
+    istore 1 4154
+    istore 1 4155
+    istore 1 4156
+    istore 1 4157
+    istore 1 4158
+    istore 1 4159
+    istore 1 4160
+    istore 1 4161
+    istore 1 4162
+    istore 1 4163
+    istore 1 4164
+    istore 1 4165
+    istore 1 4166
+    istore 1 4167
+    istore 1 4168
+    istore 1 4169
+    istore 1 4170
+    istore 1 4171
+    istore 1 4172
+    istore 1 4173
+    istore 1 4174
+    istore 1 4175
+    istore 1 4176
+    istore 1 4177
+    istore 1 4178
+    istore 1 4179
+    istore 1 4180
+    istore 1 4181
+    istore 1 4182
+    istore 1 4183
+    istore 1 4184
+    istore 1 4185
+    istore 1 4186
+    istore 1 4187
+    istore 1 4188
+    istore 1 4189
+    istore 1 4190
+    istore 1 4191
+    istore 1 4192
+    istore 1 4193
+    istore 1 4194
+    istore 1 4195
+    istore 1 4196
+    istore 1 4197
+    istore 1 4198
+    istore 1 4199
+    istore 1 4200
+    istore 1 4201
+    istore 1 4202
+    istore 1 4203
+    istore 1 4204
+    istore 1 4205
+    istore 1 4206
+    istore 1 4207
+    istore 1 4208
+    istore 1 4209
+    istore 1 4210
+    istore 1 4211
+    istore 1 4212
+    istore 1 4213
+    istore 1 4214
+    istore 1 4215
+    istore 1 4216
+    istore 1 4217
+    istore 1 4218
+    istore 1 4219
+    istore 1 4220
+    istore 1 4221
+    istore 1 4222
+    istore 1 4223
+    istore 1 4224
+    istore 1 4225
+    istore 1 4226
+    istore 1 4227
+    istore 1 4228
+    istore 1 4229
+    istore 1 4230
+    istore 1 4231
+    istore 1 4232
+    istore 1 4233
+    istore 1 4234
+    istore 1 4235
+    istore 1 4236
+    istore 1 4237
+    istore 1 4238
+    istore 1 4239
+    istore 1 4240
+    istore 1 4241
+    istore 1 4242
+    istore 1 4243
+    istore 1 4244
+    istore 1 4245
+    istore 1 4246
+    istore 1 4247
+    istore 1 4248
+    istore 1 4249
+    istore 1 4250
+    istore 1 4251
+    istore 1 4252
+    istore 1 4253
+    istore 1 4254
+    istore 1 4255
+    istore 1 4256
+    istore 1 4257
+    istore 1 4258
+    istore 1 4259
+    istore 1 4260
+    istore 1 4261
+    istore 1 4262
+    istore 1 4263
+    istore 1 4264
+    istore 1 4265
+    istore 1 4266
+    istore 1 4267
+    istore 1 4268
+    istore 1 4269
+    istore 1 4270
+    istore 1 4271
+    istore 1 4272
+    istore 1 4273
+    istore 1 4274
+    istore 1 4275
+    istore 1 4276
+    istore 1 4277
+    istore 1 4278
+    istore 1 4279
+    istore 1 4280
+    istore 1 4281
+    istore 1 4282
+    istore 1 4283
+    istore 1 4284
+    istore 1 4285
+    istore 1 4286
+    istore 1 4287
+    istore 1 4288
+    istore 1 4289
+    istore 1 4290
+    istore 1 4291
+    istore 1 4292
+    istore 1 4293
+    istore 1 4294
+    istore 1 4295
+    istore 1 4296
+    istore 1 4297
+    istore 1 4298
+    istore 1 4299
+    istore 1 4300
+    istore 1 4301
+    istore 1 4302
+    istore 1 4303
+    istore 1 4304
+    istore 1 4305
+    istore 1 4306
+    istore 1 4307
+    istore 1 4308
+    istore 1 4309
+    istore 1 4310
+    istore 1 4311
+    istore 1 4312
+    istore 1 4313
+    istore 1 4314
+    istore 1 4315
+    istore 1 4316
+    istore 1 4317
+    istore 1 4318
+    istore 1 4319
+    istore 1 4320
+    istore 1 4321
+    istore 1 4322
+    istore 1 4323
+    istore 1 4324
+    istore 1 4325
+    istore 1 4326
+    istore 1 4327
+    istore 1 4328
+    istore 1 4329
+    istore 1 4330
+    istore 1 4331
+    istore 1 4332
+    istore 1 4333
+    istore 1 4334
+    istore 1 4335
+    istore 1 4336
+    istore 1 4337
+    istore 1 4338
+    istore 1 4339
+    istore 1 4340
+    istore 1 4341
+    istore 1 4342
+    istore 1 4343
+    istore 1 4344
+    istore 1 4345
+    istore 1 4346
+    istore 1 4347
+    istore 1 4348
+    istore 1 4349
+    istore 1 4350
+    istore 1 4351
+    istore 1 4352
+    istore 1 4353
+    istore 1 4354
+    istore 1 4355
+    istore 1 4356
+    istore 1 4357
+    istore 1 4358
+    istore 1 4359
+    istore 1 4360
+    istore 1 4361
+    istore 1 4362
+    istore 1 4363
+    istore 1 4364
+    istore 1 4365
+    istore 1 4366
+    istore 1 4367
+    istore 1 4368
+    istore 1 4369
+    istore 1 4370
+    istore 1 4371
+    istore 1 4372
+    istore 1 4373
+    istore 1 4374
+    istore 1 4375
+    istore 1 4376
+    istore 1 4377
+    istore 1 4378
+    istore 1 4379
+    istore 1 4380
+    istore 1 4381
+    istore 1 4382
+    istore 1 4383
+    istore 1 4384
+    istore 1 4385
+    istore 1 4386
+    istore 1 4387
+    istore 1 4388
+    istore 1 4389
+    istore 1 4390
+    istore 1 4391
+    istore 1 4392
+    istore 1 4393
+    istore 1 4394
+    istore 1 4395
+    istore 1 4396
+    istore 1 4397
+    istore 1 4398
+    istore 1 4399
+    istore 1 4400
+    istore 1 4401
+    istore 1 4402
+    istore 1 4403
+    istore 1 4404
+    istore 1 4405
+    istore 1 4406
+    istore 1 4407
+    istore 1 4408
+    istore 1 4409
+    istore 1 4410
+    istore 1 4411
+    istore 1 4412
+    istore 1 4413
+    istore 1 4414
+    istore 1 4415
+    istore 1 4416
+    istore 1 4417
+    istore 1 4418
+    istore 1 4419
+    istore 1 4420
+    istore 1 4421
+    istore 1 4422
+    istore 1 4423
+    istore 1 4424
+    istore 1 4425
+    istore 1 4426
+    istore 1 4427
+    istore 1 4428
+    istore 1 4429
+    istore 1 4430
+    istore 1 4431
+    istore 1 4432
+    istore 1 4433
+    istore 1 4434
+    istore 1 4435
+    istore 1 4436
+    istore 1 4437
+    istore 1 4438
+    istore 1 4439
+    istore 1 4440
+    istore 1 4441
+    istore 1 4442
+    istore 1 4443
+    istore 1 4444
+    istore 1 4445
+    istore 1 4446
+    istore 1 4447
+    istore 1 4448
+    istore 1 4449
+    istore 1 4450
+    istore 1 4451
+    istore 1 4452
+    istore 1 4453
+    istore 1 4454
+    istore 1 4455
+    istore 1 4456
+    istore 1 4457
+    istore 1 4458
+    istore 1 4459
+    istore 1 4460
+    istore 1 4461
+    istore 1 4462
+    istore 1 4463
+    istore 1 4464
+    istore 1 4465
+    istore 1 4466
+    istore 1 4467
+    istore 1 4468
+    istore 1 4469
+    istore 1 4470
+    istore 1 4471
+    istore 1 4472
+    istore 1 4473
+    istore 1 4474
+    istore 1 4475
+    istore 1 4476
+    istore 1 4477
+    istore 1 4478
+    istore 1 4479
+    istore 1 4480
+    istore 1 4481
+    istore 1 4482
+    istore 1 4483
+    istore 1 4484
+    istore 1 4485
+    istore 1 4486
+    istore 1 4487
+    istore 1 4488
+    istore 1 4489
+    istore 1 4490
+    istore 1 4491
+    istore 1 4492
+    istore 1 4493
+    istore 1 4494
+    istore 1 4495
+    istore 1 4496
+    istore 1 4497
+    istore 1 4498
+    istore 1 4499
+    istore 1 4500
+    istore 1 4501
+    istore 1 4502
+    istore 1 4503
+    istore 1 4504
+    istore 1 4505
+    istore 1 4506
+    istore 1 4507
+    istore 1 4508
+    istore 1 4509
+    istore 1 4510
+    istore 1 4511
+    istore 1 4512
+    istore 1 4513
+    istore 1 4514
+    istore 1 4515
+    istore 1 4516
+    istore 1 4517
+    istore 1 4518
+    istore 1 4519
+    istore 1 4520
+    istore 1 4521
+    istore 1 4522
+    istore 1 4523
+    istore 1 4524
+    istore 1 4525
+    istore 1 4526
+    istore 1 4527
+    istore 1 4528
+    istore 1 4529
+    istore 1 4530
+    istore 1 4531
+    istore 1 4532
+    istore 1 4533
+    istore 1 4534
+    istore 1 4535
+    istore 1 4536
+    istore 1 4537
+    istore 1 4538
+    istore 1 4539
+    istore 1 4540
+    istore 1 4541
+    istore 1 4542
+    istore 1 4543
+    istore 1 4544
+    istore 1 4545
+    istore 1 4546
+    istore 1 4547
+    istore 1 4548
+    istore 1 4549
+    istore 1 4550
+    istore 1 4551
+    istore 1 4552
+    istore 1 4553
+    istore 1 4554
+    istore 1 4555
+    istore 1 4556
+    istore 1 4557
+    istore 1 4558
+    istore 1 4559
+    istore 1 4560
+    istore 1 4561
+    istore 1 4562
+    istore 1 4563
+    istore 1 4564
+    istore 1 4565
+    istore 1 4566
+    istore 1 4567
+    istore 1 4568
+    istore 1 4569
+    istore 1 4570
+    istore 1 4571
+    istore 1 4572
+    istore 1 4573
+    istore 1 4574
+    istore 1 4575
+    istore 1 4576
+    istore 1 4577
+    istore 1 4578
+    istore 1 4579
+    istore 1 4580
+    istore 1 4581
+    istore 1 4582
+    istore 1 4583
+    istore 1 4584
+    istore 1 4585
+    istore 1 4586
+    istore 1 4587
+    istore 1 4588
+    istore 1 4589
+    istore 1 4590
+    istore 1 4591
+    istore 1 4592
+    istore 1 4593
+    istore 1 4594
+    istore 1 4595
+    istore 1 4596
+    istore 1 4597
+    istore 1 4598
+    istore 1 4599
+    istore 1 4600
+    istore 1 4601
+    istore 1 4602
+    istore 1 4603
+    istore 1 4604
+    istore 1 4605
+    istore 1 4606
+    istore 1 4607
+    istore 1 4608
+    istore 1 4609
+    istore 1 4610
+    istore 1 4611
+    istore 1 4612
+    istore 1 4613
+    istore 1 4614
+    istore 1 4615
+    istore 1 4616
+    istore 1 4617
+    istore 1 4618
+    istore 1 4619
+    istore 1 4620
+    istore 1 4621
+    istore 1 4622
+    istore 1 4623
+    istore 1 4624
+    istore 1 4625
+    istore 1 4626
+    istore 1 4627
+    istore 1 4628
+    istore 1 4629
+    istore 1 4630
+    istore 1 4631
+    istore 1 4632
+    istore 1 4633
+    istore 1 4634
+    istore 1 4635
+    istore 1 4636
+    istore 1 4637
+    istore 1 4638
+    istore 1 4639
+    istore 1 4640
+    istore 1 4641
+    istore 1 4642
+    istore 1 4643
+    istore 1 4644
+    istore 1 4645
+    istore 1 4646
+    istore 1 4647
+    istore 1 4648
+    istore 1 4649
+    istore 1 4650
+    istore 1 4651
+    istore 1 4652
+    istore 1 4653
+    istore 1 4654
+    istore 1 4655
+    istore 1 4656
+    istore 1 4657
+    istore 1 4658
+    istore 1 4659
+    istore 1 4660
+    istore 1 4661
+    istore 1 4662
+    istore 1 4663
+    istore 1 4664
+    istore 1 4665
+    istore 1 4666
+    istore 1 4667
+    istore 1 4668
+    istore 1 4669
+    istore 1 4670
+    istore 1 4671
+    istore 1 4672
+    istore 1 4673
+    istore 1 4674
+    istore 1 4675
+    istore 1 4676
+    istore 1 4677
+    istore 1 4678
+    istore 1 4679
+    istore 1 4680
+    istore 1 4681
+    istore 1 4682
+    istore 1 4683
+    istore 1 4684
+    istore 1 4685
+    istore 1 4686
+    istore 1 4687
+    istore 1 4688
+    istore 1 4689
+    istore 1 4690
+    istore 1 4691
+    istore 1 4692
+    istore 1 4693
+    istore 1 4694
+    istore 1 4695
+    istore 1 4696
+    istore 1 4697
+    istore 1 4698
+    istore 1 4699
+    istore 1 4700
+    istore 1 4701
+    istore 1 4702
+    istore 1 4703
+    istore 1 4704
+    istore 1 4705
+    istore 1 4706
+    istore 1 4707
+    istore 1 4708
+    istore 1 4709
+    istore 1 4710
+    istore 1 4711
+    istore 1 4712
+    istore 1 4713
+    istore 1 4714
+    istore 1 4715
+    istore 1 4716
+    istore 1 4717
+    istore 1 4718
+    istore 1 4719
+    istore 1 4720
+    istore 1 4721
+    istore 1 4722
+    istore 1 4723
+    istore 1 4724
+    istore 1 4725
+    istore 1 4726
+    istore 1 4727
+    istore 1 4728
+    istore 1 4729
+    istore 1 4730
+    istore 1 4731
+    istore 1 4732
+    istore 1 4733
+    istore 1 4734
+    istore 1 4735
+    istore 1 4736
+    istore 1 4737
+    istore 1 4738
+    istore 1 4739
+    istore 1 4740
+    istore 1 4741
+    istore 1 4742
+    istore 1 4743
+    istore 1 4744
+    istore 1 4745
+    istore 1 4746
+    istore 1 4747
+    istore 1 4748
+    istore 1 4749
+    istore 1 4750
+    istore 1 4751
+    istore 1 4752
+    istore 1 4753
+    istore 1 4754
+    istore 1 4755
+    istore 1 4756
+    istore 1 4757
+    istore 1 4758
+    istore 1 4759
+    istore 1 4760
+    istore 1 4761
+    istore 1 4762
+    istore 1 4763
+    istore 1 4764
+    istore 1 4765
+    istore 1 4766
+    istore 1 4767
+    istore 1 4768
+    istore 1 4769
+    istore 1 4770
+    istore 1 4771
+    istore 1 4772
+    istore 1 4773
+    istore 1 4774
+    istore 1 4775
+    istore 1 4776
+    istore 1 4777
+    istore 1 4778
+    istore 1 4779
+    istore 1 4780
+    istore 1 4781
+    istore 1 4782
+    istore 1 4783
+    istore 1 4784
+    istore 1 4785
+    istore 1 4786
+    istore 1 4787
+    istore 1 4788
+    istore 1 4789
+    istore 1 4790
+    istore 1 4791
+    istore 1 4792
+    istore 1 4793
+    istore 1 4794
+    istore 1 4795
+    istore 1 4796
+    istore 1 4797
+    istore 1 4798
+    istore 1 4799
+    istore 1 4800
+    istore 1 4801
+    istore 1 4802
+    istore 1 4803
+    istore 1 4804
+    istore 1 4805
+    istore 1 4806
+    istore 1 4807
+    istore 1 4808
+    istore 1 4809
+    istore 1 4810
+    istore 1 4811
+    istore 1 4812
+    istore 1 4813
+    istore 1 4814
+    istore 1 4815
+    istore 1 4816
+    istore 1 4817
+    istore 1 4818
+    istore 1 4819
+    istore 1 4820
+    istore 1 4821
+    istore 1 4822
+    istore 1 4823
+    istore 1 4824
+    istore 1 4825
+    istore 1 4826
+    istore 1 4827
+    istore 1 4828
+    istore 1 4829
+    istore 1 4830
+    istore 1 4831
+    istore 1 4832
+    istore 1 4833
+    istore 1 4834
+    istore 1 4835
+    istore 1 4836
+    istore 1 4837
+    istore 1 4838
+    istore 1 4839
+    istore 1 4840
+    istore 1 4841
+    istore 1 4842
+    istore 1 4843
+    istore 1 4844
+    istore 1 4845
+    istore 1 4846
+    istore 1 4847
+    istore 1 4848
+    istore 1 4849
+    istore 1 4850
+    istore 1 4851
+    istore 1 4852
+    istore 1 4853
+    istore 1 4854
+    istore 1 4855
+    istore 1 4856
+    istore 1 4857
+    istore 1 4858
+    istore 1 4859
+    istore 1 4860
+    istore 1 4861
+    istore 1 4862
+    istore 1 4863
+    istore 1 4864
+    istore 1 4865
+    istore 1 4866
+    istore 1 4867
+    istore 1 4868
+    istore 1 4869
+    istore 1 4870
+    istore 1 4871
+    istore 1 4872
+    istore 1 4873
+    istore 1 4874
+    istore 1 4875
+    istore 1 4876
+    istore 1 4877
+    istore 1 4878
+    istore 1 4879
+    istore 1 4880
+    istore 1 4881
+    istore 1 4882
+    istore 1 4883
+    istore 1 4884
+    istore 1 4885
+    istore 1 4886
+    istore 1 4887
+    istore 1 4888
+    istore 1 4889
+    istore 1 4890
+    istore 1 4891
+    istore 1 4892
+    istore 1 4893
+    istore 1 4894
+    istore 1 4895
+    istore 1 4896
+    istore 1 4897
+    istore 1 4898
+    istore 1 4899
+    istore 1 4900
+    istore 1 4901
+    istore 1 4902
+    istore 1 4903
+    istore 1 4904
+    istore 1 4905
+    istore 1 4906
+    istore 1 4907
+    istore 1 4908
+    istore 1 4909
+    istore 1 4910
+    istore 1 4911
+    istore 1 4912
+    istore 1 4913
+    istore 1 4914
+    istore 1 4915
+    istore 1 4916
+    istore 1 4917
+    istore 1 4918
+    istore 1 4919
+    istore 1 4920
+    istore 1 4921
+    istore 1 4922
+    istore 1 4923
+    istore 1 4924
+    istore 1 4925
+    istore 1 4926
+    istore 1 4927
+    istore 1 4928
+    istore 1 4929
+    istore 1 4930
+    istore 1 4931
+    istore 1 4932
+    istore 1 4933
+    istore 1 4934
+    istore 1 4935
+    istore 1 4936
+    istore 1 4937
+    istore 1 4938
+    istore 1 4939
+    istore 1 4940
+    istore 1 4941
+    istore 1 4942
+    istore 1 4943
+    istore 1 4944
+    istore 1 4945
+    istore 1 4946
+    istore 1 4947
+    istore 1 4948
+    istore 1 4949
+    istore 1 4950
+    istore 1 4951
+    istore 1 4952
+    istore 1 4953
+    istore 1 4954
+    istore 1 4955
+    istore 1 4956
+    istore 1 4957
+    istore 1 4958
+    istore 1 4959
+    istore 1 4960
+    istore 1 4961
+    istore 1 4962
+    istore 1 4963
+    istore 1 4964
+    istore 1 4965
+    istore 1 4966
+    istore 1 4967
+    istore 1 4968
+    istore 1 4969
+    istore 1 4970
+    istore 1 4971
+    istore 1 4972
+    istore 1 4973
+    istore 1 4974
+    istore 1 4975
+    istore 1 4976
+    istore 1 4977
+    istore 1 4978
+    istore 1 4979
+    istore 1 4980
+    istore 1 4981
+    istore 1 4982
+    istore 1 4983
+    istore 1 4984
+    istore 1 4985
+    istore 1 4986
+    istore 1 4987
+    istore 1 4988
+    istore 1 4989
+    istore 1 4990
+    istore 1 4991
+    istore 1 4992
+    istore 1 4993
+    istore 1 4994
+    istore 1 4995
+    istore 1 4996
+    istore 1 4997
+    istore 1 4998
+    istore 1 4999
+    istore 1 5000
+    istore 1 5001
+    istore 1 5002
+    istore 1 5003
+    istore 1 5004
+    istore 1 5005
+    istore 1 5006
+    istore 1 5007
+    istore 1 5008
+    istore 1 5009
+    istore 1 5010
+    istore 1 5011
+    istore 1 5012
+    istore 1 5013
+    istore 1 5014
+    istore 1 5015
+    istore 1 5016
+    istore 1 5017
+    istore 1 5018
+    istore 1 5019
+    istore 1 5020
+    istore 1 5021
+    istore 1 5022
+    istore 1 5023
+    istore 1 5024
+    istore 1 5025
+    istore 1 5026
+    istore 1 5027
+    istore 1 5028
+    istore 1 5029
+    istore 1 5030
+    istore 1 5031
+    istore 1 5032
+    istore 1 5033
+    istore 1 5034
+    istore 1 5035
+    istore 1 5036
+    istore 1 5037
+    istore 1 5038
+    istore 1 5039
+    istore 1 5040
+    istore 1 5041
+    istore 1 5042
+    istore 1 5043
+    istore 1 5044
+    istore 1 5045
+    istore 1 5046
+    istore 1 5047
+    istore 1 5048
+    istore 1 5049
+    istore 1 5050
+    istore 1 5051
+    istore 1 5052
+    istore 1 5053
+    istore 1 5054
+    istore 1 5055
+    istore 1 5056
+    istore 1 5057
+    istore 1 5058
+    istore 1 5059
+    istore 1 5060
+    istore 1 5061
+    istore 1 5062
+    istore 1 5063
+    istore 1 5064
+    istore 1 5065
+    istore 1 5066
+    istore 1 5067
+    istore 1 5068
+    istore 1 5069
+    istore 1 5070
+    istore 1 5071
+    istore 1 5072
+    istore 1 5073
+    istore 1 5074
+    istore 1 5075
+    istore 1 5076
+    istore 1 5077
+    istore 1 5078
+    istore 1 5079
+    istore 1 5080
+    istore 1 5081
+    istore 1 5082
+    istore 1 5083
+    istore 1 5084
+    istore 1 5085
+    istore 1 5086
+    istore 1 5087
+    istore 1 5088
+    istore 1 5089
+    istore 1 5090
+    istore 1 5091
+    istore 1 5092
+    istore 1 5093
+    istore 1 5094
+    istore 1 5095
+    istore 1 5096
+    istore 1 5097
+    istore 1 5098
+    istore 1 5099
+    istore 1 5100
+    istore 1 5101
+    istore 1 5102
+    istore 1 5103
+    istore 1 5104
+    istore 1 5105
+    istore 1 5106
+    istore 1 5107
+    istore 1 5108
+    istore 1 5109
+    istore 1 5110
+    istore 1 5111
+    istore 1 5112
+    istore 1 5113
+    istore 1 5114
+    istore 1 5115
+    istore 1 5116
+    istore 1 5117
+    istore 1 5118
+    istore 1 5119
+    istore 1 5120
+    istore 1 5121
+    istore 1 5122
+    istore 1 5123
+    istore 1 5124
+    istore 1 5125
+    istore 1 5126
+    istore 1 5127
+    istore 1 5128
+    istore 1 5129
+    istore 1 5130
+    istore 1 5131
+    istore 1 5132
+    istore 1 5133
+    istore 1 5134
+    istore 1 5135
+    istore 1 5136
+    istore 1 5137
+    istore 1 5138
+    istore 1 5139
+    istore 1 5140
+    istore 1 5141
+    istore 1 5142
+    istore 1 5143
+    istore 1 5144
+    istore 1 5145
+    istore 1 5146
+    istore 1 5147
+    istore 1 5148
+    istore 1 5149
+    istore 1 5150
+    istore 1 5151
+    istore 1 5152
+    istore 1 5153
+    istore 1 5154
+    istore 1 5155
+    istore 1 5156
+    istore 1 5157
+    istore 1 5158
+    istore 1 5159
+    istore 1 5160
+    istore 1 5161
+    istore 1 5162
+    istore 1 5163
+    istore 1 5164
+    istore 1 5165
+    istore 1 5166
+    istore 1 5167
+    istore 1 5168
+    istore 1 5169
+    istore 1 5170
+    istore 1 5171
+    istore 1 5172
+    istore 1 5173
+    istore 1 5174
+    istore 1 5175
+    istore 1 5176
+    istore 1 5177
+    istore 1 5178
+    istore 1 5179
+    istore 1 5180
+    istore 1 5181
+    istore 1 5182
+    istore 1 5183
+    istore 1 5184
+    istore 1 5185
+    istore 1 5186
+    istore 1 5187
+    istore 1 5188
+    istore 1 5189
+    istore 1 5190
+    istore 1 5191
+    istore 1 5192
+    istore 1 5193
+    istore 1 5194
+    istore 1 5195
+    istore 1 5196
+    istore 1 5197
+    istore 1 5198
+    istore 1 5199
+    istore 1 5200
+    istore 1 5201
+    istore 1 5202
+    istore 1 5203
+    istore 1 5204
+    istore 1 5205
+    istore 1 5206
+    istore 1 5207
+    istore 1 5208
+    istore 1 5209
+    istore 1 5210
+    istore 1 5211
+    istore 1 5212
+    istore 1 5213
+    istore 1 5214
+    istore 1 5215
+    istore 1 5216
+    istore 1 5217
+    istore 1 5218
+    istore 1 5219
+    istore 1 5220
+    istore 1 5221
+    istore 1 5222
+    istore 1 5223
+    istore 1 5224
+    istore 1 5225
+    istore 1 5226
+    istore 1 5227
+    istore 1 5228
+    istore 1 5229
+    istore 1 5230
+    istore 1 5231
+    istore 1 5232
+    istore 1 5233
+    istore 1 5234
+    istore 1 5235
+    istore 1 5236
+    istore 1 5237
+    istore 1 5238
+    istore 1 5239
+    istore 1 5240
+    istore 1 5241
+    istore 1 5242
+    istore 1 5243
+    istore 1 5244
+    istore 1 5245
+    istore 1 5246
+    istore 1 5247
+    istore 1 5248
+    istore 1 5249
+    istore 1 5250
+    istore 1 5251
+    istore 1 5252
+    istore 1 5253
+    istore 1 5254
+    istore 1 5255
+    istore 1 5256
+    istore 1 5257
+    istore 1 5258
+    istore 1 5259
+    istore 1 5260
+    istore 1 5261
+    istore 1 5262
+    istore 1 5263
+    istore 1 5264
+    istore 1 5265
+    istore 1 5266
+    istore 1 5267
+    istore 1 5268
+    istore 1 5269
+    istore 1 5270
+    istore 1 5271
+    istore 1 5272
+    istore 1 5273
+    istore 1 5274
+    istore 1 5275
+    istore 1 5276
+    istore 1 5277
+    istore 1 5278
+    istore 1 5279
+    istore 1 5280
+    istore 1 5281
+    istore 1 5282
+    istore 1 5283
+    istore 1 5284
+    istore 1 5285
+    istore 1 5286
+    istore 1 5287
+    istore 1 5288
+    istore 1 5289
+    istore 1 5290
+    istore 1 5291
+    istore 1 5292
+    istore 1 5293
+    istore 1 5294
+    istore 1 5295
+    istore 1 5296
+    istore 1 5297
+    istore 1 5298
+    istore 1 5299
+    istore 1 5300
+    istore 1 5301
+    istore 1 5302
+    istore 1 5303
+    istore 1 5304
+    istore 1 5305
+    istore 1 5306
+    istore 1 5307
+    istore 1 5308
+    istore 1 5309
+    istore 1 5310
+    istore 1 5311
+    istore 1 5312
+    istore 1 5313
+    istore 1 5314
+    istore 1 5315
+    istore 1 5316
+    istore 1 5317
+    istore 1 5318
+    istore 1 5319
+    istore 1 5320
+    istore 1 5321
+    istore 1 5322
+    istore 1 5323
+    istore 1 5324
+    istore 1 5325
+    istore 1 5326
+    istore 1 5327
+    istore 1 5328
+    istore 1 5329
+    istore 1 5330
+    istore 1 5331
+    istore 1 5332
+    istore 1 5333
+    istore 1 5334
+    istore 1 5335
+    istore 1 5336
+    istore 1 5337
+    istore 1 5338
+    istore 1 5339
+    istore 1 5340
+    istore 1 5341
+    istore 1 5342
+    istore 1 5343
+    istore 1 5344
+    istore 1 5345
+    istore 1 5346
+    istore 1 5347
+    istore 1 5348
+    istore 1 5349
+    istore 1 5350
+    istore 1 5351
+    istore 1 5352
+    istore 1 5353
+    istore 1 5354
+    istore 1 5355
+    istore 1 5356
+    istore 1 5357
+    istore 1 5358
+    istore 1 5359
+    istore 1 5360
+    istore 1 5361
+    istore 1 5362
+    istore 1 5363
+    istore 1 5364
+    istore 1 5365
+    istore 1 5366
+    istore 1 5367
+    istore 1 5368
+    istore 1 5369
+    istore 1 5370
+    istore 1 5371
+    istore 1 5372
+    istore 1 5373
+    istore 1 5374
+    istore 1 5375
+    istore 1 5376
+    istore 1 5377
+    istore 1 5378
+    istore 1 5379
+    istore 1 5380
+    istore 1 5381
+    istore 1 5382
+    istore 1 5383
+    istore 1 5384
+    istore 1 5385
+    istore 1 5386
+    istore 1 5387
+    istore 1 5388
+    istore 1 5389
+    istore 1 5390
+    istore 1 5391
+    istore 1 5392
+    istore 1 5393
+    istore 1 5394
+    istore 1 5395
+    istore 1 5396
+    istore 1 5397
+    istore 1 5398
+    istore 1 5399
+    istore 1 5400
+    istore 1 5401
+    istore 1 5402
+    istore 1 5403
+    istore 1 5404
+    istore 1 5405
+    istore 1 5406
+    istore 1 5407
+    istore 1 5408
+    istore 1 5409
+    istore 1 5410
+    istore 1 5411
+    istore 1 5412
+    istore 1 5413
+    istore 1 5414
+    istore 1 5415
+    istore 1 5416
+    istore 1 5417
+    istore 1 5418
+    istore 1 5419
+    istore 1 5420
+    istore 1 5421
+    istore 1 5422
+    istore 1 5423
+    istore 1 5424
+    istore 1 5425
+    istore 1 5426
+    istore 1 5427
+    istore 1 5428
+    istore 1 5429
+    istore 1 5430
+    istore 1 5431
+    istore 1 5432
+    istore 1 5433
+    istore 1 5434
+    istore 1 5435
+    istore 1 5436
+    istore 1 5437
+    istore 1 5438
+    istore 1 5439
+    istore 1 5440
+    istore 1 5441
+    istore 1 5442
+    istore 1 5443
+    istore 1 5444
+    istore 1 5445
+    istore 1 5446
+    istore 1 5447
+    istore 1 5448
+    istore 1 5449
+    istore 1 5450
+    istore 1 5451
+    istore 1 5452
+    istore 1 5453
+    istore 1 5454
+    istore 1 5455
+    istore 1 5456
+    istore 1 5457
+    istore 1 5458
+    istore 1 5459
+    istore 1 5460
+    istore 1 5461
+    istore 1 5462
+    istore 1 5463
+    istore 1 5464
+    istore 1 5465
+    istore 1 5466
+    istore 1 5467
+    istore 1 5468
+    istore 1 5469
+    istore 1 5470
+    istore 1 5471
+    istore 1 5472
+    istore 1 5473
+    istore 1 5474
+    istore 1 5475
+    istore 1 5476
+    istore 1 5477
+    istore 1 5478
+    istore 1 5479
+    istore 1 5480
+    istore 1 5481
+    istore 1 5482
+    istore 1 5483
+    istore 1 5484
+    istore 1 5485
+    istore 1 5486
+    istore 1 5487
+    istore 1 5488
+    istore 1 5489
+    istore 1 5490
+    istore 1 5491
+    istore 1 5492
+    istore 1 5493
+    istore 1 5494
+    istore 1 5495
+    istore 1 5496
+    istore 1 5497
+    istore 1 5498
+    istore 1 5499
+    istore 1 5500
+    istore 1 5501
+    istore 1 5502
+    istore 1 5503
+    istore 1 5504
+    istore 1 5505
+    istore 1 5506
+    istore 1 5507
+    istore 1 5508
+    istore 1 5509
+    istore 1 5510
+    istore 1 5511
+    istore 1 5512
+    istore 1 5513
+    istore 1 5514
+    istore 1 5515
+    istore 1 5516
+    istore 1 5517
+    istore 1 5518
+    istore 1 5519
+    istore 1 5520
+    istore 1 5521
+    istore 1 5522
+    istore 1 5523
+    istore 1 5524
+    istore 1 5525
+    istore 1 5526
+    istore 1 5527
+    istore 1 5528
+    istore 1 5529
+    istore 1 5530
+    istore 1 5531
+    istore 1 5532
+    istore 1 5533
+    istore 1 5534
+    istore 1 5535
+    istore 1 5536
+    istore 1 5537
+    istore 1 5538
+    istore 1 5539
+    istore 1 5540
+    istore 1 5541
+    istore 1 5542
+    istore 1 5543
+    istore 1 5544
+    istore 1 5545
+    istore 1 5546
+    istore 1 5547
+    istore 1 5548
+    istore 1 5549
+    istore 1 5550
+    istore 1 5551
+    istore 1 5552
+    istore 1 5553
+    istore 1 5554
+    istore 1 5555
+    istore 1 5556
+    istore 1 5557
+    istore 1 5558
+    istore 1 5559
+    istore 1 5560
+    istore 1 5561
+    istore 1 5562
+    istore 1 5563
+    istore 1 5564
+    istore 1 5565
+    istore 1 5566
+    istore 1 5567
+    istore 1 5568
+    istore 1 5569
+    istore 1 5570
+    istore 1 5571
+    istore 1 5572
+    istore 1 5573
+    istore 1 5574
+    istore 1 5575
+    istore 1 5576
+    istore 1 5577
+    istore 1 5578
+    istore 1 5579
+    istore 1 5580
+    istore 1 5581
+    istore 1 5582
+    istore 1 5583
+    istore 1 5584
+    istore 1 5585
+    istore 1 5586
+    istore 1 5587
+    istore 1 5588
+    istore 1 5589
+    istore 1 5590
+    istore 1 5591
+    istore 1 5592
+    istore 1 5593
+    istore 1 5594
+    istore 1 5595
+    istore 1 5596
+    istore 1 5597
+    istore 1 5598
+    istore 1 5599
+    istore 1 5600
+    istore 1 5601
+    istore 1 5602
+    istore 1 5603
+    istore 1 5604
+    istore 1 5605
+    istore 1 5606
+    istore 1 5607
+    istore 1 5608
+    istore 1 5609
+    istore 1 5610
+    istore 1 5611
+    istore 1 5612
+    istore 1 5613
+    istore 1 5614
+    istore 1 5615
+    istore 1 5616
+    istore 1 5617
+    istore 1 5618
+    istore 1 5619
+    istore 1 5620
+    istore 1 5621
+    istore 1 5622
+    istore 1 5623
+    istore 1 5624
+    istore 1 5625
+    istore 1 5626
+    istore 1 5627
+    istore 1 5628
+    istore 1 5629
+    istore 1 5630
+    istore 1 5631
+    istore 1 5632
+    istore 1 5633
+    istore 1 5634
+    istore 1 5635
+    istore 1 5636
+    istore 1 5637
+    istore 1 5638
+    istore 1 5639
+    istore 1 5640
+    istore 1 5641
+    istore 1 5642
+    istore 1 5643
+    istore 1 5644
+    istore 1 5645
+    istore 1 5646
+    istore 1 5647
+    istore 1 5648
+    istore 1 5649
+    istore 1 5650
+    istore 1 5651
+    istore 1 5652
+    istore 1 5653
+    istore 1 5654
+    istore 1 5655
+    istore 1 5656
+    istore 1 5657
+    istore 1 5658
+    istore 1 5659
+    istore 1 5660
+    istore 1 5661
+    istore 1 5662
+    istore 1 5663
+    istore 1 5664
+    istore 1 5665
+    istore 1 5666
+    istore 1 5667
+    istore 1 5668
+    istore 1 5669
+    istore 1 5670
+    istore 1 5671
+    istore 1 5672
+    istore 1 5673
+    istore 1 5674
+    istore 1 5675
+    istore 1 5676
+    istore 1 5677
+    istore 1 5678
+    istore 1 5679
+    istore 1 5680
+    istore 1 5681
+    istore 1 5682
+    istore 1 5683
+    istore 1 5684
+    istore 1 5685
+    istore 1 5686
+    istore 1 5687
+    istore 1 5688
+    istore 1 5689
+    istore 1 5690
+    istore 1 5691
+    istore 1 5692
+    istore 1 5693
+    istore 1 5694
+    istore 1 5695
+    istore 1 5696
+    istore 1 5697
+    istore 1 5698
+    istore 1 5699
+    istore 1 5700
+    istore 1 5701
+    istore 1 5702
+    istore 1 5703
+    istore 1 5704
+    istore 1 5705
+    istore 1 5706
+    istore 1 5707
+    istore 1 5708
+    istore 1 5709
+    istore 1 5710
+    istore 1 5711
+    istore 1 5712
+    istore 1 5713
+    istore 1 5714
+    istore 1 5715
+    istore 1 5716
+    istore 1 5717
+    istore 1 5718
+    istore 1 5719
+    istore 1 5720
+    istore 1 5721
+    istore 1 5722
+    istore 1 5723
+    istore 1 5724
+    istore 1 5725
+    istore 1 5726
+    istore 1 5727
+    istore 1 5728
+    istore 1 5729
+    istore 1 5730
+    istore 1 5731
+    istore 1 5732
+    istore 1 5733
+    istore 1 5734
+    istore 1 5735
+    istore 1 5736
+    istore 1 5737
+    istore 1 5738
+    istore 1 5739
+    istore 1 5740
+    istore 1 5741
+    istore 1 5742
+    istore 1 5743
+    istore 1 5744
+    istore 1 5745
+    istore 1 5746
+    istore 1 5747
+    istore 1 5748
+    istore 1 5749
+    istore 1 5750
+    istore 1 5751
+    istore 1 5752
+    istore 1 5753
+    istore 1 5754
+    istore 1 5755
+    istore 1 5756
+    istore 1 5757
+    istore 1 5758
+    istore 1 5759
+    istore 1 5760
+    istore 1 5761
+    istore 1 5762
+    istore 1 5763
+    istore 1 5764
+    istore 1 5765
+    istore 1 5766
+    istore 1 5767
+    istore 1 5768
+    istore 1 5769
+    istore 1 5770
+    istore 1 5771
+    istore 1 5772
+    istore 1 5773
+    istore 1 5774
+    istore 1 5775
+    istore 1 5776
+    istore 1 5777
+    istore 1 5778
+    istore 1 5779
+    istore 1 5780
+    istore 1 5781
+    istore 1 5782
+    istore 1 5783
+    istore 1 5784
+    istore 1 5785
+    istore 1 5786
+    istore 1 5787
+    istore 1 5788
+    istore 1 5789
+    istore 1 5790
+    istore 1 5791
+    istore 1 5792
+    istore 1 5793
+    istore 1 5794
+    istore 1 5795
+    istore 1 5796
+    istore 1 5797
+    istore 1 5798
+    istore 1 5799
+    istore 1 5800
+    istore 1 5801
+    istore 1 5802
+    istore 1 5803
+    istore 1 5804
+    istore 1 5805
+    istore 1 5806
+    istore 1 5807
+    istore 1 5808
+    istore 1 5809
+    istore 1 5810
+    istore 1 5811
+    istore 1 5812
+    istore 1 5813
+    istore 1 5814
+    istore 1 5815
+    istore 1 5816
+    istore 1 5817
+    istore 1 5818
+    istore 1 5819
+    istore 1 5820
+    istore 1 5821
+    istore 1 5822
+    istore 1 5823
+    istore 1 5824
+    istore 1 5825
+    istore 1 5826
+    istore 1 5827
+    istore 1 5828
+    istore 1 5829
+    istore 1 5830
+    istore 1 5831
+    istore 1 5832
+    istore 1 5833
+    istore 1 5834
+    istore 1 5835
+    istore 1 5836
+    istore 1 5837
+    istore 1 5838
+    istore 1 5839
+    istore 1 5840
+    istore 1 5841
+    istore 1 5842
+    istore 1 5843
+    istore 1 5844
+    istore 1 5845
+    istore 1 5846
+    istore 1 5847
+    istore 1 5848
+    istore 1 5849
+    istore 1 5850
+    istore 1 5851
+    istore 1 5852
+    istore 1 5853
+    istore 1 5854
+    istore 1 5855
+    istore 1 5856
+    istore 1 5857
+    istore 1 5858
+    istore 1 5859
+    istore 1 5860
+    istore 1 5861
+    istore 1 5862
+    istore 1 5863
+    istore 1 5864
+    istore 1 5865
+    istore 1 5866
+    istore 1 5867
+    istore 1 5868
+    istore 1 5869
+    istore 1 5870
+    istore 1 5871
+    istore 1 5872
+    istore 1 5873
+    istore 1 5874
+    istore 1 5875
+    istore 1 5876
+    istore 1 5877
+    istore 1 5878
+    istore 1 5879
+    istore 1 5880
+    istore 1 5881
+    istore 1 5882
+    istore 1 5883
+    istore 1 5884
+    istore 1 5885
+    istore 1 5886
+    istore 1 5887
+    istore 1 5888
+    istore 1 5889
+    istore 1 5890
+    istore 1 5891
+    istore 1 5892
+    istore 1 5893
+    istore 1 5894
+    istore 1 5895
+    istore 1 5896
+    istore 1 5897
+    istore 1 5898
+    istore 1 5899
+    istore 1 5900
+    istore 1 5901
+    istore 1 5902
+    istore 1 5903
+    istore 1 5904
+    istore 1 5905
+    istore 1 5906
+    istore 1 5907
+    istore 1 5908
+    istore 1 5909
+    istore 1 5910
+    istore 1 5911
+    istore 1 5912
+    istore 1 5913
+    istore 1 5914
+    istore 1 5915
+    istore 1 5916
+    istore 1 5917
+    istore 1 5918
+    istore 1 5919
+    istore 1 5920
+    istore 1 5921
+    istore 1 5922
+    istore 1 5923
+    istore 1 5924
+    istore 1 5925
+    istore 1 5926
+    istore 1 5927
+    istore 1 5928
+    istore 1 5929
+    istore 1 5930
+    istore 1 5931
+    istore 1 5932
+    istore 1 5933
+    istore 1 5934
+    istore 1 5935
+    istore 1 5936
+    istore 1 5937
+    istore 1 5938
+    istore 1 5939
+    istore 1 5940
+    istore 1 5941
+    istore 1 5942
+    istore 1 5943
+    istore 1 5944
+    istore 1 5945
+    istore 1 5946
+    istore 1 5947
+    istore 1 5948
+    istore 1 5949
+    istore 1 5950
+    istore 1 5951
+    istore 1 5952
+    istore 1 5953
+    istore 1 5954
+    istore 1 5955
+    istore 1 5956
+    istore 1 5957
+    istore 1 5958
+    istore 1 5959
+    istore 1 5960
+    istore 1 5961
+    istore 1 5962
+    istore 1 5963
+    istore 1 5964
+    istore 1 5965
+    istore 1 5966
+    istore 1 5967
+    istore 1 5968
+    istore 1 5969
+    istore 1 5970
+    istore 1 5971
+    istore 1 5972
+    istore 1 5973
+    istore 1 5974
+    istore 1 5975
+    istore 1 5976
+    istore 1 5977
+    istore 1 5978
+    istore 1 5979
+    istore 1 5980
+    istore 1 5981
+    istore 1 5982
+    istore 1 5983
+    istore 1 5984
+    istore 1 5985
+    istore 1 5986
+    istore 1 5987
+    istore 1 5988
+    istore 1 5989
+    istore 1 5990
+    istore 1 5991
+    istore 1 5992
+    istore 1 5993
+    istore 1 5994
+    istore 1 5995
+    istore 1 5996
+    istore 1 5997
+    istore 1 5998
+    istore 1 5999
+    istore 1 6000
+    istore 1 6001
+    istore 1 6002
+    istore 1 6003
+    istore 1 6004
+    istore 1 6005
+    istore 1 6006
+    istore 1 6007
+    istore 1 6008
+    istore 1 6009
+    istore 1 6010
+    istore 1 6011
+    istore 1 6012
+    istore 1 6013
+    istore 1 6014
+    istore 1 6015
+    istore 1 6016
+    istore 1 6017
+    istore 1 6018
+    istore 1 6019
+    istore 1 6020
+    istore 1 6021
+    istore 1 6022
+    istore 1 6023
+    istore 1 6024
+    istore 1 6025
+    istore 1 6026
+    istore 1 6027
+    istore 1 6028
+    istore 1 6029
+    istore 1 6030
+    istore 1 6031
+    istore 1 6032
+    istore 1 6033
+    istore 1 6034
+    istore 1 6035
+    istore 1 6036
+    istore 1 6037
+    istore 1 6038
+    istore 1 6039
+    istore 1 6040
+    istore 1 6041
+    istore 1 6042
+    istore 1 6043
+    istore 1 6044
+    istore 1 6045
+    istore 1 6046
+    istore 1 6047
+    istore 1 6048
+    istore 1 6049
+    istore 1 6050
+    istore 1 6051
+    istore 1 6052
+    istore 1 6053
+    istore 1 6054
+    istore 1 6055
+    istore 1 6056
+    istore 1 6057
+    istore 1 6058
+    istore 1 6059
+    istore 1 6060
+    istore 1 6061
+    istore 1 6062
+    istore 1 6063
+    istore 1 6064
+    istore 1 6065
+    istore 1 6066
+    istore 1 6067
+    istore 1 6068
+    istore 1 6069
+    istore 1 6070
+    istore 1 6071
+    istore 1 6072
+    istore 1 6073
+    istore 1 6074
+    istore 1 6075
+    istore 1 6076
+    istore 1 6077
+    istore 1 6078
+    istore 1 6079
+    istore 1 6080
+    istore 1 6081
+    istore 1 6082
+    istore 1 6083
+    istore 1 6084
+    istore 1 6085
+    istore 1 6086
+    istore 1 6087
+    istore 1 6088
+    istore 1 6089
+    istore 1 6090
+    istore 1 6091
+    istore 1 6092
+    istore 1 6093
+    istore 1 6094
+    istore 1 6095
+    istore 1 6096
+    istore 1 6097
+    istore 1 6098
+    istore 1 6099
+    istore 1 6100
+    istore 1 6101
+    istore 1 6102
+    istore 1 6103
+    istore 1 6104
+    istore 1 6105
+    istore 1 6106
+    istore 1 6107
+    istore 1 6108
+    istore 1 6109
+    istore 1 6110
+    istore 1 6111
+    istore 1 6112
+    istore 1 6113
+    istore 1 6114
+    istore 1 6115
+    istore 1 6116
+    istore 1 6117
+    istore 1 6118
+    istore 1 6119
+    istore 1 6120
+    istore 1 6121
+    istore 1 6122
+    istore 1 6123
+    istore 1 6124
+    istore 1 6125
+    istore 1 6126
+    istore 1 6127
+    istore 1 6128
+    istore 1 6129
+    istore 1 6130
+    istore 1 6131
+    istore 1 6132
+    istore 1 6133
+    istore 1 6134
+    istore 1 6135
+    istore 1 6136
+    istore 1 6137
+    istore 1 6138
+    istore 1 6139
+    istore 1 6140
+    istore 1 6141
+    istore 1 6142
+    istore 1 6143
+    istore 1 6144
+    istore 1 6145
+    istore 1 6146
+    istore 1 6147
+    istore 1 6148
+    istore 1 6149
+    istore 1 6150
+    istore 1 6151
+    istore 1 6152
+    istore 1 6153
+    istore 1 6154
+    istore 1 6155
+    istore 1 6156
+    istore 1 6157
+    istore 1 6158
+    istore 1 6159
+    istore 1 6160
+    istore 1 6161
+    istore 1 6162
+    istore 1 6163
+    istore 1 6164
+    istore 1 6165
+    istore 1 6166
+    istore 1 6167
+    istore 1 6168
+    istore 1 6169
+    istore 1 6170
+    istore 1 6171
+    istore 1 6172
+    istore 1 6173
+    istore 1 6174
+    istore 1 6175
+    istore 1 6176
+    istore 1 6177
+    istore 1 6178
+    istore 1 6179
+    istore 1 6180
+    istore 1 6181
+    istore 1 6182
+    istore 1 6183
+    istore 1 6184
+    istore 1 6185
+    istore 1 6186
+    istore 1 6187
+    istore 1 6188
+    istore 1 6189
+    istore 1 6190
+    istore 1 6191
+    istore 1 6192
+    istore 1 6193
+    istore 1 6194
+    istore 1 6195
+    istore 1 6196
+    istore 1 6197
+    istore 1 6198
+    istore 1 6199
+    istore 1 6200
+    istore 1 6201
+    istore 1 6202
+    istore 1 6203
+    istore 1 6204
+    istore 1 6205
+    istore 1 6206
+    istore 1 6207
+    istore 1 6208
+    istore 1 6209
+    istore 1 6210
+    istore 1 6211
+    istore 1 6212
+    istore 1 6213
+    istore 1 6214
+    istore 1 6215
+    istore 1 6216
+    istore 1 6217
+    istore 1 6218
+    istore 1 6219
+    istore 1 6220
+    istore 1 6221
+    istore 1 6222
+    istore 1 6223
+    istore 1 6224
+    istore 1 6225
+    istore 1 6226
+    istore 1 6227
+    istore 1 6228
+    istore 1 6229
+    istore 1 6230
+    istore 1 6231
+    istore 1 6232
+    istore 1 6233
+    istore 1 6234
+    istore 1 6235
+    istore 1 6236
+    istore 1 6237
+    istore 1 6238
+    istore 1 6239
+    istore 1 6240
+    istore 1 6241
+    istore 1 6242
+    istore 1 6243
+    istore 1 6244
+    istore 1 6245
+    istore 1 6246
+    istore 1 6247
+    istore 1 6248
+    istore 1 6249
+    istore 1 6250
+    istore 1 6251
+    istore 1 6252
+    istore 1 6253
+    istore 1 6254
+    istore 1 6255
+    istore 1 6256
+    istore 1 6257
+    istore 1 6258
+    istore 1 6259
+    istore 1 6260
+    istore 1 6261
+    istore 1 6262
+    istore 1 6263
+    istore 1 6264
+    istore 1 6265
+    istore 1 6266
+    istore 1 6267
+    istore 1 6268
+    istore 1 6269
+    istore 1 6270
+    istore 1 6271
+    istore 1 6272
+    istore 1 6273
+    istore 1 6274
+    istore 1 6275
+    istore 1 6276
+    istore 1 6277
+    istore 1 6278
+    istore 1 6279
+    istore 1 6280
+    istore 1 6281
+    istore 1 6282
+    istore 1 6283
+    istore 1 6284
+    istore 1 6285
+    istore 1 6286
+    istore 1 6287
+    istore 1 6288
+    istore 1 6289
+    istore 1 6290
+    istore 1 6291
+    istore 1 6292
+    istore 1 6293
+    istore 1 6294
+    istore 1 6295
+    istore 1 6296
+    istore 1 6297
+    istore 1 6298
+    istore 1 6299
+    istore 1 6300
+    istore 1 6301
+    istore 1 6302
+    istore 1 6303
+    istore 1 6304
+    istore 1 6305
+    istore 1 6306
+    istore 1 6307
+    istore 1 6308
+    istore 1 6309
+    istore 1 6310
+    istore 1 6311
+    istore 1 6312
+    istore 1 6313
+    istore 1 6314
+    istore 1 6315
+    istore 1 6316
+    istore 1 6317
+    istore 1 6318
+    istore 1 6319
+    istore 1 6320
+    istore 1 6321
+    istore 1 6322
+    istore 1 6323
+    istore 1 6324
+    istore 1 6325
+    istore 1 6326
+    istore 1 6327
+    istore 1 6328
+    istore 1 6329
+    istore 1 6330
+    istore 1 6331
+    istore 1 6332
+    istore 1 6333
+    istore 1 6334
+    istore 1 6335
+    istore 1 6336
+    istore 1 6337
+    istore 1 6338
+    istore 1 6339
+    istore 1 6340
+    istore 1 6341
+    istore 1 6342
+    istore 1 6343
+    istore 1 6344
+    istore 1 6345
+    istore 1 6346
+    istore 1 6347
+    istore 1 6348
+    istore 1 6349
+    istore 1 6350
+    istore 1 6351
+    istore 1 6352
+    istore 1 6353
+    istore 1 6354
+    istore 1 6355
+    istore 1 6356
+    istore 1 6357
+    istore 1 6358
+    istore 1 6359
+    istore 1 6360
+    istore 1 6361
+    istore 1 6362
+    istore 1 6363
+    istore 1 6364
+    istore 1 6365
+    istore 1 6366
+    istore 1 6367
+    istore 1 6368
+    istore 1 6369
+    istore 1 6370
+    istore 1 6371
+    istore 1 6372
+    istore 1 6373
+    istore 1 6374
+    istore 1 6375
+    istore 1 6376
+    istore 1 6377
+    istore 1 6378
+    istore 1 6379
+    istore 1 6380
+    istore 1 6381
+    istore 1 6382
+    istore 1 6383
+    istore 1 6384
+    istore 1 6385
+    istore 1 6386
+    istore 1 6387
+    istore 1 6388
+    istore 1 6389
+    istore 1 6390
+    istore 1 6391
+    istore 1 6392
+    istore 1 6393
+    istore 1 6394
+    istore 1 6395
+    istore 1 6396
+    istore 1 6397
+    istore 1 6398
+    istore 1 6399
+    istore 1 6400
+    istore 1 6401
+    istore 1 6402
+    istore 1 6403
+    istore 1 6404
+    istore 1 6405
+    istore 1 6406
+    istore 1 6407
+    istore 1 6408
+    istore 1 6409
+    istore 1 6410
+    istore 1 6411
+    istore 1 6412
+    istore 1 6413
+    istore 1 6414
+    istore 1 6415
+    istore 1 6416
+    istore 1 6417
+    istore 1 6418
+    istore 1 6419
+    istore 1 6420
+    istore 1 6421
+    istore 1 6422
+    istore 1 6423
+    istore 1 6424
+    istore 1 6425
+    istore 1 6426
+    istore 1 6427
+    istore 1 6428
+    istore 1 6429
+    istore 1 6430
+    istore 1 6431
+    istore 1 6432
+    istore 1 6433
+    istore 1 6434
+    istore 1 6435
+    istore 1 6436
+    istore 1 6437
+    istore 1 6438
+    istore 1 6439
+    istore 1 6440
+    istore 1 6441
+    istore 1 6442
+    istore 1 6443
+    istore 1 6444
+    istore 1 6445
+    istore 1 6446
+    istore 1 6447
+    istore 1 6448
+    istore 1 6449
+    istore 1 6450
+    istore 1 6451
+    istore 1 6452
+    istore 1 6453
+    istore 1 6454
+    istore 1 6455
+    istore 1 6456
+    istore 1 6457
+    istore 1 6458
+    istore 1 6459
+    istore 1 6460
+    istore 1 6461
+    istore 1 6462
+    istore 1 6463
+    istore 1 6464
+    istore 1 6465
+    istore 1 6466
+    istore 1 6467
+    istore 1 6468
+    istore 1 6469
+    istore 1 6470
+    istore 1 6471
+    istore 1 6472
+    istore 1 6473
+    istore 1 6474
+    istore 1 6475
+    istore 1 6476
+    istore 1 6477
+    istore 1 6478
+    istore 1 6479
+    istore 1 6480
+    istore 1 6481
+    istore 1 6482
+    istore 1 6483
+    istore 1 6484
+    istore 1 6485
+    istore 1 6486
+    istore 1 6487
+    istore 1 6488
+    istore 1 6489
+    istore 1 6490
+    istore 1 6491
+    istore 1 6492
+    istore 1 6493
+    istore 1 6494
+    istore 1 6495
+    istore 1 6496
+    istore 1 6497
+    istore 1 6498
+    istore 1 6499
+    istore 1 6500
+    istore 1 6501
+    istore 1 6502
+    istore 1 6503
+    istore 1 6504
+    istore 1 6505
+    istore 1 6506
+    istore 1 6507
+    istore 1 6508
+    istore 1 6509
+    istore 1 6510
+    istore 1 6511
+    istore 1 6512
+    istore 1 6513
+    istore 1 6514
+    istore 1 6515
+    istore 1 6516
+    istore 1 6517
+    istore 1 6518
+    istore 1 6519
+    istore 1 6520
+    istore 1 6521
+    istore 1 6522
+    istore 1 6523
+    istore 1 6524
+    istore 1 6525
+    istore 1 6526
+    istore 1 6527
+    istore 1 6528
+    istore 1 6529
+    istore 1 6530
+    istore 1 6531
+    istore 1 6532
+    istore 1 6533
+    istore 1 6534
+    istore 1 6535
+    istore 1 6536
+    istore 1 6537
+    istore 1 6538
+    istore 1 6539
+    istore 1 6540
+    istore 1 6541
+    istore 1 6542
+    istore 1 6543
+    istore 1 6544
+    istore 1 6545
+    istore 1 6546
+    istore 1 6547
+    istore 1 6548
+    istore 1 6549
+    istore 1 6550
+    istore 1 6551
+    istore 1 6552
+    istore 1 6553
+    istore 1 6554
+    istore 1 6555
+    istore 1 6556
+    istore 1 6557
+    istore 1 6558
+    istore 1 6559
+    istore 1 6560
+    istore 1 6561
+    istore 1 6562
+    istore 1 6563
+    istore 1 6564
+    istore 1 6565
+    istore 1 6566
+    istore 1 6567
+    istore 1 6568
+    istore 1 6569
+    istore 1 6570
+    istore 1 6571
+    istore 1 6572
+    istore 1 6573
+    istore 1 6574
+    istore 1 6575
+    istore 1 6576
+    istore 1 6577
+    istore 1 6578
+    istore 1 6579
+    istore 1 6580
+    istore 1 6581
+    istore 1 6582
+    istore 1 6583
+    istore 1 6584
+    istore 1 6585
+    istore 1 6586
+    istore 1 6587
+    istore 1 6588
+    istore 1 6589
+    istore 1 6590
+    istore 1 6591
+    istore 1 6592
+    istore 1 6593
+    istore 1 6594
+    istore 1 6595
+    istore 1 6596
+    istore 1 6597
+    istore 1 6598
+    istore 1 6599
+    istore 1 6600
+    istore 1 6601
+    istore 1 6602
+    istore 1 6603
+    istore 1 6604
+    istore 1 6605
+    istore 1 6606
+    istore 1 6607
+    istore 1 6608
+    istore 1 6609
+    istore 1 6610
+    istore 1 6611
+    istore 1 6612
+    istore 1 6613
+    istore 1 6614
+    istore 1 6615
+    istore 1 6616
+    istore 1 6617
+    istore 1 6618
+    istore 1 6619
+    istore 1 6620
+    istore 1 6621
+    istore 1 6622
+    istore 1 6623
+    istore 1 6624
+    istore 1 6625
+    istore 1 6626
+    istore 1 6627
+    istore 1 6628
+    istore 1 6629
+    istore 1 6630
+    istore 1 6631
+    istore 1 6632
+    istore 1 6633
+    istore 1 6634
+    istore 1 6635
+    istore 1 6636
+    istore 1 6637
+    istore 1 6638
+    istore 1 6639
+    istore 1 6640
+    istore 1 6641
+    istore 1 6642
+    istore 1 6643
+    istore 1 6644
+    istore 1 6645
+    istore 1 6646
+    istore 1 6647
+    istore 1 6648
+    istore 1 6649
+    istore 1 6650
+    istore 1 6651
+    istore 1 6652
+    istore 1 6653
+    istore 1 6654
+    istore 1 6655
+    istore 1 6656
+    istore 1 6657
+    istore 1 6658
+    istore 1 6659
+    istore 1 6660
+    istore 1 6661
+    istore 1 6662
+    istore 1 6663
+    istore 1 6664
+    istore 1 6665
+    istore 1 6666
+    istore 1 6667
+    istore 1 6668
+    istore 1 6669
+    istore 1 6670
+    istore 1 6671
+    istore 1 6672
+    istore 1 6673
+    istore 1 6674
+    istore 1 6675
+    istore 1 6676
+    istore 1 6677
+    istore 1 6678
+    istore 1 6679
+    istore 1 6680
+    istore 1 6681
+    istore 1 6682
+    istore 1 6683
+    istore 1 6684
+    istore 1 6685
+    istore 1 6686
+    istore 1 6687
+    istore 1 6688
+    istore 1 6689
+    istore 1 6690
+    istore 1 6691
+    istore 1 6692
+    istore 1 6693
+    istore 1 6694
+    istore 1 6695
+    istore 1 6696
+    istore 1 6697
+    istore 1 6698
+    istore 1 6699
+    istore 1 6700
+    istore 1 6701
+    istore 1 6702
+    istore 1 6703
+    istore 1 6704
+    istore 1 6705
+    istore 1 6706
+    istore 1 6707
+    istore 1 6708
+    istore 1 6709
+    istore 1 6710
+    istore 1 6711
+    istore 1 6712
+    istore 1 6713
+    istore 1 6714
+    istore 1 6715
+    istore 1 6716
+    istore 1 6717
+    istore 1 6718
+    istore 1 6719
+    istore 1 6720
+    istore 1 6721
+    istore 1 6722
+    istore 1 6723
+    istore 1 6724
+    istore 1 6725
+    istore 1 6726
+    istore 1 6727
+    istore 1 6728
+    istore 1 6729
+    istore 1 6730
+    istore 1 6731
+    istore 1 6732
+    istore 1 6733
+    istore 1 6734
+    istore 1 6735
+    istore 1 6736
+    istore 1 6737
+    istore 1 6738
+    istore 1 6739
+    istore 1 6740
+    istore 1 6741
+    istore 1 6742
+    istore 1 6743
+    istore 1 6744
+    istore 1 6745
+    istore 1 6746
+    istore 1 6747
+    istore 1 6748
+    istore 1 6749
+    istore 1 6750
+    istore 1 6751
+    istore 1 6752
+    istore 1 6753
+    istore 1 6754
+    istore 1 6755
+    istore 1 6756
+    istore 1 6757
+    istore 1 6758
+    istore 1 6759
+    istore 1 6760
+    istore 1 6761
+    istore 1 6762
+    istore 1 6763
+    istore 1 6764
+    istore 1 6765
+    istore 1 6766
+    istore 1 6767
+    istore 1 6768
+    istore 1 6769
+    istore 1 6770
+    istore 1 6771
+    istore 1 6772
+    istore 1 6773
+    istore 1 6774
+    istore 1 6775
+    istore 1 6776
+    istore 1 6777
+    istore 1 6778
+    istore 1 6779
+    istore 1 6780
+    istore 1 6781
+    istore 1 6782
+    istore 1 6783
+    istore 1 6784
+    istore 1 6785
+    istore 1 6786
+    istore 1 6787
+    istore 1 6788
+    istore 1 6789
+    istore 1 6790
+    istore 1 6791
+    istore 1 6792
+    istore 1 6793
+    istore 1 6794
+    istore 1 6795
+    istore 1 6796
+    istore 1 6797
+    istore 1 6798
+    istore 1 6799
+    istore 1 6800
+    istore 1 6801
+    istore 1 6802
+    istore 1 6803
+    istore 1 6804
+    istore 1 6805
+    istore 1 6806
+    istore 1 6807
+    istore 1 6808
+    istore 1 6809
+    istore 1 6810
+    istore 1 6811
+    istore 1 6812
+    istore 1 6813
+    istore 1 6814
+    istore 1 6815
+    istore 1 6816
+    istore 1 6817
+    istore 1 6818
+    istore 1 6819
+    istore 1 6820
+    istore 1 6821
+    istore 1 6822
+    istore 1 6823
+    istore 1 6824
+    istore 1 6825
+    istore 1 6826
+    istore 1 6827
+    istore 1 6828
+    istore 1 6829
+    istore 1 6830
+    istore 1 6831
+    istore 1 6832
+    istore 1 6833
+    istore 1 6834
+    istore 1 6835
+    istore 1 6836
+    istore 1 6837
+    istore 1 6838
+    istore 1 6839
+    istore 1 6840
+    istore 1 6841
+    istore 1 6842
+    istore 1 6843
+    istore 1 6844
+    istore 1 6845
+    istore 1 6846
+    istore 1 6847
+    istore 1 6848
+    istore 1 6849
+    istore 1 6850
+    istore 1 6851
+    istore 1 6852
+    istore 1 6853
+    istore 1 6854
+    istore 1 6855
+    istore 1 6856
+    istore 1 6857
+    istore 1 6858
+    istore 1 6859
+    istore 1 6860
+    istore 1 6861
+    istore 1 6862
+    istore 1 6863
+    istore 1 6864
+    istore 1 6865
+    istore 1 6866
+    istore 1 6867
+    istore 1 6868
+    istore 1 6869
+    istore 1 6870
+    istore 1 6871
+    istore 1 6872
+    istore 1 6873
+    istore 1 6874
+    istore 1 6875
+    istore 1 6876
+    istore 1 6877
+    istore 1 6878
+    istore 1 6879
+    istore 1 6880
+    istore 1 6881
+    istore 1 6882
+    istore 1 6883
+    istore 1 6884
+    istore 1 6885
+    istore 1 6886
+    istore 1 6887
+    istore 1 6888
+    istore 1 6889
+    istore 1 6890
+    istore 1 6891
+    istore 1 6892
+    istore 1 6893
+    istore 1 6894
+    istore 1 6895
+    istore 1 6896
+    istore 1 6897
+    istore 1 6898
+    istore 1 6899
+    istore 1 6900
+    istore 1 6901
+    istore 1 6902
+    istore 1 6903
+    istore 1 6904
+    istore 1 6905
+    istore 1 6906
+    istore 1 6907
+    istore 1 6908
+    istore 1 6909
+    istore 1 6910
+    istore 1 6911
+    istore 1 6912
+    istore 1 6913
+    istore 1 6914
+    istore 1 6915
+    istore 1 6916
+    istore 1 6917
+    istore 1 6918
+    istore 1 6919
+    istore 1 6920
+    istore 1 6921
+    istore 1 6922
+    istore 1 6923
+    istore 1 6924
+    istore 1 6925
+    istore 1 6926
+    istore 1 6927
+    istore 1 6928
+    istore 1 6929
+    istore 1 6930
+    istore 1 6931
+    istore 1 6932
+    istore 1 6933
+    istore 1 6934
+    istore 1 6935
+    istore 1 6936
+    istore 1 6937
+    istore 1 6938
+    istore 1 6939
+    istore 1 6940
+    istore 1 6941
+    istore 1 6942
+    istore 1 6943
+    istore 1 6944
+    istore 1 6945
+    istore 1 6946
+    istore 1 6947
+    istore 1 6948
+    istore 1 6949
+    istore 1 6950
+    istore 1 6951
+    istore 1 6952
+    istore 1 6953
+    istore 1 6954
+    istore 1 6955
+    istore 1 6956
+    istore 1 6957
+    istore 1 6958
+    istore 1 6959
+    istore 1 6960
+    istore 1 6961
+    istore 1 6962
+    istore 1 6963
+    istore 1 6964
+    istore 1 6965
+    istore 1 6966
+    istore 1 6967
+    istore 1 6968
+    istore 1 6969
+    istore 1 6970
+    istore 1 6971
+    istore 1 6972
+    istore 1 6973
+    istore 1 6974
+    istore 1 6975
+    istore 1 6976
+    istore 1 6977
+    istore 1 6978
+    istore 1 6979
+    istore 1 6980
+    istore 1 6981
+    istore 1 6982
+    istore 1 6983
+    istore 1 6984
+    istore 1 6985
+    istore 1 6986
+    istore 1 6987
+    istore 1 6988
+    istore 1 6989
+    istore 1 6990
+    istore 1 6991
+    istore 1 6992
+    istore 1 6993
+    istore 1 6994
+    istore 1 6995
+    istore 1 6996
+    istore 1 6997
+    istore 1 6998
+    istore 1 6999
+    istore 1 7000
+    istore 1 7001
+    istore 1 7002
+    istore 1 7003
+    istore 1 7004
+    istore 1 7005
+    istore 1 7006
+    istore 1 7007
+    istore 1 7008
+    istore 1 7009
+    istore 1 7010
+    istore 1 7011
+    istore 1 7012
+    istore 1 7013
+    istore 1 7014
+    istore 1 7015
+    istore 1 7016
+    istore 1 7017
+    istore 1 7018
+    istore 1 7019
+    istore 1 7020
+    istore 1 7021
+    istore 1 7022
+    istore 1 7023
+    istore 1 7024
+    istore 1 7025
+    istore 1 7026
+    istore 1 7027
+    istore 1 7028
+    istore 1 7029
+    istore 1 7030
+    istore 1 7031
+    istore 1 7032
+    istore 1 7033
+    istore 1 7034
+    istore 1 7035
+    istore 1 7036
+    istore 1 7037
+    istore 1 7038
+    istore 1 7039
+    istore 1 7040
+    istore 1 7041
+    istore 1 7042
+    istore 1 7043
+    istore 1 7044
+    istore 1 7045
+    istore 1 7046
+    istore 1 7047
+    istore 1 7048
+    istore 1 7049
+    istore 1 7050
+    istore 1 7051
+    istore 1 7052
+    istore 1 7053
+    istore 1 7054
+    istore 1 7055
+    istore 1 7056
+    istore 1 7057
+    istore 1 7058
+    istore 1 7059
+    istore 1 7060
+    istore 1 7061
+    istore 1 7062
+    istore 1 7063
+    istore 1 7064
+    istore 1 7065
+    istore 1 7066
+    istore 1 7067
+    istore 1 7068
+    istore 1 7069
+    istore 1 7070
+    istore 1 7071
+    istore 1 7072
+    istore 1 7073
+    istore 1 7074
+    istore 1 7075
+    istore 1 7076
+    istore 1 7077
+    istore 1 7078
+    istore 1 7079
+    istore 1 7080
+    istore 1 7081
+    istore 1 7082
+    istore 1 7083
+    istore 1 7084
+    istore 1 7085
+    istore 1 7086
+    istore 1 7087
+    istore 1 7088
+    istore 1 7089
+    istore 1 7090
+    istore 1 7091
+    istore 1 7092
+    istore 1 7093
+    istore 1 7094
+    istore 1 7095
+    istore 1 7096
+    istore 1 7097
+    istore 1 7098
+    istore 1 7099
+    istore 1 7100
+    istore 1 7101
+    istore 1 7102
+    istore 1 7103
+    istore 1 7104
+    istore 1 7105
+    istore 1 7106
+    istore 1 7107
+    istore 1 7108
+    istore 1 7109
+    istore 1 7110
+    istore 1 7111
+    istore 1 7112
+    istore 1 7113
+    istore 1 7114
+    istore 1 7115
+    istore 1 7116
+    istore 1 7117
+    istore 1 7118
+    istore 1 7119
+    istore 1 7120
+    istore 1 7121
+    istore 1 7122
+    istore 1 7123
+    istore 1 7124
+    istore 1 7125
+    istore 1 7126
+    istore 1 7127
+    istore 1 7128
+    istore 1 7129
+    istore 1 7130
+    istore 1 7131
+    istore 1 7132
+    istore 1 7133
+    istore 1 7134
+    istore 1 7135
+    istore 1 7136
+    istore 1 7137
+    istore 1 7138
+    istore 1 7139
+    istore 1 7140
+    istore 1 7141
+    istore 1 7142
+    istore 1 7143
+    istore 1 7144
+    istore 1 7145
+    istore 1 7146
+    istore 1 7147
+    istore 1 7148
+    istore 1 7149
+    istore 1 7150
+    istore 1 7151
+    istore 1 7152
+    istore 1 7153
+    istore 1 7154
+    istore 1 7155
+    istore 1 7156
+    istore 1 7157
+    istore 1 7158
+    istore 1 7159
+    istore 1 7160
+    istore 1 7161
+    istore 1 7162
+    istore 1 7163
+    istore 1 7164
+    istore 1 7165
+    istore 1 7166
+    istore 1 7167
+    istore 1 7168
+    istore 1 7169
+    istore 1 7170
+    istore 1 7171
+    istore 1 7172
+    istore 1 7173
+    istore 1 7174
+    istore 1 7175
+    istore 1 7176
+    istore 1 7177
+    istore 1 7178
+    istore 1 7179
+    istore 1 7180
+    istore 1 7181
+    istore 1 7182
+    istore 1 7183
+    istore 1 7184
+    istore 1 7185
+    istore 1 7186
+    istore 1 7187
+    istore 1 7188
+    istore 1 7189
+    istore 1 7190
+    istore 1 7191
+    istore 1 7192
+    istore 1 7193
+    istore 1 7194
+    istore 1 7195
+    istore 1 7196
+    istore 1 7197
+    istore 1 7198
+    istore 1 7199
+    istore 1 7200
+    istore 1 7201
+    istore 1 7202
+    istore 1 7203
+    istore 1 7204
+    istore 1 7205
+    istore 1 7206
+    istore 1 7207
+    istore 1 7208
+    istore 1 7209
+    istore 1 7210
+    istore 1 7211
+    istore 1 7212
+    istore 1 7213
+    istore 1 7214
+    istore 1 7215
+    istore 1 7216
+    istore 1 7217
+    istore 1 7218
+    istore 1 7219
+    istore 1 7220
+    istore 1 7221
+    istore 1 7222
+    istore 1 7223
+    istore 1 7224
+    istore 1 7225
+    istore 1 7226
+    istore 1 7227
+    istore 1 7228
+    istore 1 7229
+    istore 1 7230
+    istore 1 7231
+    istore 1 7232
+    istore 1 7233
+    istore 1 7234
+    istore 1 7235
+    istore 1 7236
+    istore 1 7237
+    istore 1 7238
+    istore 1 7239
+    istore 1 7240
+    istore 1 7241
+    istore 1 7242
+    istore 1 7243
+    istore 1 7244
+    istore 1 7245
+    istore 1 7246
+    istore 1 7247
+    istore 1 7248
+    istore 1 7249
+    istore 1 7250
+    istore 1 7251
+    istore 1 7252
+    istore 1 7253
+    istore 1 7254
+    istore 1 7255
+    istore 1 7256
+    istore 1 7257
+    istore 1 7258
+    istore 1 7259
+    istore 1 7260
+    istore 1 7261
+    istore 1 7262
+    istore 1 7263
+    istore 1 7264
+    istore 1 7265
+    istore 1 7266
+    istore 1 7267
+    istore 1 7268
+    istore 1 7269
+    istore 1 7270
+    istore 1 7271
+    istore 1 7272
+    istore 1 7273
+    istore 1 7274
+    istore 1 7275
+    istore 1 7276
+    istore 1 7277
+    istore 1 7278
+    istore 1 7279
+    istore 1 7280
+    istore 1 7281
+    istore 1 7282
+    istore 1 7283
+    istore 1 7284
+    istore 1 7285
+    istore 1 7286
+    istore 1 7287
+    istore 1 7288
+    istore 1 7289
+    istore 1 7290
+    istore 1 7291
+    istore 1 7292
+    istore 1 7293
+    istore 1 7294
+    istore 1 7295
+    istore 1 7296
+    istore 1 7297
+    istore 1 7298
+    istore 1 7299
+    istore 1 7300
+    istore 1 7301
+    istore 1 7302
+    istore 1 7303
+    istore 1 7304
+    istore 1 7305
+    istore 1 7306
+    istore 1 7307
+    istore 1 7308
+    istore 1 7309
+    istore 1 7310
+    istore 1 7311
+    istore 1 7312
+    istore 1 7313
+    istore 1 7314
+    istore 1 7315
+    istore 1 7316
+    istore 1 7317
+    istore 1 7318
+    istore 1 7319
+    istore 1 7320
+    istore 1 7321
+    istore 1 7322
+    istore 1 7323
+    istore 1 7324
+    istore 1 7325
+    istore 1 7326
+    istore 1 7327
+    istore 1 7328
+    istore 1 7329
+    istore 1 7330
+    istore 1 7331
+    istore 1 7332
+    istore 1 7333
+    istore 1 7334
+    istore 1 7335
+    istore 1 7336
+    istore 1 7337
+    istore 1 7338
+    istore 1 7339
+    istore 1 7340
+    istore 1 7341
+    istore 1 7342
+    istore 1 7343
+    istore 1 7344
+    istore 1 7345
+    istore 1 7346
+    istore 1 7347
+    istore 1 7348
+    istore 1 7349
+    istore 1 7350
+    istore 1 7351
+    istore 1 7352
+    istore 1 7353
+    istore 1 7354
+    istore 1 7355
+    istore 1 7356
+    istore 1 7357
+    istore 1 7358
+    istore 1 7359
+    istore 1 7360
+    istore 1 7361
+    istore 1 7362
+    istore 1 7363
+    istore 1 7364
+    istore 1 7365
+    istore 1 7366
+    istore 1 7367
+    istore 1 7368
+    istore 1 7369
+    istore 1 7370
+    istore 1 7371
+    istore 1 7372
+    istore 1 7373
+    istore 1 7374
+    istore 1 7375
+    istore 1 7376
+    istore 1 7377
+    istore 1 7378
+    istore 1 7379
+    istore 1 7380
+    istore 1 7381
+    istore 1 7382
+    istore 1 7383
+    istore 1 7384
+    istore 1 7385
+    istore 1 7386
+    istore 1 7387
+    istore 1 7388
+    istore 1 7389
+    istore 1 7390
+    istore 1 7391
+    istore 1 7392
+    istore 1 7393
+    istore 1 7394
+    istore 1 7395
+    istore 1 7396
+    istore 1 7397
+    istore 1 7398
+    istore 1 7399
+    istore 1 7400
+    istore 1 7401
+    istore 1 7402
+    istore 1 7403
+    istore 1 7404
+    istore 1 7405
+    istore 1 7406
+    istore 1 7407
+    istore 1 7408
+    istore 1 7409
+    istore 1 7410
+    istore 1 7411
+    istore 1 7412
+    istore 1 7413
+    istore 1 7414
+    istore 1 7415
+    istore 1 7416
+    istore 1 7417
+    istore 1 7418
+    istore 1 7419
+    istore 1 7420
+    istore 1 7421
+    istore 1 7422
+    istore 1 7423
+    istore 1 7424
+    istore 1 7425
+    istore 1 7426
+    istore 1 7427
+    istore 1 7428
+    istore 1 7429
+    istore 1 7430
+    istore 1 7431
+    istore 1 7432
+    istore 1 7433
+    istore 1 7434
+    istore 1 7435
+    istore 1 7436
+    istore 1 7437
+    istore 1 7438
+    istore 1 7439
+    istore 1 7440
+    istore 1 7441
+    istore 1 7442
+    istore 1 7443
+    istore 1 7444
+    istore 1 7445
+    istore 1 7446
+    istore 1 7447
+    istore 1 7448
+    istore 1 7449
+    istore 1 7450
+    istore 1 7451
+    istore 1 7452
+    istore 1 7453
+    istore 1 7454
+    istore 1 7455
+    istore 1 7456
+    istore 1 7457
+    istore 1 7458
+    istore 1 7459
+    istore 1 7460
+    istore 1 7461
+    istore 1 7462
+    istore 1 7463
+    istore 1 7464
+    istore 1 7465
+    istore 1 7466
+    istore 1 7467
+    istore 1 7468
+    istore 1 7469
+    istore 1 7470
+    istore 1 7471
+    istore 1 7472
+    istore 1 7473
+    istore 1 7474
+    istore 1 7475
+    istore 1 7476
+    istore 1 7477
+    istore 1 7478
+    istore 1 7479
+    istore 1 7480
+    istore 1 7481
+    istore 1 7482
+    istore 1 7483
+    istore 1 7484
+    istore 1 7485
+    istore 1 7486
+    istore 1 7487
+    istore 1 7488
+    istore 1 7489
+    istore 1 7490
+    istore 1 7491
+    istore 1 7492
+    istore 1 7493
+    istore 1 7494
+    istore 1 7495
+    istore 1 7496
+    istore 1 7497
+    istore 1 7498
+    istore 1 7499
+    istore 1 7500
+    istore 1 7501
+    istore 1 7502
+    istore 1 7503
+    istore 1 7504
+    istore 1 7505
+    istore 1 7506
+    istore 1 7507
+    istore 1 7508
+    istore 1 7509
+    istore 1 7510
+    istore 1 7511
+    istore 1 7512
+    istore 1 7513
+    istore 1 7514
+    istore 1 7515
+    istore 1 7516
+    istore 1 7517
+    istore 1 7518
+    istore 1 7519
+    istore 1 7520
+    istore 1 7521
+    istore 1 7522
+    istore 1 7523
+    istore 1 7524
+    istore 1 7525
+    istore 1 7526
+    istore 1 7527
+    istore 1 7528
+    istore 1 7529
+    istore 1 7530
+    istore 1 7531
+    istore 1 7532
+    istore 1 7533
+    istore 1 7534
+    istore 1 7535
+    istore 1 7536
+    istore 1 7537
+    istore 1 7538
+    istore 1 7539
+    istore 1 7540
+    istore 1 7541
+    istore 1 7542
+    istore 1 7543
+    istore 1 7544
+    istore 1 7545
+    istore 1 7546
+    istore 1 7547
+    istore 1 7548
+    istore 1 7549
+    istore 1 7550
+    istore 1 7551
+    istore 1 7552
+    istore 1 7553
+    istore 1 7554
+    istore 1 7555
+    istore 1 7556
+    istore 1 7557
+    istore 1 7558
+    istore 1 7559
+    istore 1 7560
+    istore 1 7561
+    istore 1 7562
+    istore 1 7563
+    istore 1 7564
+    istore 1 7565
+    istore 1 7566
+    istore 1 7567
+    istore 1 7568
+    istore 1 7569
+    istore 1 7570
+    istore 1 7571
+    istore 1 7572
+    istore 1 7573
+    istore 1 7574
+    istore 1 7575
+    istore 1 7576
+    istore 1 7577
+    istore 1 7578
+    istore 1 7579
+    istore 1 7580
+    istore 1 7581
+    istore 1 7582
+    istore 1 7583
+    istore 1 7584
+    istore 1 7585
+    istore 1 7586
+    istore 1 7587
+    istore 1 7588
+    istore 1 7589
+    istore 1 7590
+    istore 1 7591
+    istore 1 7592
+    istore 1 7593
+    istore 1 7594
+    istore 1 7595
+    istore 1 7596
+    istore 1 7597
+    istore 1 7598
+    istore 1 7599
+    istore 1 7600
+    istore 1 7601
+    istore 1 7602
+    istore 1 7603
+    istore 1 7604
+    istore 1 7605
+    istore 1 7606
+    istore 1 7607
+    istore 1 7608
+    istore 1 7609
+    istore 1 7610
+    istore 1 7611
+    istore 1 7612
+    istore 1 7613
+    istore 1 7614
+    istore 1 7615
+    istore 1 7616
+    istore 1 7617
+    istore 1 7618
+    istore 1 7619
+    istore 1 7620
+    istore 1 7621
+    istore 1 7622
+    istore 1 7623
+    istore 1 7624
+    istore 1 7625
+    istore 1 7626
+    istore 1 7627
+    istore 1 7628
+    istore 1 7629
+    istore 1 7630
+    istore 1 7631
+    istore 1 7632
+    istore 1 7633
+    istore 1 7634
+    istore 1 7635
+    istore 1 7636
+    istore 1 7637
+    istore 1 7638
+    istore 1 7639
+    istore 1 7640
+    istore 1 7641
+    istore 1 7642
+    istore 1 7643
+    istore 1 7644
+    istore 1 7645
+    istore 1 7646
+    istore 1 7647
+    istore 1 7648
+    istore 1 7649
+    istore 1 7650
+    istore 1 7651
+    istore 1 7652
+    istore 1 7653
+    istore 1 7654
+    istore 1 7655
+    istore 1 7656
+    istore 1 7657
+    istore 1 7658
+    istore 1 7659
+    istore 1 7660
+    istore 1 7661
+    istore 1 7662
+    istore 1 7663
+    istore 1 7664
+    istore 1 7665
+    istore 1 7666
+    istore 1 7667
+    istore 1 7668
+    istore 1 7669
+    istore 1 7670
+    istore 1 7671
+    istore 1 7672
+    istore 1 7673
+    istore 1 7674
+    istore 1 7675
+    istore 1 7676
+    istore 1 7677
+    istore 1 7678
+    istore 1 7679
+    istore 1 7680
+    istore 1 7681
+    istore 1 7682
+    istore 1 7683
+    istore 1 7684
+    istore 1 7685
+    istore 1 7686
+    istore 1 7687
+    istore 1 7688
+    istore 1 7689
+    istore 1 7690
+    istore 1 7691
+    istore 1 7692
+    istore 1 7693
+    istore 1 7694
+    istore 1 7695
+    istore 1 7696
+    istore 1 7697
+    istore 1 7698
+    istore 1 7699
+    istore 1 7700
+    istore 1 7701
+    istore 1 7702
+    istore 1 7703
+    istore 1 7704
+    istore 1 7705
+    istore 1 7706
+    istore 1 7707
+    istore 1 7708
+    istore 1 7709
+    istore 1 7710
+    istore 1 7711
+    istore 1 7712
+    istore 1 7713
+    istore 1 7714
+    istore 1 7715
+    istore 1 7716
+    istore 1 7717
+    istore 1 7718
+    istore 1 7719
+    istore 1 7720
+    istore 1 7721
+    istore 1 7722
+    istore 1 7723
+    istore 1 7724
+    istore 1 7725
+    istore 1 7726
+    istore 1 7727
+    istore 1 7728
+    istore 1 7729
+    istore 1 7730
+    istore 1 7731
+    istore 1 7732
+    istore 1 7733
+    istore 1 7734
+    istore 1 7735
+    istore 1 7736
+    istore 1 7737
+    istore 1 7738
+    istore 1 7739
+    istore 1 7740
+    istore 1 7741
+    istore 1 7742
+    istore 1 7743
+    istore 1 7744
+    istore 1 7745
+    istore 1 7746
+    istore 1 7747
+    istore 1 7748
+    istore 1 7749
+    istore 1 7750
+    istore 1 7751
+    istore 1 7752
+    istore 1 7753
+    istore 1 7754
+    istore 1 7755
+    istore 1 7756
+    istore 1 7757
+    istore 1 7758
+    istore 1 7759
+    istore 1 7760
+    istore 1 7761
+    istore 1 7762
+    istore 1 7763
+    istore 1 7764
+    istore 1 7765
+    istore 1 7766
+    istore 1 7767
+    istore 1 7768
+    istore 1 7769
+    istore 1 7770
+    istore 1 7771
+    istore 1 7772
+    istore 1 7773
+    istore 1 7774
+    istore 1 7775
+    istore 1 7776
+    istore 1 7777
+    istore 1 7778
+    istore 1 7779
+    istore 1 7780
+    istore 1 7781
+    istore 1 7782
+    istore 1 7783
+    istore 1 7784
+    istore 1 7785
+    istore 1 7786
+    istore 1 7787
+    istore 1 7788
+    istore 1 7789
+    istore 1 7790
+    istore 1 7791
+    istore 1 7792
+    istore 1 7793
+    istore 1 7794
+    istore 1 7795
+    istore 1 7796
+    istore 1 7797
+    istore 1 7798
+    istore 1 7799
+    istore 1 7800
+    istore 1 7801
+    istore 1 7802
+    istore 1 7803
+    istore 1 7804
+    istore 1 7805
+    istore 1 7806
+    istore 1 7807
+    istore 1 7808
+    istore 1 7809
+    istore 1 7810
+    istore 1 7811
+    istore 1 7812
+    istore 1 7813
+    istore 1 7814
+    istore 1 7815
+    istore 1 7816
+    istore 1 7817
+    istore 1 7818
+    istore 1 7819
+    istore 1 7820
+    istore 1 7821
+    istore 1 7822
+    istore 1 7823
+    istore 1 7824
+    istore 1 7825
+    istore 1 7826
+    istore 1 7827
+    istore 1 7828
+    istore 1 7829
+    istore 1 7830
+    istore 1 7831
+    istore 1 7832
+    istore 1 7833
+    istore 1 7834
+    istore 1 7835
+    istore 1 7836
+    istore 1 7837
+    istore 1 7838
+    istore 1 7839
+    istore 1 7840
+    istore 1 7841
+    istore 1 7842
+    istore 1 7843
+    istore 1 7844
+    istore 1 7845
+    istore 1 7846
+    istore 1 7847
+    istore 1 7848
+    istore 1 7849
+    istore 1 7850
+    istore 1 7851
+    istore 1 7852
+    istore 1 7853
+    istore 1 7854
+    istore 1 7855
+    istore 1 7856
+    istore 1 7857
+    istore 1 7858
+    istore 1 7859
+    istore 1 7860
+    istore 1 7861
+    istore 1 7862
+    istore 1 7863
+    istore 1 7864
+    istore 1 7865
+    istore 1 7866
+    istore 1 7867
+    istore 1 7868
+    istore 1 7869
+    istore 1 7870
+    istore 1 7871
+    istore 1 7872
+    istore 1 7873
+    istore 1 7874
+    istore 1 7875
+    istore 1 7876
+    istore 1 7877
+    istore 1 7878
+    istore 1 7879
+    istore 1 7880
+    istore 1 7881
+    istore 1 7882
+    istore 1 7883
+    istore 1 7884
+    istore 1 7885
+    istore 1 7886
+    istore 1 7887
+    istore 1 7888
+    istore 1 7889
+    istore 1 7890
+    istore 1 7891
+    istore 1 7892
+    istore 1 7893
+    istore 1 7894
+    istore 1 7895
+    istore 1 7896
+    istore 1 7897
+    istore 1 7898
+    istore 1 7899
+    istore 1 7900
+    istore 1 7901
+    istore 1 7902
+    istore 1 7903
+    istore 1 7904
+    istore 1 7905
+    istore 1 7906
+    istore 1 7907
+    istore 1 7908
+    istore 1 7909
+    istore 1 7910
+    istore 1 7911
+    istore 1 7912
+    istore 1 7913
+    istore 1 7914
+    istore 1 7915
+    istore 1 7916
+    istore 1 7917
+    istore 1 7918
+    istore 1 7919
+    istore 1 7920
+    istore 1 7921
+    istore 1 7922
+    istore 1 7923
+    istore 1 7924
+    istore 1 7925
+    istore 1 7926
+    istore 1 7927
+    istore 1 7928
+    istore 1 7929
+    istore 1 7930
+    istore 1 7931
+    istore 1 7932
+    istore 1 7933
+    istore 1 7934
+    istore 1 7935
+    istore 1 7936
+    istore 1 7937
+    istore 1 7938
+    istore 1 7939
+    istore 1 7940
+    istore 1 7941
+    istore 1 7942
+    istore 1 7943
+    istore 1 7944
+    istore 1 7945
+    istore 1 7946
+    istore 1 7947
+    istore 1 7948
+    istore 1 7949
+    istore 1 7950
+    istore 1 7951
+    istore 1 7952
+    istore 1 7953
+    istore 1 7954
+    istore 1 7955
+    istore 1 7956
+    istore 1 7957
+    istore 1 7958
+    istore 1 7959
+    istore 1 7960
+    istore 1 7961
+    istore 1 7962
+    istore 1 7963
+    istore 1 7964
+    istore 1 7965
+    istore 1 7966
+    istore 1 7967
+    istore 1 7968
+    istore 1 7969
+    istore 1 7970
+    istore 1 7971
+    istore 1 7972
+    istore 1 7973
+    istore 1 7974
+    istore 1 7975
+    istore 1 7976
+    istore 1 7977
+    istore 1 7978
+    istore 1 7979
+    istore 1 7980
+    istore 1 7981
+    istore 1 7982
+    istore 1 7983
+    istore 1 7984
+    istore 1 7985
+    istore 1 7986
+    istore 1 7987
+    istore 1 7988
+    istore 1 7989
+    istore 1 7990
+    istore 1 7991
+    istore 1 7992
+    istore 1 7993
+    istore 1 7994
+    istore 1 7995
+    istore 1 7996
+    istore 1 7997
+    istore 1 7998
+    istore 1 7999
+    istore 1 8000
+    istore 1 8001
+    istore 1 8002
+    istore 1 8003
+    istore 1 8004
+    istore 1 8005
+    istore 1 8006
+    istore 1 8007
+    istore 1 8008
+    istore 1 8009
+    istore 1 8010
+    istore 1 8011
+    istore 1 8012
+    istore 1 8013
+    istore 1 8014
+    istore 1 8015
+    istore 1 8016
+    istore 1 8017
+    istore 1 8018
+    istore 1 8019
+    istore 1 8020
+    istore 1 8021
+    istore 1 8022
+    istore 1 8023
+    istore 1 8024
+    istore 1 8025
+    istore 1 8026
+    istore 1 8027
+    istore 1 8028
+    istore 1 8029
+    istore 1 8030
+    istore 1 8031
+    istore 1 8032
+    istore 1 8033
+    istore 1 8034
+    istore 1 8035
+    istore 1 8036
+    istore 1 8037
+    istore 1 8038
+    istore 1 8039
+    istore 1 8040
+    istore 1 8041
+    istore 1 8042
+    istore 1 8043
+    istore 1 8044
+    istore 1 8045
+    istore 1 8046
+    istore 1 8047
+    istore 1 8048
+    istore 1 8049
+    istore 1 8050
+    istore 1 8051
+    istore 1 8052
+    istore 1 8053
+    istore 1 8054
+    istore 1 8055
+    istore 1 8056
+    istore 1 8057
+    istore 1 8058
+    istore 1 8059
+    istore 1 8060
+    istore 1 8061
+    istore 1 8062
+    istore 1 8063
+    istore 1 8064
+    istore 1 8065
+    istore 1 8066
+    istore 1 8067
+    istore 1 8068
+    istore 1 8069
+    istore 1 8070
+    istore 1 8071
+    istore 1 8072
+    istore 1 8073
+    istore 1 8074
+    istore 1 8075
+    istore 1 8076
+    istore 1 8077
+    istore 1 8078
+    istore 1 8079
+    istore 1 8080
+    istore 1 8081
+    istore 1 8082
+    istore 1 8083
+    istore 1 8084
+    istore 1 8085
+    istore 1 8086
+    istore 1 8087
+    istore 1 8088
+    istore 1 8089
+    istore 1 8090
+    istore 1 8091
+    istore 1 8092
+    istore 1 8093
+    istore 1 8094
+    istore 1 8095
+    istore 1 8096
+    istore 1 8097
+    istore 1 8098
+    istore 1 8099
+    istore 1 8100
+    istore 1 8101
+    istore 1 8102
+    istore 1 8103
+    istore 1 8104
+    istore 1 8105
+    istore 1 8106
+    istore 1 8107
+    istore 1 8108
+    istore 1 8109
+    istore 1 8110
+    istore 1 8111
+    istore 1 8112
+    istore 1 8113
+    istore 1 8114
+    istore 1 8115
+    istore 1 8116
+    istore 1 8117
+    istore 1 8118
+    istore 1 8119
+    istore 1 8120
+    istore 1 8121
+    istore 1 8122
+    istore 1 8123
+    istore 1 8124
+    istore 1 8125
+    istore 1 8126
+    istore 1 8127
+    istore 1 8128
+    istore 1 8129
+    istore 1 8130
+    istore 1 8131
+    istore 1 8132
+    istore 1 8133
+    istore 1 8134
+    istore 1 8135
+    istore 1 8136
+    istore 1 8137
+    istore 1 8138
+    istore 1 8139
+    istore 1 8140
+    istore 1 8141
+    istore 1 8142
+    istore 1 8143
+    istore 1 8144
+    istore 1 8145
+    istore 1 8146
+    istore 1 8147
+    istore 1 8148
+    istore 1 8149
+    istore 1 8150
+    istore 1 8151
+    istore 1 8152
+    istore 1 8153
+    istore 1 8154
+    istore 1 8155
+    istore 1 8156
+    istore 1 8157
+    istore 1 8158
+    istore 1 8159
+    istore 1 8160
+    istore 1 8161
+    istore 1 8162
+    istore 1 8163
+    istore 1 8164
+    istore 1 8165
+    istore 1 8166
+    istore 1 8167
+    istore 1 8168
+    istore 1 8169
+    istore 1 8170
+    istore 1 8171
+    istore 1 8172
+    istore 1 8173
+    istore 1 8174
+    istore 1 8175
+    istore 1 8176
+    istore 1 8177
+    istore 1 8178
+    istore 1 8179
+    istore 1 8180
+    istore 1 8181
+    istore 1 8182
+    istore 1 8183
+    istore 1 8184
+    istore 1 8185
+    istore 1 8186
+    istore 1 8187
+    istore 1 8188
+    istore 1 8189
+    istore 1 8190
+    istore 1 8191
+    istore 1 8192
+    istore 1 8193
+    istore 1 8194
+    istore 1 8195
+    istore 1 8196
+    istore 1 8197
+    istore 1 8198
+    istore 1 8199
+    istore 1 8200
+    istore 1 8201
+    istore 1 8202
+    istore 1 8203
+    istore 1 8204
+    istore 1 8205
+    istore 1 8206
+    istore 1 8207
+    istore 1 8208
+    istore 1 8209
+    istore 1 8210
+    istore 1 8211
+    istore 1 8212
+    istore 1 8213
+    istore 1 8214
+    istore 1 8215
+    istore 1 8216
+    istore 1 8217
+    istore 1 8218
+    istore 1 8219
+    istore 1 8220
+    istore 1 8221
+    istore 1 8222
+    istore 1 8223
+    istore 1 8224
+    istore 1 8225
+    istore 1 8226
+    istore 1 8227
+    istore 1 8228
+    istore 1 8229
+    istore 1 8230
+    istore 1 8231
+    istore 1 8232
+    istore 1 8233
+    istore 1 8234
+    istore 1 8235
+    istore 1 8236
+    istore 1 8237
+    istore 1 8238
+    istore 1 8239
+    istore 1 8240
+    istore 1 8241
+    istore 1 8242
+    istore 1 8243
+    istore 1 8244
+    istore 1 8245
+    istore 1 8246
+    istore 1 8247
+    istore 1 8248
+    istore 1 8249
+    istore 1 8250
+    istore 1 8251
+    istore 1 8252
+    istore 1 8253
+    istore 1 8254
+    istore 1 8255
+    istore 1 8256
+    istore 1 8257
+    istore 1 8258
+    istore 1 8259
+    istore 1 8260
+    istore 1 8261
+    istore 1 8262
+    istore 1 8263
+    istore 1 8264
+    istore 1 8265
+    istore 1 8266
+    istore 1 8267
+    istore 1 8268
+    istore 1 8269
+    istore 1 8270
+    istore 1 8271
+    istore 1 8272
+    istore 1 8273
+    istore 1 8274
+    istore 1 8275
+    istore 1 8276
+    istore 1 8277
+    istore 1 8278
+    istore 1 8279
+    istore 1 8280
+    istore 1 8281
+    istore 1 8282
+    istore 1 8283
+    istore 1 8284
+    istore 1 8285
+    istore 1 8286
+    istore 1 8287
+    istore 1 8288
+    istore 1 8289
+    istore 1 8290
+    istore 1 8291
+    istore 1 8292
+    istore 1 8293
+    istore 1 8294
+    istore 1 8295
+    istore 1 8296
+    istore 1 8297
+    istore 1 8298
+    istore 1 8299
+    istore 1 8300
+    istore 1 8301
+    istore 1 8302
+    istore 1 8303
+    istore 1 8304
+    istore 1 8305
+    istore 1 8306
+    istore 1 8307
+    istore 1 8308
+    istore 1 8309
+    istore 1 8310
+    istore 1 8311
+    istore 1 8312
+    istore 1 8313
+    istore 1 8314
+    istore 1 8315
+    istore 1 8316
+    istore 1 8317
+    istore 1 8318
+    istore 1 8319
+    istore 1 8320
+    istore 1 8321
+    istore 1 8322
+    istore 1 8323
+    istore 1 8324
+    istore 1 8325
+    istore 1 8326
+    istore 1 8327
+    istore 1 8328
+    istore 1 8329
+    istore 1 8330
+    istore 1 8331
+    istore 1 8332
+    istore 1 8333
+    istore 1 8334
+    istore 1 8335
+    istore 1 8336
+    istore 1 8337
+    istore 1 8338
+    istore 1 8339
+    istore 1 8340
+    istore 1 8341
+    istore 1 8342
+    istore 1 8343
+    istore 1 8344
+    istore 1 8345
+    istore 1 8346
+    istore 1 8347
+    istore 1 8348
+    istore 1 8349
+    istore 1 8350
+    istore 1 8351
+    istore 1 8352
+    istore 1 8353
+    istore 1 8354
+    istore 1 8355
+    istore 1 8356
+    istore 1 8357
+    istore 1 8358
+    istore 1 8359
+    istore 1 8360
+    istore 1 8361
+    istore 1 8362
+    istore 1 8363
+    istore 1 8364
+    istore 1 8365
+    istore 1 8366
+    istore 1 8367
+    istore 1 8368
+    istore 1 8369
+    istore 1 8370
+    istore 1 8371
+    istore 1 8372
+    istore 1 8373
+    istore 1 8374
+    istore 1 8375
+    istore 1 8376
+    istore 1 8377
+    istore 1 8378
+    istore 1 8379
+    istore 1 8380
+    istore 1 8381
+    istore 1 8382
+    istore 1 8383
+    istore 1 8384
+    istore 1 8385
+    istore 1 8386
+    istore 1 8387
+    istore 1 8388
+    istore 1 8389
+    istore 1 8390
+    istore 1 8391
+    istore 1 8392
+    istore 1 8393
+    istore 1 8394
+    istore 1 8395
+    istore 1 8396
+    istore 1 8397
+    istore 1 8398
+    istore 1 8399
+    istore 1 8400
+    istore 1 8401
+    istore 1 8402
+    istore 1 8403
+    istore 1 8404
+    istore 1 8405
+    istore 1 8406
+    istore 1 8407
+    istore 1 8408
+    istore 1 8409
+    istore 1 8410
+    istore 1 8411
+    istore 1 8412
+    istore 1 8413
+    istore 1 8414
+    istore 1 8415
+    istore 1 8416
+    istore 1 8417
+    istore 1 8418
+    istore 1 8419
+    istore 1 8420
+    istore 1 8421
+    istore 1 8422
+    istore 1 8423
+    istore 1 8424
+    istore 1 8425
+    istore 1 8426
+    istore 1 8427
+    istore 1 8428
+    istore 1 8429
+    istore 1 8430
+    istore 1 8431
+    istore 1 8432
+    istore 1 8433
+    istore 1 8434
+    istore 1 8435
+    istore 1 8436
+    istore 1 8437
+    istore 1 8438
+    istore 1 8439
+    istore 1 8440
+    istore 1 8441
+    istore 1 8442
+    istore 1 8443
+    istore 1 8444
+    istore 1 8445
+    istore 1 8446
+    istore 1 8447
+    istore 1 8448
+    istore 1 8449
+    istore 1 8450
+    istore 1 8451
+    istore 1 8452
+    istore 1 8453
+    istore 1 8454
+    istore 1 8455
+    istore 1 8456
+    istore 1 8457
+    istore 1 8458
+    istore 1 8459
+    istore 1 8460
+    istore 1 8461
+    istore 1 8462
+    istore 1 8463
+    istore 1 8464
+    istore 1 8465
+    istore 1 8466
+    istore 1 8467
+    istore 1 8468
+    istore 1 8469
+    istore 1 8470
+    istore 1 8471
+    istore 1 8472
+    istore 1 8473
+    istore 1 8474
+    istore 1 8475
+    istore 1 8476
+    istore 1 8477
+    istore 1 8478
+    istore 1 8479
+    istore 1 8480
+    istore 1 8481
+    istore 1 8482
+    istore 1 8483
+    istore 1 8484
+    istore 1 8485
+    istore 1 8486
+    istore 1 8487
+    istore 1 8488
+    istore 1 8489
+    istore 1 8490
+    istore 1 8491
+    istore 1 8492
+    istore 1 8493
+    istore 1 8494
+    istore 1 8495
+    istore 1 8496
+    istore 1 8497
+    istore 1 8498
+    istore 1 8499
+    istore 1 8500
+    istore 1 8501
+    istore 1 8502
+    istore 1 8503
+    istore 1 8504
+    istore 1 8505
+    istore 1 8506
+    istore 1 8507
+    istore 1 8508
+    istore 1 8509
+    istore 1 8510
+    istore 1 8511
+    istore 1 8512
+    istore 1 8513
+    istore 1 8514
+    istore 1 8515
+    istore 1 8516
+    istore 1 8517
+    istore 1 8518
+    istore 1 8519
+    istore 1 8520
+    istore 1 8521
+    istore 1 8522
+    istore 1 8523
+    istore 1 8524
+    istore 1 8525
+    istore 1 8526
+    istore 1 8527
+    istore 1 8528
+    istore 1 8529
+    istore 1 8530
+    istore 1 8531
+    istore 1 8532
+    istore 1 8533
+    istore 1 8534
+    istore 1 8535
+    istore 1 8536
+    istore 1 8537
+    istore 1 8538
+    istore 1 8539
+    istore 1 8540
+    istore 1 8541
+    istore 1 8542
+    istore 1 8543
+    istore 1 8544
+    istore 1 8545
+    istore 1 8546
+    istore 1 8547
+    istore 1 8548
+    istore 1 8549
+    istore 1 8550
+    istore 1 8551
+    istore 1 8552
+    istore 1 8553
+    istore 1 8554
+    istore 1 8555
+    istore 1 8556
+    istore 1 8557
+    istore 1 8558
+    istore 1 8559
+    istore 1 8560
+    istore 1 8561
+    istore 1 8562
+    istore 1 8563
+    istore 1 8564
+    istore 1 8565
+    istore 1 8566
+    istore 1 8567
+    istore 1 8568
+    istore 1 8569
+    istore 1 8570
+    istore 1 8571
+    istore 1 8572
+    istore 1 8573
+    istore 1 8574
+    istore 1 8575
+    istore 1 8576
+    istore 1 8577
+    istore 1 8578
+    istore 1 8579
+    istore 1 8580
+    istore 1 8581
+    istore 1 8582
+    istore 1 8583
+    istore 1 8584
+    istore 1 8585
+    istore 1 8586
+    istore 1 8587
+    istore 1 8588
+    istore 1 8589
+    istore 1 8590
+    istore 1 8591
+    istore 1 8592
+    istore 1 8593
+    istore 1 8594
+    istore 1 8595
+    istore 1 8596
+    istore 1 8597
+    istore 1 8598
+    istore 1 8599
+    istore 1 8600
+    istore 1 8601
+    istore 1 8602
+    istore 1 8603
+    istore 1 8604
+    istore 1 8605
+    istore 1 8606
+    istore 1 8607
+    istore 1 8608
+    istore 1 8609
+    istore 1 8610
+    istore 1 8611
+    istore 1 8612
+    istore 1 8613
+    istore 1 8614
+    istore 1 8615
+    istore 1 8616
+    istore 1 8617
+    istore 1 8618
+    istore 1 8619
+    istore 1 8620
+    istore 1 8621
+    istore 1 8622
+    istore 1 8623
+    istore 1 8624
+    istore 1 8625
+    istore 1 8626
+    istore 1 8627
+    istore 1 8628
+    istore 1 8629
+    istore 1 8630
+    istore 1 8631
+    istore 1 8632
+    istore 1 8633
+    istore 1 8634
+    istore 1 8635
+    istore 1 8636
+    istore 1 8637
+    istore 1 8638
+    istore 1 8639
+    istore 1 8640
+    istore 1 8641
+    istore 1 8642
+    istore 1 8643
+    istore 1 8644
+    istore 1 8645
+    istore 1 8646
+    istore 1 8647
+    istore 1 8648
+    istore 1 8649
+    istore 1 8650
+    istore 1 8651
+    istore 1 8652
+    istore 1 8653
+    istore 1 8654
+    istore 1 8655
+    istore 1 8656
+    istore 1 8657
+    istore 1 8658
+    istore 1 8659
+    istore 1 8660
+    istore 1 8661
+    istore 1 8662
+    istore 1 8663
+    istore 1 8664
+    istore 1 8665
+    istore 1 8666
+    istore 1 8667
+    istore 1 8668
+    istore 1 8669
+    istore 1 8670
+    istore 1 8671
+    istore 1 8672
+    istore 1 8673
+    istore 1 8674
+    istore 1 8675
+    istore 1 8676
+    istore 1 8677
+    istore 1 8678
+    istore 1 8679
+    istore 1 8680
+    istore 1 8681
+    istore 1 8682
+    istore 1 8683
+    istore 1 8684
+    istore 1 8685
+    istore 1 8686
+    istore 1 8687
+    istore 1 8688
+    istore 1 8689
+    istore 1 8690
+    istore 1 8691
+    istore 1 8692
+    istore 1 8693
+    istore 1 8694
+    istore 1 8695
+    istore 1 8696
+    istore 1 8697
+    istore 1 8698
+    istore 1 8699
+    istore 1 8700
+    istore 1 8701
+    istore 1 8702
+    istore 1 8703
+    istore 1 8704
+    istore 1 8705
+    istore 1 8706
+    istore 1 8707
+    istore 1 8708
+    istore 1 8709
+    istore 1 8710
+    istore 1 8711
+    istore 1 8712
+    istore 1 8713
+    istore 1 8714
+    istore 1 8715
+    istore 1 8716
+    istore 1 8717
+    istore 1 8718
+    istore 1 8719
+    istore 1 8720
+    istore 1 8721
+    istore 1 8722
+    istore 1 8723
+    istore 1 8724
+    istore 1 8725
+    istore 1 8726
+    istore 1 8727
+    istore 1 8728
+    istore 1 8729
+    istore 1 8730
+    istore 1 8731
+    istore 1 8732
+    istore 1 8733
+    istore 1 8734
+    istore 1 8735
+    istore 1 8736
+    istore 1 8737
+    istore 1 8738
+    istore 1 8739
+    istore 1 8740
+    istore 1 8741
+    istore 1 8742
+    istore 1 8743
+    istore 1 8744
+    istore 1 8745
+    istore 1 8746
+    istore 1 8747
+    istore 1 8748
+    istore 1 8749
+    istore 1 8750
+    istore 1 8751
+    istore 1 8752
+    istore 1 8753
+    istore 1 8754
+    istore 1 8755
+    istore 1 8756
+    istore 1 8757
+    istore 1 8758
+    istore 1 8759
+    istore 1 8760
+    istore 1 8761
+    istore 1 8762
+    istore 1 8763
+    istore 1 8764
+    istore 1 8765
+    istore 1 8766
+    istore 1 8767
+    istore 1 8768
+    istore 1 8769
+    istore 1 8770
+    istore 1 8771
+    istore 1 8772
+    istore 1 8773
+    istore 1 8774
+    istore 1 8775
+    istore 1 8776
+    istore 1 8777
+    istore 1 8778
+    istore 1 8779
+    istore 1 8780
+    istore 1 8781
+    istore 1 8782
+    istore 1 8783
+    istore 1 8784
+    istore 1 8785
+    istore 1 8786
+    istore 1 8787
+    istore 1 8788
+    istore 1 8789
+    istore 1 8790
+    istore 1 8791
+    istore 1 8792
+    istore 1 8793
+    istore 1 8794
+    istore 1 8795
+    istore 1 8796
+    istore 1 8797
+    istore 1 8798
+    istore 1 8799
+    istore 1 8800
+    istore 1 8801
+    istore 1 8802
+    istore 1 8803
+    istore 1 8804
+    istore 1 8805
+    istore 1 8806
+    istore 1 8807
+    istore 1 8808
+    istore 1 8809
+    istore 1 8810
+    istore 1 8811
+    istore 1 8812
+    istore 1 8813
+    istore 1 8814
+    istore 1 8815
+    istore 1 8816
+    istore 1 8817
+    istore 1 8818
+    istore 1 8819
+    istore 1 8820
+    istore 1 8821
+    istore 1 8822
+    istore 1 8823
+    istore 1 8824
+    istore 1 8825
+    istore 1 8826
+    istore 1 8827
+    istore 1 8828
+    istore 1 8829
+    istore 1 8830
+    istore 1 8831
+    istore 1 8832
+    istore 1 8833
+    istore 1 8834
+    istore 1 8835
+    istore 1 8836
+    istore 1 8837
+    istore 1 8838
+    istore 1 8839
+    istore 1 8840
+    istore 1 8841
+    istore 1 8842
+    istore 1 8843
+    istore 1 8844
+    istore 1 8845
+    istore 1 8846
+    istore 1 8847
+    istore 1 8848
+    istore 1 8849
+    istore 1 8850
+    istore 1 8851
+    istore 1 8852
+    istore 1 8853
+    istore 1 8854
+    istore 1 8855
+    istore 1 8856
+    istore 1 8857
+    istore 1 8858
+    istore 1 8859
+    istore 1 8860
+    istore 1 8861
+    istore 1 8862
+    istore 1 8863
+    istore 1 8864
+    istore 1 8865
+    istore 1 8866
+    istore 1 8867
+    istore 1 8868
+    istore 1 8869
+    istore 1 8870
+    istore 1 8871
+    istore 1 8872
+    istore 1 8873
+    istore 1 8874
+    istore 1 8875
+    istore 1 8876
+    istore 1 8877
+    istore 1 8878
+    istore 1 8879
+    istore 1 8880
+    istore 1 8881
+    istore 1 8882
+    istore 1 8883
+    istore 1 8884
+    istore 1 8885
+    istore 1 8886
+    istore 1 8887
+    istore 1 8888
+    istore 1 8889
+    istore 1 8890
+    istore 1 8891
+    istore 1 8892
+    istore 1 8893
+    istore 1 8894
+    istore 1 8895
+    istore 1 8896
+    istore 1 8897
+    istore 1 8898
+    istore 1 8899
+    istore 1 8900
+    istore 1 8901
+    istore 1 8902
+    istore 1 8903
+    istore 1 8904
+    istore 1 8905
+    istore 1 8906
+    istore 1 8907
+    istore 1 8908
+    istore 1 8909
+    istore 1 8910
+    istore 1 8911
+    istore 1 8912
+    istore 1 8913
+    istore 1 8914
+    istore 1 8915
+    istore 1 8916
+    istore 1 8917
+    istore 1 8918
+    istore 1 8919
+    istore 1 8920
+    istore 1 8921
+    istore 1 8922
+    istore 1 8923
+    istore 1 8924
+    istore 1 8925
+    istore 1 8926
+    istore 1 8927
+    istore 1 8928
+    istore 1 8929
+    istore 1 8930
+    istore 1 8931
+    istore 1 8932
+    istore 1 8933
+    istore 1 8934
+    istore 1 8935
+    istore 1 8936
+    istore 1 8937
+    istore 1 8938
+    istore 1 8939
+    istore 1 8940
+    istore 1 8941
+    istore 1 8942
+    istore 1 8943
+    istore 1 8944
+    istore 1 8945
+    istore 1 8946
+    istore 1 8947
+    istore 1 8948
+    istore 1 8949
+    istore 1 8950
+    istore 1 8951
+    istore 1 8952
+    istore 1 8953
+    istore 1 8954
+    istore 1 8955
+    istore 1 8956
+    istore 1 8957
+    istore 1 8958
+    istore 1 8959
+    istore 1 8960
+    istore 1 8961
+    istore 1 8962
+    istore 1 8963
+    istore 1 8964
+    istore 1 8965
+    istore 1 8966
+    istore 1 8967
+    istore 1 8968
+    istore 1 8969
+    istore 1 8970
+    istore 1 8971
+    istore 1 8972
+    istore 1 8973
+    istore 1 8974
+    istore 1 8975
+    istore 1 8976
+    istore 1 8977
+    istore 1 8978
+    istore 1 8979
+    istore 1 8980
+    istore 1 8981
+    istore 1 8982
+    istore 1 8983
+    istore 1 8984
+    istore 1 8985
+    istore 1 8986
+    istore 1 8987
+    istore 1 8988
+    istore 1 8989
+    istore 1 8990
+    istore 1 8991
+    istore 1 8992
+    istore 1 8993
+    istore 1 8994
+    istore 1 8995
+    istore 1 8996
+    istore 1 8997
+    istore 1 8998
+    istore 1 8999
+    istore 1 9000
+    istore 1 9001
+    istore 1 9002
+    istore 1 9003
+    istore 1 9004
+    istore 1 9005
+    istore 1 9006
+    istore 1 9007
+    istore 1 9008
+    istore 1 9009
+    istore 1 9010
+    istore 1 9011
+    istore 1 9012
+    istore 1 9013
+    istore 1 9014
+    istore 1 9015
+    istore 1 9016
+    istore 1 9017
+    istore 1 9018
+    istore 1 9019
+    istore 1 9020
+    istore 1 9021
+    istore 1 9022
+    istore 1 9023
+    istore 1 9024
+    istore 1 9025
+    istore 1 9026
+    istore 1 9027
+    istore 1 9028
+    istore 1 9029
+    istore 1 9030
+    istore 1 9031
+    istore 1 9032
+    istore 1 9033
+    istore 1 9034
+    istore 1 9035
+    istore 1 9036
+    istore 1 9037
+    istore 1 9038
+    istore 1 9039
+    istore 1 9040
+    istore 1 9041
+    istore 1 9042
+    istore 1 9043
+    istore 1 9044
+    istore 1 9045
+    istore 1 9046
+    istore 1 9047
+    istore 1 9048
+    istore 1 9049
+    istore 1 9050
+    istore 1 9051
+    istore 1 9052
+    istore 1 9053
+    istore 1 9054
+    istore 1 9055
+    istore 1 9056
+    istore 1 9057
+    istore 1 9058
+    istore 1 9059
+    istore 1 9060
+    istore 1 9061
+    istore 1 9062
+    istore 1 9063
+    istore 1 9064
+    istore 1 9065
+    istore 1 9066
+    istore 1 9067
+    istore 1 9068
+    istore 1 9069
+    istore 1 9070
+    istore 1 9071
+    istore 1 9072
+    istore 1 9073
+    istore 1 9074
+    istore 1 9075
+    istore 1 9076
+    istore 1 9077
+    istore 1 9078
+    istore 1 9079
+    istore 1 9080
+    istore 1 9081
+    istore 1 9082
+    istore 1 9083
+    istore 1 9084
+    istore 1 9085
+    istore 1 9086
+    istore 1 9087
+    istore 1 9088
+    istore 1 9089
+    istore 1 9090
+    istore 1 9091
+    istore 1 9092
+    istore 1 9093
+    istore 1 9094
+    istore 1 9095
+    istore 1 9096
+    istore 1 9097
+    istore 1 9098
+    istore 1 9099
+    istore 1 9100
+    istore 1 9101
+    istore 1 9102
+    istore 1 9103
+    istore 1 9104
+    istore 1 9105
+    istore 1 9106
+    istore 1 9107
+    istore 1 9108
+    istore 1 9109
+    istore 1 9110
+    istore 1 9111
+    istore 1 9112
+    istore 1 9113
+    istore 1 9114
+    istore 1 9115
+    istore 1 9116
+    istore 1 9117
+    istore 1 9118
+    istore 1 9119
+    istore 1 9120
+    istore 1 9121
+    istore 1 9122
+    istore 1 9123
+    istore 1 9124
+    istore 1 9125
+    istore 1 9126
+    istore 1 9127
+    istore 1 9128
+    istore 1 9129
+    istore 1 9130
+    istore 1 9131
+    istore 1 9132
+    istore 1 9133
+    istore 1 9134
+    istore 1 9135
+    istore 1 9136
+    istore 1 9137
+    istore 1 9138
+    istore 1 9139
+    istore 1 9140
+    istore 1 9141
+    istore 1 9142
+    istore 1 9143
+    istore 1 9144
+    istore 1 9145
+    istore 1 9146
+    istore 1 9147
+    istore 1 9148
+    istore 1 9149
+    istore 1 9150
+    istore 1 9151
+    istore 1 9152
+    istore 1 9153
+    istore 1 9154
+    istore 1 9155
+    istore 1 9156
+    istore 1 9157
+    istore 1 9158
+    istore 1 9159
+    istore 1 9160
+    istore 1 9161
+    istore 1 9162
+    istore 1 9163
+    istore 1 9164
+    istore 1 9165
+    istore 1 9166
+    istore 1 9167
+    istore 1 9168
+    istore 1 9169
+    istore 1 9170
+    istore 1 9171
+    istore 1 9172
+    istore 1 9173
+    istore 1 9174
+    istore 1 9175
+    istore 1 9176
+    istore 1 9177
+    istore 1 9178
+    istore 1 9179
+    istore 1 9180
+    istore 1 9181
+    istore 1 9182
+    istore 1 9183
+    istore 1 9184
+    istore 1 9185
+    istore 1 9186
+    istore 1 9187
+    istore 1 9188
+    istore 1 9189
+    istore 1 9190
+    istore 1 9191
+    istore 1 9192
+    istore 1 9193
+    istore 1 9194
+    istore 1 9195
+    istore 1 9196
+    istore 1 9197
+    istore 1 9198
+    istore 1 9199
+    istore 1 9200
+    istore 1 9201
+    istore 1 9202
+    istore 1 9203
+    istore 1 9204
+    istore 1 9205
+    istore 1 9206
+    istore 1 9207
+    istore 1 9208
+    istore 1 9209
+    istore 1 9210
+    istore 1 9211
+    istore 1 9212
+    istore 1 9213
+    istore 1 9214
+    istore 1 9215
+    istore 1 9216
+    istore 1 9217
+    istore 1 9218
+    istore 1 9219
+    istore 1 9220
+    istore 1 9221
+    istore 1 9222
+    istore 1 9223
+    istore 1 9224
+    istore 1 9225
+    istore 1 9226
+    istore 1 9227
+    istore 1 9228
+    istore 1 9229
+    istore 1 9230
+    istore 1 9231
+    istore 1 9232
+    istore 1 9233
+    istore 1 9234
+    istore 1 9235
+    istore 1 9236
+    istore 1 9237
+    istore 1 9238
+    istore 1 9239
+    istore 1 9240
+    istore 1 9241
+    istore 1 9242
+    istore 1 9243
+    istore 1 9244
+    istore 1 9245
+    istore 1 9246
+    istore 1 9247
+    istore 1 9248
+    istore 1 9249
+    istore 1 9250
+    istore 1 9251
+    istore 1 9252
+    istore 1 9253
+    istore 1 9254
+    istore 1 9255
+    istore 1 9256
+    istore 1 9257
+    istore 1 9258
+    istore 1 9259
+    istore 1 9260
+    istore 1 9261
+    istore 1 9262
+    istore 1 9263
+    istore 1 9264
+    istore 1 9265
+    istore 1 9266
+    istore 1 9267
+    istore 1 9268
+    istore 1 9269
+    istore 1 9270
+    istore 1 9271
+    istore 1 9272
+    istore 1 9273
+    istore 1 9274
+    istore 1 9275
+    istore 1 9276
+    istore 1 9277
+    istore 1 9278
+    istore 1 9279
+    istore 1 9280
+    istore 1 9281
+    istore 1 9282
+    istore 1 9283
+    istore 1 9284
+    istore 1 9285
+    istore 1 9286
+    istore 1 9287
+    istore 1 9288
+    istore 1 9289
+    istore 1 9290
+    istore 1 9291
+    istore 1 9292
+    istore 1 9293
+    istore 1 9294
+    istore 1 9295
+    istore 1 9296
+    istore 1 9297
+    istore 1 9298
+    istore 1 9299
+    istore 1 9300
+    istore 1 9301
+    istore 1 9302
+    istore 1 9303
+    istore 1 9304
+    istore 1 9305
+    istore 1 9306
+    istore 1 9307
+    istore 1 9308
+    istore 1 9309
+    istore 1 9310
+    istore 1 9311
+    istore 1 9312
+    istore 1 9313
+    istore 1 9314
+    istore 1 9315
+    istore 1 9316
+    istore 1 9317
+    istore 1 9318
+    istore 1 9319
+    istore 1 9320
+    istore 1 9321
+    istore 1 9322
+    istore 1 9323
+    istore 1 9324
+    istore 1 9325
+    istore 1 9326
+    istore 1 9327
+    istore 1 9328
+    istore 1 9329
+    istore 1 9330
+    istore 1 9331
+    istore 1 9332
+    istore 1 9333
+    istore 1 9334
+    istore 1 9335
+    istore 1 9336
+    istore 1 9337
+    istore 1 9338
+    istore 1 9339
+    istore 1 9340
+    istore 1 9341
+    istore 1 9342
+    istore 1 9343
+    istore 1 9344
+    istore 1 9345
+    istore 1 9346
+    istore 1 9347
+    istore 1 9348
+    istore 1 9349
+    istore 1 9350
+    istore 1 9351
+    istore 1 9352
+    istore 1 9353
+    istore 1 9354
+    istore 1 9355
+    istore 1 9356
+    istore 1 9357
+    istore 1 9358
+    istore 1 9359
+    istore 1 9360
+    istore 1 9361
+    istore 1 9362
+    istore 1 9363
+    istore 1 9364
+    istore 1 9365
+    istore 1 9366
+    istore 1 9367
+    istore 1 9368
+    istore 1 9369
+    istore 1 9370
+    istore 1 9371
+    istore 1 9372
+    istore 1 9373
+    istore 1 9374
+    istore 1 9375
+    istore 1 9376
+    istore 1 9377
+    istore 1 9378
+    istore 1 9379
+    istore 1 9380
+    istore 1 9381
+    istore 1 9382
+    istore 1 9383
+    istore 1 9384
+    istore 1 9385
+    istore 1 9386
+    istore 1 9387
+    istore 1 9388
+    istore 1 9389
+    istore 1 9390
+    istore 1 9391
+    istore 1 9392
+    istore 1 9393
+    istore 1 9394
+    istore 1 9395
+    istore 1 9396
+    istore 1 9397
+    istore 1 9398
+    istore 1 9399
+    istore 1 9400
+    istore 1 9401
+    istore 1 9402
+    istore 1 9403
+    istore 1 9404
+    istore 1 9405
+    istore 1 9406
+    istore 1 9407
+    istore 1 9408
+    istore 1 9409
+    istore 1 9410
+    istore 1 9411
+    istore 1 9412
+    istore 1 9413
+    istore 1 9414
+    istore 1 9415
+    istore 1 9416
+    istore 1 9417
+    istore 1 9418
+    istore 1 9419
+    istore 1 9420
+    istore 1 9421
+    istore 1 9422
+    istore 1 9423
+    istore 1 9424
+    istore 1 9425
+    istore 1 9426
+    istore 1 9427
+    istore 1 9428
+    istore 1 9429
+    istore 1 9430
+    istore 1 9431
+    istore 1 9432
+    istore 1 9433
+    istore 1 9434
+    istore 1 9435
+    istore 1 9436
+    istore 1 9437
+    istore 1 9438
+    istore 1 9439
+    istore 1 9440
+    istore 1 9441
+    istore 1 9442
+    istore 1 9443
+    istore 1 9444
+    istore 1 9445
+    istore 1 9446
+    istore 1 9447
+    istore 1 9448
+    istore 1 9449
+    istore 1 9450
+    istore 1 9451
+    istore 1 9452
+    istore 1 9453
+    istore 1 9454
+    istore 1 9455
+    istore 1 9456
+    istore 1 9457
+    istore 1 9458
+    istore 1 9459
+    istore 1 9460
+    istore 1 9461
+    istore 1 9462
+    istore 1 9463
+    istore 1 9464
+    istore 1 9465
+    istore 1 9466
+    istore 1 9467
+    istore 1 9468
+    istore 1 9469
+    istore 1 9470
+    istore 1 9471
+    istore 1 9472
+    istore 1 9473
+    istore 1 9474
+    istore 1 9475
+    istore 1 9476
+    istore 1 9477
+    istore 1 9478
+    istore 1 9479
+    istore 1 9480
+    istore 1 9481
+    istore 1 9482
+    istore 1 9483
+    istore 1 9484
+    istore 1 9485
+    istore 1 9486
+    istore 1 9487
+    istore 1 9488
+    istore 1 9489
+    istore 1 9490
+    istore 1 9491
+    istore 1 9492
+    istore 1 9493
+    istore 1 9494
+    istore 1 9495
+    istore 1 9496
+    istore 1 9497
+    istore 1 9498
+    istore 1 9499
+    istore 1 9500
+    istore 1 9501
+    istore 1 9502
+    istore 1 9503
+    istore 1 9504
+    istore 1 9505
+    istore 1 9506
+    istore 1 9507
+    istore 1 9508
+    istore 1 9509
+    istore 1 9510
+    istore 1 9511
+    istore 1 9512
+    istore 1 9513
+    istore 1 9514
+    istore 1 9515
+    istore 1 9516
+    istore 1 9517
+    istore 1 9518
+    istore 1 9519
+    istore 1 9520
+    istore 1 9521
+    istore 1 9522
+    istore 1 9523
+    istore 1 9524
+    istore 1 9525
+    istore 1 9526
+    istore 1 9527
+    istore 1 9528
+    istore 1 9529
+    istore 1 9530
+    istore 1 9531
+    istore 1 9532
+    istore 1 9533
+    istore 1 9534
+    istore 1 9535
+    istore 1 9536
+    istore 1 9537
+    istore 1 9538
+    istore 1 9539
+    istore 1 9540
+    istore 1 9541
+    istore 1 9542
+    istore 1 9543
+    istore 1 9544
+    istore 1 9545
+    istore 1 9546
+    istore 1 9547
+    istore 1 9548
+    istore 1 9549
+    istore 1 9550
+    istore 1 9551
+    istore 1 9552
+    istore 1 9553
+    istore 1 9554
+    istore 1 9555
+    istore 1 9556
+    istore 1 9557
+    istore 1 9558
+    istore 1 9559
+    istore 1 9560
+    istore 1 9561
+    istore 1 9562
+    istore 1 9563
+    istore 1 9564
+    istore 1 9565
+    istore 1 9566
+    istore 1 9567
+    istore 1 9568
+    istore 1 9569
+    istore 1 9570
+    istore 1 9571
+    istore 1 9572
+    istore 1 9573
+    istore 1 9574
+    istore 1 9575
+    istore 1 9576
+    istore 1 9577
+    istore 1 9578
+    istore 1 9579
+    istore 1 9580
+    istore 1 9581
+    istore 1 9582
+    istore 1 9583
+    istore 1 9584
+    istore 1 9585
+    istore 1 9586
+    istore 1 9587
+    istore 1 9588
+    istore 1 9589
+    istore 1 9590
+    istore 1 9591
+    istore 1 9592
+    istore 1 9593
+    istore 1 9594
+    istore 1 9595
+    istore 1 9596
+    istore 1 9597
+    istore 1 9598
+    istore 1 9599
+    istore 1 9600
+    istore 1 9601
+    istore 1 9602
+    istore 1 9603
+    istore 1 9604
+    istore 1 9605
+    istore 1 9606
+    istore 1 9607
+    istore 1 9608
+    istore 1 9609
+    istore 1 9610
+    istore 1 9611
+    istore 1 9612
+    istore 1 9613
+    istore 1 9614
+    istore 1 9615
+    istore 1 9616
+    istore 1 9617
+    istore 1 9618
+    istore 1 9619
+    istore 1 9620
+    istore 1 9621
+    istore 1 9622
+    istore 1 9623
+    istore 1 9624
+    istore 1 9625
+    istore 1 9626
+    istore 1 9627
+    istore 1 9628
+    istore 1 9629
+    istore 1 9630
+    istore 1 9631
+    istore 1 9632
+    istore 1 9633
+    istore 1 9634
+    istore 1 9635
+    istore 1 9636
+    istore 1 9637
+    istore 1 9638
+    istore 1 9639
+    istore 1 9640
+    istore 1 9641
+    istore 1 9642
+    istore 1 9643
+    istore 1 9644
+    istore 1 9645
+    istore 1 9646
+    istore 1 9647
+    istore 1 9648
+    istore 1 9649
+    istore 1 9650
+    istore 1 9651
+    istore 1 9652
+    istore 1 9653
+    istore 1 9654
+    istore 1 9655
+    istore 1 9656
+    istore 1 9657
+    istore 1 9658
+    istore 1 9659
+    istore 1 9660
+    istore 1 9661
+    istore 1 9662
+    istore 1 9663
+    istore 1 9664
+    istore 1 9665
+    istore 1 9666
+    istore 1 9667
+    istore 1 9668
+    istore 1 9669
+    istore 1 9670
+    istore 1 9671
+    istore 1 9672
+    istore 1 9673
+    istore 1 9674
+    istore 1 9675
+    istore 1 9676
+    istore 1 9677
+    istore 1 9678
+    istore 1 9679
+    istore 1 9680
+    istore 1 9681
+    istore 1 9682
+    istore 1 9683
+    istore 1 9684
+    istore 1 9685
+    istore 1 9686
+    istore 1 9687
+    istore 1 9688
+    istore 1 9689
+    istore 1 9690
+    istore 1 9691
+    istore 1 9692
+    istore 1 9693
+    istore 1 9694
+    istore 1 9695
+    istore 1 9696
+    istore 1 9697
+    istore 1 9698
+    istore 1 9699
+    istore 1 9700
+    istore 1 9701
+    istore 1 9702
+    istore 1 9703
+    istore 1 9704
+    istore 1 9705
+    istore 1 9706
+    istore 1 9707
+    istore 1 9708
+    istore 1 9709
+    istore 1 9710
+    istore 1 9711
+    istore 1 9712
+    istore 1 9713
+    istore 1 9714
+    istore 1 9715
+    istore 1 9716
+    istore 1 9717
+    istore 1 9718
+    istore 1 9719
+    istore 1 9720
+    istore 1 9721
+    istore 1 9722
+    istore 1 9723
+    istore 1 9724
+    istore 1 9725
+    istore 1 9726
+    istore 1 9727
+    istore 1 9728
+    istore 1 9729
+    istore 1 9730
+    istore 1 9731
+    istore 1 9732
+    istore 1 9733
+    istore 1 9734
+    istore 1 9735
+    istore 1 9736
+    istore 1 9737
+    istore 1 9738
+    istore 1 9739
+    istore 1 9740
+    istore 1 9741
+    istore 1 9742
+    istore 1 9743
+    istore 1 9744
+    istore 1 9745
+    istore 1 9746
+    istore 1 9747
+    istore 1 9748
+    istore 1 9749
+    istore 1 9750
+    istore 1 9751
+    istore 1 9752
+    istore 1 9753
+    istore 1 9754
+    istore 1 9755
+    istore 1 9756
+    istore 1 9757
+    istore 1 9758
+    istore 1 9759
+    istore 1 9760
+    istore 1 9761
+    istore 1 9762
+    istore 1 9763
+    istore 1 9764
+    istore 1 9765
+    istore 1 9766
+    istore 1 9767
+    istore 1 9768
+    istore 1 9769
+    istore 1 9770
+    istore 1 9771
+    istore 1 9772
+    istore 1 9773
+    istore 1 9774
+    istore 1 9775
+    istore 1 9776
+    istore 1 9777
+    istore 1 9778
+    istore 1 9779
+    istore 1 9780
+    istore 1 9781
+    istore 1 9782
+    istore 1 9783
+    istore 1 9784
+    istore 1 9785
+    istore 1 9786
+    istore 1 9787
+    istore 1 9788
+    istore 1 9789
+    istore 1 9790
+    istore 1 9791
+    istore 1 9792
+    istore 1 9793
+    istore 1 9794
+    istore 1 9795
+    istore 1 9796
+    istore 1 9797
+    istore 1 9798
+    istore 1 9799
+    istore 1 9800
+    istore 1 9801
+    istore 1 9802
+    istore 1 9803
+    istore 1 9804
+    istore 1 9805
+    istore 1 9806
+    istore 1 9807
+    istore 1 9808
+    istore 1 9809
+    istore 1 9810
+    istore 1 9811
+    istore 1 9812
+    istore 1 9813
+    istore 1 9814
+    istore 1 9815
+    istore 1 9816
+    istore 1 9817
+    istore 1 9818
+    istore 1 9819
+    istore 1 9820
+    istore 1 9821
+    istore 1 9822
+    istore 1 9823
+    istore 1 9824
+    istore 1 9825
+    istore 1 9826
+    istore 1 9827
+    istore 1 9828
+    istore 1 9829
+    istore 1 9830
+    istore 1 9831
+    istore 1 9832
+    istore 1 9833
+    istore 1 9834
+    istore 1 9835
+    istore 1 9836
+    istore 1 9837
+    istore 1 9838
+    istore 1 9839
+    istore 1 9840
+    istore 1 9841
+    istore 1 9842
+    istore 1 9843
+    istore 1 9844
+    istore 1 9845
+    istore 1 9846
+    istore 1 9847
+    istore 1 9848
+    istore 1 9849
+    istore 1 9850
+    istore 1 9851
+    istore 1 9852
+    istore 1 9853
+    istore 1 9854
+    istore 1 9855
+    istore 1 9856
+    istore 1 9857
+    istore 1 9858
+    istore 1 9859
+    istore 1 9860
+    istore 1 9861
+    istore 1 9862
+    istore 1 9863
+    istore 1 9864
+    istore 1 9865
+    istore 1 9866
+    istore 1 9867
+    istore 1 9868
+    istore 1 9869
+    istore 1 9870
+    istore 1 9871
+    istore 1 9872
+    istore 1 9873
+    istore 1 9874
+    istore 1 9875
+    istore 1 9876
+    istore 1 9877
+    istore 1 9878
+    istore 1 9879
+    istore 1 9880
+    istore 1 9881
+    istore 1 9882
+    istore 1 9883
+    istore 1 9884
+    istore 1 9885
+    istore 1 9886
+    istore 1 9887
+    istore 1 9888
+    istore 1 9889
+    istore 1 9890
+    istore 1 9891
+    istore 1 9892
+    istore 1 9893
+    istore 1 9894
+    istore 1 9895
+    istore 1 9896
+    istore 1 9897
+    istore 1 9898
+    istore 1 9899
+    istore 1 9900
+    istore 1 9901
+    istore 1 9902
+    istore 1 9903
+    istore 1 9904
+    istore 1 9905
+    istore 1 9906
+    istore 1 9907
+    istore 1 9908
+    istore 1 9909
+    istore 1 9910
+    istore 1 9911
+    istore 1 9912
+    istore 1 9913
+    istore 1 9914
+    istore 1 9915
+    istore 1 9916
+    istore 1 9917
+    istore 1 9918
+    istore 1 9919
+    istore 1 9920
+    istore 1 9921
+    istore 1 9922
+    istore 1 9923
+    istore 1 9924
+    istore 1 9925
+    istore 1 9926
+    istore 1 9927
+    istore 1 9928
+    istore 1 9929
+    istore 1 9930
+    istore 1 9931
+    istore 1 9932
+    istore 1 9933
+    istore 1 9934
+    istore 1 9935
+    istore 1 9936
+    istore 1 9937
+    istore 1 9938
+    istore 1 9939
+    istore 1 9940
+    istore 1 9941
+    istore 1 9942
+    istore 1 9943
+    istore 1 9944
+    istore 1 9945
+    istore 1 9946
+    istore 1 9947
+    istore 1 9948
+    istore 1 9949
+    istore 1 9950
+    istore 1 9951
+    istore 1 9952
+    istore 1 9953
+    istore 1 9954
+    istore 1 9955
+    istore 1 9956
+    istore 1 9957
+    istore 1 9958
+    istore 1 9959
+    istore 1 9960
+    istore 1 9961
+    istore 1 9962
+    istore 1 9963
+    istore 1 9964
+    istore 1 9965
+    istore 1 9966
+    istore 1 9967
+    istore 1 9968
+    istore 1 9969
+    istore 1 9970
+    istore 1 9971
+    istore 1 9972
+    istore 1 9973
+    istore 1 9974
+    istore 1 9975
+    istore 1 9976
+    istore 1 9977
+    istore 1 9978
+    istore 1 9979
+    istore 1 9980
+    istore 1 9981
+    istore 1 9982
+    istore 1 9983
+    istore 1 9984
+    istore 1 9985
+    istore 1 9986
+    istore 1 9987
+    istore 1 9988
+    istore 1 9989
+    istore 1 9990
+    istore 1 9991
+    istore 1 9992
+    istore 1 9993
+    istore 1 9994
+    istore 1 9995
+    istore 1 9996
+    istore 1 9997
+    istore 1 9998
+    istore 1 9999
+    istore 1 10000
+    istore 1 10001
+    istore 1 10002
+    istore 1 10003
+    istore 1 10004
+    istore 1 10005
+    istore 1 10006
+    istore 1 10007
+    istore 1 10008
+    istore 1 10009
+    istore 1 10010
+    istore 1 10011
+    istore 1 10012
+    istore 1 10013
+    istore 1 10014
+    istore 1 10015
+    istore 1 10016
+    istore 1 10017
+    istore 1 10018
+    istore 1 10019
+    istore 1 10020
+    istore 1 10021
+    istore 1 10022
+    istore 1 10023
+    istore 1 10024
+    istore 1 10025
+    istore 1 10026
+    istore 1 10027
+    istore 1 10028
+    istore 1 10029
+    istore 1 10030
+    istore 1 10031
+    istore 1 10032
+    istore 1 10033
+    istore 1 10034
+    istore 1 10035
+    istore 1 10036
+    istore 1 10037
+    istore 1 10038
+    istore 1 10039
+    istore 1 10040
+    istore 1 10041
+    istore 1 10042
+    istore 1 10043
+    istore 1 10044
+    istore 1 10045
+    istore 1 10046
+    istore 1 10047
+    istore 1 10048
+    istore 1 10049
+    istore 1 10050
+    istore 1 10051
+    istore 1 10052
+    istore 1 10053
+    istore 1 10054
+    istore 1 10055
+    istore 1 10056
+    istore 1 10057
+    istore 1 10058
+    istore 1 10059
+    istore 1 10060
+    istore 1 10061
+    istore 1 10062
+    istore 1 10063
+    istore 1 10064
+    istore 1 10065
+    istore 1 10066
+    istore 1 10067
+    istore 1 10068
+    istore 1 10069
+    istore 1 10070
+    istore 1 10071
+    istore 1 10072
+    istore 1 10073
+    istore 1 10074
+    istore 1 10075
+    istore 1 10076
+    istore 1 10077
+    istore 1 10078
+    istore 1 10079
+    istore 1 10080
+    istore 1 10081
+    istore 1 10082
+    istore 1 10083
+    istore 1 10084
+    istore 1 10085
+    istore 1 10086
+    istore 1 10087
+    istore 1 10088
+    istore 1 10089
+    istore 1 10090
+    istore 1 10091
+    istore 1 10092
+    istore 1 10093
+    istore 1 10094
+    istore 1 10095
+    istore 1 10096
+    istore 1 10097
+    istore 1 10098
+    istore 1 10099
+    istore 1 10100
+    istore 1 10101
+    istore 1 10102
+    istore 1 10103
+    istore 1 10104
+    istore 1 10105
+    istore 1 10106
+    istore 1 10107
+    istore 1 10108
+    istore 1 10109
+    istore 1 10110
+    istore 1 10111
+    istore 1 10112
+    istore 1 10113
+    istore 1 10114
+    istore 1 10115
+    istore 1 10116
+    istore 1 10117
+    istore 1 10118
+    istore 1 10119
+    istore 1 10120
+    istore 1 10121
+    istore 1 10122
+    istore 1 10123
+    istore 1 10124
+    istore 1 10125
+    istore 1 10126
+    istore 1 10127
+    istore 1 10128
+    istore 1 10129
+    istore 1 10130
+    istore 1 10131
+    istore 1 10132
+    istore 1 10133
+    istore 1 10134
+    istore 1 10135
+    istore 1 10136
+    istore 1 10137
+    istore 1 10138
+    istore 1 10139
+    istore 1 10140
+    istore 1 10141
+    istore 1 10142
+    istore 1 10143
+    istore 1 10144
+    istore 1 10145
+    istore 1 10146
+    istore 1 10147
+    istore 1 10148
+    istore 1 10149
+    istore 1 10150
+    istore 1 10151
+    istore 1 10152
+    istore 1 10153
+    istore 1 10154
+    istore 1 10155
+    istore 1 10156
+    istore 1 10157
+    istore 1 10158
+    istore 1 10159
+    istore 1 10160
+    istore 1 10161
+    istore 1 10162
+    istore 1 10163
+    istore 1 10164
+    istore 1 10165
+    istore 1 10166
+    istore 1 10167
+    istore 1 10168
+    istore 1 10169
+    istore 1 10170
+    istore 1 10171
+    istore 1 10172
+    istore 1 10173
+    istore 1 10174
+    istore 1 10175
+    istore 1 10176
+    istore 1 10177
+    istore 1 10178
+    istore 1 10179
+    istore 1 10180
+    istore 1 10181
+    istore 1 10182
+    istore 1 10183
+    istore 1 10184
+    istore 1 10185
+    istore 1 10186
+    istore 1 10187
+    istore 1 10188
+    istore 1 10189
+    istore 1 10190
+    istore 1 10191
+    istore 1 10192
+    istore 1 10193
+    istore 1 10194
+    istore 1 10195
+    istore 1 10196
+    istore 1 10197
+    istore 1 10198
+    istore 1 10199
+    istore 1 10200
+    istore 1 10201
+    istore 1 10202
+    istore 1 10203
+    istore 1 10204
+    istore 1 10205
+    istore 1 10206
+    istore 1 10207
+    istore 1 10208
+    istore 1 10209
+    istore 1 10210
+    istore 1 10211
+    istore 1 10212
+    istore 1 10213
+    istore 1 10214
+    istore 1 10215
+    istore 1 10216
+    istore 1 10217
+    istore 1 10218
+    istore 1 10219
+    istore 1 10220
+    istore 1 10221
+    istore 1 10222
+    istore 1 10223
+    istore 1 10224
+    istore 1 10225
+    istore 1 10226
+    istore 1 10227
+    istore 1 10228
+    istore 1 10229
+    istore 1 10230
+    istore 1 10231
+    istore 1 10232
+    istore 1 10233
+    istore 1 10234
+    istore 1 10235
+    istore 1 10236
+    istore 1 10237
+    istore 1 10238
+    istore 1 10239
+    istore 1 10240
+    istore 1 10241
+    istore 1 10242
+    istore 1 10243
+    istore 1 10244
+    istore 1 10245
+    istore 1 10246
+    istore 1 10247
+    istore 1 10248
+    istore 1 10249
+    istore 1 10250
+    istore 1 10251
+    istore 1 10252
+    istore 1 10253
+    istore 1 10254
+    istore 1 10255
+    istore 1 10256
+    istore 1 10257
+    istore 1 10258
+    istore 1 10259
+    istore 1 10260
+    istore 1 10261
+    istore 1 10262
+    istore 1 10263
+    istore 1 10264
+    istore 1 10265
+    istore 1 10266
+    istore 1 10267
+    istore 1 10268
+    istore 1 10269
+    istore 1 10270
+    istore 1 10271
+    istore 1 10272
+    istore 1 10273
+    istore 1 10274
+    istore 1 10275
+    istore 1 10276
+    istore 1 10277
+    istore 1 10278
+    istore 1 10279
+    istore 1 10280
+    istore 1 10281
+    istore 1 10282
+    istore 1 10283
+    istore 1 10284
+    istore 1 10285
+    istore 1 10286
+    istore 1 10287
+    istore 1 10288
+    istore 1 10289
+    istore 1 10290
+    istore 1 10291
+    istore 1 10292
+    istore 1 10293
+    istore 1 10294
+    istore 1 10295
+    istore 1 10296
+    istore 1 10297
+    istore 1 10298
+    istore 1 10299
+    istore 1 10300
+    istore 1 10301
+    istore 1 10302
+    istore 1 10303
+    istore 1 10304
+    istore 1 10305
+    istore 1 10306
+    istore 1 10307
+    istore 1 10308
+    istore 1 10309
+    istore 1 10310
+    istore 1 10311
+    istore 1 10312
+    istore 1 10313
+    istore 1 10314
+    istore 1 10315
+    istore 1 10316
+    istore 1 10317
+    istore 1 10318
+    istore 1 10319
+    istore 1 10320
+    istore 1 10321
+    istore 1 10322
+    istore 1 10323
+    istore 1 10324
+    istore 1 10325
+    istore 1 10326
+    istore 1 10327
+    istore 1 10328
+    istore 1 10329
+    istore 1 10330
+    istore 1 10331
+    istore 1 10332
+    istore 1 10333
+    istore 1 10334
+    istore 1 10335
+    istore 1 10336
+    istore 1 10337
+    istore 1 10338
+    istore 1 10339
+    istore 1 10340
+    istore 1 10341
+    istore 1 10342
+    istore 1 10343
+    istore 1 10344
+    istore 1 10345
+    istore 1 10346
+    istore 1 10347
+    istore 1 10348
+    istore 1 10349
+    istore 1 10350
+    istore 1 10351
+    istore 1 10352
+    istore 1 10353
+    istore 1 10354
+    istore 1 10355
+    istore 1 10356
+    istore 1 10357
+    istore 1 10358
+    istore 1 10359
+    istore 1 10360
+    istore 1 10361
+    istore 1 10362
+    istore 1 10363
+    istore 1 10364
+    istore 1 10365
+    istore 1 10366
+    istore 1 10367
+    istore 1 10368
+    istore 1 10369
+    istore 1 10370
+    istore 1 10371
+    istore 1 10372
+    istore 1 10373
+    istore 1 10374
+    istore 1 10375
+    istore 1 10376
+    istore 1 10377
+    istore 1 10378
+    istore 1 10379
+    istore 1 10380
+    istore 1 10381
+    istore 1 10382
+    istore 1 10383
+    istore 1 10384
+    istore 1 10385
+    istore 1 10386
+    istore 1 10387
+    istore 1 10388
+    istore 1 10389
+    istore 1 10390
+    istore 1 10391
+    istore 1 10392
+    istore 1 10393
+    istore 1 10394
+    istore 1 10395
+    istore 1 10396
+    istore 1 10397
+    istore 1 10398
+    istore 1 10399
+    istore 1 10400
+    istore 1 10401
+    istore 1 10402
+    istore 1 10403
+    istore 1 10404
+    istore 1 10405
+    istore 1 10406
+    istore 1 10407
+    istore 1 10408
+    istore 1 10409
+    istore 1 10410
+    istore 1 10411
+    istore 1 10412
+    istore 1 10413
+    istore 1 10414
+    istore 1 10415
+    istore 1 10416
+    istore 1 10417
+    istore 1 10418
+    istore 1 10419
+    istore 1 10420
+    istore 1 10421
+    istore 1 10422
+    istore 1 10423
+    istore 1 10424
+    istore 1 10425
+    istore 1 10426
+    istore 1 10427
+    istore 1 10428
+    istore 1 10429
+    istore 1 10430
+    istore 1 10431
+    istore 1 10432
+    istore 1 10433
+    istore 1 10434
+    istore 1 10435
+    istore 1 10436
+    istore 1 10437
+    istore 1 10438
+    istore 1 10439
+    istore 1 10440
+    istore 1 10441
+    istore 1 10442
+    istore 1 10443
+    istore 1 10444
+    istore 1 10445
+    istore 1 10446
+    istore 1 10447
+    istore 1 10448
+    istore 1 10449
+    istore 1 10450
+    istore 1 10451
+    istore 1 10452
+    istore 1 10453
+    istore 1 10454
+    istore 1 10455
+    istore 1 10456
+    istore 1 10457
+    istore 1 10458
+    istore 1 10459
+    istore 1 10460
+    istore 1 10461
+    istore 1 10462
+    istore 1 10463
+    istore 1 10464
+    istore 1 10465
+    istore 1 10466
+    istore 1 10467
+    istore 1 10468
+    istore 1 10469
+    istore 1 10470
+    istore 1 10471
+    istore 1 10472
+    istore 1 10473
+    istore 1 10474
+    istore 1 10475
+    istore 1 10476
+    istore 1 10477
+    istore 1 10478
+    istore 1 10479
+    istore 1 10480
+    istore 1 10481
+    istore 1 10482
+    istore 1 10483
+    istore 1 10484
+    istore 1 10485
+    istore 1 10486
+    istore 1 10487
+    istore 1 10488
+    istore 1 10489
+    istore 1 10490
+    istore 1 10491
+    istore 1 10492
+    istore 1 10493
+    istore 1 10494
+    istore 1 10495
+    istore 1 10496
+    istore 1 10497
+    istore 1 10498
+    istore 1 10499
+    istore 1 10500
+    istore 1 10501
+    istore 1 10502
+    istore 1 10503
+    istore 1 10504
+    istore 1 10505
+    istore 1 10506
+    istore 1 10507
+    istore 1 10508
+    istore 1 10509
+    istore 1 10510
+    istore 1 10511
+    istore 1 10512
+    istore 1 10513
+    istore 1 10514
+    istore 1 10515
+    istore 1 10516
+    istore 1 10517
+    istore 1 10518
+    istore 1 10519
+    istore 1 10520
+    istore 1 10521
+    istore 1 10522
+    istore 1 10523
+    istore 1 10524
+    istore 1 10525
+    istore 1 10526
+    istore 1 10527
+    istore 1 10528
+    istore 1 10529
+    istore 1 10530
+    istore 1 10531
+    istore 1 10532
+    istore 1 10533
+    istore 1 10534
+    istore 1 10535
+    istore 1 10536
+    istore 1 10537
+    istore 1 10538
+    istore 1 10539
+    istore 1 10540
+    istore 1 10541
+    istore 1 10542
+    istore 1 10543
+    istore 1 10544
+    istore 1 10545
+    istore 1 10546
+    istore 1 10547
+    istore 1 10548
+    istore 1 10549
+    istore 1 10550
+    istore 1 10551
+    istore 1 10552
+    istore 1 10553
+    istore 1 10554
+    istore 1 10555
+    istore 1 10556
+    istore 1 10557
+    istore 1 10558
+    istore 1 10559
+    istore 1 10560
+    istore 1 10561
+    istore 1 10562
+    istore 1 10563
+    istore 1 10564
+    istore 1 10565
+    istore 1 10566
+    istore 1 10567
+    istore 1 10568
+    istore 1 10569
+    istore 1 10570
+    istore 1 10571
+    istore 1 10572
+    istore 1 10573
+    istore 1 10574
+    istore 1 10575
+    istore 1 10576
+    istore 1 10577
+    istore 1 10578
+    istore 1 10579
+    istore 1 10580
+    istore 1 10581
+    istore 1 10582
+    istore 1 10583
+    istore 1 10584
+    istore 1 10585
+    istore 1 10586
+    istore 1 10587
+    istore 1 10588
+    istore 1 10589
+    istore 1 10590
+    istore 1 10591
+    istore 1 10592
+    istore 1 10593
+    istore 1 10594
+    istore 1 10595
+    istore 1 10596
+    istore 1 10597
+    istore 1 10598
+    istore 1 10599
+    istore 1 10600
+    istore 1 10601
+    istore 1 10602
+    istore 1 10603
+    istore 1 10604
+    istore 1 10605
+    istore 1 10606
+    istore 1 10607
+    istore 1 10608
+    istore 1 10609
+    istore 1 10610
+    istore 1 10611
+    istore 1 10612
+    istore 1 10613
+    istore 1 10614
+    istore 1 10615
+    istore 1 10616
+    istore 1 10617
+    istore 1 10618
+    istore 1 10619
+    istore 1 10620
+    istore 1 10621
+    istore 1 10622
+    istore 1 10623
+    istore 1 10624
+    istore 1 10625
+    istore 1 10626
+    istore 1 10627
+    istore 1 10628
+    istore 1 10629
+    istore 1 10630
+    istore 1 10631
+    istore 1 10632
+    istore 1 10633
+    istore 1 10634
+    istore 1 10635
+    istore 1 10636
+    istore 1 10637
+    istore 1 10638
+    istore 1 10639
+    istore 1 10640
+    istore 1 10641
+    istore 1 10642
+    istore 1 10643
+    istore 1 10644
+    istore 1 10645
+    istore 1 10646
+    istore 1 10647
+    istore 1 10648
+    istore 1 10649
+    istore 1 10650
+    istore 1 10651
+    istore 1 10652
+    istore 1 10653
+    istore 1 10654
+    istore 1 10655
+    istore 1 10656
+    istore 1 10657
+    istore 1 10658
+    istore 1 10659
+    istore 1 10660
+    istore 1 10661
+    istore 1 10662
+    istore 1 10663
+    istore 1 10664
+    istore 1 10665
+    istore 1 10666
+    istore 1 10667
+    istore 1 10668
+    istore 1 10669
+    istore 1 10670
+    istore 1 10671
+    istore 1 10672
+    istore 1 10673
+    istore 1 10674
+    istore 1 10675
+    istore 1 10676
+    istore 1 10677
+    istore 1 10678
+    istore 1 10679
+    istore 1 10680
+    istore 1 10681
+    istore 1 10682
+    istore 1 10683
+    istore 1 10684
+    istore 1 10685
+    istore 1 10686
+    istore 1 10687
+    istore 1 10688
+    istore 1 10689
+    istore 1 10690
+    istore 1 10691
+    istore 1 10692
+    istore 1 10693
+    istore 1 10694
+    istore 1 10695
+    istore 1 10696
+    istore 1 10697
+    istore 1 10698
+    istore 1 10699
+    istore 1 10700
+    istore 1 10701
+    istore 1 10702
+    istore 1 10703
+    istore 1 10704
+    istore 1 10705
+    istore 1 10706
+    istore 1 10707
+    istore 1 10708
+    istore 1 10709
+    istore 1 10710
+    istore 1 10711
+    istore 1 10712
+    istore 1 10713
+    istore 1 10714
+    istore 1 10715
+    istore 1 10716
+    istore 1 10717
+    istore 1 10718
+    istore 1 10719
+    istore 1 10720
+    istore 1 10721
+    istore 1 10722
+    istore 1 10723
+    istore 1 10724
+    istore 1 10725
+    istore 1 10726
+    istore 1 10727
+    istore 1 10728
+    istore 1 10729
+    istore 1 10730
+    istore 1 10731
+    istore 1 10732
+    istore 1 10733
+    istore 1 10734
+    istore 1 10735
+    istore 1 10736
+    istore 1 10737
+    istore 1 10738
+    istore 1 10739
+    istore 1 10740
+    istore 1 10741
+    istore 1 10742
+    istore 1 10743
+    istore 1 10744
+    istore 1 10745
+    istore 1 10746
+    istore 1 10747
+    istore 1 10748
+    istore 1 10749
+    istore 1 10750
+    istore 1 10751
+    istore 1 10752
+    istore 1 10753
+    istore 1 10754
+    istore 1 10755
+    istore 1 10756
+    istore 1 10757
+    istore 1 10758
+    istore 1 10759
+    istore 1 10760
+    istore 1 10761
+    istore 1 10762
+    istore 1 10763
+    istore 1 10764
+    istore 1 10765
+    istore 1 10766
+    istore 1 10767
+    istore 1 10768
+    istore 1 10769
+    istore 1 10770
+    istore 1 10771
+    istore 1 10772
+    istore 1 10773
+    istore 1 10774
+    istore 1 10775
+    istore 1 10776
+    istore 1 10777
+    istore 1 10778
+    istore 1 10779
+    istore 1 10780
+    istore 1 10781
+    istore 1 10782
+    istore 1 10783
+    istore 1 10784
+    istore 1 10785
+    istore 1 10786
+    istore 1 10787
+    istore 1 10788
+    istore 1 10789
+    istore 1 10790
+    istore 1 10791
+    istore 1 10792
+    istore 1 10793
+    istore 1 10794
+    istore 1 10795
+    istore 1 10796
+    istore 1 10797
+    istore 1 10798
+    istore 1 10799
+    istore 1 10800
+    istore 1 10801
+    istore 1 10802
+    istore 1 10803
+    istore 1 10804
+    istore 1 10805
+    istore 1 10806
+    istore 1 10807
+    istore 1 10808
+    istore 1 10809
+    istore 1 10810
+    istore 1 10811
+    istore 1 10812
+    istore 1 10813
+    istore 1 10814
+    istore 1 10815
+    istore 1 10816
+    istore 1 10817
+    istore 1 10818
+    istore 1 10819
+    istore 1 10820
+    istore 1 10821
+    istore 1 10822
+    istore 1 10823
+    istore 1 10824
+    istore 1 10825
+    istore 1 10826
+    istore 1 10827
+    istore 1 10828
+    istore 1 10829
+    istore 1 10830
+    istore 1 10831
+    istore 1 10832
+    istore 1 10833
+    istore 1 10834
+    istore 1 10835
+    istore 1 10836
+    istore 1 10837
+    istore 1 10838
+    istore 1 10839
+    istore 1 10840
+    istore 1 10841
+    istore 1 10842
+    istore 1 10843
+    istore 1 10844
+    istore 1 10845
+    istore 1 10846
+    istore 1 10847
+    istore 1 10848
+    istore 1 10849
+    istore 1 10850
+    istore 1 10851
+    istore 1 10852
+    istore 1 10853
+    istore 1 10854
+    istore 1 10855
+    istore 1 10856
+    istore 1 10857
+    istore 1 10858
+    istore 1 10859
+    istore 1 10860
+    istore 1 10861
+    istore 1 10862
+    istore 1 10863
+    istore 1 10864
+    istore 1 10865
+    istore 1 10866
+    istore 1 10867
+    istore 1 10868
+    istore 1 10869
+    istore 1 10870
+    istore 1 10871
+    istore 1 10872
+    istore 1 10873
+    istore 1 10874
+    istore 1 10875
+    istore 1 10876
+    istore 1 10877
+    istore 1 10878
+    istore 1 10879
+    istore 1 10880
+    istore 1 10881
+    istore 1 10882
+    istore 1 10883
+    istore 1 10884
+    istore 1 10885
+    istore 1 10886
+    istore 1 10887
+    istore 1 10888
+    istore 1 10889
+    istore 1 10890
+    istore 1 10891
+    istore 1 10892
+    istore 1 10893
+    istore 1 10894
+    istore 1 10895
+    istore 1 10896
+    istore 1 10897
+    istore 1 10898
+    istore 1 10899
+    istore 1 10900
+    istore 1 10901
+    istore 1 10902
+    istore 1 10903
+    istore 1 10904
+    istore 1 10905
+    istore 1 10906
+    istore 1 10907
+    istore 1 10908
+    istore 1 10909
+    istore 1 10910
+    istore 1 10911
+    istore 1 10912
+    istore 1 10913
+    istore 1 10914
+    istore 1 10915
+    istore 1 10916
+    istore 1 10917
+    istore 1 10918
+    istore 1 10919
+    istore 1 10920
+    istore 1 10921
+    istore 1 10922
+    istore 1 10923
+    istore 1 10924
+    istore 1 10925
+    istore 1 10926
+    istore 1 10927
+    istore 1 10928
+    istore 1 10929
+    istore 1 10930
+    istore 1 10931
+    istore 1 10932
+    istore 1 10933
+    istore 1 10934
+    istore 1 10935
+    istore 1 10936
+    istore 1 10937
+    istore 1 10938
+    istore 1 10939
+    istore 1 10940
+    istore 1 10941
+    istore 1 10942
+    istore 1 10943
+    istore 1 10944
+    istore 1 10945
+    istore 1 10946
+    istore 1 10947
+    istore 1 10948
+    istore 1 10949
+    istore 1 10950
+    istore 1 10951
+    istore 1 10952
+    istore 1 10953
+    istore 1 10954
+    istore 1 10955
+    istore 1 10956
+    istore 1 10957
+    istore 1 10958
+    istore 1 10959
+    istore 1 10960
+    istore 1 10961
+    istore 1 10962
+    istore 1 10963
+    istore 1 10964
+    istore 1 10965
+    istore 1 10966
+    istore 1 10967
+    istore 1 10968
+    istore 1 10969
+    istore 1 10970
+    istore 1 10971
+    istore 1 10972
+    istore 1 10973
+    istore 1 10974
+    istore 1 10975
+    istore 1 10976
+    istore 1 10977
+    istore 1 10978
+    istore 1 10979
+    istore 1 10980
+    istore 1 10981
+    istore 1 10982
+    istore 1 10983
+    istore 1 10984
+    istore 1 10985
+    istore 1 10986
+    istore 1 10987
+    istore 1 10988
+    istore 1 10989
+    istore 1 10990
+    istore 1 10991
+    istore 1 10992
+    istore 1 10993
+    istore 1 10994
+    istore 1 10995
+    istore 1 10996
+    istore 1 10997
+    istore 1 10998
+    istore 1 10999
+    istore 1 11000
+    istore 1 11001
+    istore 1 11002
+    istore 1 11003
+    istore 1 11004
+    istore 1 11005
+    istore 1 11006
+    istore 1 11007
+    istore 1 11008
+    istore 1 11009
+    istore 1 11010
+    istore 1 11011
+    istore 1 11012
+    istore 1 11013
+    istore 1 11014
+    istore 1 11015
+    istore 1 11016
+    istore 1 11017
+    istore 1 11018
+    istore 1 11019
+    istore 1 11020
+    istore 1 11021
+    istore 1 11022
+    istore 1 11023
+    istore 1 11024
+    istore 1 11025
+    istore 1 11026
+    istore 1 11027
+    istore 1 11028
+    istore 1 11029
+    istore 1 11030
+    istore 1 11031
+    istore 1 11032
+    istore 1 11033
+    istore 1 11034
+    istore 1 11035
+    istore 1 11036
+    istore 1 11037
+    istore 1 11038
+    istore 1 11039
+    istore 1 11040
+    istore 1 11041
+    istore 1 11042
+    istore 1 11043
+    istore 1 11044
+    istore 1 11045
+    istore 1 11046
+    istore 1 11047
+    istore 1 11048
+    istore 1 11049
+    istore 1 11050
+    istore 1 11051
+    istore 1 11052
+    istore 1 11053
+    istore 1 11054
+    istore 1 11055
+    istore 1 11056
+    istore 1 11057
+    istore 1 11058
+    istore 1 11059
+    istore 1 11060
+    istore 1 11061
+    istore 1 11062
+    istore 1 11063
+    istore 1 11064
+    istore 1 11065
+    istore 1 11066
+    istore 1 11067
+    istore 1 11068
+    istore 1 11069
+    istore 1 11070
+    istore 1 11071
+    istore 1 11072
+    istore 1 11073
+    istore 1 11074
+    istore 1 11075
+    istore 1 11076
+    istore 1 11077
+    istore 1 11078
+    istore 1 11079
+    istore 1 11080
+    istore 1 11081
+    istore 1 11082
+    istore 1 11083
+    istore 1 11084
+    istore 1 11085
+    istore 1 11086
+    istore 1 11087
+    istore 1 11088
+    istore 1 11089
+    istore 1 11090
+    istore 1 11091
+    istore 1 11092
+    istore 1 11093
+    istore 1 11094
+    istore 1 11095
+    istore 1 11096
+    istore 1 11097
+    istore 1 11098
+    istore 1 11099
+    istore 1 11100
+    istore 1 11101
+    istore 1 11102
+    istore 1 11103
+    istore 1 11104
+    istore 1 11105
+    istore 1 11106
+    istore 1 11107
+    istore 1 11108
+    istore 1 11109
+    istore 1 11110
+    istore 1 11111
+    istore 1 11112
+    istore 1 11113
+    istore 1 11114
+    istore 1 11115
+    istore 1 11116
+    istore 1 11117
+    istore 1 11118
+    istore 1 11119
+    istore 1 11120
+    istore 1 11121
+    istore 1 11122
+    istore 1 11123
+    istore 1 11124
+    istore 1 11125
+    istore 1 11126
+    istore 1 11127
+    istore 1 11128
+    istore 1 11129
+    istore 1 11130
+    istore 1 11131
+    istore 1 11132
+    istore 1 11133
+    istore 1 11134
+    istore 1 11135
+    istore 1 11136
+    istore 1 11137
+    istore 1 11138
+    istore 1 11139
+    istore 1 11140
+    istore 1 11141
+    istore 1 11142
+    istore 1 11143
+    istore 1 11144
+    istore 1 11145
+    istore 1 11146
+    istore 1 11147
+    istore 1 11148
+    istore 1 11149
+    istore 1 11150
+    istore 1 11151
+    istore 1 11152
+    istore 1 11153
+    istore 1 11154
+    istore 1 11155
+    istore 1 11156
+    istore 1 11157
+    istore 1 11158
+    istore 1 11159
+    istore 1 11160
+    istore 1 11161
+    istore 1 11162
+    istore 1 11163
+    istore 1 11164
+    istore 1 11165
+    istore 1 11166
+    istore 1 11167
+    istore 1 11168
+    istore 1 11169
+    istore 1 11170
+    istore 1 11171
+    istore 1 11172
+    istore 1 11173
+    istore 1 11174
+    istore 1 11175
+    istore 1 11176
+    istore 1 11177
+    istore 1 11178
+    istore 1 11179
+    istore 1 11180
+    istore 1 11181
+    istore 1 11182
+    istore 1 11183
+    istore 1 11184
+    istore 1 11185
+    istore 1 11186
+    istore 1 11187
+    istore 1 11188
+    istore 1 11189
+    istore 1 11190
+    istore 1 11191
+    istore 1 11192
+    istore 1 11193
+    istore 1 11194
+    istore 1 11195
+    istore 1 11196
+    istore 1 11197
+    istore 1 11198
+    istore 1 11199
+    istore 1 11200
+    istore 1 11201
+    istore 1 11202
+    istore 1 11203
+    istore 1 11204
+    istore 1 11205
+    istore 1 11206
+    istore 1 11207
+    istore 1 11208
+    istore 1 11209
+    istore 1 11210
+    istore 1 11211
+    istore 1 11212
+    istore 1 11213
+    istore 1 11214
+    istore 1 11215
+    istore 1 11216
+    istore 1 11217
+    istore 1 11218
+    istore 1 11219
+    istore 1 11220
+    istore 1 11221
+    istore 1 11222
+    istore 1 11223
+    istore 1 11224
+    istore 1 11225
+    istore 1 11226
+    istore 1 11227
+    istore 1 11228
+    istore 1 11229
+    istore 1 11230
+    istore 1 11231
+    istore 1 11232
+    istore 1 11233
+    istore 1 11234
+    istore 1 11235
+    istore 1 11236
+    istore 1 11237
+    istore 1 11238
+    istore 1 11239
+    istore 1 11240
+    istore 1 11241
+    istore 1 11242
+    istore 1 11243
+    istore 1 11244
+    istore 1 11245
+    istore 1 11246
+    istore 1 11247
+    istore 1 11248
+    istore 1 11249
+    istore 1 11250
+    istore 1 11251
+    istore 1 11252
+    istore 1 11253
+    istore 1 11254
+    istore 1 11255
+    istore 1 11256
+    istore 1 11257
+    istore 1 11258
+    istore 1 11259
+    istore 1 11260
+    istore 1 11261
+    istore 1 11262
+    istore 1 11263
+    istore 1 11264
+    istore 1 11265
+    istore 1 11266
+    istore 1 11267
+    istore 1 11268
+    istore 1 11269
+    istore 1 11270
+    istore 1 11271
+    istore 1 11272
+    istore 1 11273
+    istore 1 11274
+    istore 1 11275
+    istore 1 11276
+    istore 1 11277
+    istore 1 11278
+    istore 1 11279
+    istore 1 11280
+    istore 1 11281
+    istore 1 11282
+    istore 1 11283
+    istore 1 11284
+    istore 1 11285
+    istore 1 11286
+    istore 1 11287
+    istore 1 11288
+    istore 1 11289
+    istore 1 11290
+    istore 1 11291
+    istore 1 11292
+    istore 1 11293
+    istore 1 11294
+    istore 1 11295
+    istore 1 11296
+    istore 1 11297
+    istore 1 11298
+    istore 1 11299
+    istore 1 11300
+    istore 1 11301
+    istore 1 11302
+    istore 1 11303
+    istore 1 11304
+    istore 1 11305
+    istore 1 11306
+    istore 1 11307
+    istore 1 11308
+    istore 1 11309
+    istore 1 11310
+    istore 1 11311
+    istore 1 11312
+    istore 1 11313
+    istore 1 11314
+    istore 1 11315
+    istore 1 11316
+    istore 1 11317
+    istore 1 11318
+    istore 1 11319
+    istore 1 11320
+    istore 1 11321
+    istore 1 11322
+    istore 1 11323
+    istore 1 11324
+    istore 1 11325
+    istore 1 11326
+    istore 1 11327
+    istore 1 11328
+    istore 1 11329
+    istore 1 11330
+    istore 1 11331
+    istore 1 11332
+    istore 1 11333
+    istore 1 11334
+    istore 1 11335
+    istore 1 11336
+    istore 1 11337
+    istore 1 11338
+    istore 1 11339
+    istore 1 11340
+    istore 1 11341
+    istore 1 11342
+    istore 1 11343
+    istore 1 11344
+    istore 1 11345
+    istore 1 11346
+    istore 1 11347
+    istore 1 11348
+    istore 1 11349
+    istore 1 11350
+    istore 1 11351
+    istore 1 11352
+    istore 1 11353
+    istore 1 11354
+    istore 1 11355
+    istore 1 11356
+    istore 1 11357
+    istore 1 11358
+    istore 1 11359
+    istore 1 11360
+    istore 1 11361
+    istore 1 11362
+    istore 1 11363
+    istore 1 11364
+    istore 1 11365
+    istore 1 11366
+    istore 1 11367
+    istore 1 11368
+    istore 1 11369
+    istore 1 11370
+    istore 1 11371
+    istore 1 11372
+    istore 1 11373
+    istore 1 11374
+    istore 1 11375
+    istore 1 11376
+    istore 1 11377
+    istore 1 11378
+    istore 1 11379
+    istore 1 11380
+    istore 1 11381
+    istore 1 11382
+    istore 1 11383
+    istore 1 11384
+    istore 1 11385
+    istore 1 11386
+    istore 1 11387
+    istore 1 11388
+    istore 1 11389
+    istore 1 11390
+    istore 1 11391
+    istore 1 11392
+    istore 1 11393
+    istore 1 11394
+    istore 1 11395
+    istore 1 11396
+    istore 1 11397
+    istore 1 11398
+    istore 1 11399
+    istore 1 11400
+    istore 1 11401
+    istore 1 11402
+    istore 1 11403
+    istore 1 11404
+    istore 1 11405
+    istore 1 11406
+    istore 1 11407
+    istore 1 11408
+    istore 1 11409
+    istore 1 11410
+    istore 1 11411
+    istore 1 11412
+    istore 1 11413
+    istore 1 11414
+    istore 1 11415
+    istore 1 11416
+    istore 1 11417
+    istore 1 11418
+    istore 1 11419
+    istore 1 11420
+    istore 1 11421
+    istore 1 11422
+    istore 1 11423
+    istore 1 11424
+    istore 1 11425
+    istore 1 11426
+    istore 1 11427
+    istore 1 11428
+    istore 1 11429
+    istore 1 11430
+    istore 1 11431
+    istore 1 11432
+    istore 1 11433
+    istore 1 11434
+    istore 1 11435
+    istore 1 11436
+    istore 1 11437
+    istore 1 11438
+    istore 1 11439
+    istore 1 11440
+    istore 1 11441
+    istore 1 11442
+    istore 1 11443
+    istore 1 11444
+    istore 1 11445
+    istore 1 11446
+    istore 1 11447
+    istore 1 11448
+    istore 1 11449
+    istore 1 11450
+    istore 1 11451
+    istore 1 11452
+    istore 1 11453
+    istore 1 11454
+    istore 1 11455
+    istore 1 11456
+    istore 1 11457
+    istore 1 11458
+    istore 1 11459
+    istore 1 11460
+    istore 1 11461
+    istore 1 11462
+    istore 1 11463
+    istore 1 11464
+    istore 1 11465
+    istore 1 11466
+    istore 1 11467
+    istore 1 11468
+    istore 1 11469
+    istore 1 11470
+    istore 1 11471
+    istore 1 11472
+    istore 1 11473
+    istore 1 11474
+    istore 1 11475
+    istore 1 11476
+    istore 1 11477
+    istore 1 11478
+    istore 1 11479
+    istore 1 11480
+    istore 1 11481
+    istore 1 11482
+    istore 1 11483
+    istore 1 11484
+    istore 1 11485
+    istore 1 11486
+    istore 1 11487
+    istore 1 11488
+    istore 1 11489
+    istore 1 11490
+    istore 1 11491
+    istore 1 11492
+    istore 1 11493
+    istore 1 11494
+    istore 1 11495
+    istore 1 11496
+    istore 1 11497
+    istore 1 11498
+    istore 1 11499
+    istore 1 11500
+    istore 1 11501
+    istore 1 11502
+    istore 1 11503
+    istore 1 11504
+    istore 1 11505
+    istore 1 11506
+    istore 1 11507
+    istore 1 11508
+    istore 1 11509
+    istore 1 11510
+    istore 1 11511
+    istore 1 11512
+    istore 1 11513
+    istore 1 11514
+    istore 1 11515
+    istore 1 11516
+    istore 1 11517
+    istore 1 11518
+    istore 1 11519
+    istore 1 11520
+    istore 1 11521
+    istore 1 11522
+    istore 1 11523
+    istore 1 11524
+    istore 1 11525
+    istore 1 11526
+    istore 1 11527
+    istore 1 11528
+    istore 1 11529
+    istore 1 11530
+    istore 1 11531
+    istore 1 11532
+    istore 1 11533
+    istore 1 11534
+    istore 1 11535
+    istore 1 11536
+    istore 1 11537
+    istore 1 11538
+    istore 1 11539
+    istore 1 11540
+    istore 1 11541
+    istore 1 11542
+    istore 1 11543
+    istore 1 11544
+    istore 1 11545
+    istore 1 11546
+    istore 1 11547
+    istore 1 11548
+    istore 1 11549
+    istore 1 11550
+    istore 1 11551
+    istore 1 11552
+    istore 1 11553
+    istore 1 11554
+    istore 1 11555
+    istore 1 11556
+    istore 1 11557
+    istore 1 11558
+    istore 1 11559
+    istore 1 11560
+    istore 1 11561
+    istore 1 11562
+    istore 1 11563
+    istore 1 11564
+    istore 1 11565
+    istore 1 11566
+    istore 1 11567
+    istore 1 11568
+    istore 1 11569
+    istore 1 11570
+    istore 1 11571
+    istore 1 11572
+    istore 1 11573
+    istore 1 11574
+    istore 1 11575
+    istore 1 11576
+    istore 1 11577
+    istore 1 11578
+    istore 1 11579
+    istore 1 11580
+    istore 1 11581
+    istore 1 11582
+    istore 1 11583
+    istore 1 11584
+    istore 1 11585
+    istore 1 11586
+    istore 1 11587
+    istore 1 11588
+    istore 1 11589
+    istore 1 11590
+    istore 1 11591
+    istore 1 11592
+    istore 1 11593
+    istore 1 11594
+    istore 1 11595
+    istore 1 11596
+    istore 1 11597
+    istore 1 11598
+    istore 1 11599
+    istore 1 11600
+    istore 1 11601
+    istore 1 11602
+    istore 1 11603
+    istore 1 11604
+    istore 1 11605
+    istore 1 11606
+    istore 1 11607
+    istore 1 11608
+    istore 1 11609
+    istore 1 11610
+    istore 1 11611
+    istore 1 11612
+    istore 1 11613
+    istore 1 11614
+    istore 1 11615
+    istore 1 11616
+    istore 1 11617
+    istore 1 11618
+    istore 1 11619
+    istore 1 11620
+    istore 1 11621
+    istore 1 11622
+    istore 1 11623
+    istore 1 11624
+    istore 1 11625
+    istore 1 11626
+    istore 1 11627
+    istore 1 11628
+    istore 1 11629
+    istore 1 11630
+    istore 1 11631
+    istore 1 11632
+    istore 1 11633
+    istore 1 11634
+    istore 1 11635
+    istore 1 11636
+    istore 1 11637
+    istore 1 11638
+    istore 1 11639
+    istore 1 11640
+    istore 1 11641
+    istore 1 11642
+    istore 1 11643
+    istore 1 11644
+    istore 1 11645
+    istore 1 11646
+    istore 1 11647
+    istore 1 11648
+    istore 1 11649
+    istore 1 11650
+    istore 1 11651
+    istore 1 11652
+    istore 1 11653
+    istore 1 11654
+    istore 1 11655
+    istore 1 11656
+    istore 1 11657
+    istore 1 11658
+    istore 1 11659
+    istore 1 11660
+    istore 1 11661
+    istore 1 11662
+    istore 1 11663
+    istore 1 11664
+    istore 1 11665
+    istore 1 11666
+    istore 1 11667
+    istore 1 11668
+    istore 1 11669
+    istore 1 11670
+    istore 1 11671
+    istore 1 11672
+    istore 1 11673
+    istore 1 11674
+    istore 1 11675
+    istore 1 11676
+    istore 1 11677
+    istore 1 11678
+    istore 1 11679
+    istore 1 11680
+    istore 1 11681
+    istore 1 11682
+    istore 1 11683
+    istore 1 11684
+    istore 1 11685
+    istore 1 11686
+    istore 1 11687
+    istore 1 11688
+    istore 1 11689
+    istore 1 11690
+    istore 1 11691
+    istore 1 11692
+    istore 1 11693
+    istore 1 11694
+    istore 1 11695
+    istore 1 11696
+    istore 1 11697
+    istore 1 11698
+    istore 1 11699
+    istore 1 11700
+    istore 1 11701
+    istore 1 11702
+    istore 1 11703
+    istore 1 11704
+    istore 1 11705
+    istore 1 11706
+    istore 1 11707
+    istore 1 11708
+    istore 1 11709
+    istore 1 11710
+    istore 1 11711
+    istore 1 11712
+    istore 1 11713
+    istore 1 11714
+    istore 1 11715
+    istore 1 11716
+    istore 1 11717
+    istore 1 11718
+    istore 1 11719
+    istore 1 11720
+    istore 1 11721
+    istore 1 11722
+    istore 1 11723
+    istore 1 11724
+    istore 1 11725
+    istore 1 11726
+    istore 1 11727
+    istore 1 11728
+    istore 1 11729
+    istore 1 11730
+    istore 1 11731
+    istore 1 11732
+    istore 1 11733
+    istore 1 11734
+    istore 1 11735
+    istore 1 11736
+    istore 1 11737
+    istore 1 11738
+    istore 1 11739
+    istore 1 11740
+    istore 1 11741
+    istore 1 11742
+    istore 1 11743
+    istore 1 11744
+    istore 1 11745
+    istore 1 11746
+    istore 1 11747
+    istore 1 11748
+    istore 1 11749
+    istore 1 11750
+    istore 1 11751
+    istore 1 11752
+    istore 1 11753
+    istore 1 11754
+    istore 1 11755
+    istore 1 11756
+    istore 1 11757
+    istore 1 11758
+    istore 1 11759
+    istore 1 11760
+    istore 1 11761
+    istore 1 11762
+    istore 1 11763
+    istore 1 11764
+    istore 1 11765
+    istore 1 11766
+    istore 1 11767
+    istore 1 11768
+    istore 1 11769
+    istore 1 11770
+    istore 1 11771
+    istore 1 11772
+    istore 1 11773
+    istore 1 11774
+    istore 1 11775
+    istore 1 11776
+    istore 1 11777
+    istore 1 11778
+    istore 1 11779
+    istore 1 11780
+    istore 1 11781
+    istore 1 11782
+    istore 1 11783
+    istore 1 11784
+    istore 1 11785
+    istore 1 11786
+    istore 1 11787
+    istore 1 11788
+    istore 1 11789
+    istore 1 11790
+    istore 1 11791
+    istore 1 11792
+    istore 1 11793
+    istore 1 11794
+    istore 1 11795
+    istore 1 11796
+    istore 1 11797
+    istore 1 11798
+    istore 1 11799
+    istore 1 11800
+    istore 1 11801
+    istore 1 11802
+    istore 1 11803
+    istore 1 11804
+    istore 1 11805
+    istore 1 11806
+    istore 1 11807
+    istore 1 11808
+    istore 1 11809
+    istore 1 11810
+    istore 1 11811
+    istore 1 11812
+    istore 1 11813
+    istore 1 11814
+    istore 1 11815
+    istore 1 11816
+    istore 1 11817
+    istore 1 11818
+    istore 1 11819
+    istore 1 11820
+    istore 1 11821
+    istore 1 11822
+    istore 1 11823
+    istore 1 11824
+    istore 1 11825
+    istore 1 11826
+    istore 1 11827
+    istore 1 11828
+    istore 1 11829
+    istore 1 11830
+    istore 1 11831
+    istore 1 11832
+    istore 1 11833
+    istore 1 11834
+    istore 1 11835
+    istore 1 11836
+    istore 1 11837
+    istore 1 11838
+    istore 1 11839
+    istore 1 11840
+    istore 1 11841
+    istore 1 11842
+    istore 1 11843
+    istore 1 11844
+    istore 1 11845
+    istore 1 11846
+    istore 1 11847
+    istore 1 11848
+    istore 1 11849
+    istore 1 11850
+    istore 1 11851
+    istore 1 11852
+    istore 1 11853
+    istore 1 11854
+    istore 1 11855
+    istore 1 11856
+    istore 1 11857
+    istore 1 11858
+    istore 1 11859
+    istore 1 11860
+    istore 1 11861
+    istore 1 11862
+    istore 1 11863
+    istore 1 11864
+    istore 1 11865
+    istore 1 11866
+    istore 1 11867
+    istore 1 11868
+    istore 1 11869
+    istore 1 11870
+    istore 1 11871
+    istore 1 11872
+    istore 1 11873
+    istore 1 11874
+    istore 1 11875
+    istore 1 11876
+    istore 1 11877
+    istore 1 11878
+    istore 1 11879
+    istore 1 11880
+    istore 1 11881
+    istore 1 11882
+    istore 1 11883
+    istore 1 11884
+    istore 1 11885
+    istore 1 11886
+    istore 1 11887
+    istore 1 11888
+    istore 1 11889
+    istore 1 11890
+    istore 1 11891
+    istore 1 11892
+    istore 1 11893
+    istore 1 11894
+    istore 1 11895
+    istore 1 11896
+    istore 1 11897
+    istore 1 11898
+    istore 1 11899
+    istore 1 11900
+    istore 1 11901
+    istore 1 11902
+    istore 1 11903
+    istore 1 11904
+    istore 1 11905
+    istore 1 11906
+    istore 1 11907
+    istore 1 11908
+    istore 1 11909
+    istore 1 11910
+    istore 1 11911
+    istore 1 11912
+    istore 1 11913
+    istore 1 11914
+    istore 1 11915
+    istore 1 11916
+    istore 1 11917
+    istore 1 11918
+    istore 1 11919
+    istore 1 11920
+    istore 1 11921
+    istore 1 11922
+    istore 1 11923
+    istore 1 11924
+    istore 1 11925
+    istore 1 11926
+    istore 1 11927
+    istore 1 11928
+    istore 1 11929
+    istore 1 11930
+    istore 1 11931
+    istore 1 11932
+    istore 1 11933
+    istore 1 11934
+    istore 1 11935
+    istore 1 11936
+    istore 1 11937
+    istore 1 11938
+    istore 1 11939
+    istore 1 11940
+    istore 1 11941
+    istore 1 11942
+    istore 1 11943
+    istore 1 11944
+    istore 1 11945
+    istore 1 11946
+    istore 1 11947
+    istore 1 11948
+    istore 1 11949
+    istore 1 11950
+    istore 1 11951
+    istore 1 11952
+    istore 1 11953
+    istore 1 11954
+    istore 1 11955
+    istore 1 11956
+    istore 1 11957
+    istore 1 11958
+    istore 1 11959
+    istore 1 11960
+    istore 1 11961
+    istore 1 11962
+    istore 1 11963
+    istore 1 11964
+    istore 1 11965
+    istore 1 11966
+    istore 1 11967
+    istore 1 11968
+    istore 1 11969
+    istore 1 11970
+    istore 1 11971
+    istore 1 11972
+    istore 1 11973
+    istore 1 11974
+    istore 1 11975
+    istore 1 11976
+    istore 1 11977
+    istore 1 11978
+    istore 1 11979
+    istore 1 11980
+    istore 1 11981
+    istore 1 11982
+    istore 1 11983
+    istore 1 11984
+    istore 1 11985
+    istore 1 11986
+    istore 1 11987
+    istore 1 11988
+    istore 1 11989
+    istore 1 11990
+    istore 1 11991
+    istore 1 11992
+    istore 1 11993
+    istore 1 11994
+    istore 1 11995
+    istore 1 11996
+    istore 1 11997
+    istore 1 11998
+    istore 1 11999
+    print 1
+    frame 0 16
+    call 0 foo
+    izero 0
+    end
+.end
+
+.function: foo
+    istore 1 42
+    print 1
+    end
+.end
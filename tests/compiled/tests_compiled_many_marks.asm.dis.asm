@@ -0,0 +1,8008 @@
+.function: main
+    istore 1 0
+    jump 0x9
+    iinc 1
+    jump 0x19
+    iinc 1
+    jump 0x7d0e
+    iinc 1
+    jump 0x29
+    iinc 1
+    jump 0x11
+    iinc 1
+    jump 0x39
+    iinc 1
+    jump 0x21
+    iinc 1
+    jump 0x49
+    iinc 1
+    jump 0x31
+    iinc 1
+    jump 0x59
+    iinc 1
+    jump 0x41
+    iinc 1
+    jump 0x69
+    iinc 1
+    jump 0x51
+    iinc 1
+    jump 0x79
+    iinc 1
+    jump 0x61
+    iinc 1
+    jump 0x89
+    iinc 1
+    jump 0x71
+    iinc 1
+    jump 0x99
+    iinc 1
+    jump 0x81
+    iinc 1
+    jump 0xa9
+    iinc 1
+    jump 0x91
+    iinc 1
+    jump 0xb9
+    iinc 1
+    jump 0xa1
+    iinc 1
+    jump 0xc9
+    iinc 1
+    jump 0xb1
+    iinc 1
+    jump 0xd9
+    iinc 1
+    jump 0xc1
+    iinc 1
+    jump 0xe9
+    iinc 1
+    jump 0xd1
+    iinc 1
+    jump 0xf9
+    iinc 1
+    jump 0xe1
+    iinc 1
+    jump 0x109
+    iinc 1
+    jump 0xf1
+    iinc 1
+    jump 0x119
+    iinc 1
+    jump 0x101
+    iinc 1
+    jump 0x129
+    iinc 1
+    jump 0x111
+    iinc 1
+    jump 0x139
+    iinc 1
+    jump 0x121
+    iinc 1
+    jump 0x149
+    iinc 1
+    jump 0x131
+    iinc 1
+    jump 0x159
+    iinc 1
+    jump 0x141
+    iinc 1
+    jump 0x169
+    iinc 1
+    jump 0x151
+    iinc 1
+    jump 0x179
+    iinc 1
+    jump 0x161
+    iinc 1
+    jump 0x189
+    iinc 1
+    jump 0x171
+    iinc 1
+    jump 0x199
+    iinc 1
+    jump 0x181
+    iinc 1
+    jump 0x1a9
+    iinc 1
+    jump 0x191
+    iinc 1
+    jump 0x1b9
+    iinc 1
+    jump 0x1a1
+    iinc 1
+    jump 0x1c9
+    iinc 1
+    jump 0x1b1
+    iinc 1
+    jump 0x1d9
+    iinc 1
+    jump 0x1c1
+    iinc 1
+    jump 0x1e9
+    iinc 1
+    jump 0x1d1
+    iinc 1
+    jump 0x1f9
+    iinc 1
+    jump 0x1e1
+    iinc 1
+    jump 0x209
+    iinc 1
+    jump 0x1f1
+    iinc 1
+    jump 0x219
+    iinc 1
+    jump 0x201
+    iinc 1
+    jump 0x229
+    iinc 1
+    jump 0x211
+    iinc 1
+    jump 0x239
+    iinc 1
+    jump 0x221
+    iinc 1
+    jump 0x249
+    iinc 1
+    jump 0x231
+    iinc 1
+    jump 0x259
+    iinc 1
+    jump 0x241
+    iinc 1
+    jump 0x269
+    iinc 1
+    jump 0x251
+    iinc 1
+    jump 0x279
+    iinc 1
+    jump 0x261
+    iinc 1
+    jump 0x289
+    iinc 1
+    jump 0x271
+    iinc 1
+    jump 0x299
+    iinc 1
+    jump 0x281
+    iinc 1
+    jump 0x2a9
+    iinc 1
+    jump 0x291
+    iinc 1
+    jump 0x2b9
+    iinc 1
+    jump 0x2a1
+    iinc 1
+    jump 0x2c9
+    iinc 1
+    jump 0x2b1
+    iinc 1
+    jump 0x2d9
+    iinc 1
+    jump 0x2c1
+    iinc 1
+    jump 0x2e9
+    iinc 1
+    jump 0x2d1
+    iinc 1
+    jump 0x2f9
+    iinc 1
+    jump 0x2e1
+    iinc 1
+    jump 0x309
+    iinc 1
+    jump 0x2f1
+    iinc 1
+    jump 0x319
+    iinc 1
+    jump 0x301
+    iinc 1
+    jump 0x329
+    iinc 1
+    jump 0x311
+    iinc 1
+    jump 0x339
+    iinc 1
+    jump 0x321
+    iinc 1
+    jump 0x349
+    iinc 1
+    jump 0x331
+    iinc 1
+    jump 0x359
+    iinc 1
+    jump 0x341
+    iinc 1
+    jump 0x369
+    iinc 1
+    jump 0x351
+    iinc 1
+    jump 0x379
+    iinc 1
+    jump 0x361
+    iinc 1
+    jump 0x389
+    iinc 1
+    jump 0x371
+    iinc 1
+    jump 0x399
+    iinc 1
+    jump 0x381
+    iinc 1
+    jump 0x3a9
+    iinc 1
+    jump 0x391
+    iinc 1
+    jump 0x3b9
+    iinc 1
+    jump 0x3a1
+    iinc 1
+    jump 0x3c9
+    iinc 1
+    jump 0x3b1
+    iinc 1
+    jump 0x3d9
+    iinc 1
+    jump 0x3c1
+    iinc 1
+    jump 0x3e9
+    iinc 1
+    jump 0x3d1
+    iinc 1
+    jump 0x3f9
+    iinc 1
+    jump 0x3e1
+    iinc 1
+    jump 0x409
+    iinc 1
+    jump 0x3f1
+    iinc 1
+    jump 0x419
+    iinc 1
+    jump 0x401
+    iinc 1
+    jump 0x429
+    iinc 1
+    jump 0x411
+    iinc 1
+    jump 0x439
+    iinc 1
+    jump 0x421
+    iinc 1
+    jump 0x449
+    iinc 1
+    jump 0x431
+    iinc 1
+    jump 0x459
+    iinc 1
+    jump 0x441
+    iinc 1
+    jump 0x469
+    iinc 1
+    jump 0x451
+    iinc 1
+    jump 0x479
+    iinc 1
+    jump 0x461
+    iinc 1
+    jump 0x489
+    iinc 1
+    jump 0x471
+    iinc 1
+    jump 0x499
+    iinc 1
+    jump 0x481
+    iinc 1
+    jump 0x4a9
+    iinc 1
+    jump 0x491
+    iinc 1
+    jump 0x4b9
+    iinc 1
+    jump 0x4a1
+    iinc 1
+    jump 0x4c9
+    iinc 1
+    jump 0x4b1
+    iinc 1
+    jump 0x4d9
+    iinc 1
+    jump 0x4c1
+    iinc 1
+    jump 0x4e9
+    iinc 1
+    jump 0x4d1
+    iinc 1
+    jump 0x4f9
+    iinc 1
+    jump 0x4e1
+    iinc 1
+    jump 0x509
+    iinc 1
+    jump 0x4f1
+    iinc 1
+    jump 0x519
+    iinc 1
+    jump 0x501
+    iinc 1
+    jump 0x529
+    iinc 1
+    jump 0x511
+    iinc 1
+    jump 0x539
+    iinc 1
+    jump 0x521
+    iinc 1
+    jump 0x549
+    iinc 1
+    jump 0x531
+    iinc 1
+    jump 0x559
+    iinc 1
+    jump 0x541
+    iinc 1
+    jump 0x569
+    iinc 1
+    jump 0x551
+    iinc 1
+    jump 0x579
+    iinc 1
+    jump 0x561
+    iinc 1
+    jump 0x589
+    iinc 1
+    jump 0x571
+    iinc 1
+    jump 0x599
+    iinc 1
+    jump 0x581
+    iinc 1
+    jump 0x5a9
+    iinc 1
+    jump 0x591
+    iinc 1
+    jump 0x5b9
+    iinc 1
+    jump 0x5a1
+    iinc 1
+    jump 0x5c9
+    iinc 1
+    jump 0x5b1
+    iinc 1
+    jump 0x5d9
+    iinc 1
+    jump 0x5c1
+    iinc 1
+    jump 0x5e9
+    iinc 1
+    jump 0x5d1
+    iinc 1
+    jump 0x5f9
+    iinc 1
+    jump 0x5e1
+    iinc 1
+    jump 0x609
+    iinc 1
+    jump 0x5f1
+    iinc 1
+    jump 0x619
+    iinc 1
+    jump 0x601
+    iinc 1
+    jump 0x629
+    iinc 1
+    jump 0x611
+    iinc 1
+    jump 0x639
+    iinc 1
+    jump 0x621
+    iinc 1
+    jump 0x649
+    iinc 1
+    jump 0x631
+    iinc 1
+    jump 0x659
+    iinc 1
+    jump 0x641
+    iinc 1
+    jump 0x669
+    iinc 1
+    jump 0x651
+    iinc 1
+    jump 0x679
+    iinc 1
+    jump 0x661
+    iinc 1
+    jump 0x689
+    iinc 1
+    jump 0x671
+    iinc 1
+    jump 0x699
+    iinc 1
+    jump 0x681
+    iinc 1
+    jump 0x6a9
+    iinc 1
+    jump 0x691
+    iinc 1
+    jump 0x6b9
+    iinc 1
+    jump 0x6a1
+    iinc 1
+    jump 0x6c9
+    iinc 1
+    jump 0x6b1
+    iinc 1
+    jump 0x6d9
+    iinc 1
+    jump 0x6c1
+    iinc 1
+    jump 0x6e9
+    iinc 1
+    jump 0x6d1
+    iinc 1
+    jump 0x6f9
+    iinc 1
+    jump 0x6e1
+    iinc 1
+    jump 0x709
+    iinc 1
+    jump 0x6f1
+    iinc 1
+    jump 0x719
+    iinc 1
+    jump 0x701
+    iinc 1
+    jump 0x729
+    iinc 1
+    jump 0x711
+    iinc 1
+    jump 0x739
+    iinc 1
+    jump 0x721
+    iinc 1
+    jump 0x749
+    iinc 1
+    jump 0x731
+    iinc 1
+    jump 0x759
+    iinc 1
+    jump 0x741
+    iinc 1
+    jump 0x769
+    iinc 1
+    jump 0x751
+    iinc 1
+    jump 0x779
+    iinc 1
+    jump 0x761
+    iinc 1
+    jump 0x789
+    iinc 1
+    jump 0x771
+    iinc 1
+    jump 0x799
+    iinc 1
+    jump 0x781
+    iinc 1
+    jump 0x7a9
+    iinc 1
+    jump 0x791
+    iinc 1
+    jump 0x7b9
+    iinc 1
+    jump 0x7a1
+    iinc 1
+    jump 0x7c9
+    iinc 1
+    jump 0x7b1
+    iinc 1
+    jump 0x7d9
+    iinc 1
+    jump 0x7c1
+    iinc 1
+    jump 0x7e9
+    iinc 1
+    jump 0x7d1
+    iinc 1
+    jump 0x7f9
+    iinc 1
+    jump 0x7e1
+    iinc 1
+    jump 0x809
+    iinc 1
+    jump 0x7f1
+    iinc 1
+    jump 0x819
+    iinc 1
+    jump 0x801
+    iinc 1
+    jump 0x829
+    iinc 1
+    jump 0x811
+    iinc 1
+    jump 0x839
+    iinc 1
+    jump 0x821
+    iinc 1
+    jump 0x849
+    iinc 1
+    jump 0x831
+    iinc 1
+    jump 0x859
+    iinc 1
+    jump 0x841
+    iinc 1
+    jump 0x869
+    iinc 1
+    jump 0x851
+    iinc 1
+    jump 0x879
+    iinc 1
+    jump 0x861
+    iinc 1
+    jump 0x889
+    iinc 1
+    jump 0x871
+    iinc 1
+    jump 0x899
+    iinc 1
+    jump 0x881
+    iinc 1
+    jump 0x8a9
+    iinc 1
+    jump 0x891
+    iinc 1
+    jump 0x8b9
+    iinc 1
+    jump 0x8a1
+    iinc 1
+    jump 0x8c9
+    iinc 1
+    jump 0x8b1
+    iinc 1
+    jump 0x8d9
+    iinc 1
+    jump 0x8c1
+    iinc 1
+    jump 0x8e9
+    iinc 1
+    jump 0x8d1
+    iinc 1
+    jump 0x8f9
+    iinc 1
+    jump 0x8e1
+    iinc 1
+    jump 0x909
+    iinc 1
+    jump 0x8f1
+    iinc 1
+    jump 0x919
+    iinc 1
+    jump 0x901
+    iinc 1
+    jump 0x929
+    iinc 1
+    jump 0x911
+    iinc 1
+    jump 0x939
+    iinc 1
+    jump 0x921
+    iinc 1
+    jump 0x949
+    iinc 1
+    jump 0x931
+    iinc 1
+    jump 0x959
+    iinc 1
+    jump 0x941
+    iinc 1
+    jump 0x969
+    iinc 1
+    jump 0x951
+    iinc 1
+    jump 0x979
+    iinc 1
+    jump 0x961
+    iinc 1
+    jump 0x989
+    iinc 1
+    jump 0x971
+    iinc 1
+    jump 0x999
+    iinc 1
+    jump 0x981
+    iinc 1
+    jump 0x9a9
+    iinc 1
+    jump 0x991
+    iinc 1
+    jump 0x9b9
+    iinc 1
+    jump 0x9a1
+    iinc 1
+    jump 0x9c9
+    iinc 1
+    jump 0x9b1
+    iinc 1
+    jump 0x9d9
+    iinc 1
+    jump 0x9c1
+    iinc 1
+    jump 0x9e9
+    iinc 1
+    jump 0x9d1
+    iinc 1
+    jump 0x9f9
+    iinc 1
+    jump 0x9e1
+    iinc 1
+    jump 0xa09
+    iinc 1
+    jump 0x9f1
+    iinc 1
+    jump 0xa19
+    iinc 1
+    jump 0xa01
+    iinc 1
+    jump 0xa29
+    iinc 1
+    jump 0xa11
+    iinc 1
+    jump 0xa39
+    iinc 1
+    jump 0xa21
+    iinc 1
+    jump 0xa49
+    iinc 1
+    jump 0xa31
+    iinc 1
+    jump 0xa59
+    iinc 1
+    jump 0xa41
+    iinc 1
+    jump 0xa69
+    iinc 1
+    jump 0xa51
+    iinc 1
+    jump 0xa79
+    iinc 1
+    jump 0xa61
+    iinc 1
+    jump 0xa89
+    iinc 1
+    jump 0xa71
+    iinc 1
+    jump 0xa99
+    iinc 1
+    jump 0xa81
+    iinc 1
+    jump 0xaa9
+    iinc 1
+    jump 0xa91
+    iinc 1
+    jump 0xab9
+    iinc 1
+    jump 0xaa1
+    iinc 1
+    jump 0xac9
+    iinc 1
+    jump 0xab1
+    iinc 1
+    jump 0xad9
+    iinc 1
+    jump 0xac1
+    iinc 1
+    jump 0xae9
+    iinc 1
+    jump 0xad1
+    iinc 1
+    jump 0xaf9
+    iinc 1
+    jump 0xae1
+    iinc 1
+    jump 0xb09
+    iinc 1
+    jump 0xaf1
+    iinc 1
+    jump 0xb19
+    iinc 1
+    jump 0xb01
+    iinc 1
+    jump 0xb29
+    iinc 1
+    jump 0xb11
+    iinc 1
+    jump 0xb39
+    iinc 1
+    jump 0xb21
+    iinc 1
+    jump 0xb49
+    iinc 1
+    jump 0xb31
+    iinc 1
+    jump 0xb59
+    iinc 1
+    jump 0xb41
+    iinc 1
+    jump 0xb69
+    iinc 1
+    jump 0xb51
+    iinc 1
+    jump 0xb79
+    iinc 1
+    jump 0xb61
+    iinc 1
+    jump 0xb89
+    iinc 1
+    jump 0xb71
+    iinc 1
+    jump 0xb99
+    iinc 1
+    jump 0xb81
+    iinc 1
+    jump 0xba9
+    iinc 1
+    jump 0xb91
+    iinc 1
+    jump 0xbb9
+    iinc 1
+    jump 0xba1
+    iinc 1
+    jump 0xbc9
+    iinc 1
+    jump 0xbb1
+    iinc 1
+    jump 0xbd9
+    iinc 1
+    jump 0xbc1
+    iinc 1
+    jump 0xbe9
+    iinc 1
+    jump 0xbd1
+    iinc 1
+    jump 0xbf9
+    iinc 1
+    jump 0xbe1
+    iinc 1
+    jump 0xc09
+    iinc 1
+    jump 0xbf1
+    iinc 1
+    jump 0xc19
+    iinc 1
+    jump 0xc01
+    iinc 1
+    jump 0xc29
+    iinc 1
+    jump 0xc11
+    iinc 1
+    jump 0xc39
+    iinc 1
+    jump 0xc21
+    iinc 1
+    jump 0xc49
+    iinc 1
+    jump 0xc31
+    iinc 1
+    jump 0xc59
+    iinc 1
+    jump 0xc41
+    iinc 1
+    jump 0xc69
+    iinc 1
+    jump 0xc51
+    iinc 1
+    jump 0xc79
+    iinc 1
+    jump 0xc61
+    iinc 1
+    jump 0xc89
+    iinc 1
+    jump 0xc71
+    iinc 1
+    jump 0xc99
+    iinc 1
+    jump 0xc81
+    iinc 1
+    jump 0xca9
+    iinc 1
+    jump 0xc91
+    iinc 1
+    jump 0xcb9
+    iinc 1
+    jump 0xca1
+    iinc 1
+    jump 0xcc9
+    iinc 1
+    jump 0xcb1
+    iinc 1
+    jump 0xcd9
+    iinc 1
+    jump 0xcc1
+    iinc 1
+    jump 0xce9
+    iinc 1
+    jump 0xcd1
+    iinc 1
+    jump 0xcf9
+    iinc 1
+    jump 0xce1
+    iinc 1
+    jump 0xd09
+    iinc 1
+    jump 0xcf1
+    iinc 1
+    jump 0xd19
+    iinc 1
+    jump 0xd01
+    iinc 1
+    jump 0xd29
+    iinc 1
+    jump 0xd11
+    iinc 1
+    jump 0xd39
+    iinc 1
+    jump 0xd21
+    iinc 1
+    jump 0xd49
+    iinc 1
+    jump 0xd31
+    iinc 1
+    jump 0xd59
+    iinc 1
+    jump 0xd41
+    iinc 1
+    jump 0xd69
+    iinc 1
+    jump 0xd51
+    iinc 1
+    jump 0xd79
+    iinc 1
+    jump 0xd61
+    iinc 1
+    jump 0xd89
+    iinc 1
+    jump 0xd71
+    iinc 1
+    jump 0xd99
+    iinc 1
+    jump 0xd81
+    iinc 1
+    jump 0xda9
+    iinc 1
+    jump 0xd91
+    iinc 1
+    jump 0xdb9
+    iinc 1
+    jump 0xda1
+    iinc 1
+    jump 0xdc9
+    iinc 1
+    jump 0xdb1
+    iinc 1
+    jump 0xdd9
+    iinc 1
+    jump 0xdc1
+    iinc 1
+    jump 0xde9
+    iinc 1
+    jump 0xdd1
+    iinc 1
+    jump 0xdf9
+    iinc 1
+    jump 0xde1
+    iinc 1
+    jump 0xe09
+    iinc 1
+    jump 0xdf1
+    iinc 1
+    jump 0xe19
+    iinc 1
+    jump 0xe01
+    iinc 1
+    jump 0xe29
+    iinc 1
+    jump 0xe11
+    iinc 1
+    jump 0xe39
+    iinc 1
+    jump 0xe21
+    iinc 1
+    jump 0xe49
+    iinc 1
+    jump 0xe31
+    iinc 1
+    jump 0xe59
+    iinc 1
+    jump 0xe41
+    iinc 1
+    jump 0xe69
+    iinc 1
+    jump 0xe51
+    iinc 1
+    jump 0xe79
+    iinc 1
+    jump 0xe61
+    iinc 1
+    jump 0xe89
+    iinc 1
+    jump 0xe71
+    iinc 1
+    jump 0xe99
+    iinc 1
+    jump 0xe81
+    iinc 1
+    jump 0xea9
+    iinc 1
+    jump 0xe91
+    iinc 1
+    jump 0xeb9
+    iinc 1
+    jump 0xea1
+    iinc 1
+    jump 0xec9
+    iinc 1
+    jump 0xeb1
+    iinc 1
+    jump 0xed9
+    iinc 1
+    jump 0xec1
+    iinc 1
+    jump 0xee9
+    iinc 1
+    jump 0xed1
+    iinc 1
+    jump 0xef9
+    iinc 1
+    jump 0xee1
+    iinc 1
+    jump 0xf09
+    iinc 1
+    jump 0xef1
+    iinc 1
+    jump 0xf19
+    iinc 1
+    jump 0xf01
+    iinc 1
+    jump 0xf29
+    iinc 1
+    jump 0xf11
+    iinc 1
+    jump 0xf39
+    iinc 1
+    jump 0xf21
+    iinc 1
+    jump 0xf49
+    iinc 1
+    jump 0xf31
+    iinc 1
+    jump 0xf59
+    iinc 1
+    jump 0xf41
+    iinc 1
+    jump 0xf69
+    iinc 1
+    jump 0xf51
+    iinc 1
+    jump 0xf79
+    iinc 1
+    jump 0xf61
+    iinc 1
+    jump 0xf89
+    iinc 1
+    jump 0xf71
+    iinc 1
+    jump 0xf99
+    iinc 1
+    jump 0xf81
+    iinc 1
+    jump 0xfa9
+    iinc 1
+    jump 0xf91
+    iinc 1
+    jump 0xfb9
+    iinc 1
+    jump 0xfa1
+    iinc 1
+    jump 0xfc9
+    iinc 1
+    jump 0xfb1
+    iinc 1
+    jump 0xfd9
+    iinc 1
+    jump 0xfc1
+    iinc 1
+    jump 0xfe9
+    iinc 1
+    jump 0xfd1
+    iinc 1
+    jump 0xff9
+    iinc 1
+    jump 0xfe1
+    iinc 1
+    jump 0x1009
+    iinc 1
+    jump 0xff1
+    iinc 1
+    jump 0x1019
+    iinc 1
+    jump 0x1001
+    iinc 1
+    jump 0x1029
+    iinc 1
+    jump 0x1011
+    iinc 1
+    jump 0x1039
+    iinc 1
+    jump 0x1021
+    iinc 1
+    jump 0x1049
+    iinc 1
+    jump 0x1031
+    iinc 1
+    jump 0x1059
+    iinc 1
+    jump 0x1041
+    iinc 1
+    jump 0x1069
+    iinc 1
+    jump 0x1051
+    iinc 1
+    jump 0x1079
+    iinc 1
+    jump 0x1061
+    iinc 1
+    jump 0x1089
+    iinc 1
+    jump 0x1071
+    iinc 1
+    jump 0x1099
+    iinc 1
+    jump 0x1081
+    iinc 1
+    jump 0x10a9
+    iinc 1
+    jump 0x1091
+    iinc 1
+    jump 0x10b9
+    iinc 1
+    jump 0x10a1
+    iinc 1
+    jump 0x10c9
+    iinc 1
+    jump 0x10b1
+    iinc 1
+    jump 0x10d9
+    iinc 1
+    jump 0x10c1
+    iinc 1
+    jump 0x10e9
+    iinc 1
+    jump 0x10d1
+    iinc 1
+    jump 0x10f9
+    iinc 1
+    jump 0x10e1
+    iinc 1
+    jump 0x1109
+    iinc 1
+    jump 0x10f1
+    iinc 1
+    jump 0x1119
+    iinc 1
+    jump 0x1101
+    iinc 1
+    jump 0x1129
+    iinc 1
+    jump 0x1111
+    iinc 1
+    jump 0x1139
+    iinc 1
+    jump 0x1121
+    iinc 1
+    jump 0x1149
+    iinc 1
+    jump 0x1131
+    iinc 1
+    jump 0x1159
+    iinc 1
+    jump 0x1141
+    iinc 1
+    jump 0x1169
+    iinc 1
+    jump 0x1151
+    iinc 1
+    jump 0x1179
+    iinc 1
+    jump 0x1161
+    iinc 1
+    jump 0x1189
+    iinc 1
+    jump 0x1171
+    iinc 1
+    jump 0x1199
+    iinc 1
+    jump 0x1181
+    iinc 1
+    jump 0x11a9
+    iinc 1
+    jump 0x1191
+    iinc 1
+    jump 0x11b9
+    iinc 1
+    jump 0x11a1
+    iinc 1
+    jump 0x11c9
+    iinc 1
+    jump 0x11b1
+    iinc 1
+    jump 0x11d9
+    iinc 1
+    jump 0x11c1
+    iinc 1
+    jump 0x11e9
+    iinc 1
+    jump 0x11d1
+    iinc 1
+    jump 0x11f9
+    iinc 1
+    jump 0x11e1
+    iinc 1
+    jump 0x1209
+    iinc 1
+    jump 0x11f1
+    iinc 1
+    jump 0x1219
+    iinc 1
+    jump 0x1201
+    iinc 1
+    jump 0x1229
+    iinc 1
+    jump 0x1211
+    iinc 1
+    jump 0x1239
+    iinc 1
+    jump 0x1221
+    iinc 1
+    jump 0x1249
+    iinc 1
+    jump 0x1231
+    iinc 1
+    jump 0x1259
+    iinc 1
+    jump 0x1241
+    iinc 1
+    jump 0x1269
+    iinc 1
+    jump 0x1251
+    iinc 1
+    jump 0x1279
+    iinc 1
+    jump 0x1261
+    iinc 1
+    jump 0x1289
+    iinc 1
+    jump 0x1271
+    iinc 1
+    jump 0x1299
+    iinc 1
+    jump 0x1281
+    iinc 1
+    jump 0x12a9
+    iinc 1
+    jump 0x1291
+    iinc 1
+    jump 0x12b9
+    iinc 1
+    jump 0x12a1
+    iinc 1
+    jump 0x12c9
+    iinc 1
+    jump 0x12b1
+    iinc 1
+    jump 0x12d9
+    iinc 1
+    jump 0x12c1
+    iinc 1
+    jump 0x12e9
+    iinc 1
+    jump 0x12d1
+    iinc 1
+    jump 0x12f9
+    iinc 1
+    jump 0x12e1
+    iinc 1
+    jump 0x1309
+    iinc 1
+    jump 0x12f1
+    iinc 1
+    jump 0x1319
+    iinc 1
+    jump 0x1301
+    iinc 1
+    jump 0x1329
+    iinc 1
+    jump 0x1311
+    iinc 1
+    jump 0x1339
+    iinc 1
+    jump 0x1321
+    iinc 1
+    jump 0x1349
+    iinc 1
+    jump 0x1331
+    iinc 1
+    jump 0x1359
+    iinc 1
+    jump 0x1341
+    iinc 1
+    jump 0x1369
+    iinc 1
+    jump 0x1351
+    iinc 1
+    jump 0x1379
+    iinc 1
+    jump 0x1361
+    iinc 1
+    jump 0x1389
+    iinc 1
+    jump 0x1371
+    iinc 1
+    jump 0x1399
+    iinc 1
+    jump 0x1381
+    iinc 1
+    jump 0x13a9
+    iinc 1
+    jump 0x1391
+    iinc 1
+    jump 0x13b9
+    iinc 1
+    jump 0x13a1
+    iinc 1
+    jump 0x13c9
+    iinc 1
+    jump 0x13b1
+    iinc 1
+    jump 0x13d9
+    iinc 1
+    jump 0x13c1
+    iinc 1
+    jump 0x13e9
+    iinc 1
+    jump 0x13d1
+    iinc 1
+    jump 0x13f9
+    iinc 1
+    jump 0x13e1
+    iinc 1
+    jump 0x1409
+    iinc 1
+    jump 0x13f1
+    iinc 1
+    jump 0x1419
+    iinc 1
+    jump 0x1401
+    iinc 1
+    jump 0x1429
+    iinc 1
+    jump 0x1411
+    iinc 1
+    jump 0x1439
+    iinc 1
+    jump 0x1421
+    iinc 1
+    jump 0x1449
+    iinc 1
+    jump 0x1431
+    iinc 1
+    jump 0x1459
+    iinc 1
+    jump 0x1441
+    iinc 1
+    jump 0x1469
+    iinc 1
+    jump 0x1451
+    iinc 1
+    jump 0x1479
+    iinc 1
+    jump 0x1461
+    iinc 1
+    jump 0x1489
+    iinc 1
+    jump 0x1471
+    iinc 1
+    jump 0x1499
+    iinc 1
+    jump 0x1481
+    iinc 1
+    jump 0x14a9
+    iinc 1
+    jump 0x1491
+    iinc 1
+    jump 0x14b9
+    iinc 1
+    jump 0x14a1
+    iinc 1
+    jump 0x14c9
+    iinc 1
+    jump 0x14b1
+    iinc 1
+    jump 0x14d9
+    iinc 1
+    jump 0x14c1
+    iinc 1
+    jump 0x14e9
+    iinc 1
+    jump 0x14d1
+    iinc 1
+    jump 0x14f9
+    iinc 1
+    jump 0x14e1
+    iinc 1
+    jump 0x1509
+    iinc 1
+    jump 0x14f1
+    iinc 1
+    jump 0x1519
+    iinc 1
+    jump 0x1501
+    iinc 1
+    jump 0x1529
+    iinc 1
+    jump 0x1511
+    iinc 1
+    jump 0x1539
+    iinc 1
+    jump 0x1521
+    iinc 1
+    jump 0x1549
+    iinc 1
+    jump 0x1531
+    iinc 1
+    jump 0x1559
+    iinc 1
+    jump 0x1541
+    iinc 1
+    jump 0x1569
+    iinc 1
+    jump 0x1551
+    iinc 1
+    jump 0x1579
+    iinc 1
+    jump 0x1561
+    iinc 1
+    jump 0x1589
+    iinc 1
+    jump 0x1571
+    iinc 1
+    jump 0x1599
+    iinc 1
+    jump 0x1581
+    iinc 1
+    jump 0x15a9
+    iinc 1
+    jump 0x1591
+    iinc 1
+    jump 0x15b9
+    iinc 1
+    jump 0x15a1
+    iinc 1
+    jump 0x15c9
+    iinc 1
+    jump 0x15b1
+    iinc 1
+    jump 0x15d9
+    iinc 1
+    jump 0x15c1
+    iinc 1
+    jump 0x15e9
+    iinc 1
+    jump 0x15d1
+    iinc 1
+    jump 0x15f9
+    iinc 1
+    jump 0x15e1
+    iinc 1
+    jump 0x1609
+    iinc 1
+    jump 0x15f1
+    iinc 1
+    jump 0x1619
+    iinc 1
+    jump 0x1601
+    iinc 1
+    jump 0x1629
+    iinc 1
+    jump 0x1611
+    iinc 1
+    jump 0x1639
+    iinc 1
+    jump 0x1621
+    iinc 1
+    jump 0x1649
+    iinc 1
+    jump 0x1631
+    iinc 1
+    jump 0x1659
+    iinc 1
+    jump 0x1641
+    iinc 1
+    jump 0x1669
+    iinc 1
+    jump 0x1651
+    iinc 1
+    jump 0x1679
+    iinc 1
+    jump 0x1661
+    iinc 1
+    jump 0x1689
+    iinc 1
+    jump 0x1671
+    iinc 1
+    jump 0x1699
+    iinc 1
+    jump 0x1681
+    iinc 1
+    jump 0x16a9
+    iinc 1
+    jump 0x1691
+    iinc 1
+    jump 0x16b9
+    iinc 1
+    jump 0x16a1
+    iinc 1
+    jump 0x16c9
+    iinc 1
+    jump 0x16b1
+    iinc 1
+    jump 0x16d9
+    iinc 1
+    jump 0x16c1
+    iinc 1
+    jump 0x16e9
+    iinc 1
+    jump 0x16d1
+    iinc 1
+    jump 0x16f9
+    iinc 1
+    jump 0x16e1
+    iinc 1
+    jump 0x1709
+    iinc 1
+    jump 0x16f1
+    iinc 1
+    jump 0x1719
+    iinc 1
+    jump 0x1701
+    iinc 1
+    jump 0x1729
+    iinc 1
+    jump 0x1711
+    iinc 1
+    jump 0x1739
+    iinc 1
+    jump 0x1721
+    iinc 1
+    jump 0x1749
+    iinc 1
+    jump 0x1731
+    iinc 1
+    jump 0x1759
+    iinc 1
+    jump 0x1741
+    iinc 1
+    jump 0x1769
+    iinc 1
+    jump 0x1751
+    iinc 1
+    jump 0x1779
+    iinc 1
+    jump 0x1761
+    iinc 1
+    jump 0x1789
+    iinc 1
+    jump 0x1771
+    iinc 1
+    jump 0x1799
+    iinc 1
+    jump 0x1781
+    iinc 1
+    jump 0x17a9
+    iinc 1
+    jump 0x1791
+    iinc 1
+    jump 0x17b9
+    iinc 1
+    jump 0x17a1
+    iinc 1
+    jump 0x17c9
+    iinc 1
+    jump 0x17b1
+    iinc 1
+    jump 0x17d9
+    iinc 1
+    jump 0x17c1
+    iinc 1
+    jump 0x17e9
+    iinc 1
+    jump 0x17d1
+    iinc 1
+    jump 0x17f9
+    iinc 1
+    jump 0x17e1
+    iinc 1
+    jump 0x1809
+    iinc 1
+    jump 0x17f1
+    iinc 1
+    jump 0x1819
+    iinc 1
+    jump 0x1801
+    iinc 1
+    jump 0x1829
+    iinc 1
+    jump 0x1811
+    iinc 1
+    jump 0x1839
+    iinc 1
+    jump 0x1821
+    iinc 1
+    jump 0x1849
+    iinc 1
+    jump 0x1831
+    iinc 1
+    jump 0x1859
+    iinc 1
+    jump 0x1841
+    iinc 1
+    jump 0x1869
+    iinc 1
+    jump 0x1851
+    iinc 1
+    jump 0x1879
+    iinc 1
+    jump 0x1861
+    iinc 1
+    jump 0x1889
+    iinc 1
+    jump 0x1871
+    iinc 1
+    jump 0x1899
+    iinc 1
+    jump 0x1881
+    iinc 1
+    jump 0x18a9
+    iinc 1
+    jump 0x1891
+    iinc 1
+    jump 0x18b9
+    iinc 1
+    jump 0x18a1
+    iinc 1
+    jump 0x18c9
+    iinc 1
+    jump 0x18b1
+    iinc 1
+    jump 0x18d9
+    iinc 1
+    jump 0x18c1
+    iinc 1
+    jump 0x18e9
+    iinc 1
+    jump 0x18d1
+    iinc 1
+    jump 0x18f9
+    iinc 1
+    jump 0x18e1
+    iinc 1
+    jump 0x1909
+    iinc 1
+    jump 0x18f1
+    iinc 1
+    jump 0x1919
+    iinc 1
+    jump 0x1901
+    iinc 1
+    jump 0x1929
+    iinc 1
+    jump 0x1911
+    iinc 1
+    jump 0x1939
+    iinc 1
+    jump 0x1921
+    iinc 1
+    jump 0x1949
+    iinc 1
+    jump 0x1931
+    iinc 1
+    jump 0x1959
+    iinc 1
+    jump 0x1941
+    iinc 1
+    jump 0x1969
+    iinc 1
+    jump 0x1951
+    iinc 1
+    jump 0x1979
+    iinc 1
+    jump 0x1961
+    iinc 1
+    jump 0x1989
+    iinc 1
+    jump 0x1971
+    iinc 1
+    jump 0x1999
+    iinc 1
+    jump 0x1981
+    iinc 1
+    jump 0x19a9
+    iinc 1
+    jump 0x1991
+    iinc 1
+    jump 0x19b9
+    iinc 1
+    jump 0x19a1
+    iinc 1
+    jump 0x19c9
+    iinc 1
+    jump 0x19b1
+    iinc 1
+    jump 0x19d9
+    iinc 1
+    jump 0x19c1
+    iinc 1
+    jump 0x19e9
+    iinc 1
+    jump 0x19d1
+    iinc 1
+    jump 0x19f9
+    iinc 1
+    jump 0x19e1
+    iinc 1
+    jump 0x1a09
+    iinc 1
+    jump 0x19f1
+    iinc 1
+    jump 0x1a19
+    iinc 1
+    jump 0x1a01
+    iinc 1
+    jump 0x1a29
+    iinc 1
+    jump 0x1a11
+    iinc 1
+    jump 0x1a39
+    iinc 1
+    jump 0x1a21
+    iinc 1
+    jump 0x1a49
+    iinc 1
+    jump 0x1a31
+    iinc 1
+    jump 0x1a59
+    iinc 1
+    jump 0x1a41
+    iinc 1
+    jump 0x1a69
+    iinc 1
+    jump 0x1a51
+    iinc 1
+    jump 0x1a79
+    iinc 1
+    jump 0x1a61
+    iinc 1
+    jump 0x1a89
+    iinc 1
+    jump 0x1a71
+    iinc 1
+    jump 0x1a99
+    iinc 1
+    jump 0x1a81
+    iinc 1
+    jump 0x1aa9
+    iinc 1
+    jump 0x1a91
+    iinc 1
+    jump 0x1ab9
+    iinc 1
+    jump 0x1aa1
+    iinc 1
+    jump 0x1ac9
+    iinc 1
+    jump 0x1ab1
+    iinc 1
+    jump 0x1ad9
+    iinc 1
+    jump 0x1ac1
+    iinc 1
+    jump 0x1ae9
+    iinc 1
+    jump 0x1ad1
+    iinc 1
+    jump 0x1af9
+    iinc 1
+    jump 0x1ae1
+    iinc 1
+    jump 0x1b09
+    iinc 1
+    jump 0x1af1
+    iinc 1
+    jump 0x1b19
+    iinc 1
+    jump 0x1b01
+    iinc 1
+    jump 0x1b29
+    iinc 1
+    jump 0x1b11
+    iinc 1
+    jump 0x1b39
+    iinc 1
+    jump 0x1b21
+    iinc 1
+    jump 0x1b49
+    iinc 1
+    jump 0x1b31
+    iinc 1
+    jump 0x1b59
+    iinc 1
+    jump 0x1b41
+    iinc 1
+    jump 0x1b69
+    iinc 1
+    jump 0x1b51
+    iinc 1
+    jump 0x1b79
+    iinc 1
+    jump 0x1b61
+    iinc 1
+    jump 0x1b89
+    iinc 1
+    jump 0x1b71
+    iinc 1
+    jump 0x1b99
+    iinc 1
+    jump 0x1b81
+    iinc 1
+    jump 0x1ba9
+    iinc 1
+    jump 0x1b91
+    iinc 1
+    jump 0x1bb9
+    iinc 1
+    jump 0x1ba1
+    iinc 1
+    jump 0x1bc9
+    iinc 1
+    jump 0x1bb1
+    iinc 1
+    jump 0x1bd9
+    iinc 1
+    jump 0x1bc1
+    iinc 1
+    jump 0x1be9
+    iinc 1
+    jump 0x1bd1
+    iinc 1
+    jump 0x1bf9
+    iinc 1
+    jump 0x1be1
+    iinc 1
+    jump 0x1c09
+    iinc 1
+    jump 0x1bf1
+    iinc 1
+    jump 0x1c19
+    iinc 1
+    jump 0x1c01
+    iinc 1
+    jump 0x1c29
+    iinc 1
+    jump 0x1c11
+    iinc 1
+    jump 0x1c39
+    iinc 1
+    jump 0x1c21
+    iinc 1
+    jump 0x1c49
+    iinc 1
+    jump 0x1c31
+    iinc 1
+    jump 0x1c59
+    iinc 1
+    jump 0x1c41
+    iinc 1
+    jump 0x1c69
+    iinc 1
+    jump 0x1c51
+    iinc 1
+    jump 0x1c79
+    iinc 1
+    jump 0x1c61
+    iinc 1
+    jump 0x1c89
+    iinc 1
+    jump 0x1c71
+    iinc 1
+    jump 0x1c99
+    iinc 1
+    jump 0x1c81
+    iinc 1
+    jump 0x1ca9
+    iinc 1
+    jump 0x1c91
+    iinc 1
+    jump 0x1cb9
+    iinc 1
+    jump 0x1ca1
+    iinc 1
+    jump 0x1cc9
+    iinc 1
+    jump 0x1cb1
+    iinc 1
+    jump 0x1cd9
+    iinc 1
+    jump 0x1cc1
+    iinc 1
+    jump 0x1ce9
+    iinc 1
+    jump 0x1cd1
+    iinc 1
+    jump 0x1cf9
+    iinc 1
+    jump 0x1ce1
+    iinc 1
+    jump 0x1d09
+    iinc 1
+    jump 0x1cf1
+    iinc 1
+    jump 0x1d19
+    iinc 1
+    jump 0x1d01
+    iinc 1
+    jump 0x1d29
+    iinc 1
+    jump 0x1d11
+    iinc 1
+    jump 0x1d39
+    iinc 1
+    jump 0x1d21
+    iinc 1
+    jump 0x1d49
+    iinc 1
+    jump 0x1d31
+    iinc 1
+    jump 0x1d59
+    iinc 1
+    jump 0x1d41
+    iinc 1
+    jump 0x1d69
+    iinc 1
+    jump 0x1d51
+    iinc 1
+    jump 0x1d79
+    iinc 1
+    jump 0x1d61
+    iinc 1
+    jump 0x1d89
+    iinc 1
+    jump 0x1d71
+    iinc 1
+    jump 0x1d99
+    iinc 1
+    jump 0x1d81
+    iinc 1
+    jump 0x1da9
+    iinc 1
+    jump 0x1d91
+    iinc 1
+    jump 0x1db9
+    iinc 1
+    jump 0x1da1
+    iinc 1
+    jump 0x1dc9
+    iinc 1
+    jump 0x1db1
+    iinc 1
+    jump 0x1dd9
+    iinc 1
+    jump 0x1dc1
+    iinc 1
+    jump 0x1de9
+    iinc 1
+    jump 0x1dd1
+    iinc 1
+    jump 0x1df9
+    iinc 1
+    jump 0x1de1
+    iinc 1
+    jump 0x1e09
+    iinc 1
+    jump 0x1df1
+    iinc 1
+    jump 0x1e19
+    iinc 1
+    jump 0x1e01
+    iinc 1
+    jump 0x1e29
+    iinc 1
+    jump 0x1e11
+    iinc 1
+    jump 0x1e39
+    iinc 1
+    jump 0x1e21
+    iinc 1
+    jump 0x1e49
+    iinc 1
+    jump 0x1e31
+    iinc 1
+    jump 0x1e59
+    iinc 1
+    jump 0x1e41
+    iinc 1
+    jump 0x1e69
+    iinc 1
+    jump 0x1e51
+    iinc 1
+    jump 0x1e79
+    iinc 1
+    jump 0x1e61
+    iinc 1
+    jump 0x1e89
+    iinc 1
+    jump 0x1e71
+    iinc 1
+    jump 0x1e99
+    iinc 1
+    jump 0x1e81
+    iinc 1
+    jump 0x1ea9
+    iinc 1
+    jump 0x1e91
+    iinc 1
+    jump 0x1eb9
+    iinc 1
+    jump 0x1ea1
+    iinc 1
+    jump 0x1ec9
+    iinc 1
+    jump 0x1eb1
+    iinc 1
+    jump 0x1ed9
+    iinc 1
+    jump 0x1ec1
+    iinc 1
+    jump 0x1ee9
+    iinc 1
+    jump 0x1ed1
+    iinc 1
+    jump 0x1ef9
+    iinc 1
+    jump 0x1ee1
+    iinc 1
+    jump 0x1f09
+    iinc 1
+    jump 0x1ef1
+    iinc 1
+    jump 0x1f19
+    iinc 1
+    jump 0x1f01
+    iinc 1
+    jump 0x1f29
+    iinc 1
+    jump 0x1f11
+    iinc 1
+    jump 0x1f39
+    iinc 1
+    jump 0x1f21
+    iinc 1
+    jump 0x1f49
+    iinc 1
+    jump 0x1f31
+    iinc 1
+    jump 0x1f59
+    iinc 1
+    jump 0x1f41
+    iinc 1
+    jump 0x1f69
+    iinc 1
+    jump 0x1f51
+    iinc 1
+    jump 0x1f79
+    iinc 1
+    jump 0x1f61
+    iinc 1
+    jump 0x1f89
+    iinc 1
+    jump 0x1f71
+    iinc 1
+    jump 0x1f99
+    iinc 1
+    jump 0x1f81
+    iinc 1
+    jump 0x1fa9
+    iinc 1
+    jump 0x1f91
+    iinc 1
+    jump 0x1fb9
+    iinc 1
+    jump 0x1fa1
+    iinc 1
+    jump 0x1fc9
+    iinc 1
+    jump 0x1fb1
+    iinc 1
+    jump 0x1fd9
+    iinc 1
+    jump 0x1fc1
+    iinc 1
+    jump 0x1fe9
+    iinc 1
+    jump 0x1fd1
+    iinc 1
+    jump 0x1ff9
+    iinc 1
+    jump 0x1fe1
+    iinc 1
+    jump 0x2009
+    iinc 1
+    jump 0x1ff1
+    iinc 1
+    jump 0x2019
+    iinc 1
+    jump 0x2001
+    iinc 1
+    jump 0x2029
+    iinc 1
+    jump 0x2011
+    iinc 1
+    jump 0x2039
+    iinc 1
+    jump 0x2021
+    iinc 1
+    jump 0x2049
+    iinc 1
+    jump 0x2031
+    iinc 1
+    jump 0x2059
+    iinc 1
+    jump 0x2041
+    iinc 1
+    jump 0x2069
+    iinc 1
+    jump 0x2051
+    iinc 1
+    jump 0x2079
+    iinc 1
+    jump 0x2061
+    iinc 1
+    jump 0x2089
+    iinc 1
+    jump 0x2071
+    iinc 1
+    jump 0x2099
+    iinc 1
+    jump 0x2081
+    iinc 1
+    jump 0x20a9
+    iinc 1
+    jump 0x2091
+    iinc 1
+    jump 0x20b9
+    iinc 1
+    jump 0x20a1
+    iinc 1
+    jump 0x20c9
+    iinc 1
+    jump 0x20b1
+    iinc 1
+    jump 0x20d9
+    iinc 1
+    jump 0x20c1
+    iinc 1
+    jump 0x20e9
+    iinc 1
+    jump 0x20d1
+    iinc 1
+    jump 0x20f9
+    iinc 1
+    jump 0x20e1
+    iinc 1
+    jump 0x2109
+    iinc 1
+    jump 0x20f1
+    iinc 1
+    jump 0x2119
+    iinc 1
+    jump 0x2101
+    iinc 1
+    jump 0x2129
+    iinc 1
+    jump 0x2111
+    iinc 1
+    jump 0x2139
+    iinc 1
+    jump 0x2121
+    iinc 1
+    jump 0x2149
+    iinc 1
+    jump 0x2131
+    iinc 1
+    jump 0x2159
+    iinc 1
+    jump 0x2141
+    iinc 1
+    jump 0x2169
+    iinc 1
+    jump 0x2151
+    iinc 1
+    jump 0x2179
+    iinc 1
+    jump 0x2161
+    iinc 1
+    jump 0x2189
+    iinc 1
+    jump 0x2171
+    iinc 1
+    jump 0x2199
+    iinc 1
+    jump 0x2181
+    iinc 1
+    jump 0x21a9
+    iinc 1
+    jump 0x2191
+    iinc 1
+    jump 0x21b9
+    iinc 1
+    jump 0x21a1
+    iinc 1
+    jump 0x21c9
+    iinc 1
+    jump 0x21b1
+    iinc 1
+    jump 0x21d9
+    iinc 1
+    jump 0x21c1
+    iinc 1
+    jump 0x21e9
+    iinc 1
+    jump 0x21d1
+    iinc 1
+    jump 0x21f9
+    iinc 1
+    jump 0x21e1
+    iinc 1
+    jump 0x2209
+    iinc 1
+    jump 0x21f1
+    iinc 1
+    jump 0x2219
+    iinc 1
+    jump 0x2201
+    iinc 1
+    jump 0x2229
+    iinc 1
+    jump 0x2211
+    iinc 1
+    jump 0x2239
+    iinc 1
+    jump 0x2221
+    iinc 1
+    jump 0x2249
+    iinc 1
+    jump 0x2231
+    iinc 1
+    jump 0x2259
+    iinc 1
+    jump 0x2241
+    iinc 1
+    jump 0x2269
+    iinc 1
+    jump 0x2251
+    iinc 1
+    jump 0x2279
+    iinc 1
+    jump 0x2261
+    iinc 1
+    jump 0x2289
+    iinc 1
+    jump 0x2271
+    iinc 1
+    jump 0x2299
+    iinc 1
+    jump 0x2281
+    iinc 1
+    jump 0x22a9
+    iinc 1
+    jump 0x2291
+    iinc 1
+    jump 0x22b9
+    iinc 1
+    jump 0x22a1
+    iinc 1
+    jump 0x22c9
+    iinc 1
+    jump 0x22b1
+    iinc 1
+    jump 0x22d9
+    iinc 1
+    jump 0x22c1
+    iinc 1
+    jump 0x22e9
+    iinc 1
+    jump 0x22d1
+    iinc 1
+    jump 0x22f9
+    iinc 1
+    jump 0x22e1
+    iinc 1
+    jump 0x2309
+    iinc 1
+    jump 0x22f1
+    iinc 1
+    jump 0x2319
+    iinc 1
+    jump 0x2301
+    iinc 1
+    jump 0x2329
+    iinc 1
+    jump 0x2311
+    iinc 1
+    jump 0x2339
+    iinc 1
+    jump 0x2321
+    iinc 1
+    jump 0x2349
+    iinc 1
+    jump 0x2331
+    iinc 1
+    jump 0x2359
+    iinc 1
+    jump 0x2341
+    iinc 1
+    jump 0x2369
+    iinc 1
+    jump 0x2351
+    iinc 1
+    jump 0x2379
+    iinc 1
+    jump 0x2361
+    iinc 1
+    jump 0x2389
+    iinc 1
+    jump 0x2371
+    iinc 1
+    jump 0x2399
+    iinc 1
+    jump 0x2381
+    iinc 1
+    jump 0x23a9
+    iinc 1
+    jump 0x2391
+    iinc 1
+    jump 0x23b9
+    iinc 1
+    jump 0x23a1
+    iinc 1
+    jump 0x23c9
+    iinc 1
+    jump 0x23b1
+    iinc 1
+    jump 0x23d9
+    iinc 1
+    jump 0x23c1
+    iinc 1
+    jump 0x23e9
+    iinc 1
+    jump 0x23d1
+    iinc 1
+    jump 0x23f9
+    iinc 1
+    jump 0x23e1
+    iinc 1
+    jump 0x2409
+    iinc 1
+    jump 0x23f1
+    iinc 1
+    jump 0x2419
+    iinc 1
+    jump 0x2401
+    iinc 1
+    jump 0x2429
+    iinc 1
+    jump 0x2411
+    iinc 1
+    jump 0x2439
+    iinc 1
+    jump 0x2421
+    iinc 1
+    jump 0x2449
+    iinc 1
+    jump 0x2431
+    iinc 1
+    jump 0x2459
+    iinc 1
+    jump 0x2441
+    iinc 1
+    jump 0x2469
+    iinc 1
+    jump 0x2451
+    iinc 1
+    jump 0x2479
+    iinc 1
+    jump 0x2461
+    iinc 1
+    jump 0x2489
+    iinc 1
+    jump 0x2471
+    iinc 1
+    jump 0x2499
+    iinc 1
+    jump 0x2481
+    iinc 1
+    jump 0x24a9
+    iinc 1
+    jump 0x2491
+    iinc 1
+    jump 0x24b9
+    iinc 1
+    jump 0x24a1
+    iinc 1
+    jump 0x24c9
+    iinc 1
+    jump 0x24b1
+    iinc 1
+    jump 0x24d9
+    iinc 1
+    jump 0x24c1
+    iinc 1
+    jump 0x24e9
+    iinc 1
+    jump 0x24d1
+    iinc 1
+    jump 0x24f9
+    iinc 1
+    jump 0x24e1
+    iinc 1
+    jump 0x2509
+    iinc 1
+    jump 0x24f1
+    iinc 1
+    jump 0x2519
+    iinc 1
+    jump 0x2501
+    iinc 1
+    jump 0x2529
+    iinc 1
+    jump 0x2511
+    iinc 1
+    jump 0x2539
+    iinc 1
+    jump 0x2521
+    iinc 1
+    jump 0x2549
+    iinc 1
+    jump 0x2531
+    iinc 1
+    jump 0x2559
+    iinc 1
+    jump 0x2541
+    iinc 1
+    jump 0x2569
+    iinc 1
+    jump 0x2551
+    iinc 1
+    jump 0x2579
+    iinc 1
+    jump 0x2561
+    iinc 1
+    jump 0x2589
+    iinc 1
+    jump 0x2571
+    iinc 1
+    jump 0x2599
+    iinc 1
+    jump 0x2581
+    iinc 1
+    jump 0x25a9
+    iinc 1
+    jump 0x2591
+    iinc 1
+    jump 0x25b9
+    iinc 1
+    jump 0x25a1
+    iinc 1
+    jump 0x25c9
+    iinc 1
+    jump 0x25b1
+    iinc 1
+    jump 0x25d9
+    iinc 1
+    jump 0x25c1
+    iinc 1
+    jump 0x25e9
+    iinc 1
+    jump 0x25d1
+    iinc 1
+    jump 0x25f9
+    iinc 1
+    jump 0x25e1
+    iinc 1
+    jump 0x2609
+    iinc 1
+    jump 0x25f1
+    iinc 1
+    jump 0x2619
+    iinc 1
+    jump 0x2601
+    iinc 1
+    jump 0x2629
+    iinc 1
+    jump 0x2611
+    iinc 1
+    jump 0x2639
+    iinc 1
+    jump 0x2621
+    iinc 1
+    jump 0x2649
+    iinc 1
+    jump 0x2631
+    iinc 1
+    jump 0x2659
+    iinc 1
+    jump 0x2641
+    iinc 1
+    jump 0x2669
+    iinc 1
+    jump 0x2651
+    iinc 1
+    jump 0x2679
+    iinc 1
+    jump 0x2661
+    iinc 1
+    jump 0x2689
+    iinc 1
+    jump 0x2671
+    iinc 1
+    jump 0x2699
+    iinc 1
+    jump 0x2681
+    iinc 1
+    jump 0x26a9
+    iinc 1
+    jump 0x2691
+    iinc 1
+    jump 0x26b9
+    iinc 1
+    jump 0x26a1
+    iinc 1
+    jump 0x26c9
+    iinc 1
+    jump 0x26b1
+    iinc 1
+    jump 0x26d9
+    iinc 1
+    jump 0x26c1
+    iinc 1
+    jump 0x26e9
+    iinc 1
+    jump 0x26d1
+    iinc 1
+    jump 0x26f9
+    iinc 1
+    jump 0x26e1
+    iinc 1
+    jump 0x2709
+    iinc 1
+    jump 0x26f1
+    iinc 1
+    jump 0x2719
+    iinc 1
+    jump 0x2701
+    iinc 1
+    jump 0x2729
+    iinc 1
+    jump 0x2711
+    iinc 1
+    jump 0x2739
+    iinc 1
+    jump 0x2721
+    iinc 1
+    jump 0x2749
+    iinc 1
+    jump 0x2731
+    iinc 1
+    jump 0x2759
+    iinc 1
+    jump 0x2741
+    iinc 1
+    jump 0x2769
+    iinc 1
+    jump 0x2751
+    iinc 1
+    jump 0x2779
+    iinc 1
+    jump 0x2761
+    iinc 1
+    jump 0x2789
+    iinc 1
+    jump 0x2771
+    iinc 1
+    jump 0x2799
+    iinc 1
+    jump 0x2781
+    iinc 1
+    jump 0x27a9
+    iinc 1
+    jump 0x2791
+    iinc 1
+    jump 0x27b9
+    iinc 1
+    jump 0x27a1
+    iinc 1
+    jump 0x27c9
+    iinc 1
+    jump 0x27b1
+    iinc 1
+    jump 0x27d9
+    iinc 1
+    jump 0x27c1
+    iinc 1
+    jump 0x27e9
+    iinc 1
+    jump 0x27d1
+    iinc 1
+    jump 0x27f9
+    iinc 1
+    jump 0x27e1
+    iinc 1
+    jump 0x2809
+    iinc 1
+    jump 0x27f1
+    iinc 1
+    jump 0x2819
+    iinc 1
+    jump 0x2801
+    iinc 1
+    jump 0x2829
+    iinc 1
+    jump 0x2811
+    iinc 1
+    jump 0x2839
+    iinc 1
+    jump 0x2821
+    iinc 1
+    jump 0x2849
+    iinc 1
+    jump 0x2831
+    iinc 1
+    jump 0x2859
+    iinc 1
+    jump 0x2841
+    iinc 1
+    jump 0x2869
+    iinc 1
+    jump 0x2851
+    iinc 1
+    jump 0x2879
+    iinc 1
+    jump 0x2861
+    iinc 1
+    jump 0x2889
+    iinc 1
+    jump 0x2871
+    iinc 1
+    jump 0x2899
+    iinc 1
+    jump 0x2881
+    iinc 1
+    jump 0x28a9
+    iinc 1
+    jump 0x2891
+    iinc 1
+    jump 0x28b9
+    iinc 1
+    jump 0x28a1
+    iinc 1
+    jump 0x28c9
+    iinc 1
+    jump 0x28b1
+    iinc 1
+    jump 0x28d9
+    iinc 1
+    jump 0x28c1
+    iinc 1
+    jump 0x28e9
+    iinc 1
+    jump 0x28d1
+    iinc 1
+    jump 0x28f9
+    iinc 1
+    jump 0x28e1
+    iinc 1
+    jump 0x2909
+    iinc 1
+    jump 0x28f1
+    iinc 1
+    jump 0x2919
+    iinc 1
+    jump 0x2901
+    iinc 1
+    jump 0x2929
+    iinc 1
+    jump 0x2911
+    iinc 1
+    jump 0x2939
+    iinc 1
+    jump 0x2921
+    iinc 1
+    jump 0x2949
+    iinc 1
+    jump 0x2931
+    iinc 1
+    jump 0x2959
+    iinc 1
+    jump 0x2941
+    iinc 1
+    jump 0x2969
+    iinc 1
+    jump 0x2951
+    iinc 1
+    jump 0x2979
+    iinc 1
+    jump 0x2961
+    iinc 1
+    jump 0x2989
+    iinc 1
+    jump 0x2971
+    iinc 1
+    jump 0x2999
+    iinc 1
+    jump 0x2981
+    iinc 1
+    jump 0x29a9
+    iinc 1
+    jump 0x2991
+    iinc 1
+    jump 0x29b9
+    iinc 1
+    jump 0x29a1
+    iinc 1
+    jump 0x29c9
+    iinc 1
+    jump 0x29b1
+    iinc 1
+    jump 0x29d9
+    iinc 1
+    jump 0x29c1
+    iinc 1
+    jump 0x29e9
+    iinc 1
+    jump 0x29d1
+    iinc 1
+    jump 0x29f9
+    iinc 1
+    jump 0x29e1
+    iinc 1
+    jump 0x2a09
+    iinc 1
+    jump 0x29f1
+    iinc 1
+    jump 0x2a19
+    iinc 1
+    jump 0x2a01
+    iinc 1
+    jump 0x2a29
+    iinc 1
+    jump 0x2a11
+    iinc 1
+    jump 0x2a39
+    iinc 1
+    jump 0x2a21
+    iinc 1
+    jump 0x2a49
+    iinc 1
+    jump 0x2a31
+    iinc 1
+    jump 0x2a59
+    iinc 1
+    jump 0x2a41
+    iinc 1
+    jump 0x2a69
+    iinc 1
+    jump 0x2a51
+    iinc 1
+    jump 0x2a79
+    iinc 1
+    jump 0x2a61
+    iinc 1
+    jump 0x2a89
+    iinc 1
+    jump 0x2a71
+    iinc 1
+    jump 0x2a99
+    iinc 1
+    jump 0x2a81
+    iinc 1
+    jump 0x2aa9
+    iinc 1
+    jump 0x2a91
+    iinc 1
+    jump 0x2ab9
+    iinc 1
+    jump 0x2aa1
+    iinc 1
+    jump 0x2ac9
+    iinc 1
+    jump 0x2ab1
+    iinc 1
+    jump 0x2ad9
+    iinc 1
+    jump 0x2ac1
+    iinc 1
+    jump 0x2ae9
+    iinc 1
+    jump 0x2ad1
+    iinc 1
+    jump 0x2af9
+    iinc 1
+    jump 0x2ae1
+    iinc 1
+    jump 0x2b09
+    iinc 1
+    jump 0x2af1
+    iinc 1
+    jump 0x2b19
+    iinc 1
+    jump 0x2b01
+    iinc 1
+    jump 0x2b29
+    iinc 1
+    jump 0x2b11
+    iinc 1
+    jump 0x2b39
+    iinc 1
+    jump 0x2b21
+    iinc 1
+    jump 0x2b49
+    iinc 1
+    jump 0x2b31
+    iinc 1
+    jump 0x2b59
+    iinc 1
+    jump 0x2b41
+    iinc 1
+    jump 0x2b69
+    iinc 1
+    jump 0x2b51
+    iinc 1
+    jump 0x2b79
+    iinc 1
+    jump 0x2b61
+    iinc 1
+    jump 0x2b89
+    iinc 1
+    jump 0x2b71
+    iinc 1
+    jump 0x2b99
+    iinc 1
+    jump 0x2b81
+    iinc 1
+    jump 0x2ba9
+    iinc 1
+    jump 0x2b91
+    iinc 1
+    jump 0x2bb9
+    iinc 1
+    jump 0x2ba1
+    iinc 1
+    jump 0x2bc9
+    iinc 1
+    jump 0x2bb1
+    iinc 1
+    jump 0x2bd9
+    iinc 1
+    jump 0x2bc1
+    iinc 1
+    jump 0x2be9
+    iinc 1
+    jump 0x2bd1
+    iinc 1
+    jump 0x2bf9
+    iinc 1
+    jump 0x2be1
+    iinc 1
+    jump 0x2c09
+    iinc 1
+    jump 0x2bf1
+    iinc 1
+    jump 0x2c19
+    iinc 1
+    jump 0x2c01
+    iinc 1
+    jump 0x2c29
+    iinc 1
+    jump 0x2c11
+    iinc 1
+    jump 0x2c39
+    iinc 1
+    jump 0x2c21
+    iinc 1
+    jump 0x2c49
+    iinc 1
+    jump 0x2c31
+    iinc 1
+    jump 0x2c59
+    iinc 1
+    jump 0x2c41
+    iinc 1
+    jump 0x2c69
+    iinc 1
+    jump 0x2c51
+    iinc 1
+    jump 0x2c79
+    iinc 1
+    jump 0x2c61
+    iinc 1
+    jump 0x2c89
+    iinc 1
+    jump 0x2c71
+    iinc 1
+    jump 0x2c99
+    iinc 1
+    jump 0x2c81
+    iinc 1
+    jump 0x2ca9
+    iinc 1
+    jump 0x2c91
+    iinc 1
+    jump 0x2cb9
+    iinc 1
+    jump 0x2ca1
+    iinc 1
+    jump 0x2cc9
+    iinc 1
+    jump 0x2cb1
+    iinc 1
+    jump 0x2cd9
+    iinc 1
+    jump 0x2cc1
+    iinc 1
+    jump 0x2ce9
+    iinc 1
+    jump 0x2cd1
+    iinc 1
+    jump 0x2cf9
+    iinc 1
+    jump 0x2ce1
+    iinc 1
+    jump 0x2d09
+    iinc 1
+    jump 0x2cf1
+    iinc 1
+    jump 0x2d19
+    iinc 1
+    jump 0x2d01
+    iinc 1
+    jump 0x2d29
+    iinc 1
+    jump 0x2d11
+    iinc 1
+    jump 0x2d39
+    iinc 1
+    jump 0x2d21
+    iinc 1
+    jump 0x2d49
+    iinc 1
+    jump 0x2d31
+    iinc 1
+    jump 0x2d59
+    iinc 1
+    jump 0x2d41
+    iinc 1
+    jump 0x2d69
+    iinc 1
+    jump 0x2d51
+    iinc 1
+    jump 0x2d79
+    iinc 1
+    jump 0x2d61
+    iinc 1
+    jump 0x2d89
+    iinc 1
+    jump 0x2d71
+    iinc 1
+    jump 0x2d99
+    iinc 1
+    jump 0x2d81
+    iinc 1
+    jump 0x2da9
+    iinc 1
+    jump 0x2d91
+    iinc 1
+    jump 0x2db9
+    iinc 1
+    jump 0x2da1
+    iinc 1
+    jump 0x2dc9
+    iinc 1
+    jump 0x2db1
+    iinc 1
+    jump 0x2dd9
+    iinc 1
+    jump 0x2dc1
+    iinc 1
+    jump 0x2de9
+    iinc 1
+    jump 0x2dd1
+    iinc 1
+    jump 0x2df9
+    iinc 1
+    jump 0x2de1
+    iinc 1
+    jump 0x2e09
+    iinc 1
+    jump 0x2df1
+    iinc 1
+    jump 0x2e19
+    iinc 1
+    jump 0x2e01
+    iinc 1
+    jump 0x2e29
+    iinc 1
+    jump 0x2e11
+    iinc 1
+    jump 0x2e39
+    iinc 1
+    jump 0x2e21
+    iinc 1
+    jump 0x2e49
+    iinc 1
+    jump 0x2e31
+    iinc 1
+    jump 0x2e59
+    iinc 1
+    jump 0x2e41
+    iinc 1
+    jump 0x2e69
+    iinc 1
+    jump 0x2e51
+    iinc 1
+    jump 0x2e79
+    iinc 1
+    jump 0x2e61
+    iinc 1
+    jump 0x2e89
+    iinc 1
+    jump 0x2e71
+    iinc 1
+    jump 0x2e99
+    iinc 1
+    jump 0x2e81
+    iinc 1
+    jump 0x2ea9
+    iinc 1
+    jump 0x2e91
+    iinc 1
+    jump 0x2eb9
+    iinc 1
+    jump 0x2ea1
+    iinc 1
+    jump 0x2ec9
+    iinc 1
+    jump 0x2eb1
+    iinc 1
+    jump 0x2ed9
+    iinc 1
+    jump 0x2ec1
+    iinc 1
+    jump 0x2ee9
+    iinc 1
+    jump 0x2ed1
+    iinc 1
+    jump 0x2ef9
+    iinc 1
+    jump 0x2ee1
+    iinc 1
+    jump 0x2f09
+    iinc 1
+    jump 0x2ef1
+    iinc 1
+    jump 0x2f19
+    iinc 1
+    jump 0x2f01
+    iinc 1
+    jump 0x2f29
+    iinc 1
+    jump 0x2f11
+    iinc 1
+    jump 0x2f39
+    iinc 1
+    jump 0x2f21
+    iinc 1
+    jump 0x2f49
+    iinc 1
+    jump 0x2f31
+    iinc 1
+    jump 0x2f59
+    iinc 1
+    jump 0x2f41
+    iinc 1
+    jump 0x2f69
+    iinc 1
+    jump 0x2f51
+    iinc 1
+    jump 0x2f79
+    iinc 1
+    jump 0x2f61
+    iinc 1
+    jump 0x2f89
+    iinc 1
+    jump 0x2f71
+    iinc 1
+    jump 0x2f99
+    iinc 1
+    jump 0x2f81
+    iinc 1
+    jump 0x2fa9
+    iinc 1
+    jump 0x2f91
+    iinc 1
+    jump 0x2fb9
+    iinc 1
+    jump 0x2fa1
+    iinc 1
+    jump 0x2fc9
+    iinc 1
+    jump 0x2fb1
+    iinc 1
+    jump 0x2fd9
+    iinc 1
+    jump 0x2fc1
+    iinc 1
+    jump 0x2fe9
+    iinc 1
+    jump 0x2fd1
+    iinc 1
+    jump 0x2ff9
+    iinc 1
+    jump 0x2fe1
+    iinc 1
+    jump 0x3009
+    iinc 1
+    jump 0x2ff1
+    iinc 1
+    jump 0x3019
+    iinc 1
+    jump 0x3001
+    iinc 1
+    jump 0x3029
+    iinc 1
+    jump 0x3011
+    iinc 1
+    jump 0x3039
+    iinc 1
+    jump 0x3021
+    iinc 1
+    jump 0x3049
+    iinc 1
+    jump 0x3031
+    iinc 1
+    jump 0x3059
+    iinc 1
+    jump 0x3041
+    iinc 1
+    jump 0x3069
+    iinc 1
+    jump 0x3051
+    iinc 1
+    jump 0x3079
+    iinc 1
+    jump 0x3061
+    iinc 1
+    jump 0x3089
+    iinc 1
+    jump 0x3071
+    iinc 1
+    jump 0x3099
+    iinc 1
+    jump 0x3081
+    iinc 1
+    jump 0x30a9
+    iinc 1
+    jump 0x3091
+    iinc 1
+    jump 0x30b9
+    iinc 1
+    jump 0x30a1
+    iinc 1
+    jump 0x30c9
+    iinc 1
+    jump 0x30b1
+    iinc 1
+    jump 0x30d9
+    iinc 1
+    jump 0x30c1
+    iinc 1
+    jump 0x30e9
+    iinc 1
+    jump 0x30d1
+    iinc 1
+    jump 0x30f9
+    iinc 1
+    jump 0x30e1
+    iinc 1
+    jump 0x3109
+    iinc 1
+    jump 0x30f1
+    iinc 1
+    jump 0x3119
+    iinc 1
+    jump 0x3101
+    iinc 1
+    jump 0x3129
+    iinc 1
+    jump 0x3111
+    iinc 1
+    jump 0x3139
+    iinc 1
+    jump 0x3121
+    iinc 1
+    jump 0x3149
+    iinc 1
+    jump 0x3131
+    iinc 1
+    jump 0x3159
+    iinc 1
+    jump 0x3141
+    iinc 1
+    jump 0x3169
+    iinc 1
+    jump 0x3151
+    iinc 1
+    jump 0x3179
+    iinc 1
+    jump 0x3161
+    iinc 1
+    jump 0x3189
+    iinc 1
+    jump 0x3171
+    iinc 1
+    jump 0x3199
+    iinc 1
+    jump 0x3181
+    iinc 1
+    jump 0x31a9
+    iinc 1
+    jump 0x3191
+    iinc 1
+    jump 0x31b9
+    iinc 1
+    jump 0x31a1
+    iinc 1
+    jump 0x31c9
+    iinc 1
+    jump 0x31b1
+    iinc 1
+    jump 0x31d9
+    iinc 1
+    jump 0x31c1
+    iinc 1
+    jump 0x31e9
+    iinc 1
+    jump 0x31d1
+    iinc 1
+    jump 0x31f9
+    iinc 1
+    jump 0x31e1
+    iinc 1
+    jump 0x3209
+    iinc 1
+    jump 0x31f1
+    iinc 1
+    jump 0x3219
+    iinc 1
+    jump 0x3201
+    iinc 1
+    jump 0x3229
+    iinc 1
+    jump 0x3211
+    iinc 1
+    jump 0x3239
+    iinc 1
+    jump 0x3221
+    iinc 1
+    jump 0x3249
+    iinc 1
+    jump 0x3231
+    iinc 1
+    jump 0x3259
+    iinc 1
+    jump 0x3241
+    iinc 1
+    jump 0x3269
+    iinc 1
+    jump 0x3251
+    iinc 1
+    jump 0x3279
+    iinc 1
+    jump 0x3261
+    iinc 1
+    jump 0x3289
+    iinc 1
+    jump 0x3271
+    iinc 1
+    jump 0x3299
+    iinc 1
+    jump 0x3281
+    iinc 1
+    jump 0x32a9
+    iinc 1
+    jump 0x3291
+    iinc 1
+    jump 0x32b9
+    iinc 1
+    jump 0x32a1
+    iinc 1
+    jump 0x32c9
+    iinc 1
+    jump 0x32b1
+    iinc 1
+    jump 0x32d9
+    iinc 1
+    jump 0x32c1
+    iinc 1
+    jump 0x32e9
+    iinc 1
+    jump 0x32d1
+    iinc 1
+    jump 0x32f9
+    iinc 1
+    jump 0x32e1
+    iinc 1
+    jump 0x3309
+    iinc 1
+    jump 0x32f1
+    iinc 1
+    jump 0x3319
+    iinc 1
+    jump 0x3301
+    iinc 1
+    jump 0x3329
+    iinc 1
+    jump 0x3311
+    iinc 1
+    jump 0x3339
+    iinc 1
+    jump 0x3321
+    iinc 1
+    jump 0x3349
+    iinc 1
+    jump 0x3331
+    iinc 1
+    jump 0x3359
+    iinc 1
+    jump 0x3341
+    iinc 1
+    jump 0x3369
+    iinc 1
+    jump 0x3351
+    iinc 1
+    jump 0x3379
+    iinc 1
+    jump 0x3361
+    iinc 1
+    jump 0x3389
+    iinc 1
+    jump 0x3371
+    iinc 1
+    jump 0x3399
+    iinc 1
+    jump 0x3381
+    iinc 1
+    jump 0x33a9
+    iinc 1
+    jump 0x3391
+    iinc 1
+    jump 0x33b9
+    iinc 1
+    jump 0x33a1
+    iinc 1
+    jump 0x33c9
+    iinc 1
+    jump 0x33b1
+    iinc 1
+    jump 0x33d9
+    iinc 1
+    jump 0x33c1
+    iinc 1
+    jump 0x33e9
+    iinc 1
+    jump 0x33d1
+    iinc 1
+    jump 0x33f9
+    iinc 1
+    jump 0x33e1
+    iinc 1
+    jump 0x3409
+    iinc 1
+    jump 0x33f1
+    iinc 1
+    jump 0x3419
+    iinc 1
+    jump 0x3401
+    iinc 1
+    jump 0x3429
+    iinc 1
+    jump 0x3411
+    iinc 1
+    jump 0x3439
+    iinc 1
+    jump 0x3421
+    iinc 1
+    jump 0x3449
+    iinc 1
+    jump 0x3431
+    iinc 1
+    jump 0x3459
+    iinc 1
+    jump 0x3441
+    iinc 1
+    jump 0x3469
+    iinc 1
+    jump 0x3451
+    iinc 1
+    jump 0x3479
+    iinc 1
+    jump 0x3461
+    iinc 1
+    jump 0x3489
+    iinc 1
+    jump 0x3471
+    iinc 1
+    jump 0x3499
+    iinc 1
+    jump 0x3481
+    iinc 1
+    jump 0x34a9
+    iinc 1
+    jump 0x3491
+    iinc 1
+    jump 0x34b9
+    iinc 1
+    jump 0x34a1
+    iinc 1
+    jump 0x34c9
+    iinc 1
+    jump 0x34b1
+    iinc 1
+    jump 0x34d9
+    iinc 1
+    jump 0x34c1
+    iinc 1
+    jump 0x34e9
+    iinc 1
+    jump 0x34d1
+    iinc 1
+    jump 0x34f9
+    iinc 1
+    jump 0x34e1
+    iinc 1
+    jump 0x3509
+    iinc 1
+    jump 0x34f1
+    iinc 1
+    jump 0x3519
+    iinc 1
+    jump 0x3501
+    iinc 1
+    jump 0x3529
+    iinc 1
+    jump 0x3511
+    iinc 1
+    jump 0x3539
+    iinc 1
+    jump 0x3521
+    iinc 1
+    jump 0x3549
+    iinc 1
+    jump 0x3531
+    iinc 1
+    jump 0x3559
+    iinc 1
+    jump 0x3541
+    iinc 1
+    jump 0x3569
+    iinc 1
+    jump 0x3551
+    iinc 1
+    jump 0x3579
+    iinc 1
+    jump 0x3561
+    iinc 1
+    jump 0x3589
+    iinc 1
+    jump 0x3571
+    iinc 1
+    jump 0x3599
+    iinc 1
+    jump 0x3581
+    iinc 1
+    jump 0x35a9
+    iinc 1
+    jump 0x3591
+    iinc 1
+    jump 0x35b9
+    iinc 1
+    jump 0x35a1
+    iinc 1
+    jump 0x35c9
+    iinc 1
+    jump 0x35b1
+    iinc 1
+    jump 0x35d9
+    iinc 1
+    jump 0x35c1
+    iinc 1
+    jump 0x35e9
+    iinc 1
+    jump 0x35d1
+    iinc 1
+    jump 0x35f9
+    iinc 1
+    jump 0x35e1
+    iinc 1
+    jump 0x3609
+    iinc 1
+    jump 0x35f1
+    iinc 1
+    jump 0x3619
+    iinc 1
+    jump 0x3601
+    iinc 1
+    jump 0x3629
+    iinc 1
+    jump 0x3611
+    iinc 1
+    jump 0x3639
+    iinc 1
+    jump 0x3621
+    iinc 1
+    jump 0x3649
+    iinc 1
+    jump 0x3631
+    iinc 1
+    jump 0x3659
+    iinc 1
+    jump 0x3641
+    iinc 1
+    jump 0x3669
+    iinc 1
+    jump 0x3651
+    iinc 1
+    jump 0x3679
+    iinc 1
+    jump 0x3661
+    iinc 1
+    jump 0x3689
+    iinc 1
+    jump 0x3671
+    iinc 1
+    jump 0x3699
+    iinc 1
+    jump 0x3681
+    iinc 1
+    jump 0x36a9
+    iinc 1
+    jump 0x3691
+    iinc 1
+    jump 0x36b9
+    iinc 1
+    jump 0x36a1
+    iinc 1
+    jump 0x36c9
+    iinc 1
+    jump 0x36b1
+    iinc 1
+    jump 0x36d9
+    iinc 1
+    jump 0x36c1
+    iinc 1
+    jump 0x36e9
+    iinc 1
+    jump 0x36d1
+    iinc 1
+    jump 0x36f9
+    iinc 1
+    jump 0x36e1
+    iinc 1
+    jump 0x3709
+    iinc 1
+    jump 0x36f1
+    iinc 1
+    jump 0x3719
+    iinc 1
+    jump 0x3701
+    iinc 1
+    jump 0x3729
+    iinc 1
+    jump 0x3711
+    iinc 1
+    jump 0x3739
+    iinc 1
+    jump 0x3721
+    iinc 1
+    jump 0x3749
+    iinc 1
+    jump 0x3731
+    iinc 1
+    jump 0x3759
+    iinc 1
+    jump 0x3741
+    iinc 1
+    jump 0x3769
+    iinc 1
+    jump 0x3751
+    iinc 1
+    jump 0x3779
+    iinc 1
+    jump 0x3761
+    iinc 1
+    jump 0x3789
+    iinc 1
+    jump 0x3771
+    iinc 1
+    jump 0x3799
+    iinc 1
+    jump 0x3781
+    iinc 1
+    jump 0x37a9
+    iinc 1
+    jump 0x3791
+    iinc 1
+    jump 0x37b9
+    iinc 1
+    jump 0x37a1
+    iinc 1
+    jump 0x37c9
+    iinc 1
+    jump 0x37b1
+    iinc 1
+    jump 0x37d9
+    iinc 1
+    jump 0x37c1
+    iinc 1
+    jump 0x37e9
+    iinc 1
+    jump 0x37d1
+    iinc 1
+    jump 0x37f9
+    iinc 1
+    jump 0x37e1
+    iinc 1
+    jump 0x3809
+    iinc 1
+    jump 0x37f1
+    iinc 1
+    jump 0x3819
+    iinc 1
+    jump 0x3801
+    iinc 1
+    jump 0x3829
+    iinc 1
+    jump 0x3811
+    iinc 1
+    jump 0x3839
+    iinc 1
+    jump 0x3821
+    iinc 1
+    jump 0x3849
+    iinc 1
+    jump 0x3831
+    iinc 1
+    jump 0x3859
+    iinc 1
+    jump 0x3841
+    iinc 1
+    jump 0x3869
+    iinc 1
+    jump 0x3851
+    iinc 1
+    jump 0x3879
+    iinc 1
+    jump 0x3861
+    iinc 1
+    jump 0x3889
+    iinc 1
+    jump 0x3871
+    iinc 1
+    jump 0x3899
+    iinc 1
+    jump 0x3881
+    iinc 1
+    jump 0x38a9
+    iinc 1
+    jump 0x3891
+    iinc 1
+    jump 0x38b9
+    iinc 1
+    jump 0x38a1
+    iinc 1
+    jump 0x38c9
+    iinc 1
+    jump 0x38b1
+    iinc 1
+    jump 0x38d9
+    iinc 1
+    jump 0x38c1
+    iinc 1
+    jump 0x38e9
+    iinc 1
+    jump 0x38d1
+    iinc 1
+    jump 0x38f9
+    iinc 1
+    jump 0x38e1
+    iinc 1
+    jump 0x3909
+    iinc 1
+    jump 0x38f1
+    iinc 1
+    jump 0x3919
+    iinc 1
+    jump 0x3901
+    iinc 1
+    jump 0x3929
+    iinc 1
+    jump 0x3911
+    iinc 1
+    jump 0x3939
+    iinc 1
+    jump 0x3921
+    iinc 1
+    jump 0x3949
+    iinc 1
+    jump 0x3931
+    iinc 1
+    jump 0x3959
+    iinc 1
+    jump 0x3941
+    iinc 1
+    jump 0x3969
+    iinc 1
+    jump 0x3951
+    iinc 1
+    jump 0x3979
+    iinc 1
+    jump 0x3961
+    iinc 1
+    jump 0x3989
+    iinc 1
+    jump 0x3971
+    iinc 1
+    jump 0x3999
+    iinc 1
+    jump 0x3981
+    iinc 1
+    jump 0x39a9
+    iinc 1
+    jump 0x3991
+    iinc 1
+    jump 0x39b9
+    iinc 1
+    jump 0x39a1
+    iinc 1
+    jump 0x39c9
+    iinc 1
+    jump 0x39b1
+    iinc 1
+    jump 0x39d9
+    iinc 1
+    jump 0x39c1
+    iinc 1
+    jump 0x39e9
+    iinc 1
+    jump 0x39d1
+    iinc 1
+    jump 0x39f9
+    iinc 1
+    jump 0x39e1
+    iinc 1
+    jump 0x3a09
+    iinc 1
+    jump 0x39f1
+    iinc 1
+    jump 0x3a19
+    iinc 1
+    jump 0x3a01
+    iinc 1
+    jump 0x3a29
+    iinc 1
+    jump 0x3a11
+    iinc 1
+    jump 0x3a39
+    iinc 1
+    jump 0x3a21
+    iinc 1
+    jump 0x3a49
+    iinc 1
+    jump 0x3a31
+    iinc 1
+    jump 0x3a59
+    iinc 1
+    jump 0x3a41
+    iinc 1
+    jump 0x3a69
+    iinc 1
+    jump 0x3a51
+    iinc 1
+    jump 0x3a79
+    iinc 1
+    jump 0x3a61
+    iinc 1
+    jump 0x3a89
+    iinc 1
+    jump 0x3a71
+    iinc 1
+    jump 0x3a99
+    iinc 1
+    jump 0x3a81
+    iinc 1
+    jump 0x3aa9
+    iinc 1
+    jump 0x3a91
+    iinc 1
+    jump 0x3ab9
+    iinc 1
+    jump 0x3aa1
+    iinc 1
+    jump 0x3ac9
+    iinc 1
+    jump 0x3ab1
+    iinc 1
+    jump 0x3ad9
+    iinc 1
+    jump 0x3ac1
+    iinc 1
+    jump 0x3ae9
+    iinc 1
+    jump 0x3ad1
+    iinc 1
+    jump 0x3af9
+    iinc 1
+    jump 0x3ae1
+    iinc 1
+    jump 0x3b09
+    iinc 1
+    jump 0x3af1
+    iinc 1
+    jump 0x3b19
+    iinc 1
+    jump 0x3b01
+    iinc 1
+    jump 0x3b29
+    iinc 1
+    jump 0x3b11
+    iinc 1
+    jump 0x3b39
+    iinc 1
+    jump 0x3b21
+    iinc 1
+    jump 0x3b49
+    iinc 1
+    jump 0x3b31
+    iinc 1
+    jump 0x3b59
+    iinc 1
+    jump 0x3b41
+    iinc 1
+    jump 0x3b69
+    iinc 1
+    jump 0x3b51
+    iinc 1
+    jump 0x3b79
+    iinc 1
+    jump 0x3b61
+    iinc 1
+    jump 0x3b89
+    iinc 1
+    jump 0x3b71
+    iinc 1
+    jump 0x3b99
+    iinc 1
+    jump 0x3b81
+    iinc 1
+    jump 0x3ba9
+    iinc 1
+    jump 0x3b91
+    iinc 1
+    jump 0x3bb9
+    iinc 1
+    jump 0x3ba1
+    iinc 1
+    jump 0x3bc9
+    iinc 1
+    jump 0x3bb1
+    iinc 1
+    jump 0x3bd9
+    iinc 1
+    jump 0x3bc1
+    iinc 1
+    jump 0x3be9
+    iinc 1
+    jump 0x3bd1
+    iinc 1
+    jump 0x3bf9
+    iinc 1
+    jump 0x3be1
+    iinc 1
+    jump 0x3c09
+    iinc 1
+    jump 0x3bf1
+    iinc 1
+    jump 0x3c19
+    iinc 1
+    jump 0x3c01
+    iinc 1
+    jump 0x3c29
+    iinc 1
+    jump 0x3c11
+    iinc 1
+    jump 0x3c39
+    iinc 1
+    jump 0x3c21
+    iinc 1
+    jump 0x3c49
+    iinc 1
+    jump 0x3c31
+    iinc 1
+    jump 0x3c59
+    iinc 1
+    jump 0x3c41
+    iinc 1
+    jump 0x3c69
+    iinc 1
+    jump 0x3c51
+    iinc 1
+    jump 0x3c79
+    iinc 1
+    jump 0x3c61
+    iinc 1
+    jump 0x3c89
+    iinc 1
+    jump 0x3c71
+    iinc 1
+    jump 0x3c99
+    iinc 1
+    jump 0x3c81
+    iinc 1
+    jump 0x3ca9
+    iinc 1
+    jump 0x3c91
+    iinc 1
+    jump 0x3cb9
+    iinc 1
+    jump 0x3ca1
+    iinc 1
+    jump 0x3cc9
+    iinc 1
+    jump 0x3cb1
+    iinc 1
+    jump 0x3cd9
+    iinc 1
+    jump 0x3cc1
+    iinc 1
+    jump 0x3ce9
+    iinc 1
+    jump 0x3cd1
+    iinc 1
+    jump 0x3cf9
+    iinc 1
+    jump 0x3ce1
+    iinc 1
+    jump 0x3d09
+    iinc 1
+    jump 0x3cf1
+    iinc 1
+    jump 0x3d19
+    iinc 1
+    jump 0x3d01
+    iinc 1
+    jump 0x3d29
+    iinc 1
+    jump 0x3d11
+    iinc 1
+    jump 0x3d39
+    iinc 1
+    jump 0x3d21
+    iinc 1
+    jump 0x3d49
+    iinc 1
+    jump 0x3d31
+    iinc 1
+    jump 0x3d59
+    iinc 1
+    jump 0x3d41
+    iinc 1
+    jump 0x3d69
+    iinc 1
+    jump 0x3d51
+    iinc 1
+    jump 0x3d79
+    iinc 1
+    jump 0x3d61
+    iinc 1
+    jump 0x3d89
+    iinc 1
+    jump 0x3d71
+    iinc 1
+    jump 0x3d99
+    iinc 1
+    jump 0x3d81
+    iinc 1
+    jump 0x3da9
+    iinc 1
+    jump 0x3d91
+    iinc 1
+    jump 0x3db9
+    iinc 1
+    jump 0x3da1
+    iinc 1
+    jump 0x3dc9
+    iinc 1
+    jump 0x3db1
+    iinc 1
+    jump 0x3dd9
+    iinc 1
+    jump 0x3dc1
+    iinc 1
+    jump 0x3de9
+    iinc 1
+    jump 0x3dd1
+    iinc 1
+    jump 0x3df9
+    iinc 1
+    jump 0x3de1
+    iinc 1
+    jump 0x3e09
+    iinc 1
+    jump 0x3df1
+    iinc 1
+    jump 0x3e19
+    iinc 1
+    jump 0x3e01
+    iinc 1
+    jump 0x3e29
+    iinc 1
+    jump 0x3e11
+    iinc 1
+    jump 0x3e39
+    iinc 1
+    jump 0x3e21
+    iinc 1
+    jump 0x3e49
+    iinc 1
+    jump 0x3e31
+    iinc 1
+    jump 0x3e59
+    iinc 1
+    jump 0x3e41
+    iinc 1
+    jump 0x3e69
+    iinc 1
+    jump 0x3e51
+    iinc 1
+    jump 0x3e79
+    iinc 1
+    jump 0x3e61
+    iinc 1
+    jump 0x3e89
+    iinc 1
+    jump 0x3e71
+    iinc 1
+    jump 0x3e99
+    iinc 1
+    jump 0x3e81
+    iinc 1
+    jump 0x3ea9
+    iinc 1
+    jump 0x3e91
+    iinc 1
+    jump 0x3eb9
+    iinc 1
+    jump 0x3ea1
+    iinc 1
+    jump 0x3ec9
+    iinc 1
+    jump 0x3eb1
+    iinc 1
+    jump 0x3ed9
+    iinc 1
+    jump 0x3ec1
+    iinc 1
+    jump 0x3ee9
+    iinc 1
+    jump 0x3ed1
+    iinc 1
+    jump 0x3ef9
+    iinc 1
+    jump 0x3ee1
+    iinc 1
+    jump 0x3f09
+    iinc 1
+    jump 0x3ef1
+    iinc 1
+    jump 0x3f19
+    iinc 1
+    jump 0x3f01
+    iinc 1
+    jump 0x3f29
+    iinc 1
+    jump 0x3f11
+    iinc 1
+    jump 0x3f39
+    iinc 1
+    jump 0x3f21
+    iinc 1
+    jump 0x3f49
+    iinc 1
+    jump 0x3f31
+    iinc 1
+    jump 0x3f59
+    iinc 1
+    jump 0x3f41
+    iinc 1
+    jump 0x3f69
+    iinc 1
+    jump 0x3f51
+    iinc 1
+    jump 0x3f79
+    iinc 1
+    jump 0x3f61
+    iinc 1
+    jump 0x3f89
+    iinc 1
+    jump 0x3f71
+    iinc 1
+    jump 0x3f99
+    iinc 1
+    jump 0x3f81
+    iinc 1
+    jump 0x3fa9
+    iinc 1
+    jump 0x3f91
+    iinc 1
+    jump 0x3fb9
+    iinc 1
+    jump 0x3fa1
+    iinc 1
+    jump 0x3fc9
+    iinc 1
+    jump 0x3fb1
+    iinc 1
+    jump 0x3fd9
+    iinc 1
+    jump 0x3fc1
+    iinc 1
+    jump 0x3fe9
+    iinc 1
+    jump 0x3fd1
+    iinc 1
+    jump 0x3ff9
+    iinc 1
+    jump 0x3fe1
+    iinc 1
+    jump 0x4009
+    iinc 1
+    jump 0x3ff1
+    iinc 1
+    jump 0x4019
+    iinc 1
+    jump 0x4001
+    iinc 1
+    jump 0x4029
+    iinc 1
+    jump 0x4011
+    iinc 1
+    jump 0x4039
+    iinc 1
+    jump 0x4021
+    iinc 1
+    jump 0x4049
+    iinc 1
+    jump 0x4031
+    iinc 1
+    jump 0x4059
+    iinc 1
+    jump 0x4041
+    iinc 1
+    jump 0x4069
+    iinc 1
+    jump 0x4051
+    iinc 1
+    jump 0x4079
+    iinc 1
+    jump 0x4061
+    iinc 1
+    jump 0x4089
+    iinc 1
+    jump 0x4071
+    iinc 1
+    jump 0x4099
+    iinc 1
+    jump 0x4081
+    iinc 1
+    jump 0x40a9
+    iinc 1
+    jump 0x4091
+    iinc 1
+    jump 0x40b9
+    iinc 1
+    jump 0x40a1
+    iinc 1
+    jump 0x40c9
+    iinc 1
+    jump 0x40b1
+    iinc 1
+    jump 0x40d9
+    iinc 1
+    jump 0x40c1
+    iinc 1
+    jump 0x40e9
+    iinc 1
+    jump 0x40d1
+    iinc 1
+    jump 0x40f9
+    iinc 1
+    jump 0x40e1
+    iinc 1
+    jump 0x4109
+    iinc 1
+    jump 0x40f1
+    iinc 1
+    jump 0x4119
+    iinc 1
+    jump 0x4101
+    iinc 1
+    jump 0x4129
+    iinc 1
+    jump 0x4111
+    iinc 1
+    jump 0x4139
+    iinc 1
+    jump 0x4121
+    iinc 1
+    jump 0x4149
+    iinc 1
+    jump 0x4131
+    iinc 1
+    jump 0x4159
+    iinc 1
+    jump 0x4141
+    iinc 1
+    jump 0x4169
+    iinc 1
+    jump 0x4151
+    iinc 1
+    jump 0x4179
+    iinc 1
+    jump 0x4161
+    iinc 1
+    jump 0x4189
+    iinc 1
+    jump 0x4171
+    iinc 1
+    jump 0x4199
+    iinc 1
+    jump 0x4181
+    iinc 1
+    jump 0x41a9
+    iinc 1
+    jump 0x4191
+    iinc 1
+    jump 0x41b9
+    iinc 1
+    jump 0x41a1
+    iinc 1
+    jump 0x41c9
+    iinc 1
+    jump 0x41b1
+    iinc 1
+    jump 0x41d9
+    iinc 1
+    jump 0x41c1
+    iinc 1
+    jump 0x41e9
+    iinc 1
+    jump 0x41d1
+    iinc 1
+    jump 0x41f9
+    iinc 1
+    jump 0x41e1
+    iinc 1
+    jump 0x4209
+    iinc 1
+    jump 0x41f1
+    iinc 1
+    jump 0x4219
+    iinc 1
+    jump 0x4201
+    iinc 1
+    jump 0x4229
+    iinc 1
+    jump 0x4211
+    iinc 1
+    jump 0x4239
+    iinc 1
+    jump 0x4221
+    iinc 1
+    jump 0x4249
+    iinc 1
+    jump 0x4231
+    iinc 1
+    jump 0x4259
+    iinc 1
+    jump 0x4241
+    iinc 1
+    jump 0x4269
+    iinc 1
+    jump 0x4251
+    iinc 1
+    jump 0x4279
+    iinc 1
+    jump 0x4261
+    iinc 1
+    jump 0x4289
+    iinc 1
+    jump 0x4271
+    iinc 1
+    jump 0x4299
+    iinc 1
+    jump 0x4281
+    iinc 1
+    jump 0x42a9
+    iinc 1
+    jump 0x4291
+    iinc 1
+    jump 0x42b9
+    iinc 1
+    jump 0x42a1
+    iinc 1
+    jump 0x42c9
+    iinc 1
+    jump 0x42b1
+    iinc 1
+    jump 0x42d9
+    iinc 1
+    jump 0x42c1
+    iinc 1
+    jump 0x42e9
+    iinc 1
+    jump 0x42d1
+    iinc 1
+    jump 0x42f9
+    iinc 1
+    jump 0x42e1
+    iinc 1
+    jump 0x4309
+    iinc 1
+    jump 0x42f1
+    iinc 1
+    jump 0x4319
+    iinc 1
+    jump 0x4301
+    iinc 1
+    jump 0x4329
+    iinc 1
+    jump 0x4311
+    iinc 1
+    jump 0x4339
+    iinc 1
+    jump 0x4321
+    iinc 1
+    jump 0x4349
+    iinc 1
+    jump 0x4331
+    iinc 1
+    jump 0x4359
+    iinc 1
+    jump 0x4341
+    iinc 1
+    jump 0x4369
+    iinc 1
+    jump 0x4351
+    iinc 1
+    jump 0x4379
+    iinc 1
+    jump 0x4361
+    iinc 1
+    jump 0x4389
+    iinc 1
+    jump 0x4371
+    iinc 1
+    jump 0x4399
+    iinc 1
+    jump 0x4381
+    iinc 1
+    jump 0x43a9
+    iinc 1
+    jump 0x4391
+    iinc 1
+    jump 0x43b9
+    iinc 1
+    jump 0x43a1
+    iinc 1
+    jump 0x43c9
+    iinc 1
+    jump 0x43b1
+    iinc 1
+    jump 0x43d9
+    iinc 1
+    jump 0x43c1
+    iinc 1
+    jump 0x43e9
+    iinc 1
+    jump 0x43d1
+    iinc 1
+    jump 0x43f9
+    iinc 1
+    jump 0x43e1
+    iinc 1
+    jump 0x4409
+    iinc 1
+    jump 0x43f1
+    iinc 1
+    jump 0x4419
+    iinc 1
+    jump 0x4401
+    iinc 1
+    jump 0x4429
+    iinc 1
+    jump 0x4411
+    iinc 1
+    jump 0x4439
+    iinc 1
+    jump 0x4421
+    iinc 1
+    jump 0x4449
+    iinc 1
+    jump 0x4431
+    iinc 1
+    jump 0x4459
+    iinc 1
+    jump 0x4441
+    iinc 1
+    jump 0x4469
+    iinc 1
+    jump 0x4451
+    iinc 1
+    jump 0x4479
+    iinc 1
+    jump 0x4461
+    iinc 1
+    jump 0x4489
+    iinc 1
+    jump 0x4471
+    iinc 1
+    jump 0x4499
+    iinc 1
+    jump 0x4481
+    iinc 1
+    jump 0x44a9
+    iinc 1
+    jump 0x4491
+    iinc 1
+    jump 0x44b9
+    iinc 1
+    jump 0x44a1
+    iinc 1
+    jump 0x44c9
+    iinc 1
+    jump 0x44b1
+    iinc 1
+    jump 0x44d9
+    iinc 1
+    jump 0x44c1
+    iinc 1
+    jump 0x44e9
+    iinc 1
+    jump 0x44d1
+    iinc 1
+    jump 0x44f9
+    iinc 1
+    jump 0x44e1
+    iinc 1
+    jump 0x4509
+    iinc 1
+    jump 0x44f1
+    iinc 1
+    jump 0x4519
+    iinc 1
+    jump 0x4501
+    iinc 1
+    jump 0x4529
+    iinc 1
+    jump 0x4511
+    iinc 1
+    jump 0x4539
+    iinc 1
+    jump 0x4521
+    iinc 1
+    jump 0x4549
+    iinc 1
+    jump 0x4531
+    iinc 1
+    jump 0x4559
+    iinc 1
+    jump 0x4541
+    iinc 1
+    jump 0x4569
+    iinc 1
+    jump 0x4551
+    iinc 1
+    jump 0x4579
+    iinc 1
+    jump 0x4561
+    iinc 1
+    jump 0x4589
+    iinc 1
+    jump 0x4571
+    iinc 1
+    jump 0x4599
+    iinc 1
+    jump 0x4581
+    iinc 1
+    jump 0x45a9
+    iinc 1
+    jump 0x4591
+    iinc 1
+    jump 0x45b9
+    iinc 1
+    jump 0x45a1
+    iinc 1
+    jump 0x45c9
+    iinc 1
+    jump 0x45b1
+    iinc 1
+    jump 0x45d9
+    iinc 1
+    jump 0x45c1
+    iinc 1
+    jump 0x45e9
+    iinc 1
+    jump 0x45d1
+    iinc 1
+    jump 0x45f9
+    iinc 1
+    jump 0x45e1
+    iinc 1
+    jump 0x4609
+    iinc 1
+    jump 0x45f1
+    iinc 1
+    jump 0x4619
+    iinc 1
+    jump 0x4601
+    iinc 1
+    jump 0x4629
+    iinc 1
+    jump 0x4611
+    iinc 1
+    jump 0x4639
+    iinc 1
+    jump 0x4621
+    iinc 1
+    jump 0x4649
+    iinc 1
+    jump 0x4631
+    iinc 1
+    jump 0x4659
+    iinc 1
+    jump 0x4641
+    iinc 1
+    jump 0x4669
+    iinc 1
+    jump 0x4651
+    iinc 1
+    jump 0x4679
+    iinc 1
+    jump 0x4661
+    iinc 1
+    jump 0x4689
+    iinc 1
+    jump 0x4671
+    iinc 1
+    jump 0x4699
+    iinc 1
+    jump 0x4681
+    iinc 1
+    jump 0x46a9
+    iinc 1
+    jump 0x4691
+    iinc 1
+    jump 0x46b9
+    iinc 1
+    jump 0x46a1
+    iinc 1
+    jump 0x46c9
+    iinc 1
+    jump 0x46b1
+    iinc 1
+    jump 0x46d9
+    iinc 1
+    jump 0x46c1
+    iinc 1
+    jump 0x46e9
+    iinc 1
+    jump 0x46d1
+    iinc 1
+    jump 0x46f9
+    iinc 1
+    jump 0x46e1
+    iinc 1
+    jump 0x4709
+    iinc 1
+    jump 0x46f1
+    iinc 1
+    jump 0x4719
+    iinc 1
+    jump 0x4701
+    iinc 1
+    jump 0x4729
+    iinc 1
+    jump 0x4711
+    iinc 1
+    jump 0x4739
+    iinc 1
+    jump 0x4721
+    iinc 1
+    jump 0x4749
+    iinc 1
+    jump 0x4731
+    iinc 1
+    jump 0x4759
+    iinc 1
+    jump 0x4741
+    iinc 1
+    jump 0x4769
+    iinc 1
+    jump 0x4751
+    iinc 1
+    jump 0x4779
+    iinc 1
+    jump 0x4761
+    iinc 1
+    jump 0x4789
+    iinc 1
+    jump 0x4771
+    iinc 1
+    jump 0x4799
+    iinc 1
+    jump 0x4781
+    iinc 1
+    jump 0x47a9
+    iinc 1
+    jump 0x4791
+    iinc 1
+    jump 0x47b9
+    iinc 1
+    jump 0x47a1
+    iinc 1
+    jump 0x47c9
+    iinc 1
+    jump 0x47b1
+    iinc 1
+    jump 0x47d9
+    iinc 1
+    jump 0x47c1
+    iinc 1
+    jump 0x47e9
+    iinc 1
+    jump 0x47d1
+    iinc 1
+    jump 0x47f9
+    iinc 1
+    jump 0x47e1
+    iinc 1
+    jump 0x4809
+    iinc 1
+    jump 0x47f1
+    iinc 1
+    jump 0x4819
+    iinc 1
+    jump 0x4801
+    iinc 1
+    jump 0x4829
+    iinc 1
+    jump 0x4811
+    iinc 1
+    jump 0x4839
+    iinc 1
+    jump 0x4821
+    iinc 1
+    jump 0x4849
+    iinc 1
+    jump 0x4831
+    iinc 1
+    jump 0x4859
+    iinc 1
+    jump 0x4841
+    iinc 1
+    jump 0x4869
+    iinc 1
+    jump 0x4851
+    iinc 1
+    jump 0x4879
+    iinc 1
+    jump 0x4861
+    iinc 1
+    jump 0x4889
+    iinc 1
+    jump 0x4871
+    iinc 1
+    jump 0x4899
+    iinc 1
+    jump 0x4881
+    iinc 1
+    jump 0x48a9
+    iinc 1
+    jump 0x4891
+    iinc 1
+    jump 0x48b9
+    iinc 1
+    jump 0x48a1
+    iinc 1
+    jump 0x48c9
+    iinc 1
+    jump 0x48b1
+    iinc 1
+    jump 0x48d9
+    iinc 1
+    jump 0x48c1
+    iinc 1
+    jump 0x48e9
+    iinc 1
+    jump 0x48d1
+    iinc 1
+    jump 0x48f9
+    iinc 1
+    jump 0x48e1
+    iinc 1
+    jump 0x4909
+    iinc 1
+    jump 0x48f1
+    iinc 1
+    jump 0x4919
+    iinc 1
+    jump 0x4901
+    iinc 1
+    jump 0x4929
+    iinc 1
+    jump 0x4911
+    iinc 1
+    jump 0x4939
+    iinc 1
+    jump 0x4921
+    iinc 1
+    jump 0x4949
+    iinc 1
+    jump 0x4931
+    iinc 1
+    jump 0x4959
+    iinc 1
+    jump 0x4941
+    iinc 1
+    jump 0x4969
+    iinc 1
+    jump 0x4951
+    iinc 1
+    jump 0x4979
+    iinc 1
+    jump 0x4961
+    iinc 1
+    jump 0x4989
+    iinc 1
+    jump 0x4971
+    iinc 1
+    jump 0x4999
+    iinc 1
+    jump 0x4981
+    iinc 1
+    jump 0x49a9
+    iinc 1
+    jump 0x4991
+    iinc 1
+    jump 0x49b9
+    iinc 1
+    jump 0x49a1
+    iinc 1
+    jump 0x49c9
+    iinc 1
+    jump 0x49b1
+    iinc 1
+    jump 0x49d9
+    iinc 1
+    jump 0x49c1
+    iinc 1
+    jump 0x49e9
+    iinc 1
+    jump 0x49d1
+    iinc 1
+    jump 0x49f9
+    iinc 1
+    jump 0x49e1
+    iinc 1
+    jump 0x4a09
+    iinc 1
+    jump 0x49f1
+    iinc 1
+    jump 0x4a19
+    iinc 1
+    jump 0x4a01
+    iinc 1
+    jump 0x4a29
+    iinc 1
+    jump 0x4a11
+    iinc 1
+    jump 0x4a39
+    iinc 1
+    jump 0x4a21
+    iinc 1
+    jump 0x4a49
+    iinc 1
+    jump 0x4a31
+    iinc 1
+    jump 0x4a59
+    iinc 1
+    jump 0x4a41
+    iinc 1
+    jump 0x4a69
+    iinc 1
+    jump 0x4a51
+    iinc 1
+    jump 0x4a79
+    iinc 1
+    jump 0x4a61
+    iinc 1
+    jump 0x4a89
+    iinc 1
+    jump 0x4a71
+    iinc 1
+    jump 0x4a99
+    iinc 1
+    jump 0x4a81
+    iinc 1
+    jump 0x4aa9
+    iinc 1
+    jump 0x4a91
+    iinc 1
+    jump 0x4ab9
+    iinc 1
+    jump 0x4aa1
+    iinc 1
+    jump 0x4ac9
+    iinc 1
+    jump 0x4ab1
+    iinc 1
+    jump 0x4ad9
+    iinc 1
+    jump 0x4ac1
+    iinc 1
+    jump 0x4ae9
+    iinc 1
+    jump 0x4ad1
+    iinc 1
+    jump 0x4af9
+    iinc 1
+    jump 0x4ae1
+    iinc 1
+    jump 0x4b09
+    iinc 1
+    jump 0x4af1
+    iinc 1
+    jump 0x4b19
+    iinc 1
+    jump 0x4b01
+    iinc 1
+    jump 0x4b29
+    iinc 1
+    jump 0x4b11
+    iinc 1
+    jump 0x4b39
+    iinc 1
+    jump 0x4b21
+    iinc 1
+    jump 0x4b49
+    iinc 1
+    jump 0x4b31
+    iinc 1
+    jump 0x4b59
+    iinc 1
+    jump 0x4b41
+    iinc 1
+    jump 0x4b69
+    iinc 1
+    jump 0x4b51
+    iinc 1
+    jump 0x4b79
+    iinc 1
+    jump 0x4b61
+    iinc 1
+    jump 0x4b89
+    iinc 1
+    jump 0x4b71
+    iinc 1
+    jump 0x4b99
+    iinc 1
+    jump 0x4b81
+    iinc 1
+    jump 0x4ba9
+    iinc 1
+    jump 0x4b91
+    iinc 1
+    jump 0x4bb9
+    iinc 1
+    jump 0x4ba1
+    iinc 1
+    jump 0x4bc9
+    iinc 1
+    jump 0x4bb1
+    iinc 1
+    jump 0x4bd9
+    iinc 1
+    jump 0x4bc1
+    iinc 1
+    jump 0x4be9
+    iinc 1
+    jump 0x4bd1
+    iinc 1
+    jump 0x4bf9
+    iinc 1
+    jump 0x4be1
+    iinc 1
+    jump 0x4c09
+    iinc 1
+    jump 0x4bf1
+    iinc 1
+    jump 0x4c19
+    iinc 1
+    jump 0x4c01
+    iinc 1
+    jump 0x4c29
+    iinc 1
+    jump 0x4c11
+    iinc 1
+    jump 0x4c39
+    iinc 1
+    jump 0x4c21
+    iinc 1
+    jump 0x4c49
+    iinc 1
+    jump 0x4c31
+    iinc 1
+    jump 0x4c59
+    iinc 1
+    jump 0x4c41
+    iinc 1
+    jump 0x4c69
+    iinc 1
+    jump 0x4c51
+    iinc 1
+    jump 0x4c79
+    iinc 1
+    jump 0x4c61
+    iinc 1
+    jump 0x4c89
+    iinc 1
+    jump 0x4c71
+    iinc 1
+    jump 0x4c99
+    iinc 1
+    jump 0x4c81
+    iinc 1
+    jump 0x4ca9
+    iinc 1
+    jump 0x4c91
+    iinc 1
+    jump 0x4cb9
+    iinc 1
+    jump 0x4ca1
+    iinc 1
+    jump 0x4cc9
+    iinc 1
+    jump 0x4cb1
+    iinc 1
+    jump 0x4cd9
+    iinc 1
+    jump 0x4cc1
+    iinc 1
+    jump 0x4ce9
+    iinc 1
+    jump 0x4cd1
+    iinc 1
+    jump 0x4cf9
+    iinc 1
+    jump 0x4ce1
+    iinc 1
+    jump 0x4d09
+    iinc 1
+    jump 0x4cf1
+    iinc 1
+    jump 0x4d19
+    iinc 1
+    jump 0x4d01
+    iinc 1
+    jump 0x4d29
+    iinc 1
+    jump 0x4d11
+    iinc 1
+    jump 0x4d39
+    iinc 1
+    jump 0x4d21
+    iinc 1
+    jump 0x4d49
+    iinc 1
+    jump 0x4d31
+    iinc 1
+    jump 0x4d59
+    iinc 1
+    jump 0x4d41
+    iinc 1
+    jump 0x4d69
+    iinc 1
+    jump 0x4d51
+    iinc 1
+    jump 0x4d79
+    iinc 1
+    jump 0x4d61
+    iinc 1
+    jump 0x4d89
+    iinc 1
+    jump 0x4d71
+    iinc 1
+    jump 0x4d99
+    iinc 1
+    jump 0x4d81
+    iinc 1
+    jump 0x4da9
+    iinc 1
+    jump 0x4d91
+    iinc 1
+    jump 0x4db9
+    iinc 1
+    jump 0x4da1
+    iinc 1
+    jump 0x4dc9
+    iinc 1
+    jump 0x4db1
+    iinc 1
+    jump 0x4dd9
+    iinc 1
+    jump 0x4dc1
+    iinc 1
+    jump 0x4de9
+    iinc 1
+    jump 0x4dd1
+    iinc 1
+    jump 0x4df9
+    iinc 1
+    jump 0x4de1
+    iinc 1
+    jump 0x4e09
+    iinc 1
+    jump 0x4df1
+    iinc 1
+    jump 0x4e19
+    iinc 1
+    jump 0x4e01
+    iinc 1
+    jump 0x4e29
+    iinc 1
+    jump 0x4e11
+    iinc 1
+    jump 0x4e39
+    iinc 1
+    jump 0x4e21
+    iinc 1
+    jump 0x4e49
+    iinc 1
+    jump 0x4e31
+    iinc 1
+    jump 0x4e59
+    iinc 1
+    jump 0x4e41
+    iinc 1
+    jump 0x4e69
+    iinc 1
+    jump 0x4e51
+    iinc 1
+    jump 0x4e79
+    iinc 1
+    jump 0x4e61
+    iinc 1
+    jump 0x4e89
+    iinc 1
+    jump 0x4e71
+    iinc 1
+    jump 0x4e99
+    iinc 1
+    jump 0x4e81
+    iinc 1
+    jump 0x4ea9
+    iinc 1
+    jump 0x4e91
+    iinc 1
+    jump 0x4eb9
+    iinc 1
+    jump 0x4ea1
+    iinc 1
+    jump 0x4ec9
+    iinc 1
+    jump 0x4eb1
+    iinc 1
+    jump 0x4ed9
+    iinc 1
+    jump 0x4ec1
+    iinc 1
+    jump 0x4ee9
+    iinc 1
+    jump 0x4ed1
+    iinc 1
+    jump 0x4ef9
+    iinc 1
+    jump 0x4ee1
+    iinc 1
+    jump 0x4f09
+    iinc 1
+    jump 0x4ef1
+    iinc 1
+    jump 0x4f19
+    iinc 1
+    jump 0x4f01
+    iinc 1
+    jump 0x4f29
+    iinc 1
+    jump 0x4f11
+    iinc 1
+    jump 0x4f39
+    iinc 1
+    jump 0x4f21
+    iinc 1
+    jump 0x4f49
+    iinc 1
+    jump 0x4f31
+    iinc 1
+    jump 0x4f59
+    iinc 1
+    jump 0x4f41
+    iinc 1
+    jump 0x4f69
+    iinc 1
+    jump 0x4f51
+    iinc 1
+    jump 0x4f79
+    iinc 1
+    jump 0x4f61
+    iinc 1
+    jump 0x4f89
+    iinc 1
+    jump 0x4f71
+    iinc 1
+    jump 0x4f99
+    iinc 1
+    jump 0x4f81
+    iinc 1
+    jump 0x4fa9
+    iinc 1
+    jump 0x4f91
+    iinc 1
+    jump 0x4fb9
+    iinc 1
+    jump 0x4fa1
+    iinc 1
+    jump 0x4fc9
+    iinc 1
+    jump 0x4fb1
+    iinc 1
+    jump 0x4fd9
+    iinc 1
+    jump 0x4fc1
+    iinc 1
+    jump 0x4fe9
+    iinc 1
+    jump 0x4fd1
+    iinc 1
+    jump 0x4ff9
+    iinc 1
+    jump 0x4fe1
+    iinc 1
+    jump 0x5009
+    iinc 1
+    jump 0x4ff1
+    iinc 1
+    jump 0x5019
+    iinc 1
+    jump 0x5001
+    iinc 1
+    jump 0x5029
+    iinc 1
+    jump 0x5011
+    iinc 1
+    jump 0x5039
+    iinc 1
+    jump 0x5021
+    iinc 1
+    jump 0x5049
+    iinc 1
+    jump 0x5031
+    iinc 1
+    jump 0x5059
+    iinc 1
+    jump 0x5041
+    iinc 1
+    jump 0x5069
+    iinc 1
+    jump 0x5051
+    iinc 1
+    jump 0x5079
+    iinc 1
+    jump 0x5061
+    iinc 1
+    jump 0x5089
+    iinc 1
+    jump 0x5071
+    iinc 1
+    jump 0x5099
+    iinc 1
+    jump 0x5081
+    iinc 1
+    jump 0x50a9
+    iinc 1
+    jump 0x5091
+    iinc 1
+    jump 0x50b9
+    iinc 1
+    jump 0x50a1
+    iinc 1
+    jump 0x50c9
+    iinc 1
+    jump 0x50b1
+    iinc 1
+    jump 0x50d9
+    iinc 1
+    jump 0x50c1
+    iinc 1
+    jump 0x50e9
+    iinc 1
+    jump 0x50d1
+    iinc 1
+    jump 0x50f9
+    iinc 1
+    jump 0x50e1
+    iinc 1
+    jump 0x5109
+    iinc 1
+    jump 0x50f1
+    iinc 1
+    jump 0x5119
+    iinc 1
+    jump 0x5101
+    iinc 1
+    jump 0x5129
+    iinc 1
+    jump 0x5111
+    iinc 1
+    jump 0x5139
+    iinc 1
+    jump 0x5121
+    iinc 1
+    jump 0x5149
+    iinc 1
+    jump 0x5131
+    iinc 1
+    jump 0x5159
+    iinc 1
+    jump 0x5141
+    iinc 1
+    jump 0x5169
+    iinc 1
+    jump 0x5151
+    iinc 1
+    jump 0x5179
+    iinc 1
+    jump 0x5161
+    iinc 1
+    jump 0x5189
+    iinc 1
+    jump 0x5171
+    iinc 1
+    jump 0x5199
+    iinc 1
+    jump 0x5181
+    iinc 1
+    jump 0x51a9
+    iinc 1
+    jump 0x5191
+    iinc 1
+    jump 0x51b9
+    iinc 1
+    jump 0x51a1
+    iinc 1
+    jump 0x51c9
+    iinc 1
+    jump 0x51b1
+    iinc 1
+    jump 0x51d9
+    iinc 1
+    jump 0x51c1
+    iinc 1
+    jump 0x51e9
+    iinc 1
+    jump 0x51d1
+    iinc 1
+    jump 0x51f9
+    iinc 1
+    jump 0x51e1
+    iinc 1
+    jump 0x5209
+    iinc 1
+    jump 0x51f1
+    iinc 1
+    jump 0x5219
+    iinc 1
+    jump 0x5201
+    iinc 1
+    jump 0x5229
+    iinc 1
+    jump 0x5211
+    iinc 1
+    jump 0x5239
+    iinc 1
+    jump 0x5221
+    iinc 1
+    jump 0x5249
+    iinc 1
+    jump 0x5231
+    iinc 1
+    jump 0x5259
+    iinc 1
+    jump 0x5241
+    iinc 1
+    jump 0x5269
+    iinc 1
+    jump 0x5251
+    iinc 1
+    jump 0x5279
+    iinc 1
+    jump 0x5261
+    iinc 1
+    jump 0x5289
+    iinc 1
+    jump 0x5271
+    iinc 1
+    jump 0x5299
+    iinc 1
+    jump 0x5281
+    iinc 1
+    jump 0x52a9
+    iinc 1
+    jump 0x5291
+    iinc 1
+    jump 0x52b9
+    iinc 1
+    jump 0x52a1
+    iinc 1
+    jump 0x52c9
+    iinc 1
+    jump 0x52b1
+    iinc 1
+    jump 0x52d9
+    iinc 1
+    jump 0x52c1
+    iinc 1
+    jump 0x52e9
+    iinc 1
+    jump 0x52d1
+    iinc 1
+    jump 0x52f9
+    iinc 1
+    jump 0x52e1
+    iinc 1
+    jump 0x5309
+    iinc 1
+    jump 0x52f1
+    iinc 1
+    jump 0x5319
+    iinc 1
+    jump 0x5301
+    iinc 1
+    jump 0x5329
+    iinc 1
+    jump 0x5311
+    iinc 1
+    jump 0x5339
+    iinc 1
+    jump 0x5321
+    iinc 1
+    jump 0x5349
+    iinc 1
+    jump 0x5331
+    iinc 1
+    jump 0x5359
+    iinc 1
+    jump 0x5341
+    iinc 1
+    jump 0x5369
+    iinc 1
+    jump 0x5351
+    iinc 1
+    jump 0x5379
+    iinc 1
+    jump 0x5361
+    iinc 1
+    jump 0x5389
+    iinc 1
+    jump 0x5371
+    iinc 1
+    jump 0x5399
+    iinc 1
+    jump 0x5381
+    iinc 1
+    jump 0x53a9
+    iinc 1
+    jump 0x5391
+    iinc 1
+    jump 0x53b9
+    iinc 1
+    jump 0x53a1
+    iinc 1
+    jump 0x53c9
+    iinc 1
+    jump 0x53b1
+    iinc 1
+    jump 0x53d9
+    iinc 1
+    jump 0x53c1
+    iinc 1
+    jump 0x53e9
+    iinc 1
+    jump 0x53d1
+    iinc 1
+    jump 0x53f9
+    iinc 1
+    jump 0x53e1
+    iinc 1
+    jump 0x5409
+    iinc 1
+    jump 0x53f1
+    iinc 1
+    jump 0x5419
+    iinc 1
+    jump 0x5401
+    iinc 1
+    jump 0x5429
+    iinc 1
+    jump 0x5411
+    iinc 1
+    jump 0x5439
+    iinc 1
+    jump 0x5421
+    iinc 1
+    jump 0x5449
+    iinc 1
+    jump 0x5431
+    iinc 1
+    jump 0x5459
+    iinc 1
+    jump 0x5441
+    iinc 1
+    jump 0x5469
+    iinc 1
+    jump 0x5451
+    iinc 1
+    jump 0x5479
+    iinc 1
+    jump 0x5461
+    iinc 1
+    jump 0x5489
+    iinc 1
+    jump 0x5471
+    iinc 1
+    jump 0x5499
+    iinc 1
+    jump 0x5481
+    iinc 1
+    jump 0x54a9
+    iinc 1
+    jump 0x5491
+    iinc 1
+    jump 0x54b9
+    iinc 1
+    jump 0x54a1
+    iinc 1
+    jump 0x54c9
+    iinc 1
+    jump 0x54b1
+    iinc 1
+    jump 0x54d9
+    iinc 1
+    jump 0x54c1
+    iinc 1
+    jump 0x54e9
+    iinc 1
+    jump 0x54d1
+    iinc 1
+    jump 0x54f9
+    iinc 1
+    jump 0x54e1
+    iinc 1
+    jump 0x5509
+    iinc 1
+    jump 0x54f1
+    iinc 1
+    jump 0x5519
+    iinc 1
+    jump 0x5501
+    iinc 1
+    jump 0x5529
+    iinc 1
+    jump 0x5511
+    iinc 1
+    jump 0x5539
+    iinc 1
+    jump 0x5521
+    iinc 1
+    jump 0x5549
+    iinc 1
+    jump 0x5531
+    iinc 1
+    jump 0x5559
+    iinc 1
+    jump 0x5541
+    iinc 1
+    jump 0x5569
+    iinc 1
+    jump 0x5551
+    iinc 1
+    jump 0x5579
+    iinc 1
+    jump 0x5561
+    iinc 1
+    jump 0x5589
+    iinc 1
+    jump 0x5571
+    iinc 1
+    jump 0x5599
+    iinc 1
+    jump 0x5581
+    iinc 1
+    jump 0x55a9
+    iinc 1
+    jump 0x5591
+    iinc 1
+    jump 0x55b9
+    iinc 1
+    jump 0x55a1
+    iinc 1
+    jump 0x55c9
+    iinc 1
+    jump 0x55b1
+    iinc 1
+    jump 0x55d9
+    iinc 1
+    jump 0x55c1
+    iinc 1
+    jump 0x55e9
+    iinc 1
+    jump 0x55d1
+    iinc 1
+    jump 0x55f9
+    iinc 1
+    jump 0x55e1
+    iinc 1
+    jump 0x5609
+    iinc 1
+    jump 0x55f1
+    iinc 1
+    jump 0x5619
+    iinc 1
+    jump 0x5601
+    iinc 1
+    jump 0x5629
+    iinc 1
+    jump 0x5611
+    iinc 1
+    jump 0x5639
+    iinc 1
+    jump 0x5621
+    iinc 1
+    jump 0x5649
+    iinc 1
+    jump 0x5631
+    iinc 1
+    jump 0x5659
+    iinc 1
+    jump 0x5641
+    iinc 1
+    jump 0x5669
+    iinc 1
+    jump 0x5651
+    iinc 1
+    jump 0x5679
+    iinc 1
+    jump 0x5661
+    iinc 1
+    jump 0x5689
+    iinc 1
+    jump 0x5671
+    iinc 1
+    jump 0x5699
+    iinc 1
+    jump 0x5681
+    iinc 1
+    jump 0x56a9
+    iinc 1
+    jump 0x5691
+    iinc 1
+    jump 0x56b9
+    iinc 1
+    jump 0x56a1
+    iinc 1
+    jump 0x56c9
+    iinc 1
+    jump 0x56b1
+    iinc 1
+    jump 0x56d9
+    iinc 1
+    jump 0x56c1
+    iinc 1
+    jump 0x56e9
+    iinc 1
+    jump 0x56d1
+    iinc 1
+    jump 0x56f9
+    iinc 1
+    jump 0x56e1
+    iinc 1
+    jump 0x5709
+    iinc 1
+    jump 0x56f1
+    iinc 1
+    jump 0x5719
+    iinc 1
+    jump 0x5701
+    iinc 1
+    jump 0x5729
+    iinc 1
+    jump 0x5711
+    iinc 1
+    jump 0x5739
+    iinc 1
+    jump 0x5721
+    iinc 1
+    jump 0x5749
+    iinc 1
+    jump 0x5731
+    iinc 1
+    jump 0x5759
+    iinc 1
+    jump 0x5741
+    iinc 1
+    jump 0x5769
+    iinc 1
+    jump 0x5751
+    iinc 1
+    jump 0x5779
+    iinc 1
+    jump 0x5761
+    iinc 1
+    jump 0x5789
+    iinc 1
+    jump 0x5771
+    iinc 1
+    jump 0x5799
+    iinc 1
+    jump 0x5781
+    iinc 1
+    jump 0x57a9
+    iinc 1
+    jump 0x5791
+    iinc 1
+    jump 0x57b9
+    iinc 1
+    jump 0x57a1
+    iinc 1
+    jump 0x57c9
+    iinc 1
+    jump 0x57b1
+    iinc 1
+    jump 0x57d9
+    iinc 1
+    jump 0x57c1
+    iinc 1
+    jump 0x57e9
+    iinc 1
+    jump 0x57d1
+    iinc 1
+    jump 0x57f9
+    iinc 1
+    jump 0x57e1
+    iinc 1
+    jump 0x5809
+    iinc 1
+    jump 0x57f1
+    iinc 1
+    jump 0x5819
+    iinc 1
+    jump 0x5801
+    iinc 1
+    jump 0x5829
+    iinc 1
+    jump 0x5811
+    iinc 1
+    jump 0x5839
+    iinc 1
+    jump 0x5821
+    iinc 1
+    jump 0x5849
+    iinc 1
+    jump 0x5831
+    iinc 1
+    jump 0x5859
+    iinc 1
+    jump 0x5841
+    iinc 1
+    jump 0x5869
+    iinc 1
+    jump 0x5851
+    iinc 1
+    jump 0x5879
+    iinc 1
+    jump 0x5861
+    iinc 1
+    jump 0x5889
+    iinc 1
+    jump 0x5871
+    iinc 1
+    jump 0x5899
+    iinc 1
+    jump 0x5881
+    iinc 1
+    jump 0x58a9
+    iinc 1
+    jump 0x5891
+    iinc 1
+    jump 0x58b9
+    iinc 1
+    jump 0x58a1
+    iinc 1
+    jump 0x58c9
+    iinc 1
+    jump 0x58b1
+    iinc 1
+    jump 0x58d9
+    iinc 1
+    jump 0x58c1
+    iinc 1
+    jump 0x58e9
+    iinc 1
+    jump 0x58d1
+    iinc 1
+    jump 0x58f9
+    iinc 1
+    jump 0x58e1
+    iinc 1
+    jump 0x5909
+    iinc 1
+    jump 0x58f1
+    iinc 1
+    jump 0x5919
+    iinc 1
+    jump 0x5901
+    iinc 1
+    jump 0x5929
+    iinc 1
+    jump 0x5911
+    iinc 1
+    jump 0x5939
+    iinc 1
+    jump 0x5921
+    iinc 1
+    jump 0x5949
+    iinc 1
+    jump 0x5931
+    iinc 1
+    jump 0x5959
+    iinc 1
+    jump 0x5941
+    iinc 1
+    jump 0x5969
+    iinc 1
+    jump 0x5951
+    iinc 1
+    jump 0x5979
+    iinc 1
+    jump 0x5961
+    iinc 1
+    jump 0x5989
+    iinc 1
+    jump 0x5971
+    iinc 1
+    jump 0x5999
+    iinc 1
+    jump 0x5981
+    iinc 1
+    jump 0x59a9
+    iinc 1
+    jump 0x5991
+    iinc 1
+    jump 0x59b9
+    iinc 1
+    jump 0x59a1
+    iinc 1
+    jump 0x59c9
+    iinc 1
+    jump 0x59b1
+    iinc 1
+    jump 0x59d9
+    iinc 1
+    jump 0x59c1
+    iinc 1
+    jump 0x59e9
+    iinc 1
+    jump 0x59d1
+    iinc 1
+    jump 0x59f9
+    iinc 1
+    jump 0x59e1
+    iinc 1
+    jump 0x5a09
+    iinc 1
+    jump 0x59f1
+    iinc 1
+    jump 0x5a19
+    iinc 1
+    jump 0x5a01
+    iinc 1
+    jump 0x5a29
+    iinc 1
+    jump 0x5a11
+    iinc 1
+    jump 0x5a39
+    iinc 1
+    jump 0x5a21
+    iinc 1
+    jump 0x5a49
+    iinc 1
+    jump 0x5a31
+    iinc 1
+    jump 0x5a59
+    iinc 1
+    jump 0x5a41
+    iinc 1
+    jump 0x5a69
+    iinc 1
+    jump 0x5a51
+    iinc 1
+    jump 0x5a79
+    iinc 1
+    jump 0x5a61
+    iinc 1
+    jump 0x5a89
+    iinc 1
+    jump 0x5a71
+    iinc 1
+    jump 0x5a99
+    iinc 1
+    jump 0x5a81
+    iinc 1
+    jump 0x5aa9
+    iinc 1
+    jump 0x5a91
+    iinc 1
+    jump 0x5ab9
+    iinc 1
+    jump 0x5aa1
+    iinc 1
+    jump 0x5ac9
+    iinc 1
+    jump 0x5ab1
+    iinc 1
+    jump 0x5ad9
+    iinc 1
+    jump 0x5ac1
+    iinc 1
+    jump 0x5ae9
+    iinc 1
+    jump 0x5ad1
+    iinc 1
+    jump 0x5af9
+    iinc 1
+    jump 0x5ae1
+    iinc 1
+    jump 0x5b09
+    iinc 1
+    jump 0x5af1
+    iinc 1
+    jump 0x5b19
+    iinc 1
+    jump 0x5b01
+    iinc 1
+    jump 0x5b29
+    iinc 1
+    jump 0x5b11
+    iinc 1
+    jump 0x5b39
+    iinc 1
+    jump 0x5b21
+    iinc 1
+    jump 0x5b49
+    iinc 1
+    jump 0x5b31
+    iinc 1
+    jump 0x5b59
+    iinc 1
+    jump 0x5b41
+    iinc 1
+    jump 0x5b69
+    iinc 1
+    jump 0x5b51
+    iinc 1
+    jump 0x5b79
+    iinc 1
+    jump 0x5b61
+    iinc 1
+    jump 0x5b89
+    iinc 1
+    jump 0x5b71
+    iinc 1
+    jump 0x5b99
+    iinc 1
+    jump 0x5b81
+    iinc 1
+    jump 0x5ba9
+    iinc 1
+    jump 0x5b91
+    iinc 1
+    jump 0x5bb9
+    iinc 1
+    jump 0x5ba1
+    iinc 1
+    jump 0x5bc9
+    iinc 1
+    jump 0x5bb1
+    iinc 1
+    jump 0x5bd9
+    iinc 1
+    jump 0x5bc1
+    iinc 1
+    jump 0x5be9
+    iinc 1
+    jump 0x5bd1
+    iinc 1
+    jump 0x5bf9
+    iinc 1
+    jump 0x5be1
+    iinc 1
+    jump 0x5c09
+    iinc 1
+    jump 0x5bf1
+    iinc 1
+    jump 0x5c19
+    iinc 1
+    jump 0x5c01
+    iinc 1
+    jump 0x5c29
+    iinc 1
+    jump 0x5c11
+    iinc 1
+    jump 0x5c39
+    iinc 1
+    jump 0x5c21
+    iinc 1
+    jump 0x5c49
+    iinc 1
+    jump 0x5c31
+    iinc 1
+    jump 0x5c59
+    iinc 1
+    jump 0x5c41
+    iinc 1
+    jump 0x5c69
+    iinc 1
+    jump 0x5c51
+    iinc 1
+    jump 0x5c79
+    iinc 1
+    jump 0x5c61
+    iinc 1
+    jump 0x5c89
+    iinc 1
+    jump 0x5c71
+    iinc 1
+    jump 0x5c99
+    iinc 1
+    jump 0x5c81
+    iinc 1
+    jump 0x5ca9
+    iinc 1
+    jump 0x5c91
+    iinc 1
+    jump 0x5cb9
+    iinc 1
+    jump 0x5ca1
+    iinc 1
+    jump 0x5cc9
+    iinc 1
+    jump 0x5cb1
+    iinc 1
+    jump 0x5cd9
+    iinc 1
+    jump 0x5cc1
+    iinc 1
+    jump 0x5ce9
+    iinc 1
+    jump 0x5cd1
+    iinc 1
+    jump 0x5cf9
+    iinc 1
+    jump 0x5ce1
+    iinc 1
+    jump 0x5d09
+    iinc 1
+    jump 0x5cf1
+    iinc 1
+    jump 0x5d19
+    iinc 1
+    jump 0x5d01
+    iinc 1
+    jump 0x5d29
+    iinc 1
+    jump 0x5d11
+    iinc 1
+    jump 0x5d39
+    iinc 1
+    jump 0x5d21
+    iinc 1
+    jump 0x5d49
+    iinc 1
+    jump 0x5d31
+    iinc 1
+    jump 0x5d59
+    iinc 1
+    jump 0x5d41
+    iinc 1
+    jump 0x5d69
+    iinc 1
+    jump 0x5d51
+    iinc 1
+    jump 0x5d79
+    iinc 1
+    jump 0x5d61
+    iinc 1
+    jump 0x5d89
+    iinc 1
+    jump 0x5d71
+    iinc 1
+    jump 0x5d99
+    iinc 1
+    jump 0x5d81
+    iinc 1
+    jump 0x5da9
+    iinc 1
+    jump 0x5d91
+    iinc 1
+    jump 0x5db9
+    iinc 1
+    jump 0x5da1
+    iinc 1
+    jump 0x5dc9
+    iinc 1
+    jump 0x5db1
+    iinc 1
+    jump 0x5dd9
+    iinc 1
+    jump 0x5dc1
+    iinc 1
+    jump 0x5de9
+    iinc 1
+    jump 0x5dd1
+    iinc 1
+    jump 0x5df9
+    iinc 1
+    jump 0x5de1
+    iinc 1
+    jump 0x5e09
+    iinc 1
+    jump 0x5df1
+    iinc 1
+    jump 0x5e19
+    iinc 1
+    jump 0x5e01
+    iinc 1
+    jump 0x5e29
+    iinc 1
+    jump 0x5e11
+    iinc 1
+    jump 0x5e39
+    iinc 1
+    jump 0x5e21
+    iinc 1
+    jump 0x5e49
+    iinc 1
+    jump 0x5e31
+    iinc 1
+    jump 0x5e59
+    iinc 1
+    jump 0x5e41
+    iinc 1
+    jump 0x5e69
+    iinc 1
+    jump 0x5e51
+    iinc 1
+    jump 0x5e79
+    iinc 1
+    jump 0x5e61
+    iinc 1
+    jump 0x5e89
+    iinc 1
+    jump 0x5e71
+    iinc 1
+    jump 0x5e99
+    iinc 1
+    jump 0x5e81
+    iinc 1
+    jump 0x5ea9
+    iinc 1
+    jump 0x5e91
+    iinc 1
+    jump 0x5eb9
+    iinc 1
+    jump 0x5ea1
+    iinc 1
+    jump 0x5ec9
+    iinc 1
+    jump 0x5eb1
+    iinc 1
+    jump 0x5ed9
+    iinc 1
+    jump 0x5ec1
+    iinc 1
+    jump 0x5ee9
+    iinc 1
+    jump 0x5ed1
+    iinc 1
+    jump 0x5ef9
+    iinc 1
+    jump 0x5ee1
+    iinc 1
+    jump 0x5f09
+    iinc 1
+    jump 0x5ef1
+    iinc 1
+    jump 0x5f19
+    iinc 1
+    jump 0x5f01
+    iinc 1
+    jump 0x5f29
+    iinc 1
+    jump 0x5f11
+    iinc 1
+    jump 0x5f39
+    iinc 1
+    jump 0x5f21
+    iinc 1
+    jump 0x5f49
+    iinc 1
+    jump 0x5f31
+    iinc 1
+    jump 0x5f59
+    iinc 1
+    jump 0x5f41
+    iinc 1
+    jump 0x5f69
+    iinc 1
+    jump 0x5f51
+    iinc 1
+    jump 0x5f79
+    iinc 1
+    jump 0x5f61
+    iinc 1
+    jump 0x5f89
+    iinc 1
+    jump 0x5f71
+    iinc 1
+    jump 0x5f99
+    iinc 1
+    jump 0x5f81
+    iinc 1
+    jump 0x5fa9
+    iinc 1
+    jump 0x5f91
+    iinc 1
+    jump 0x5fb9
+    iinc 1
+    jump 0x5fa1
+    iinc 1
+    jump 0x5fc9
+    iinc 1
+    jump 0x5fb1
+    iinc 1
+    jump 0x5fd9
+    iinc 1
+    jump 0x5fc1
+    iinc 1
+    jump 0x5fe9
+    iinc 1
+    jump 0x5fd1
+    iinc 1
+    jump 0x5ff9
+    iinc 1
+    jump 0x5fe1
+    iinc 1
+    jump 0x6009
+    iinc 1
+    jump 0x5ff1
+    iinc 1
+    jump 0x6019
+    iinc 1
+    jump 0x6001
+    iinc 1
+    jump 0x6029
+    iinc 1
+    jump 0x6011
+    iinc 1
+    jump 0x6039
+    iinc 1
+    jump 0x6021
+    iinc 1
+    jump 0x6049
+    iinc 1
+    jump 0x6031
+    iinc 1
+    jump 0x6059
+    iinc 1
+    jump 0x6041
+    iinc 1
+    jump 0x6069
+    iinc 1
+    jump 0x6051
+    iinc 1
+    jump 0x6079
+    iinc 1
+    jump 0x6061
+    iinc 1
+    jump 0x6089
+    iinc 1
+    jump 0x6071
+    iinc 1
+    jump 0x6099
+    iinc 1
+    jump 0x6081
+    iinc 1
+    jump 0x60a9
+    iinc 1
+    jump 0x6091
+    iinc 1
+    jump 0x60b9
+    iinc 1
+    jump 0x60a1
+    iinc 1
+    jump 0x60c9
+    iinc 1
+    jump 0x60b1
+    iinc 1
+    jump 0x60d9
+    iinc 1
+    jump 0x60c1
+    iinc 1
+    jump 0x60e9
+    iinc 1
+    jump 0x60d1
+    iinc 1
+    jump 0x60f9
+    iinc 1
+    jump 0x60e1
+    iinc 1
+    jump 0x6109
+    iinc 1
+    jump 0x60f1
+    iinc 1
+    jump 0x6119
+    iinc 1
+    jump 0x6101
+    iinc 1
+    jump 0x6129
+    iinc 1
+    jump 0x6111
+    iinc 1
+    jump 0x6139
+    iinc 1
+    jump 0x6121
+    iinc 1
+    jump 0x6149
+    iinc 1
+    jump 0x6131
+    iinc 1
+    jump 0x6159
+    iinc 1
+    jump 0x6141
+    iinc 1
+    jump 0x6169
+    iinc 1
+    jump 0x6151
+    iinc 1
+    jump 0x6179
+    iinc 1
+    jump 0x6161
+    iinc 1
+    jump 0x6189
+    iinc 1
+    jump 0x6171
+    iinc 1
+    jump 0x6199
+    iinc 1
+    jump 0x6181
+    iinc 1
+    jump 0x61a9
+    iinc 1
+    jump 0x6191
+    iinc 1
+    jump 0x61b9
+    iinc 1
+    jump 0x61a1
+    iinc 1
+    jump 0x61c9
+    iinc 1
+    jump 0x61b1
+    iinc 1
+    jump 0x61d9
+    iinc 1
+    jump 0x61c1
+    iinc 1
+    jump 0x61e9
+    iinc 1
+    jump 0x61d1
+    iinc 1
+    jump 0x61f9
+    iinc 1
+    jump 0x61e1
+    iinc 1
+    jump 0x6209
+    iinc 1
+    jump 0x61f1
+    iinc 1
+    jump 0x6219
+    iinc 1
+    jump 0x6201
+    iinc 1
+    jump 0x6229
+    iinc 1
+    jump 0x6211
+    iinc 1
+    jump 0x6239
+    iinc 1
+    jump 0x6221
+    iinc 1
+    jump 0x6249
+    iinc 1
+    jump 0x6231
+    iinc 1
+    jump 0x6259
+    iinc 1
+    jump 0x6241
+    iinc 1
+    jump 0x6269
+    iinc 1
+    jump 0x6251
+    iinc 1
+    jump 0x6279
+    iinc 1
+    jump 0x6261
+    iinc 1
+    jump 0x6289
+    iinc 1
+    jump 0x6271
+    iinc 1
+    jump 0x6299
+    iinc 1
+    jump 0x6281
+    iinc 1
+    jump 0x62a9
+    iinc 1
+    jump 0x6291
+    iinc 1
+    jump 0x62b9
+    iinc 1
+    jump 0x62a1
+    iinc 1
+    jump 0x62c9
+    iinc 1
+    jump 0x62b1
+    iinc 1
+    jump 0x62d9
+    iinc 1
+    jump 0x62c1
+    iinc 1
+    jump 0x62e9
+    iinc 1
+    jump 0x62d1
+    iinc 1
+    jump 0x62f9
+    iinc 1
+    jump 0x62e1
+    iinc 1
+    jump 0x6309
+    iinc 1
+    jump 0x62f1
+    iinc 1
+    jump 0x6319
+    iinc 1
+    jump 0x6301
+    iinc 1
+    jump 0x6329
+    iinc 1
+    jump 0x6311
+    iinc 1
+    jump 0x6339
+    iinc 1
+    jump 0x6321
+    iinc 1
+    jump 0x6349
+    iinc 1
+    jump 0x6331
+    iinc 1
+    jump 0x6359
+    iinc 1
+    jump 0x6341
+    iinc 1
+    jump 0x6369
+    iinc 1
+    jump 0x6351
+    iinc 1
+    jump 0x6379
+    iinc 1
+    jump 0x6361
+    iinc 1
+    jump 0x6389
+    iinc 1
+    jump 0x6371
+    iinc 1
+    jump 0x6399
+    iinc 1
+    jump 0x6381
+    iinc 1
+    jump 0x63a9
+    iinc 1
+    jump 0x6391
+    iinc 1
+    jump 0x63b9
+    iinc 1
+    jump 0x63a1
+    iinc 1
+    jump 0x63c9
+    iinc 1
+    jump 0x63b1
+    iinc 1
+    jump 0x63d9
+    iinc 1
+    jump 0x63c1
+    iinc 1
+    jump 0x63e9
+    iinc 1
+    jump 0x63d1
+    iinc 1
+    jump 0x63f9
+    iinc 1
+    jump 0x63e1
+    iinc 1
+    jump 0x6409
+    iinc 1
+    jump 0x63f1
+    iinc 1
+    jump 0x6419
+    iinc 1
+    jump 0x6401
+    iinc 1
+    jump 0x6429
+    iinc 1
+    jump 0x6411
+    iinc 1
+    jump 0x6439
+    iinc 1
+    jump 0x6421
+    iinc 1
+    jump 0x6449
+    iinc 1
+    jump 0x6431
+    iinc 1
+    jump 0x6459
+    iinc 1
+    jump 0x6441
+    iinc 1
+    jump 0x6469
+    iinc 1
+    jump 0x6451
+    iinc 1
+    jump 0x6479
+    iinc 1
+    jump 0x6461
+    iinc 1
+    jump 0x6489
+    iinc 1
+    jump 0x6471
+    iinc 1
+    jump 0x6499
+    iinc 1
+    jump 0x6481
+    iinc 1
+    jump 0x64a9
+    iinc 1
+    jump 0x6491
+    iinc 1
+    jump 0x64b9
+    iinc 1
+    jump 0x64a1
+    iinc 1
+    jump 0x64c9
+    iinc 1
+    jump 0x64b1
+    iinc 1
+    jump 0x64d9
+    iinc 1
+    jump 0x64c1
+    iinc 1
+    jump 0x64e9
+    iinc 1
+    jump 0x64d1
+    iinc 1
+    jump 0x64f9
+    iinc 1
+    jump 0x64e1
+    iinc 1
+    jump 0x6509
+    iinc 1
+    jump 0x64f1
+    iinc 1
+    jump 0x6519
+    iinc 1
+    jump 0x6501
+    iinc 1
+    jump 0x6529
+    iinc 1
+    jump 0x6511
+    iinc 1
+    jump 0x6539
+    iinc 1
+    jump 0x6521
+    iinc 1
+    jump 0x6549
+    iinc 1
+    jump 0x6531
+    iinc 1
+    jump 0x6559
+    iinc 1
+    jump 0x6541
+    iinc 1
+    jump 0x6569
+    iinc 1
+    jump 0x6551
+    iinc 1
+    jump 0x6579
+    iinc 1
+    jump 0x6561
+    iinc 1
+    jump 0x6589
+    iinc 1
+    jump 0x6571
+    iinc 1
+    jump 0x6599
+    iinc 1
+    jump 0x6581
+    iinc 1
+    jump 0x65a9
+    iinc 1
+    jump 0x6591
+    iinc 1
+    jump 0x65b9
+    iinc 1
+    jump 0x65a1
+    iinc 1
+    jump 0x65c9
+    iinc 1
+    jump 0x65b1
+    iinc 1
+    jump 0x65d9
+    iinc 1
+    jump 0x65c1
+    iinc 1
+    jump 0x65e9
+    iinc 1
+    jump 0x65d1
+    iinc 1
+    jump 0x65f9
+    iinc 1
+    jump 0x65e1
+    iinc 1
+    jump 0x6609
+    iinc 1
+    jump 0x65f1
+    iinc 1
+    jump 0x6619
+    iinc 1
+    jump 0x6601
+    iinc 1
+    jump 0x6629
+    iinc 1
+    jump 0x6611
+    iinc 1
+    jump 0x6639
+    iinc 1
+    jump 0x6621
+    iinc 1
+    jump 0x6649
+    iinc 1
+    jump 0x6631
+    iinc 1
+    jump 0x6659
+    iinc 1
+    jump 0x6641
+    iinc 1
+    jump 0x6669
+    iinc 1
+    jump 0x6651
+    iinc 1
+    jump 0x6679
+    iinc 1
+    jump 0x6661
+    iinc 1
+    jump 0x6689
+    iinc 1
+    jump 0x6671
+    iinc 1
+    jump 0x6699
+    iinc 1
+    jump 0x6681
+    iinc 1
+    jump 0x66a9
+    iinc 1
+    jump 0x6691
+    iinc 1
+    jump 0x66b9
+    iinc 1
+    jump 0x66a1
+    iinc 1
+    jump 0x66c9
+    iinc 1
+    jump 0x66b1
+    iinc 1
+    jump 0x66d9
+    iinc 1
+    jump 0x66c1
+    iinc 1
+    jump 0x66e9
+    iinc 1
+    jump 0x66d1
+    iinc 1
+    jump 0x66f9
+    iinc 1
+    jump 0x66e1
+    iinc 1
+    jump 0x6709
+    iinc 1
+    jump 0x66f1
+    iinc 1
+    jump 0x6719
+    iinc 1
+    jump 0x6701
+    iinc 1
+    jump 0x6729
+    iinc 1
+    jump 0x6711
+    iinc 1
+    jump 0x6739
+    iinc 1
+    jump 0x6721
+    iinc 1
+    jump 0x6749
+    iinc 1
+    jump 0x6731
+    iinc 1
+    jump 0x6759
+    iinc 1
+    jump 0x6741
+    iinc 1
+    jump 0x6769
+    iinc 1
+    jump 0x6751
+    iinc 1
+    jump 0x6779
+    iinc 1
+    jump 0x6761
+    iinc 1
+    jump 0x6789
+    iinc 1
+    jump 0x6771
+    iinc 1
+    jump 0x6799
+    iinc 1
+    jump 0x6781
+    iinc 1
+    jump 0x67a9
+    iinc 1
+    jump 0x6791
+    iinc 1
+    jump 0x67b9
+    iinc 1
+    jump 0x67a1
+    iinc 1
+    jump 0x67c9
+    iinc 1
+    jump 0x67b1
+    iinc 1
+    jump 0x67d9
+    iinc 1
+    jump 0x67c1
+    iinc 1
+    jump 0x67e9
+    iinc 1
+    jump 0x67d1
+    iinc 1
+    jump 0x67f9
+    iinc 1
+    jump 0x67e1
+    iinc 1
+    jump 0x6809
+    iinc 1
+    jump 0x67f1
+    iinc 1
+    jump 0x6819
+    iinc 1
+    jump 0x6801
+    iinc 1
+    jump 0x6829
+    iinc 1
+    jump 0x6811
+    iinc 1
+    jump 0x6839
+    iinc 1
+    jump 0x6821
+    iinc 1
+    jump 0x6849
+    iinc 1
+    jump 0x6831
+    iinc 1
+    jump 0x6859
+    iinc 1
+    jump 0x6841
+    iinc 1
+    jump 0x6869
+    iinc 1
+    jump 0x6851
+    iinc 1
+    jump 0x6879
+    iinc 1
+    jump 0x6861
+    iinc 1
+    jump 0x6889
+    iinc 1
+    jump 0x6871
+    iinc 1
+    jump 0x6899
+    iinc 1
+    jump 0x6881
+    iinc 1
+    jump 0x68a9
+    iinc 1
+    jump 0x6891
+    iinc 1
+    jump 0x68b9
+    iinc 1
+    jump 0x68a1
+    iinc 1
+    jump 0x68c9
+    iinc 1
+    jump 0x68b1
+    iinc 1
+    jump 0x68d9
+    iinc 1
+    jump 0x68c1
+    iinc 1
+    jump 0x68e9
+    iinc 1
+    jump 0x68d1
+    iinc 1
+    jump 0x68f9
+    iinc 1
+    jump 0x68e1
+    iinc 1
+    jump 0x6909
+    iinc 1
+    jump 0x68f1
+    iinc 1
+    jump 0x6919
+    iinc 1
+    jump 0x6901
+    iinc 1
+    jump 0x6929
+    iinc 1
+    jump 0x6911
+    iinc 1
+    jump 0x6939
+    iinc 1
+    jump 0x6921
+    iinc 1
+    jump 0x6949
+    iinc 1
+    jump 0x6931
+    iinc 1
+    jump 0x6959
+    iinc 1
+    jump 0x6941
+    iinc 1
+    jump 0x6969
+    iinc 1
+    jump 0x6951
+    iinc 1
+    jump 0x6979
+    iinc 1
+    jump 0x6961
+    iinc 1
+    jump 0x6989
+    iinc 1
+    jump 0x6971
+    iinc 1
+    jump 0x6999
+    iinc 1
+    jump 0x6981
+    iinc 1
+    jump 0x69a9
+    iinc 1
+    jump 0x6991
+    iinc 1
+    jump 0x69b9
+    iinc 1
+    jump 0x69a1
+    iinc 1
+    jump 0x69c9
+    iinc 1
+    jump 0x69b1
+    iinc 1
+    jump 0x69d9
+    iinc 1
+    jump 0x69c1
+    iinc 1
+    jump 0x69e9
+    iinc 1
+    jump 0x69d1
+    iinc 1
+    jump 0x69f9
+    iinc 1
+    jump 0x69e1
+    iinc 1
+    jump 0x6a09
+    iinc 1
+    jump 0x69f1
+    iinc 1
+    jump 0x6a19
+    iinc 1
+    jump 0x6a01
+    iinc 1
+    jump 0x6a29
+    iinc 1
+    jump 0x6a11
+    iinc 1
+    jump 0x6a39
+    iinc 1
+    jump 0x6a21
+    iinc 1
+    jump 0x6a49
+    iinc 1
+    jump 0x6a31
+    iinc 1
+    jump 0x6a59
+    iinc 1
+    jump 0x6a41
+    iinc 1
+    jump 0x6a69
+    iinc 1
+    jump 0x6a51
+    iinc 1
+    jump 0x6a79
+    iinc 1
+    jump 0x6a61
+    iinc 1
+    jump 0x6a89
+    iinc 1
+    jump 0x6a71
+    iinc 1
+    jump 0x6a99
+    iinc 1
+    jump 0x6a81
+    iinc 1
+    jump 0x6aa9
+    iinc 1
+    jump 0x6a91
+    iinc 1
+    jump 0x6ab9
+    iinc 1
+    jump 0x6aa1
+    iinc 1
+    jump 0x6ac9
+    iinc 1
+    jump 0x6ab1
+    iinc 1
+    jump 0x6ad9
+    iinc 1
+    jump 0x6ac1
+    iinc 1
+    jump 0x6ae9
+    iinc 1
+    jump 0x6ad1
+    iinc 1
+    jump 0x6af9
+    iinc 1
+    jump 0x6ae1
+    iinc 1
+    jump 0x6b09
+    iinc 1
+    jump 0x6af1
+    iinc 1
+    jump 0x6b19
+    iinc 1
+    jump 0x6b01
+    iinc 1
+    jump 0x6b29
+    iinc 1
+    jump 0x6b11
+    iinc 1
+    jump 0x6b39
+    iinc 1
+    jump 0x6b21
+    iinc 1
+    jump 0x6b49
+    iinc 1
+    jump 0x6b31
+    iinc 1
+    jump 0x6b59
+    iinc 1
+    jump 0x6b41
+    iinc 1
+    jump 0x6b69
+    iinc 1
+    jump 0x6b51
+    iinc 1
+    jump 0x6b79
+    iinc 1
+    jump 0x6b61
+    iinc 1
+    jump 0x6b89
+    iinc 1
+    jump 0x6b71
+    iinc 1
+    jump 0x6b99
+    iinc 1
+    jump 0x6b81
+    iinc 1
+    jump 0x6ba9
+    iinc 1
+    jump 0x6b91
+    iinc 1
+    jump 0x6bb9
+    iinc 1
+    jump 0x6ba1
+    iinc 1
+    jump 0x6bc9
+    iinc 1
+    jump 0x6bb1
+    iinc 1
+    jump 0x6bd9
+    iinc 1
+    jump 0x6bc1
+    iinc 1
+    jump 0x6be9
+    iinc 1
+    jump 0x6bd1
+    iinc 1
+    jump 0x6bf9
+    iinc 1
+    jump 0x6be1
+    iinc 1
+    jump 0x6c09
+    iinc 1
+    jump 0x6bf1
+    iinc 1
+    jump 0x6c19
+    iinc 1
+    jump 0x6c01
+    iinc 1
+    jump 0x6c29
+    iinc 1
+    jump 0x6c11
+    iinc 1
+    jump 0x6c39
+    iinc 1
+    jump 0x6c21
+    iinc 1
+    jump 0x6c49
+    iinc 1
+    jump 0x6c31
+    iinc 1
+    jump 0x6c59
+    iinc 1
+    jump 0x6c41
+    iinc 1
+    jump 0x6c69
+    iinc 1
+    jump 0x6c51
+    iinc 1
+    jump 0x6c79
+    iinc 1
+    jump 0x6c61
+    iinc 1
+    jump 0x6c89
+    iinc 1
+    jump 0x6c71
+    iinc 1
+    jump 0x6c99
+    iinc 1
+    jump 0x6c81
+    iinc 1
+    jump 0x6ca9
+    iinc 1
+    jump 0x6c91
+    iinc 1
+    jump 0x6cb9
+    iinc 1
+    jump 0x6ca1
+    iinc 1
+    jump 0x6cc9
+    iinc 1
+    jump 0x6cb1
+    iinc 1
+    jump 0x6cd9
+    iinc 1
+    jump 0x6cc1
+    iinc 1
+    jump 0x6ce9
+    iinc 1
+    jump 0x6cd1
+    iinc 1
+    jump 0x6cf9
+    iinc 1
+    jump 0x6ce1
+    iinc 1
+    jump 0x6d09
+    iinc 1
+    jump 0x6cf1
+    iinc 1
+    jump 0x6d19
+    iinc 1
+    jump 0x6d01
+    iinc 1
+    jump 0x6d29
+    iinc 1
+    jump 0x6d11
+    iinc 1
+    jump 0x6d39
+    iinc 1
+    jump 0x6d21
+    iinc 1
+    jump 0x6d49
+    iinc 1
+    jump 0x6d31
+    iinc 1
+    jump 0x6d59
+    iinc 1
+    jump 0x6d41
+    iinc 1
+    jump 0x6d69
+    iinc 1
+    jump 0x6d51
+    iinc 1
+    jump 0x6d79
+    iinc 1
+    jump 0x6d61
+    iinc 1
+    jump 0x6d89
+    iinc 1
+    jump 0x6d71
+    iinc 1
+    jump 0x6d99
+    iinc 1
+    jump 0x6d81
+    iinc 1
+    jump 0x6da9
+    iinc 1
+    jump 0x6d91
+    iinc 1
+    jump 0x6db9
+    iinc 1
+    jump 0x6da1
+    iinc 1
+    jump 0x6dc9
+    iinc 1
+    jump 0x6db1
+    iinc 1
+    jump 0x6dd9
+    iinc 1
+    jump 0x6dc1
+    iinc 1
+    jump 0x6de9
+    iinc 1
+    jump 0x6dd1
+    iinc 1
+    jump 0x6df9
+    iinc 1
+    jump 0x6de1
+    iinc 1
+    jump 0x6e09
+    iinc 1
+    jump 0x6df1
+    iinc 1
+    jump 0x6e19
+    iinc 1
+    jump 0x6e01
+    iinc 1
+    jump 0x6e29
+    iinc 1
+    jump 0x6e11
+    iinc 1
+    jump 0x6e39
+    iinc 1
+    jump 0x6e21
+    iinc 1
+    jump 0x6e49
+    iinc 1
+    jump 0x6e31
+    iinc 1
+    jump 0x6e59
+    iinc 1
+    jump 0x6e41
+    iinc 1
+    jump 0x6e69
+    iinc 1
+    jump 0x6e51
+    iinc 1
+    jump 0x6e79
+    iinc 1
+    jump 0x6e61
+    iinc 1
+    jump 0x6e89
+    iinc 1
+    jump 0x6e71
+    iinc 1
+    jump 0x6e99
+    iinc 1
+    jump 0x6e81
+    iinc 1
+    jump 0x6ea9
+    iinc 1
+    jump 0x6e91
+    iinc 1
+    jump 0x6eb9
+    iinc 1
+    jump 0x6ea1
+    iinc 1
+    jump 0x6ec9
+    iinc 1
+    jump 0x6eb1
+    iinc 1
+    jump 0x6ed9
+    iinc 1
+    jump 0x6ec1
+    iinc 1
+    jump 0x6ee9
+    iinc 1
+    jump 0x6ed1
+    iinc 1
+    jump 0x6ef9
+    iinc 1
+    jump 0x6ee1
+    iinc 1
+    jump 0x6f09
+    iinc 1
+    jump 0x6ef1
+    iinc 1
+    jump 0x6f19
+    iinc 1
+    jump 0x6f01
+    iinc 1
+    jump 0x6f29
+    iinc 1
+    jump 0x6f11
+    iinc 1
+    jump 0x6f39
+    iinc 1
+    jump 0x6f21
+    iinc 1
+    jump 0x6f49
+    iinc 1
+    jump 0x6f31
+    iinc 1
+    jump 0x6f59
+    iinc 1
+    jump 0x6f41
+    iinc 1
+    jump 0x6f69
+    iinc 1
+    jump 0x6f51
+    iinc 1
+    jump 0x6f79
+    iinc 1
+    jump 0x6f61
+    iinc 1
+    jump 0x6f89
+    iinc 1
+    jump 0x6f71
+    iinc 1
+    jump 0x6f99
+    iinc 1
+    jump 0x6f81
+    iinc 1
+    jump 0x6fa9
+    iinc 1
+    jump 0x6f91
+    iinc 1
+    jump 0x6fb9
+    iinc 1
+    jump 0x6fa1
+    iinc 1
+    jump 0x6fc9
+    iinc 1
+    jump 0x6fb1
+    iinc 1
+    jump 0x6fd9
+    iinc 1
+    jump 0x6fc1
+    iinc 1
+    jump 0x6fe9
+    iinc 1
+    jump 0x6fd1
+    iinc 1
+    jump 0x6ff9
+    iinc 1
+    jump 0x6fe1
+    iinc 1
+    jump 0x7009
+    iinc 1
+    jump 0x6ff1
+    iinc 1
+    jump 0x7019
+    iinc 1
+    jump 0x7001
+    iinc 1
+    jump 0x7029
+    iinc 1
+    jump 0x7011
+    iinc 1
+    jump 0x7039
+    iinc 1
+    jump 0x7021
+    iinc 1
+    jump 0x7049
+    iinc 1
+    jump 0x7031
+    iinc 1
+    jump 0x7059
+    iinc 1
+    jump 0x7041
+    iinc 1
+    jump 0x7069
+    iinc 1
+    jump 0x7051
+    iinc 1
+    jump 0x7079
+    iinc 1
+    jump 0x7061
+    iinc 1
+    jump 0x7089
+    iinc 1
+    jump 0x7071
+    iinc 1
+    jump 0x7099
+    iinc 1
+    jump 0x7081
+    iinc 1
+    jump 0x70a9
+    iinc 1
+    jump 0x7091
+    iinc 1
+    jump 0x70b9
+    iinc 1
+    jump 0x70a1
+    iinc 1
+    jump 0x70c9
+    iinc 1
+    jump 0x70b1
+    iinc 1
+    jump 0x70d9
+    iinc 1
+    jump 0x70c1
+    iinc 1
+    jump 0x70e9
+    iinc 1
+    jump 0x70d1
+    iinc 1
+    jump 0x70f9
+    iinc 1
+    jump 0x70e1
+    iinc 1
+    jump 0x7109
+    iinc 1
+    jump 0x70f1
+    iinc 1
+    jump 0x7119
+    iinc 1
+    jump 0x7101
+    iinc 1
+    jump 0x7129
+    iinc 1
+    jump 0x7111
+    iinc 1
+    jump 0x7139
+    iinc 1
+    jump 0x7121
+    iinc 1
+    jump 0x7149
+    iinc 1
+    jump 0x7131
+    iinc 1
+    jump 0x7159
+    iinc 1
+    jump 0x7141
+    iinc 1
+    jump 0x7169
+    iinc 1
+    jump 0x7151
+    iinc 1
+    jump 0x7179
+    iinc 1
+    jump 0x7161
+    iinc 1
+    jump 0x7189
+    iinc 1
+    jump 0x7171
+    iinc 1
+    jump 0x7199
+    iinc 1
+    jump 0x7181
+    iinc 1
+    jump 0x71a9
+    iinc 1
+    jump 0x7191
+    iinc 1
+    jump 0x71b9
+    iinc 1
+    jump 0x71a1
+    iinc 1
+    jump 0x71c9
+    iinc 1
+    jump 0x71b1
+    iinc 1
+    jump 0x71d9
+    iinc 1
+    jump 0x71c1
+    iinc 1
+    jump 0x71e9
+    iinc 1
+    jump 0x71d1
+    iinc 1
+    jump 0x71f9
+    iinc 1
+    jump 0x71e1
+    iinc 1
+    jump 0x7209
+    iinc 1
+    jump 0x71f1
+    iinc 1
+    jump 0x7219
+    iinc 1
+    jump 0x7201
+    iinc 1
+    jump 0x7229
+    iinc 1
+    jump 0x7211
+    iinc 1
+    jump 0x7239
+    iinc 1
+    jump 0x7221
+    iinc 1
+    jump 0x7249
+    iinc 1
+    jump 0x7231
+    iinc 1
+    jump 0x7259
+    iinc 1
+    jump 0x7241
+    iinc 1
+    jump 0x7269
+    iinc 1
+    jump 0x7251
+    iinc 1
+    jump 0x7279
+    iinc 1
+    jump 0x7261
+    iinc 1
+    jump 0x7289
+    iinc 1
+    jump 0x7271
+    iinc 1
+    jump 0x7299
+    iinc 1
+    jump 0x7281
+    iinc 1
+    jump 0x72a9
+    iinc 1
+    jump 0x7291
+    iinc 1
+    jump 0x72b9
+    iinc 1
+    jump 0x72a1
+    iinc 1
+    jump 0x72c9
+    iinc 1
+    jump 0x72b1
+    iinc 1
+    jump 0x72d9
+    iinc 1
+    jump 0x72c1
+    iinc 1
+    jump 0x72e9
+    iinc 1
+    jump 0x72d1
+    iinc 1
+    jump 0x72f9
+    iinc 1
+    jump 0x72e1
+    iinc 1
+    jump 0x7309
+    iinc 1
+    jump 0x72f1
+    iinc 1
+    jump 0x7319
+    iinc 1
+    jump 0x7301
+    iinc 1
+    jump 0x7329
+    iinc 1
+    jump 0x7311
+    iinc 1
+    jump 0x7339
+    iinc 1
+    jump 0x7321
+    iinc 1
+    jump 0x7349
+    iinc 1
+    jump 0x7331
+    iinc 1
+    jump 0x7359
+    iinc 1
+    jump 0x7341
+    iinc 1
+    jump 0x7369
+    iinc 1
+    jump 0x7351
+    iinc 1
+    jump 0x7379
+    iinc 1
+    jump 0x7361
+    iinc 1
+    jump 0x7389
+    iinc 1
+    jump 0x7371
+    iinc 1
+    jump 0x7399
+    iinc 1
+    jump 0x7381
+    iinc 1
+    jump 0x73a9
+    iinc 1
+    jump 0x7391
+    iinc 1
+    jump 0x73b9
+    iinc 1
+    jump 0x73a1
+    iinc 1
+    jump 0x73c9
+    iinc 1
+    jump 0x73b1
+    iinc 1
+    jump 0x73d9
+    iinc 1
+    jump 0x73c1
+    iinc 1
+    jump 0x73e9
+    iinc 1
+    jump 0x73d1
+    iinc 1
+    jump 0x73f9
+    iinc 1
+    jump 0x73e1
+    iinc 1
+    jump 0x7409
+    iinc 1
+    jump 0x73f1
+    iinc 1
+    jump 0x7419
+    iinc 1
+    jump 0x7401
+    iinc 1
+    jump 0x7429
+    iinc 1
+    jump 0x7411
+    iinc 1
+    jump 0x7439
+    iinc 1
+    jump 0x7421
+    iinc 1
+    jump 0x7449
+    iinc 1
+    jump 0x7431
+    iinc 1
+    jump 0x7459
+    iinc 1
+    jump 0x7441
+    iinc 1
+    jump 0x7469
+    iinc 1
+    jump 0x7451
+    iinc 1
+    jump 0x7479
+    iinc 1
+    jump 0x7461
+    iinc 1
+    jump 0x7489
+    iinc 1
+    jump 0x7471
+    iinc 1
+    jump 0x7499
+    iinc 1
+    jump 0x7481
+    iinc 1
+    jump 0x74a9
+    iinc 1
+    jump 0x7491
+    iinc 1
+    jump 0x74b9
+    iinc 1
+    jump 0x74a1
+    iinc 1
+    jump 0x74c9
+    iinc 1
+    jump 0x74b1
+    iinc 1
+    jump 0x74d9
+    iinc 1
+    jump 0x74c1
+    iinc 1
+    jump 0x74e9
+    iinc 1
+    jump 0x74d1
+    iinc 1
+    jump 0x74f9
+    iinc 1
+    jump 0x74e1
+    iinc 1
+    jump 0x7509
+    iinc 1
+    jump 0x74f1
+    iinc 1
+    jump 0x7519
+    iinc 1
+    jump 0x7501
+    iinc 1
+    jump 0x7529
+    iinc 1
+    jump 0x7511
+    iinc 1
+    jump 0x7539
+    iinc 1
+    jump 0x7521
+    iinc 1
+    jump 0x7549
+    iinc 1
+    jump 0x7531
+    iinc 1
+    jump 0x7559
+    iinc 1
+    jump 0x7541
+    iinc 1
+    jump 0x7569
+    iinc 1
+    jump 0x7551
+    iinc 1
+    jump 0x7579
+    iinc 1
+    jump 0x7561
+    iinc 1
+    jump 0x7589
+    iinc 1
+    jump 0x7571
+    iinc 1
+    jump 0x7599
+    iinc 1
+    jump 0x7581
+    iinc 1
+    jump 0x75a9
+    iinc 1
+    jump 0x7591
+    iinc 1
+    jump 0x75b9
+    iinc 1
+    jump 0x75a1
+    iinc 1
+    jump 0x75c9
+    iinc 1
+    jump 0x75b1
+    iinc 1
+    jump 0x75d9
+    iinc 1
+    jump 0x75c1
+    iinc 1
+    jump 0x75e9
+    iinc 1
+    jump 0x75d1
+    iinc 1
+    jump 0x75f9
+    iinc 1
+    jump 0x75e1
+    iinc 1
+    jump 0x7609
+    iinc 1
+    jump 0x75f1
+    iinc 1
+    jump 0x7619
+    iinc 1
+    jump 0x7601
+    iinc 1
+    jump 0x7629
+    iinc 1
+    jump 0x7611
+    iinc 1
+    jump 0x7639
+    iinc 1
+    jump 0x7621
+    iinc 1
+    jump 0x7649
+    iinc 1
+    jump 0x7631
+    iinc 1
+    jump 0x7659
+    iinc 1
+    jump 0x7641
+    iinc 1
+    jump 0x7669
+    iinc 1
+    jump 0x7651
+    iinc 1
+    jump 0x7679
+    iinc 1
+    jump 0x7661
+    iinc 1
+    jump 0x7689
+    iinc 1
+    jump 0x7671
+    iinc 1
+    jump 0x7699
+    iinc 1
+    jump 0x7681
+    iinc 1
+    jump 0x76a9
+    iinc 1
+    jump 0x7691
+    iinc 1
+    jump 0x76b9
+    iinc 1
+    jump 0x76a1
+    iinc 1
+    jump 0x76c9
+    iinc 1
+    jump 0x76b1
+    iinc 1
+    jump 0x76d9
+    iinc 1
+    jump 0x76c1
+    iinc 1
+    jump 0x76e9
+    iinc 1
+    jump 0x76d1
+    iinc 1
+    jump 0x76f9
+    iinc 1
+    jump 0x76e1
+    iinc 1
+    jump 0x7709
+    iinc 1
+    jump 0x76f1
+    iinc 1
+    jump 0x7719
+    iinc 1
+    jump 0x7701
+    iinc 1
+    jump 0x7729
+    iinc 1
+    jump 0x7711
+    iinc 1
+    jump 0x7739
+    iinc 1
+    jump 0x7721
+    iinc 1
+    jump 0x7749
+    iinc 1
+    jump 0x7731
+    iinc 1
+    jump 0x7759
+    iinc 1
+    jump 0x7741
+    iinc 1
+    jump 0x7769
+    iinc 1
+    jump 0x7751
+    iinc 1
+    jump 0x7779
+    iinc 1
+    jump 0x7761
+    iinc 1
+    jump 0x7789
+    iinc 1
+    jump 0x7771
+    iinc 1
+    jump 0x7799
+    iinc 1
+    jump 0x7781
+    iinc 1
+    jump 0x77a9
+    iinc 1
+    jump 0x7791
+    iinc 1
+    jump 0x77b9
+    iinc 1
+    jump 0x77a1
+    iinc 1
+    jump 0x77c9
+    iinc 1
+    jump 0x77b1
+    iinc 1
+    jump 0x77d9
+    iinc 1
+    jump 0x77c1
+    iinc 1
+    jump 0x77e9
+    iinc 1
+    jump 0x77d1
+    iinc 1
+    jump 0x77f9
+    iinc 1
+    jump 0x77e1
+    iinc 1
+    jump 0x7809
+    iinc 1
+    jump 0x77f1
+    iinc 1
+    jump 0x7819
+    iinc 1
+    jump 0x7801
+    iinc 1
+    jump 0x7829
+    iinc 1
+    jump 0x7811
+    iinc 1
+    jump 0x7839
+    iinc 1
+    jump 0x7821
+    iinc 1
+    jump 0x7849
+    iinc 1
+    jump 0x7831
+    iinc 1
+    jump 0x7859
+    iinc 1
+    jump 0x7841
+    iinc 1
+    jump 0x7869
+    iinc 1
+    jump 0x7851
+    iinc 1
+    jump 0x7879
+    iinc 1
+    jump 0x7861
+    iinc 1
+    jump 0x7889
+    iinc 1
+    jump 0x7871
+    iinc 1
+    jump 0x7899
+    iinc 1
+    jump 0x7881
+    iinc 1
+    jump 0x78a9
+    iinc 1
+    jump 0x7891
+    iinc 1
+    jump 0x78b9
+    iinc 1
+    jump 0x78a1
+    iinc 1
+    jump 0x78c9
+    iinc 1
+    jump 0x78b1
+    iinc 1
+    jump 0x78d9
+    iinc 1
+    jump 0x78c1
+    iinc 1
+    jump 0x78e9
+    iinc 1
+    jump 0x78d1
+    iinc 1
+    jump 0x78f9
+    iinc 1
+    jump 0x78e1
+    iinc 1
+    jump 0x7909
+    iinc 1
+    jump 0x78f1
+    iinc 1
+    jump 0x7919
+    iinc 1
+    jump 0x7901
+    iinc 1
+    jump 0x7929
+    iinc 1
+    jump 0x7911
+    iinc 1
+    jump 0x7939
+    iinc 1
+    jump 0x7921
+    iinc 1
+    jump 0x7949
+    iinc 1
+    jump 0x7931
+    iinc 1
+    jump 0x7959
+    iinc 1
+    jump 0x7941
+    iinc 1
+    jump 0x7969
+    iinc 1
+    jump 0x7951
+    iinc 1
+    jump 0x7979
+    iinc 1
+    jump 0x7961
+    iinc 1
+    jump 0x7989
+    iinc 1
+    jump 0x7971
+    iinc 1
+    jump 0x7999
+    iinc 1
+    jump 0x7981
+    iinc 1
+    jump 0x79a9
+    iinc 1
+    jump 0x7991
+    iinc 1
+    jump 0x79b9
+    iinc 1
+    jump 0x79a1
+    iinc 1
+    jump 0x79c9
+    iinc 1
+    jump 0x79b1
+    iinc 1
+    jump 0x79d9
+    iinc 1
+    jump 0x79c1
+    iinc 1
+    jump 0x79e9
+    iinc 1
+    jump 0x79d1
+    iinc 1
+    jump 0x79f9
+    iinc 1
+    jump 0x79e1
+    iinc 1
+    jump 0x7a09
+    iinc 1
+    jump 0x79f1
+    iinc 1
+    jump 0x7a19
+    iinc 1
+    jump 0x7a01
+    iinc 1
+    jump 0x7a29
+    iinc 1
+    jump 0x7a11
+    iinc 1
+    jump 0x7a39
+    iinc 1
+    jump 0x7a21
+    iinc 1
+    jump 0x7a49
+    iinc 1
+    jump 0x7a31
+    iinc 1
+    jump 0x7a59
+    iinc 1
+    jump 0x7a41
+    iinc 1
+    jump 0x7a69
+    iinc 1
+    jump 0x7a51
+    iinc 1
+    jump 0x7a79
+    iinc 1
+    jump 0x7a61
+    iinc 1
+    jump 0x7a89
+    iinc 1
+    jump 0x7a71
+    iinc 1
+    jump 0x7a99
+    iinc 1
+    jump 0x7a81
+    iinc 1
+    jump 0x7aa9
+    iinc 1
+    jump 0x7a91
+    iinc 1
+    jump 0x7ab9
+    iinc 1
+    jump 0x7aa1
+    iinc 1
+    jump 0x7ac9
+    iinc 1
+    jump 0x7ab1
+    iinc 1
+    jump 0x7ad9
+    iinc 1
+    jump 0x7ac1
+    iinc 1
+    jump 0x7ae9
+    iinc 1
+    jump 0x7ad1
+    iinc 1
+    jump 0x7af9
+    iinc 1
+    jump 0x7ae1
+    iinc 1
+    jump 0x7b09
+    iinc 1
+    jump 0x7af1
+    iinc 1
+    jump 0x7b19
+    iinc 1
+    jump 0x7b01
+    iinc 1
+    jump 0x7b29
+    iinc 1
+    jump 0x7b11
+    iinc 1
+    jump 0x7b39
+    iinc 1
+    jump 0x7b21
+    iinc 1
+    jump 0x7b49
+    iinc 1
+    jump 0x7b31
+    iinc 1
+    jump 0x7b59
+    iinc 1
+    jump 0x7b41
+    iinc 1
+    jump 0x7b69
+    iinc 1
+    jump 0x7b51
+    iinc 1
+    jump 0x7b79
+    iinc 1
+    jump 0x7b61
+    iinc 1
+    jump 0x7b89
+    iinc 1
+    jump 0x7b71
+    iinc 1
+    jump 0x7b99
+    iinc 1
+    jump 0x7b81
+    iinc 1
+    jump 0x7ba9
+    iinc 1
+    jump 0x7b91
+    iinc 1
+    jump 0x7bb9
+    iinc 1
+    jump 0x7ba1
+    iinc 1
+    jump 0x7bc9
+    iinc 1
+    jump 0x7bb1
+    iinc 1
+    jump 0x7bd9
+    iinc 1
+    jump 0x7bc1
+    iinc 1
+    jump 0x7be9
+    iinc 1
+    jump 0x7bd1
+    iinc 1
+    jump 0x7bf9
+    iinc 1
+    jump 0x7be1
+    iinc 1
+    jump 0x7c09
+    iinc 1
+    jump 0x7bf1
+    iinc 1
+    jump 0x7c19
+    iinc 1
+    jump 0x7c01
+    iinc 1
+    jump 0x7c29
+    iinc 1
+    jump 0x7c11
+    iinc 1
+    jump 0x7c39
+    iinc 1
+    jump 0x7c21
+    iinc 1
+    jump 0x7c49
+    iinc 1
+    jump 0x7c31
+    iinc 1
+    jump 0x7c59
+    iinc 1
+    jump 0x7c41
+    iinc 1
+    jump 0x7c69
+    iinc 1
+    jump 0x7c51
+    iinc 1
+    jump 0x7c79
+    iinc 1
+    jump 0x7c61
+    iinc 1
+    jump 0x7c89
+    iinc 1
+    jump 0x7c71
+    iinc 1
+    jump 0x7c99
+    iinc 1
+    jump 0x7c81
+    iinc 1
+    jump 0x7ca9
+    iinc 1
+    jump 0x7c91
+    iinc 1
+    jump 0x7cb9
+    iinc 1
+    jump 0x7ca1
+    iinc 1
+    jump 0x7cc9
+    iinc 1
+    jump 0x7cb1
+    iinc 1
+    jump 0x7cd9
+    iinc 1
+    jump 0x7cc1
+    iinc 1
+    jump 0x7ce9
+    iinc 1
+    jump 0x7cd1
+    iinc 1
+    jump 0x7cf9
+    iinc 1
+    jump 0x7ce1
+    iinc 1
+    jump 0x7d09
+    iinc 1
+    jump 0x7cf1
+    jump 0x7d01
+    print 1
+    izero 0
+    end
+.end
@@ -14,6 +14,9 @@ Returning correct may mean raising an exception in some cases.
 
 import json
 import os
+import re
+import shutil
+import struct
 import subprocess
 import sys
 import unittest
@@ -37,6 +40,11 @@ class ViuaDisassemblerError(ViuaError):
     """
     pass
 
+class ViuaLinkerError(ViuaError):
+    """Base class for exceptions related to Viua linker.
+    """
+    pass
+
 class ViuaCPUError(ViuaError):
     """Base class for exceptions related to Viua CPU.
     """
@@ -74,6 +82,19 @@ def disassemble(path, out=None):
         raise ViuaDisassemblerError('{0}: {1}'.format(' '.join(asmargs), output.strip()))
     return (output, error, exit_code)
 
+def link(out, modules, opts=(), okcodes=(0,)):
+    """Link modules given as `modules` and put binary in `out`.
+    Raises exception if linking is not successful.
+    """
+    ldargs = ('./build/bin/vm/ld',) + opts + ('--out', out,) + tuple(modules)
+    p = subprocess.Popen(ldargs, stdout=subprocess.PIPE)
+    output, error = p.communicate()
+    output = output.decode('utf-8')
+    exit_code = p.wait()
+    if exit_code not in okcodes:
+        raise ViuaLinkerError('{0}: {1}'.format(' '.join(ldargs), output.strip()))
+    return (output, error, exit_code)
+
 def run(path, expected_exit_code=0):
     """Run given file with Viua CPU and return its output.
     """
@@ -159,9 +180,15 @@ class IntegerInstructionsTests(unittest.TestCase):
     def testCalculatingModulo(self):
         runTest(self, 'modulo.asm', '65', 0)
 
+    def testImmediateOperands(self):
+        runTestSplitlines(self, 'immediates.asm', ['42', '92', '276', '69', 'true', 'true', 'false', 'false', 'true', '47'])
+
     def testIntegersInCondition(self):
         runTest(self, 'in_condition.asm', 'true', 0)
 
+    def testSpecialisedInstructionsWithReferenceOperands(self):
+        runTestSplitlines(self, 'typed_references.asm', ['44', '44', '44', 'false', 'false', 'false'])
+
     def testBooleanAsInteger(self):
         runTest(self, 'boolean_as_int.asm', '70', 0)
 
@@ -255,6 +282,9 @@ class FloatInstructionsTests(unittest.TestCase):
     def testFEQ(self):
         runTest(self, 'eq.asm', 'true', 0)
 
+    def testImmediateOperands(self):
+        runTestSplitlines(self, 'immediates.asm', ['1.75', '2.0', '-4.0', '-0.5', 'true', 'true', 'false', 'false', 'true'])
+
     def testFloatsInCondition(self):
         runTest(self, 'in_condition.asm', 'true', 0)
 
@@ -276,6 +306,27 @@ class StringInstructionsTests(unittest.TestCase):
     def testHelloWorld(self):
         runTest(self, 'hello_world.asm', 'Hello World!', 0)
 
+    def testSTREQ(self):
+        runTest(self, 'equality.asm', ['true', 'false', 'true'], 0, lambda o: o.strip().splitlines())
+
+    def testNativeStringInstructions(self):
+        runTest(self, 'operations.asm', ['Hello World!', '12', 'World!', 'Hello', 'World', '6', '-1', '1', '-1', '0', '["a", "b", "", "c"]', '43'], 0, lambda o: o.strip().splitlines())
+
+    def testStringBuilder(self):
+        runTest(self, 'builder.asm', 'n:0 n:1 n:2 n:3 "n:"', 0)
+
+
+class AtomInstructionsTests(unittest.TestCase):
+    """Tests for atom instructions.
+    """
+    PATH = './sample/asm/atoms'
+
+    def testATOMEQ(self):
+        runTest(self, 'equality.asm', ['ok', 'true', 'false'], 0, lambda o: o.strip().splitlines())
+
+    def testCatchingAtomsByValue(self):
+        runTest(self, 'catching.asm', ['ok', 'any atom'], 0, lambda o: o.strip().splitlines())
+
 
 class VectorInstructionsTests(unittest.TestCase):
     """Tests for vector-related instructions.
@@ -300,6 +351,9 @@ class VectorInstructionsTests(unittest.TestCase):
     def testVAT(self):
         runTest(self, 'vat.asm', ['0', '1', '1', 'Hello World!'], 0, lambda o: o.strip().splitlines())
 
+    def testVectorViews(self):
+        runTest(self, 'slices.asm', ['[3, 4, 5, 6]', '[4, 5]', '2', '4', '36', '[3, 4, 5, 6]', '[3, 4, 5, 6]'], 0, lambda o: o.strip().splitlines())
+
 
 class CastingInstructionsTests(unittest.TestCase):
     """Tests for byte instructions.
@@ -315,6 +369,9 @@ class CastingInstructionsTests(unittest.TestCase):
     def testSTOI(self):
         runTest(self, 'stoi.asm', '69')
 
+    def testSTOIInvalid(self):
+        runTest(self, 'stoi_invalid.asm', 'exception encountered: invalid integer: "fourty two"')
+
 
 class RegisterManipulationInstructionsTests(unittest.TestCase):
     """Tests for register-manipulation instructions.
@@ -417,6 +474,9 @@ class FunctionTests(unittest.TestCase):
     def testReturningReferences(self):
         runTest(self, 'return_by_reference.asm', 42, 0, lambda o: int(o.strip()))
 
+    def testTailCalls(self):
+        runTestReturnsIntegers(self, 'tail_calls.asm', [1250025000, 100000, 5050])
+
     def testStaticRegisters(self):
         runTestReturnsIntegers(self, 'static_registers.asm', [i for i in range(0, 10)])
 
@@ -498,6 +558,69 @@ class StaticLinkingTests(unittest.TestCase):
         self.assertEqual(['42', ':-)'], output.strip().splitlines())
         self.assertEqual(0, excode)
 
+    def testUnusedLinkedFunctionsAreRemoved(self):
+        lib_name = 'print_N.asm'
+        assembly_lib_path = os.path.join(self.PATH, lib_name)
+        compiled_lib_path = os.path.join(COMPILED_SAMPLES_PATH, (lib_name + '.gc.wlib'))
+        assemble(assembly_lib_path, compiled_lib_path, opts=('--lib',))
+        bin_name = 'links.asm'
+        assembly_bin_path = os.path.join(self.PATH, bin_name)
+        compiled_bin_path = os.path.join(COMPILED_SAMPLES_PATH, (bin_name + '.gc.bin'))
+        output, error, exit_code = assemble(assembly_bin_path, compiled_bin_path, links=(compiled_lib_path,), opts=('--print-gc-sections',))
+        self.assertEqual("[asm:gc] removing unused function 'print_N::print_69' (8 bytes) from {0}\n".format(compiled_lib_path), output)
+        self.assertEqual((0, '42\n'), run(compiled_bin_path))
+        disassembly = disassemble(compiled_bin_path)[0]
+        self.assertIn('print_N::print_42', disassembly)
+        self.assertNotIn('print_N::print_69', disassembly)
+
+
+class DynamicLinkingTests(unittest.TestCase):
+    """Tests for linking modules at runtime.
+
+    Modules are assembled into current working directory as it is searched for modules first.
+    """
+    PATH = './sample/asm/linking/dynamic'
+
+    def testLinkingBasic(self):
+        assemble('./sample/asm/linking/static/print_N.asm', './print_N.vlib', opts=('--lib',))
+        runTestNoDisassemblyRerun(self, 'links.asm', '42')
+
+    def testLinkingCodeWithBranchesAndJumps(self):
+        assemble('./sample/asm/linking/static/jumplib.asm', './jumplib.vlib', opts=('--lib',))
+        runTestNoDisassemblyRerun(self, 'jumplink.asm', ['42', ':-)'], 0, lambda o: o.strip().splitlines())
+
+    def testOnlyCalledFunctionsAreMaterialized(self):
+        assemble('./sample/asm/linking/static/print_N.asm', './print_N.vlib', opts=('--lib',))
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'sample_asm_linking_dynamic_links.asm.bin')
+        assemble(os.path.join(self.PATH, 'links.asm'), compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--verbose', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual(['42', '[cpu] message: module "print_N": materialized 1 of 2 functions'], output.decode('utf-8').strip().splitlines())
+
+    def testOnlyEnteredBlocksAreMaterialized(self):
+        assemble('./sample/asm/linking/static/catcher.asm', './catcher.vlib', opts=('--lib',))
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'sample_asm_linking_dynamic_catching.asm.bin')
+        assemble(os.path.join(self.PATH, 'catching.asm'), compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--verbose', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(0, p.wait())
+        self.assertEqual(['42', '[cpu] message: module "catcher": materialized 1 of 1 functions and 2 of 3 blocks'], output.decode('utf-8').strip().splitlines())
+
+    def testCorruptedCodeIsRejectedWhenMaterialized(self):
+        assemble('./sample/asm/linking/static/print_N.asm', './print_N.vlib', opts=('--lib',))
+        with open('./print_N.vlib', 'rb') as ifstream:
+            image = bytearray(ifstream.read())
+        # replace opcode of `print 1` following `istore 1 42` with an invalid one
+        position = image.rfind(b'\x00\x01\x2a') + 3
+        image[position] = 0xff
+        with open('./print_N.vlib', 'wb') as ofstream:
+            ofstream.write(image)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'sample_asm_linking_dynamic_links.asm.corrupted.bin')
+        assemble(os.path.join(self.PATH, 'links.asm'), compiled_path)
+        exit_code, output = run(compiled_path, 1)
+        self.assertIn('uncaught object: Exception = Exception: "corrupted module: print_N: invalid opcode in function at byte 4"', output)
+
 
 class JumpingTests(unittest.TestCase):
     """
@@ -564,6 +687,555 @@ class AssemblerErrorTests(unittest.TestCase):
         self.assertEqual(1, exit_code)
 
 
+class AssemblerCacheTests(unittest.TestCase):
+    """Tests for reusing modules and functions assembled earlier.
+    """
+    PATH = COMPILED_SAMPLES_PATH
+    CACHE = os.path.join(COMPILED_SAMPLES_PATH, 'cache')
+
+    FOO = '.function: foo\n    strstore 1 "foo"\n    print 1\n    atom 2 \'ok\'\n    print 2\n    end\n.end\n\n'
+    BAR = '.function: bar\n    strstore 1 "bar"\n    print 1\n    end\n.end\n\n'
+
+    def write(self, name, source):
+        path = os.path.join(self.PATH, name)
+        with open(path, 'w') as ofstream:
+            ofstream.write(source)
+        return path
+
+    def setUp(self):
+        shutil.rmtree(self.CACHE, ignore_errors=True)
+
+    def testUnchangedModuleIsReused(self):
+        assembly_path = self.write('cached_module.asm', self.FOO + '.function: main\n    frame 0\n    call foo\n    izero 0\n    end\n.end\n')
+        first_path = os.path.join(self.PATH, 'cached_module.asm.bin')
+        second_path = os.path.join(self.PATH, 'cached_module.asm.cached.bin')
+        assemble(assembly_path, first_path, opts=('--cache', self.CACHE))
+        output, error, exit_code = assemble(assembly_path, second_path, opts=('--verbose', '--cache', self.CACHE))
+        self.assertIn('[asm:cache] message: image found in cache', output)
+        with open(first_path, 'rb') as first, open(second_path, 'rb') as second:
+            self.assertEqual(first.read(), second.read())
+        self.assertEqual((0, 'foo\nok\n'), run(second_path))
+
+    def testUnchangedFunctionsAreReused(self):
+        main = '.function: main\n    strstore 1 "main"\n    print 1\n    frame 0\n    call foo\n{0}    izero 0\n    end\n.end\n'
+        assembly_path = self.write('cached_functions.asm', self.FOO + main.format(''))
+        compiled_path = os.path.join(self.PATH, 'cached_functions.asm.bin')
+        assemble(assembly_path, compiled_path, opts=('--cache', self.CACHE))
+
+        # literals of bar are placed in constant pool before literals of foo so
+        # cached bytecode of foo must be updated to use new indexes
+        assembly_path = self.write('cached_functions.asm', self.BAR + self.FOO + main.format('    frame 0\n    call bar\n'))
+        output, error, exit_code = assemble(assembly_path, compiled_path, opts=('--verbose', '--cache', self.CACHE))
+        self.assertIn('[asm:cache] message: 1 of 4 functions and blocks found in cache', output)
+        self.assertEqual((0, 'main\nfoo\nok\nbar\n'), run(compiled_path))
+
+        uncached_path = os.path.join(self.PATH, 'cached_functions.asm.uncached.bin')
+        assemble(assembly_path, uncached_path)
+        with open(compiled_path, 'rb') as cached, open(uncached_path, 'rb') as uncached:
+            self.assertEqual(uncached.read(), cached.read())
+
+
+class LinkerTests(unittest.TestCase):
+    """Tests for relocatable objects and viua-ld.
+    """
+    PATH = COMPILED_SAMPLES_PATH
+
+    MAIN = '.function: main\n    strstore 1 "main"\n    print 1\n    frame 0\n    call foo\n    izero 0\n    end\n.end\n'
+    FOO = ('.function: unused\n    strstore 1 "unused"\n    print 1\n    end\n.end\n\n'
+           '.function: foo\n    istore 1 0\n    istore 2 2\n    .mark: loop\n    ilt 3 1 2\n    branch 3 body done\n'
+           '    .mark: body\n    strstore 4 "foo"\n    print 4\n    iinc 1\n    jump loop\n'
+           '    .mark: done\n    atom 5 \'ok\'\n    print 5\n    end\n.end\n')
+
+    def compile(self, name, source, opts=('--object',)):
+        assembly_path = os.path.join(self.PATH, name)
+        with open(assembly_path, 'w') as ofstream:
+            ofstream.write(source)
+        object_path = os.path.join(self.PATH, '{0}.{1}'.format(name, ('wlib' if '--lib' in opts else 'vo')))
+        assemble(assembly_path, object_path, opts=opts)
+        return object_path
+
+    def testLinkingObjects(self):
+        main_object = self.compile('ld_main.asm', self.MAIN)
+        foo_object = self.compile('ld_foo.asm', self.FOO)
+        executable_path = os.path.join(self.PATH, 'ld_main.bin')
+        output, error, exit_code = link(executable_path, (main_object, foo_object), opts=('--print-gc-sections',))
+        self.assertEqual("[ld:gc] removing unused function 'unused' (8 bytes) from {0}\n".format(foo_object), output)
+        self.assertEqual((0, 'main\nfoo\nfoo\nok\n'), run(executable_path))
+        self.assertNotIn('unused', disassemble(executable_path)[0])
+
+    def testLiteralsOfRemovedFunctionsAreDropped(self):
+        main_object = self.compile('ld_literals_main.asm', self.MAIN)
+        foo_object = self.compile('ld_literals_foo.asm', ('.function: unused\n    strstore 0 "dead"\n    fstore 1 0.5\n    end\n.end\n\n'
+                                                           '.function: foo\n    strstore 1 "foo"\n    print 1\n    fstore 2 1.5\n    print 2\n    end\n.end\n'))
+        executable_path = os.path.join(self.PATH, 'ld_literals.bin')
+        link(executable_path, (main_object, foo_object))
+        self.assertEqual((0, 'main\nfoo\n1.5\n'), run(executable_path))
+        with open(executable_path, 'rb') as ifstream:
+            self.assertNotIn(b'dead', ifstream.read())
+
+    def testLinkingInParallel(self):
+        main_object = self.compile('ld_parallel_main.asm', self.MAIN)
+        foo_object = self.compile('ld_parallel_foo.asm', self.FOO)
+        executable_path = os.path.join(self.PATH, 'ld_parallel.bin')
+        link(executable_path, (foo_object, main_object), opts=('-j', '2', '--no-gc'))
+        self.assertEqual((0, 'main\nfoo\nfoo\nok\n'), run(executable_path))
+        self.assertIn('.function: unused', disassemble(executable_path)[0])
+
+    def testLinkingObjectWithLibrary(self):
+        main_object = self.compile('ld_lib_main.asm', self.MAIN)
+        library_path = self.compile('ld_lib_foo.asm', self.FOO, opts=('--lib',))
+        executable_path = os.path.join(self.PATH, 'ld_lib.bin')
+        link(executable_path, (main_object, library_path))
+        self.assertEqual((0, 'main\nfoo\nfoo\nok\n'), run(executable_path))
+
+    def testDuplicateSymbol(self):
+        main_object = self.compile('ld_duplicate.asm', self.MAIN)
+        output, error, exit_code = link(os.path.join(self.PATH, 'ld_duplicate.bin'), (main_object, main_object), okcodes=(1,))
+        self.assertEqual("fatal: duplicate symbol 'main': defined in {0} and {0}".format(main_object), output.strip())
+
+    def testObjectIsNotRunnable(self):
+        main_object = self.compile('ld_not_runnable.asm', self.MAIN)
+        self.assertEqual((1, 'fatal: {0} is a relocatable object: link it with viua-ld\n'.format(main_object)), run(main_object, 1))
+
+
+class BytecodeFormatTests(unittest.TestCase):
+    """Tests for bytecode image format.
+    """
+    PATH = COMPILED_SAMPLES_PATH
+
+    def instructionSet(self):
+        """Return names of instructions indexed by their opcodes, and numbers of their integer operands.
+        """
+        with open('./include/viua/bytecode/opcodes.h') as ifstream:
+            opcodes = re.findall(r'^    ([A-Z]+)(?: = 0)?,', ifstream.read(), re.MULTILINE)
+        with open('./include/viua/bytecode/maps.h') as ifstream:
+            maps = ifstream.read()
+        maps = maps[maps.index('OP_INTEGER_OPERANDS'):maps.index('OP_NAMES')]
+        return [op.lower() for op in opcodes], {name: int(count) for name, count in re.findall(r'\{ "(\w+)",\s*(\d+) \}', maps)}
+
+    def downgrade(self, path, out, version=0):
+        """Rewrite executable image given as `path` into older format `version`.
+
+        Literals are embedded back into bytecode, integer operands of images older than version 4
+        are encoded as (bool, int) pairs, and jump targets of images older than version 3
+        are offsets from the beginning of the bytecode.
+        Format version 0 has no header, and uses 16 bit sizes and addresses.
+        Its instruction set ends with `halt`, as opcodes added later are appended after it.
+        """
+        with open(path, 'rb') as ifstream:
+            image = ifstream.read()
+        self.assertEqual(b'VIUA', image[:4])
+        blocks, functions, symtab, constpool = self.readSections(path)
+        constants = self.readConstants(constpool)
+        i = 5
+        for _ in ('blocks', 'functions', 'symtab', 'constpool', 'inlined'):
+            i += 4 + int.from_bytes(image[i:i+4], 'little')
+        bytecode = image[i+4:]
+
+        names, counts = self.instructionSet()
+        code, offsets, targets = b'', {}, []
+        i = 0
+        while i < len(bytecode):
+            instruction, name = i, names[bytecode[i]]
+            if version == 0:
+                self.assertLessEqual(bytecode[i], names.index('halt'), 'instruction not available in unversioned images: {0}'.format(name))
+            offsets[instruction] = len(code)
+            i += 1
+            operands = []
+            if counts[name]:
+                mode = bytecode[i]
+                i += 1
+                for n in range(counts[name]):
+                    if (mode >> (2*n)) & 2:
+                        operands.append(((mode >> (2*n)) & 1, int.from_bytes(bytecode[i:i+4], 'little', signed=True)))
+                        i += 4
+                    else:
+                        operands.append(((mode >> (2*n)) & 1, bytecode[i]))
+                        i += 1
+            literal = b''
+            if name in ('strstore', 'atom', 'fstore'):
+                kind, value = constants[operands.pop()[1]]
+                literal = (struct.pack('<f', value) if name == 'fstore' else (value.encode('utf-8') + b'\0'))
+            code += bytes([bytecode[instruction]])
+            if version < 4:
+                for n, (ref, value) in enumerate(operands):
+                    code += bytes([ref]) + (bytes([value]) if (name == 'bstore' and n == 1) else value.to_bytes(4, 'little', signed=True))
+            elif operands:
+                code += bytes([sum((ref | (0 if 0 <= value < 256 else 2)) << (2*n) for n, (ref, value) in enumerate(operands))])
+                code += b''.join((bytes([value]) if 0 <= value < 256 else value.to_bytes(4, 'little', signed=True)) for ref, value in operands)
+            code += literal
+            if name == 'ress':
+                code += bytecode[i:i+4]
+                i += 4
+            elif name in ('jump', 'branch'):
+                for _ in range(1 if name == 'jump' else 2):
+                    targets.append((len(code), instruction, instruction + int.from_bytes(bytecode[i:i+4], 'little', signed=True)))
+                    code += bytes(4)
+                    i += 4
+            elif name in ('closure', 'function', 'call', 'excall', 'try', 'eximport', 'link', 'catch'):
+                for _ in range(2 if name == 'catch' else 1):
+                    end = bytecode.index(b'\0', i) + 1
+                    code += bytecode[i:end]
+                    i = end
+        code = bytearray(code)
+        for field, instruction, target in targets:
+            target = offsets[target] - (offsets[instruction] if version >= 3 else 0)
+            code[field:field+4] = target.to_bytes(4, 'little', signed=True)
+
+        size_field = (2 if version == 0 else 4)
+        older = (b'' if version == 0 else (b'VIUA' + bytes([version])))
+        for section in (blocks, functions):
+            section = b''.join(name.encode('utf-8') + b'\0' + offsets[address].to_bytes(size_field, 'little') for name, address in section.items())
+            older += len(section).to_bytes(size_field, 'little') + section
+        if version >= 2:
+            older += bytes(4)   # symbol table is rebuilt by the loader so it may be left empty
+        older += len(code).to_bytes(size_field, 'little') + (bytes(14) if version == 0 else b'') + bytes(code)
+
+        with open(out, 'wb') as ofstream:
+            ofstream.write(older)
+
+    def readSections(self, path):
+        """Return ID sections (as name-to-address dictionaries), symbol table, and constant pool of image given as `path`.
+        """
+        with open(path, 'rb') as ifstream:
+            image = ifstream.read()
+        i = 5
+        sections = []
+        for _ in ('blocks', 'functions', 'symtab', 'constpool'):
+            section_size = int.from_bytes(image[i:i+4], 'little')
+            sections.append(image[i+4:i+4+section_size])
+            i += 4 + section_size
+        ids = []
+        for section in sections[:2]:
+            mapping, j = {}, 0
+            while j < len(section):
+                name_end = section.index(b'\0', j)
+                mapping[section[j:name_end].decode('utf-8')] = int.from_bytes(section[name_end+1:name_end+5], 'little')
+                j = name_end+5
+            ids.append(mapping)
+        return ids[0], ids[1], sections[2], sections[3]
+
+    def readConstants(self, constpool):
+        """Return entries of constant pool as (kind, value) pairs.
+        """
+        field = lambda n: int.from_bytes(constpool[n*4:n*4+4], 'little')
+        segment_count = field(0)
+        entry_count = field(1 + segment_count*2)
+        data = (1 + segment_count*2 + 1 + entry_count*2) * 4
+        entries = []
+        for e in range(entry_count):
+            kind, offset = field(2 + segment_count*2 + e*2), data + field(2 + segment_count*2 + e*2 + 1)
+            if kind == 2:
+                entries.append((kind, struct.unpack('<f', constpool[offset:offset+4])[0]))
+            else:
+                entries.append((kind, constpool[offset:constpool.index(b'\0', offset)].decode('utf-8')))
+        return entries
+
+    def lookup(self, symtab, name, kind):
+        """Look symbol up in symbol table the way the VM does.
+        """
+        field = lambda n: int.from_bytes(symtab[n*4:n*4+4], 'little')
+        bucket_count, entry_count = field(0), field(1)
+        h = 2166136261
+        for c in name.encode('utf-8'):
+            h = ((h ^ c) * 16777619) & 0xffffffff
+        bucket = h & (bucket_count-1)
+        strings = (2 + bucket_count + 1 + entry_count*4) * 4
+        for e in range(field(2+bucket), field(2+bucket+1)):
+            entry = 2 + bucket_count + 1 + e*4
+            name_offset = strings + field(entry+1)
+            if field(entry) == h and field(entry+3) == kind and symtab[name_offset:symtab.index(b'\0', name_offset)] == name.encode('utf-8'):
+                return field(entry+2)
+        return None
+
+    def testSymbolTable(self):
+        assembly_path = os.path.join('./sample/asm/blocks', 'catching_builtin_type.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'symtab_catching_builtin_type.asm.bin')
+        assemble(assembly_path, compiled_path)
+        blocks, functions, symtab, constpool = self.readSections(compiled_path)
+        self.assertEqual(['handle_integer', 'main_block'], sorted(blocks.keys()))
+        self.assertEqual(['__entry', 'main'], sorted(functions.keys()))
+        for name, address in functions.items():
+            self.assertEqual(address, self.lookup(symtab, name, 0))
+            self.assertEqual(None, self.lookup(symtab, name, 1))
+        for name, address in blocks.items():
+            self.assertEqual(address, self.lookup(symtab, name, 1))
+        self.assertEqual(None, self.lookup(symtab, 'no_such_function', 0))
+
+    def testRunningLegacyImage(self):
+        assembly_path = os.path.join('./sample/asm/functions', 'nested_calls.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'legacy_nested_calls.asm.bin')
+        legacy_path = os.path.join(COMPILED_SAMPLES_PATH, 'legacy_nested_calls.asm.legacy.bin')
+        assemble(assembly_path, compiled_path)
+        self.downgrade(compiled_path, legacy_path)
+        self.assertEqual(run(compiled_path), run(legacy_path))
+
+    def testRunningImagesOfBaselineAssembler(self):
+        # images in sample/legacy were built from these samples by the assembler that predates versioned format
+        for sample in ('string/hello_world.asm', 'looping.asm', 'functions/nested_calls.asm'):
+            assembly_path = os.path.join('./sample/asm', sample)
+            compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'baseline_{0}.bin'.format(sample.replace('/', '_')))
+            legacy_path = os.path.join('./sample/legacy', '{0}.bin'.format(os.path.splitext(os.path.basename(sample))[0]))
+            assemble(assembly_path, compiled_path)
+            self.assertEqual(run(compiled_path), run(legacy_path))
+
+    def testRunningLegacyImageWithJumps(self):
+        assembly_path = os.path.join('./sample/asm', 'looping.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'legacy_looping.asm.bin')
+        legacy_path = os.path.join(COMPILED_SAMPLES_PATH, 'legacy_looping.asm.legacy.bin')
+        assemble(assembly_path, compiled_path)
+        self.downgrade(compiled_path, legacy_path)
+        self.assertEqual(run(compiled_path), run(legacy_path))
+
+    def testRunningImageWithoutOperandModes(self):
+        assembly_path = os.path.join('./sample/asm/blocks', 'catching_builtin_type.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'v3_catching_builtin_type.asm.bin')
+        v3_path = os.path.join(COMPILED_SAMPLES_PATH, 'v3_catching_builtin_type.asm.v3.bin')
+        assemble(assembly_path, compiled_path)
+        self.downgrade(compiled_path, v3_path, 3)
+        self.assertEqual(run(compiled_path), run(v3_path))
+
+    def testRunningLegacyImageWithLiterals(self):
+        name = 'legacy_literals.asm'
+        with open(os.path.join(COMPILED_SAMPLES_PATH, name), 'w') as ofstream:
+            ofstream.write('.function: main\n    strstore 1 "Hello World!"\n    print 1\n    fstore 2 0.5\n    fadd 2 2 2\n    print 2\n')
+            ofstream.write('    atom 3 \'ok\'\n    print 3\n    istore 4 300\n    istore 5 4\n    iadd 4 @5 4\n    print 4\n    bstore 6 65\n    print 6\n    izero 0\n    end\n.end\n')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}.bin'.format(name))
+        legacy_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}.legacy.bin'.format(name))
+        assemble(os.path.join(COMPILED_SAMPLES_PATH, name), compiled_path)
+        # unversioned images have no atoms so the oldest versioned format is used
+        self.downgrade(compiled_path, legacy_path, 1)
+        self.assertEqual((0, 'Hello World!\n1.0\nok\n600\nA\n'), run(legacy_path))
+
+    def testRunningImageWithoutConstantPool(self):
+        for sample in ('string/operations.asm', 'atoms/catching.asm', 'float/in_condition.asm'):
+            assembly_path = os.path.join('./sample/asm', sample)
+            compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'v4_{0}.bin'.format(sample.replace('/', '_')))
+            v4_path = os.path.join(COMPILED_SAMPLES_PATH, 'v4_{0}.v4.bin'.format(sample.replace('/', '_')))
+            assemble(assembly_path, compiled_path)
+            self.downgrade(compiled_path, v4_path, 4)
+            self.assertEqual(run(compiled_path), run(v4_path))
+
+    def testRejectingFileWithoutMagicNumber(self):
+        for name, contents in (('empty.bin', b''), ('junk.bin', b'XXXXjunk that is not bytecode\n')):
+            path = os.path.join(COMPILED_SAMPLES_PATH, name)
+            with open(path, 'wb') as ofstream:
+                ofstream.write(contents)
+            excode, output = run(path, 1)
+            self.assertEqual('fatal: {0} is not a valid bytecode image'.format(path), output.strip())
+
+    def testConstantPoolIsDeduplicated(self):
+        name = 'deduplicated_constants.asm'
+        with open(os.path.join(COMPILED_SAMPLES_PATH, name), 'w') as ofstream:
+            ofstream.write('.function: main\n    strstore 1 "Hello World!"\n    print 1\n    fstore 2 0.5\n    fstore 3 0.5\n    fadd 2 3 2\n    print 2\n')
+            ofstream.write('    atom 4 \'ok\'\n    print 4\n    frame 0\n    call foo\n    izero 0\n    end\n.end\n\n')
+            ofstream.write('.function: foo\n    strstore 1 "Hello World!"\n    print 1\n    atom 2 \'ok\'\n    print 2\n    end\n.end\n')
+        runTest(self, name, ['Hello World!', '1.0', 'ok', 'Hello World!', 'ok'], 0, lambda o: o.strip().splitlines())
+        blocks, functions, symtab, constpool = self.readSections(os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.bin'.format(self.PATH[2:].replace('/', '_'), name)))
+        self.assertEqual([(0, 'Hello World!'), (2, 0.5), (1, 'ok')], self.readConstants(constpool))
+
+    def testRunningWithoutMmap(self):
+        assembly_path = os.path.join('./sample/asm/functions', 'nested_calls.asm')
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'no_mmap_nested_calls.asm.bin')
+        assemble(assembly_path, compiled_path)
+        p = subprocess.Popen(('./build/bin/vm/cpu', '--no-mmap', compiled_path), stdout=subprocess.PIPE)
+        output, error = p.communicate()
+        self.assertEqual(run(compiled_path), (p.wait(), output.decode('utf-8')))
+
+    def testImageLargerThan64KiB(self):
+        name = 'large_image.asm'
+        with open(os.path.join(COMPILED_SAMPLES_PATH, name), 'w') as ofstream:
+            # istore with an immediate wider than a byte is 7 bytes long so main alone takes more than 64KiB,
+            # and foo is placed at address beyond reach of 16 bit offsets
+            ofstream.write('.function: main\n')
+            ofstream.write(''.join('    istore 1 {0}\n'.format(i) for i in range(12000)))
+            ofstream.write('    print 1\n    frame 0\n    call foo\n    izero 0\n    end\n.end\n\n')
+            ofstream.write('.function: foo\n    istore 1 42\n    print 1\n    end\n.end\n')
+        runTest(self, name, ['11999', '42'], 0, lambda o: o.strip().splitlines())
+
+    def testFunctionWithThousandsOfMarks(self):
+        name = 'many_marks.asm'
+        with open(os.path.join(COMPILED_SAMPLES_PATH, name), 'w') as ofstream:
+            # every state jumps over the next one, and odd states are visited on the way back
+            ofstream.write('.function: main\n    istore 1 0\n    jump state_0\n')
+            ofstream.write(''.join('    .mark: state_{0}\n    iinc 1\n    jump state_{1}\n'.format(i, (i+2 if i % 2 == 0 else i-2)) for i in range(4000)))
+            ofstream.write('    .mark: state_4000\n    jump state_3999\n    .mark: state_-1\n    print 1\n    izero 0\n    end\n.end\n')
+        runTest(self, name, '4000')
+
+    def testParallelAssemblyIsDeterministic(self):
+        name = 'parallel_assembly.asm'
+        with open(os.path.join(COMPILED_SAMPLES_PATH, name), 'w') as ofstream:
+            # more literals than narrow operands can address, shared between functions
+            ofstream.write('.function: main\n')
+            ofstream.write(''.join('    frame 0\n    call f{0}\n'.format(i) for i in range(300)))
+            ofstream.write('    izero 0\n    end\n.end\n\n')
+            ofstream.write(''.join('.function: f{0}\n    strstore 1 "s{0}"\n    atom 2 \'a{1}\'\n    fstore 3 {1}.5\n    end\n.end\n\n'.format(i, i % 7) for i in range(300)))
+        source_path = os.path.join(COMPILED_SAMPLES_PATH, name)
+        sequential_path = '{0}.bin'.format(source_path)
+        parallel_path = '{0}.j4.bin'.format(source_path)
+        assemble(source_path, sequential_path)
+        assemble(source_path, parallel_path, opts=('--jobs', '4'))
+        with open(sequential_path, 'rb') as sequential, open(parallel_path, 'rb') as parallel:
+            self.assertEqual(sequential.read(), parallel.read())
+
+
+class OptimizationTests(unittest.TestCase):
+    """Tests for optimizations done by assembler.
+    """
+    PATH = './sample/asm/optimization'
+
+    def assembleOptimized(self, name, opts=('-O1', '--opt-report')):
+        assembly_path = os.path.join(self.PATH, name)
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, '{0}_{1}.O1.bin'.format(self.PATH[2:].replace('/', '_'), os.path.basename(name)))
+        output, error, exit_code = assemble(assembly_path, compiled_path, opts=opts)
+        return (compiled_path, output.strip().splitlines())
+
+    def testPeepholeOptimizations(self):
+        compiled_path, report = self.assembleOptimized('peephole.asm')
+        self.assertIn("[asm:opt] function 'main': line 12: constant-arithmetic: `imul 3 1 2` -> `istore 3 42`", report)
+        self.assertIn("[asm:opt] function 'main': line 17: constant-branch: `branch 4 less greater_or_equal` -> `jump less`", report)
+        self.assertIn("[asm:opt] function 'main': line 19: unreachable: removed `strstore 5 \"wrong\"`", report)
+        self.assertIn("[asm:opt] function 'main': line 25: empty-call: removed `call nothing`", report)
+        self.assertIn("[asm:opt] function 'main': line 26: jump-to-next: removed `jump report`", report)
+        self.assertEqual((0, '42\n'), run(compiled_path))
+
+    def testOptimizedCodeBehavesLikeUnoptimized(self):
+        runTest(self, 'peephole.asm', '42')
+        compiled_path, report = self.assembleOptimized('peephole.asm', opts=('-O1',))
+        self.assertEqual([], report)
+        disasm_path = '{0}.dis.asm'.format(compiled_path)
+        disassemble(compiled_path, disasm_path)
+        assemble(disasm_path, '{0}.bin'.format(disasm_path))
+        self.assertEqual((0, '42\n'), run('{0}.bin'.format(disasm_path)))
+
+    def testConstantPropagation(self):
+        runTest(self, 'propagation.asm', ['30', '15.0'], 0, lambda o: o.strip().splitlines())
+        compiled_path, report = self.assembleOptimized('propagation.asm', opts=('-O2', '--opt-report'))
+        self.assertIn("[asm:opt] function 'main': line 12: constant-propagation: `itof 4 3` -> `fstore 4 30`", report)
+        self.assertIn("[asm:opt] function 'main': line 14: constant-propagation: `fmul 6 4 5` -> `fstore 6 15`", report)
+        # bound and scale are known after the loop
+        self.assertIn("[asm:opt] function 'main': line 26: constant-branch: `branch 9 finish wrong` -> `jump finish`", report)
+        self.assertIn("[asm:opt] function 'main': line 28: dead-code: removed `strstore 10 \"wrong\"`", report)
+        self.assertIn("[asm:opt] function 'main': line 9: dead-store: removed `istore bound 10`", report)
+        self.assertEqual((0, '30\n15.0\n'), run(compiled_path))
+
+    def testPropagationBacksOffFromReferencesAndIndirection(self):
+        compiled_path, report = self.assembleOptimized('references.asm', opts=('-O2', '--opt-report'))
+        # only the frame of the call is shrunk, as registers of the function are all known
+        self.assertEqual(["[asm:opt] function 'main': line 39: frame-size: `frame 0` -> `frame 0 4`"], report)
+        self.assertEqual((0, '1\n1\n'), run(compiled_path))
+
+    def testRegisterAllocation(self):
+        runTest(self, 'registers.asm', '45')
+        compiled_path, report = self.assembleOptimized('registers.asm', opts=('-O2', '--opt-report'))
+        self.assertIn("[asm:opt] function 'sum': line 15: register-allocation: `ilt 50 i n` -> `ilt 4 3 1`", report)
+        self.assertIn("[asm:opt] function 'sum': line 18: register-allocation: `iadd 60 total i` -> `iadd 2 2 3`", report)
+        self.assertIn("[asm:opt] function 'sum': line 19: coalescing: removed `move total 60`", report)
+        self.assertIn("[asm:opt] function 'sum': line 23: coalescing: removed `move 70 total`", report)
+        self.assertIn("[asm:opt] function 'main': line 30: frame-size: `frame 1 128` -> `frame 1 5`", report)
+        self.assertEqual((0, '45\n'), run(compiled_path))
+        disassembly = disassemble(compiled_path)[0]
+        self.assertIn('frame 1 5', disassembly)
+        self.assertEqual(1, disassembly.count('move'))
+
+    def testTypeSpecialisation(self):
+        runTest(self, 'typed.asm', ['450', '450'], 0, lambda o: o.strip().splitlines())
+        compiled_path, report = self.assembleOptimized('typed.asm', opts=('-O2', '--opt-report'))
+        # argument of the function may hold anything, accumulator and counter are known to hold integers
+        self.assertIn("[asm:opt] function 'scaled': line 12: specialisation: `ilt 4 3 1` -> `gilt 4 3 1`", report)
+        self.assertIn("[asm:opt] function 'scaled': line 15: specialisation: `iadd 2 2 3` -> `tiadd 2 2 3`", report)
+        self.assertIn("[asm:opt] function 'scaled': line 19: specialisation: `imul 2 2 1` -> `gimul 2 2 1`", report)
+        self.assertEqual((0, '450\n450\n'), run(compiled_path))
+        # specialised instructions survive disassembly
+        disasm_path = '{0}.dis.asm'.format(compiled_path)
+        disassemble(compiled_path, disasm_path)
+        assemble(disasm_path, '{0}.bin'.format(disasm_path))
+        self.assertEqual((0, '450\n450\n'), run('{0}.bin'.format(disasm_path)))
+
+    def testImmediateOperands(self):
+        runTest(self, 'immediates.asm', ['18', '9.0'], 0, lambda o: o.strip().splitlines())
+        compiled_path, report = self.assembleOptimized('immediates.asm', opts=('-O2', '--opt-report'))
+        # known right-hand side operands are used directly, and known left-hand side ones are swapped in
+        self.assertIn("[asm:opt] function 'main': line 13: immediate-operand: `ilt 6 1 3` -> `ilti 6 1 10`", report)
+        self.assertIn("[asm:opt] function 'main': line 17: immediate-operand: `iadd 1 4 1` -> `iaddi 1 1 3`", report)
+        self.assertIn("[asm:opt] function 'main': line 22: immediate-operand: `fmul 7 5 7` -> `fmuli 7 7 0.5`", report)
+        # registers holding the constants are no longer needed
+        self.assertIn("[asm:opt] function 'main': line 9: dead-store: removed `istore 3 10`", report)
+        self.assertIn("[asm:opt] function 'main': line 11: dead-store: removed `fstore 5 0.5`", report)
+        self.assertEqual((0, '18\n9.0\n'), run(compiled_path))
+        disasm_path = '{0}.dis.asm'.format(compiled_path)
+        disassemble(compiled_path, disasm_path)
+        assemble(disasm_path, '{0}.bin'.format(disasm_path))
+        self.assertEqual((0, '18\n9.0\n'), run('{0}.bin'.format(disasm_path)))
+
+    def testTailCalls(self):
+        runTest(self, 'tail_calls.asm', ['500500', '2000'], 0, lambda o: o.strip().splitlines())
+        compiled_path, report = self.assembleOptimized('tail_calls.asm')
+        self.assertEqual(["[asm:opt] function 'count': line 41: tail-call: `call 5 count` -> `tailcall count`",
+                          "[asm:opt] function 'sum': line 18: tail-call: `call sum` -> `tailcall sum`"], [l for l in report if ': tail-call: ' in l])
+        # return value is now placed by the tail call
+        self.assertIn("[asm:opt] function 'count': line 42: unreachable: removed `move 0 5`", report)
+        self.assertEqual((0, '500500\n2000\n'), run(compiled_path))
+        disasm_path = '{0}.dis.asm'.format(compiled_path)
+        disassemble(compiled_path, disasm_path)
+        assemble(disasm_path, '{0}.bin'.format(disasm_path))
+        self.assertEqual((0, '500500\n2000\n'), run('{0}.bin'.format(disasm_path)))
+
+    def testFramesElidedByTailCallsAreCountedInStackTraces(self):
+        compiled_path, report = self.assembleOptimized('tail_call_stack_trace.asm')
+        self.assertIn("[asm:opt] function 'countdown': line 12: tail-call: `call countdown` -> `tailcall countdown`", report)
+        excode, output = run(compiled_path, 1)
+        trace = output[output.index('stack trace'):output.index('frame details')].strip().splitlines()
+        self.assertEqual(4, len(trace))
+        self.assertTrue(trace[1].strip().startswith('main/1('))
+        self.assertEqual('... 10 frames elided by tail calls', trace[2].strip())
+        self.assertEqual('countdown/1(0)', trace[3].strip())
+
+    def testInlining(self):
+        runTest(self, 'inlining.asm', ['49', '49', '100'], 0, lambda o: o.strip().splitlines())
+        # only functions named by .inline: directives are inlined at -O1
+        compiled_path, report = self.assembleOptimized('inlining.asm')
+        self.assertEqual(["[asm:opt] function 'main': line 50: inline: `call 4 clamp` -> `.inlined: clamp 1`",
+                          "[asm:opt] function 'main': line 54: inline: `call 5 clamp` -> `.inlined: clamp 1`"], [l for l in report if ': inline: ' in l])
+        self.assertEqual((0, '49\n49\n100\n'), run(compiled_path))
+        compiled_path, report = self.assembleOptimized('inlining.asm', opts=('-O2', '--opt-report'))
+        self.assertIn("[asm:opt] function 'main': line 42: inline: `call 2 square` -> `.inlined: square 1`", report)
+        self.assertIn("[asm:opt] function 'main': line 46: inline: `call 3 square` -> `.inlined: square 1`", report)
+        self.assertEqual((0, '49\n49\n100\n'), run(compiled_path))
+        disassembly = disassemble(compiled_path)[0]
+        self.assertNotIn('call', disassembly)
+
+    def testInlinedFunctionsAreNamedInStackTraces(self):
+        compiled_path, report = self.assembleOptimized('inlined_stack_trace.asm')
+        self.assertEqual(["[asm:opt] function 'main': line 19: inline: `call consume` -> `.inlined: consume 1`"], [l for l in report if ': inline: ' in l])
+        excode, output = run(compiled_path, 1)
+        trace = output[output.index('stack trace'):output.index('frame details')].strip().splitlines()
+        self.assertEqual(3, len(trace))
+        self.assertTrue(trace[1].strip().startswith('main/1('))
+        self.assertEqual('consume/1 (inlined)', trace[2].strip())
+
+    def testInliningFunctionsOfLinkedModules(self):
+        lib_path = os.path.join(COMPILED_SAMPLES_PATH, 'optimization_jumplib.asm.wlib')
+        assemble(os.path.join('.', 'sample', 'asm', 'linking', 'static', 'jumplib.asm'), lib_path, opts=('--lib',))
+        compiled_path = os.path.join(COMPILED_SAMPLES_PATH, 'optimization_inlining_linked.asm.bin')
+        output, error, exit_code = assemble(os.path.join(self.PATH, 'inlining_linked.asm'), compiled_path, links=(lib_path,), opts=('-O1', '--opt-report'))
+        self.assertIn("[asm:opt] function 'main': line 10: inline: `call 0 jumprint` -> `.inlined: jumprint 1`", output.splitlines())
+        self.assertEqual((0, '42\n:-)\n'), run(compiled_path))
+        self.assertNotIn('jumprint', disassemble(compiled_path)[0])
+
+    def testInliningUndefinedFunctionIsRejected(self):
+        assembly_path = os.path.join(COMPILED_SAMPLES_PATH, 'inline_undefined.asm')
+        with open(assembly_path, 'w') as ofstream:
+            ofstream.write('.signature: foo\n.inline: foo\n.function: main\n    izero 0\n    end\n.end\n')
+        output, error, exit_code = assemble(assembly_path, '{0}.bin'.format(assembly_path), okcodes=(1,))
+        self.assertEqual("fatal: .inline: directive names undefined function 'foo' at line 2", output.strip())
+
+    def testModulesWithAbsoluteJumpsAreNotOptimized(self):
+        compiled_path, report = self.assembleOptimized(os.path.join('..', 'absolute_jumping', 'absolute_jump.asm'))
+        self.assertEqual(['[asm:opt] note: module jumps to instruction indexes or byte offsets, code is not optimized'], report)
+        self.assertEqual((0, "Hey babe, I'm absolute.\n"), run(compiled_path))
+
+
 class ExternalModulesTests(unittest.TestCase):
     """Tests for C/C++ module importing, and calling external functions.
     """